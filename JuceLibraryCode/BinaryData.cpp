@@ -0,0 +1,2643 @@
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+#include <cstring>
+
+namespace BinaryData
+{
+
+//================== bg.png ==================
+static const unsigned char temp_binary_data_0[] =
+{ 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,4,176,0,0,3,32,8,6,0,0,0,51,224,155,2,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,0,9,112,72,89,115,0,0,29,
+134,0,0,29,134,1,93,162,19,129,0,0,255,165,73,68,65,84,120,94,236,157,117,120,20,247,22,134,191,89,79,118,227,174,132,132,16,220,221,93,139,187,23,168,208,150,186,220,186,247,214,219,91,119,247,150,150,
+42,45,45,53,90,220,221,221,131,196,125,119,206,253,35,36,77,102,128,6,136,236,110,190,247,121,222,167,201,57,103,40,36,187,59,51,103,126,2,69,49,8,0,74,41,245,104,75,62,203,122,246,29,36,170,234,58,183,
+46,103,233,215,195,71,79,214,253,89,213,109,109,253,28,86,20,67,185,127,187,201,100,18,95,95,187,174,142,210,243,181,166,222,83,37,175,105,237,107,155,210,202,84,81,20,185,244,178,235,165,48,175,160,244,
+92,230,114,58,229,243,207,127,150,166,45,90,235,234,105,205,155,156,210,80,6,13,29,173,139,83,74,169,55,88,114,205,83,55,49,89,186,247,234,175,203,87,150,6,131,65,12,34,42,8,33,196,211,41,249,44,219,182,
+121,61,10,243,10,181,233,242,40,10,242,179,243,49,120,216,88,124,61,231,67,109,182,218,209,126,14,183,108,211,1,245,234,55,40,23,243,70,68,212,210,127,123,155,246,157,241,225,135,223,35,48,56,88,91,70,
+200,121,163,125,79,85,23,37,175,233,178,175,109,66,42,147,152,216,120,44,254,123,45,222,126,253,25,152,172,166,210,184,98,80,48,122,116,111,172,94,186,24,215,222,120,47,108,62,62,229,142,35,53,203,142,
+109,91,48,239,219,57,218,48,33,132,120,5,37,215,60,46,213,5,163,241,159,115,83,101,163,170,197,255,31,93,103,139,82,74,61,217,251,30,122,78,114,179,114,36,63,59,87,78,165,158,146,163,7,83,101,215,246,253,
+178,116,241,122,121,239,253,111,229,242,171,111,149,148,134,77,116,199,213,180,118,187,67,102,223,120,143,184,156,69,146,121,42,83,6,13,241,254,167,181,102,139,69,198,79,190,92,242,178,114,228,137,167,
+223,212,229,41,165,148,22,27,27,159,32,187,182,239,215,143,42,62,195,232,98,79,30,237,99,177,90,197,104,52,234,226,148,82,74,221,95,131,161,106,71,160,43,167,191,32,132,16,175,34,174,78,93,152,76,38,228,
+100,103,33,47,47,23,206,162,34,228,229,229,105,203,220,134,14,157,123,224,211,247,63,68,92,66,36,20,69,41,141,79,157,121,45,62,124,231,229,114,181,222,132,159,159,63,166,205,188,30,39,78,28,197,15,223,
+124,134,172,172,76,109,9,33,23,68,135,206,221,33,2,44,91,252,167,54,85,229,52,110,214,18,117,234,214,195,188,111,190,208,166,8,185,96,198,79,190,28,31,191,255,170,54,252,15,34,128,162,192,85,228,66,187,
+206,93,177,102,229,50,109,133,71,16,18,26,134,91,255,243,8,190,248,252,93,172,90,177,88,155,38,132,16,82,139,49,104,3,132,16,226,13,28,216,183,7,123,118,237,64,234,177,163,200,202,204,116,235,230,21,0,
+228,230,102,35,50,50,4,202,233,155,15,72,241,179,5,127,255,32,109,169,87,145,149,149,137,23,255,247,16,62,253,240,13,54,175,72,165,209,161,115,119,204,253,244,115,248,250,250,106,83,213,130,221,238,192,
+149,51,174,193,77,183,61,4,95,95,187,54,77,200,5,177,106,197,223,56,121,44,77,27,254,7,69,193,169,212,116,244,187,100,184,199,54,175,0,224,228,137,227,216,189,119,39,174,154,117,11,66,195,194,181,105,66,
+8,33,181,28,221,176,44,74,41,165,213,111,247,94,253,229,216,161,212,210,41,32,159,125,54,95,124,124,124,116,117,148,254,155,33,161,97,242,223,199,95,149,187,239,127,70,252,252,252,117,121,111,54,41,57,
+69,182,108,220,37,67,70,140,215,229,170,211,152,216,120,121,224,145,23,164,207,128,161,186,28,173,60,251,14,24,42,237,59,117,215,197,189,213,250,13,26,203,146,69,235,116,211,7,247,239,62,36,215,222,120,
+175,196,196,197,235,142,241,84,91,182,110,95,163,231,192,150,109,58,72,108,124,130,0,144,62,253,135,72,171,54,29,116,53,148,82,74,171,93,93,128,82,74,105,53,91,178,123,71,92,157,186,242,235,47,203,228,
+254,135,158,23,95,95,95,93,29,165,255,166,162,40,242,232,147,175,139,170,186,100,217,146,13,18,22,17,161,171,241,102,67,66,195,164,117,187,78,186,120,77,216,162,85,59,153,118,217,117,186,56,173,28,199,
+76,152,46,143,62,249,186,68,197,196,234,114,222,104,201,121,194,98,181,202,229,87,223,42,187,182,239,151,87,95,255,92,186,246,232,43,118,187,67,87,71,47,206,225,163,39,203,140,43,111,18,0,242,209,199,243,
+206,107,215,98,254,14,40,165,180,202,212,5,40,165,148,86,179,138,98,56,227,162,135,138,162,232,98,148,158,203,161,35,39,202,161,125,71,228,178,89,55,75,120,68,164,46,79,171,87,179,217,162,139,185,163,209,
+177,113,226,112,248,253,243,125,76,92,185,166,136,187,57,124,204,100,249,236,243,159,37,204,139,94,227,41,13,27,139,213,106,213,197,75,84,20,67,185,197,205,125,52,15,57,206,118,30,161,23,102,82,114,138,
+252,231,174,199,165,71,159,129,242,205,215,127,72,116,108,156,174,230,108,42,138,161,92,19,43,46,62,65,90,182,105,175,171,163,148,82,122,126,114,13,44,66,106,41,81,49,177,218,16,169,97,138,215,223,253,
+231,99,185,120,49,247,127,22,116,39,228,223,176,88,44,48,153,76,24,58,102,20,222,124,245,105,164,30,59,170,45,33,213,76,81,81,161,54,116,81,52,108,220,12,177,241,9,218,112,165,224,231,31,128,160,224,16,
+24,141,38,40,6,247,254,236,57,184,127,15,110,189,109,22,142,123,193,107,60,32,48,8,47,189,250,41,54,172,94,133,183,222,254,10,54,155,77,91,2,160,120,155,114,85,149,210,141,62,242,114,115,129,211,231,138,
+146,115,71,201,22,227,228,226,217,181,99,27,94,252,223,67,184,233,218,219,241,242,27,207,225,240,193,3,218,146,179,34,162,66,81,138,23,222,111,222,178,45,158,122,242,53,212,79,105,170,45,35,132,212,114,
+140,70,35,26,53,109,193,245,254,206,19,93,87,139,82,234,57,150,125,202,103,181,90,165,94,74,195,115,142,218,9,11,143,144,57,115,22,72,118,122,150,244,232,51,80,0,72,163,166,45,36,40,56,68,87,75,171,223,
+146,223,167,246,233,45,165,21,209,108,177,136,195,239,159,81,52,212,251,236,213,119,176,252,56,111,145,140,153,48,67,130,67,66,117,249,139,49,56,36,84,58,117,235,85,186,238,15,173,122,253,252,3,100,238,
+87,191,149,91,207,234,177,167,222,16,179,197,51,70,238,213,6,195,194,35,206,121,93,117,54,21,197,32,143,61,245,134,236,223,115,88,158,124,230,45,142,142,115,99,45,86,171,248,249,7,232,226,148,86,181,70,
+163,81,166,95,126,131,220,126,247,227,18,28,90,185,231,116,47,86,23,160,148,122,136,101,27,28,29,187,244,148,45,27,119,73,65,110,158,252,56,111,145,180,105,223,89,215,0,105,216,184,153,108,219,188,167,
+244,34,57,47,59,87,62,254,120,158,124,247,237,159,181,102,13,17,74,41,245,116,71,141,155,38,233,39,210,229,190,135,158,211,229,46,214,6,141,155,74,203,214,156,234,84,93,182,106,219,81,84,213,37,7,246,30,
+150,233,87,220,40,175,191,57,71,84,213,37,157,187,245,214,213,94,172,205,90,182,145,126,131,134,235,226,180,234,28,49,102,138,172,91,179,173,214,109,166,225,105,54,111,217,70,62,250,232,7,185,100,248,184,
+11,106,86,82,122,49,222,243,192,179,146,118,60,77,110,188,245,65,93,142,158,81,93,128,82,143,54,58,54,78,174,190,238,78,185,252,234,91,42,253,233,244,197,154,148,220,64,38,78,155,37,33,161,97,186,220,249,
+90,118,132,206,144,17,227,37,47,43,87,183,43,81,199,46,61,75,235,83,26,54,145,99,135,142,235,106,74,26,89,3,6,143,212,253,63,106,147,218,102,31,165,180,118,107,179,217,36,49,185,190,219,62,149,111,216,
+184,153,52,104,212,84,23,175,12,77,38,147,46,70,171,70,171,205,38,205,90,182,145,184,58,117,75,191,238,51,96,168,196,213,169,171,171,189,88,253,3,2,100,224,144,209,50,100,196,120,222,164,87,147,193,33,
+161,124,64,232,1,214,111,208,88,210,78,164,137,170,186,228,142,123,158,224,8,72,90,173,70,197,196,74,135,206,61,164,121,203,182,188,31,169,152,186,0,165,30,107,64,96,144,188,248,242,199,165,141,153,215,
+223,156,83,37,83,227,146,83,26,201,165,151,93,39,161,97,225,186,220,217,12,8,12,148,29,91,246,138,170,186,100,197,210,141,82,39,33,81,87,115,62,150,124,192,13,31,61,73,215,144,82,85,151,172,93,181,85,162,
+162,139,47,154,252,253,3,100,253,218,237,197,57,151,83,87,171,170,46,249,225,251,191,116,255,143,218,36,79,24,148,82,155,205,38,29,58,119,47,93,252,190,78,221,36,185,229,246,71,164,78,221,36,93,45,165,
+158,168,213,106,147,38,205,91,93,244,57,207,225,231,39,151,94,118,189,212,77,76,214,229,40,245,68,135,140,28,47,7,246,30,150,130,220,124,137,171,195,105,212,148,186,171,92,196,157,120,21,77,155,183,70,
+98,157,120,172,90,190,5,0,112,217,140,17,24,60,116,156,182,236,162,48,153,204,232,212,165,55,66,66,194,81,88,80,160,77,159,17,187,221,129,119,223,153,139,164,148,56,0,64,235,118,13,241,244,83,175,107,203,
+206,11,17,21,41,13,155,224,147,119,222,208,166,176,125,243,94,76,158,62,1,71,14,31,4,0,60,250,196,107,104,210,44,169,56,121,122,241,87,45,135,143,165,106,67,94,79,114,131,70,120,231,221,175,209,162,117,
+59,136,20,47,124,219,186,93,39,132,132,134,105,75,201,89,176,90,173,240,241,241,133,209,100,66,147,230,173,144,210,176,137,182,132,16,143,33,50,58,22,159,189,255,17,110,186,229,65,12,25,57,30,227,39,94,
+129,39,254,123,59,58,117,237,163,45,37,196,35,41,40,200,199,198,117,171,75,207,121,23,138,127,64,16,162,163,227,144,153,149,161,77,17,226,145,124,247,213,167,232,214,187,59,166,207,186,30,249,121,121,218,
+52,33,196,141,208,117,181,40,245,84,109,54,155,132,132,134,73,157,186,137,242,218,27,95,200,218,85,91,165,75,143,62,186,186,139,177,94,253,6,210,189,247,0,221,246,213,103,211,104,52,74,191,65,195,197,89,
+88,88,110,196,211,227,79,189,169,171,61,95,19,18,235,201,210,69,235,203,253,185,75,23,175,151,160,224,96,1,80,58,69,96,204,132,25,82,144,155,175,27,117,85,226,222,93,7,37,254,34,71,132,121,162,61,251,12,
+20,85,117,201,177,67,169,18,30,25,37,93,123,246,147,140,147,25,146,148,156,162,171,173,110,61,101,49,247,1,151,140,146,15,62,248,94,62,249,228,71,89,252,247,58,105,219,161,171,174,134,82,79,209,104,52,
+74,231,110,189,165,168,160,160,244,243,113,241,223,235,36,32,48,80,87,75,41,165,148,82,74,47,222,200,232,24,233,211,127,136,152,76,102,93,238,12,234,2,244,34,244,241,241,149,176,211,83,15,42,170,209,104,
+146,230,45,219,150,174,119,16,27,87,71,162,57,95,254,162,53,26,141,98,177,90,117,241,139,213,215,215,87,124,124,124,116,241,179,105,50,153,36,38,46,94,186,246,236,39,139,254,90,35,170,234,146,95,230,47,
+189,232,245,185,74,118,179,113,56,252,164,239,192,97,242,205,55,127,200,99,79,190,46,41,141,154,148,230,75,196,233,69,222,179,210,50,69,85,93,178,124,233,70,57,126,228,132,168,170,75,78,28,61,41,117,234,
+214,190,230,21,0,241,243,243,151,199,159,122,67,210,79,164,203,198,117,59,36,43,45,83,230,206,253,77,87,119,54,35,163,98,202,253,30,91,182,233,32,189,250,13,190,232,29,188,254,105,92,21,55,32,221,185,129,
+21,24,24,36,125,250,15,145,149,203,54,73,175,126,131,117,121,90,94,147,201,36,173,218,118,148,200,232,24,1,32,195,70,77,146,27,111,125,176,116,202,26,117,15,187,247,30,32,233,39,210,101,201,162,117,165,
+211,208,123,244,30,32,143,60,246,10,119,18,163,244,95,236,217,119,144,116,234,214,75,23,119,103,21,69,145,132,196,122,110,125,190,165,148,82,111,181,109,251,206,242,232,19,175,85,116,195,11,93,128,94,160,
+62,190,190,210,165,123,31,153,121,229,77,165,55,39,21,49,54,174,142,60,247,226,135,50,243,202,155,196,223,63,64,186,246,236,39,245,27,54,214,213,209,138,169,40,6,49,26,141,186,120,77,88,182,9,1,64,2,131,
+130,165,109,135,46,98,183,219,117,181,103,210,120,142,133,116,207,53,50,199,104,52,150,54,175,20,69,41,173,235,209,103,160,60,247,226,135,18,24,20,44,141,154,182,144,213,43,182,200,176,81,147,116,199,215,
+6,75,126,38,137,245,234,203,174,237,251,75,71,91,92,50,124,172,174,246,108,246,25,48,84,150,46,94,47,79,62,243,182,188,242,218,103,226,114,22,137,170,186,228,209,39,94,151,168,243,248,12,208,122,182,223,
+171,59,91,27,71,240,157,175,161,97,225,242,217,103,243,69,85,93,178,109,243,30,121,241,149,79,74,71,102,110,223,188,71,26,55,107,169,59,134,214,156,245,27,54,150,248,132,68,73,172,87,95,6,14,25,37,169,
+135,139,55,193,224,107,157,210,179,219,189,247,0,41,204,47,144,235,111,190,95,151,115,103,27,54,110,38,243,126,248,91,122,246,29,116,94,15,41,207,164,39,158,195,41,165,180,38,13,139,136,148,166,45,90,139,
+161,98,247,240,186,0,189,0,131,67,66,165,93,199,174,50,108,212,68,121,253,141,47,164,103,223,65,186,154,179,105,181,217,164,101,155,246,114,223,131,207,201,39,159,254,36,225,145,81,186,26,122,126,186,203,
+212,171,146,6,150,162,40,186,167,246,21,217,1,232,250,155,239,147,33,35,198,235,226,255,252,25,229,71,234,148,143,253,99,113,35,235,236,63,11,119,248,89,85,183,37,255,222,254,131,134,203,243,47,125,36,
+255,185,235,113,233,217,119,144,152,205,21,219,121,166,228,248,241,83,174,40,55,29,243,182,59,31,149,223,127,91,41,67,71,78,208,29,83,17,203,254,30,58,119,235,45,15,253,247,37,153,126,249,13,220,21,204,
+195,173,83,55,73,54,148,108,164,112,22,143,31,61,33,221,122,246,211,29,75,107,78,171,205,38,191,45,88,46,170,234,146,147,199,78,202,157,247,62,37,254,110,186,43,33,165,238,224,219,239,204,149,157,219,246,
+73,88,120,132,46,231,206,70,199,196,201,11,47,125,36,59,183,237,147,206,221,122,235,242,148,82,74,221,70,93,128,94,128,1,1,129,210,178,77,123,169,155,148,44,29,187,244,148,222,253,46,57,239,233,107,97,
+17,17,178,118,245,182,243,106,126,81,247,183,108,19,169,236,136,168,127,107,24,249,248,250,202,222,157,7,165,48,191,64,146,83,26,233,242,103,250,127,156,235,207,44,155,43,249,251,104,107,104,197,45,249,
+121,42,138,65,126,158,191,68,138,242,11,228,137,167,139,215,53,179,219,29,98,54,87,104,14,247,25,255,204,248,132,68,121,255,131,239,202,53,55,38,76,185,82,87,79,61,199,215,222,248,66,215,176,58,147,123,
+119,29,148,198,77,91,232,142,167,53,103,100,84,180,244,232,51,80,34,163,162,117,57,74,105,121,147,146,83,164,110,146,103,238,76,104,243,241,145,97,163,38,74,116,76,156,46,71,41,165,212,109,212,5,232,5,
+90,182,65,224,231,231,127,206,102,194,217,172,151,220,64,146,146,83,36,32,48,80,76,23,112,3,76,189,195,146,102,84,175,190,131,37,227,100,134,252,240,253,95,18,18,26,166,171,163,149,231,191,53,0,207,100,
+73,189,175,221,46,13,26,53,189,160,166,149,86,171,205,38,171,87,110,17,85,117,137,203,233,148,194,252,226,197,164,211,142,167,73,124,66,241,58,121,212,115,52,153,76,242,159,187,30,211,53,170,206,229,251,
+31,124,231,54,211,160,169,222,243,253,156,160,148,186,159,81,49,177,23,61,85,144,82,74,105,245,107,40,191,33,33,185,24,202,110,73,156,149,149,121,65,91,20,239,220,177,21,190,190,118,220,117,207,83,240,
+243,243,215,166,73,45,65,68,133,136,138,223,126,249,1,173,59,182,199,190,131,135,208,180,121,27,109,25,169,68,74,126,230,231,131,136,10,69,49,32,55,39,7,91,55,111,64,81,81,17,12,6,3,20,229,226,62,90,125,
+108,22,0,128,179,176,8,162,10,0,192,47,208,14,171,213,166,169,36,238,78,231,238,125,240,232,67,183,106,195,231,100,221,198,117,80,79,255,222,137,123,80,246,61,125,190,159,19,132,16,247,98,242,165,87,227,
+242,43,110,134,213,230,163,77,17,66,136,199,19,26,30,129,192,160,96,109,216,107,184,184,187,44,82,233,68,68,70,225,193,251,158,194,210,101,11,145,118,234,164,54,77,206,147,139,109,36,212,36,138,98,128,
+162,40,216,185,125,43,174,158,53,30,139,22,254,170,45,33,255,66,241,207,176,106,95,3,218,155,89,85,61,255,70,88,9,138,98,64,65,126,62,198,76,28,141,147,199,210,96,182,89,96,182,153,1,0,179,174,189,3,59,
+182,109,209,30,66,220,28,85,213,188,22,68,138,61,11,219,54,239,197,123,111,63,127,193,175,33,82,53,240,247,65,136,247,96,52,26,177,124,249,95,72,79,59,165,77,85,42,62,62,190,48,24,138,175,65,124,237,118,
+132,133,71,192,104,52,106,203,8,33,164,82,25,116,201,24,204,190,254,110,109,216,171,208,13,203,162,53,231,61,15,60,43,203,150,108,224,244,193,74,178,236,180,176,178,187,241,209,218,225,176,81,19,101,228,
+216,169,186,184,187,90,118,109,178,216,248,4,121,233,213,79,229,224,190,35,50,102,194,116,93,45,245,28,223,126,103,174,110,154,224,153,252,238,219,133,18,27,159,160,59,158,82,74,169,231,57,101,250,53,210,
+178,77,123,105,218,162,181,172,92,190,73,14,236,61,44,73,201,41,186,58,74,41,173,76,19,18,235,201,194,63,86,73,239,254,67,116,57,47,81,23,160,53,232,232,241,211,165,91,207,254,186,56,61,127,75,154,87,108,
+90,213,94,19,235,213,151,250,13,206,189,0,190,59,121,166,215,172,127,0,119,60,243,116,131,130,67,100,249,146,13,186,134,85,137,127,47,92,35,93,123,246,213,29,71,41,165,212,115,237,210,163,175,44,248,121,
+153,172,91,189,77,84,213,37,31,127,242,163,248,250,250,234,234,40,173,42,141,220,193,186,214,90,167,110,146,76,155,121,93,165,63,24,109,218,188,149,116,238,222,71,23,175,102,117,1,74,189,194,226,70,128,
+34,0,36,165,97,19,233,209,123,128,174,134,82,119,84,219,196,186,80,235,38,37,75,235,182,29,197,98,177,232,114,180,122,44,249,61,134,132,134,201,179,207,191,95,218,180,42,42,40,148,191,23,174,145,113,147,
+46,147,160,224,16,221,113,148,82,74,61,91,135,195,79,214,175,41,110,94,189,240,242,199,226,112,248,233,106,60,209,232,152,56,121,230,185,119,165,85,219,142,186,28,117,47,47,189,236,122,185,245,246,71,116,
+113,90,59,12,13,11,175,180,77,192,124,124,125,165,75,143,62,242,227,188,69,114,215,125,79,87,202,125,202,69,168,11,80,234,21,150,52,175,162,98,98,229,224,222,35,162,170,46,185,253,238,199,197,199,135,79,
+191,104,237,176,78,66,162,116,232,210,163,210,167,36,7,4,6,113,155,241,243,176,236,73,254,218,27,239,149,31,127,92,36,61,250,12,212,213,81,74,41,245,46,155,54,111,37,93,123,244,211,197,61,85,31,31,31,249,
+253,183,21,162,170,46,121,229,181,207,42,253,250,130,86,174,51,175,188,73,210,142,167,201,144,17,227,197,100,226,239,138,94,184,13,155,52,151,119,223,251,70,230,125,255,183,116,232,220,67,151,175,102,117,
+1,74,189,194,146,155,198,235,110,190,175,220,116,157,169,51,102,235,106,41,165,122,237,118,199,25,183,25,143,175,83,87,46,189,252,122,105,211,174,179,36,167,120,206,20,77,74,169,103,171,40,138,4,6,6,73,
+147,102,45,165,99,151,158,165,15,170,40,165,85,175,195,225,87,58,146,184,168,160,64,92,206,34,233,213,119,176,174,142,186,143,38,179,89,122,246,29,36,175,190,246,185,36,123,208,146,26,212,253,108,220,172,
+165,244,27,52,92,66,194,194,117,185,234,214,8,224,126,205,162,238,132,156,145,192,160,96,196,196,197,35,61,45,237,244,235,199,221,17,196,196,198,227,131,55,223,128,195,223,183,52,186,99,231,81,44,248,249,
+219,114,149,132,144,242,248,251,7,96,236,164,203,96,52,26,113,240,192,222,114,185,140,140,116,152,76,38,220,125,231,195,8,9,139,198,162,191,22,64,206,177,179,30,113,111,140,70,35,162,99,227,144,156,210,
+8,9,137,201,48,155,205,232,222,107,32,250,246,31,134,67,135,246,34,43,51,67,123,8,241,32,66,195,194,49,116,228,68,100,100,156,66,102,70,186,54,237,49,116,238,222,7,207,63,251,22,198,142,157,140,209,35,
+199,98,229,218,85,216,190,117,147,182,140,16,82,69,68,70,199,96,96,255,97,88,183,110,59,14,28,60,142,32,63,7,86,175,223,130,53,171,150,106,75,137,155,160,170,42,246,238,222,129,223,127,255,17,25,233,167,
+224,116,58,181,37,132,84,136,188,156,28,236,218,185,13,217,153,153,218,84,181,163,120,72,39,130,212,48,77,154,183,194,188,185,223,193,100,50,162,97,179,134,200,72,79,211,150,184,37,245,27,52,194,213,215,
+220,129,46,237,91,225,88,234,41,108,220,186,13,159,126,242,6,214,172,90,166,45,37,132,148,193,63,32,16,131,134,140,198,129,253,123,176,104,225,175,218,52,108,54,27,90,183,235,140,162,194,66,172,88,182,
+8,34,170,182,132,120,8,54,155,13,99,39,94,134,71,238,185,19,1,129,14,28,56,112,12,1,254,14,68,199,135,227,142,123,158,194,83,143,221,9,151,203,165,61,140,120,0,9,137,245,240,229,103,223,162,101,235,20,
+108,221,180,7,211,175,156,129,101,139,23,106,203,60,130,122,245,27,96,224,37,99,17,22,26,129,63,126,159,135,223,126,249,65,91,66,8,169,66,20,69,41,125,88,21,16,24,4,255,128,64,100,102,164,87,217,61,129,
+197,98,129,211,233,132,170,242,250,130,16,82,30,221,176,44,74,203,106,182,88,100,225,159,171,165,48,191,64,6,13,29,45,70,163,81,87,227,206,42,138,65,66,195,194,197,207,207,95,151,163,148,82,10,241,245,
+245,149,177,19,103,202,250,53,219,229,216,161,84,217,187,235,96,233,180,235,187,239,127,70,87,79,221,223,196,228,250,114,42,245,84,185,41,244,69,133,133,50,98,204,20,93,45,165,148,186,155,241,9,137,98,
+119,56,116,113,74,105,237,150,83,8,201,191,98,183,59,144,210,168,21,110,188,229,6,252,249,235,79,30,56,85,72,144,155,155,131,194,194,2,109,130,16,66,8,128,162,162,34,108,218,176,6,27,183,109,195,177,83,
+185,120,235,189,183,176,126,227,110,168,69,38,28,61,126,28,127,252,246,211,233,235,6,114,54,44,22,11,98,227,235,84,217,104,132,243,197,238,240,195,77,55,92,15,147,217,84,26,51,24,12,88,189,118,59,22,255,
+173,31,85,73,8,33,238,68,118,86,38,10,11,139,120,238,33,132,148,131,83,8,201,191,162,40,10,28,126,126,200,114,131,57,175,23,138,162,24,0,128,211,156,8,33,228,95,104,222,178,13,20,197,128,130,194,124,24,
+20,3,246,237,217,133,236,236,44,109,25,41,67,179,22,173,145,148,220,8,155,55,173,193,182,205,27,181,233,26,163,99,151,158,88,240,195,119,240,241,243,1,0,220,255,240,11,120,236,145,255,160,176,128,15,116,
+8,33,132,16,226,121,176,129,229,5,36,214,171,15,155,143,47,54,111,88,171,77,17,66,8,33,231,141,197,106,69,189,228,6,112,58,157,92,40,187,2,76,158,126,13,166,140,155,132,169,151,142,198,177,163,135,181,
+233,26,65,81,12,16,81,209,166,125,103,12,29,58,1,139,151,252,134,159,190,255,74,91,70,8,33,132,16,226,49,176,129,229,5,12,31,61,9,215,205,186,30,183,222,121,61,86,45,95,162,77,19,66,8,33,164,10,49,153,
+205,104,221,182,19,0,193,202,101,139,220,102,209,123,163,209,88,109,127,23,95,95,95,56,252,252,145,122,236,168,54,69,8,33,132,16,82,41,112,13,44,47,32,34,42,6,151,79,159,130,198,141,218,98,247,254,221,
+56,184,191,252,150,247,132,120,2,86,155,13,35,70,79,193,177,163,135,144,151,155,171,77,19,66,136,219,162,170,42,14,29,216,135,99,71,14,65,85,75,214,25,173,121,68,228,244,20,250,226,191,79,217,175,43,27,
+85,85,81,144,95,0,85,173,158,134,25,33,132,16,226,137,24,77,38,36,212,77,66,118,86,38,119,217,188,0,138,23,6,34,30,141,159,95,0,68,21,28,56,124,4,6,131,81,155,38,196,35,112,58,157,240,243,15,192,176,145,
+147,49,116,228,4,52,109,222,74,91,66,8,33,110,141,211,233,116,187,181,22,203,254,125,170,242,239,230,114,185,80,84,84,168,13,19,66,8,33,164,12,162,170,200,206,202,244,192,141,209,220,3,54,176,188,128,94,
+61,6,226,211,175,127,194,93,119,94,131,69,11,43,103,103,33,69,81,74,23,62,39,164,58,112,57,157,248,232,221,151,225,114,57,241,242,179,207,160,81,19,54,176,8,33,132,144,218,134,193,96,128,209,244,207,238,
+153,132,16,226,77,168,170,138,227,169,199,46,106,138,191,197,106,69,80,112,8,140,198,218,55,120,133,83,8,61,28,69,81,144,153,157,129,31,191,255,162,82,215,157,48,153,76,48,26,141,156,10,64,170,21,151,203,
+133,117,107,150,99,199,190,67,88,183,102,25,210,78,157,212,150,16,66,8,33,196,139,9,9,11,71,80,96,48,114,114,178,57,66,129,16,66,206,64,207,190,131,48,118,236,12,236,220,185,5,153,25,233,218,180,87,195,
+6,150,135,163,40,10,14,236,223,83,233,91,156,139,20,119,135,171,106,173,12,66,206,197,246,173,27,217,188,34,164,6,72,172,87,31,221,123,13,196,241,212,35,200,203,205,69,96,96,16,112,122,106,28,33,132,84,
+7,133,133,133,200,61,221,188,114,135,6,150,143,143,15,102,92,113,19,6,14,26,137,160,208,80,108,219,178,65,91,66,8,33,213,138,179,168,8,48,156,238,3,100,101,106,211,94,13,27,88,228,44,184,207,34,180,231,
+75,92,157,186,104,212,164,57,78,28,63,198,155,46,55,98,216,168,73,136,140,142,193,190,61,59,181,41,29,138,98,128,162,112,147,84,66,170,147,75,70,140,195,47,223,127,143,41,83,198,194,225,23,135,149,171,
+22,163,78,221,36,248,249,7,224,120,234,49,109,57,33,132,84,9,170,170,194,229,114,185,69,243,10,0,92,46,21,102,139,17,89,217,153,56,176,127,15,142,30,62,168,45,33,132,144,106,37,35,35,29,219,182,108,168,
+117,205,43,176,129,69,188,9,127,255,0,116,238,214,7,221,186,247,135,191,127,16,54,174,95,197,6,150,27,17,30,25,133,196,196,6,88,187,122,153,54,117,6,60,183,129,74,72,101,18,17,25,133,156,236,108,109,184,
+82,81,20,3,250,12,24,130,185,159,126,8,95,63,31,168,46,21,237,218,53,69,183,206,253,177,255,240,49,236,220,177,25,233,105,167,180,135,17,66,72,45,65,112,240,192,62,108,223,186,145,205,43,66,200,69,227,
+227,227,139,160,144,16,228,230,84,237,245,157,183,194,85,186,137,215,224,116,58,97,181,217,176,111,223,78,124,61,231,125,228,231,231,107,75,170,148,128,128,192,90,185,144,94,69,249,235,247,159,241,238,
+155,207,105,195,132,144,179,208,111,224,48,108,94,183,9,67,70,140,215,166,42,149,200,232,104,124,249,209,7,176,250,90,225,44,40,130,234,84,225,44,112,162,93,135,198,120,231,141,103,209,184,41,55,84,32,
+132,16,66,8,169,12,76,38,19,18,18,234,193,196,205,42,46,8,206,209,33,164,18,232,213,119,48,162,99,226,241,217,199,111,161,168,144,219,136,19,66,46,142,225,163,39,227,243,15,223,130,201,98,66,65,110,1,250,
+14,30,138,191,255,92,160,45,171,20,76,102,51,38,77,157,133,55,94,124,10,70,179,17,174,34,23,76,214,226,139,170,215,223,252,18,55,222,112,41,242,114,115,181,135,17,66,8,33,132,16,82,237,148,204,213,161,
+148,158,167,22,171,85,46,155,117,179,252,246,235,114,73,74,78,209,229,41,165,244,124,84,20,131,140,153,48,67,84,213,37,121,217,185,178,106,249,102,81,85,151,172,90,177,89,87,91,217,246,25,48,84,10,114,
+243,69,85,93,114,104,223,81,233,211,127,136,4,4,6,201,127,238,122,76,226,19,234,234,234,221,213,54,237,59,203,187,239,127,43,211,102,94,39,254,254,1,50,227,202,155,228,177,167,222,144,230,173,218,234,106,
+41,117,7,239,121,224,89,121,237,141,47,36,62,33,81,0,72,235,118,157,36,174,142,231,188,231,0,72,84,116,140,46,70,41,165,148,86,129,186,0,165,30,165,197,98,145,208,240,8,177,88,173,186,92,85,59,104,216,
+24,201,78,207,146,190,3,135,233,114,244,252,85,20,131,46,70,105,109,210,108,177,200,61,15,60,43,95,126,249,171,116,236,210,83,44,86,171,116,233,222,71,218,118,232,162,171,173,10,123,247,31,34,111,189,51,
+87,234,55,108,44,190,190,118,249,237,215,21,162,170,46,121,241,149,79,196,104,52,234,234,221,209,207,63,255,89,84,213,37,170,234,146,165,139,215,151,126,125,228,192,49,137,141,171,163,171,55,26,141,82,
+39,33,209,163,154,116,212,59,180,218,108,242,210,171,159,150,190,70,83,15,31,151,215,222,248,66,14,236,57,44,195,71,79,210,213,187,179,67,71,78,144,193,195,198,138,175,175,93,151,163,148,82,74,43,81,93,
+128,210,243,50,32,48,72,166,95,126,131,116,235,217,79,151,171,14,19,147,234,75,167,174,189,196,199,215,87,151,171,106,71,140,153,34,195,71,79,214,197,233,249,171,40,134,210,6,150,221,225,16,63,63,127,93,
+13,165,180,106,60,83,243,248,219,111,254,44,30,9,150,149,43,239,127,240,157,212,111,216,88,87,227,78,154,76,38,153,52,237,42,201,205,204,46,109,8,104,189,114,246,237,186,227,130,66,66,101,204,132,25,210,
+167,255,16,93,142,210,170,244,227,79,126,212,189,70,75,156,247,195,223,98,119,56,116,199,184,171,161,97,225,178,119,215,65,153,125,227,61,186,28,165,148,186,155,161,97,225,114,213,181,119,200,157,247,62,
+37,209,49,113,186,60,117,107,117,1,74,43,108,227,166,45,100,205,202,45,162,170,46,113,57,139,228,173,119,230,74,187,142,93,117,117,85,169,201,108,214,197,170,75,79,25,145,224,9,150,220,64,135,133,71,200,
+162,191,214,202,250,53,219,165,83,215,158,186,58,74,105,213,171,40,6,185,108,214,205,178,115,219,62,233,63,104,132,116,233,209,87,30,120,228,69,177,218,108,186,90,119,209,102,179,201,202,229,155,138,27,
+0,46,103,185,102,192,230,13,59,101,230,149,55,233,70,181,180,237,208,69,234,212,77,18,139,197,162,251,243,40,173,74,75,166,10,171,170,75,92,154,215,107,137,151,94,118,189,238,56,119,246,138,171,111,147,
+245,107,182,73,80,112,136,46,71,41,165,238,228,149,215,252,71,50,79,101,200,170,229,155,165,121,203,54,186,60,117,107,117,1,74,43,100,215,30,125,37,237,120,154,238,226,43,63,39,87,250,13,26,174,171,247,
+38,203,142,22,162,23,111,217,159,229,136,49,83,36,63,59,87,84,213,37,59,182,236,229,186,26,148,214,160,14,63,63,1,32,145,81,209,210,186,93,39,49,187,121,163,103,214,236,219,117,77,0,85,117,201,242,165,
+27,165,126,131,198,226,112,20,255,123,112,250,115,39,42,58,166,70,166,159,211,202,51,34,50,202,227,214,139,106,218,162,181,100,158,202,44,189,126,114,185,156,197,77,215,18,79,191,110,103,92,113,163,238,
+88,119,55,174,78,93,190,167,60,68,139,197,34,38,147,73,23,167,53,111,167,110,189,36,49,169,190,46,78,43,71,69,81,36,174,78,93,105,208,176,137,4,6,5,235,242,212,189,53,2,184,95,179,168,59,113,3,236,118,
+7,76,102,19,156,69,69,218,148,91,208,189,215,0,252,252,253,55,176,251,251,2,34,80,20,165,52,103,52,155,144,150,174,226,167,121,95,149,59,198,155,176,219,237,80,12,10,92,78,167,54,69,46,8,129,217,98,193,
+216,137,51,209,166,85,71,188,240,234,171,88,179,110,59,10,138,128,223,126,251,9,89,153,25,218,3,8,33,213,64,225,233,93,85,179,179,179,112,228,208,1,168,46,151,182,196,173,56,122,228,0,14,30,205,70,110,
+182,138,7,255,251,40,158,126,230,89,44,93,177,17,135,142,166,98,229,138,191,112,226,120,106,153,106,65,118,86,22,92,110,254,111,34,103,167,115,247,62,24,51,110,6,54,110,88,133,244,180,83,218,180,91,98,
+48,24,240,195,55,191,160,78,98,52,68,149,226,224,63,151,80,165,40,138,130,215,222,120,19,59,183,111,209,166,220,154,204,140,116,190,167,60,0,155,143,15,250,244,31,138,140,244,52,100,103,103,105,211,164,
+134,240,243,243,199,168,241,151,226,186,89,55,98,225,162,223,113,236,232,97,109,9,169,36,50,51,210,113,226,68,42,242,243,243,180,41,226,1,232,186,90,180,102,181,218,108,50,117,198,108,233,63,104,132,46,
+231,14,118,238,222,167,116,141,17,237,176,247,194,188,124,121,228,177,87,61,238,105,232,249,202,209,87,149,175,195,225,39,215,222,116,175,180,106,211,65,151,163,148,210,127,83,81,20,93,76,107,69,106,168,
+103,56,120,232,24,217,187,235,160,12,26,58,70,151,115,119,123,247,31,34,69,249,5,165,163,175,92,206,211,150,249,94,85,93,242,211,143,139,221,126,212,35,117,79,141,70,227,57,215,18,117,56,252,228,202,107,
+254,35,9,137,245,116,57,90,51,42,138,65,218,118,232,42,253,7,13,151,224,144,80,93,158,210,218,170,197,106,149,192,192,160,178,49,125,17,173,89,141,70,163,132,132,133,185,229,26,2,13,27,55,147,99,135,143,
+23,55,175,156,229,135,186,171,170,75,10,114,243,185,85,57,165,148,82,74,171,204,168,232,88,89,186,120,131,76,157,49,91,151,243,20,159,125,238,189,127,166,16,158,110,94,149,76,33,44,121,56,88,148,95,32,
+177,241,250,157,51,41,253,55,141,70,163,248,7,4,232,226,148,82,234,105,246,236,51,72,162,162,99,75,191,55,104,135,99,213,54,234,38,37,99,244,248,233,136,137,139,215,166,106,12,151,203,133,147,199,143,35,
+237,212,73,109,170,198,233,209,235,18,132,69,6,23,127,163,0,40,51,117,112,253,154,29,120,245,237,57,24,54,124,50,98,227,19,254,57,136,16,66,8,33,164,146,200,204,72,199,148,233,99,241,254,219,47,106,83,
+30,195,107,175,63,5,213,233,130,162,40,80,148,211,179,8,21,5,80,148,210,25,133,235,214,237,196,201,114,211,94,9,169,24,46,151,11,153,25,238,183,252,66,80,72,8,30,126,236,21,76,190,244,106,222,43,16,66,
+254,149,49,19,166,195,207,63,0,71,14,31,44,141,213,250,6,86,97,97,1,252,252,2,96,181,216,180,41,114,6,190,251,230,99,188,246,198,28,20,230,21,150,174,123,181,109,243,94,140,155,116,25,122,244,233,132,235,
+103,79,198,199,31,190,138,220,156,108,237,161,132,16,15,194,100,50,193,104,52,106,195,165,24,12,181,254,244,81,138,205,230,131,176,136,72,109,152,16,82,69,228,228,100,99,199,54,207,90,27,74,203,214,77,
+27,240,212,115,239,22,127,115,186,113,229,44,56,189,238,169,162,32,243,84,22,198,77,30,137,188,188,218,189,62,75,139,86,109,17,26,22,174,13,19,15,37,63,55,15,1,254,1,120,255,237,23,176,98,209,50,180,105,
+223,73,91,66,8,33,165,248,249,5,98,219,214,13,218,176,126,152,22,165,231,50,36,52,76,62,255,252,103,201,203,202,145,187,238,125,90,234,212,77,212,213,80,74,61,219,115,237,180,57,110,210,101,178,117,211,
+110,153,53,251,118,105,218,162,181,92,118,213,45,242,200,99,175,136,143,143,207,233,99,107,215,58,67,86,171,149,235,85,80,74,207,219,160,224,16,217,190,101,79,233,116,193,110,189,250,203,255,94,248,64,
+118,108,221,43,93,186,247,209,213,123,187,193,33,161,18,17,25,37,0,196,238,112,200,195,143,190,44,46,151,83,62,255,252,103,73,170,159,34,117,234,38,201,117,55,221,39,126,254,103,95,219,137,186,191,73,201,
+41,146,157,158,37,170,234,146,213,43,182,136,201,100,214,213,80,247,147,235,241,209,154,240,44,175,59,93,128,210,127,181,94,74,67,25,56,100,148,216,78,223,176,82,74,61,87,147,201,44,38,115,197,46,32,71,
+141,155,86,110,221,187,178,235,224,61,243,220,123,98,52,26,117,199,80,74,41,61,179,17,145,81,114,211,109,15,75,223,1,195,4,128,152,205,150,90,123,109,21,28,18,42,14,63,63,105,220,180,133,172,91,179,77,
+183,198,234,169,212,83,178,108,201,6,177,219,29,18,26,22,126,182,27,27,234,230,222,118,231,163,162,186,156,242,215,159,171,229,154,235,239,22,147,201,164,171,113,87,131,67,66,197,215,215,174,139,215,6,
+71,143,191,84,134,140,156,192,7,118,212,29,212,5,40,165,180,218,108,211,190,179,36,37,55,208,197,105,245,105,119,56,36,58,38,78,23,47,87,99,183,203,245,55,223,95,122,51,225,44,44,18,103,81,81,233,247,37,
+139,14,63,255,210,71,226,235,235,171,59,190,172,161,97,225,210,170,45,119,155,164,148,210,178,214,134,209,171,73,245,82,164,110,82,178,46,94,98,155,246,157,37,237,120,218,25,31,146,168,170,75,78,165,158,
+146,142,93,122,202,180,153,215,74,251,78,221,116,199,83,247,54,185,65,35,249,232,163,31,164,77,251,206,186,156,39,216,180,121,43,121,246,185,247,100,248,232,201,18,16,24,40,6,195,153,71,170,123,163,109,
+59,116,145,125,187,15,201,19,79,191,41,22,171,85,151,167,180,186,52,2,184,95,59,167,144,16,66,170,139,184,58,117,145,149,149,129,244,180,83,218,20,169,38,84,151,11,38,147,9,38,147,9,138,82,188,248,107,
+89,66,195,194,241,243,143,127,97,198,244,209,16,17,136,75,45,221,192,65,68,74,235,20,69,65,187,182,77,176,104,217,90,236,220,126,246,245,105,226,19,18,209,180,121,59,236,219,179,3,5,5,5,218,52,33,132,16,
+47,195,96,48,160,91,207,126,120,233,127,175,97,197,154,85,216,183,103,151,182,4,189,250,14,194,47,63,124,7,71,128,29,16,193,63,103,151,211,8,224,99,183,97,250,212,201,232,216,166,13,158,253,223,211,200,
+204,72,215,86,85,27,38,179,25,170,170,106,195,228,28,88,173,86,252,241,231,47,216,178,113,157,54,229,17,164,30,59,130,172,156,76,188,248,204,255,48,116,200,88,196,213,109,132,198,205,90,35,51,51,13,39,
+79,120,247,134,11,135,15,238,199,238,3,71,16,20,28,134,213,43,22,161,160,32,95,91,66,72,181,161,235,106,81,74,41,173,125,134,134,133,75,163,166,45,202,13,143,87,20,69,230,206,253,237,244,168,171,194,226,
+145,87,167,71,95,149,232,114,254,243,132,124,214,236,219,37,48,40,248,172,235,103,225,244,246,222,67,70,140,147,43,103,255,71,204,21,156,186,72,41,165,212,115,13,8,12,146,171,174,189,67,250,15,26,161,203,
+1,144,182,29,186,74,81,126,65,241,136,94,167,83,175,171,216,146,115,205,128,193,35,117,127,70,117,219,189,247,0,25,55,233,114,93,156,122,191,97,225,17,50,103,206,130,210,215,227,163,79,190,174,171,161,
+148,86,141,220,70,138,16,66,46,144,58,117,147,112,233,101,215,33,32,48,72,155,242,72,78,28,79,197,246,173,155,144,151,151,91,26,155,58,243,90,12,27,214,29,170,211,5,17,20,239,245,94,178,199,251,25,72,77,
+61,252,175,163,233,92,46,23,254,250,227,103,132,135,69,162,110,82,125,109,154,16,66,136,151,145,145,158,134,87,94,120,20,243,231,205,213,166,224,112,248,225,219,57,115,96,180,152,202,141,234,45,251,53,
+164,120,148,47,0,140,26,119,41,126,250,225,171,127,114,53,196,198,117,171,80,55,161,30,250,14,28,166,77,17,47,70,81,12,56,158,122,12,227,198,13,192,13,183,60,8,87,145,11,190,54,31,109,25,33,164,10,209,
+117,181,40,165,148,254,187,245,27,52,146,67,251,142,200,31,191,175,148,158,125,6,234,242,158,108,201,8,170,193,195,198,138,203,233,44,55,226,74,107,217,245,73,92,78,167,116,234,218,75,247,231,157,73,135,
+195,79,124,124,206,189,94,86,109,50,32,48,80,236,118,71,233,247,126,254,1,210,170,77,135,115,142,102,163,148,82,79,215,98,181,202,216,137,51,101,197,210,141,255,156,75,92,229,71,96,149,196,135,142,156,
+160,59,190,38,141,141,171,35,223,124,253,135,199,174,233,68,207,95,237,46,205,173,218,118,148,121,63,252,45,125,250,15,209,213,82,74,43,95,142,192,34,132,92,48,6,131,1,245,27,52,130,213,102,211,166,106,
+5,187,118,108,195,248,75,167,194,229,116,97,252,184,25,176,219,29,218,18,143,231,135,111,62,199,67,143,189,2,131,209,0,197,80,126,232,149,162,40,48,24,13,40,202,47,194,140,43,110,194,101,179,110,65,78,
+102,14,124,43,248,115,200,206,206,42,55,218,171,54,209,161,75,15,140,30,127,41,28,126,126,165,177,233,151,223,136,79,62,254,1,241,9,137,8,10,14,193,143,223,255,129,235,174,189,163,220,113,132,16,226,109,
+20,22,20,224,243,143,223,66,167,110,173,112,217,85,183,34,47,43,15,138,162,64,49,40,16,145,210,115,207,244,203,111,196,183,95,125,162,61,188,70,57,120,96,31,190,252,246,75,216,124,56,2,167,182,32,82,188,
+238,89,201,136,192,213,43,150,96,246,245,211,107,237,245,12,33,53,129,174,171,69,41,165,21,81,81,12,226,31,16,88,235,71,136,152,76,102,241,247,15,16,163,209,168,203,121,178,37,255,158,54,237,59,151,27,
+101,229,44,44,210,237,12,85,178,139,97,92,157,4,177,219,107,231,22,211,231,227,21,87,223,38,167,82,211,100,212,184,105,165,177,182,29,187,202,225,3,199,36,227,100,186,28,59,148,42,25,39,211,37,49,185,190,
+238,88,74,41,245,38,21,197,80,238,252,153,148,156,34,175,191,57,167,248,92,115,250,28,115,221,77,247,233,142,163,244,66,173,77,187,7,82,122,46,235,38,37,75,143,62,3,203,205,0,240,0,117,1,74,41,165,84,0,
+136,201,100,146,15,62,252,94,82,15,31,151,37,139,214,203,137,163,39,79,79,21,44,146,201,211,175,145,110,61,251,201,192,33,163,36,56,36,180,86,108,1,95,89,218,124,124,164,97,147,230,18,19,23,95,46,30,30,
+17,41,255,125,226,53,249,243,143,85,210,164,89,75,221,113,148,82,234,141,150,52,177,76,38,83,105,172,75,247,62,114,112,239,17,121,232,191,47,233,234,41,189,16,173,54,155,92,117,237,29,114,235,29,255,213,
+229,40,173,109,118,234,218,75,210,142,167,137,170,186,100,250,21,55,234,242,238,170,114,250,11,66,60,154,166,205,91,193,106,243,193,202,101,139,180,41,66,200,5,162,40,6,40,10,144,88,175,62,50,51,210,113,
+234,228,9,36,55,104,140,175,63,159,139,45,219,247,97,248,240,158,186,250,146,161,245,132,16,66,200,249,98,48,24,96,48,24,224,116,58,1,0,119,223,255,12,54,110,92,141,175,231,124,168,45,37,228,188,104,222,
+170,45,30,121,240,25,12,26,212,9,67,71,78,196,247,95,127,166,45,33,164,214,144,220,160,17,86,46,90,2,191,160,226,101,63,242,178,242,80,191,73,99,28,58,176,79,91,90,227,24,141,70,180,105,223,25,22,139,21,
+235,215,174,132,17,192,253,218,34,82,181,88,109,54,152,77,102,4,6,5,67,21,181,244,36,77,46,28,255,192,64,220,126,219,67,216,189,111,39,142,30,57,164,77,159,17,139,213,138,186,73,201,200,207,203,67,81,81,
+145,54,77,8,129,64,68,112,234,228,9,228,228,100,67,85,85,156,72,61,134,31,127,254,9,223,125,55,7,153,153,25,80,20,67,153,231,32,124,30,66,8,33,228,194,41,187,243,96,221,164,100,196,215,169,135,171,102,
+94,142,92,167,96,239,174,237,40,44,44,44,87,79,72,69,185,254,198,251,48,125,218,48,156,60,150,134,219,239,188,5,121,185,92,179,138,212,94,194,194,35,176,98,237,102,252,252,235,223,56,158,154,131,160,128,
+0,252,252,219,2,28,62,116,64,91,90,227,24,12,6,92,50,108,2,62,120,243,101,172,217,184,29,28,129,85,141,52,105,214,18,141,155,181,70,221,132,100,36,38,36,161,99,155,102,120,250,197,151,240,238,155,207,105,
+75,73,5,136,140,138,134,159,127,32,118,108,219,12,0,24,49,102,50,2,2,66,202,253,60,167,93,118,29,182,110,94,135,101,139,255,44,115,100,49,29,187,244,196,167,239,127,136,156,156,124,220,120,251,45,152,255,
+131,126,107,103,79,197,96,48,64,85,57,18,134,16,66,8,33,158,69,201,131,145,118,29,187,98,200,208,9,152,117,233,88,4,135,7,34,177,94,10,246,238,222,169,45,39,164,66,52,109,209,26,111,191,246,62,238,255,
+239,253,248,225,155,47,180,105,66,106,53,70,163,17,0,224,114,185,180,41,183,192,108,54,99,224,144,209,216,181,115,43,160,157,83,72,171,206,203,175,186,181,120,59,250,194,194,210,69,41,39,78,155,165,171,
+163,21,51,52,44,92,166,206,152,45,14,135,95,105,44,60,50,170,92,205,181,55,222,43,191,46,88,46,221,123,13,144,8,77,110,248,232,73,146,149,150,41,170,234,146,220,204,28,233,208,185,135,238,255,225,105,246,
+31,60,66,110,188,245,1,241,15,8,208,229,40,165,148,82,74,61,197,39,158,126,83,14,238,59,34,199,143,156,144,17,99,166,112,225,109,64,234,36,36,74,64,96,144,46,78,41,165,181,69,131,182,187,69,170,142,31,
+190,253,20,167,142,167,195,96,42,238,112,102,158,202,194,162,133,191,104,203,72,5,57,113,60,21,133,69,133,184,244,178,27,78,63,173,3,82,143,30,41,87,243,197,103,111,193,229,114,225,205,151,95,197,29,119,
+61,81,218,93,78,78,105,132,103,31,123,12,249,249,133,152,56,117,22,70,79,158,134,163,71,220,111,200,100,69,49,26,141,184,250,250,187,240,223,251,31,193,154,213,75,145,157,157,173,45,33,132,16,66,8,241,
+24,254,250,123,1,118,239,57,140,49,83,166,96,238,23,31,112,100,57,128,140,140,116,20,228,231,107,195,228,60,41,185,111,32,132,120,22,138,162,0,218,142,22,173,26,21,165,248,169,81,199,46,61,229,200,129,
+99,146,155,149,35,195,70,77,210,213,209,243,179,126,195,198,242,241,39,63,74,116,108,92,105,204,100,50,137,162,24,74,127,230,205,90,180,145,151,95,253,84,70,141,155,86,186,187,77,195,198,205,228,179,207,
+230,75,191,65,195,117,127,166,39,106,182,88,100,194,148,43,164,109,135,46,229,226,101,119,243,161,148,82,74,41,245,68,185,203,45,173,44,13,134,127,238,17,40,165,158,39,215,192,170,38,74,58,253,34,42,162,
+162,99,97,247,243,195,206,109,91,160,40,74,185,5,43,201,249,19,17,21,141,156,172,44,100,103,103,1,0,76,38,19,68,4,170,90,252,115,213,238,138,166,221,41,173,100,173,5,111,252,61,88,109,54,62,169,35,132,
+16,66,106,41,126,126,254,152,50,125,54,230,124,246,54,82,143,29,213,166,9,169,117,112,157,88,66,60,27,54,176,170,25,109,243,132,148,199,110,119,160,200,89,132,194,130,2,109,234,130,40,219,56,60,27,252,
+157,16,66,8,33,196,27,49,153,205,88,179,114,51,142,30,59,137,241,19,135,224,228,137,227,218,18,66,106,5,245,27,54,70,189,228,134,152,247,237,28,68,70,197,160,223,192,17,216,176,126,5,214,172,92,166,45,
+37,132,184,49,70,0,247,107,131,164,242,112,56,252,96,52,154,96,54,155,224,227,107,71,65,1,71,195,156,11,155,205,6,5,10,138,138,138,180,169,11,164,100,180,225,185,248,183,188,231,97,50,153,225,240,243,231,
+235,141,16,66,8,169,197,168,170,138,197,203,151,66,49,249,224,170,43,174,199,161,163,135,112,96,223,30,109,153,219,97,48,26,107,124,100,124,80,112,8,44,22,11,10,42,233,161,42,169,89,12,70,35,78,30,63,134,
+209,19,102,224,179,247,223,199,228,201,163,16,30,154,132,207,63,127,31,13,155,52,71,108,92,29,28,61,114,72,123,24,33,196,205,96,3,171,138,241,181,59,0,17,20,22,22,64,85,85,183,221,154,210,93,176,217,108,
+200,47,200,231,208,222,139,68,81,20,190,222,136,142,203,174,186,5,3,7,143,194,170,21,139,42,177,73,76,8,33,196,157,57,118,228,48,22,253,245,43,14,29,61,132,130,130,60,28,62,228,254,155,214,152,204,102,
+168,103,185,134,41,94,42,2,85,254,0,178,110,98,50,252,252,2,112,226,120,170,54,69,60,144,220,156,108,180,110,223,25,115,62,121,7,126,1,118,0,128,17,10,82,211,179,240,242,179,47,98,195,150,173,216,188,113,
+173,246,48,66,200,89,240,243,15,64,76,76,60,84,151,171,90,27,253,156,66,72,220,10,31,31,31,20,22,22,178,241,66,72,37,211,177,75,15,44,90,248,43,0,224,149,215,191,192,141,215,77,69,97,97,161,182,140,16,
+66,8,113,107,170,107,233,7,131,161,120,25,10,62,84,245,14,154,183,108,131,5,243,126,194,182,29,7,240,247,178,21,136,139,137,197,37,253,59,195,47,200,129,251,31,126,1,15,222,123,131,246,16,66,200,57,232,
+216,181,39,38,77,184,28,31,127,250,22,22,159,190,199,168,14,216,192,34,132,144,90,192,181,55,221,139,7,110,191,1,102,179,25,7,15,165,162,103,191,110,56,122,152,67,229,9,33,132,120,30,213,213,196,34,222,
+131,191,127,0,226,235,38,97,199,182,205,40,200,207,135,213,102,195,115,47,124,128,248,232,40,76,154,50,12,105,167,78,106,15,33,132,156,3,147,217,12,155,205,7,133,5,249,213,250,80,156,13,44,66,8,169,5,4,
+4,6,193,238,112,192,100,50,35,59,43,3,233,233,233,103,157,158,65,8,33,132,184,51,181,173,129,165,40,10,218,118,232,2,167,179,8,187,119,108,3,20,5,233,105,167,180,101,164,130,24,141,198,210,217,30,22,171,
+21,133,5,5,181,238,53,69,136,167,194,53,176,8,33,164,22,80,144,159,143,172,204,76,100,164,167,33,47,47,175,198,23,199,37,132,16,66,46,156,218,117,14,187,233,182,135,240,249,39,111,161,95,175,129,216,188,
+115,55,174,190,250,54,196,37,212,195,218,213,75,57,197,241,60,80,20,3,20,69,129,8,96,48,40,16,17,184,92,46,40,138,194,113,29,132,120,8,197,147,187,137,14,147,217,140,65,67,199,224,181,55,190,192,37,195,
+199,194,215,110,71,219,14,93,112,201,136,241,48,91,44,218,114,66,8,33,132,16,66,8,169,116,74,54,94,137,79,136,68,231,78,189,49,115,234,48,92,115,217,12,24,77,38,109,41,57,7,34,106,169,101,27,127,34,194,
+209,87,132,212,0,38,147,9,205,91,181,133,195,225,167,77,157,19,161,122,29,126,126,178,123,199,126,81,85,151,20,230,23,200,131,255,125,73,142,31,57,33,111,190,245,165,152,76,102,93,189,183,104,182,88,116,
+49,74,41,165,148,82,74,105,205,232,227,227,35,159,124,242,163,168,170,75,84,213,37,219,54,239,145,134,77,154,233,234,40,165,212,147,52,26,141,242,220,11,31,200,247,223,45,148,164,228,20,93,254,76,114,172,
+228,25,40,153,3,221,171,223,96,252,240,229,23,176,218,173,200,203,202,195,3,143,191,128,15,223,127,25,135,15,186,255,246,195,21,165,236,124,239,39,158,126,11,193,129,129,184,108,230,40,109,89,173,64,81,
+202,15,72,228,147,24,66,8,33,132,16,226,14,248,248,248,226,195,15,191,67,120,104,16,38,76,25,137,131,251,247,106,75,8,33,196,227,8,143,140,194,236,107,239,194,168,161,3,48,121,250,36,172,89,185,76,91,82,
+14,54,176,254,133,78,93,123,97,254,183,95,195,30,96,71,211,230,173,177,105,195,90,109,137,87,112,195,173,15,224,153,199,239,70,97,110,1,226,18,235,226,120,234,49,109,137,87,83,210,188,98,211,138,16,66,
+8,33,164,102,177,219,237,40,44,42,66,81,53,238,108,229,206,148,60,112,46,94,191,169,248,214,141,139,142,19,66,188,5,255,128,0,188,250,234,167,248,252,203,15,241,245,156,143,180,233,114,112,17,247,179,80,
+220,208,16,28,216,191,7,127,45,93,137,159,126,249,19,127,254,54,223,43,251,125,211,175,184,1,47,63,247,8,0,192,104,54,225,224,209,108,44,95,242,167,182,204,171,41,190,32,40,190,8,136,137,139,71,120,100,
+20,28,14,63,100,101,102,104,75,73,53,226,235,107,135,217,98,41,93,251,129,16,66,72,245,210,172,101,27,220,250,159,135,225,23,24,136,221,187,182,193,229,116,106,75,8,169,116,2,2,131,0,72,181,110,205,238,
+222,200,233,134,85,73,243,234,159,70,22,33,132,120,58,5,5,5,152,59,247,19,236,223,183,187,66,15,46,116,243,10,105,177,138,98,16,69,49,232,226,222,162,209,104,148,25,87,222,88,58,159,190,196,180,227,105,
+18,28,18,162,171,247,118,123,244,25,40,115,191,250,77,182,110,218,45,187,119,236,151,212,35,39,228,246,187,31,23,163,209,168,171,165,85,111,108,92,29,121,231,221,175,229,185,23,63,20,31,31,95,93,158,82,
+74,105,213,26,19,27,47,71,15,165,150,94,31,172,91,189,85,122,245,27,172,171,163,180,58,180,59,28,146,144,88,79,44,181,120,189,86,111,191,55,169,41,13,6,131,132,133,71,240,103,75,169,103,168,11,208,90,98,
+147,102,45,197,89,84,84,174,121,85,152,95,32,51,174,188,81,172,54,155,174,222,219,157,255,211,18,93,51,47,227,100,186,4,4,6,233,106,105,213,218,160,81,83,249,234,203,95,101,221,234,109,50,106,220,52,110,
+46,64,105,21,219,178,77,123,105,219,190,179,132,134,133,235,114,180,246,88,124,115,172,148,126,127,203,237,143,232,206,139,223,124,243,135,238,56,74,171,218,6,141,154,202,71,31,253,32,175,190,246,153,12,
+28,50,74,186,245,236,167,171,161,244,98,228,195,82,74,61,70,93,160,194,26,12,6,49,24,216,169,246,84,253,252,3,164,119,191,75,228,145,199,95,149,147,199,78,137,170,186,228,134,91,31,208,213,213,22,59,118,
+233,89,238,73,243,214,77,187,101,210,165,87,241,105,76,53,27,21,29,35,175,189,241,133,204,154,125,187,68,68,70,233,242,148,210,202,211,96,48,72,247,94,253,37,227,100,134,168,46,167,92,123,227,221,98,48,
+112,212,105,109,213,106,179,149,27,117,252,232,19,175,149,107,94,157,56,122,82,26,53,105,174,59,142,210,170,182,85,155,14,146,157,158,37,71,15,165,202,130,95,150,201,240,49,147,117,53,148,158,77,171,213,
+42,83,102,204,150,39,158,126,75,90,183,235,164,203,215,86,13,6,131,216,237,14,93,156,82,55,87,23,168,176,109,59,116,145,246,157,186,73,84,76,172,132,134,71,72,159,254,67,164,103,159,65,186,58,234,254,198,
+39,36,74,215,30,125,107,229,200,43,156,126,234,12,64,146,146,83,228,237,119,230,202,109,119,62,38,65,193,181,111,26,165,59,104,183,59,56,10,132,210,106,50,40,56,68,222,126,103,174,204,253,234,55,217,190,
+101,175,236,219,117,176,194,219,24,83,239,183,78,221,68,217,189,125,191,168,170,75,126,255,109,133,36,213,111,160,171,161,238,161,193,96,16,147,201,164,139,123,147,157,186,245,146,111,191,249,67,222,126,
+103,174,56,252,252,116,121,74,207,102,104,88,184,60,254,212,155,146,157,158,37,46,167,83,254,252,99,149,116,232,220,67,87,87,219,12,10,14,145,102,45,219,148,27,121,75,169,187,123,81,187,16,250,250,250,
+34,32,40,24,227,38,94,142,126,61,122,99,227,214,109,248,232,163,87,177,110,245,10,109,41,113,83,184,131,73,49,103,219,133,144,63,31,66,136,55,99,48,24,224,231,31,128,220,220,28,4,4,4,34,54,190,46,118,110,
+219,140,236,236,44,109,41,169,165,132,134,133,163,110,82,125,108,90,191,6,185,185,57,218,52,113,3,234,38,37,227,165,231,223,65,124,108,4,174,152,125,37,22,255,245,155,182,196,107,48,91,44,16,85,224,116,
+114,115,23,114,254,132,71,70,161,69,171,246,232,218,181,31,214,111,88,137,47,62,126,91,91,82,171,48,153,76,80,20,133,155,37,17,143,226,162,26,88,37,68,197,196,162,81,227,22,216,183,119,39,118,110,223,170,
+77,19,226,17,104,155,88,218,239,9,33,164,166,96,51,157,16,114,38,122,245,29,140,183,94,121,13,117,18,163,0,0,63,206,91,140,113,227,7,177,9,77,8,33,196,43,57,103,3,203,100,50,33,48,56,4,25,105,105,40,42,
+250,247,237,12,9,241,116,120,147,72,136,119,147,156,210,16,102,179,5,155,55,174,211,166,220,22,110,151,78,8,57,27,127,47,92,131,78,93,154,97,195,186,157,184,247,225,7,17,16,16,132,249,243,190,196,177,163,
+71,180,165,132,16,55,38,41,57,5,254,1,129,88,179,114,153,54,69,8,41,131,17,192,253,218,96,9,29,186,244,64,211,102,109,112,248,208,62,228,229,229,106,211,132,120,29,138,114,206,158,46,33,164,18,136,138,
+142,197,168,177,211,176,115,199,102,152,77,230,106,29,186,222,167,255,48,124,246,254,123,72,203,113,225,228,201,99,200,72,79,211,150,212,40,197,35,63,255,249,12,178,88,44,112,185,92,104,208,168,41,110,
+190,237,97,204,156,126,21,86,172,92,140,140,140,244,114,199,17,66,106,39,171,214,173,134,221,30,141,117,27,183,96,203,230,181,248,225,155,207,145,153,153,161,45,35,132,184,33,70,163,17,14,135,31,82,26,
+54,65,187,14,61,16,16,16,136,77,27,214,104,203,72,37,19,21,19,139,9,147,175,68,86,102,26,78,157,60,161,77,19,55,231,156,13,44,171,213,6,31,31,95,108,221,188,129,163,82,72,45,161,124,243,74,81,148,211,77,
+45,66,72,101,225,44,42,66,163,166,45,49,101,242,149,104,209,186,35,22,253,245,75,181,141,48,218,186,121,3,242,85,43,30,186,235,22,116,233,220,23,11,126,159,143,204,140,202,189,217,43,219,132,106,214,178,
+13,130,67,195,112,34,245,152,174,57,165,165,100,218,50,32,112,56,252,208,172,101,91,92,119,195,189,104,208,184,57,222,127,253,21,244,237,219,9,77,154,212,131,98,12,198,218,117,203,145,195,41,66,132,212,
+122,142,29,57,140,175,231,126,130,93,187,183,226,228,137,84,222,140,121,41,190,190,118,88,44,86,206,136,241,50,108,54,31,76,191,252,6,220,126,243,237,72,207,202,197,215,95,126,128,44,54,160,171,28,255,
+128,0,124,240,230,155,184,102,214,149,88,190,118,3,246,238,222,161,45,33,110,142,110,101,247,178,26,202,108,167,76,169,167,218,188,85,91,25,56,100,180,196,196,198,235,114,37,134,71,68,234,242,138,162,112,
+103,14,74,171,64,95,187,93,158,122,246,109,185,108,214,205,165,187,128,86,151,22,139,69,218,117,236,42,77,154,181,20,31,31,31,93,190,178,236,59,112,152,20,228,230,203,138,101,27,197,100,54,235,242,90,75,
+126,14,77,155,183,146,109,155,247,200,103,159,205,151,217,55,222,35,170,234,18,85,117,137,179,176,80,178,211,179,229,243,207,127,22,135,163,234,118,224,50,91,44,98,228,185,159,82,74,221,194,38,205,91,201,
+166,245,59,101,247,142,3,210,174,99,87,93,158,122,182,41,141,154,200,85,215,222,33,11,255,92,45,195,71,79,210,229,105,213,88,47,185,129,252,189,112,141,236,223,115,88,162,98,98,117,121,234,214,234,2,148,
+122,149,205,91,182,145,223,126,93,33,71,15,30,147,175,191,254,93,247,33,101,50,155,165,105,139,214,50,239,135,191,229,210,203,174,47,151,51,24,12,213,126,115,77,105,109,49,177,94,125,137,142,141,211,197,
+61,93,163,209,40,253,6,14,147,188,172,156,210,230,211,132,41,87,232,234,180,150,124,214,244,31,60,82,10,243,11,36,63,39,79,150,46,94,47,233,39,210,229,232,193,84,217,191,251,144,124,57,103,129,52,108,210,
+76,119,108,101,202,166,61,165,148,186,135,117,234,38,201,137,163,39,75,207,37,25,39,51,36,54,62,65,87,71,61,223,97,163,38,201,213,215,221,37,102,179,69,151,163,85,99,68,100,148,140,24,51,69,130,130,67,
+116,57,234,214,234,2,148,122,149,189,250,14,150,75,47,191,94,198,76,152,46,139,254,90,43,93,123,244,45,151,31,62,122,178,44,250,107,173,60,244,232,203,186,155,105,54,176,168,55,216,127,240,8,185,253,174,
+199,117,35,12,107,82,111,110,146,244,238,119,73,233,205,70,137,121,89,57,18,87,167,174,174,246,108,118,238,222,91,118,239,56,32,233,39,210,165,115,183,222,18,20,18,42,195,71,79,146,75,134,143,211,213,82,
+74,41,245,62,67,66,195,100,195,218,237,186,243,73,203,54,237,117,181,212,59,244,15,8,228,8,104,74,255,93,93,128,82,175,213,223,63,64,55,101,168,103,223,65,210,169,107,175,210,239,203,54,172,216,192,162,
+222,224,147,207,188,85,250,228,118,232,200,9,186,60,173,92,19,235,213,151,149,203,54,137,170,186,196,229,114,202,209,131,169,242,208,127,95,146,192,160,96,93,237,185,140,137,139,151,104,55,106,58,82,74,
+41,173,62,135,141,154,248,79,227,202,229,20,85,117,73,250,137,116,169,83,55,81,87,75,41,61,63,99,98,227,37,34,50,74,23,167,238,239,57,23,113,119,71,226,234,212,69,207,190,131,177,111,247,78,56,157,78,109,
+154,144,115,82,80,80,160,123,221,236,221,189,3,7,246,239,1,78,47,162,172,223,176,128,59,19,18,207,102,227,198,213,88,186,98,3,86,172,217,132,132,132,122,72,77,61,140,19,199,83,181,101,21,166,223,192,97,
+8,9,11,199,161,131,251,181,41,2,32,237,212,73,204,249,250,115,168,8,66,179,6,201,24,55,117,26,222,126,227,127,200,207,207,211,150,158,145,146,197,222,179,50,51,144,149,153,1,69,81,96,48,26,171,109,161,
+123,66,106,138,110,61,251,35,48,40,24,199,142,30,214,166,8,169,117,4,135,132,98,198,180,41,197,155,9,157,222,80,232,131,143,127,192,71,31,188,161,45,37,132,84,16,69,49,96,208,208,81,248,239,131,79,99,225,
+223,191,227,196,241,99,218,18,226,1,232,186,90,238,108,223,1,67,101,205,170,45,18,19,199,167,210,238,174,55,76,17,42,94,196,157,35,176,168,119,233,231,231,127,193,175,107,163,209,40,55,255,231,97,25,120,
+201,40,93,142,22,91,242,217,103,177,90,165,117,219,142,165,63,235,11,253,153,83,239,84,81,20,137,137,139,23,31,31,95,93,174,182,250,191,23,62,144,252,156,60,249,239,227,175,74,139,214,237,116,121,74,107,
+147,254,254,1,178,119,215,193,114,211,7,47,191,250,86,93,93,137,17,81,209,210,189,87,127,105,216,184,153,116,234,218,75,124,124,249,217,66,169,86,179,197,34,111,189,51,87,198,87,96,109,82,234,182,234,2,
+110,109,82,114,138,92,123,227,61,226,239,31,160,203,81,90,217,242,134,147,122,187,138,114,126,211,100,45,86,171,52,107,209,90,108,182,170,219,189,207,27,53,24,42,254,51,166,222,175,162,40,146,156,210,80,
+150,45,217,32,95,126,249,171,248,249,249,235,106,106,163,73,201,41,242,253,119,11,37,243,84,134,252,246,235,138,10,237,222,73,169,183,106,52,26,101,199,214,189,165,205,171,253,123,14,151,91,242,66,107,
+100,116,140,220,117,223,83,178,121,195,46,185,235,190,167,197,215,110,215,213,80,74,139,223,91,218,24,245,28,61,110,10,97,218,169,147,88,190,116,33,10,10,10,180,41,226,6,152,76,102,52,106,218,2,249,249,
+185,40,40,40,128,201,108,134,159,127,0,10,11,10,79,191,230,60,11,69,225,244,65,226,221,40,138,114,134,105,179,103,199,229,114,225,216,209,35,186,169,184,255,70,201,180,56,0,104,223,169,59,20,5,200,202,
+204,170,53,239,47,78,255,35,101,241,241,241,65,255,65,163,48,226,146,1,104,215,161,49,14,29,203,193,138,101,127,105,203,106,29,105,167,78,226,227,79,222,193,155,239,190,131,111,191,251,10,153,233,105,218,
+18,183,196,238,112,96,234,140,107,209,182,125,87,116,234,218,27,237,59,118,199,150,77,107,81,200,107,85,114,17,136,8,178,11,128,158,157,59,225,147,207,231,99,202,165,99,177,105,253,26,109,89,41,217,89,
+89,216,176,97,37,108,126,97,248,229,231,111,176,119,247,78,109,9,33,164,22,93,147,41,138,1,190,190,62,48,26,141,0,0,85,173,248,245,126,77,163,40,6,40,138,2,147,201,120,198,191,183,174,171,69,233,133,106,
+52,26,229,225,71,95,150,61,59,14,200,188,31,254,150,205,27,118,202,101,87,221,162,171,243,20,207,103,100,10,165,84,111,217,17,94,126,126,254,114,251,221,79,200,145,131,199,164,126,195,198,186,90,234,25,
+250,251,7,72,72,104,152,46,78,207,207,58,117,147,164,207,128,33,178,97,237,118,217,188,97,151,248,113,100,185,199,106,177,90,229,166,219,30,146,220,204,108,113,185,92,242,231,239,43,37,32,48,72,87,71,233,
+133,24,19,23,47,54,155,77,23,167,148,210,115,25,20,28,34,147,166,205,146,43,175,185,77,218,119,234,166,203,187,179,254,1,1,98,179,249,72,120,100,212,153,70,204,233,15,160,244,98,140,138,142,145,239,190,
+91,40,170,234,146,55,222,250,82,66,195,195,117,53,158,162,55,172,227,69,105,77,90,210,188,106,222,170,109,233,206,124,159,124,242,163,174,142,122,134,137,245,234,203,214,77,187,101,199,214,189,210,166,
+125,103,93,158,158,191,241,9,137,242,234,235,159,75,163,38,205,117,57,234,57,58,28,126,210,119,224,48,25,56,100,20,27,188,128,216,237,14,105,212,164,57,175,163,42,81,62,84,165,148,158,143,70,163,81,2,2,
+131,36,36,44,92,124,61,112,77,188,179,125,230,113,126,20,169,84,74,118,241,11,12,10,70,247,94,3,48,239,187,57,40,42,44,212,150,17,82,105,216,124,124,48,102,252,12,152,45,86,188,253,218,51,218,52,169,65,
+74,62,15,58,118,233,137,63,126,254,17,89,153,57,40,40,40,196,77,119,221,131,207,62,124,83,91,78,220,28,147,217,140,219,239,122,28,15,220,115,61,0,96,227,186,157,152,48,117,44,54,111,92,167,45,37,231,73,
+92,124,2,84,85,229,206,158,30,202,153,119,48,174,221,132,134,133,227,171,47,126,196,231,95,207,197,91,175,61,141,188,188,138,237,194,74,8,33,53,73,114,74,67,180,104,213,17,69,69,133,176,90,109,80,85,21,
+233,105,39,240,235,207,223,159,113,42,27,169,25,116,93,45,74,105,177,124,114,232,158,42,138,65,218,117,236,42,29,58,119,151,228,148,134,242,227,188,69,146,159,147,39,207,189,248,129,52,106,218,66,87,79,
+107,206,160,224,16,217,181,109,159,124,250,233,79,18,21,19,43,175,190,254,185,92,126,213,217,119,81,114,39,67,195,35,100,196,152,201,210,173,103,127,46,194,14,72,189,250,13,100,234,140,217,210,166,125,
+39,105,209,170,157,36,36,214,19,255,128,64,93,157,59,59,102,194,12,153,56,245,74,93,156,82,90,249,182,105,223,89,14,236,57,44,35,199,78,213,229,40,165,212,29,13,9,13,147,219,239,126,92,246,237,58,40,233,
+39,211,75,103,20,25,141,38,93,45,173,49,117,1,74,233,105,207,54,116,145,214,140,38,211,63,39,143,190,3,135,201,35,143,191,42,179,102,223,46,251,119,31,42,221,165,103,232,200,9,186,227,104,205,233,235,107,
+151,150,109,218,139,143,79,241,174,133,145,209,49,18,20,28,162,171,115,71,237,14,135,220,122,199,163,226,116,22,201,123,239,127,43,81,209,177,186,154,218,164,217,108,209,197,60,201,33,35,38,136,170,186,
+36,245,240,113,169,83,55,73,151,167,148,86,190,245,27,52,146,248,132,68,93,156,82,74,221,213,168,152,88,185,255,225,231,229,248,145,19,242,222,7,223,73,131,198,77,117,53,180,70,213,5,40,165,167,101,3,171,
+226,218,237,14,49,91,170,254,6,183,228,119,226,31,16,40,19,167,205,146,130,220,188,210,230,213,209,67,169,18,27,95,71,119,12,117,15,61,245,253,52,110,210,76,217,181,125,191,172,89,181,85,58,119,239,163,
+203,83,247,183,77,251,206,178,97,237,14,57,176,231,176,252,52,111,17,215,155,162,180,134,245,245,181,75,151,238,125,196,207,207,95,151,163,148,210,154,214,108,54,75,243,150,109,197,215,215,174,203,209,
+154,213,160,157,79,72,8,41,139,104,3,4,64,84,116,12,70,143,191,20,225,17,145,0,128,200,168,104,244,25,48,12,102,147,73,91,90,37,40,138,1,153,25,233,48,24,140,48,219,44,0,128,67,251,142,161,239,224,129,
+56,184,127,159,182,156,212,48,138,242,207,169,166,236,215,158,194,103,31,189,133,150,109,154,226,137,255,61,131,248,58,73,218,52,113,115,234,55,104,132,39,255,251,63,204,91,240,7,38,78,159,134,75,134,245,
+224,186,93,132,212,48,170,234,194,213,87,222,132,149,203,214,162,67,231,238,218,52,33,132,212,40,69,69,69,88,183,102,5,114,115,115,180,41,226,6,232,186,90,148,82,122,46,251,12,24,42,46,103,145,92,119,211,
+189,18,20,28,34,151,205,186,69,18,170,105,74,78,201,86,170,77,154,183,146,223,127,93,33,199,14,165,74,65,94,190,124,242,201,143,18,22,30,161,171,167,148,214,110,67,66,195,36,177,94,253,51,109,195,76,41,
+173,65,99,226,226,101,193,207,203,228,196,209,147,210,182,67,23,93,158,82,74,41,213,106,4,112,191,182,163,69,72,117,99,183,59,144,210,168,9,12,6,3,178,179,179,180,233,26,65,81,12,80,20,110,212,121,38,178,
+50,211,145,87,228,139,171,166,79,70,76,124,35,252,241,199,143,216,176,110,149,182,172,74,48,24,12,16,17,88,172,86,44,248,253,103,188,245,238,59,152,255,235,159,56,149,145,129,131,7,246,32,61,237,148,246,
+144,26,161,94,253,6,136,136,138,198,137,212,99,218,20,33,164,26,201,203,205,69,218,169,147,16,225,103,57,33,238,68,86,102,6,118,237,223,139,107,174,185,28,63,253,252,7,182,110,94,175,45,33,132,16,66,202,
+193,6,22,169,113,76,38,19,218,117,236,138,110,221,7,192,225,239,135,195,135,246,163,160,32,95,91,86,109,20,79,113,42,219,232,37,90,114,115,114,240,199,111,63,226,100,86,1,28,126,1,120,239,173,23,180,37,
+149,138,209,104,44,189,249,20,145,211,83,8,211,112,34,245,24,78,158,56,142,157,219,183,96,245,138,197,110,209,188,178,218,108,104,218,188,21,58,118,233,3,0,216,181,99,171,182,196,173,168,223,160,17,44,
+86,43,178,179,50,181,41,66,8,33,228,95,177,88,172,112,185,92,218,240,191,98,119,56,208,162,85,123,44,90,178,6,95,207,249,176,70,175,253,8,33,132,120,6,181,174,129,101,50,153,224,231,231,15,0,112,185,156,
+218,52,169,1,84,85,69,65,126,62,124,236,118,52,104,208,12,249,249,185,56,176,127,143,182,172,90,248,103,125,30,65,120,100,20,226,226,235,226,196,241,84,77,21,41,97,253,218,21,248,109,193,15,218,112,165,
+83,118,228,132,197,106,133,197,108,134,211,89,252,254,253,167,225,88,243,88,109,54,116,235,217,15,67,46,25,135,216,232,56,252,249,231,124,164,30,59,162,45,115,27,162,99,226,112,197,85,183,225,84,218,113,
+236,223,187,91,155,38,53,76,217,198,45,33,164,230,105,213,182,35,98,226,234,32,61,253,20,138,138,138,180,105,183,194,230,227,3,187,195,15,5,249,85,219,20,170,223,160,17,46,25,62,1,29,59,247,194,225,195,
+251,144,149,153,161,45,57,35,118,187,3,151,205,186,5,251,247,237,194,167,31,189,201,230,21,33,132,144,10,225,121,171,233,86,2,254,129,65,168,91,47,89,27,38,53,200,177,163,135,241,221,87,159,96,206,231,
+239,32,245,216,97,24,141,70,109,73,181,160,40,128,136,138,208,176,48,252,185,224,111,172,88,180,8,141,154,52,215,150,145,26,196,229,116,162,176,176,176,244,123,17,181,92,190,38,73,168,91,15,131,6,142,70,
+80,64,16,126,156,255,53,182,109,217,168,45,113,43,78,157,60,129,229,203,23,34,39,203,61,166,237,146,98,186,247,30,128,91,110,127,4,193,33,161,218,20,33,164,6,153,126,233,108,44,89,248,59,22,204,95,140,
+54,237,59,107,211,23,141,201,100,186,232,141,46,252,252,252,49,233,210,171,240,218,107,159,97,252,164,43,180,233,74,39,38,46,1,237,91,119,132,143,143,15,124,237,14,109,250,172,168,170,138,185,95,190,143,
+95,127,254,94,155,34,132,16,66,206,137,110,97,172,218,160,217,98,209,197,104,237,86,81,12,2,64,108,62,62,242,250,155,115,68,85,93,162,170,46,89,187,106,171,216,124,124,116,245,148,106,13,8,12,146,110,61,
+251,73,155,246,157,197,106,179,233,242,238,170,129,139,91,187,133,129,129,65,114,255,195,207,203,254,221,135,100,244,248,233,85,190,232,184,195,207,175,244,235,176,240,8,9,10,14,209,213,208,51,235,31,16,
+168,139,81,239,181,228,250,32,161,110,61,89,186,120,189,168,170,75,62,252,232,7,93,221,197,154,80,55,233,162,183,108,239,213,111,176,28,62,112,76,222,124,235,43,105,216,164,153,46,95,217,70,68,70,73,74,
+163,38,186,56,165,148,82,90,69,234,2,148,214,74,75,46,80,167,206,152,93,218,188,42,113,250,229,215,235,234,41,165,180,50,29,50,98,188,28,218,127,84,134,141,154,168,203,85,166,118,187,67,62,249,244,39,89,
+185,124,147,244,236,51,72,134,142,156,32,199,143,156,144,131,251,142,200,128,193,35,37,44,60,66,76,102,179,4,135,132,138,162,40,186,227,107,187,81,209,49,242,215,194,213,50,106,220,165,186,28,245,126,3,
+2,131,228,242,171,111,149,65,67,199,232,114,23,107,96,80,176,88,173,86,93,252,124,236,212,173,151,124,244,241,60,105,192,166,18,165,148,82,239,84,23,160,180,210,253,207,93,143,75,255,65,195,117,113,119,
+211,98,177,200,226,191,215,234,26,88,215,221,116,175,174,150,82,74,43,211,30,189,7,232,182,146,47,105,172,87,150,126,254,254,242,205,55,127,232,62,227,202,154,122,248,184,236,222,177,95,30,121,252,21,221,
+241,20,18,28,18,42,79,60,253,166,236,223,125,72,122,245,27,172,203,83,122,177,26,12,6,9,8,12,146,192,160,96,93,174,34,6,4,4,138,201,100,210,197,41,165,148,82,79,183,214,45,226,78,106,6,179,213,140,79,222,
+121,7,233,185,192,234,149,139,181,105,183,64,81,12,16,81,177,239,208,33,52,74,110,142,252,156,124,44,248,109,5,110,191,251,78,124,243,229,71,40,44,44,208,30,66,8,33,149,198,222,61,59,113,248,224,254,114,
+49,69,81,0,8,204,22,11,84,205,46,95,231,187,200,123,120,68,36,190,250,226,39,244,235,223,1,162,10,68,45,115,172,0,226,18,136,8,236,254,190,8,12,246,199,245,55,204,198,209,35,135,202,254,17,181,26,135,195,
+15,221,123,15,68,70,122,26,190,252,226,125,156,202,113,98,64,223,161,248,121,254,183,23,180,3,91,9,193,33,161,232,216,181,23,142,28,218,95,186,57,5,169,221,212,77,170,135,250,41,141,97,177,88,46,104,35,
+144,130,130,124,168,170,251,172,15,73,8,33,238,128,217,108,134,193,104,228,231,163,23,160,235,106,81,90,21,14,25,49,94,254,251,248,171,186,184,59,26,20,28,34,49,113,241,226,235,235,171,203,81,74,105,117,
+59,98,204,20,153,56,245,74,241,243,15,16,0,210,161,115,119,105,222,170,173,174,238,92,190,246,198,23,162,170,46,113,22,21,137,179,80,99,81,177,170,234,146,156,140,108,233,209,103,160,238,248,218,172,195,
+225,39,247,61,244,156,164,159,72,151,190,3,135,9,0,177,90,109,210,184,89,203,139,26,233,18,19,23,47,255,125,252,85,249,207,93,143,139,217,204,181,57,105,177,65,193,193,18,22,17,41,54,91,237,89,127,179,
+178,71,155,82,74,105,89,141,70,163,4,135,134,74,104,88,184,46,71,61,75,142,192,34,213,198,246,173,27,241,235,130,239,79,239,176,35,218,180,91,145,159,151,135,172,204,12,20,21,21,121,196,223,151,16,226,
+221,228,229,229,160,101,171,14,120,252,145,39,145,210,184,13,50,50,51,176,106,217,162,10,143,12,237,220,173,55,94,124,254,191,0,80,60,242,74,65,57,21,131,2,131,193,128,93,219,14,160,239,37,3,177,124,241,
+66,237,31,81,171,241,241,241,69,221,164,6,80,197,138,171,102,78,195,230,157,187,177,125,235,70,28,63,118,244,162,158,228,118,232,220,3,121,121,121,248,224,157,23,145,159,159,167,77,147,90,74,126,94,30,
+114,115,178,107,217,136,60,94,103,17,66,42,206,148,233,215,160,71,175,129,88,191,118,5,156,206,34,109,90,135,205,199,7,1,254,129,200,203,205,69,65,65,190,54,237,149,68,70,69,195,207,63,0,217,89,153,218,
+148,199,163,235,106,81,122,49,78,156,54,75,238,186,239,105,241,241,245,149,65,67,199,200,55,223,252,33,99,39,206,212,213,81,74,41,173,184,73,245,82,74,215,169,122,225,165,143,116,249,115,57,102,194,116,
+57,149,154,86,58,2,75,187,238,149,170,186,228,151,159,151,74,116,108,156,224,244,104,8,142,136,208,27,19,23,47,171,150,111,150,199,159,126,243,162,70,94,81,74,255,209,199,199,87,82,26,54,150,248,132,68,
+110,28,65,43,93,163,209,200,221,231,189,204,62,253,135,200,254,61,135,228,166,219,30,18,179,217,172,203,159,77,211,121,212,122,131,189,250,14,150,43,103,255,71,23,247,2,117,1,74,47,200,128,192,32,185,247,
+193,255,149,222,12,173,93,181,85,10,243,242,75,191,191,235,190,167,120,193,79,41,165,23,225,132,41,87,202,227,79,189,33,67,71,78,16,155,207,249,77,47,154,113,229,141,165,159,199,121,217,185,114,112,239,
+17,89,248,199,106,153,126,197,13,210,169,107,47,49,26,141,2,54,175,206,105,189,148,134,210,119,192,80,137,142,41,110,244,81,74,47,206,46,221,251,200,111,191,174,144,188,172,28,201,78,207,146,37,139,214,
+75,187,142,93,117,117,244,223,13,9,13,149,222,253,46,17,99,45,191,214,158,124,233,213,242,235,130,229,242,254,7,223,201,85,215,221,33,235,215,110,151,117,107,182,73,189,148,134,186,90,234,121,26,141,70,
+233,222,123,128,52,111,213,78,151,163,229,181,88,44,18,16,24,164,139,123,129,186,0,165,231,109,76,92,188,108,221,180,187,244,230,168,236,19,254,178,95,151,172,29,66,41,165,244,194,141,136,140,150,65,67,
+199,156,215,83,101,147,201,36,55,222,250,160,204,154,125,187,36,167,52,20,127,255,0,177,59,28,186,58,122,118,189,244,66,144,210,26,241,146,225,227,36,43,45,83,156,69,69,82,152,95,80,122,173,152,157,158,
+117,222,107,252,213,118,147,83,26,201,234,149,155,69,85,93,242,236,243,239,137,229,60,206,13,222,162,143,143,143,252,239,133,15,74,95,71,90,39,95,122,181,238,152,202,180,94,253,134,50,118,226,76,241,243,
+243,215,229,40,165,149,167,65,59,159,144,144,11,37,48,192,1,0,112,21,185,78,239,156,117,122,173,21,57,253,223,226,72,153,35,8,33,132,84,148,226,245,248,138,57,118,244,48,246,236,222,14,131,161,98,167,113,
+69,49,192,233,116,226,217,39,239,197,171,47,62,134,29,219,182,32,51,51,3,57,217,217,165,121,242,239,100,164,167,105,67,132,144,11,228,200,225,3,216,180,101,47,0,192,100,54,150,198,125,253,125,209,171,247,
+144,50,149,23,78,108,124,2,70,141,155,134,128,192,64,109,202,43,48,153,76,24,56,100,20,150,253,181,8,45,90,165,0,0,174,159,61,25,143,62,241,26,252,3,2,180,229,94,205,148,25,215,226,186,107,38,2,165,247,
+31,229,239,57,42,178,78,210,133,98,177,88,48,125,198,245,120,229,217,39,16,22,17,169,77,87,43,109,59,116,193,140,43,110,212,134,9,241,42,116,93,45,74,47,196,6,141,155,202,137,163,39,69,85,93,226,114,22,
+73,110,102,118,185,39,31,75,23,175,23,255,128,64,221,113,148,82,74,43,102,201,244,190,11,153,226,119,33,199,80,74,105,85,90,178,195,231,119,223,254,41,183,221,249,152,12,27,53,81,250,12,24,34,145,81,209,
+186,218,11,241,142,123,158,144,3,123,14,75,219,14,93,164,101,235,246,82,191,65,99,93,141,39,27,27,159,80,122,157,93,84,80,40,69,5,133,165,223,247,234,59,88,87,239,205,190,247,254,183,197,247,32,46,167,
+168,46,103,185,123,144,29,91,247,74,88,120,132,238,152,202,210,207,223,95,54,173,223,41,206,162,162,26,159,2,219,173,87,127,81,85,151,220,126,247,227,186,28,165,94,162,46,80,97,109,54,91,233,130,175,180,
+118,91,114,99,212,167,255,16,81,85,151,100,165,101,202,136,49,83,100,212,248,75,101,207,206,3,242,245,220,223,185,102,8,165,148,86,162,108,72,81,74,233,217,53,153,204,242,215,159,171,69,85,93,242,237,55,
+127,200,125,15,61,47,221,123,245,215,213,121,178,102,139,69,46,191,250,214,127,154,53,46,167,184,92,78,249,207,93,143,73,112,72,168,174,222,155,77,74,78,249,103,57,19,77,3,235,141,183,190,212,213,87,182,
+205,91,181,149,59,238,121,66,18,235,37,235,114,213,169,217,98,145,31,231,45,18,85,117,201,248,201,151,235,242,158,100,92,157,186,146,88,175,190,46,78,47,204,228,6,141,228,237,119,230,74,120,68,164,46,87,
+98,98,82,125,105,220,172,165,46,238,102,234,2,21,182,78,221,36,105,223,185,187,46,78,107,159,101,111,164,174,190,238,46,185,253,238,39,164,97,147,102,2,64,2,131,130,117,245,148,82,74,41,165,148,150,168,
+40,6,49,26,141,149,214,156,87,20,131,244,25,48,84,14,236,61,44,170,234,146,239,191,91,40,86,155,77,87,231,13,14,30,54,182,116,22,196,212,25,179,117,121,111,177,255,160,17,50,124,244,36,49,24,206,252,26,
+169,155,84,175,244,247,93,144,155,39,135,247,31,149,188,172,28,185,254,150,251,117,181,85,101,201,134,40,53,105,163,166,45,228,232,193,99,178,121,227,46,143,94,235,242,254,135,159,151,221,59,14,72,221,
+164,154,109,10,122,131,1,1,129,242,202,107,159,137,170,186,228,245,55,231,156,117,199,215,168,232,88,137,137,139,215,197,221,76,93,160,194,134,134,133,75,108,92,29,93,28,128,164,52,106,82,227,67,40,105,
+205,123,182,55,7,165,181,197,136,200,168,210,221,226,162,162,99,228,186,155,239,147,235,111,190,95,194,194,207,254,244,131,82,74,41,165,149,99,251,78,221,229,153,231,222,147,214,237,58,233,114,222,100,
+139,86,109,101,234,204,107,117,113,111,114,226,180,89,146,151,149,43,221,123,15,208,229,74,238,57,58,118,233,41,143,63,245,134,180,237,208,69,130,130,67,36,41,57,197,107,27,151,231,50,62,33,81,122,244,
+25,40,22,171,85,151,243,20,75,118,183,191,233,182,135,116,57,90,113,21,197,32,161,225,225,242,238,123,223,72,250,137,116,113,185,92,50,106,220,52,93,157,167,168,156,254,162,82,9,10,14,198,77,183,60,132,
+165,203,254,192,15,223,124,161,77,19,66,72,173,161,123,175,254,24,48,112,20,194,66,66,49,164,127,23,132,69,133,0,0,82,143,156,196,189,143,60,133,143,222,123,9,57,57,57,218,195,8,33,132,16,66,46,8,69,49,
+64,68,213,134,189,130,206,221,122,163,91,247,254,248,224,189,151,113,112,127,241,38,0,196,59,241,245,181,99,210,180,171,80,63,185,17,22,45,254,21,191,253,242,61,50,51,50,180,101,228,95,104,221,174,19,84,
+151,11,107,86,45,67,116,108,28,166,77,191,14,19,71,15,71,151,238,237,60,114,115,154,74,111,96,197,213,169,139,9,147,174,192,210,37,191,99,225,239,63,107,211,132,16,82,235,120,230,185,247,112,195,181,147,
+75,191,23,145,210,157,58,7,14,25,141,249,63,204,45,83,77,60,13,163,209,136,192,224,16,156,60,158,170,77,17,66,8,33,164,146,9,10,14,65,199,46,61,113,244,200,33,172,94,177,68,155,38,94,134,175,175,29,209,
+113,241,56,126,236,168,71,54,92,106,26,95,95,59,68,84,228,229,229,149,198,26,53,109,142,125,187,119,122,228,67,244,74,223,55,187,121,203,118,216,181,107,43,155,87,132,16,114,154,39,30,187,3,63,207,95,86,
+250,125,73,243,42,243,84,22,14,29,220,87,166,146,120,26,221,122,245,199,252,159,22,99,227,154,13,120,253,205,57,136,137,139,215,150,16,66,8,33,181,138,216,184,58,184,227,158,39,209,184,89,75,109,170,82,
+72,59,117,18,127,254,246,19,142,28,58,160,77,17,47,36,55,55,7,59,183,109,97,243,234,2,201,205,205,65,94,94,30,20,197,0,69,41,110,255,108,222,176,206,35,155,87,37,232,230,21,86,134,138,162,84,218,34,140,
+148,86,182,54,155,77,26,52,106,42,177,241,9,23,188,78,87,120,68,164,212,171,223,128,187,43,210,115,90,242,57,104,183,219,229,250,155,239,151,189,59,15,138,203,89,36,95,126,185,64,82,26,53,213,213,83,207,
+177,107,143,190,229,182,44,47,42,44,146,225,163,39,235,234,40,165,222,105,64,64,160,46,86,25,6,135,132,74,84,76,172,46,78,169,167,248,238,123,223,136,170,186,100,196,24,158,19,41,165,149,107,165,143,192,
+42,65,68,180,33,66,220,6,31,95,59,198,141,191,12,147,166,204,130,143,143,175,54,93,33,130,67,195,208,181,199,64,36,36,213,215,166,8,41,69,68,133,162,40,200,201,201,193,115,79,223,143,174,189,187,160,67,
+151,158,24,51,166,31,182,109,222,160,45,39,30,68,251,14,61,241,195,143,139,48,107,246,237,232,210,189,47,82,26,53,198,207,243,56,29,148,16,111,39,60,34,18,227,38,93,134,62,3,134,105,83,23,77,255,65,195,
+177,110,229,122,124,244,254,92,248,218,237,218,52,33,110,207,140,43,110,196,168,161,61,49,103,206,175,88,186,232,15,109,154,16,66,46,138,74,95,3,139,16,79,193,207,207,31,22,155,237,162,214,173,241,241,
+245,69,94,110,174,54,76,72,57,74,134,235,106,23,84,245,230,69,86,107,3,190,190,118,228,230,122,238,240,107,66,200,249,99,54,155,113,235,29,143,34,48,48,8,207,63,251,32,14,30,168,156,105,224,49,113,241,
+184,231,158,167,48,109,194,37,176,218,173,184,227,158,167,240,196,127,111,231,3,97,226,113,116,236,210,19,153,153,233,216,180,126,141,54,69,8,33,23,141,17,192,253,218,224,133,18,20,28,130,27,111,121,16,
+55,223,120,39,78,164,157,196,254,189,187,120,226,37,110,75,97,97,1,242,46,242,230,211,89,84,164,13,17,114,6,74,70,189,106,57,83,140,120,10,69,101,222,255,37,235,154,17,66,188,27,69,81,96,182,90,240,211,
+188,47,113,160,18,119,64,51,155,205,24,62,124,28,90,180,74,193,188,121,139,241,224,3,55,35,59,59,75,91,70,136,219,115,112,255,94,28,63,118,84,27,38,30,76,157,186,73,184,100,216,120,36,214,75,65,104,120,
+56,44,22,11,178,50,51,160,170,124,8,75,170,159,74,27,129,229,235,107,199,21,87,223,134,105,19,198,33,169,110,20,82,83,211,209,103,112,111,236,221,181,83,91,74,8,33,132,144,243,192,106,181,162,223,224,145,
+216,188,97,53,118,237,216,166,77,19,66,188,128,128,192,32,116,238,214,7,75,254,250,21,105,105,167,180,105,66,8,1,0,152,204,102,136,170,66,85,165,90,70,242,15,25,49,30,15,223,251,0,50,50,178,81,80,88,132,
+85,235,214,227,233,167,238,117,203,70,165,175,221,142,214,109,59,225,232,145,67,216,177,109,179,54,125,94,52,104,212,20,25,233,105,56,114,248,160,54,69,106,144,74,89,3,203,100,50,99,224,144,209,56,126,
+226,40,58,116,110,129,107,110,190,3,126,126,62,168,87,175,161,182,180,74,176,88,173,8,8,12,212,134,9,169,113,130,67,66,209,184,89,11,109,152,16,66,42,140,209,104,196,213,215,221,133,155,174,185,9,5,249,
+249,218,52,33,196,75,200,72,79,195,188,111,191,96,243,138,16,114,78,20,69,129,143,143,47,76,102,147,54,85,37,44,252,237,39,220,253,224,189,120,251,195,247,113,247,253,183,225,213,87,158,184,168,37,88,170,
+138,248,132,186,248,251,207,21,248,243,183,159,176,224,199,95,16,29,19,167,45,57,47,156,206,34,220,126,199,163,104,215,161,171,54,69,106,144,74,25,129,101,50,153,16,16,24,132,147,39,142,3,0,108,54,27,162,
+99,227,112,236,200,17,228,228,100,107,203,43,29,131,193,0,131,209,200,233,92,196,173,8,9,13,69,163,166,45,81,144,159,143,229,75,254,210,166,9,33,164,66,40,138,1,131,135,141,193,201,19,169,88,242,247,239,
+218,52,33,132,16,66,106,25,70,163,17,46,151,75,27,174,82,76,38,19,156,78,167,54,236,22,196,196,198,227,135,111,126,70,179,150,201,165,177,201,151,94,131,143,223,127,181,92,221,249,242,236,243,239,97,230,
+228,17,104,223,173,11,182,108,92,175,77,147,26,160,82,70,96,57,157,206,210,230,149,162,24,144,159,159,143,221,59,119,156,177,121,101,177,90,225,240,243,211,134,47,10,85,85,217,188,242,50,146,146,83,208,
+162,117,59,152,45,22,109,202,35,8,143,140,66,223,129,35,97,181,216,176,126,237,74,109,154,16,66,42,140,136,138,239,191,254,140,205,43,66,8,33,132,0,64,181,55,175,112,250,158,223,93,113,185,156,216,119,
+176,252,148,198,202,88,159,244,185,255,61,132,187,30,122,10,62,182,11,219,181,158,84,62,149,186,136,123,49,231,30,208,101,177,90,17,95,39,17,39,220,112,216,97,109,34,40,56,24,173,218,116,192,225,67,7,220,
+114,161,253,248,58,137,104,223,161,7,14,236,219,237,145,139,152,90,44,22,4,135,132,98,235,230,245,56,117,242,132,54,77,8,33,132,16,226,53,196,198,39,224,225,255,190,4,191,192,64,108,218,192,221,231,8,33,
+213,75,118,118,22,230,204,249,16,43,215,110,69,128,35,18,191,254,185,28,175,191,242,36,242,242,46,110,183,248,244,180,83,88,190,244,79,174,131,229,70,84,202,20,194,243,37,190,78,93,36,214,107,0,167,179,
+8,139,22,254,234,150,13,20,111,166,83,183,94,184,102,214,45,152,247,243,119,248,232,221,87,180,105,183,193,96,48,64,81,148,26,121,194,64,8,241,46,180,67,237,205,102,51,12,6,35,10,10,184,166,20,33,132,92,
+12,117,147,146,241,235,143,191,34,161,94,12,126,248,126,17,238,125,240,54,236,222,177,21,25,25,233,218,82,66,8,169,18,20,197,80,186,160,125,116,108,28,92,78,39,142,29,61,162,45,35,94,64,165,76,33,60,95,
+14,30,216,135,75,167,206,194,239,191,204,195,171,175,127,14,187,221,161,45,41,37,46,62,1,190,118,187,54,76,46,144,203,175,186,5,223,207,153,131,247,62,120,205,173,155,87,56,61,53,148,205,43,82,27,184,254,
+150,251,49,97,234,149,218,48,169,68,186,247,30,128,187,238,123,26,241,9,137,104,217,166,3,158,120,234,77,212,77,250,103,157,4,66,8,33,23,134,205,199,7,241,9,81,80,157,46,164,36,199,227,135,175,190,198,
+252,121,11,225,227,195,41,55,132,16,160,87,191,193,248,227,247,149,184,249,63,15,35,174,78,130,54,93,41,136,168,80,148,226,214,198,225,131,7,216,188,242,98,206,57,133,80,81,12,240,245,245,69,81,37,175,
+47,37,34,232,214,115,32,58,117,108,129,152,240,80,188,246,230,107,200,207,203,211,150,193,98,177,96,234,244,217,104,211,182,51,78,165,29,47,93,103,139,92,56,117,147,234,99,206,215,115,241,227,247,95,105,
+83,132,144,154,66,17,188,244,244,51,16,179,63,54,172,91,1,167,179,114,63,115,9,80,80,144,143,167,31,125,12,237,218,245,192,234,53,43,176,101,235,6,108,218,176,6,46,55,94,207,129,16,66,60,129,19,169,199,
+240,203,239,127,35,54,58,5,109,219,53,130,95,128,29,31,127,241,61,22,44,248,30,170,155,63,136,84,20,3,140,70,195,5,207,6,105,212,180,5,6,94,50,6,225,17,145,168,155,84,31,217,89,25,200,205,201,209,150,17,
+114,209,152,204,102,36,37,55,128,179,168,16,5,5,5,218,180,219,50,106,220,52,124,253,249,135,168,155,20,131,126,125,186,98,230,212,25,8,137,172,143,21,203,255,66,126,190,254,254,255,226,184,176,247,49,241,
+60,228,92,26,141,70,93,236,98,141,137,141,151,187,238,123,90,30,123,242,117,105,211,190,147,46,95,162,193,96,144,113,147,102,202,254,221,135,100,230,149,55,235,242,148,210,218,169,209,104,148,174,61,251,
+73,68,100,148,46,231,169,246,238,119,137,108,92,191,67,154,182,104,173,203,209,202,113,214,236,219,165,48,175,64,234,55,104,172,203,81,74,41,189,56,131,67,66,229,131,15,191,151,135,30,125,73,151,115,87,
+141,70,163,248,248,248,232,226,21,53,41,57,69,22,254,185,90,178,211,179,68,85,93,50,98,204,20,93,13,165,149,97,116,108,188,60,247,194,7,210,190,83,55,93,206,157,29,55,249,114,81,85,151,184,156,78,113,22,
+21,137,170,186,68,85,93,50,120,216,88,93,45,165,21,241,156,35,176,128,226,209,82,103,194,215,215,142,144,208,176,11,90,96,123,204,132,25,56,116,112,47,94,120,246,97,28,62,116,64,155,46,69,68,176,119,247,
+14,20,136,13,126,126,1,88,190,116,33,84,213,189,159,228,120,10,197,67,44,207,252,187,173,237,212,77,170,143,118,29,187,226,208,193,125,110,189,219,70,109,198,100,54,227,181,151,223,195,168,145,227,33,70,
+11,138,138,10,80,55,41,25,117,18,18,113,244,240,65,168,106,241,28,120,79,98,207,174,237,248,234,155,175,144,118,242,196,25,71,164,146,139,103,215,206,45,248,230,135,159,176,121,227,90,143,124,141,16,66,
+136,187,162,40,6,228,229,230,96,238,87,31,227,247,95,231,105,211,110,139,136,92,212,181,94,218,169,147,88,177,122,57,96,12,196,215,223,253,140,121,223,127,129,172,204,12,109,25,33,23,77,97,65,1,114,243,
+115,113,96,255,30,100,164,167,105,211,110,203,166,245,171,177,239,112,6,6,247,235,5,147,197,132,204,83,89,120,250,249,119,241,229,231,239,34,55,151,163,21,201,249,115,193,139,184,27,141,70,24,77,38,20,
+94,192,16,198,128,192,32,20,228,231,33,63,63,191,220,130,107,231,194,225,231,135,156,236,156,10,213,146,115,83,50,63,152,63,203,242,4,4,4,162,223,160,17,24,51,98,60,150,173,90,129,23,255,247,144,71,13,
+209,173,109,36,213,111,128,85,139,151,194,63,216,15,243,127,90,138,171,102,79,67,112,72,40,124,124,236,56,116,112,47,242,243,243,113,244,240,33,237,97,132,16,66,72,181,81,209,235,92,66,8,241,102,94,125,
+253,115,164,165,167,227,221,119,159,199,182,205,27,181,105,66,42,204,191,142,192,178,90,173,232,220,173,55,226,234,212,197,193,3,123,75,71,100,137,200,5,47,176,93,144,159,15,167,211,89,218,72,169,72,15,
+173,176,176,176,66,117,164,34,148,140,192,3,154,183,106,135,7,31,252,31,246,31,216,93,235,23,187,51,91,204,48,153,76,88,190,114,9,22,204,255,230,130,70,23,146,234,35,237,228,9,44,93,181,22,73,9,141,209,
+165,99,83,44,248,99,17,82,83,143,96,228,200,169,136,136,138,197,169,147,169,181,254,53,77,8,33,164,166,17,248,249,249,195,100,50,85,250,154,178,132,16,226,238,148,204,250,249,254,187,47,240,235,47,223,
+225,228,241,84,109,9,33,231,141,110,94,97,137,65,33,33,114,211,109,15,138,170,186,228,175,63,87,139,213,106,211,213,80,207,52,36,44,76,38,93,122,149,100,165,101,138,170,186,228,218,27,239,209,213,80,234,
+9,42,138,65,102,93,123,135,156,74,77,147,163,7,83,37,39,51,91,90,180,110,167,171,163,148,82,74,171,67,155,205,38,55,255,231,17,185,234,218,59,196,96,48,72,187,142,93,101,193,207,203,120,110,162,244,2,12,
+12,10,150,1,151,140,18,95,95,187,40,138,162,203,83,247,87,81,12,229,190,46,251,61,165,23,160,46,32,0,196,110,119,200,171,175,127,46,170,234,146,249,63,45,150,122,41,13,117,53,212,51,237,216,165,167,108,
+223,178,167,116,17,189,237,91,246,200,196,169,87,202,196,105,179,170,100,209,126,74,47,86,147,201,164,139,21,159,0,255,185,144,185,238,230,251,68,85,93,50,101,198,108,93,45,165,158,96,68,84,180,216,108,
+124,80,68,255,185,192,47,249,156,211,94,252,107,235,169,123,217,176,73,115,113,185,156,162,170,46,249,250,235,63,228,229,87,63,21,85,117,201,241,163,39,36,62,33,81,87,79,41,61,187,70,163,81,90,180,106,
+43,237,58,118,149,217,55,222,35,126,254,254,186,26,234,25,122,114,243,74,81,12,226,112,248,233,226,180,70,212,5,4,128,68,197,196,202,246,45,123,228,201,103,222,226,47,203,203,156,56,117,86,105,243,42,39,
+35,91,38,77,187,74,2,131,130,37,177,94,125,49,176,129,69,221,208,179,157,236,20,197,80,238,53,91,191,65,99,177,178,1,64,61,208,230,45,219,202,77,183,61,36,65,33,161,186,28,173,93,234,155,87,28,113,224,
+105,218,29,14,89,244,215,218,210,107,173,178,190,253,206,92,54,170,41,189,0,163,99,227,100,223,174,131,50,108,212,68,93,142,94,152,205,91,21,95,123,116,235,217,79,151,163,229,53,153,204,210,168,105,11,
+14,246,112,3,207,186,136,187,201,100,66,68,84,12,14,29,216,7,148,89,132,210,100,50,193,229,82,185,32,165,7,147,88,47,25,163,199,206,68,122,198,41,216,237,126,152,50,102,52,186,247,106,143,172,172,76,109,
+41,33,132,120,5,205,90,182,129,217,108,193,170,229,139,181,169,26,39,32,32,16,227,167,92,137,173,91,214,225,207,95,127,210,166,61,18,147,217,12,39,215,251,185,32,206,180,209,74,108,124,2,198,140,159,137,
+136,176,8,252,185,112,62,242,242,114,145,145,158,134,53,43,151,150,57,146,184,19,137,245,146,241,217,71,95,163,117,219,6,0,0,87,145,11,70,179,17,206,66,39,234,36,37,225,200,161,131,218,67,8,33,255,66,223,
+129,195,0,17,252,242,211,183,218,20,57,15,226,19,18,49,110,194,101,184,249,154,203,16,30,29,130,103,158,123,31,183,220,56,93,91,70,52,152,205,22,56,157,78,246,65,220,0,93,87,235,92,242,73,160,119,153,220,
+160,145,92,118,213,45,226,235,107,215,229,40,165,212,27,140,138,137,149,223,126,93,33,195,199,76,209,229,106,90,171,213,42,3,135,140,150,150,173,219,235,114,158,106,96,80,176,188,254,198,28,105,213,166,
+131,46,71,255,221,146,17,167,77,155,183,146,81,227,166,73,157,186,73,242,191,23,62,40,29,53,189,101,227,46,201,201,200,150,153,87,222,164,59,150,186,135,37,215,202,118,135,67,174,187,233,62,57,126,228,
+132,168,170,75,78,30,59,37,215,221,124,31,159,224,83,74,107,212,167,158,125,71,84,213,37,185,89,57,242,250,155,115,164,85,91,158,175,61,69,187,195,33,241,9,137,98,48,156,121,118,74,45,81,23,160,148,82,
+74,189,194,240,136,200,210,11,181,17,110,216,192,242,241,241,149,164,228,20,93,220,147,109,213,182,163,156,74,61,37,75,23,175,151,198,205,90,234,242,180,98,254,60,127,137,168,170,75,118,108,221,43,159,
+126,250,147,252,60,127,137,188,240,242,199,114,96,239,97,185,255,225,231,217,4,113,115,203,78,125,79,74,78,145,55,223,250,146,107,52,82,74,221,194,254,131,70,200,139,47,127,44,109,59,116,209,229,168,123,
+27,19,23,47,179,174,189,93,70,142,157,38,157,186,246,210,229,107,131,103,157,66,72,8,33,228,223,81,20,3,70,140,153,140,22,45,218,227,173,55,158,193,190,61,187,180,37,164,6,185,252,170,91,49,226,146,97,
+248,240,179,15,240,245,156,15,145,155,155,163,45,33,149,140,201,100,66,100,116,44,234,36,36,65,68,176,248,175,223,180,37,30,67,74,163,38,56,118,228,48,210,211,78,105,83,85,206,39,159,252,136,161,131,186,
+2,10,240,234,219,95,224,219,111,63,131,159,127,0,222,124,241,5,116,237,221,3,59,182,109,214,30,66,220,140,146,229,55,8,33,132,144,202,162,78,66,34,62,249,240,43,228,229,21,96,228,152,1,200,72,79,211,150,
+120,53,70,0,247,107,131,132,16,66,206,140,209,104,132,162,40,16,41,238,253,71,199,198,226,241,71,158,193,193,195,71,240,231,239,63,34,47,47,87,123,8,169,65,246,239,219,137,185,95,127,134,101,75,22,162,
+136,107,50,85,11,170,170,34,51,35,29,7,246,237,193,129,253,123,180,105,143,161,94,253,6,120,250,241,87,176,126,211,58,28,57,116,64,155,174,82,34,162,162,241,224,61,119,227,189,79,191,5,84,35,10,10,138,
+176,110,195,42,44,95,178,16,223,204,251,1,91,54,173,215,30,66,220,18,62,35,38,132,16,82,185,100,164,167,97,255,145,35,176,251,133,96,233,146,223,145,155,83,187,30,206,22,175,20,74,8,33,164,66,4,135,132,
+194,63,32,176,244,251,208,176,8,188,252,198,203,120,224,222,235,113,234,228,137,114,181,164,230,57,113,60,21,39,142,167,106,195,181,130,126,3,135,161,73,179,150,218,48,169,32,113,117,18,17,20,232,167,13,
+87,11,117,18,234,33,59,39,31,79,62,126,23,102,205,158,142,78,237,154,195,98,182,34,61,237,20,54,172,93,165,45,39,149,76,74,195,38,24,51,97,134,54,76,8,33,132,184,5,191,252,248,13,110,189,105,70,173,188,
+198,229,20,66,66,8,57,15,140,70,35,84,85,133,136,192,104,52,98,224,144,209,88,181,124,17,142,28,230,142,82,196,125,104,211,190,19,150,44,252,3,91,183,236,69,199,46,173,145,157,157,165,45,33,255,130,221,
+225,192,228,105,215,96,201,226,95,177,126,205,74,109,186,202,80,20,3,12,6,5,190,118,7,178,50,51,0,0,22,171,21,133,5,5,156,146,86,13,248,7,4,224,235,47,127,193,119,243,127,194,179,79,222,171,77,19,66,8,
+33,164,6,97,3,139,16,66,46,16,69,49,32,40,36,24,105,39,79,121,221,77,165,217,108,129,170,186,224,114,185,180,41,226,230,116,237,209,23,175,191,244,26,234,37,199,193,104,50,224,231,159,150,98,242,180,17,
+103,125,74,231,31,16,136,188,188,92,20,21,22,106,83,4,40,55,101,184,38,96,211,170,250,176,219,29,24,58,114,34,210,78,157,192,252,121,115,107,244,247,78,8,33,228,252,24,60,108,12,210,211,79,97,241,194,223,
+248,249,237,197,112,13,44,114,81,40,138,129,61,80,82,139,17,228,229,230,122,229,123,64,81,0,85,45,217,240,131,120,18,29,59,247,66,76,116,2,214,174,219,134,19,169,233,72,74,140,197,242,53,235,176,103,215,
+118,109,41,0,192,96,80,160,138,64,101,179,210,77,225,123,176,186,240,243,247,71,86,102,58,150,46,254,83,155,242,24,2,2,131,96,50,154,80,84,228,190,13,105,127,255,0,24,77,166,127,93,151,208,215,215,23,118,
+135,31,242,243,243,180,41,66,8,209,97,183,59,208,187,247,16,228,231,231,226,112,53,175,93,73,170,15,142,192,34,23,68,104,88,56,178,50,51,81,80,144,175,77,17,66,220,8,179,197,2,17,129,243,95,110,20,136,
+119,98,50,153,96,50,155,161,186,92,40,228,8,43,66,188,150,22,173,219,225,146,33,227,209,185,93,123,92,115,221,116,236,222,121,230,134,181,59,96,181,218,0,8,10,10,10,180,169,114,180,235,212,13,109,219,118,
+197,27,175,60,201,207,47,66,72,133,232,217,103,16,108,54,31,252,248,253,151,218,148,199,211,190,83,119,100,100,156,194,214,77,27,180,169,90,71,201,35,118,74,43,236,29,247,60,33,111,188,249,165,248,248,
+250,234,114,148,82,247,177,77,251,206,210,169,91,47,93,156,82,74,169,231,107,119,56,228,133,151,62,146,162,194,66,113,22,57,101,248,232,73,162,40,6,93,157,39,218,119,192,80,249,101,254,82,137,171,83,87,
+151,163,148,210,218,96,64,64,160,12,26,58,90,22,255,189,78,84,213,37,121,89,185,114,229,236,219,117,117,181,76,93,128,210,115,106,182,88,228,251,239,254,18,85,117,201,87,95,253,38,145,209,49,186,26,74,
+169,123,232,231,31,32,129,65,193,186,248,191,25,26,22,46,225,17,145,186,56,245,12,21,197,224,53,55,177,148,210,179,219,164,121,43,201,207,201,147,223,127,93,33,109,218,119,214,229,61,89,187,195,33,81,209,
+177,98,50,153,116,185,51,201,207,60,74,169,183,232,227,227,35,227,38,93,38,187,182,239,23,85,117,137,170,186,196,229,114,150,126,61,106,220,165,186,99,106,139,92,3,139,156,55,118,95,59,174,189,250,58,68,
+69,135,162,65,131,4,236,63,148,129,229,75,23,106,203,136,7,97,48,24,208,180,121,43,228,229,229,254,235,144,126,226,89,20,22,20,156,247,250,33,118,135,3,221,123,13,128,195,63,0,251,247,238,214,166,73,37,
+224,107,183,163,110,82,50,78,158,56,174,77,85,18,37,231,121,66,136,55,99,50,155,176,108,245,70,60,250,232,61,103,93,231,206,83,41,42,44,68,118,86,38,84,181,162,155,24,240,51,143,16,226,29,4,6,5,99,222,
+220,185,136,142,15,135,168,2,113,9,32,128,136,64,49,40,24,59,122,24,182,237,62,138,141,235,87,105,15,245,122,216,192,34,231,77,97,97,1,254,94,186,8,7,14,103,194,98,244,69,90,70,54,126,91,240,189,182,140,
+120,16,77,91,180,198,242,191,255,134,203,24,128,63,126,251,81,155,38,181,12,171,213,10,64,176,99,219,38,228,231,157,95,243,171,178,49,24,141,94,185,147,140,217,98,193,200,49,151,194,234,99,101,147,144,
+212,10,66,194,194,97,50,153,80,200,135,36,149,74,86,102,38,182,108,90,135,130,252,252,90,187,177,142,213,102,67,253,148,70,104,217,166,3,2,2,3,113,34,245,216,121,52,189,8,33,196,253,200,205,205,193,151,
+223,124,141,144,144,36,52,107,150,12,197,80,126,71,100,69,81,96,128,3,159,127,254,126,185,227,106,11,186,97,89,148,158,143,102,179,69,23,115,119,237,14,135,60,250,196,107,114,227,173,15,138,209,104,212,
+229,107,147,19,167,94,41,171,86,108,150,221,59,246,203,13,183,60,32,245,27,54,150,144,208,48,93,29,165,70,163,81,124,237,118,93,188,170,52,153,76,242,214,59,115,101,220,164,203,116,57,111,48,50,42,90,174,
+187,233,94,25,112,201,72,93,142,82,111,82,81,20,121,231,221,175,101,234,204,107,117,57,74,47,214,110,61,251,75,198,201,12,41,204,203,151,83,169,167,100,213,138,205,114,201,240,177,186,58,74,41,245,20,21,
+69,41,253,186,255,224,17,178,115,219,190,210,233,131,170,234,146,172,180,44,105,221,174,147,238,184,90,162,46,64,169,215,219,179,239,96,81,85,151,236,223,125,72,140,198,138,173,173,224,13,78,158,126,181,
+174,25,48,101,250,53,178,105,253,78,105,223,169,155,24,12,6,25,57,118,170,180,235,216,85,119,44,165,138,162,84,249,198,13,227,39,95,46,115,230,44,144,17,99,166,72,74,195,38,178,119,215,65,153,51,103,65,
+133,215,64,241,52,91,181,237,40,219,183,236,145,62,253,135,232,114,148,122,147,45,90,181,147,134,141,155,233,226,148,94,172,177,113,117,100,213,138,205,146,118,60,77,92,78,167,100,156,204,144,78,93,123,
+234,234,40,165,212,147,44,187,174,159,175,221,46,189,250,13,150,47,190,248,69,114,179,114,106,251,117,163,46,64,169,87,107,50,153,228,137,167,223,148,227,71,78,72,223,129,195,116,121,111,182,67,231,238,
+178,122,229,22,25,59,113,134,24,12,197,31,138,6,131,65,226,234,212,21,179,217,44,0,36,40,56,164,244,107,74,171,218,178,39,103,135,159,159,60,240,200,11,114,248,192,81,57,149,122,74,222,126,247,107,121,
+228,177,87,228,167,31,23,137,221,238,240,218,5,122,59,116,233,33,221,122,245,247,218,127,31,165,148,86,149,37,159,155,237,59,117,147,227,71,78,72,65,110,158,244,27,52,92,87,87,221,42,138,34,177,241,9,98,
+182,120,222,44,5,74,169,251,88,188,41,207,63,163,177,0,72,189,250,13,116,117,181,76,93,128,82,175,182,125,167,110,178,232,175,181,210,180,69,107,129,102,136,102,101,26,22,30,33,65,193,33,186,120,77,219,
+127,208,8,89,181,124,115,109,239,220,83,55,50,52,44,92,122,247,31,34,65,193,33,18,18,22,38,163,198,77,147,83,169,105,178,106,197,102,73,172,87,95,66,66,195,36,48,40,88,218,116,232,82,218,120,165,148,82,
+74,203,58,249,210,171,229,166,255,60,92,227,15,3,226,226,19,228,127,47,124,32,15,63,250,178,88,172,86,93,158,82,74,233,133,171,0,144,164,228,20,140,155,112,25,178,178,50,241,194,179,15,105,215,200,34,196,
+171,8,14,9,133,197,106,197,209,195,135,160,40,6,136,84,205,66,159,131,135,141,197,241,99,71,176,124,233,95,218,84,141,19,19,27,15,163,201,196,197,163,201,121,81,178,64,112,101,47,170,30,30,17,137,184,58,
+137,216,184,110,21,10,10,10,224,227,227,131,81,227,103,96,195,186,229,88,183,122,5,112,250,255,237,107,247,69,110,78,78,165,255,255,203,18,29,19,135,132,196,100,236,216,190,9,199,143,29,43,141,87,229,103,
+5,33,132,184,51,254,254,1,200,201,201,134,203,229,210,166,136,134,78,93,123,225,171,79,62,193,146,229,155,112,221,141,51,113,96,223,30,109,9,33,132,144,139,225,241,167,222,148,236,244,44,81,85,151,12,25,
+49,94,215,225,162,148,94,152,102,139,133,163,69,168,87,89,242,84,187,119,191,75,164,223,160,202,153,126,171,29,1,169,125,114,174,40,202,233,225,211,85,255,94,234,208,185,187,28,218,119,84,84,213,37,199,
+143,156,144,187,239,127,70,82,26,53,213,213,81,74,105,109,80,81,20,25,54,106,162,124,243,245,31,146,156,210,72,151,167,122,47,155,117,179,124,240,225,247,226,231,31,160,203,85,182,129,129,65,186,24,245,
+44,77,38,179,116,235,217,79,58,117,237,169,187,30,162,148,158,197,146,149,236,191,255,254,47,125,146,82,74,41,45,211,88,106,220,172,165,228,231,228,74,94,118,174,52,111,213,86,87,119,161,150,52,169,74,
+230,250,151,255,254,226,27,88,21,57,254,211,79,127,42,183,195,139,170,186,36,55,51,71,174,186,246,14,174,11,71,41,173,117,198,39,36,202,95,127,174,145,215,94,255,66,34,34,163,116,121,170,55,34,42,90,108,
+54,155,46,94,153,38,36,213,147,175,191,254,93,246,239,57,196,93,108,61,92,131,193,32,189,250,14,146,161,35,39,120,237,102,53,148,86,186,59,182,238,149,194,188,2,105,223,169,187,62,73,41,165,148,158,214,
+106,179,149,54,121,78,28,61,41,63,253,184,88,122,245,187,68,87,87,25,86,70,211,170,196,178,127,206,217,46,16,163,99,227,229,248,145,19,229,27,88,46,103,233,215,61,250,12,212,29,67,41,165,222,108,68,84,
+180,140,28,55,85,66,66,195,116,57,90,51,54,109,222,170,220,185,202,229,114,202,236,27,238,150,192,32,142,198,162,148,214,14,13,157,187,119,64,187,206,93,176,108,241,159,218,217,133,132,16,66,200,233,181,
+175,128,224,224,80,88,173,22,172,92,190,5,83,175,184,18,47,191,241,2,26,52,108,14,147,201,164,61,228,162,17,81,43,125,205,169,54,237,59,99,205,202,205,88,248,199,42,180,104,221,190,92,110,208,37,99,16,
+18,17,84,46,6,69,1,0,184,156,46,28,79,61,90,62,71,8,33,94,206,177,35,135,241,213,103,239,227,228,137,227,218,20,169,1,20,197,128,187,239,122,172,220,185,74,81,20,60,255,204,3,248,241,251,63,17,159,144,
+88,174,158,144,170,68,81,12,165,215,135,132,84,55,186,174,22,165,148,86,182,54,31,31,169,151,210,80,108,54,31,93,142,186,159,70,163,81,160,153,218,103,52,26,197,225,231,39,118,187,189,92,109,101,141,148,
+170,10,75,254,110,49,113,117,100,243,198,93,165,79,173,211,142,167,73,120,68,100,105,93,159,1,67,37,253,68,186,228,102,102,75,230,169,140,114,35,177,38,76,185,82,247,231,82,74,41,165,213,237,151,115,22,
+148,31,41,124,218,189,187,14,74,199,46,61,116,245,148,86,149,101,175,253,58,119,235,45,29,187,244,212,213,208,202,115,192,224,145,210,170,109,71,93,188,54,202,182,41,33,164,202,137,137,141,199,231,159,
+254,132,249,223,205,71,96,144,102,148,11,241,24,92,46,23,178,179,178,144,147,147,83,46,94,217,35,165,42,147,146,191,91,108,92,29,220,253,224,3,24,54,106,18,174,189,233,62,220,243,200,51,200,207,207,47,
+173,91,240,211,183,104,222,182,53,154,183,109,139,129,195,71,98,249,210,77,56,121,44,13,211,46,187,30,159,124,240,90,153,63,209,251,105,209,186,61,66,66,195,180,97,175,198,225,231,135,148,70,77,16,18,22,
+174,77,17,66,136,219,112,215,125,55,98,215,246,3,218,48,54,109,217,131,157,59,182,106,195,196,3,240,220,81,76,2,0,232,209,123,32,222,121,237,45,216,29,126,218,2,82,137,28,79,61,130,220,220,242,215,223,
+213,141,143,143,47,194,35,34,181,97,29,22,139,5,126,126,254,218,240,5,99,183,59,16,30,25,85,110,198,135,174,171,69,41,165,149,233,29,247,60,41,206,162,34,25,63,229,10,238,204,232,33,150,60,89,171,204,181,
+168,60,73,163,201,36,17,81,209,186,184,183,27,28,26,38,167,82,79,201,251,31,124,39,65,193,33,186,188,183,122,199,61,79,74,81,65,161,28,59,148,42,111,191,51,87,218,118,232,162,171,161,148,82,119,112,246,
+13,247,200,246,45,123,100,204,132,233,242,232,19,175,73,97,65,129,60,247,226,135,186,58,234,25,6,5,5,151,142,122,247,52,59,119,235,45,206,162,34,89,186,120,189,132,134,133,235,242,212,187,140,141,79,144,
+230,45,207,189,129,147,191,127,128,76,191,252,6,233,222,123,128,68,70,69,159,117,237,217,138,234,107,183,203,141,183,62,32,47,188,244,81,217,215,152,190,176,54,107,50,155,197,207,207,191,86,93,184,83,90,
+149,90,172,86,25,57,118,42,111,8,61,204,146,237,156,203,54,176,218,118,232,34,201,41,13,117,181,222,102,109,108,216,1,16,95,95,187,220,124,251,35,146,118,60,77,84,213,37,135,246,31,149,148,134,77,116,117,
+222,232,141,183,62,40,187,182,237,43,253,183,47,89,180,94,76,38,238,60,73,169,167,232,239,31,32,125,7,14,147,208,240,8,93,174,178,141,138,137,149,118,29,187,214,88,211,193,108,177,72,88,153,127,231,216,
+137,51,165,101,235,246,186,58,234,25,122,242,53,71,203,54,237,229,251,239,22,74,135,206,220,12,142,22,219,161,75,15,185,229,246,71,36,34,50,74,46,189,252,122,105,223,169,155,174,230,124,84,20,131,68,70,
+197,72,108,124,66,233,117,153,114,58,89,171,177,88,173,0,0,213,165,194,225,231,128,203,229,130,211,233,68,94,110,174,182,148,16,114,158,40,138,193,173,167,152,145,51,163,253,189,69,68,70,225,239,63,150,
+192,215,199,138,206,61,187,96,239,238,93,229,234,137,231,227,31,16,136,190,3,134,35,59,59,3,13,26,52,195,245,179,102,98,252,212,201,88,190,100,161,182,212,235,80,20,5,190,118,59,130,130,66,16,29,27,143,
+83,39,143,99,231,118,78,199,33,196,83,240,243,15,192,181,215,223,131,191,254,254,25,127,253,254,179,54,93,105,116,234,218,11,159,188,247,1,226,18,34,241,195,247,139,112,211,109,179,176,99,235,102,109,25,
+33,132,212,74,124,125,237,176,59,28,168,87,191,17,26,52,108,142,149,43,254,194,134,181,171,180,101,23,69,173,111,96,89,172,86,248,216,124,80,84,84,136,188,188,60,136,212,234,31,7,33,132,148,82,210,196,
+82,20,3,238,186,239,105,60,120,239,117,216,185,109,63,118,238,62,132,201,83,135,227,212,201,19,218,67,136,23,160,40,6,56,28,14,40,6,3,50,51,210,181,105,66,220,138,192,160,96,132,132,133,227,208,254,125,
+200,207,207,211,166,73,45,194,106,181,193,96,48,32,47,175,106,30,64,39,36,214,195,210,133,139,17,30,29,82,26,59,180,63,21,109,59,181,193,209,195,135,202,213,18,226,237,148,125,208,217,179,207,32,88,172,
+86,204,255,97,174,182,140,212,82,122,245,27,140,180,83,39,177,97,237,42,56,157,69,218,244,69,225,169,171,198,93,16,198,51,108,245,94,88,80,128,140,140,116,228,230,230,178,121,69,72,5,240,181,219,49,116,
+228,4,244,233,63,4,138,162,104,211,196,11,105,217,166,61,218,180,104,137,79,62,249,9,223,204,251,13,61,186,182,192,140,203,111,212,150,17,47,65,68,69,112,104,24,178,179,179,180,41,66,220,142,123,239,127,
+22,91,215,175,195,230,13,219,240,242,171,159,98,248,232,201,112,112,49,97,143,36,54,190,14,94,123,227,11,244,236,51,72,155,170,16,5,5,249,85,214,188,2,128,160,224,144,114,205,43,0,136,137,15,71,114,74,
+227,114,49,66,188,157,226,133,231,139,239,155,91,183,235,132,5,63,125,131,1,253,71,32,48,144,27,53,213,118,140,70,35,76,102,51,126,251,249,7,172,89,185,180,210,155,87,37,232,230,26,122,155,17,81,209,242,
+231,239,43,229,143,223,87,138,195,207,95,151,167,148,86,220,225,163,39,151,110,219,252,208,163,47,139,143,143,143,174,134,122,143,138,98,16,135,195,79,124,124,124,196,108,54,75,112,72,136,52,109,222,74,
+90,183,235,164,171,165,148,210,234,246,189,247,191,45,61,39,169,170,75,114,179,114,36,42,58,86,87,71,221,219,136,200,40,217,186,105,119,241,239,48,51,71,134,142,156,40,40,179,30,163,187,120,203,29,255,
+45,247,122,251,230,155,63,36,48,40,88,87,71,43,95,46,18,238,62,150,172,219,21,28,18,42,75,23,175,23,85,117,201,254,61,135,164,91,175,126,186,90,90,123,84,20,131,116,239,53,160,58,222,171,186,128,87,233,
+107,183,203,39,159,252,88,122,162,249,223,243,239,87,248,100,104,50,153,121,82,170,133,6,135,134,201,140,43,110,148,102,45,219,232,114,20,50,104,232,24,113,57,139,68,85,93,226,114,22,73,131,198,77,117,
+53,148,82,74,105,117,120,239,131,207,149,107,40,92,125,221,157,186,26,111,242,242,171,110,145,209,227,167,235,226,158,108,88,120,132,108,57,221,188,82,93,206,210,223,229,244,43,110,208,213,214,180,70,163,
+81,6,92,50,74,230,255,180,88,46,189,252,122,177,90,173,186,26,90,185,58,252,252,228,147,79,126,148,212,195,199,165,223,160,225,186,60,173,126,75,26,88,145,81,209,146,113,50,163,244,61,59,97,202,21,186,
+90,234,253,90,109,54,1,32,22,139,69,98,98,227,47,122,231,193,10,168,11,120,141,65,193,33,50,119,238,111,229,46,108,84,213,37,247,62,240,63,177,157,254,65,159,75,139,213,42,193,33,161,30,189,59,4,61,127,
+135,140,24,47,57,25,217,210,165,123,31,93,142,22,95,72,204,156,117,179,236,216,178,87,182,109,222,35,117,147,146,117,53,238,160,217,98,145,113,147,46,147,137,83,175,44,23,31,53,110,154,116,238,222,91,87,
+79,41,165,90,141,70,147,12,29,53,81,102,94,121,147,152,205,22,93,158,214,188,19,167,94,41,199,143,158,144,109,155,247,200,204,43,111,210,229,189,201,230,173,218,150,94,203,206,153,179,64,234,55,104,172,
+171,241,68,3,2,2,101,213,242,205,186,6,150,203,229,148,110,61,221,103,68,7,239,7,106,198,97,163,38,149,190,38,246,238,58,40,1,129,65,186,26,90,253,150,188,31,174,186,246,142,210,223,79,247,94,253,117,117,
+212,187,141,141,79,144,109,155,119,203,163,79,188,46,14,135,159,46,95,69,234,2,94,99,163,166,45,164,32,47,95,215,192,82,85,151,180,106,219,65,80,186,69,124,197,70,100,209,218,97,76,92,188,116,236,210,83,
+23,167,255,156,172,204,22,139,140,30,127,169,12,27,53,169,198,182,145,62,151,70,163,81,134,140,24,47,255,185,235,49,105,219,161,75,105,92,81,12,114,205,13,119,203,207,243,151,74,74,195,38,186,227,40,165,
+180,68,179,197,34,225,145,81,210,179,239,32,233,212,173,23,111,94,221,212,193,195,198,202,29,247,60,41,118,135,67,151,243,38,109,54,155,124,247,237,194,114,215,178,123,119,29,148,208,240,42,159,170,81,
+45,70,197,196,202,146,69,235,68,85,93,146,159,157,43,43,150,110,20,85,117,201,252,159,150,232,106,221,73,126,46,84,189,247,61,244,124,185,215,61,155,36,238,97,201,61,180,143,143,143,220,120,219,67,242,
+224,127,95,170,142,169,99,212,205,188,242,154,255,148,190,55,239,186,239,105,81,12,213,242,153,168,11,120,149,79,61,251,118,185,15,189,21,75,55,202,101,179,110,150,58,117,147,4,101,230,214,71,197,196,202,
+83,207,190,35,255,123,254,125,9,10,230,180,65,74,207,102,201,197,90,64,96,144,91,174,127,101,52,154,100,252,228,203,101,224,144,209,103,109,78,55,109,209,74,174,186,238,78,9,143,136,212,229,104,177,188,
+40,167,181,93,63,63,127,241,15,8,212,197,169,123,105,50,153,220,242,92,84,217,70,199,196,73,250,137,116,81,85,151,184,156,197,163,148,10,114,243,36,58,38,78,87,235,105,150,156,111,28,14,63,185,230,250,
+187,165,219,233,6,69,171,182,29,164,239,192,97,60,31,213,114,159,120,250,77,41,42,40,148,227,71,78,200,238,237,251,203,61,152,244,84,35,34,163,75,239,69,61,89,190,55,107,183,161,225,17,178,99,235,222,114,
+189,150,43,103,255,71,87,87,217,42,167,191,240,58,74,182,246,236,212,181,23,254,248,229,71,152,44,197,59,16,206,251,97,17,70,143,237,143,252,188,188,210,154,132,196,122,88,250,215,98,132,71,133,64,68,208,
+176,113,51,108,223,186,89,251,71,18,114,70,202,110,35,91,91,184,144,127,115,80,112,8,218,180,239,140,252,188,60,172,88,246,55,242,243,170,102,187,115,131,193,128,136,200,104,164,30,59,2,151,203,165,77,
+151,18,26,22,142,252,188,60,238,180,118,6,172,54,27,12,138,130,188,42,250,29,17,66,8,57,63,76,38,19,126,253,101,41,186,118,111,9,0,56,114,224,56,38,92,58,21,11,127,255,89,91,234,113,20,239,104,86,188,3,
+42,33,90,34,163,98,16,20,18,138,172,204,12,100,102,164,35,51,35,93,91,226,113,132,71,68,194,199,199,23,251,246,238,214,166,42,157,250,13,26,161,119,191,97,216,190,117,3,126,253,249,123,109,250,162,185,
+144,123,2,226,29,12,28,50,26,33,161,225,216,179,107,27,162,98,226,145,148,216,0,43,150,47,196,111,191,252,160,45,173,116,116,93,45,111,176,164,35,60,101,198,108,185,245,142,71,101,218,101,215,201,209,131,
+169,242,217,103,243,197,100,54,151,171,155,51,103,129,100,156,204,144,91,110,127,68,122,247,187,132,235,92,208,10,25,16,248,207,147,249,138,62,129,48,153,205,110,57,229,174,42,173,223,160,177,220,252,159,
+135,101,229,242,77,226,114,22,137,203,89,36,127,253,185,90,250,12,24,170,171,165,238,97,241,176,240,138,189,166,41,165,244,98,76,172,87,95,150,46,94,47,253,7,143,208,229,104,121,219,119,234,46,235,86,111,
+147,91,110,127,68,130,67,66,117,121,79,182,236,121,135,231,32,74,43,71,139,213,42,3,134,140,146,125,187,14,138,179,168,72,46,191,250,86,241,15,8,208,213,81,122,33,198,198,213,209,197,170,73,93,160,70,108,
+216,184,153,116,232,220,93,124,237,118,93,238,98,108,215,177,171,68,199,22,15,175,174,223,176,113,233,194,127,101,79,146,87,92,125,171,180,110,215,81,119,44,173,25,171,97,231,130,139,50,32,48,80,190,249,
+230,15,57,124,224,152,76,157,49,91,140,198,226,191,239,185,46,182,76,38,147,4,6,5,75,66,98,189,90,181,248,164,201,108,150,119,222,251,166,220,208,210,18,243,179,115,165,125,167,238,186,99,40,165,148,214,
+14,77,102,179,220,122,231,163,242,209,199,243,228,169,103,223,145,217,55,222,163,171,161,229,117,247,107,36,74,169,251,168,40,6,137,142,141,151,46,221,251,200,91,239,204,149,212,195,199,229,213,215,63,
+151,136,200,40,93,45,165,23,234,217,150,108,169,66,117,129,106,181,228,166,191,117,187,78,242,209,71,63,200,128,75,70,234,106,42,195,178,63,88,69,81,206,216,108,56,83,140,86,175,189,251,93,34,227,39,95,
+174,139,87,151,103,123,13,148,196,253,252,253,229,173,119,230,150,107,196,172,95,179,237,95,23,148,52,24,12,98,50,153,196,106,181,213,196,155,188,198,84,20,131,110,139,243,178,190,252,234,167,186,99,40,
+165,148,214,14,155,183,108,35,31,127,242,163,40,138,34,237,59,117,147,83,169,105,110,187,179,173,187,121,182,235,21,74,41,61,155,73,201,41,50,104,232,104,73,105,84,188,145,81,187,142,93,165,83,215,94,186,
+58,74,221,89,183,90,3,203,63,32,16,138,162,32,35,61,77,155,186,96,138,231,213,11,68,164,116,142,61,192,121,246,238,74,147,102,45,17,21,29,135,95,126,250,86,155,114,11,30,125,242,117,252,231,230,153,80,
+93,42,32,128,193,84,252,154,202,78,207,65,253,38,13,113,244,240,33,237,33,181,158,126,3,135,225,167,31,190,210,134,145,121,42,11,179,111,189,19,31,190,243,178,54,69,8,33,164,22,224,112,248,193,104,50,149,
+94,247,53,104,220,20,169,71,143,224,212,201,19,218,82,66,8,33,149,72,167,174,61,225,231,23,136,105,147,47,199,162,101,139,240,227,15,95,96,247,206,237,218,50,66,220,14,35,128,251,181,193,154,162,160,32,
+31,5,249,249,218,240,69,82,182,63,87,182,121,71,220,145,212,99,71,177,123,231,54,109,184,74,9,10,14,65,80,112,8,114,115,115,32,34,240,241,241,133,213,102,69,81,97,161,182,20,113,117,18,49,116,112,63,40,
+167,91,191,138,65,1,0,88,108,22,108,221,113,24,107,86,45,209,30,82,235,73,75,59,137,227,105,78,116,106,219,10,22,155,5,46,167,11,143,60,254,26,110,187,253,70,183,109,84,18,114,46,252,3,2,96,50,153,81,84,
+164,255,140,32,132,84,156,194,194,194,114,215,125,39,142,167,34,47,47,183,92,13,33,132,144,202,167,97,227,230,232,215,111,24,86,174,89,129,136,136,40,228,231,231,97,231,142,45,218,50,66,220,14,183,26,129,
+69,72,77,208,103,192,16,92,62,125,54,94,121,253,89,0,192,216,49,151,98,247,190,221,120,250,177,187,203,141,212,83,20,5,34,130,135,31,123,5,119,222,118,5,0,32,39,35,7,119,62,244,20,186,118,232,2,163,209,
+136,81,163,122,151,214,147,242,180,237,208,5,205,91,118,192,177,163,7,241,253,215,159,65,132,31,61,228,236,88,109,54,136,8,10,11,10,180,169,26,37,62,33,17,35,71,79,197,103,31,191,129,35,28,113,73,8,33,
+132,16,15,165,73,243,86,200,205,205,198,238,29,28,121,69,60,7,54,176,72,173,39,44,60,2,19,166,204,66,235,230,173,209,173,99,75,28,56,148,138,7,30,189,31,191,206,255,174,92,93,201,54,177,14,63,127,188,253,
+214,28,12,232,211,30,99,38,79,195,252,121,95,3,0,162,162,99,113,228,240,193,114,199,16,110,175,75,46,12,95,95,95,40,138,1,57,57,217,218,84,141,225,231,239,143,203,174,188,5,107,215,46,197,239,191,204,211,
+166,9,33,68,135,197,106,117,187,70,60,33,132,16,226,169,176,129,69,170,141,240,200,40,216,108,62,216,191,119,183,54,85,227,248,251,7,224,199,31,254,68,131,250,241,232,222,183,55,54,174,95,163,45,41,93,
+67,77,68,133,197,98,65,104,88,4,14,31,58,80,99,13,154,184,58,117,113,96,223,30,109,152,16,175,193,100,50,193,233,116,106,195,53,130,159,159,63,166,206,188,14,123,118,111,197,188,111,231,104,211,132,16,
+2,0,168,155,84,31,233,105,39,145,118,234,36,234,38,38,227,177,71,95,196,59,31,188,142,159,190,255,82,91,74,8,33,181,138,154,186,103,34,222,133,91,173,129,69,188,27,155,205,7,17,145,209,48,26,141,200,202,
+204,212,166,107,148,130,130,2,252,189,228,47,124,245,237,183,88,179,114,153,54,125,154,226,245,211,20,197,0,151,203,137,172,172,76,40,138,1,138,2,40,6,67,181,78,137,51,91,44,184,253,206,199,97,178,152,
+176,115,59,231,171,19,239,67,81,12,48,155,77,112,185,92,218,84,141,16,16,20,8,129,224,215,249,223,243,185,15,33,228,172,4,4,6,162,160,32,31,249,121,121,112,185,156,56,145,118,10,251,246,238,192,137,227,
+169,218,82,66,8,241,106,74,54,83,251,7,129,221,238,64,243,86,109,113,236,232,225,106,189,119,34,222,3,71,96,145,106,37,34,42,26,97,225,145,216,184,110,181,54,229,54,84,228,233,64,217,154,178,35,179,170,
+139,174,61,250,98,194,248,153,216,181,103,39,158,125,242,94,168,106,245,253,191,9,33,132,16,66,8,33,228,223,8,12,10,198,125,247,63,139,3,135,246,97,235,214,245,232,223,119,24,58,181,107,133,158,125,58,
+32,59,43,75,91,78,200,191,194,6,22,33,30,72,183,94,253,17,17,17,141,140,140,52,20,21,22,96,245,202,165,165,219,144,19,226,13,40,138,1,62,62,54,228,230,158,121,71,50,135,195,129,168,152,56,236,221,179,235,
+140,59,134,18,66,8,33,132,144,154,37,56,52,12,107,150,175,69,92,66,36,0,192,89,80,132,49,147,103,226,155,47,63,210,150,186,53,157,187,245,70,80,112,40,214,174,94,134,131,251,247,106,211,164,26,41,30,58,
+66,8,241,40,22,254,54,31,95,124,242,14,254,254,227,23,216,124,236,168,87,191,161,182,132,184,17,145,209,49,104,213,182,3,154,181,108,131,14,157,123,32,60,162,248,36,78,206,77,97,153,198,148,162,40,80,20,
+5,86,171,13,131,134,142,193,210,197,107,241,213,103,223,194,215,215,183,220,49,132,16,66,46,156,216,248,58,248,239,227,175,162,67,231,30,218,20,33,132,156,55,185,217,217,216,184,249,159,245,143,139,10,
+157,112,58,61,235,193,227,149,215,252,7,127,253,241,51,190,253,234,99,108,92,189,22,35,199,78,213,150,144,106,166,120,97,31,122,65,118,237,217,79,198,78,156,41,54,155,77,151,163,180,186,52,153,76,186,24,
+117,15,237,118,135,220,121,239,147,178,116,241,122,89,182,100,131,44,91,178,65,134,142,156,160,171,163,21,115,246,13,119,75,78,70,182,188,249,246,87,210,182,67,23,93,158,82,74,233,133,91,175,126,67,121,
+240,145,23,165,89,203,54,186,28,165,238,164,201,108,150,136,200,40,81,20,131,46,71,107,222,146,223,75,74,163,38,146,126,50,93,178,211,179,36,253,68,186,168,170,75,210,142,167,201,192,33,163,116,199,184,
+163,17,81,209,146,118,60,77,84,213,37,46,151,179,244,191,253,7,13,215,213,210,106,83,23,160,21,52,58,38,78,242,179,115,69,85,93,50,112,200,104,93,158,82,74,99,226,234,200,177,195,199,69,85,93,165,142,155,
+116,153,174,142,86,204,150,109,58,72,189,250,13,117,113,74,41,165,148,214,30,147,83,26,201,160,161,99,196,104,52,234,114,212,125,140,136,140,146,177,19,103,74,243,150,109,165,65,163,166,114,233,101,215,
+203,190,93,7,229,234,235,239,210,213,186,163,201,41,13,197,89,84,36,170,234,18,103,81,145,184,156,197,95,255,249,251,74,93,45,173,54,117,1,90,65,159,254,223,59,146,147,145,45,115,230,44,144,164,228,20,
+93,158,210,170,112,192,37,35,37,40,56,68,23,167,238,167,162,40,162,40,6,25,57,118,170,252,56,111,145,252,186,96,185,92,125,221,93,18,24,20,172,171,165,148,82,74,41,141,140,138,150,62,253,135,200,165,151,
+95,47,77,154,181,212,229,41,36,32,32,80,250,13,28,38,17,145,209,186,28,117,127,109,54,155,24,141,70,81,20,69,151,115,71,175,184,230,54,41,202,47,40,125,16,93,152,95,32,189,251,93,34,126,254,1,18,22,30,
+161,171,167,85,174,46,64,43,104,191,65,195,165,73,243,86,186,56,165,85,233,192,33,163,228,210,203,174,151,160,96,54,65,104,237,179,164,41,168,141,83,74,41,245,110,125,237,118,233,212,181,151,196,213,169,
+171,203,121,147,237,58,118,149,229,75,55,74,118,70,182,140,153,48,67,151,167,16,131,193,32,54,155,143,46,78,221,83,69,49,156,214,51,26,86,103,178,105,139,214,114,235,29,143,202,158,157,7,100,226,212,43,
+5,128,76,191,252,122,57,176,247,176,152,45,22,93,61,173,58,185,11,33,33,30,70,80,112,8,158,121,230,45,172,92,179,2,239,191,253,2,178,178,50,181,37,228,95,176,217,108,48,154,76,200,201,206,214,166,8,33,
+132,16,226,134,36,38,37,227,163,247,231,224,253,79,63,197,43,47,60,170,77,123,21,137,245,234,35,48,40,4,155,54,172,65,65,126,190,54,237,149,4,4,6,161,107,143,126,56,122,228,32,86,46,91,164,77,19,82,35,
+40,138,1,34,106,233,247,190,190,118,228,230,230,0,0,218,118,232,130,158,189,46,193,11,207,62,128,188,188,188,50,71,145,170,196,8,224,126,109,144,16,226,190,228,231,229,97,247,158,237,104,219,174,43,118,
+239,217,142,83,39,142,107,75,200,191,208,172,101,91,92,125,205,29,200,200,74,195,225,131,251,181,105,66,8,33,132,156,5,135,195,15,109,218,119,129,42,42,138,138,10,225,116,58,181,37,85,66,126,65,62,96,113,
+64,84,21,171,87,46,241,234,103,240,105,167,78,226,200,225,131,112,157,229,103,171,40,138,54,228,209,24,12,6,188,248,210,71,120,226,209,187,112,233,148,201,216,184,109,47,182,110,94,175,45,35,164,6,16,40,
+138,225,244,123,78,80,84,84,84,154,57,124,112,63,22,253,181,160,218,62,3,73,49,108,96,17,226,129,164,30,59,130,63,126,251,17,25,105,167,32,226,189,23,112,85,197,169,147,39,80,88,84,128,46,93,251,33,191,
+32,7,71,14,29,212,150,16,55,66,81,12,94,125,163,66,8,33,158,132,170,170,136,138,137,67,215,238,253,209,164,105,107,108,88,183,18,170,250,207,8,133,170,194,89,84,132,149,203,255,198,170,21,139,106,237,57,
+161,103,159,129,120,227,213,15,177,118,195,26,28,59,122,68,155,246,72,108,54,27,30,124,228,69,92,51,107,60,142,28,60,14,187,175,15,38,78,24,133,99,39,11,177,106,197,226,90,251,187,62,19,86,155,13,141,155,
+52,71,126,126,190,71,140,204,171,147,144,136,150,109,58,96,239,238,157,218,148,135,81,50,123,141,184,3,108,96,17,226,193,176,121,117,97,184,92,78,236,221,189,3,91,54,175,133,175,221,129,212,99,222,113,
+17,232,189,8,204,102,51,26,55,109,129,180,180,147,80,93,174,74,105,106,89,44,22,132,134,71,32,55,231,220,83,73,219,117,236,138,156,156,108,228,231,115,120,56,113,127,140,70,35,250,14,24,138,176,136,40,
+28,60,176,87,155,38,228,162,81,85,21,7,15,236,197,238,221,219,144,118,234,56,78,158,72,229,245,72,53,224,240,243,195,235,47,191,135,109,59,118,99,238,220,143,145,239,37,83,150,76,38,51,84,113,225,181,215,
+223,194,83,207,60,129,207,230,124,137,195,199,114,97,181,218,176,248,239,5,124,109,157,38,34,50,10,67,70,76,66,98,82,3,236,217,189,205,237,151,16,137,137,139,199,103,31,127,131,204,156,2,44,254,251,87,
+109,154,120,8,6,131,1,157,186,246,130,175,221,142,147,199,83,181,233,26,67,183,48,22,165,148,82,234,46,6,4,6,201,93,247,61,45,39,143,157,146,219,239,126,66,154,181,108,163,171,185,16,173,86,219,57,119,
+244,140,171,83,87,154,181,108,35,173,219,117,18,95,95,187,46,79,169,187,233,227,227,35,239,190,247,77,233,78,73,127,47,92,35,67,71,78,244,232,133,115,41,245,118,99,227,19,36,32,48,72,23,215,106,182,88,
+36,169,126,3,49,24,141,186,28,245,126,163,99,227,165,107,207,190,18,18,26,166,203,85,165,45,90,183,147,190,3,135,138,201,108,214,229,206,164,201,100,18,0,210,160,113,83,153,58,227,90,137,136,226,78,145,
+158,108,72,104,152,236,218,190,95,126,248,238,47,9,8,8,212,229,107,72,93,128,82,74,41,117,11,19,147,235,203,186,213,219,74,111,200,85,213,37,91,55,237,22,135,159,159,174,182,178,52,153,76,210,171,223,96,
+249,113,222,34,89,177,108,147,180,104,221,78,87,67,169,59,250,216,147,175,151,123,175,148,56,126,202,21,186,90,74,169,123,216,171,239,96,137,79,72,212,197,107,163,220,101,216,189,236,222,107,128,228,101,
+229,136,170,186,100,246,13,119,139,193,240,239,191,31,62,48,241,46,173,86,171,220,251,224,115,114,242,216,41,153,58,243,90,93,190,38,228,20,66,130,232,216,56,140,30,55,3,107,87,47,213,166,8,33,164,70,73,
+172,151,130,187,239,190,165,92,44,36,44,16,105,89,192,226,191,127,43,23,175,44,20,69,65,100,116,12,204,86,7,190,155,247,45,22,253,249,11,23,232,36,110,143,175,175,29,239,190,249,26,236,14,31,168,46,21,
+34,2,17,129,98,80,16,25,22,135,119,222,121,77,123,8,33,196,13,216,187,103,39,50,210,211,180,225,243,198,225,231,135,196,228,20,196,198,39,224,232,145,67,218,180,135,32,218,0,169,33,122,245,29,140,95,230,
+125,13,179,205,2,0,24,208,175,7,242,138,108,88,185,124,17,92,46,94,19,213,22,92,46,23,254,252,253,39,124,63,127,62,78,164,30,117,155,207,22,93,87,139,214,46,199,77,154,41,170,234,146,251,31,126,65,236,
+118,78,147,169,44,43,242,148,130,82,250,239,14,30,54,182,244,9,96,137,243,126,248,91,87,71,189,215,144,208,48,25,60,108,172,52,106,218,66,151,163,197,154,204,102,89,183,166,120,180,162,179,168,72,156,133,
+69,226,44,42,18,85,117,201,170,229,155,117,245,148,82,207,182,100,180,82,203,214,237,229,245,55,231,200,190,221,135,164,48,47,95,92,46,167,204,255,105,137,132,69,68,234,142,161,180,162,54,107,217,70,178,
+210,50,203,93,123,125,57,103,129,4,6,5,235,106,41,173,102,117,1,90,203,124,241,149,79,74,63,152,158,121,238,61,93,158,86,204,232,152,56,25,59,113,166,60,247,226,7,242,247,194,53,178,106,197,102,185,233,
+182,135,196,98,181,234,106,41,165,231,231,148,25,179,229,215,95,150,201,255,94,248,64,174,185,225,110,105,214,178,141,216,237,14,49,114,45,16,175,215,110,119,200,172,217,183,203,222,93,7,229,145,199,95,
+145,112,222,148,157,213,119,74,214,191,114,57,197,89,84,36,46,167,83,84,213,37,179,102,223,161,171,165,148,122,190,109,218,119,146,220,204,242,15,120,74,92,182,100,67,133,214,214,162,84,107,201,52,192,
+22,173,218,202,220,185,191,139,179,168,72,222,120,235,75,137,137,141,215,213,82,207,214,108,177,136,195,81,117,203,114,84,145,186,0,173,69,70,199,198,73,234,145,19,165,39,187,140,147,233,92,172,248,2,108,
+220,180,133,28,63,250,207,207,177,172,221,123,245,215,213,83,74,43,174,221,225,144,228,148,134,18,22,30,81,46,94,55,41,89,124,124,124,116,245,212,187,244,15,8,148,86,109,58,72,183,158,253,165,107,143,190,
+210,186,93,39,49,91,44,186,58,10,25,61,254,82,113,185,138,155,86,37,186,92,78,105,208,168,169,174,150,82,234,217,250,249,249,203,142,173,123,139,223,231,78,103,177,174,211,255,61,221,188,254,252,139,95,
+120,158,164,231,173,162,24,74,71,248,69,199,196,201,232,241,151,74,120,100,148,174,142,122,190,225,145,81,50,108,212,68,93,220,157,53,104,231,19,146,218,69,100,100,12,66,35,130,74,191,127,228,233,87,184,
+85,252,5,208,190,83,47,132,132,255,243,115,44,75,92,124,146,54,68,46,130,46,221,251,160,67,231,30,218,48,241,98,114,115,114,145,158,118,10,185,185,57,165,49,69,81,176,103,215,14,228,121,201,54,226,228,
+236,100,102,164,99,245,202,165,88,248,251,124,44,249,251,119,168,170,11,38,163,81,91,70,0,204,249,244,93,180,237,208,5,195,70,77,194,181,55,221,135,247,222,255,14,227,38,93,134,173,155,55,104,75,9,169,
+86,226,234,212,69,219,246,157,161,40,138,54,69,46,16,17,129,205,90,188,62,145,162,156,182,76,14,0,6,246,233,0,63,255,128,50,71,17,242,239,136,168,16,81,161,40,6,28,62,116,0,115,62,125,23,169,71,143,104,
+203,136,23,112,242,120,42,76,38,51,250,12,24,170,77,185,53,186,174,22,173,61,250,248,248,200,136,49,83,100,214,181,119,72,143,62,3,117,121,90,49,39,77,155,165,27,121,85,226,204,89,55,233,234,233,133,217,
+188,85,91,201,78,207,146,220,204,28,73,105,216,68,151,167,148,122,143,37,235,8,114,154,40,165,158,239,152,9,51,36,47,59,87,230,204,89,32,141,155,181,212,229,233,133,217,186,93,39,217,187,235,160,238,218,
+83,85,93,146,118,60,77,186,246,232,171,59,134,82,74,203,218,166,125,103,89,178,104,157,68,68,69,235,114,238,168,114,250,11,66,200,69,208,182,67,23,44,253,251,119,228,100,230,225,216,177,83,128,2,4,248,
+219,177,125,231,65,76,187,108,60,118,109,223,166,61,132,156,39,81,49,177,248,253,231,133,168,223,176,14,0,96,193,207,203,49,100,120,79,20,228,231,107,75,9,33,30,70,189,250,13,16,26,22,137,168,232,88,36,
+38,54,64,143,46,221,96,54,153,240,204,11,143,227,143,95,127,66,97,65,129,246,16,66,136,7,17,25,21,141,73,83,175,198,213,51,167,66,85,5,211,46,159,142,197,127,85,205,78,178,181,5,69,49,64,68,69,68,100,20,
+134,12,159,136,152,152,120,212,173,83,23,147,198,15,64,81,126,17,186,244,238,141,213,43,184,195,56,33,228,220,216,29,14,116,237,209,15,107,86,46,193,49,15,24,105,87,229,13,172,240,136,72,36,212,77,198,
+246,109,155,144,158,118,74,155,38,196,43,176,218,108,104,211,174,51,142,30,57,136,35,135,15,66,129,2,187,195,129,172,204,12,78,113,170,36,198,78,154,137,79,63,120,189,244,251,188,172,60,212,173,95,15,169,
+199,142,150,171,35,132,120,30,55,221,246,16,158,122,236,78,109,24,206,130,34,76,189,252,90,124,250,225,27,218,20,33,196,3,137,138,137,69,247,158,3,17,27,91,23,175,188,240,8,114,114,254,153,26,78,206,15,
+69,41,94,9,70,68,45,23,111,223,169,59,76,102,51,22,253,185,160,92,156,16,66,188,129,42,111,96,69,199,198,225,190,251,158,65,203,166,13,241,203,159,127,225,165,231,255,139,195,135,14,104,203,72,45,196,96,
+48,64,85,255,57,233,42,138,82,58,103,159,144,178,40,138,130,216,248,58,120,245,165,15,48,112,80,39,0,192,123,31,124,143,43,46,31,131,162,194,66,109,57,33,196,195,136,79,72,196,230,181,235,224,235,239,171,
+77,225,232,193,227,104,213,161,53,142,30,62,164,77,17,66,60,20,131,193,0,163,209,136,162,162,34,109,138,156,39,103,107,100,17,66,136,55,82,229,13,44,0,8,8,8,68,187,78,221,209,163,199,0,188,255,222,75,216,
+182,121,163,182,132,212,66,28,14,63,12,28,50,6,70,163,177,244,233,250,148,233,215,32,59,59,3,115,191,248,80,91,238,17,240,34,226,236,148,12,117,191,16,74,142,53,153,76,232,209,123,32,98,98,19,240,213,23,
+239,35,43,51,67,91,74,8,241,80,250,13,26,142,159,190,255,82,27,6,0,116,234,218,11,75,23,253,169,13,19,66,170,24,179,197,2,103,81,17,31,48,18,183,166,101,155,14,168,155,148,130,69,11,127,193,177,35,135,
+181,105,66,136,151,161,91,24,139,210,234,178,123,175,254,226,114,185,100,194,148,43,164,94,253,134,178,110,245,54,105,211,190,179,174,142,122,143,23,186,32,115,201,118,190,255,22,163,148,122,150,101,183,
+235,190,245,142,255,234,22,34,94,240,243,82,241,243,247,215,29,71,41,173,122,29,126,126,226,227,235,43,86,171,85,151,163,212,29,140,140,142,145,117,107,182,137,170,186,228,227,143,231,137,205,230,163,171,
+161,180,54,217,186,93,71,233,221,255,18,93,220,139,212,5,40,173,86,223,123,255,91,113,185,92,82,152,87,32,55,220,242,128,46,79,61,87,179,197,34,125,7,14,147,169,51,175,149,168,152,88,137,137,141,151,169,
+51,102,75,114,74,67,93,109,69,44,123,163,75,41,245,30,203,54,182,95,126,245,83,81,85,151,28,63,114,66,102,92,121,147,56,252,252,116,245,148,210,234,83,81,12,23,252,240,137,210,170,182,109,135,46,146,149,
+150,41,170,234,146,172,180,44,143,217,73,141,210,170,178,103,223,65,178,121,227,46,153,57,235,102,177,219,29,186,188,23,168,11,80,90,45,150,52,34,194,35,163,100,238,87,191,201,187,239,125,227,173,111,50,
+175,215,104,52,138,205,102,211,93,224,182,104,213,86,14,238,61,34,185,153,57,50,239,135,191,229,213,215,62,151,37,139,214,73,235,118,157,116,127,6,165,180,246,170,189,65,238,216,165,167,196,39,36,234,234,
+40,165,148,210,178,14,27,53,73,142,31,57,33,175,191,57,71,250,14,28,166,203,83,90,219,52,24,140,242,221,183,11,197,229,114,202,152,9,211,117,121,79,183,90,214,192,34,228,223,208,46,232,78,60,11,179,197,
+2,147,209,136,194,194,66,168,106,241,231,139,136,32,40,56,4,29,187,244,194,181,87,94,143,254,3,59,226,248,145,147,152,126,213,213,248,253,151,31,184,59,35,33,164,28,103,90,67,208,104,52,66,68,120,126,32,
+132,16,114,70,146,83,26,193,104,50,98,235,166,13,218,20,33,181,150,111,191,249,3,29,219,53,193,160,17,195,177,98,233,223,218,180,71,195,6,214,57,184,152,69,167,9,33,255,16,21,19,139,1,131,70,99,199,246,
+141,248,219,139,183,117,14,13,11,67,81,145,19,25,233,105,218,20,33,164,130,148,52,178,74,208,158,135,195,35,163,16,20,20,130,109,91,42,190,33,12,207,231,132,16,226,253,240,179,158,144,226,247,193,140,43,
+110,192,222,61,219,241,235,207,223,107,211,85,134,209,104,68,68,84,12,242,114,115,144,118,234,164,54,93,105,24,1,220,175,13,146,18,216,219,35,164,50,200,206,202,196,218,213,75,177,127,223,110,109,202,107,
+232,216,165,39,158,127,230,117,44,95,185,4,169,199,142,104,211,132,144,10,163,29,45,94,158,248,132,68,252,239,233,215,144,210,164,21,54,109,92,141,156,156,108,109,73,57,202,222,208,4,5,135,192,106,177,
+162,160,32,95,91,86,97,66,194,194,208,176,113,51,28,57,124,80,155,34,132,16,82,205,40,138,1,138,82,50,38,67,127,206,32,196,29,168,223,176,49,204,22,11,178,179,178,180,169,42,64,176,102,213,18,236,217,181,
+253,244,67,193,234,121,95,248,248,248,162,83,215,222,104,210,180,53,118,239,218,138,162,194,66,109,73,165,80,254,49,39,1,0,12,26,58,6,207,189,248,33,162,99,226,16,18,26,134,22,173,219,193,108,177,104,203,
+8,33,4,56,253,153,241,199,207,243,224,112,248,98,207,174,29,218,52,33,164,18,217,178,113,61,102,94,62,30,145,97,17,104,223,169,135,54,173,163,164,121,21,29,27,135,85,203,214,96,209,194,21,136,141,79,208,
+150,85,136,192,160,96,188,242,210,71,232,209,115,176,54,69,8,33,164,6,16,81,57,234,138,184,53,9,117,235,161,79,223,161,80,180,137,106,160,58,223,27,34,130,152,216,4,140,24,50,10,73,245,26,104,211,149,138,
+246,81,103,173,119,198,149,55,137,170,186,228,231,249,75,101,201,162,117,242,201,167,63,137,201,100,214,213,81,74,105,82,253,6,114,244,96,170,44,250,107,45,23,157,166,180,154,245,245,245,213,197,206,100,
+112,72,168,188,255,193,119,162,170,46,81,85,151,220,122,231,163,186,154,127,211,238,112,200,139,47,127,44,5,185,249,146,210,176,137,46,79,41,165,148,186,179,17,81,209,146,148,156,162,139,211,170,53,42,
+58,70,154,181,104,163,139,123,163,245,234,55,148,201,151,94,37,189,250,14,174,202,205,217,116,129,90,111,76,92,29,89,248,199,106,113,22,22,73,126,78,158,180,110,215,81,87,67,41,165,56,189,125,243,221,247,
+63,35,161,97,225,186,28,165,212,61,124,227,173,47,37,243,84,134,180,106,219,81,186,247,234,47,61,251,14,210,213,252,155,77,91,180,22,85,117,201,59,239,126,45,70,163,73,151,167,148,82,74,221,213,58,9,73,
+178,114,249,38,249,223,11,31,232,114,148,86,166,138,98,144,148,70,77,36,32,48,72,151,171,12,185,136,251,89,176,219,29,184,244,178,27,176,111,223,118,124,255,245,231,218,52,33,132,16,66,60,132,25,87,220,
+136,67,7,247,96,254,188,175,181,169,10,99,183,59,208,181,103,63,172,95,187,2,135,15,30,208,166,9,33,132,16,183,164,78,221,36,252,240,205,124,68,134,7,97,250,85,215,224,187,185,159,106,75,8,241,24,216,192,
+170,0,138,162,64,132,63,166,202,196,104,50,21,111,141,238,114,105,83,132,16,66,72,165,160,221,145,74,251,61,33,132,16,226,237,52,106,218,28,173,219,116,193,111,11,190,195,161,3,251,181,105,66,60,10,54,
+176,72,141,16,30,25,5,187,221,129,140,244,52,156,58,121,66,155,38,132,16,66,46,26,109,195,74,251,61,33,132,16,114,190,216,237,14,216,124,124,112,242,196,113,109,138,16,82,197,112,23,66,82,35,156,72,77,
+69,70,122,26,242,243,243,180,41,66,8,33,164,82,40,105,86,133,133,71,32,174,78,2,155,87,132,16,66,46,26,85,117,161,176,176,80,27,62,111,12,6,3,174,186,246,14,188,246,198,23,232,220,173,151,54,77,8,57,3,
+108,96,145,26,65,85,93,56,117,242,4,114,115,114,180,41,66,8,33,228,172,248,249,251,35,40,56,68,27,62,39,49,113,117,112,227,141,247,107,195,132,16,66,200,121,147,151,151,135,172,204,12,109,248,188,241,241,
+245,133,217,108,193,140,105,195,241,231,175,243,49,101,250,53,80,20,69,91,70,8,41,195,121,55,176,12,6,3,76,38,147,54,76,8,33,132,156,21,69,57,239,211,13,33,58,20,69,129,159,95,0,90,180,106,143,164,250,
+41,218,244,89,217,189,99,27,18,19,234,96,226,212,43,97,119,56,180,105,66,106,132,186,137,201,176,218,108,218,176,87,193,207,254,202,37,38,46,30,189,250,13,214,134,137,7,114,227,109,15,98,210,212,171,241,
+252,51,15,160,113,179,22,88,179,106,27,222,123,235,121,12,25,49,94,91,74,8,41,195,121,157,85,172,54,27,124,124,124,97,243,241,129,217,98,209,166,9,33,132,144,114,24,141,70,212,75,105,136,128,128,0,0,64,
+98,189,250,104,223,169,187,182,140,144,127,165,105,243,86,24,57,118,26,140,38,35,178,178,50,208,172,121,219,10,63,80,203,204,204,192,139,175,62,139,251,239,184,29,117,19,147,181,105,66,170,157,186,73,201,
+168,83,55,9,206,162,34,109,202,171,16,81,217,196,170,68,174,152,117,43,22,252,244,45,174,189,241,94,109,138,120,24,107,215,44,197,138,229,11,1,0,219,183,110,66,207,62,29,49,100,196,4,28,216,191,91,91,74,
+8,41,131,17,64,133,199,212,219,108,54,88,172,22,88,172,54,20,21,22,194,229,116,106,75,8,249,63,123,247,29,30,85,149,255,113,252,115,231,78,203,76,122,239,161,132,222,123,239,189,119,21,44,40,246,186,214,
+85,247,103,95,219,186,234,218,219,174,189,139,96,5,20,80,64,64,164,73,239,189,37,4,72,239,153,204,253,254,254,8,137,228,94,193,4,82,102,38,159,215,243,188,159,149,115,78,112,213,144,204,156,220,123,46,
+17,209,25,20,88,173,86,100,102,102,32,40,40,24,99,198,95,12,179,89,197,206,237,155,245,11,137,206,41,62,33,9,138,9,8,8,8,66,64,96,16,242,243,242,112,96,255,222,42,63,139,102,255,222,93,88,253,251,6,28,
+59,122,8,249,249,121,250,105,162,58,19,151,144,136,132,164,166,216,178,97,45,10,11,11,244,211,62,33,48,48,8,137,141,155,194,172,154,145,159,151,171,159,166,243,208,170,77,123,60,120,223,63,160,185,220,
+152,56,118,40,14,28,203,192,150,77,235,244,203,200,75,28,220,191,7,199,83,142,194,164,170,0,128,146,146,98,236,217,181,13,199,83,142,233,151,18,209,25,170,253,20,66,171,205,6,0,40,41,46,214,79,17,17,17,
+25,196,196,198,161,85,219,78,112,58,253,49,227,162,153,120,249,181,127,227,215,229,63,235,151,17,81,21,89,172,86,244,27,48,12,73,141,154,97,193,247,95,224,120,106,138,126,9,121,176,30,189,7,96,247,206,
+173,200,204,72,215,79,249,140,139,47,189,6,247,222,113,23,214,109,220,134,127,255,251,65,236,217,181,163,210,60,159,8,90,61,65,193,33,184,253,174,71,145,146,122,4,63,124,63,27,109,218,119,70,139,22,237,
+241,227,130,57,216,185,125,139,126,57,17,145,79,19,198,24,99,172,54,107,218,172,133,36,53,106,34,254,254,1,134,57,198,88,245,26,55,233,18,201,60,153,41,37,197,37,50,227,138,27,12,243,85,205,233,116,74,
+100,84,180,88,44,22,195,28,99,23,82,183,94,253,100,221,154,109,226,118,187,229,149,215,62,53,204,71,70,69,203,141,183,222,47,157,187,245,52,204,49,99,86,155,77,2,131,130,13,227,1,1,129,134,49,86,251,89,
+172,214,138,191,86,20,147,97,190,170,93,200,199,214,70,102,126,47,96,94,80,181,175,192,170,111,101,247,209,203,233,139,199,254,120,68,54,17,17,17,145,175,11,11,143,192,11,255,121,7,129,1,1,248,248,139,
+15,177,106,229,207,56,114,232,128,126,217,57,89,172,86,12,28,60,18,173,219,118,198,201,19,199,209,180,105,11,252,176,96,46,214,254,182,92,191,148,188,64,72,104,24,252,253,3,112,228,240,65,253,84,189,138,
+137,139,199,192,193,163,81,80,144,135,111,230,124,82,105,46,36,52,12,115,191,252,1,141,18,163,241,196,115,47,226,195,119,95,65,113,81,81,165,53,158,236,162,25,179,112,228,240,1,172,90,177,68,63,69,62,46,
+185,121,43,124,254,209,28,156,56,149,137,43,174,156,140,147,39,210,244,75,170,76,85,85,184,221,110,253,112,157,139,138,142,197,184,137,211,177,119,207,118,44,253,105,129,126,154,200,227,24,118,181,24,99,
+140,49,198,152,231,21,27,23,47,83,47,185,82,2,3,131,12,115,85,205,225,112,202,188,121,43,36,227,68,134,108,88,191,83,52,205,45,75,126,94,43,38,147,103,93,13,192,254,186,168,152,88,233,221,111,176,36,53,
+110,106,152,243,228,204,102,179,220,125,223,19,114,50,245,148,108,222,184,91,162,162,99,12,107,60,185,123,255,239,105,217,190,101,175,52,106,156,108,152,99,190,91,175,190,131,100,255,158,35,162,105,110,
+209,52,183,236,222,113,64,198,77,154,46,189,251,13,150,240,136,72,195,122,79,79,81,76,210,165,123,111,217,186,105,143,188,255,193,183,94,249,207,192,26,94,94,119,5,86,171,54,237,17,29,19,15,179,217,140,
+227,169,71,177,101,211,239,250,37,68,68,68,68,62,175,252,233,110,231,115,53,250,160,161,163,241,241,59,239,32,58,62,2,69,121,69,184,120,230,44,124,247,213,231,250,101,228,193,66,195,194,17,26,22,129,163,
+135,15,162,168,168,80,63,237,209,130,130,67,48,98,244,100,168,170,138,125,123,119,96,237,111,43,32,226,61,111,73,156,254,254,184,225,230,251,176,110,237,114,44,251,249,71,253,52,249,160,126,131,134,99,
+233,194,121,80,84,19,220,46,55,20,69,129,201,92,246,53,248,177,39,95,195,127,254,253,32,178,179,179,244,31,230,209,98,227,226,177,115,203,54,216,236,54,52,109,217,2,71,15,31,210,47,33,242,72,134,93,45,
+79,171,252,39,130,195,71,77,144,130,156,252,138,93,239,125,187,14,73,100,84,180,97,125,93,22,22,17,33,125,250,15,225,79,45,25,99,140,49,230,85,117,236,220,93,230,125,191,92,38,76,153,97,152,99,158,155,
+217,98,145,196,70,77,188,254,106,9,179,217,108,24,243,164,38,78,187,76,134,140,24,103,24,103,13,179,127,63,255,118,197,123,80,87,113,137,148,186,92,21,191,238,217,103,128,97,189,55,100,177,90,229,190,7,
+158,145,89,215,221,97,152,99,204,131,51,12,120,108,79,254,235,141,138,47,20,154,230,150,3,123,142,72,120,68,132,97,93,93,54,112,232,40,89,185,124,163,68,212,243,70,26,99,172,118,139,140,138,230,97,169,
+140,49,159,75,85,85,195,24,243,236,204,22,139,4,5,135,24,198,89,205,54,243,234,219,36,237,216,73,233,216,165,187,97,142,53,172,20,69,145,184,132,68,185,246,166,123,36,39,35,167,226,189,104,214,169,44,249,
+242,203,197,210,182,67,103,195,199,156,153,195,233,148,102,45,90,25,198,61,33,94,132,193,188,48,195,128,71,22,159,216,72,82,14,31,175,180,129,149,121,50,75,26,55,109,102,88,91,151,69,68,69,203,164,105,
+151,75,72,72,168,97,142,49,230,27,141,26,55,69,150,45,89,47,253,7,13,55,204,49,198,24,99,204,247,114,250,251,203,140,43,174,151,87,95,255,84,98,227,18,12,243,172,225,116,230,211,2,123,245,29,36,121,89,
+185,178,107,251,1,137,138,137,53,172,253,179,172,86,107,149,215,122,98,86,171,85,162,99,227,164,107,143,62,226,231,231,103,152,103,172,46,43,187,113,215,11,116,236,210,3,209,241,17,0,128,210,98,23,142,
+30,74,195,135,159,127,143,236,172,76,253,210,58,117,50,237,56,190,154,253,33,50,51,51,244,83,68,228,225,20,197,84,113,134,204,217,244,238,55,24,95,124,240,30,186,116,106,14,151,171,68,63,77,68,68,68,167,
+41,138,9,170,170,234,135,189,82,126,94,30,62,249,224,77,188,249,214,115,252,254,79,48,153,202,94,51,174,90,177,4,61,251,247,199,228,75,38,35,45,53,69,191,236,79,185,92,165,80,78,63,117,208,219,52,73,110,
+129,127,62,249,26,230,125,179,8,77,154,182,68,105,105,253,63,53,177,161,138,138,137,197,232,241,211,208,185,91,47,196,196,198,235,167,27,20,195,174,150,39,22,159,216,72,238,123,224,25,185,243,222,199,165,
+91,207,126,18,26,22,94,49,167,170,170,40,138,169,34,253,199,50,198,216,249,20,24,20,44,235,214,108,151,236,244,108,153,124,209,229,134,121,198,24,99,140,85,78,81,20,195,24,99,222,94,217,251,76,165,226,
+182,235,209,227,167,201,209,67,169,114,209,140,171,13,107,125,169,17,99,38,73,97,110,190,92,127,243,189,134,57,86,119,249,251,7,200,219,239,204,149,131,251,142,202,242,101,191,203,166,223,119,201,75,175,
+124,44,113,241,137,134,181,190,158,10,224,17,253,142,150,39,202,201,206,194,138,95,22,97,213,202,159,145,114,244,48,10,11,11,128,51,118,178,21,69,193,31,15,47,169,248,139,10,101,87,90,148,61,116,177,252,
+175,203,127,77,68,212,171,239,32,20,22,228,163,176,160,236,107,139,162,152,48,113,234,101,240,243,11,194,117,55,206,194,47,75,22,234,63,132,136,200,160,239,128,161,200,203,203,169,120,157,66,68,68,190,
+224,143,247,144,34,2,135,195,137,59,111,191,5,251,14,158,192,207,139,191,215,47,246,25,105,169,199,240,213,119,243,240,227,252,185,208,180,234,63,241,150,106,134,0,80,204,42,58,182,239,130,102,77,227,81,
+84,236,194,135,159,125,136,157,59,54,161,168,208,187,158,66,123,161,188,102,7,231,143,219,124,4,38,83,217,95,187,221,238,178,75,149,205,42,68,211,224,118,159,253,146,70,253,163,166,85,85,133,136,240,15,
+34,17,97,194,148,75,209,163,71,127,60,241,232,93,200,207,207,3,0,88,109,54,116,237,222,7,191,46,255,89,191,156,136,232,172,186,116,239,141,253,251,118,33,51,61,93,63,69,68,53,40,52,44,28,145,81,49,8,143,
+140,198,225,3,123,113,248,208,1,253,18,162,26,165,40,166,138,247,146,0,208,178,77,123,28,79,57,138,44,30,37,67,117,36,38,54,30,97,17,145,56,122,248,96,131,253,188,243,154,13,44,84,92,69,5,136,72,197,206,
+119,65,65,126,165,53,170,217,12,209,180,74,27,83,250,205,171,242,157,243,138,143,81,213,115,110,126,17,249,130,200,168,104,100,102,102,192,85,82,118,142,67,108,124,2,138,139,138,144,126,234,164,126,105,
+131,210,163,119,127,220,249,183,7,240,247,251,110,196,161,3,251,244,211,68,68,68,84,69,109,59,116,70,92,124,18,150,46,158,143,226,226,98,253,116,141,186,248,210,107,112,203,117,55,33,33,62,18,175,189,253,
+33,158,121,242,126,253,18,34,34,170,101,14,167,19,22,139,21,238,210,82,228,229,229,234,167,107,220,185,79,47,246,48,34,101,27,83,34,130,75,46,191,22,107,127,219,132,199,158,124,21,113,9,137,232,216,165,
+59,62,253,116,1,150,253,188,22,145,81,209,250,15,173,48,106,220,84,172,249,109,11,250,14,28,138,168,152,88,188,249,214,23,248,242,203,69,8,12,10,210,47,37,242,25,161,97,225,120,234,169,215,48,122,252,52,
+132,132,134,66,85,205,48,153,84,184,92,46,253,210,6,71,85,205,120,244,241,123,184,121,69,68,68,116,129,82,143,29,193,212,201,151,97,249,178,245,232,220,173,167,126,186,70,45,249,105,30,30,126,226,65,204,
+186,241,122,252,176,96,142,126,154,168,214,253,213,131,128,136,26,130,208,176,112,244,238,55,24,45,90,183,211,79,213,26,195,193,88,158,158,170,170,114,195,45,247,137,166,185,69,211,220,114,236,240,113,
+41,204,205,151,194,188,2,153,121,245,109,98,177,90,43,173,47,63,76,178,223,160,225,82,152,155,47,154,230,150,226,252,66,201,60,153,89,241,123,180,108,221,206,240,247,97,204,87,10,12,10,146,151,94,249,72,
+230,206,253,89,166,77,191,74,236,118,187,97,13,99,140,49,198,216,133,150,220,188,165,164,28,57,46,251,247,28,150,240,136,72,195,188,175,212,184,73,51,25,50,124,172,196,39,54,50,204,49,223,74,85,213,138,
+195,219,25,99,198,66,195,35,196,207,225,48,140,215,70,94,115,136,123,57,171,205,134,214,109,59,224,248,241,163,248,109,205,86,180,107,217,6,137,141,99,144,155,147,143,81,19,38,226,187,175,63,131,118,150,
+219,1,63,253,112,14,26,53,141,3,0,168,22,21,118,135,173,98,238,199,197,191,96,247,206,109,103,172,38,242,29,197,197,197,216,176,113,53,78,164,159,194,145,195,7,120,78,4,17,145,15,40,251,233,191,0,167,15,
+143,31,60,108,28,50,51,78,34,59,43,83,191,148,168,206,100,164,159,194,183,243,231,97,213,218,245,216,183,119,103,197,209,5,190,102,202,69,87,226,233,199,30,197,240,161,99,177,107,223,30,28,61,124,80,191,
+196,171,217,236,118,4,7,135,84,60,220,166,33,43,63,190,134,136,254,92,97,65,1,74,235,232,206,30,175,58,3,11,167,95,172,217,237,54,184,53,13,37,197,197,104,146,220,28,173,219,118,196,158,93,219,177,107,
+199,214,138,53,103,30,176,87,238,127,111,207,193,172,171,38,86,26,43,45,41,5,0,140,157,124,17,22,206,255,166,210,28,17,17,17,145,39,51,155,205,184,245,142,135,240,220,191,254,15,0,112,96,207,81,12,27,59,
+28,251,247,236,210,47,37,186,32,61,122,15,64,218,241,99,56,184,127,175,126,170,65,138,139,79,68,231,110,189,209,175,207,80,180,110,209,28,207,190,248,20,150,46,94,160,95,230,181,134,143,158,8,171,205,142,
+239,191,250,76,63,69,68,84,175,12,151,101,121,75,138,98,170,244,107,85,85,69,81,76,134,241,242,95,183,105,215,81,14,237,63,38,154,230,150,71,31,127,89,250,244,31,34,23,95,122,141,28,57,144,34,237,58,118,
+49,252,254,140,49,198,24,99,158,220,208,145,227,43,142,67,112,21,151,136,166,185,101,231,182,253,18,18,26,102,88,203,216,249,214,165,123,111,201,205,204,149,229,203,126,151,192,192,32,195,124,67,175,105,
+179,22,210,181,71,31,195,123,16,111,174,207,128,33,18,19,27,103,24,103,140,177,250,204,227,174,192,50,155,205,136,142,41,187,205,239,216,209,35,127,122,37,85,185,63,59,56,239,92,235,1,160,101,155,118,136,
+79,104,132,95,150,44,68,73,113,49,44,86,43,122,247,29,132,205,27,215,33,51,131,143,188,38,34,162,154,227,112,56,80,84,84,84,233,201,184,126,126,126,48,153,84,228,231,231,85,90,75,116,62,154,54,107,129,
+133,243,22,161,113,114,28,74,75,74,97,182,154,177,102,213,54,140,24,221,31,217,217,89,250,229,68,213,162,40,38,4,6,5,161,123,207,126,184,254,154,219,176,125,247,78,60,243,228,253,117,242,164,41,34,34,162,
+63,99,216,213,170,171,44,86,107,197,1,235,0,36,34,42,74,30,123,242,21,57,118,40,85,238,123,224,95,134,245,53,157,55,31,198,231,205,255,223,25,99,172,33,164,170,170,52,107,209,90,172,54,91,165,241,224,144,
+80,9,13,11,55,172,103,172,186,149,95,237,17,159,216,72,214,173,222,38,154,230,150,119,222,253,74,156,254,254,134,181,85,45,40,56,184,218,31,31,23,159,40,143,60,254,146,12,27,53,193,48,199,188,187,168,232,
+88,105,219,161,147,216,116,95,199,152,247,167,40,38,137,75,72,146,230,45,219,24,230,24,99,204,83,171,215,67,220,77,138,82,233,64,188,190,3,134,225,185,39,30,66,72,120,48,190,95,176,24,171,87,45,171,180,
+190,38,156,121,224,41,160,64,81,60,238,34,180,115,82,20,5,170,170,66,81,148,74,63,209,7,128,168,232,24,188,243,246,28,108,216,180,150,87,147,17,17,213,51,17,65,86,102,58,74,75,203,206,90,44,87,84,84,136,
+146,146,98,30,8,75,23,76,81,202,94,199,228,100,103,226,231,95,150,160,95,239,161,184,229,111,87,227,196,241,84,253,210,42,75,106,212,4,147,167,93,137,236,236,116,100,103,103,25,94,107,252,25,167,211,137,
+143,223,125,11,87,95,125,5,178,242,76,176,59,236,104,154,220,2,7,246,239,209,47,37,47,83,92,84,136,227,169,41,112,159,229,1,73,228,189,84,213,132,33,195,199,193,98,177,84,156,107,166,40,38,244,233,63,24,
+14,135,19,233,167,78,232,63,132,136,168,222,213,235,6,150,254,69,209,169,147,199,177,231,80,26,118,238,62,130,111,191,254,4,39,79,164,85,154,175,25,103,190,97,40,223,200,243,46,34,98,248,119,7,0,173,218,
+116,192,11,207,255,19,54,91,20,150,45,253,17,37,62,250,212,23,34,34,111,113,182,77,170,179,141,19,85,207,31,175,99,50,210,79,225,131,15,223,185,224,215,78,233,167,78,2,10,240,224,63,158,194,181,215,220,
+4,147,205,129,141,191,175,214,47,171,160,40,10,242,114,115,241,251,150,157,152,126,209,84,140,26,57,16,87,92,54,29,27,183,236,195,234,85,75,245,203,201,203,252,217,235,77,242,13,34,130,99,71,15,98,223,
+222,93,21,255,157,205,22,51,238,185,251,49,116,234,220,19,81,177,241,136,75,72,196,158,93,219,245,31,74,68,84,111,140,135,72,213,163,236,172,44,124,242,193,27,120,234,159,127,199,246,173,155,244,211,116,
+14,3,134,140,196,53,87,255,13,183,223,253,24,178,114,178,240,243,226,85,136,140,138,214,47,163,243,212,161,115,55,88,109,54,253,48,17,17,145,199,40,44,44,212,15,157,151,181,191,45,199,43,111,60,135,184,
+152,240,191,60,171,77,68,160,40,10,22,46,248,26,51,175,189,13,0,96,50,153,176,121,243,90,253,210,90,51,96,200,72,60,250,196,203,8,11,143,208,79,17,209,57,228,100,103,163,212,229,170,248,117,169,203,133,
+111,231,125,129,137,163,7,227,127,175,62,135,168,168,248,74,235,137,136,60,129,225,190,66,230,125,245,29,48,84,6,15,31,35,56,125,190,202,165,51,111,148,70,77,146,13,235,88,245,187,229,246,7,100,245,170,
+45,98,183,219,13,115,140,49,118,62,169,102,179,97,140,49,79,171,99,231,238,18,21,29,99,24,215,87,126,22,151,170,170,114,213,181,183,203,205,127,123,64,252,3,2,12,235,106,163,152,216,120,57,184,247,168,
+148,20,22,75,98,163,38,134,121,198,88,245,186,116,230,13,226,42,42,145,171,174,189,93,76,38,158,185,203,24,243,184,12,3,140,49,64,252,252,252,228,198,91,239,23,77,115,203,143,63,172,170,244,192,1,198,24,
+171,74,125,7,12,149,198,77,155,85,26,155,124,209,21,210,170,77,123,195,90,230,155,89,172,86,153,54,99,150,180,105,215,81,0,72,96,96,144,79,254,64,164,124,19,171,174,27,58,114,188,148,20,22,203,236,217,
+139,196,207,225,48,204,51,198,170,86,249,159,225,206,221,122,201,67,143,189,104,120,0,9,99,140,121,66,245,122,6,22,157,93,219,14,157,241,234,43,31,32,40,44,2,191,175,91,165,159,166,58,208,186,93,71,124,
+59,231,99,40,138,130,189,123,142,224,163,143,223,214,47,33,34,58,167,228,22,173,240,254,255,62,64,104,84,35,248,57,252,48,113,202,229,176,251,57,176,116,241,60,195,225,238,228,155,236,54,27,126,94,176,
+0,227,199,78,66,124,227,118,120,231,141,87,177,105,199,30,236,221,237,107,231,202,136,126,160,78,28,79,57,138,247,62,250,8,95,124,241,1,242,114,115,244,211,68,84,101,2,69,49,33,245,216,17,44,91,242,3,220,
+110,55,76,38,19,207,108,244,65,209,177,113,80,160,160,164,164,88,63,117,193,6,14,25,133,172,172,12,20,21,213,204,45,237,68,127,198,176,171,197,234,167,242,159,124,244,29,48,84,78,166,158,18,77,115,139,
+166,185,229,254,7,255,45,254,254,117,115,41,62,251,35,171,205,38,61,251,12,148,39,158,126,93,222,250,223,151,98,230,45,63,140,177,243,232,186,155,254,46,174,146,18,209,52,183,124,246,249,143,18,16,24,100,
+88,195,124,187,137,83,47,149,146,162,98,209,52,183,28,218,119,84,18,18,27,25,214,248,74,157,187,245,148,166,205,91,26,198,61,177,107,111,188,71,158,121,238,127,124,141,197,24,107,48,57,156,78,233,222,171,
+191,132,133,71,24,230,46,180,241,147,103,200,226,69,171,249,53,149,213,118,134,1,86,143,13,29,49,174,226,69,238,153,93,62,235,22,195,90,86,119,197,37,36,138,170,250,246,57,0,237,58,116,150,78,93,123,24,
+198,61,181,75,103,222,40,253,7,13,55,140,51,230,137,93,124,217,181,242,232,19,47,75,72,104,152,97,142,53,140,166,77,159,37,175,190,241,153,180,110,215,193,48,231,75,141,159,60,93,118,108,221,47,221,122,
+246,53,204,121,82,221,122,246,149,253,123,142,200,67,143,190,32,126,126,188,245,144,213,93,65,193,193,60,150,130,213,91,78,127,127,195,209,6,53,81,92,66,146,252,180,104,181,12,24,50,210,48,215,208,226,
+159,239,179,167,40,166,154,56,114,192,48,192,234,41,139,197,34,123,119,29,18,77,115,139,219,93,42,154,187,84,52,205,45,233,105,25,21,103,103,48,86,27,245,234,59,80,114,51,115,37,227,68,166,199,111,98,133,
+134,135,203,227,79,191,46,154,230,150,188,172,92,121,226,233,55,36,144,87,180,48,198,152,199,116,255,131,207,72,230,201,76,153,124,209,21,134,57,79,40,36,52,76,222,255,224,91,105,215,177,139,97,142,177,
+218,110,230,213,183,74,231,110,189,12,227,140,121,115,83,47,185,82,38,76,153,97,24,111,104,37,38,53,150,78,93,122,240,206,157,179,164,170,106,77,252,187,49,12,176,122,236,138,89,183,136,171,184,236,86,
+19,77,115,203,150,141,187,165,125,167,174,134,117,140,157,79,102,179,217,240,69,99,210,180,203,165,32,39,175,226,115,46,55,51,87,102,92,113,131,225,99,235,43,139,213,42,38,83,217,78,125,120,68,164,252,
+180,104,181,225,10,197,141,235,119,74,76,92,188,225,99,25,99,140,213,79,99,38,94,44,3,6,123,230,79,226,45,86,171,68,70,69,27,198,25,171,139,154,181,104,37,119,223,247,132,12,24,50,82,84,245,130,223,200,
+49,230,17,241,182,193,178,108,54,187,56,157,254,53,113,149,17,59,123,134,1,86,207,77,189,228,74,209,52,183,252,48,127,165,56,156,78,65,61,62,221,135,249,78,33,33,161,114,227,173,247,75,108,92,66,197,216,
+216,137,23,139,187,180,236,74,191,82,151,171,98,67,232,190,7,158,49,124,124,125,213,185,107,79,121,251,221,175,100,250,229,215,201,142,173,251,12,87,40,150,247,213,87,75,36,180,22,238,231,103,140,49,198,
+24,171,201,46,190,244,26,217,185,125,191,116,225,149,88,181,86,66,98,35,105,212,36,217,48,206,152,175,215,127,240,8,249,230,235,165,210,111,208,48,195,156,167,229,231,231,39,119,222,251,184,60,254,212,
+107,98,59,253,132,230,206,221,122,73,235,182,231,60,110,193,48,192,234,169,242,251,101,195,34,34,101,225,143,171,164,121,203,214,149,198,27,74,22,171,85,156,254,254,134,113,118,97,13,28,58,74,198,76,152,
+38,102,139,69,0,72,171,54,237,101,231,182,253,146,157,158,45,165,167,15,152,214,52,183,220,251,127,255,242,168,207,57,167,191,191,188,253,206,220,138,255,127,110,119,105,217,166,219,233,77,172,242,13,56,
+77,115,203,115,47,188,87,241,207,199,24,99,140,49,230,137,53,73,110,46,211,166,207,170,179,171,199,3,2,3,165,101,235,182,98,63,253,6,209,215,139,142,137,149,95,150,174,151,244,180,12,153,54,125,150,71,
+189,174,101,172,182,27,54,114,188,184,74,92,242,218,27,159,25,230,60,169,150,109,218,201,226,133,127,220,89,243,239,231,223,150,27,110,185,79,92,197,37,114,244,80,170,36,53,110,98,248,152,211,25,6,88,61,
+86,126,165,85,249,23,90,69,81,26,220,23,93,171,205,86,43,79,198,104,232,233,111,151,232,63,120,132,220,247,192,51,242,212,51,111,74,214,169,44,209,52,183,60,245,204,155,134,143,243,132,250,13,28,94,241,
+197,173,212,229,170,116,245,85,249,134,214,59,239,126,37,77,146,155,243,106,69,198,24,99,140,177,51,138,141,79,144,59,238,121,76,38,76,185,180,65,60,76,36,32,32,80,250,13,28,38,255,247,240,115,114,104,
+223,49,185,236,202,155,12,107,88,195,74,81,76,21,119,54,53,132,70,140,158,40,159,125,246,131,180,237,208,217,48,87,223,169,170,42,183,223,253,168,20,230,22,84,186,155,70,95,198,137,12,121,255,131,111,37,
+34,50,74,255,123,24,127,83,198,152,239,167,170,170,52,106,146,44,99,38,76,147,121,223,47,151,23,95,249,72,252,252,252,12,235,60,33,171,213,42,31,124,248,93,165,47,106,238,210,63,110,121,212,52,183,52,107,
+209,202,240,113,140,49,198,88,117,179,88,173,50,109,250,44,121,237,245,207,228,197,151,63,148,144,208,80,195,26,198,188,173,240,136,72,185,250,134,187,106,229,9,161,3,6,143,144,235,110,250,187,68,199,196,
+25,230,234,58,155,221,46,150,51,174,198,111,217,186,157,188,242,234,39,124,32,86,3,79,85,85,137,138,137,53,140,251,114,161,225,225,134,11,24,234,187,176,240,8,249,252,243,31,13,155,85,231,106,213,202,205,
+18,30,25,121,230,239,99,252,141,107,162,228,230,173,228,171,175,126,150,91,239,124,72,26,55,109,214,160,118,60,25,243,150,84,85,149,30,189,7,200,176,145,227,43,54,175,60,237,10,38,155,221,46,65,193,33,
+98,247,243,147,75,103,222,40,91,54,238,150,39,255,245,134,180,239,212,85,250,14,24,42,119,222,251,184,204,186,238,142,6,115,89,60,99,140,177,218,173,77,251,78,242,235,138,77,114,34,229,148,252,235,185,
+255,137,122,225,79,76,242,152,174,189,241,110,249,191,135,159,149,160,224,96,195,28,243,253,172,54,91,141,255,176,178,101,155,118,178,115,219,126,41,46,40,146,145,99,39,27,230,235,58,139,213,42,86,155,
+173,210,152,195,233,148,192,32,126,206,51,86,159,53,109,222,82,118,239,56,96,216,160,170,74,11,127,88,37,246,63,190,118,25,127,243,11,173,99,151,30,114,112,239,209,138,191,97,81,94,129,236,217,113,80,250,
+15,26,110,88,203,24,171,191,252,252,252,164,105,179,22,21,191,246,180,205,43,156,190,12,252,204,67,56,195,194,35,196,207,225,48,172,99,140,49,198,106,162,208,176,112,233,213,111,144,92,126,213,77,210,161,
+115,55,143,251,9,246,249,54,113,234,165,21,175,205,119,111,63,32,237,60,240,214,18,230,93,53,109,214,66,190,251,118,153,252,239,237,57,50,110,242,244,63,187,213,167,222,243,196,215,182,140,53,196,6,15,
+31,99,216,152,170,106,111,191,51,87,156,206,138,51,178,141,191,249,133,148,144,212,88,50,78,100,136,166,185,197,85,92,82,233,128,229,209,227,167,25,214,51,198,88,85,82,20,83,165,243,224,202,206,135,187,
+240,23,37,215,220,112,151,244,27,232,249,79,233,96,140,49,86,63,253,239,157,185,114,231,189,255,52,140,123,75,14,135,67,110,187,235,97,41,206,47,172,244,134,96,228,216,41,134,181,140,85,167,182,237,59,
+201,132,41,51,60,242,1,58,53,241,26,145,49,86,115,117,232,212,85,210,211,210,13,155,83,127,213,227,79,191,174,255,189,140,191,249,133,20,20,20,44,191,174,216,40,154,230,150,146,162,226,138,195,150,31,121,
+252,101,159,186,4,155,49,86,255,149,109,106,157,255,11,148,209,227,167,138,166,185,37,59,61,91,222,125,239,107,153,121,205,173,226,112,240,118,103,198,24,99,127,148,144,212,88,94,124,249,67,185,253,238,
+71,37,62,33,201,48,239,233,197,39,36,137,251,244,235,241,242,31,44,207,251,126,57,111,169,98,62,221,133,188,62,100,190,87,183,158,125,229,234,235,239,168,116,62,26,171,251,226,19,147,228,153,231,254,103,
+216,164,210,231,42,46,145,212,35,105,114,50,245,148,196,39,54,210,255,62,198,223,248,66,139,141,79,144,175,191,90,34,218,233,39,134,93,117,237,237,134,53,140,177,186,205,233,244,231,230,204,25,13,26,54,
+90,142,29,62,110,248,130,121,217,85,124,82,13,99,140,49,99,61,122,15,144,190,3,134,138,170,170,134,57,79,206,164,170,242,211,226,53,101,175,203,75,202,30,128,50,124,244,68,195,58,198,24,243,213,154,183,
+104,45,67,71,140,19,51,47,168,169,183,202,55,149,77,38,85,198,79,158,46,107,87,111,171,244,30,204,93,90,42,133,185,5,82,152,91,32,227,39,79,151,216,184,132,179,61,116,194,48,80,35,37,36,53,150,255,190,
+61,71,134,142,24,103,152,99,140,213,125,65,65,193,18,16,24,100,24,111,136,149,95,121,165,105,238,138,171,68,203,155,117,253,157,134,245,140,49,198,152,55,247,234,27,159,85,252,84,91,211,220,50,123,246,
+34,177,233,14,186,102,140,49,198,106,51,155,221,46,161,97,225,21,191,30,51,225,34,217,188,113,183,236,220,182,95,186,116,239,45,9,73,141,101,242,69,87,156,243,120,23,229,244,95,16,17,53,8,225,17,145,216,
+179,125,23,130,194,2,43,141,139,166,225,192,190,20,188,246,246,251,120,235,181,127,35,47,47,183,210,60,17,17,145,55,234,216,165,59,86,255,178,12,102,155,5,162,9,76,102,19,0,160,71,239,1,88,251,219,10,253,
+114,34,34,162,90,163,170,42,0,192,237,118,3,0,156,78,127,216,236,54,100,164,167,87,172,81,20,5,34,127,190,77,85,246,29,140,136,168,129,40,200,207,199,237,247,61,132,7,31,125,1,155,55,236,1,0,164,29,59,
+133,161,163,38,96,232,168,193,56,117,234,4,226,19,27,233,63,140,136,136,200,43,137,38,176,248,89,161,152,20,152,84,5,0,240,226,43,31,97,239,238,29,250,165,68,68,68,181,202,237,118,87,108,94,1,64,126,126,
+94,165,205,43,0,103,221,188,2,0,94,129,69,68,13,86,175,190,3,49,112,224,104,44,93,58,31,171,86,44,173,24,183,88,172,112,185,74,42,173,37,34,239,49,112,200,72,156,72,75,197,246,173,155,244,83,68,13,210,
+132,41,151,98,238,23,239,67,81,20,92,49,235,86,124,244,222,107,250,37,84,5,125,250,15,193,174,157,91,112,234,196,9,253,20,17,81,189,177,251,249,161,89,139,214,216,190,101,99,165,205,33,95,101,184,175,144,
+49,198,124,189,136,200,40,233,220,173,151,71,62,250,153,157,127,138,98,146,150,173,219,73,219,246,157,196,207,207,97,152,103,190,223,77,183,253,67,52,205,45,39,83,79,73,76,92,188,97,158,177,134,218,85,
+215,221,33,119,220,243,152,97,156,85,173,27,110,185,95,52,205,45,43,126,217,80,233,12,23,198,152,103,214,144,158,56,104,181,218,164,81,147,228,134,114,72,189,97,128,49,198,124,62,171,205,38,14,39,159,202,
+232,107,217,108,54,249,226,139,133,178,102,213,22,233,212,165,135,97,254,207,106,213,182,189,36,55,111,101,24,103,222,85,100,84,180,60,247,194,123,149,30,202,240,213,220,159,37,144,15,175,96,140,93,96,
+179,174,187,163,210,215,150,157,219,246,75,167,174,85,251,30,195,254,200,106,179,73,124,98,35,175,123,146,39,243,206,198,78,188,88,122,246,25,104,24,247,229,26,200,159,45,195,0,99,181,90,80,80,176,92,52,
+227,106,9,14,9,53,204,49,198,216,133,164,40,38,73,72,106,44,205,154,183,18,127,255,0,195,188,190,184,248,68,121,255,131,111,229,218,155,238,49,204,49,239,169,81,147,100,57,176,231,72,197,155,203,146,162,
+98,113,21,23,139,166,185,101,230,53,183,25,214,51,198,88,85,235,218,163,183,148,20,150,125,61,57,179,67,251,143,73,114,243,150,134,245,236,236,197,198,39,200,213,55,220,41,78,167,191,97,142,177,154,204,
+100,50,201,63,159,124,85,222,127,255,27,222,109,225,99,241,16,119,170,115,109,58,116,198,103,31,190,137,91,254,246,128,126,138,136,232,130,136,104,56,114,232,0,246,236,222,81,165,39,73,22,22,21,224,208,
+209,35,56,158,122,68,63,69,94,36,63,47,23,187,247,29,65,105,73,41,138,11,138,241,218,91,159,227,155,239,150,227,63,47,125,128,77,27,126,211,47,39,34,170,178,214,109,58,195,108,51,235,135,145,208,40,26,
+49,113,137,250,225,6,203,223,63,0,1,1,149,159,240,172,151,147,157,133,223,215,174,68,9,207,25,165,90,166,105,26,62,120,255,21,60,255,226,227,40,117,185,244,211,13,70,88,120,4,98,227,19,96,183,251,161,93,
+135,206,24,61,126,42,2,2,207,253,231,212,27,24,118,181,24,171,173,20,197,36,15,61,246,98,197,79,175,6,15,31,99,88,195,24,99,23,146,162,40,162,40,38,195,248,217,10,13,11,23,63,7,207,203,242,246,252,3,2,
+228,154,27,238,150,45,27,119,203,99,79,190,42,33,97,97,134,53,140,49,86,221,194,35,34,101,241,194,213,149,174,190,42,206,47,148,107,111,188,91,2,2,2,13,235,27,98,102,139,69,134,140,24,43,205,91,182,49,
+204,49,198,234,167,22,173,219,74,234,145,52,57,117,252,148,204,159,183,66,78,164,156,148,3,123,142,248,194,215,45,195,0,99,181,86,251,78,93,229,216,161,227,242,244,191,223,146,199,158,124,69,158,253,207,
+59,226,228,57,68,140,177,26,204,108,54,139,201,84,245,13,44,230,253,157,185,97,57,104,232,40,233,218,163,143,97,141,47,22,24,24,36,138,162,24,198,25,99,53,83,249,215,150,144,208,48,249,242,203,197,162,
+105,110,89,191,102,187,12,24,60,66,236,126,126,210,168,73,178,225,99,26,98,65,193,33,114,251,221,143,74,147,228,230,134,57,198,88,253,20,26,22,46,171,87,109,169,180,249,238,11,199,42,40,167,255,130,168,
+78,4,135,132,34,48,40,24,135,15,238,7,0,4,5,135,160,176,176,0,37,197,197,250,165,68,68,231,197,98,181,66,115,187,171,252,24,97,69,81,0,40,16,209,244,83,68,30,169,67,231,110,184,229,230,251,48,106,104,111,
+156,74,207,198,188,133,75,177,248,167,111,177,236,167,31,160,105,252,60,38,170,73,138,98,130,136,6,179,217,130,78,93,123,224,224,254,61,56,121,34,13,0,96,82,85,104,85,252,94,227,203,76,38,19,252,3,2,145,
+159,159,7,119,105,169,126,154,136,234,88,249,215,173,224,144,16,188,252,242,135,184,116,198,40,252,186,98,51,198,79,26,134,140,244,83,250,229,94,133,27,88,68,68,68,68,94,98,226,212,203,240,217,251,255,
+133,213,207,170,159,194,206,109,7,240,194,27,111,97,238,23,239,225,212,201,19,250,105,34,58,79,229,111,6,207,246,107,34,170,57,241,137,73,152,56,249,114,28,60,180,7,135,246,239,193,246,173,155,170,252,
+67,73,250,67,249,215,41,85,53,99,216,168,9,216,181,99,51,14,236,219,163,95,230,117,120,136,59,17,17,121,61,85,85,225,112,56,160,170,170,97,92,81,248,173,142,124,199,208,33,99,42,109,94,137,8,68,202,126,
+22,217,178,77,99,188,241,242,83,120,248,209,23,206,248,8,34,186,80,250,205,42,253,175,137,168,230,100,103,101,194,173,105,120,255,141,215,176,104,222,15,72,108,212,68,191,132,170,64,68,131,162,152,224,
+118,151,226,135,239,231,224,192,190,61,167,239,58,240,110,188,2,139,232,60,89,172,214,178,91,53,68,160,40,10,74,121,201,52,81,189,50,153,76,16,169,252,198,130,63,37,39,95,51,126,242,116,124,253,229,71,
+101,191,56,189,113,85,225,244,11,211,161,35,198,227,231,69,243,42,207,17,17,17,121,145,206,221,122,33,42,58,22,75,23,47,64,97,97,129,126,154,26,40,110,96,17,157,39,139,197,2,237,244,230,149,73,81,80,82,
+194,71,2,19,17,81,237,106,218,172,5,118,109,219,10,147,249,244,149,133,229,155,88,167,55,175,174,190,225,46,188,251,22,175,192,34,34,34,34,223,195,13,44,34,34,34,34,47,97,179,219,177,246,183,205,104,219,
+190,169,126,10,183,220,241,16,94,123,241,9,253,48,17,249,128,150,173,219,161,125,199,238,136,142,137,199,202,229,139,176,126,205,175,250,37,68,62,171,117,187,142,176,219,253,240,251,218,85,250,41,106,96,
+184,129,69,68,68,68,228,33,170,114,219,107,179,22,173,209,170,77,123,248,251,7,227,134,89,215,161,69,179,120,220,255,216,211,120,231,205,231,245,75,137,200,203,181,108,211,14,87,92,113,11,46,153,60,26,
+141,154,198,2,0,242,178,242,208,162,109,27,164,166,28,213,47,39,31,100,177,90,33,154,6,69,81,224,114,185,244,211,13,66,171,182,237,17,30,17,141,229,75,22,234,167,168,129,225,6,22,17,17,17,145,7,40,127,
+224,192,95,109,96,233,133,132,134,33,51,35,29,168,226,6,24,17,121,143,206,93,123,98,217,162,133,112,6,57,1,0,217,233,57,248,117,245,86,188,241,246,171,216,183,103,7,182,111,221,164,255,16,242,49,225,17,
+145,40,41,41,129,211,233,68,106,202,49,253,52,81,131,194,71,51,17,17,17,17,85,129,127,64,0,44,214,63,158,0,88,147,206,220,188,10,9,13,195,248,201,51,208,178,77,59,253,178,63,197,205,43,34,223,245,251,186,
+223,48,110,234,69,112,151,148,226,216,161,52,244,31,58,4,99,198,246,195,142,109,27,225,244,15,212,47,39,31,116,234,228,9,228,231,229,226,228,137,52,253,20,145,71,179,251,249,161,107,143,62,240,243,115,
+232,167,206,27,175,192,34,162,26,113,230,27,167,242,55,98,208,93,73,16,29,27,135,220,236,44,228,231,231,87,140,249,146,128,192,32,244,27,56,12,46,151,11,187,119,110,193,161,3,251,245,75,136,200,139,36,
+54,106,2,255,128,64,108,223,178,17,157,186,246,192,211,143,255,7,255,120,232,238,90,57,123,70,81,20,136,8,186,247,234,143,207,62,248,8,141,154,198,97,247,142,67,24,57,110,24,14,238,223,167,95,78,68,13,
+76,167,174,61,81,144,159,135,93,59,182,234,167,136,136,60,146,191,127,0,146,154,36,99,247,142,109,112,185,106,230,129,103,42,128,71,244,131,68,68,213,165,170,166,138,61,113,69,41,251,95,57,253,148,198,
+192,160,96,0,130,82,151,11,5,5,190,251,24,220,65,67,70,225,221,215,95,199,149,151,77,199,37,23,93,138,163,39,50,112,228,240,126,148,20,23,235,151,18,145,23,24,54,114,34,218,119,232,134,216,132,68,140,29,
+51,13,125,122,116,196,171,175,189,132,156,236,44,253,210,26,209,170,109,123,44,253,241,71,4,7,5,224,173,119,230,160,95,239,78,72,203,40,194,170,149,75,244,75,137,168,129,57,158,114,20,233,167,78,64,81,
+148,211,153,120,29,2,85,137,162,152,16,22,17,129,210,82,23,52,183,91,63,77,84,107,74,74,74,112,50,237,56,52,173,230,62,239,120,11,33,17,213,8,183,219,93,233,106,43,17,65,219,14,157,241,237,55,203,176,105,
+221,22,252,235,217,255,194,164,170,144,242,71,190,251,32,77,4,1,1,14,216,253,237,136,79,138,194,123,111,188,140,150,173,219,235,151,17,145,151,88,184,96,46,6,244,233,143,57,159,189,143,43,167,143,199,156,
+239,22,226,200,225,131,250,101,53,230,209,135,158,69,80,88,32,174,255,219,223,113,203,77,51,112,239,195,79,227,183,85,220,188,34,106,232,42,95,217,94,246,3,66,222,46,76,85,101,177,152,209,166,93,39,216,
+108,54,253,20,145,215,225,45,132,68,117,64,85,85,36,38,53,129,51,32,0,219,183,108,132,166,249,238,139,142,242,91,9,3,2,131,176,112,193,47,232,209,171,109,197,92,215,30,125,240,251,218,223,42,173,247,37,
+177,241,9,120,234,201,215,48,106,88,79,228,100,231,227,193,39,158,194,55,115,63,66,129,143,222,50,73,228,235,76,38,19,38,77,187,28,205,155,183,65,169,219,141,148,99,135,241,241,251,175,235,151,213,152,
+228,230,45,17,25,21,139,141,235,87,163,176,176,0,102,139,5,174,146,154,185,228,158,136,136,26,38,69,49,33,36,44,12,57,217,89,40,109,160,79,49,36,223,193,13,44,162,58,96,54,91,48,100,196,88,248,249,57,144,
+149,153,142,195,135,246,99,255,222,221,250,101,62,101,236,196,139,49,247,243,15,0,77,112,226,68,38,172,86,11,110,185,235,94,204,254,244,93,159,254,169,97,104,88,56,98,98,227,145,145,126,178,78,159,20,227,
+244,247,71,84,84,44,82,82,142,160,168,176,80,63,77,68,213,52,120,248,24,244,239,55,2,79,63,113,47,138,138,10,49,100,248,88,52,110,210,18,255,123,227,89,253,210,90,193,3,217,137,136,136,136,42,227,6,22,
+81,29,82,20,5,209,49,177,40,41,41,65,250,169,147,250,105,159,210,127,208,112,244,235,63,2,219,183,111,196,206,29,155,97,183,217,225,42,117,97,199,214,77,112,243,254,251,26,23,30,17,137,38,201,45,176,109,
+203,6,228,231,229,233,167,207,42,32,48,16,10,20,228,228,100,235,167,136,26,180,241,147,167,35,63,63,15,63,253,248,29,0,192,108,177,32,52,44,28,39,142,167,234,151,18,17,17,17,81,29,224,6,22,17,81,3,212,
+182,67,103,88,44,86,100,103,101,32,39,59,11,167,78,158,208,47,33,34,34,34,34,34,242,24,60,196,157,136,106,221,153,135,143,146,103,104,215,161,43,146,146,154,226,240,161,3,220,188,34,34,34,34,162,26,211,
+127,208,112,116,236,210,93,63,76,116,193,120,5,22,17,81,3,163,40,10,130,131,67,80,226,42,169,214,237,134,68,68,68,68,68,231,50,108,212,120,204,251,106,54,118,108,63,136,126,3,187,243,152,10,170,81,42,128,
+71,244,131,68,68,228,219,138,138,10,249,116,51,34,34,34,34,170,17,170,170,98,212,184,41,248,250,179,143,96,245,179,34,42,58,20,254,65,73,88,48,127,174,126,41,209,121,227,125,61,68,68,68,68,68,68,68,116,
+222,46,185,252,58,124,243,229,39,80,45,102,236,223,125,20,203,151,109,192,132,81,3,49,118,226,197,250,165,68,231,141,183,16,18,121,8,135,195,1,147,73,69,94,94,110,197,152,221,110,135,205,238,135,236,172,
+204,74,107,137,136,188,89,171,182,237,225,42,113,97,239,238,29,250,41,34,34,34,242,66,77,155,181,64,120,68,52,178,179,51,113,60,229,8,178,50,51,17,29,19,139,200,232,88,108,219,188,129,79,33,167,26,193,
+13,44,34,15,17,26,22,142,86,109,59,194,223,63,0,133,133,5,232,209,99,32,174,191,114,6,2,252,253,112,221,109,119,224,155,57,31,235,63,132,136,200,43,141,30,63,21,14,135,63,214,173,89,129,226,226,34,164,
+30,59,170,95,66,68,68,228,209,84,179,25,97,97,225,56,145,118,92,63,69,68,127,161,207,128,33,48,41,38,44,95,186,72,63,117,78,220,192,162,58,99,54,155,97,179,219,121,104,244,57,180,110,219,1,95,207,254,6,
+77,146,227,96,82,255,184,195,183,56,191,24,35,38,76,194,47,63,255,88,105,61,17,145,55,10,10,14,193,248,73,51,144,146,114,8,27,214,173,66,70,122,186,126,9,17,17,145,199,178,217,237,120,226,169,215,48,121,
+236,80,76,185,100,26,54,172,95,173,95,210,224,40,138,9,34,154,126,152,200,32,54,62,1,251,118,236,132,106,86,49,108,204,4,44,171,198,123,92,158,129,69,117,230,250,155,239,197,83,79,191,9,135,211,169,159,
+58,43,63,63,135,126,200,167,237,220,190,5,199,211,50,96,82,77,16,17,136,38,208,220,26,108,78,27,230,207,253,18,93,186,247,210,127,8,17,145,215,201,206,202,196,236,79,223,198,111,43,150,114,243,138,136,
+136,188,210,214,237,155,240,217,220,249,200,207,255,227,248,143,134,140,155,87,84,21,38,85,197,35,143,252,7,54,167,29,102,155,5,75,22,205,195,224,97,163,245,203,206,138,27,88,84,103,92,165,46,12,25,208,
+3,209,49,113,250,169,63,213,178,77,59,188,252,202,135,232,213,119,144,126,202,103,249,249,57,144,24,31,89,246,139,51,175,141,20,129,35,208,129,38,201,173,206,24,36,34,242,94,69,69,69,200,207,175,255,43,
+114,131,130,67,16,28,28,162,31,38,106,112,194,34,34,17,18,26,166,31,38,162,63,81,92,84,132,247,254,251,34,254,113,239,13,216,189,115,187,126,154,106,89,255,193,35,48,98,204,36,253,48,121,129,78,93,122,
+224,154,89,147,42,46,214,128,162,224,181,23,94,134,213,102,211,47,253,83,220,192,162,58,243,241,251,175,97,250,229,151,224,120,202,49,253,148,65,112,72,8,46,185,228,90,92,60,121,24,236,118,187,126,218,
+103,153,45,22,164,157,204,132,230,214,160,152,20,40,10,96,50,41,128,162,224,171,175,150,98,193,119,95,234,63,132,136,136,46,64,139,86,109,97,179,251,233,135,137,26,156,182,237,58,33,52,44,92,63,76,68,13,
+140,211,233,196,21,179,110,65,183,158,125,245,83,30,35,229,232,33,28,220,191,71,63,76,94,224,216,145,131,248,239,219,115,161,40,10,20,147,130,140,19,89,120,224,241,199,225,42,41,209,47,61,43,97,204,211,
+234,63,104,184,44,94,180,90,38,76,153,33,86,171,213,48,239,171,245,238,55,88,54,174,223,41,99,38,92,36,11,22,172,20,77,115,139,166,185,229,149,215,63,21,63,63,135,97,61,171,94,205,90,180,150,254,131,71,
+72,96,80,144,97,142,177,186,46,169,113,83,233,214,179,175,4,4,4,26,230,88,221,21,29,19,43,54,155,205,48,206,88,67,171,125,199,46,18,29,19,107,24,103,140,53,156,20,197,36,227,38,93,34,197,249,133,50,102,
+194,69,134,121,198,106,162,200,168,104,217,180,97,151,252,186,98,163,36,36,53,50,204,255,69,134,1,198,234,189,208,176,112,137,140,138,54,140,251,122,81,209,49,210,165,123,111,1,32,77,155,181,144,133,63,
+174,146,89,215,221,97,88,199,170,95,135,206,221,228,217,23,222,149,253,123,142,200,3,15,63,47,17,145,81,134,53,140,213,101,77,154,54,151,119,223,251,90,190,254,122,137,180,104,213,214,48,207,24,99,140,
+49,86,151,37,54,106,34,191,174,216,40,207,191,248,190,4,5,135,24,230,25,171,169,2,3,131,196,225,168,254,5,26,124,10,33,145,7,243,243,243,67,97,97,161,126,152,170,169,81,147,166,152,122,209,44,196,197,196,
+195,100,50,97,194,168,65,152,59,239,39,252,243,209,59,145,153,193,3,164,169,254,244,27,52,28,255,126,226,89,220,243,127,119,99,249,146,133,250,105,34,34,34,162,58,227,112,56,17,21,19,135,19,199,83,60,226,
+156,74,242,125,213,125,122,165,10,224,17,253,32,17,213,173,46,221,123,99,224,224,81,216,177,109,35,68,254,216,83,46,45,45,173,180,142,206,143,166,105,200,202,74,199,209,148,195,40,42,46,134,221,30,132,
+19,39,79,96,205,234,95,80,144,159,175,95,78,84,103,14,31,220,135,57,95,125,129,253,251,118,67,115,187,245,211,68,68,68,68,213,162,170,42,2,2,2,81,92,92,172,159,250,75,46,151,11,89,153,233,112,185,170,126,
+30,17,209,133,169,222,245,84,94,187,129,101,183,219,209,36,185,5,252,253,3,144,159,151,7,77,171,250,174,93,93,80,20,19,34,163,163,17,18,26,142,194,194,2,190,49,161,115,50,155,205,184,243,182,251,161,88,
+109,216,183,103,7,74,75,93,250,37,116,1,138,139,139,113,60,245,24,78,157,76,67,120,100,20,150,253,178,8,179,63,123,23,89,89,153,250,165,68,117,174,168,176,144,223,35,136,136,136,232,130,249,249,57,16,28,
+18,10,187,195,129,192,160,96,20,228,231,85,250,225,56,145,183,171,149,13,44,135,195,1,151,171,118,223,128,39,183,104,133,111,190,252,22,215,204,186,26,191,174,89,131,99,71,14,233,151,212,43,85,53,161,73,
+211,102,136,140,138,197,241,212,99,188,146,134,206,41,39,59,11,219,119,110,193,91,175,188,134,184,196,214,216,190,125,35,10,10,242,61,110,99,214,219,21,23,23,97,247,206,109,56,114,232,0,127,178,68,68,68,
+68,68,62,197,237,118,163,164,164,24,141,26,37,35,38,54,1,71,15,31,228,251,9,242,41,23,188,129,165,40,166,138,203,190,90,181,237,128,15,223,155,139,212,147,39,176,111,207,78,195,58,69,169,185,35,183,92,
+46,23,220,38,7,182,237,220,139,37,139,191,71,94,94,174,126,73,189,18,17,164,29,79,197,145,67,7,184,121,69,85,98,82,85,92,123,245,181,104,217,172,49,118,29,56,2,77,52,156,76,59,174,95,70,68,68,68,68,94,
+106,208,208,81,8,9,9,195,241,212,99,250,41,162,26,32,208,220,110,4,6,7,227,212,201,52,100,101,102,232,23,16,121,61,195,201,238,85,77,81,76,21,127,125,201,101,215,74,230,201,76,209,52,183,92,62,235,22,195,
+218,218,72,81,20,195,24,99,222,216,192,161,163,100,193,252,149,242,239,231,223,145,33,195,199,74,116,76,172,56,157,254,134,117,140,177,170,117,230,247,39,198,24,99,204,19,154,48,229,82,57,117,252,148,76,
+154,118,185,97,142,253,81,199,206,221,165,85,155,246,134,113,86,189,248,94,153,249,98,38,253,110,86,85,149,93,121,85,230,161,199,94,192,39,31,188,129,160,176,64,0,64,187,54,157,206,88,89,123,120,63,47,
+249,138,204,140,83,88,183,105,19,54,109,94,135,3,7,118,35,237,248,113,62,249,131,232,60,216,108,118,0,168,214,211,76,136,136,136,106,91,167,174,61,240,238,235,47,67,81,76,56,122,228,160,126,154,78,107,
+213,166,61,230,125,253,45,70,140,154,162,159,162,106,226,123,101,242,69,231,189,129,133,211,111,16,38,78,189,20,143,60,112,43,0,160,180,184,236,220,171,73,99,134,192,102,179,233,86,19,209,217,108,250,125,
+45,30,188,255,38,252,188,232,59,20,23,22,65,81,244,43,136,106,143,162,152,224,112,58,245,195,94,167,75,247,222,216,188,97,7,174,186,238,118,0,64,64,96,32,254,118,215,195,136,138,142,209,47,37,34,34,170,
+83,69,133,133,40,44,44,70,80,88,32,162,99,227,244,211,116,154,106,54,227,227,217,223,99,235,214,245,250,41,34,34,64,127,73,86,117,114,58,157,178,102,213,22,41,202,47,148,71,159,120,89,58,119,235,37,47,
+191,246,137,164,28,62,46,177,241,137,134,245,140,49,198,60,47,187,159,159,79,92,170,127,237,141,119,139,166,185,69,211,220,242,127,15,63,39,247,220,255,164,20,23,20,202,248,201,211,13,107,25,99,140,177,
+186,174,125,199,174,50,127,222,10,25,56,100,148,97,142,49,198,216,95,119,222,167,170,43,138,9,54,155,21,201,205,91,161,168,168,16,251,247,237,169,120,12,120,147,102,205,145,150,114,12,249,249,249,250,15,
+243,42,29,59,119,71,102,102,58,14,29,216,167,159,34,34,242,25,14,167,19,129,129,193,94,125,160,108,112,72,40,38,77,187,2,215,205,188,10,61,122,181,173,24,255,239,219,115,241,248,227,247,224,200,33,222,
+174,65,68,68,245,47,34,50,10,197,197,69,200,201,206,214,79,17,157,149,170,170,112,159,126,175,77,212,144,169,1,129,129,143,140,155,120,9,82,142,30,66,113,113,145,126,254,28,4,165,165,165,56,145,118,28,
+25,233,167,32,34,80,85,21,34,130,204,140,116,184,92,101,183,19,122,43,147,73,197,67,15,63,135,98,151,11,219,183,110,212,79,19,17,249,12,147,73,133,118,250,177,203,222,202,233,239,143,147,39,142,227,205,
+183,94,65,145,203,129,254,125,186,226,251,121,43,112,205,53,211,144,126,234,164,126,57,17,17,81,189,40,200,207,71,113,177,231,124,191,181,251,249,33,40,36,20,133,5,222,125,225,129,175,114,58,253,97,177,
+88,80,82,82,12,63,135,3,17,145,81,8,14,9,225,6,40,53,88,166,70,141,147,209,180,105,75,184,181,11,219,209,85,20,19,52,77,42,29,238,238,205,154,52,109,134,43,46,25,131,230,205,90,235,167,136,168,142,169,
+170,170,31,162,26,84,92,92,132,220,220,28,253,176,87,41,46,46,130,221,110,71,118,86,38,30,123,232,111,232,217,119,32,102,94,57,25,133,5,5,62,243,125,137,42,139,136,138,70,167,174,61,16,16,24,164,159,34,
+34,162,42,178,152,45,8,244,130,175,163,145,209,49,104,215,177,139,126,216,167,13,24,60,2,91,55,237,192,103,159,206,71,171,182,29,48,97,202,101,216,185,121,43,110,189,237,1,253,82,162,6,195,20,25,21,139,
+224,160,144,11,254,73,128,136,86,145,47,104,213,182,35,30,120,252,57,188,251,206,139,250,41,34,170,99,193,33,161,232,208,185,27,2,131,130,245,83,68,0,128,188,220,92,100,101,101,194,102,47,123,10,225,186,
+213,43,145,149,153,1,133,79,68,240,73,161,225,225,88,178,112,57,214,175,249,21,27,215,110,198,248,201,51,248,223,154,136,232,60,228,230,230,224,192,190,61,250,97,143,211,168,113,50,126,154,255,35,102,94,
+125,27,204,102,179,126,218,39,101,103,103,34,36,56,0,99,198,244,193,87,159,127,133,255,190,244,44,114,114,10,240,214,155,207,234,151,18,53,24,106,113,113,225,35,162,0,251,247,238,68,105,105,169,126,190,
+193,58,117,242,56,150,44,158,143,60,47,191,42,129,200,23,184,74,92,136,139,79,196,144,97,227,209,170,77,71,64,17,156,56,158,170,95,70,62,38,40,40,24,99,39,94,130,228,22,45,81,82,92,132,172,204,12,253,146,
+74,114,178,179,224,46,45,133,162,152,160,40,202,233,13,141,242,77,141,243,58,238,145,60,148,203,229,66,129,75,193,248,177,195,17,18,22,136,75,46,154,140,85,107,55,97,223,158,157,250,165,68,84,11,98,227,
+19,80,234,114,241,189,3,213,153,172,172,12,164,231,184,112,221,149,87,97,193,143,243,144,147,157,165,95,226,115,142,167,30,195,226,101,203,49,113,204,4,36,54,137,65,234,177,83,24,50,106,40,246,237,217,
+165,95,74,212,96,168,249,249,249,143,236,220,182,153,223,128,116,10,11,11,244,67,68,84,79,52,77,67,218,241,20,52,110,218,28,143,254,227,126,180,109,211,13,235,54,172,70,102,70,186,126,41,249,16,171,213,
+10,103,128,63,76,38,21,249,121,185,56,117,242,132,126,201,89,72,197,213,56,101,87,5,115,243,202,215,104,154,134,13,235,127,195,146,229,171,209,189,83,47,132,4,7,224,147,47,190,228,6,22,81,29,24,55,233,
+98,252,188,96,1,58,119,29,132,37,203,22,34,63,47,79,191,132,168,198,185,74,74,176,126,237,74,44,250,121,33,78,164,165,54,152,247,174,41,199,142,224,232,201,108,52,73,104,134,73,23,79,192,158,93,59,78,31,
+141,192,215,54,212,112,25,30,77,200,188,163,184,132,68,185,236,202,155,36,48,48,200,48,199,152,175,54,109,250,85,242,229,151,139,101,200,136,113,134,57,230,123,89,172,86,9,8,12,52,140,51,86,94,76,108,188,
+76,154,118,153,216,108,118,195,28,99,172,102,187,233,182,255,19,77,115,87,180,123,199,65,73,72,106,100,88,199,24,171,157,20,197,100,24,99,172,33,165,156,254,11,242,66,177,241,137,248,225,251,197,200,207,
+47,194,221,247,223,129,149,191,252,164,95,66,228,51,20,197,84,113,198,94,72,88,24,138,11,139,80,192,39,230,248,188,242,3,252,249,232,104,223,54,108,212,4,184,74,138,177,244,167,31,244,83,103,117,230,215,
+4,186,48,86,155,13,193,193,33,56,145,118,92,63,69,84,97,228,216,201,152,255,237,108,253,48,62,249,228,7,220,112,227,37,200,203,205,213,79,145,15,179,217,237,72,74,106,130,236,156,44,164,165,166,232,167,
+137,136,106,5,31,205,228,197,82,142,30,198,196,169,99,49,111,209,98,252,237,150,123,17,19,27,175,95,66,84,107,252,28,14,253,80,173,58,243,141,106,102,122,58,55,175,26,8,183,219,205,205,43,31,215,127,240,
+8,252,56,111,46,102,127,244,17,154,54,107,161,159,62,43,110,94,213,28,171,213,138,232,152,56,62,241,149,206,202,100,50,225,233,71,159,212,15,3,0,90,52,75,226,67,20,26,152,118,29,58,227,134,91,238,67,175,
+126,67,224,240,115,234,167,137,136,106,141,10,224,17,253,32,121,143,204,140,116,252,178,244,71,172,89,251,43,50,210,79,194,229,114,233,151,16,85,155,205,110,135,104,26,68,140,23,104,118,233,222,27,61,123,
+15,64,199,206,61,145,153,113,178,65,28,162,73,68,181,163,119,191,193,248,250,243,207,145,151,91,0,147,201,132,180,204,66,252,246,235,82,253,50,170,101,45,219,180,71,65,65,1,178,50,211,255,244,235,62,145,
+162,40,152,56,105,6,154,54,141,211,79,225,254,135,254,137,181,171,87,232,135,201,135,149,186,75,145,150,122,20,63,45,252,30,153,153,60,143,148,136,234,14,55,176,170,169,99,151,30,240,115,56,254,242,105,
+88,117,45,59,43,147,155,87,84,35,108,54,27,18,146,26,35,59,43,11,154,102,188,194,161,85,235,246,184,104,202,229,232,211,163,23,14,165,30,197,238,157,219,244,75,136,136,254,82,72,104,24,22,126,255,35,10,
+139,138,209,189,119,87,188,245,206,219,216,178,121,29,159,254,91,15,242,243,114,113,60,245,24,55,175,232,172,68,4,203,150,255,140,176,176,38,104,145,156,8,179,213,12,0,120,237,205,47,240,214,235,207,160,
+176,176,80,255,33,228,195,10,11,10,112,234,100,154,126,152,136,168,214,113,3,171,26,102,92,113,61,126,152,55,7,25,217,192,47,75,171,126,78,7,145,183,176,219,253,208,127,240,112,184,74,74,144,154,114,68,
+63,13,0,56,116,112,31,214,174,91,137,188,162,18,132,134,70,98,239,238,109,40,46,46,210,47,35,34,58,39,183,219,141,95,86,253,138,151,94,121,1,169,41,199,144,147,157,197,205,171,122,82,82,82,162,31,34,50,
+200,201,206,194,215,95,127,134,143,63,255,28,71,82,114,145,126,170,0,15,63,124,59,78,28,231,217,105,14,167,19,78,167,63,138,138,248,122,136,136,168,54,241,16,247,42,10,10,14,193,146,197,191,162,160,160,
+8,215,221,124,37,182,111,217,164,95,66,228,245,90,181,109,143,232,152,120,108,250,125,13,50,210,79,233,167,43,113,250,251,163,71,239,129,216,187,123,59,14,31,220,175,159,166,106,40,123,28,242,31,120,182,
+15,53,52,170,170,66,211,196,107,63,247,3,2,131,112,221,141,247,96,219,214,223,241,195,188,185,250,105,34,159,160,127,112,66,112,72,8,76,38,245,47,95,47,52,4,157,186,246,68,88,120,36,22,255,240,173,126,
+138,136,136,106,16,55,176,170,168,75,183,94,72,110,222,6,115,190,120,31,165,188,85,143,124,84,112,72,40,242,243,114,171,124,59,170,205,110,71,64,64,32,78,157,60,161,159,162,243,100,50,153,32,194,77,44,
+34,111,114,203,237,15,224,226,73,147,113,205,141,87,96,215,246,173,250,105,34,159,81,254,3,151,242,239,81,54,187,29,37,197,37,13,246,123,86,76,92,60,250,13,24,129,195,135,246,97,255,222,157,124,146,39,
+17,81,45,227,45,132,85,148,154,114,20,219,182,252,254,167,103,2,17,249,138,162,162,194,106,125,142,187,75,75,249,52,192,26,16,28,18,138,164,198,77,145,159,151,115,122,243,144,63,87,32,242,22,3,6,143,64,
+92,92,35,60,248,224,29,188,26,149,26,0,169,244,61,202,93,90,218,160,191,103,13,27,57,1,179,63,125,27,161,193,137,216,176,105,29,142,167,30,211,47,33,34,162,26,84,249,190,21,31,99,54,91,244,67,68,68,30,
+165,89,203,214,88,249,203,26,108,94,191,14,43,126,89,143,161,35,199,1,127,114,91,33,85,93,92,66,18,94,124,229,35,12,27,53,65,63,69,84,227,74,74,74,240,246,155,207,241,202,11,162,6,104,249,210,31,49,235,
+186,59,208,188,89,18,190,248,248,115,248,251,7,232,151,16,213,152,128,192,64,116,237,222,7,126,14,135,126,138,168,65,41,255,81,138,79,53,109,250,85,178,97,253,78,105,209,170,141,97,142,49,198,60,165,169,
+151,92,37,154,230,174,212,196,169,151,25,214,177,170,21,20,28,44,239,189,255,141,104,154,91,220,165,46,249,251,63,158,146,230,252,62,192,24,99,213,202,225,112,74,143,222,3,36,40,56,196,48,199,140,181,106,
+219,65,174,188,246,111,18,28,18,106,152,99,172,166,10,11,143,144,187,238,125,92,90,181,237,96,152,99,172,1,101,24,240,250,218,180,239,36,69,249,133,162,105,110,89,183,102,155,248,57,28,134,53,140,49,86,
+159,41,138,73,0,72,104,88,184,220,247,192,51,178,126,237,118,201,58,149,37,154,230,150,231,94,120,207,176,158,253,117,118,187,93,230,204,249,201,176,33,248,202,107,159,24,214,50,198,24,59,123,119,220,243,
+152,148,186,74,164,93,135,206,134,57,198,88,253,213,188,101,27,137,141,79,48,140,51,214,128,50,12,120,117,14,135,83,222,255,224,91,113,187,75,43,222,188,140,30,55,213,176,142,49,198,234,187,242,77,44,0,
+98,179,219,165,107,143,62,242,252,139,239,73,151,238,189,13,107,217,95,103,181,90,229,171,175,150,84,218,188,90,181,114,179,52,109,214,194,176,150,213,124,157,187,245,146,91,238,120,80,198,79,158,97,152,
+99,140,121,126,254,254,1,114,195,173,247,201,111,191,110,150,180,99,39,229,161,71,95,224,21,69,140,49,198,60,45,195,128,87,103,181,217,100,246,236,69,149,222,192,92,121,205,223,12,235,24,99,204,19,58,115,
+19,139,157,127,229,255,30,99,227,19,228,224,190,163,162,105,110,121,233,149,143,36,56,196,59,110,127,177,90,109,98,82,85,195,184,55,212,36,185,185,124,49,123,81,165,31,28,61,248,200,127,36,44,60,194,176,
+150,213,76,86,155,77,172,86,171,4,7,135,136,201,196,175,33,172,102,10,8,12,146,9,83,46,149,191,221,245,136,116,235,217,215,48,207,24,99,140,213,119,202,233,191,240,41,3,6,143,192,207,139,230,65,81,20,188,
+255,193,119,184,247,222,27,120,184,42,17,121,36,253,97,237,13,245,81,228,53,169,77,187,142,104,223,177,59,190,153,243,17,10,10,10,244,211,30,233,234,27,238,66,128,127,32,230,204,126,23,71,14,29,212,79,
+123,172,176,240,8,172,250,101,13,146,91,38,234,167,48,110,210,116,204,251,230,11,253,48,213,128,136,168,104,228,100,103,193,233,244,71,86,102,70,181,158,30,75,68,68,68,228,173,124,242,49,87,203,126,254,
+17,151,207,186,5,67,70,140,195,85,87,78,228,230,21,17,121,44,17,173,98,211,74,68,51,108,104,85,133,195,225,212,15,249,36,127,255,0,88,109,54,253,112,37,138,98,194,182,45,27,241,233,135,111,161,160,160,
+224,188,254,125,214,135,212,148,195,24,54,112,48,218,180,237,172,159,242,104,141,155,54,255,211,205,43,205,173,225,200,225,253,250,97,170,33,39,211,142,163,184,168,8,25,233,167,184,121,69,181,198,225,112,
+162,67,231,110,13,230,123,12,17,17,121,62,159,188,2,171,33,178,217,237,40,46,42,210,15,19,145,143,11,10,14,193,130,239,151,226,240,209,84,92,115,237,52,228,229,230,234,151,248,12,63,63,63,148,186,221,112,
+149,148,232,167,124,130,217,98,129,201,100,66,73,113,177,126,202,99,69,70,69,99,239,142,93,240,15,246,175,52,190,241,247,221,232,214,163,29,220,238,210,74,227,68,228,61,204,102,51,186,116,239,131,109,91,
+126,247,233,239,45,68,68,228,61,84,0,143,232,7,125,129,162,152,160,40,10,20,197,247,247,232,6,14,29,133,175,62,255,22,138,61,16,107,87,47,215,79,19,145,143,211,76,118,220,48,235,18,4,133,55,193,150,45,
+235,124,246,141,70,105,105,41,52,183,91,63,236,51,52,77,131,219,203,254,249,242,243,243,16,20,209,20,125,122,117,170,52,190,248,231,213,152,59,231,227,74,99,68,181,33,46,33,17,157,187,246,66,102,198,73,
+20,23,23,35,60,50,18,17,145,209,200,206,202,212,47,165,106,210,52,13,199,142,28,66,137,143,254,208,128,168,186,76,38,19,84,85,229,149,175,68,245,200,103,55,176,42,159,245,229,219,146,155,183,198,93,119,
+221,136,209,35,7,161,160,196,142,13,235,87,161,180,212,165,95,70,68,62,200,93,90,138,223,215,253,138,79,103,207,70,104,120,20,194,35,163,176,125,235,70,253,50,162,90,179,99,199,102,204,186,252,74,216,29,
+246,138,177,103,158,255,15,182,108,90,95,105,29,81,109,8,11,143,192,164,201,151,35,61,227,4,66,195,35,208,161,83,15,36,38,53,197,246,173,27,0,0,33,161,97,152,118,201,44,52,73,110,129,220,156,44,228,230,
+100,235,127,11,34,162,42,137,79,76,194,85,215,220,142,94,125,6,33,33,169,49,118,239,220,202,205,44,162,211,20,197,132,192,160,64,20,215,242,157,4,62,188,129,229,251,202,174,50,3,14,29,216,139,245,155,118,
+34,33,38,25,211,38,14,199,230,157,123,177,123,231,246,6,177,121,87,23,202,206,208,225,191,75,242,44,101,87,151,254,241,249,153,157,149,137,245,107,87,226,212,201,227,200,207,207,211,47,247,122,102,139,
+5,97,225,17,40,244,146,67,217,27,10,69,49,33,39,59,11,203,127,91,139,54,45,58,99,235,214,125,184,233,111,183,225,155,57,159,232,151,18,213,10,179,217,140,174,221,251,226,224,193,189,240,15,8,196,169,147,
+199,113,232,192,30,100,164,159,2,0,180,239,216,21,255,121,250,25,92,60,101,2,92,138,19,89,89,233,56,117,50,13,34,252,190,78,68,213,83,92,92,132,144,240,112,220,126,211,205,104,215,166,61,230,204,253,12,
+197,197,13,235,8,151,208,176,112,104,162,193,93,90,138,142,157,187,35,169,113,83,28,59,114,72,191,140,188,144,211,233,68,112,104,40,220,165,110,68,197,196,34,33,169,17,66,195,35,144,113,234,164,126,233,
+159,138,136,140,68,114,139,214,72,57,122,88,63,85,163,124,255,254,58,31,167,40,74,197,139,48,147,201,132,184,132,36,68,70,69,99,227,250,53,94,119,43,202,185,152,45,22,56,29,78,100,103,103,233,167,106,85,
+249,1,208,34,26,204,102,51,74,75,75,161,40,38,62,41,142,234,149,162,152,42,62,31,27,202,231,98,68,100,20,166,92,124,21,126,91,249,51,246,237,221,197,171,40,136,168,66,167,174,61,225,112,56,209,162,85,7,
+124,249,217,59,200,57,253,90,193,110,183,227,174,123,159,64,120,88,4,32,130,109,59,54,163,93,219,78,120,232,129,91,121,139,33,17,157,183,240,136,72,168,102,51,210,82,83,244,83,62,239,178,43,111,194,174,
+157,155,1,17,44,252,254,123,124,51,255,23,92,57,115,130,126,25,121,161,153,215,220,134,231,159,120,24,7,15,167,33,41,33,10,1,129,78,108,222,178,15,61,251,116,128,187,244,175,207,52,245,115,56,16,24,20,
+92,39,127,46,206,188,215,142,121,89,138,98,18,69,81,68,81,20,195,184,126,173,55,23,24,24,36,137,141,154,24,198,107,179,51,255,29,14,27,53,65,54,109,216,37,109,59,116,22,0,18,28,18,34,253,7,13,23,147,201,
+183,254,61,51,230,169,249,251,251,203,168,177,83,36,38,46,94,84,85,53,204,51,198,26,118,86,155,77,162,162,99,196,108,54,87,140,217,237,118,25,51,97,154,116,238,214,75,34,163,99,100,192,144,145,210,167,
+255,16,159,123,141,196,24,99,117,85,72,104,152,188,245,191,47,165,32,39,95,210,211,210,165,123,175,126,134,53,204,59,107,214,162,149,28,61,152,34,154,230,174,104,201,79,107,13,251,12,245,29,175,192,242,
+1,229,87,4,169,170,90,113,213,149,175,93,37,164,40,38,248,251,251,163,168,184,168,206,158,64,86,254,239,112,224,144,145,248,126,206,108,56,2,29,216,188,113,15,254,243,218,107,24,54,112,56,86,174,94,129,
+215,95,126,90,255,97,68,84,11,20,69,129,205,110,71,81,97,161,126,138,136,136,136,136,234,200,144,225,99,209,183,223,48,124,243,245,199,216,184,126,141,126,154,188,216,200,177,147,241,253,87,159,195,164,
+150,221,133,116,50,53,29,141,155,55,70,65,126,190,126,105,189,225,6,150,15,40,223,104,233,214,179,47,58,119,233,131,217,159,189,93,113,246,131,175,40,191,149,207,102,179,98,226,180,43,96,183,249,97,197,
+47,63,98,239,238,157,250,165,53,170,223,192,97,88,246,211,2,224,244,121,67,229,68,4,45,219,180,199,158,157,219,43,141,19,17,17,17,17,17,17,121,139,51,143,205,25,57,102,50,238,191,251,255,208,181,75,11,
+124,191,96,37,174,186,106,18,10,60,236,12,90,195,101,89,204,59,107,219,190,147,100,167,103,203,184,73,151,24,230,188,189,242,91,245,38,78,187,188,226,146,198,188,172,92,233,63,104,184,97,109,77,54,233,
+140,191,223,153,109,88,183,67,204,22,139,97,61,99,140,49,198,24,99,140,49,230,77,149,31,77,84,246,215,138,52,106,146,44,54,155,205,176,174,190,227,83,8,125,200,137,180,227,88,253,251,102,28,60,176,7,233,
+167,78,232,167,189,154,136,160,85,219,14,248,234,211,79,224,240,247,131,187,212,13,155,159,13,237,90,119,193,236,57,159,161,168,168,118,110,43,74,77,57,130,118,109,250,160,121,243,196,138,177,172,83,217,
+120,230,197,215,176,97,253,111,167,15,208,151,74,31,67,116,54,141,155,52,131,159,159,3,121,185,57,250,169,122,101,177,90,209,162,101,27,20,23,21,162,164,164,118,31,125,219,80,132,69,68,32,40,40,216,39,
+159,8,73,68,68,68,68,190,166,236,61,109,217,221,93,130,172,204,12,68,69,199,194,108,177,120,212,17,30,101,215,138,145,207,88,178,120,62,118,237,216,170,31,246,9,163,70,79,69,88,84,8,74,10,138,241,224,99,
+47,224,214,59,30,68,98,124,36,218,180,235,164,95,90,99,178,179,50,49,243,170,201,248,114,206,207,0,128,3,123,143,161,223,144,193,248,240,189,87,16,16,24,136,152,184,120,253,135,16,25,4,5,135,224,146,203,
+174,197,23,159,126,141,78,93,123,234,167,235,141,191,127,0,250,244,31,130,39,159,126,3,15,254,223,211,176,59,252,244,75,168,154,186,116,239,141,111,190,94,138,245,171,54,96,195,218,13,24,57,118,178,126,
+9,145,71,11,13,13,131,197,106,213,15,19,121,141,240,136,72,248,249,57,244,195,68,0,128,240,200,40,244,233,63,4,45,90,182,129,221,206,215,61,68,122,103,158,163,29,29,27,95,171,239,181,207,7,207,192,34,143,
+166,40,202,233,171,156,128,216,248,4,52,105,218,2,37,37,197,56,122,228,32,26,55,105,142,192,160,96,252,186,252,231,90,123,28,118,249,249,98,86,155,13,227,38,94,130,173,91,126,199,174,237,91,0,0,170,170,
+66,81,20,148,86,225,177,162,212,112,5,4,4,162,119,191,193,136,137,77,194,174,157,155,176,97,253,106,143,249,41,70,84,116,12,158,124,242,85,248,251,59,241,239,231,30,195,186,213,43,245,75,124,86,147,228,
+230,104,146,220,18,171,150,255,132,252,26,58,152,82,81,76,248,224,195,111,113,233,140,81,21,99,179,174,191,19,239,253,247,197,74,235,136,60,153,191,127,0,138,139,139,224,114,185,244,83,68,30,47,58,38,14,
+79,61,249,42,158,123,225,49,108,221,244,187,126,154,8,113,241,137,24,48,120,20,34,35,99,177,232,199,175,176,109,203,70,253,18,224,244,213,233,54,155,221,227,174,154,39,170,75,54,155,13,161,97,225,72,77,
+57,166,159,170,87,134,251,10,153,247,230,105,143,185,188,208,84,85,53,140,149,87,126,46,86,109,167,127,220,182,201,100,50,140,49,118,182,2,131,130,37,42,38,214,48,238,41,5,6,6,137,195,233,52,140,251,114,
+161,97,225,178,230,183,173,162,105,110,185,124,214,45,134,249,11,233,206,191,255,83,14,31,72,145,29,91,247,201,23,95,44,148,198,77,155,25,214,48,198,24,171,157,2,2,3,101,232,136,113,18,17,21,109,152,99,
+236,204,76,38,147,88,207,114,190,207,128,193,35,100,205,111,91,229,206,123,31,55,204,49,198,234,55,222,66,232,99,202,175,86,242,5,138,98,130,106,54,87,250,181,162,152,96,50,153,160,170,106,157,253,179,
+138,104,21,127,239,178,95,87,190,180,146,232,108,236,118,63,152,76,38,164,165,166,232,167,60,70,78,78,182,71,61,26,183,46,116,235,217,31,81,17,193,88,180,112,13,142,30,222,175,159,190,32,175,188,248,56,
+122,246,235,129,33,35,7,98,230,204,9,56,176,111,143,126,9,17,17,213,146,220,156,28,44,254,241,59,156,76,59,174,159,34,170,68,211,52,148,20,87,62,247,211,102,179,225,193,71,255,131,5,95,207,69,215,238,173,
+224,199,91,12,137,60,14,111,33,36,143,165,170,42,76,170,10,87,73,137,126,10,168,120,220,167,212,217,70,22,81,117,89,109,54,216,172,54,228,231,231,65,211,60,115,211,243,204,219,116,27,130,200,168,104,12,
+25,62,30,251,247,239,194,214,141,235,121,200,58,17,17,17,33,44,60,2,143,60,246,34,110,190,225,226,138,177,223,215,237,68,223,254,93,80,84,84,84,105,45,17,213,31,62,133,144,60,152,2,57,199,6,149,162,0,38,
+83,217,83,18,136,60,145,219,237,70,73,73,177,71,127,142,154,205,102,168,102,51,52,183,91,63,229,147,194,34,34,144,159,159,139,245,171,127,133,203,245,231,155,227,68,84,153,170,150,95,13,237,185,95,203,
+136,188,137,170,170,112,56,156,252,62,228,65,6,14,30,133,168,168,56,204,91,240,19,172,38,7,98,162,194,16,28,228,196,91,111,191,141,252,60,254,176,171,46,5,135,132,98,236,196,75,208,180,89,75,28,57,188,
+31,165,60,147,145,206,192,43,176,26,24,127,255,0,4,135,132,226,232,145,67,250,41,175,163,40,10,84,85,229,33,234,228,149,254,184,37,181,126,175,204,114,56,156,40,117,151,26,46,163,39,34,42,215,36,185,57,
+50,78,157,68,86,45,61,48,133,168,161,153,56,245,82,140,29,53,25,15,63,114,7,142,29,57,172,159,166,122,96,82,213,138,31,230,169,170,138,102,45,91,195,102,179,99,251,214,77,103,189,27,132,106,158,201,100,
+194,27,111,126,129,107,174,158,132,244,180,12,116,234,209,13,71,15,31,212,47,171,17,38,83,217,209,52,124,47,233,93,120,6,86,3,51,117,250,44,172,92,186,18,35,198,76,210,79,121,37,119,3,185,106,132,124,135,
+217,108,129,170,170,176,88,204,240,115,212,255,217,10,110,205,13,87,9,127,178,69,68,103,119,60,229,24,242,120,187,45,81,141,9,8,8,198,164,177,131,208,163,215,64,253,20,213,147,242,205,43,69,49,193,237,
+118,99,231,182,45,216,244,251,90,110,94,213,49,77,211,240,193,199,111,226,234,235,239,194,132,139,47,70,202,209,218,219,224,53,169,42,134,141,154,128,230,45,219,232,167,200,131,241,22,194,6,198,207,233,
+64,78,129,96,223,190,157,56,184,127,175,126,154,136,106,153,213,106,133,136,64,211,180,178,255,173,239,77,216,211,255,95,136,136,206,198,229,114,241,235,4,81,13,58,176,111,23,22,44,254,9,59,119,108,70,
+110,78,182,126,154,234,21,111,78,170,111,135,15,238,199,198,223,127,195,145,67,7,106,245,24,14,77,211,144,159,159,139,17,163,167,160,81,147,100,28,62,180,143,27,150,94,128,183,16,54,96,13,237,240,102,34,
+34,34,34,34,34,162,114,227,167,204,192,151,31,191,135,129,195,71,226,215,95,126,214,79,147,135,225,21,88,68,68,68,68,68,68,68,228,115,130,130,67,240,200,99,47,194,230,103,199,158,93,219,245,211,216,183,
+119,39,22,44,250,25,187,119,110,67,97,97,129,126,154,60,12,175,192,34,34,34,34,34,34,34,34,159,51,100,196,56,44,90,240,53,74,139,93,24,54,118,34,150,253,244,131,126,9,121,17,30,226,78,68,68,68,68,68,68,
+68,62,39,53,229,8,210,142,157,130,217,102,193,19,15,63,5,147,137,91,32,222,140,255,245,200,99,41,10,63,61,137,136,136,136,136,136,232,252,164,159,60,129,69,75,215,160,32,167,0,251,14,30,225,6,150,151,227,
+45,132,228,145,202,55,175,68,248,212,35,34,34,34,34,34,34,58,63,3,135,140,66,108,92,18,22,46,152,139,83,39,79,232,167,201,139,112,3,139,60,18,55,176,136,136,136,136,136,136,136,168,156,79,92,63,215,36,
+185,57,34,162,162,245,195,228,229,184,121,69,68,68,68,68,68,68,53,129,71,212,120,63,159,248,47,120,201,140,235,240,226,11,239,32,58,54,78,63,69,94,138,155,87,68,68,68,68,68,68,84,19,20,197,196,247,152,
+62,192,39,54,176,190,249,250,99,168,38,21,201,205,91,235,167,136,136,136,136,136,136,136,168,1,227,230,149,111,240,153,51,176,202,159,38,160,105,252,196,36,34,34,34,162,179,179,88,173,112,149,148,232,135,
+137,136,136,200,131,249,196,21,88,56,189,113,197,205,43,34,34,34,34,58,27,69,81,240,200,227,47,97,211,250,237,104,211,174,163,126,154,136,136,136,60,152,207,92,129,69,68,68,68,84,147,44,86,43,194,194,194,
+113,60,53,69,63,69,94,200,106,179,225,249,23,222,195,77,215,95,4,0,200,201,200,197,147,207,191,142,125,251,118,162,164,164,4,139,127,252,6,133,5,5,250,15,35,34,34,34,15,225,51,87,96,17,17,17,17,213,36,
+17,129,166,241,231,124,190,192,207,207,81,177,121,37,154,192,93,234,70,96,104,0,158,126,252,239,152,253,233,59,104,223,190,43,74,138,139,245,31,70,68,68,68,30,132,87,96,17,17,17,17,145,79,243,15,8,192,
+206,45,187,17,155,24,9,119,169,27,10,20,40,166,178,86,46,223,132,209,99,7,34,55,55,71,255,97,68,68,68,0,128,86,109,219,35,42,58,14,203,151,44,132,219,237,214,79,83,29,225,21,88,68,68,30,66,81,76,176,88,
+173,250,225,58,103,54,155,225,116,250,235,135,125,158,217,98,129,217,108,214,15,19,145,15,200,203,205,197,248,169,147,240,235,138,205,80,205,42,76,102,19,20,147,130,111,191,249,5,19,167,140,224,230,21,
+17,17,157,83,88,120,20,110,185,225,46,36,53,110,170,159,162,58,196,43,176,136,168,198,168,170,122,250,150,27,239,127,160,130,217,108,134,197,98,65,97,97,161,126,170,214,152,205,102,152,45,22,20,213,225,
+223,243,207,40,138,9,170,106,66,105,105,169,126,202,167,41,74,217,207,116,248,152,101,34,223,165,170,42,30,124,244,5,220,52,235,18,220,245,127,143,224,195,119,95,5,78,255,249,231,159,125,34,34,58,151,152,
+184,120,20,228,231,35,59,43,83,63,69,117,132,27,88,68,84,99,172,54,27,20,69,65,113,81,145,126,202,99,169,170,90,113,25,176,217,108,134,221,238,7,147,170,162,101,235,118,104,212,184,57,190,157,251,9,138,
+138,234,119,67,137,136,136,46,156,162,40,16,41,123,217,27,24,20,140,156,236,44,195,56,17,17,17,121,46,110,96,17,81,141,210,255,20,219,108,177,64,115,187,61,242,170,44,171,205,134,232,152,56,136,166,161,
+160,32,31,241,137,141,208,181,91,63,52,75,110,133,70,9,9,216,127,232,16,222,124,227,95,56,116,96,191,254,67,107,93,249,213,64,229,120,101,0,17,209,133,211,127,143,210,255,154,136,136,136,60,23,55,176,136,
+168,86,153,45,22,136,166,121,228,97,135,1,1,129,232,222,123,0,198,141,189,8,5,133,5,200,205,205,193,237,55,92,137,136,152,80,224,244,35,214,63,250,98,1,190,156,251,1,138,10,11,177,97,253,111,245,114,117,
+89,125,189,193,170,175,191,47,17,17,17,17,17,249,174,174,61,250,162,95,255,225,88,242,243,60,108,92,191,90,63,125,86,42,128,71,244,131,68,68,53,165,252,174,12,79,188,61,163,164,164,24,217,89,25,208,32,
+24,216,119,16,110,188,246,98,4,4,59,43,230,109,126,54,116,235,218,6,133,133,22,204,159,63,7,153,25,25,117,182,231,63,104,216,104,68,68,70,33,229,232,97,0,114,250,138,172,186,249,123,255,161,190,254,190,
+68,68,68,68,68,228,107,252,253,3,112,251,221,143,225,147,247,95,199,200,17,3,113,245,149,51,113,50,171,20,235,214,172,208,47,61,43,97,140,177,11,45,36,44,76,44,22,139,97,28,128,40,138,98,24,243,180,58,
+118,233,33,75,126,90,43,89,167,178,164,180,164,68,52,205,45,154,230,150,244,180,12,233,211,127,136,97,125,109,119,223,3,255,146,130,220,124,153,52,237,114,195,92,109,215,111,224,48,105,222,170,141,97,220,
+215,11,8,12,146,132,164,198,134,113,198,24,99,140,49,198,216,133,213,188,85,27,217,188,113,119,197,251,44,183,187,84,52,205,45,165,46,151,180,237,208,217,176,254,207,226,45,132,68,116,65,146,26,53,197,
+253,255,120,10,99,135,247,195,228,25,23,99,205,175,191,84,154,183,88,173,176,90,172,200,207,207,171,52,238,105,130,67,66,16,21,29,135,200,232,24,132,134,70,34,54,54,17,170,217,140,229,75,23,96,211,134,
+117,250,229,181,46,42,58,6,191,252,188,18,205,90,38,225,210,43,111,194,167,31,188,169,95,82,43,250,244,31,130,239,231,124,137,227,105,25,248,251,67,15,96,219,230,245,216,191,119,183,126,153,79,234,216,
+185,59,70,143,189,8,207,62,253,15,148,148,148,232,167,137,136,136,136,200,199,217,236,118,140,157,112,17,142,30,57,132,213,191,46,211,79,211,121,138,141,79,196,175,203,126,69,98,227,24,64,164,98,19,74,
+81,20,0,64,231,110,189,171,124,43,161,97,87,139,253,117,138,98,50,140,177,154,207,233,244,151,128,128,64,195,56,243,140,194,194,35,100,213,202,77,82,82,84,34,207,189,240,174,196,37,36,26,214,168,170,42,
+54,187,221,48,238,73,169,170,106,184,74,204,233,116,26,214,213,85,229,95,95,58,117,237,33,197,5,69,242,225,71,223,27,214,148,103,182,88,100,208,176,209,50,249,162,43,196,207,207,207,48,95,157,204,102,179,
+44,252,113,85,197,79,69,52,205,45,215,221,116,79,165,53,126,126,126,98,54,155,13,31,235,11,53,111,217,70,30,122,236,5,233,220,173,151,97,142,49,198,24,99,140,249,126,38,147,73,38,76,153,33,27,127,223,41,
+151,93,121,147,4,5,135,24,214,176,234,21,22,30,33,107,127,219,90,118,213,85,105,105,89,167,175,190,42,46,40,148,75,46,187,214,240,49,103,171,242,99,174,168,202,130,130,131,209,163,119,127,253,48,213,48,
+155,221,6,147,170,234,135,201,67,216,237,126,88,178,98,21,122,15,24,136,187,110,191,10,199,142,28,214,47,129,219,237,174,151,131,207,171,74,81,76,208,52,129,72,249,121,79,101,242,243,243,43,173,171,75,
+34,26,20,197,132,13,235,86,99,218,101,179,240,225,199,255,213,47,1,0,88,44,22,140,155,120,9,62,126,251,29,52,110,220,28,165,165,23,118,80,190,219,173,97,255,161,35,21,191,118,21,149,96,203,230,181,149,
+214,148,186,221,30,121,158,89,77,56,114,248,0,246,239,223,13,139,213,170,159,34,34,34,34,162,6,64,211,52,124,51,231,19,220,255,208,255,161,73,227,102,136,138,142,209,47,105,240,20,69,169,214,123,244,139,
+166,95,131,46,221,91,65,78,191,231,58,211,218,117,59,241,217,71,127,254,94,231,108,12,187,90,236,175,179,90,173,114,235,29,15,74,167,174,61,13,115,140,49,239,200,98,181,138,170,170,2,64,108,118,187,225,
+42,44,79,175,83,215,30,242,229,236,197,50,229,226,153,162,170,53,115,85,84,251,142,93,229,68,202,73,41,200,201,147,137,245,112,254,86,125,87,157,207,1,135,211,41,157,186,246,148,240,136,72,195,28,99,140,
+49,198,24,99,190,88,114,243,150,146,212,184,169,97,252,108,221,114,251,131,21,103,93,149,95,129,85,126,183,71,113,65,161,180,110,215,193,240,49,103,139,87,96,157,167,146,146,18,156,60,121,28,223,207,249,
+10,131,134,141,214,79,19,145,23,40,117,149,66,211,4,0,16,159,144,132,43,174,190,21,35,199,78,134,159,195,129,70,77,146,241,254,7,223,98,232,200,241,250,15,243,24,187,182,111,197,205,183,94,142,57,159,191,
+15,183,187,84,63,125,94,54,111,92,135,174,189,123,160,107,239,62,248,122,246,135,250,105,159,167,255,169,208,185,68,69,199,98,224,224,209,232,213,111,8,76,166,170,255,20,138,136,136,234,135,159,195,129,
+128,128,64,253,48,17,1,80,171,113,69,13,53,108,199,83,143,225,120,234,49,253,240,89,45,255,229,7,148,20,20,195,164,154,160,152,20,40,166,178,115,175,138,243,139,225,42,41,69,104,104,164,254,67,206,170,
+202,27,88,227,38,79,199,141,183,254,3,33,161,97,250,169,6,107,222,183,159,227,95,47,190,142,132,132,38,250,41,34,242,2,34,26,68,52,0,64,218,241,20,140,24,50,10,243,191,157,141,31,230,47,199,7,239,124,142,
+203,47,27,131,206,157,123,233,63,204,99,20,20,228,35,237,120,170,126,248,130,29,62,184,31,219,183,110,2,78,223,98,217,80,4,135,132,162,207,128,161,8,12,10,210,79,253,169,131,251,247,97,246,103,239,32,48,
+32,8,55,255,237,255,208,172,69,43,253,18,34,34,242,16,19,167,94,134,173,27,119,226,249,23,222,213,79,249,148,38,201,205,176,104,225,111,24,61,126,170,126,138,232,172,146,26,55,65,98,35,190,167,173,79,126,
+14,7,70,143,159,134,158,125,6,192,102,183,235,167,61,74,94,110,110,181,142,136,217,183,103,39,114,114,254,56,158,101,229,242,77,24,52,108,12,154,183,109,131,38,45,154,225,215,21,63,87,90,255,87,12,151,
+101,253,89,157,187,246,148,140,19,25,178,109,243,94,105,217,166,157,97,158,49,198,188,169,51,31,196,80,254,215,131,134,142,174,116,128,185,166,185,101,207,206,131,50,105,218,229,210,161,115,119,195,239,
+193,124,171,216,184,4,89,183,122,155,244,27,56,204,48,119,174,98,226,226,229,181,55,62,151,169,151,92,105,152,99,140,85,63,155,205,46,126,126,14,113,56,234,239,97,26,204,55,42,255,254,62,235,250,59,42,
+190,175,191,253,206,92,195,58,95,234,181,55,62,19,77,115,203,103,159,253,96,152,99,236,108,197,196,198,75,100,116,140,97,156,213,93,54,155,77,134,142,24,39,35,199,78,22,135,195,97,152,247,230,204,102,179,
+188,250,250,167,178,228,167,181,50,108,212,4,195,124,53,51,12,156,181,105,211,175,18,77,115,203,13,183,220,103,152,99,85,47,48,40,72,66,194,194,13,227,140,177,186,79,81,76,98,50,149,189,192,237,214,179,
+175,97,3,171,188,91,239,124,200,240,177,204,183,82,20,69,58,117,233,33,209,177,113,134,185,179,85,121,35,180,234,231,103,177,250,205,102,179,73,80,80,176,97,156,121,70,170,170,138,197,98,241,248,39,216,
+50,207,174,252,235,243,69,51,174,174,244,253,188,223,160,234,253,144,194,155,186,230,134,187,164,180,180,84,78,29,63,37,55,253,237,255,12,243,140,49,86,215,149,127,45,214,191,78,62,243,53,116,117,82,78,
+255,69,149,88,172,86,244,233,63,4,187,119,110,67,202,81,227,211,198,168,106,174,187,233,239,40,46,46,194,251,111,191,164,159,34,162,58,166,40,166,211,79,253,83,240,244,191,255,139,123,238,188,74,191,4,
+239,188,251,53,110,187,237,10,20,212,227,147,9,137,168,230,248,7,4,32,44,44,2,135,14,238,215,79,17,209,121,234,213,119,16,242,243,115,177,121,195,58,253,84,189,137,142,141,195,222,237,59,225,8,116,0,0,
+190,248,98,17,46,189,116,12,220,238,11,123,106,175,167,234,222,171,31,156,254,1,216,183,103,7,14,31,60,160,159,38,34,242,8,229,71,148,148,31,229,82,29,213,58,220,196,85,82,130,165,139,23,112,243,234,2,
+133,133,69,224,226,201,23,33,40,56,68,63,69,68,245,196,110,247,195,196,209,67,244,195,120,238,133,247,113,199,29,87,113,243,138,200,135,104,154,134,172,172,76,253,48,17,93,128,192,160,96,140,24,57,25,193,
+33,161,250,169,122,51,106,236,180,138,205,43,0,248,122,222,92,159,221,188,2,128,53,171,150,99,201,162,249,220,188,34,175,22,17,21,141,153,87,223,138,246,157,186,234,167,232,60,57,156,78,143,58,164,255,
+204,115,136,171,75,5,240,136,126,144,106,151,91,74,225,114,43,216,188,113,13,10,11,11,244,211,68,84,135,20,165,236,66,84,77,115,99,223,225,163,48,41,65,104,222,52,1,170,69,197,19,255,122,19,247,255,253,
+58,148,20,23,235,63,140,8,56,253,196,158,144,208,48,184,221,165,62,253,166,200,215,56,28,78,248,57,28,200,203,203,213,79,17,209,121,74,75,61,134,204,172,83,56,158,114,212,99,190,30,14,29,54,14,81,97,209,
+248,101,249,239,248,223,251,31,99,213,202,159,80,92,92,132,226,226,170,31,62,76,68,117,75,211,220,8,143,136,132,171,184,4,41,199,60,235,194,25,179,217,12,69,81,170,245,212,234,250,54,245,146,171,112,207,
+93,15,225,187,239,102,123,204,215,230,11,81,173,91,8,137,136,26,130,110,61,251,34,33,177,9,190,254,242,35,104,154,86,113,155,33,145,158,170,170,24,56,100,20,102,92,114,53,150,255,186,20,31,190,251,138,
+79,188,56,32,34,242,5,22,171,21,16,129,203,229,2,0,36,36,53,66,211,102,173,176,116,241,2,253,82,34,162,191,212,190,83,87,164,28,59,140,83,39,78,232,167,60,78,179,22,173,241,224,3,255,194,140,139,71,96,
+253,250,93,24,48,184,59,138,10,11,97,179,219,171,245,4,65,79,195,43,176,136,106,64,76,108,60,166,95,118,61,70,143,157,10,155,159,13,135,14,236,245,170,157,249,134,72,81,76,21,87,95,157,57,6,8,82,142,30,
+198,142,109,155,32,34,21,247,104,115,175,159,254,140,136,32,253,212,9,244,235,63,12,22,171,13,43,126,89,4,77,227,102,39,17,145,39,208,220,238,74,95,147,115,115,114,112,244,240,1,126,157,38,162,106,11,14,
+14,65,76,92,2,246,239,219,227,241,95,67,154,36,55,195,170,101,43,208,179,119,123,40,38,19,34,194,130,16,26,145,140,139,46,158,137,67,71,14,32,229,216,17,253,135,120,13,94,129,69,116,129,186,247,234,135,
+111,103,127,137,200,216,240,138,177,87,223,248,28,119,223,49,139,151,168,123,169,178,205,173,178,219,11,53,77,120,245,149,15,48,169,42,84,85,133,171,164,68,63,117,65,130,67,66,225,244,15,64,113,81,33,242,
+114,115,80,228,197,63,209,242,86,73,141,154,226,186,27,239,198,59,255,123,1,251,246,236,210,79,19,17,17,17,93,176,224,144,80,4,4,4,226,200,225,131,250,41,143,147,220,188,37,214,172,88,133,224,240,192,74,
+227,135,246,167,160,115,247,142,200,204,72,175,52,238,77,170,117,136,59,17,25,61,246,208,211,149,54,175,0,224,230,27,46,198,164,139,174,168,52,70,222,163,236,96,193,178,131,158,185,121,229,253,2,2,2,209,
+170,117,59,253,112,141,240,243,115,64,115,187,113,234,228,9,110,94,213,147,18,87,49,102,93,58,25,223,206,153,135,30,125,6,192,100,226,75,27,34,34,34,170,57,86,155,13,249,121,121,94,177,121,5,0,123,119,
+239,68,191,161,131,241,253,119,43,42,141,255,227,177,199,235,117,243,74,85,213,11,126,157,118,97,31,77,68,56,149,145,165,31,2,0,204,152,122,169,126,136,188,72,217,38,22,47,80,245,118,109,59,116,198,210,
+159,127,195,247,95,125,135,135,30,121,1,3,135,140,172,209,39,192,166,166,28,69,106,202,81,253,48,213,161,212,99,71,209,174,83,59,124,183,112,9,126,158,63,15,125,7,12,211,47,33,170,119,109,218,119,194,236,
+217,139,208,184,105,51,253,84,181,60,253,239,183,48,114,236,100,253,48,17,17,213,146,248,132,36,140,26,59,21,154,230,93,103,156,110,219,188,1,115,190,157,3,0,248,241,135,223,240,232,19,175,96,223,158,29,
+250,101,117,166,87,223,65,184,230,134,187,97,247,243,211,79,85,155,48,198,206,191,123,238,127,82,52,205,109,104,217,146,117,134,181,140,85,167,225,163,39,200,220,185,63,203,125,15,60,35,65,193,193,134,
+121,246,215,181,108,221,78,86,44,223,32,165,46,151,104,154,91,74,93,46,233,220,173,151,97,29,243,141,186,247,234,39,113,9,137,134,113,198,234,187,94,253,6,201,222,93,135,100,197,47,27,164,125,199,46,134,
+249,191,74,85,85,153,121,245,173,114,228,64,138,44,94,180,90,58,117,237,97,88,195,24,99,172,230,11,143,136,148,228,102,45,13,227,158,156,162,152,4,128,68,70,69,75,183,158,125,69,85,85,195,154,186,174,81,
+147,100,105,217,166,157,152,46,252,255,139,97,128,49,86,141,174,184,250,86,209,52,183,252,190,118,187,252,190,110,71,197,6,214,140,153,55,24,214,50,86,149,172,86,155,60,248,200,127,42,109,136,174,249,109,
+171,116,232,220,205,176,150,157,189,242,111,222,22,139,69,222,120,235,11,209,52,183,188,249,223,217,226,231,231,103,88,203,24,99,181,153,73,85,229,250,91,238,19,77,115,203,241,99,39,164,73,114,51,195,154,
+115,101,177,90,229,210,153,55,74,159,254,67,100,244,248,169,242,192,35,207,75,207,62,3,12,235,24,99,172,33,164,40,138,0,16,135,195,33,161,225,17,134,121,230,211,25,6,24,99,213,168,99,151,238,114,249,172,
+91,36,52,44,92,2,2,131,228,186,155,254,46,111,188,245,5,175,2,96,213,174,124,195,101,230,233,77,81,125,139,22,254,102,248,24,118,246,20,197,84,241,83,158,158,125,6,202,190,93,135,36,169,113,83,195,58,198,
+24,171,139,70,142,157,44,154,230,150,226,252,194,11,190,130,202,225,112,74,116,76,172,97,156,177,250,206,108,54,27,198,24,171,141,98,227,19,100,229,242,141,146,122,52,77,166,95,126,189,132,134,133,27,214,
+48,159,204,48,192,234,57,85,85,249,197,159,177,6,90,88,120,132,28,61,152,106,216,188,210,52,183,92,123,227,61,134,245,236,220,41,138,82,177,49,24,28,18,106,152,103,140,177,186,232,134,91,239,147,237,91,
+246,202,63,30,122,86,218,157,199,45,132,140,121,67,87,92,125,171,108,250,125,167,244,234,59,208,48,199,88,77,119,203,237,15,84,122,157,124,50,245,148,140,28,59,217,176,142,249,86,42,128,71,244,135,98,81,
+253,211,52,62,249,172,54,89,173,86,76,152,114,41,122,247,29,130,184,132,68,148,150,186,144,149,153,121,250,207,197,249,83,20,69,63,68,84,45,131,134,142,198,245,215,95,169,31,198,202,229,155,112,207,61,
+55,162,212,229,210,79,209,95,40,251,115,41,40,42,42,212,79,145,7,8,9,11,71,231,110,61,113,228,208,1,253,20,145,207,200,207,207,193,236,185,95,96,238,236,15,113,226,120,170,126,154,200,39,4,133,4,163,216,
+165,98,253,186,149,56,117,50,77,63,77,84,163,52,41,197,101,151,76,135,197,106,1,0,28,57,148,134,255,189,243,38,78,158,56,174,95,74,53,72,81,76,232,208,169,43,90,180,110,135,146,146,98,228,229,230,232,151,
+212,58,195,174,22,171,223,202,175,22,96,181,151,213,102,147,59,238,121,76,242,178,114,69,211,220,242,235,138,141,98,179,217,12,235,24,171,235,186,116,239,45,155,55,238,150,35,7,83,100,213,202,77,82,144,
+147,47,191,44,93,47,113,241,188,37,149,121,70,170,170,74,235,118,29,196,106,181,26,230,206,167,150,173,219,201,241,163,39,228,255,30,126,78,130,67,66,12,243,140,121,83,254,254,1,18,17,25,101,24,47,79,81,
+76,124,157,199,24,99,23,88,249,215,209,193,195,199,202,238,29,7,100,215,246,253,146,220,220,187,14,90,247,214,20,197,36,205,91,182,145,228,230,173,36,40,184,94,94,183,25,6,88,61,86,254,194,134,47,110,106,
+191,9,83,102,72,65,78,190,228,100,100,203,136,49,147,12,243,140,213,87,141,154,36,75,167,174,61,164,107,143,62,50,110,210,116,137,140,138,22,112,115,155,121,72,77,146,155,203,247,223,45,151,54,237,59,25,
+230,206,39,139,213,42,227,167,204,144,13,235,119,200,85,215,254,141,159,231,204,171,27,57,118,178,140,159,60,221,48,206,24,99,172,102,43,127,189,144,220,188,165,180,104,213,182,210,24,243,221,202,238,171,
+160,122,23,18,26,6,139,197,130,19,105,222,113,201,99,151,110,189,160,154,45,88,179,234,23,253,148,87,105,223,169,43,92,174,18,236,216,186,89,63,69,84,239,108,118,59,138,139,138,0,0,38,147,137,183,22,147,
+71,232,217,119,32,94,126,238,85,124,241,245,183,120,233,63,143,86,124,142,94,168,160,224,96,244,31,52,18,75,23,207,71,110,61,92,142,78,116,161,226,19,27,97,226,228,203,241,245,220,15,113,244,240,65,253,
+52,17,17,213,48,69,49,65,164,236,245,241,153,127,237,137,84,85,133,219,237,214,15,83,53,241,12,172,122,166,40,38,0,130,169,23,95,133,111,102,127,129,99,39,115,113,228,240,62,20,213,208,27,130,218,16,17,
+21,141,161,35,38,97,199,182,141,72,63,117,82,63,237,85,210,142,167,224,212,9,222,163,79,158,201,93,90,10,84,124,157,0,127,222,208,128,149,127,175,0,128,224,224,144,122,253,30,49,126,210,165,104,148,144,
+132,31,22,126,135,189,123,118,84,124,158,94,168,226,162,34,236,222,185,21,46,151,139,159,235,228,149,92,37,37,216,186,121,29,78,242,117,5,17,81,29,41,123,189,224,233,155,87,0,208,190,99,87,196,39,54,130,
+211,233,68,113,81,17,92,174,18,253,18,170,130,242,119,69,84,207,52,205,141,240,232,80,124,244,222,171,248,125,245,38,124,244,241,60,4,4,4,234,151,213,187,128,192,64,116,239,209,15,191,175,91,129,125,123,
+118,234,167,137,136,168,134,149,191,40,75,106,220,20,111,254,119,54,182,109,222,129,87,94,251,4,33,33,161,250,165,181,78,81,76,56,116,104,47,30,124,244,62,124,51,231,147,26,187,250,234,76,158,254,2,148,
+232,108,10,11,11,144,147,147,173,31,38,34,242,8,14,167,19,35,199,78,134,211,223,95,63,229,245,188,225,181,195,222,221,59,16,18,18,134,75,47,191,17,35,198,76,214,79,83,21,113,3,171,222,149,237,26,23,23,
+23,87,140,52,74,142,195,140,233,35,17,24,28,124,198,58,207,16,21,29,135,210,82,23,214,172,90,206,75,32,137,234,136,136,230,21,223,152,169,118,136,104,232,216,165,59,86,44,89,142,107,175,158,140,152,248,
+8,220,116,195,197,232,63,120,148,126,105,173,19,209,48,239,235,207,177,250,215,101,250,41,34,34,34,242,96,125,251,15,197,252,111,103,99,216,200,137,250,41,170,3,249,249,121,88,183,122,5,54,110,90,131,172,
+172,116,253,52,85,17,55,176,234,157,2,0,136,142,142,3,0,156,76,77,199,218,213,219,241,219,175,91,160,185,61,239,13,235,254,189,187,240,227,252,175,245,195,68,84,203,20,197,132,22,173,219,250,228,79,205,
+232,220,20,69,193,91,175,190,131,184,196,168,138,177,188,172,60,100,103,103,84,90,71,68,68,68,103,167,170,42,130,131,67,208,127,240,8,116,236,210,67,63,237,211,98,98,227,113,219,77,119,3,0,222,120,225,
+121,12,30,62,86,191,132,234,64,86,86,38,190,249,242,99,252,188,112,158,126,138,170,136,103,96,213,51,69,41,59,71,223,207,233,192,193,195,25,248,219,29,55,226,149,87,159,199,7,31,190,141,204,12,207,219,
+153,21,225,185,36,158,162,99,151,238,24,52,108,44,14,31,220,135,226,226,154,191,141,135,60,203,136,209,19,176,98,201,34,236,59,146,142,141,191,175,70,147,228,230,208,220,110,254,183,111,32,196,236,192,
+184,49,195,0,0,69,121,133,120,241,141,143,177,224,251,47,145,199,195,206,137,136,136,170,164,85,155,246,72,108,212,20,174,146,98,236,221,181,189,65,189,134,234,217,123,0,156,1,33,248,232,147,217,40,113,
+153,144,16,223,24,63,254,192,139,18,200,59,25,30,77,200,234,54,69,81,12,99,140,157,171,198,77,155,201,225,3,41,162,105,110,89,48,127,165,4,6,6,25,214,48,223,169,105,179,22,178,120,209,106,201,203,202,149,
+163,135,82,229,31,15,61,43,175,190,254,169,36,53,110,98,88,203,124,183,105,211,103,73,113,65,161,28,59,124,92,122,245,29,104,152,247,214,172,54,155,116,232,212,77,84,179,217,48,199,24,99,140,213,84,54,
+187,93,84,85,53,140,55,132,44,86,171,152,207,248,62,27,20,28,98,88,195,152,55,196,43,176,60,204,153,79,154,242,4,1,129,65,112,58,253,81,84,88,168,159,162,122,52,110,226,116,228,230,149,66,209,84,244,31,
+216,9,233,217,110,172,90,185,68,191,140,124,64,96,80,48,166,94,116,21,126,92,60,31,207,191,240,31,52,105,218,30,55,223,56,29,207,254,231,5,252,186,156,255,205,171,34,56,56,4,170,217,12,87,137,119,63,237,
+101,251,214,13,216,180,125,47,78,101,22,97,206,236,15,80,226,229,255,60,229,108,118,59,254,245,244,107,152,52,105,58,86,173,90,198,171,202,136,136,168,86,184,75,75,27,236,221,36,154,219,13,77,251,227,120,
+154,218,120,8,11,81,93,40,187,127,141,232,79,152,76,38,124,249,229,98,244,238,209,22,87,94,127,35,126,156,247,21,15,146,246,16,161,225,225,80,77,42,58,116,238,129,31,190,155,131,207,103,47,194,165,51,70,
+235,151,145,15,80,85,21,14,135,19,185,167,223,212,59,156,78,188,246,218,39,152,251,205,103,248,118,238,167,250,229,244,39,66,194,194,16,29,29,135,227,169,199,60,242,214,108,2,146,26,55,197,203,47,188,131,
+216,232,112,92,62,107,58,118,108,219,172,95,66,68,68,4,127,255,0,180,104,221,22,154,166,65,115,107,232,221,119,40,126,91,181,4,27,214,253,166,95,74,68,62,136,27,88,244,167,218,182,239,132,233,151,94,15,
+139,197,130,171,47,157,136,148,227,25,232,222,179,3,10,11,11,244,75,169,30,53,106,146,140,142,157,123,98,205,111,203,144,114,244,136,126,154,60,196,149,215,254,13,57,217,153,152,251,197,7,250,169,243,226,
+112,56,224,214,52,254,244,172,138,20,197,132,184,132,68,100,103,101,32,55,135,87,247,120,178,105,211,175,194,169,83,105,88,178,104,190,126,138,136,136,8,189,250,14,196,202,95,126,130,219,85,118,69,145,
+197,102,193,208,17,227,241,243,34,30,138,77,212,16,212,216,6,150,205,102,131,197,98,69,94,94,110,197,88,114,243,150,200,205,201,70,218,241,212,74,107,201,243,77,191,252,122,252,239,149,231,48,110,234,197,
+200,207,207,69,80,80,40,22,253,240,45,175,192,34,170,134,224,144,80,60,249,244,235,184,225,218,169,16,77,195,164,139,174,224,85,83,68,68,68,68,231,41,60,34,18,191,175,217,136,248,164,178,39,243,186,138,
+92,104,209,182,13,14,238,223,167,95,74,68,181,204,233,239,143,226,162,34,148,150,150,234,167,106,149,225,96,172,170,230,239,31,32,45,219,180,147,22,173,218,202,199,159,204,151,126,3,135,85,154,191,247,
+255,158,150,222,253,6,139,162,40,98,177,90,13,31,207,60,55,69,81,36,42,58,198,48,206,24,171,90,1,129,65,178,120,225,106,209,52,119,165,94,125,227,51,9,143,140,52,172,103,140,49,198,24,99,127,93,223,1,67,
+165,56,191,80,52,205,45,71,14,164,120,252,129,228,102,179,89,156,78,127,195,56,99,222,158,217,98,17,69,49,25,198,107,51,147,126,55,171,58,58,119,239,141,181,43,86,98,193,183,11,208,163,115,107,236,217,
+181,189,210,124,104,72,24,134,13,159,128,217,179,23,225,243,207,126,168,52,71,158,77,68,144,118,60,21,201,205,91,98,232,200,241,250,105,34,250,11,49,113,241,24,60,180,43,112,250,207,83,185,17,3,123,194,
+110,247,59,99,37,17,17,17,17,85,133,162,152,176,98,217,98,12,31,63,9,169,71,79,194,238,103,133,156,113,56,185,167,106,168,135,199,251,58,179,197,2,135,211,169,31,110,48,74,93,174,58,191,67,235,130,158,
+66,152,151,155,131,245,91,118,97,197,111,107,240,252,11,207,224,224,254,189,149,230,155,181,108,139,91,174,157,137,158,189,219,97,209,79,191,226,135,5,95,85,154,39,207,247,242,75,239,35,62,190,49,255,219,
+17,85,83,118,86,38,142,165,21,96,236,232,161,80,20,5,0,240,229,151,63,97,220,196,97,56,145,118,92,191,156,136,136,136,200,103,41,138,233,244,235,161,11,219,200,81,20,5,138,2,28,220,191,23,239,125,248,30,
+142,167,23,96,239,158,237,200,207,207,211,47,245,24,154,166,193,229,114,233,135,235,76,112,72,8,74,92,46,110,162,213,32,139,213,10,167,195,89,241,26,95,53,153,96,54,155,225,118,187,245,75,169,22,24,46,
+203,58,223,20,69,169,244,235,55,255,247,165,164,167,165,203,228,139,46,23,147,169,110,47,45,99,23,94,251,78,93,229,158,127,60,37,141,154,36,27,230,24,99,85,107,252,228,25,114,42,45,93,30,123,226,21,222,
+74,205,24,99,213,200,98,181,138,170,170,134,113,214,176,50,153,76,18,26,22,46,33,161,97,18,25,21,45,54,187,221,176,134,121,110,38,147,73,252,253,3,12,227,23,146,254,150,37,253,175,61,45,139,213,42,97,225,
+17,134,241,186,40,44,34,66,238,184,231,81,153,52,237,50,195,28,251,243,20,197,36,65,65,193,231,252,30,100,181,90,37,48,48,72,108,54,155,168,170,42,118,187,159,56,253,121,155,104,29,101,24,168,118,138,98,
+50,108,94,1,144,169,151,92,41,3,6,143,48,140,51,239,104,224,208,81,146,144,212,216,48,206,24,171,94,141,155,54,171,120,113,229,233,47,178,152,103,167,154,205,134,49,198,124,177,176,136,72,185,234,218,219,
+37,33,169,145,97,142,121,119,201,205,91,202,109,119,62,36,97,17,85,59,15,210,108,177,72,82,227,166,18,21,19,43,254,254,1,98,58,203,27,202,134,154,245,244,15,199,28,78,167,88,44,22,195,124,125,55,112,200,
+40,249,237,215,205,210,177,115,119,195,92,67,201,207,207,33,173,219,117,52,140,215,69,157,186,244,144,252,236,60,89,185,98,227,89,55,99,152,49,139,213,42,102,243,95,159,239,84,182,15,98,92,99,230,235,181,
+218,204,48,192,24,99,172,6,210,127,67,83,20,197,48,198,88,85,27,53,110,170,236,217,121,80,158,122,230,77,9,175,226,27,63,198,60,177,160,224,16,233,218,163,183,97,252,204,252,252,252,36,33,177,145,216,108,
+54,195,28,243,204,154,183,104,45,189,251,13,54,140,87,90,211,178,181,28,57,152,42,159,127,254,163,216,237,126,134,121,86,189,76,38,147,4,4,6,9,0,9,10,14,246,200,171,211,134,142,28,47,154,230,150,180,99,
+39,165,93,199,46,134,121,95,46,46,33,81,110,184,229,62,249,191,135,158,149,49,19,46,50,204,215,69,14,167,83,190,251,246,23,185,225,150,251,12,115,172,246,226,221,103,181,154,97,128,49,198,88,13,198,77,
+43,118,161,197,198,39,200,150,77,123,36,55,51,71,174,190,225,46,113,56,156,134,53,140,121,114,170,170,138,195,89,246,121,219,161,115,55,201,78,207,150,247,222,255,70,226,19,121,133,149,47,20,26,22,46,143,
+63,253,186,220,113,207,99,134,185,242,236,118,63,249,246,155,101,242,237,55,203,36,52,44,220,48,207,124,51,179,197,34,119,221,251,184,104,154,91,14,238,61,42,14,135,195,176,198,87,107,217,186,157,164,30,
+77,147,147,169,167,164,85,155,246,134,249,218,174,252,245,167,127,64,128,56,28,142,63,189,99,138,49,111,235,194,79,210,35,34,175,215,166,125,39,28,62,176,15,185,185,57,250,169,6,201,108,54,195,63,32,16,
+97,97,17,240,115,58,177,125,203,70,104,94,240,132,27,242,93,221,123,245,195,148,41,87,224,221,119,94,194,206,237,91,244,211,68,30,207,63,32,0,95,207,89,140,183,63,124,27,46,87,9,62,251,224,45,152,204,42,
+230,207,255,21,215,221,112,41,82,142,30,214,127,8,121,17,187,221,142,164,198,201,72,79,63,137,83,39,210,244,211,0,128,128,128,64,12,26,62,22,75,22,126,207,215,27,13,80,143,222,3,16,23,159,132,249,223,126,
+129,162,162,34,253,180,79,50,153,76,232,220,173,23,220,238,82,108,88,183,90,63,77,68,231,201,176,171,213,80,139,141,79,144,208,122,58,96,143,177,250,200,102,179,203,205,127,251,63,249,234,171,37,18,21,
+29,99,152,111,168,197,198,37,200,213,55,220,37,235,214,108,151,7,30,121,158,151,1,179,122,143,159,131,172,54,75,72,106,44,141,154,36,215,234,217,66,170,170,202,83,255,126,75,92,197,37,226,42,46,17,77,115,
+139,166,185,229,167,69,171,37,50,42,218,176,158,49,198,106,187,230,173,218,200,196,169,151,73,112,104,168,97,142,49,118,238,172,54,91,189,220,101,162,2,120,68,191,163,213,80,117,234,210,19,163,199,94,132,
+198,77,155,35,43,43,3,57,217,89,250,37,68,62,35,58,38,22,151,92,118,29,46,158,52,25,255,124,234,65,94,213,113,134,130,130,124,56,252,157,72,61,153,129,143,222,123,5,121,185,185,250,37,116,90,112,112,8,
+236,126,14,20,21,21,234,167,128,211,143,205,46,251,126,67,23,226,92,143,190,110,213,182,3,218,182,239,140,140,244,147,40,46,46,214,79,19,253,165,142,93,122,96,234,212,43,209,186,93,39,164,165,29,67,118,
+86,166,126,201,5,19,17,44,249,105,30,162,226,90,163,123,247,182,216,185,237,0,166,93,122,25,254,249,216,253,200,207,203,211,47,39,34,170,117,163,198,78,195,39,239,191,129,166,77,187,98,213,111,203,144,
+155,147,173,95,66,68,103,161,105,2,145,63,238,80,81,20,19,84,213,116,206,215,172,53,197,176,171,213,80,51,153,76,210,184,73,51,233,55,104,152,52,73,110,110,152,103,204,151,106,217,186,157,12,30,54,186,
+222,30,235,203,188,63,155,221,46,143,62,241,138,108,219,188,247,79,159,56,91,118,104,61,207,91,168,173,20,197,36,215,221,252,119,41,202,47,20,77,115,203,154,85,91,164,93,135,206,134,117,140,85,165,132,
+164,70,146,220,172,165,56,157,181,251,24,112,135,195,41,131,134,141,230,85,87,140,177,122,207,225,112,200,208,145,227,100,201,207,235,228,251,239,126,145,216,248,68,195,26,198,88,213,58,219,19,25,107,58,
+158,129,69,84,15,186,247,234,135,130,130,124,108,221,244,187,126,138,200,227,41,138,9,14,135,3,141,155,54,195,187,255,253,8,93,186,181,68,110,102,30,186,245,233,133,221,59,183,235,151,67,81,20,0,74,165,
+159,210,208,133,235,222,171,31,62,251,224,99,216,237,54,100,102,230,160,101,155,198,248,254,251,21,184,236,178,241,60,95,166,6,140,155,116,9,58,116,232,142,117,235,86,224,135,239,231,234,167,169,6,168,
+170,106,248,9,46,17,81,93,139,142,141,195,200,49,83,241,219,175,63,99,231,54,222,145,64,228,201,76,250,1,34,170,93,14,135,3,47,63,255,26,254,118,235,63,96,50,241,143,32,121,31,135,195,129,22,173,218,34,
+60,34,26,165,165,110,0,128,221,207,10,155,221,79,191,20,64,217,173,67,124,131,90,243,14,31,220,135,171,174,191,22,99,38,141,199,208,145,3,113,253,205,247,194,233,240,67,92,66,146,126,41,157,7,151,171,4,
+162,105,136,138,138,215,79,81,13,113,187,221,252,218,64,68,245,238,120,202,49,188,247,223,23,61,126,243,202,108,54,163,81,147,100,132,134,133,195,225,116,234,167,137,206,42,49,169,49,66,195,194,245,195,
+94,137,87,96,17,213,49,85,85,241,196,191,222,64,98,108,28,102,204,24,173,159,174,21,138,98,66,64,96,32,114,115,178,235,228,190,100,242,109,138,98,66,80,112,48,194,34,34,112,199,237,15,227,146,201,35,240,
+208,83,207,227,205,87,158,134,219,93,182,161,69,245,35,34,42,10,89,153,153,112,149,148,232,167,136,136,168,158,68,68,70,225,198,91,238,199,15,63,204,197,154,95,127,209,79,19,85,137,213,102,67,179,230,173,
+16,22,30,137,99,71,15,97,223,158,93,250,37,68,6,201,205,91,97,195,234,53,56,112,48,21,163,198,13,197,49,47,127,234,47,55,176,136,234,65,120,68,36,28,14,39,14,31,58,160,159,170,21,138,98,130,127,64,0,242,
+114,115,249,211,110,170,81,173,219,117,132,191,127,32,182,108,92,135,194,194,2,253,52,213,178,178,67,242,203,240,207,54,17,145,103,250,199,67,207,226,241,71,238,64,126,118,62,70,79,158,138,229,75,22,234,
+151,16,85,153,159,159,31,138,138,138,249,125,159,254,82,112,72,40,174,187,241,30,140,29,62,28,209,81,161,120,247,147,217,120,229,197,39,188,250,129,5,220,192,34,34,34,34,34,34,170,37,219,54,239,69,211,
+166,113,56,158,154,142,35,199,78,224,162,233,227,144,154,114,76,191,140,8,0,16,16,16,136,192,224,16,164,28,61,204,59,39,232,130,116,238,214,11,241,9,141,48,239,155,47,96,181,217,48,102,252,69,72,79,63,
+129,37,139,230,235,151,122,13,110,96,17,17,81,173,82,20,19,127,74,72,68,68,13,82,104,120,56,214,174,92,143,155,238,188,29,63,47,154,135,110,61,251,226,68,90,42,246,238,218,161,95,74,4,0,184,98,214,173,
+120,228,254,123,208,165,71,39,100,102,164,235,167,137,46,136,191,127,0,242,242,114,245,195,94,67,5,240,136,126,144,136,232,66,217,253,252,144,144,212,24,217,89,153,250,41,106,64,254,184,197,173,236,103,
+37,22,139,5,154,198,205,44,34,170,89,170,170,158,126,170,33,191,190,144,103,49,41,38,108,218,177,11,75,22,207,135,171,164,4,71,14,29,64,70,250,41,253,50,34,224,244,121,105,143,60,240,56,18,226,34,145,153,
+175,193,108,86,113,244,240,65,253,50,162,106,43,123,77,46,40,169,161,115,82,219,182,239,140,169,23,95,133,61,187,183,161,168,168,80,63,93,107,184,129,69,68,181,162,123,239,254,152,243,217,28,52,109,222,
+25,59,119,109,65,86,102,134,126,9,249,184,242,205,43,17,13,113,241,137,184,225,230,123,241,194,191,95,68,9,204,56,176,127,23,138,139,138,244,31,66,68,116,94,122,246,29,136,41,211,174,196,250,117,43,161,
+213,224,195,36,236,118,59,66,195,35,144,159,151,167,159,34,31,96,179,217,49,116,196,88,52,106,146,140,3,251,118,235,167,107,132,203,85,130,253,123,119,213,232,231,37,1,113,9,73,152,114,209,76,148,150,150,
+224,228,137,19,62,113,83,145,162,40,248,199,131,255,198,204,43,38,192,225,244,195,144,254,189,177,109,247,17,172,95,179,130,183,18,82,13,168,217,207,161,54,237,59,225,173,151,158,67,155,182,189,177,114,
+213,82,228,230,228,232,151,212,10,110,96,17,81,173,112,187,75,145,95,108,194,216,225,67,96,177,7,97,249,47,139,244,75,200,199,41,138,2,17,13,137,141,26,227,187,175,126,192,101,151,78,64,76,108,56,38,140,
+27,1,183,4,99,201,79,243,244,31,66,68,116,94,20,0,5,69,249,56,124,112,95,141,190,209,11,13,11,199,170,229,107,176,115,223,1,236,219,179,19,221,122,246,197,204,171,110,69,155,246,157,177,126,205,74,253,
+114,242,50,49,113,241,184,237,230,251,80,82,234,198,218,213,203,245,211,228,193,2,2,2,48,102,236,69,232,218,173,15,126,89,250,35,74,75,93,250,37,94,199,108,54,227,181,23,95,70,104,120,16,20,69,129,230,
+114,227,161,71,30,64,234,177,163,250,165,68,245,46,51,227,20,142,157,204,69,68,68,52,156,129,33,56,116,112,15,10,10,242,245,203,106,133,48,198,88,109,21,18,26,38,77,155,181,48,140,179,134,211,128,33,35,
+69,211,220,127,228,46,149,127,61,251,63,195,58,198,24,243,196,46,191,234,102,73,79,203,144,37,63,173,21,87,73,137,104,154,91,174,187,233,239,134,117,204,59,11,14,14,17,155,205,110,24,103,158,159,159,195,
+33,137,141,154,136,162,152,12,115,222,218,128,33,35,229,248,209,19,162,105,110,249,199,67,207,138,201,228,59,255,108,204,55,179,251,249,201,144,17,227,164,125,199,46,134,185,170,22,18,26,38,241,9,73,18,
+22,17,41,102,179,217,48,127,102,60,196,157,136,136,106,149,191,127,0,254,249,228,171,184,226,226,177,88,188,116,45,94,124,245,95,216,177,117,35,50,51,120,91,41,17,121,135,255,190,61,7,87,95,53,17,162,9,
+38,76,189,20,223,127,253,185,126,137,79,176,88,173,112,213,208,249,40,68,84,61,229,15,189,105,146,220,12,221,122,12,192,194,5,95,241,16,119,106,16,98,98,227,224,31,16,132,210,210,82,164,28,61,132,226,226,
+98,253,146,10,220,192,34,34,162,90,83,254,98,44,48,48,8,113,137,141,144,114,228,16,178,179,179,42,205,17,17,121,186,152,184,120,188,242,210,251,120,231,131,55,48,239,155,217,250,105,159,225,239,31,128,
+162,162,66,148,150,150,234,167,136,168,150,241,117,17,209,95,227,6,22,17,17,213,42,253,11,50,69,81,0,148,157,143,69,68,68,158,79,81,76,24,48,120,56,218,182,235,138,217,159,189,141,180,227,169,250,37,68,
+84,67,206,124,8,14,17,85,86,254,124,115,34,34,162,90,33,162,65,81,76,21,113,243,138,136,200,187,68,199,198,161,255,128,145,232,219,179,47,6,13,29,11,155,221,174,95,66,13,92,217,15,167,168,38,136,104,124,
+157,68,116,22,124,10,33,17,17,213,1,253,25,140,68,68,228,45,92,37,197,56,116,104,47,214,174,95,133,102,205,219,66,160,225,216,145,67,250,101,212,64,245,29,56,20,157,186,244,196,137,180,20,20,21,22,234,
+167,137,136,106,12,111,33,36,162,74,156,78,127,132,71,70,225,216,145,67,60,3,131,136,136,136,42,9,14,14,129,136,84,156,103,72,20,19,27,7,139,213,134,212,99,71,225,114,241,33,0,68,84,123,120,11,33,17,85,
+50,124,244,36,92,115,237,157,112,250,7,232,167,136,136,136,168,129,203,202,202,228,230,21,85,146,154,114,12,135,15,238,231,230,213,5,80,85,21,161,97,225,48,153,248,246,156,232,92,248,39,132,136,42,41,46,
+42,196,166,205,107,145,151,155,163,159,34,34,34,34,31,101,177,88,160,154,205,250,97,162,10,195,70,142,199,136,49,147,244,195,84,3,70,142,157,130,239,191,89,140,38,201,205,245,83,68,116,6,110,96,17,81,37,
+243,191,251,18,95,126,246,30,220,110,183,126,138,136,136,200,39,132,134,135,163,69,171,182,250,225,6,45,54,62,17,254,188,250,154,206,161,87,239,193,120,253,133,151,184,137,85,195,26,53,73,198,75,255,126,
+22,25,153,57,72,59,158,162,159,38,162,51,112,3,139,136,136,232,2,4,6,6,233,135,136,200,131,41,138,9,79,63,253,6,222,124,245,61,56,28,78,253,116,131,117,234,100,26,10,10,242,245,195,245,74,53,155,17,27,
+159,160,31,166,122,208,169,107,15,108,221,182,1,187,247,28,198,205,215,221,142,160,160,96,253,18,58,79,131,135,142,195,234,245,219,112,245,117,151,32,55,135,119,64,16,157,11,55,176,136,136,136,170,32,185,
+121,75,92,124,233,53,8,14,14,1,0,4,6,5,225,227,143,231,161,223,160,225,250,165,68,228,193,20,5,72,140,139,69,255,129,157,208,171,223,96,253,116,131,149,159,151,7,87,137,103,156,97,164,154,205,232,213,119,
+16,190,158,251,51,46,186,228,26,253,52,213,3,77,211,240,203,146,5,184,116,230,36,220,245,247,27,81,200,167,13,214,152,149,203,23,226,190,251,111,70,90,106,10,20,133,111,207,137,206,133,79,33,36,34,34,170,
+130,136,168,104,244,27,48,28,167,78,166,161,164,164,8,87,94,113,51,154,52,74,192,229,51,167,240,146,127,34,47,211,161,83,87,124,55,247,91,44,94,186,26,179,174,226,237,80,158,196,108,54,99,218,244,89,104,
+150,220,26,191,254,250,19,86,44,91,132,162,162,34,253,50,34,159,163,40,38,136,104,250,97,34,58,3,55,176,136,136,136,170,33,40,56,4,91,55,108,195,218,13,59,113,217,229,227,80,144,239,89,183,220,16,81,213,
+196,39,54,194,191,255,245,58,238,189,255,102,28,62,184,95,63,77,85,48,96,200,72,52,107,214,22,31,189,247,74,141,109,50,41,138,130,240,200,72,156,76,75,211,79,17,17,81,3,167,2,120,68,63,232,105,172,86,43,
+146,26,55,69,169,203,133,146,146,98,253,52,17,17,81,157,41,46,42,194,146,21,203,241,209,71,255,69,14,31,37,95,107,252,28,14,68,69,199,162,168,168,16,26,31,42,225,181,70,140,153,140,25,151,93,143,126,3,
+134,225,240,225,125,200,206,202,212,47,169,55,57,217,89,216,189,111,39,74,93,46,100,101,102,232,167,169,10,186,118,239,131,247,223,126,25,86,191,104,100,101,167,35,55,39,187,70,94,171,243,7,3,68,228,171,
+2,2,131,208,166,109,71,228,230,102,123,204,109,219,222,70,60,189,70,77,146,229,209,39,94,150,126,3,135,25,230,188,33,69,49,137,170,170,134,113,198,24,99,140,85,46,177,81,99,185,253,238,71,229,151,165,191,
+203,206,109,251,165,115,183,94,134,53,190,150,162,152,68,81,76,134,113,111,78,85,85,185,248,210,107,228,208,254,99,146,118,236,132,228,103,231,201,203,175,126,44,209,49,177,134,181,204,187,27,55,121,186,
+28,61,152,42,71,15,165,74,211,230,45,13,243,140,49,198,254,200,207,225,144,14,157,187,73,203,214,109,37,32,32,208,48,207,206,157,87,156,18,231,42,41,193,145,163,135,96,182,88,244,83,94,201,106,179,241,
+128,62,34,170,81,252,154,66,190,32,54,62,1,139,230,255,140,231,159,121,0,61,186,181,66,243,86,73,8,14,9,213,47,243,57,190,122,230,201,230,77,107,49,98,220,40,116,238,217,13,29,186,117,195,251,31,188,10,
+77,243,205,127,86,111,103,179,219,97,50,157,223,247,145,239,230,126,138,91,238,185,7,155,182,236,197,161,3,251,244,211,68,68,116,134,194,130,2,28,220,191,23,77,147,91,35,44,60,82,63,77,127,129,103,96,213,
+49,69,49,193,100,82,224,230,237,16,68,84,131,204,102,51,220,110,205,103,223,8,83,195,224,244,247,199,203,47,127,136,43,46,31,139,162,188,34,124,58,103,33,254,113,255,77,56,121,194,55,207,194,233,208,169,
+43,122,245,25,138,249,223,125,142,195,135,14,232,167,233,2,152,76,38,12,25,49,14,233,39,211,240,251,186,223,244,211,164,227,112,56,80,226,114,161,212,229,210,79,157,149,195,225,196,165,51,111,196,178,37,
+11,176,123,231,54,216,108,54,20,23,95,248,237,131,68,68,190,78,85,85,68,68,70,35,43,51,3,69,69,124,162,103,117,112,3,171,142,149,95,37,193,55,153,68,116,62,18,146,26,35,49,169,49,210,211,79,98,231,182,
+45,250,233,90,151,220,188,37,28,14,39,182,109,217,200,141,120,170,21,1,129,129,24,62,106,18,2,131,66,48,251,147,183,145,151,151,171,95,82,167,2,2,2,113,217,149,55,35,39,39,19,243,191,155,141,204,140,116,
+253,146,243,246,193,135,223,225,178,75,71,227,100,106,6,38,79,191,4,43,127,249,73,191,132,206,147,201,100,194,195,255,124,9,162,105,120,228,193,219,244,211,84,3,226,226,19,113,232,192,62,124,251,221,114,
+76,158,60,88,63,77,68,58,201,205,91,194,98,177,98,199,182,205,250,41,34,170,34,175,56,196,221,151,40,138,194,205,43,34,170,54,179,197,130,254,131,70,96,241,188,249,184,229,150,235,17,28,156,132,111,190,
+254,12,34,117,251,51,8,135,211,31,99,39,204,64,124,98,18,82,83,143,162,176,160,64,191,132,232,188,41,138,9,197,197,69,216,177,109,19,54,174,255,13,37,30,112,184,169,106,86,17,29,27,15,155,221,129,189,123,
+182,215,232,231,124,94,97,62,38,142,30,139,144,136,32,244,233,222,15,239,188,251,95,148,150,150,234,151,209,121,16,17,108,218,184,26,187,119,111,171,209,77,71,250,131,171,164,4,254,193,73,216,182,107,59,
+86,173,248,89,63,93,163,84,85,173,243,239,119,231,195,108,54,163,91,207,126,72,75,77,225,237,178,100,208,161,115,119,60,241,200,191,145,148,220,6,86,187,13,7,246,237,225,181,36,68,231,193,112,48,22,171,
+253,226,226,19,37,48,48,200,48,206,24,171,94,254,254,1,18,19,23,111,24,215,231,237,15,82,232,218,163,143,28,216,123,68,62,253,116,129,220,125,223,147,210,171,239,64,195,154,186,106,240,176,49,242,216,147,
+175,202,160,97,163,13,115,140,93,104,190,118,152,249,95,213,169,75,15,89,181,98,147,100,167,103,75,92,66,162,97,158,177,186,206,110,247,147,184,132,36,9,8,12,148,128,192,64,113,250,251,139,217,98,49,172,
+171,139,6,12,25,41,15,255,243,69,137,137,253,235,239,243,158,208,224,225,99,228,134,91,239,51,140,123,114,87,93,123,187,204,188,250,86,195,56,171,249,90,183,237,32,203,150,172,23,183,219,45,175,191,249,
+185,215,191,54,101,172,158,50,12,176,90,46,46,33,81,214,174,222,38,131,134,242,205,31,99,23,154,195,233,148,132,164,198,134,241,51,235,216,185,187,124,251,205,50,175,222,52,14,8,8,148,132,196,70,162,40,
+138,97,174,62,10,10,10,150,192,160,96,195,56,243,174,18,27,53,17,63,63,63,195,56,171,219,84,85,149,70,77,146,197,206,255,22,204,3,138,75,72,148,39,159,121,83,190,251,118,153,108,92,191,83,222,123,255,27,
+137,138,142,49,172,171,205,18,147,26,203,43,175,125,34,199,14,165,202,243,47,188,39,193,161,161,134,53,158,86,66,82,99,249,228,211,5,210,189,87,63,195,156,39,22,18,26,38,119,254,253,159,178,127,207,17,
+185,236,202,27,13,243,172,230,123,240,209,255,200,143,63,172,146,129,67,70,137,211,233,111,152,103,140,253,117,231,247,184,17,186,32,87,92,121,11,68,4,123,118,111,215,79,17,81,53,116,238,214,19,173,219,
+118,196,145,51,14,63,182,88,173,149,214,0,64,215,238,253,48,118,92,95,244,25,48,12,161,97,225,250,105,175,144,155,155,131,35,135,15,122,204,45,20,217,217,89,200,201,206,210,15,147,23,105,213,182,61,46,
+189,252,6,4,135,134,233,167,168,142,185,221,110,28,220,191,23,69,133,60,200,149,234,223,177,35,135,241,250,171,79,227,183,245,235,112,44,245,36,222,122,251,69,164,159,58,165,95,86,171,70,141,187,8,35,6,
+247,193,77,119,222,133,191,223,115,45,178,50,50,244,75,60,138,162,152,112,223,125,79,34,46,58,2,219,54,255,174,159,246,72,17,145,81,200,200,56,133,254,131,251,226,163,247,94,215,79,83,45,216,183,111,23,
+30,254,231,253,88,250,211,2,228,231,231,233,167,137,168,138,12,187,90,172,118,82,20,147,12,29,57,94,30,254,231,139,18,27,159,96,152,175,235,98,227,19,164,115,183,158,134,113,198,188,161,168,152,88,73,79,
+203,144,244,180,12,105,221,182,131,52,73,110,46,175,191,249,185,12,29,49,174,210,186,9,83,102,200,198,245,59,101,243,134,221,146,147,145,45,235,215,110,175,243,159,36,51,230,137,61,240,200,243,178,246,
+183,173,210,190,83,87,195,28,243,188,20,197,36,161,225,17,245,118,43,23,107,120,5,5,135,72,88,68,164,97,188,182,83,85,85,46,187,242,38,175,250,218,164,40,38,185,229,246,7,101,216,168,9,134,57,198,244,53,
+180,91,229,89,245,179,88,173,98,177,90,13,227,140,87,96,213,41,139,213,130,226,162,34,60,247,204,3,72,57,122,68,63,93,167,252,252,252,48,116,196,68,180,106,221,73,63,69,228,241,20,69,193,187,255,251,2,
+33,17,65,8,137,8,194,199,239,125,134,143,223,159,141,235,175,157,138,226,226,162,74,107,67,66,35,224,116,218,177,255,208,49,152,76,38,196,199,70,32,54,46,177,210,26,242,28,29,58,119,195,204,171,111,67,
+80,112,136,126,138,106,216,198,141,171,1,5,232,221,119,168,126,170,78,149,63,157,151,206,45,48,40,8,51,175,186,21,81,81,49,250,41,162,90,145,157,149,137,244,147,39,244,195,181,206,237,118,227,163,247,94,
+195,230,13,235,160,40,138,87,124,141,16,209,240,202,11,255,196,162,5,223,232,167,136,12,248,64,47,250,43,45,90,181,69,84,116,172,126,152,78,51,236,106,49,223,110,240,176,49,242,225,71,223,203,251,31,124,
+43,19,166,204,144,32,158,99,195,188,40,139,213,42,183,220,241,160,104,154,91,74,93,46,41,45,113,137,166,185,69,211,220,242,228,191,222,48,172,7,32,173,219,117,148,199,159,122,77,166,77,191,74,66,66,195,
+4,128,132,132,120,254,121,26,181,81,163,198,201,18,159,144,100,24,247,132,90,182,110,39,199,143,158,144,162,252,66,25,61,126,154,97,158,213,124,225,17,145,127,121,134,92,109,213,170,109,123,185,253,238,
+71,37,184,129,254,89,172,110,102,139,69,174,188,230,54,105,213,166,189,97,142,49,198,24,99,190,147,127,64,0,175,184,62,123,134,1,230,195,77,154,118,185,184,74,74,68,211,220,114,242,248,41,121,230,185,255,
+201,224,225,99,196,223,63,192,176,150,49,79,44,42,38,86,10,114,242,69,211,220,82,82,84,92,177,121,165,105,110,25,62,122,162,97,125,121,229,135,101,182,104,221,86,6,12,30,33,115,230,252,36,19,166,204,48,
+172,243,229,252,252,28,242,236,127,222,149,143,62,158,39,145,81,209,134,249,250,238,178,171,110,150,226,252,66,209,52,183,28,59,116,220,171,110,31,97,213,175,123,175,126,178,122,213,150,42,61,69,148,149,
+101,181,217,196,108,54,27,198,25,99,140,177,179,101,182,88,164,77,187,142,210,163,207,0,9,13,11,23,171,205,38,54,187,221,176,142,213,127,35,198,76,146,97,35,199,139,127,0,223,155,159,45,21,192,35,250,75,
+178,200,55,53,105,214,28,243,231,206,133,159,191,31,0,192,110,183,65,209,204,56,146,146,134,99,199,14,33,59,43,19,0,16,27,159,136,89,215,222,129,216,248,4,236,221,189,29,154,198,203,92,201,115,148,20,23,
+225,183,223,55,163,71,231,158,136,136,14,69,73,97,9,126,94,178,30,207,189,248,26,190,251,234,19,148,150,186,79,127,125,171,204,229,42,65,88,120,4,250,13,24,137,39,31,254,39,126,89,245,27,150,45,253,1,167,
+78,164,233,151,250,44,63,63,63,104,16,236,217,183,11,251,246,238,244,168,3,163,7,13,27,141,27,175,190,25,119,253,227,62,172,89,183,29,147,39,142,64,171,230,157,241,201,167,239,241,107,144,143,58,118,244,
+48,118,239,223,135,163,135,14,24,110,253,165,63,231,118,187,249,231,129,136,136,170,165,75,247,222,88,248,253,60,220,112,205,44,252,244,203,175,200,205,201,66,82,227,100,164,29,79,209,47,165,122,164,40,
+38,180,105,223,25,55,94,115,43,82,79,166,33,45,245,24,74,74,74,244,203,72,191,163,213,208,115,56,156,210,166,93,71,105,146,220,220,48,231,237,205,188,250,86,57,114,48,69,118,111,63,32,219,183,236,149,221,
+219,15,200,255,222,153,43,3,135,140,148,192,160,32,49,155,205,50,116,228,56,249,242,203,197,82,152,87,32,154,230,150,47,102,47,146,240,122,56,192,179,33,230,244,247,151,196,164,198,18,159,216,136,143,181,
+175,66,177,113,9,114,195,173,247,75,191,129,195,42,141,159,237,96,204,242,113,139,213,42,205,90,180,54,204,179,250,173,123,175,126,114,241,101,215,84,252,122,248,168,9,114,217,85,55,241,106,19,198,24,99,
+231,204,102,179,73,96,176,40,199,112,0,0,255,244,73,68,65,84,45,29,135,161,242,123,16,243,129,194,35,35,229,147,79,23,136,166,185,229,218,155,238,17,0,124,125,229,193,197,196,198,203,77,183,253,67,134,
+142,28,111,152,107,104,57,253,3,36,34,178,242,94,132,114,250,47,8,128,211,233,143,142,93,123,160,105,211,86,216,189,123,43,126,91,177,84,191,196,107,41,138,9,161,97,97,176,90,109,0,0,171,205,10,147,73,
+69,102,70,58,178,179,178,32,162,33,38,54,30,107,86,174,65,92,82,84,165,143,237,211,127,40,86,173,88,82,105,140,106,150,197,106,197,160,161,163,17,27,155,4,155,221,15,63,204,251,2,135,14,236,215,47,163,
+51,14,124,62,243,0,76,69,49,65,81,0,17,30,140,73,68,68,212,144,220,114,199,131,232,214,169,27,102,94,49,94,63,117,94,204,22,11,122,245,25,136,235,175,189,29,203,86,46,197,127,95,251,183,126,9,145,215,80,
+20,19,68,52,168,102,51,174,190,238,78,216,237,118,188,244,252,99,250,101,228,97,172,86,43,252,28,206,138,59,164,26,162,206,221,122,225,95,143,255,7,209,81,161,24,56,180,15,210,79,157,172,152,51,236,116,
+53,212,58,118,233,33,19,166,204,144,41,23,207,148,228,230,45,13,243,190,158,197,106,149,25,51,111,168,116,166,208,250,181,219,37,44,60,194,176,150,213,108,170,170,74,235,118,29,165,239,128,161,18,19,27,
+47,102,51,15,237,251,171,20,197,116,58,165,226,175,245,107,152,247,197,255,150,140,49,198,170,90,68,84,180,156,58,126,74,52,205,45,51,175,190,205,48,95,157,162,99,98,229,229,215,62,145,31,127,88,37,39,
+82,78,138,166,185,101,250,21,215,27,214,49,230,109,157,249,186,42,40,56,196,48,207,152,39,213,170,109,7,89,190,236,119,41,117,253,241,160,174,251,31,252,183,196,39,54,42,95,99,252,160,134,90,98,82,99,233,
+220,181,167,36,38,53,246,201,203,42,255,120,195,95,57,253,186,155,255,246,128,164,30,77,147,255,189,51,87,162,162,99,12,243,140,49,198,24,99,140,213,103,221,123,245,147,219,238,124,88,38,95,116,133,188,
+254,230,231,146,159,157,39,109,219,119,50,172,171,106,33,161,97,114,207,253,79,74,110,102,174,148,150,148,200,220,185,63,85,60,185,152,49,198,88,221,212,161,83,55,201,78,207,174,116,81,141,166,185,101,
+202,197,51,5,188,133,176,97,42,191,5,11,48,222,134,85,254,235,152,184,120,100,103,102,160,160,160,160,98,158,136,136,46,204,153,183,192,250,249,249,161,115,183,222,216,190,117,3,50,51,50,244,75,137,136,
+232,28,38,78,189,12,170,170,98,206,231,239,3,0,166,94,114,21,246,238,217,134,141,235,215,232,151,86,75,247,94,253,97,183,219,177,106,229,82,184,120,128,50,17,81,157,139,75,72,194,171,47,189,135,241,19,
+250,3,0,158,248,215,155,120,252,145,59,81,92,92,4,110,96,209,57,157,185,169,117,230,152,217,98,70,169,171,212,48,71,68,244,87,254,236,235,74,67,112,230,230,85,66,82,35,204,254,244,91,116,239,217,6,123,
+119,29,193,237,247,222,131,249,223,206,214,127,8,17,17,17,17,121,32,147,201,132,238,189,250,65,211,52,172,89,181,92,63,77,231,73,81,20,136,148,109,81,245,31,60,2,49,177,9,248,254,171,207,144,159,159,87,
+54,207,13,44,250,51,101,111,180,164,226,147,71,207,108,54,195,237,214,26,228,155,80,34,162,170,56,115,163,238,204,205,171,216,184,4,124,251,213,15,232,220,181,37,180,82,13,38,115,217,92,223,1,195,240,235,
+242,159,43,253,30,68,190,44,46,33,17,189,251,14,193,183,95,125,138,226,162,34,253,52,81,149,252,217,195,93,136,136,106,155,201,100,194,208,145,227,113,235,13,119,98,254,162,5,248,244,163,55,145,149,89,
+187,87,212,171,170,10,77,211,206,250,30,221,23,40,138,2,0,134,127,198,242,215,213,127,220,75,70,116,6,145,115,255,193,40,45,229,213,87,228,221,134,142,24,135,17,99,38,233,135,137,106,80,217,215,208,51,
+223,92,5,5,135,96,222,55,11,209,185,107,75,184,138,92,208,220,101,95,71,139,243,139,144,151,155,93,233,163,137,124,153,159,195,129,207,62,250,26,151,76,185,180,65,223,166,117,230,177,14,116,126,202,94,
+179,242,53,41,17,213,45,77,211,176,112,254,215,120,252,95,15,66,53,155,209,178,117,123,253,146,26,167,105,149,47,48,137,75,72,68,239,254,67,124,234,123,73,217,63,159,2,69,49,85,170,156,239,252,147,18,17,
+85,67,163,198,45,240,200,63,30,65,219,246,157,224,231,231,208,79,19,93,176,51,95,96,136,104,72,110,222,10,207,61,255,54,230,47,94,138,13,235,119,193,164,154,96,182,153,81,82,88,130,105,151,207,194,230,
+141,235,43,125,60,145,47,187,242,234,219,209,163,71,91,188,240,202,191,160,105,13,115,243,65,85,85,4,4,4,232,135,169,10,244,111,104,136,136,234,203,234,149,203,240,202,127,254,137,181,191,157,253,54,66,
+179,217,162,31,58,47,103,110,214,219,236,118,252,247,141,79,48,100,200,88,159,219,196,47,255,193,132,62,112,3,139,136,202,217,237,118,12,27,57,190,198,190,192,122,186,247,223,121,9,83,46,26,131,228,230,
+109,48,116,228,120,253,52,81,141,17,209,16,21,29,131,37,11,127,66,80,64,0,254,239,190,27,113,217,149,151,32,47,39,31,59,183,29,64,207,126,3,240,253,215,159,87,92,50,77,228,235,28,14,39,226,98,227,49,101,
+250,21,88,190,116,145,126,186,193,112,187,221,200,201,225,149,151,85,225,112,56,112,253,205,247,162,75,247,222,192,25,111,226,184,137,69,68,158,194,237,118,235,135,96,50,153,208,119,192,80,244,236,59,80,
+63,117,193,250,244,27,130,19,167,50,240,194,179,15,235,167,124,94,165,199,22,50,198,106,46,139,213,42,86,155,205,48,238,105,133,71,68,202,23,95,44,20,77,115,203,67,143,189,40,38,147,201,176,198,87,179,
+217,108,18,17,25,101,24,103,172,38,155,114,241,76,201,60,153,41,205,91,181,169,24,27,60,108,140,180,105,215,209,176,150,49,95,79,81,20,195,24,99,127,213,200,177,83,100,255,238,195,242,223,183,231,72,199,
+46,221,13,243,204,247,106,213,166,189,52,105,218,220,48,206,152,183,100,179,217,229,178,43,111,146,230,45,90,27,230,46,180,110,61,251,74,207,62,3,13,227,190,30,15,113,39,170,69,33,161,97,176,217,108,56,
+158,154,162,159,186,96,170,170,34,40,56,4,25,233,167,244,83,213,18,27,159,128,239,191,250,17,29,187,180,168,24,155,51,231,103,204,186,122,42,114,249,147,97,162,26,49,105,218,229,200,205,201,194,226,31,
+191,51,28,56,92,118,229,149,226,115,151,127,159,143,176,136,8,228,100,103,123,237,153,72,118,187,31,58,117,237,137,29,219,54,213,250,65,174,68,13,69,171,182,29,224,116,250,163,85,235,142,120,255,237,151,
+0,0,69,121,69,184,249,174,255,195,187,255,125,65,191,156,124,72,179,230,173,80,84,92,136,35,135,14,234,167,136,188,134,195,225,68,97,97,33,95,231,213,32,195,174,22,99,204,243,51,153,76,50,126,242,116,195,
+120,117,10,143,136,148,29,91,247,137,166,185,197,237,46,21,183,187,84,52,205,45,154,230,150,59,255,254,79,195,122,198,216,133,165,40,166,138,244,115,13,189,228,230,45,229,200,129,20,25,55,233,18,195,156,
+183,20,24,24,36,55,222,122,191,36,54,106,98,152,99,140,157,95,29,58,117,149,151,95,253,88,242,179,243,36,237,216,9,41,204,205,175,120,173,210,169,107,15,195,122,111,73,85,85,49,155,205,18,16,24,40,14,167,
+211,48,207,24,99,204,152,10,224,17,253,142,22,17,121,182,54,237,58,98,198,21,55,224,134,89,215,160,89,171,206,216,190,99,211,121,93,45,21,28,26,138,135,255,239,126,152,173,102,40,138,2,5,0,78,159,195,19,
+18,16,134,247,222,255,111,131,61,92,151,168,118,156,249,61,152,202,37,36,53,194,91,175,127,136,142,157,91,160,117,243,246,152,243,213,23,40,40,200,215,47,243,120,197,197,197,88,183,102,5,178,179,50,245,
+83,68,116,158,210,142,167,224,247,223,87,33,161,81,123,188,245,222,123,120,234,153,167,144,157,167,160,123,167,54,56,122,60,15,43,126,241,206,115,212,252,28,14,248,249,57,224,42,113,193,229,114,241,245,
+22,17,85,91,217,85,253,13,239,53,165,97,87,139,49,86,51,5,135,132,26,198,206,55,69,81,100,252,228,233,178,230,183,173,82,82,84,92,241,211,71,77,115,203,201,227,167,100,248,232,137,134,143,57,87,229,87,
+128,244,27,56,172,226,42,172,242,158,252,215,27,210,178,117,59,73,72,106,36,54,187,221,240,177,236,175,107,211,190,147,204,188,230,54,105,215,161,179,97,174,58,69,70,199,200,192,33,163,196,207,207,79,156,
+78,127,25,62,122,162,244,238,55,216,176,174,174,226,231,3,171,141,90,183,235,88,233,170,138,181,171,183,74,251,78,93,13,235,60,53,94,85,199,88,221,215,162,117,91,73,110,209,202,48,238,77,241,235,6,99,236,
+124,179,218,108,13,245,107,136,97,128,49,86,3,69,68,70,73,255,65,195,47,248,64,116,147,201,36,19,167,94,42,63,45,90,83,105,147,233,207,186,104,198,213,134,143,63,91,138,162,84,124,209,115,58,157,50,243,
+234,219,100,193,252,149,114,247,125,79,136,170,170,2,64,34,163,162,197,207,225,48,124,44,59,119,193,33,161,178,108,201,58,209,52,183,236,217,121,80,66,195,195,13,107,170,90,88,68,132,244,234,59,72,250,
+15,26,46,83,47,185,82,190,248,124,161,204,188,250,86,195,186,186,72,81,76,226,116,58,121,0,51,171,149,70,140,158,40,41,135,211,68,211,220,242,242,171,31,75,82,227,166,134,53,158,144,205,110,23,127,255,
+0,233,214,179,175,116,239,213,79,66,66,195,4,21,155,88,149,255,108,112,99,139,177,154,233,204,63,71,166,211,175,81,24,99,172,33,103,54,155,13,99,13,33,30,226,78,84,11,70,140,153,132,200,168,88,164,166,
+28,65,88,88,36,150,254,52,15,105,199,83,245,203,170,68,85,85,108,217,184,27,45,219,52,2,0,136,38,128,130,63,110,247,147,211,127,132,21,5,37,5,37,104,212,60,25,199,83,142,85,250,61,244,202,15,145,86,148,
+178,3,164,255,236,177,175,170,170,254,233,56,253,181,97,163,38,224,250,171,111,197,252,133,223,35,34,34,6,75,151,204,195,234,95,127,209,47,171,150,86,109,218,163,117,219,78,56,116,112,47,54,111,88,139,
+18,47,61,228,26,60,180,156,206,161,255,224,17,232,218,181,47,94,124,238,81,184,221,165,250,233,122,23,25,29,131,235,111,248,59,70,15,27,140,101,171,86,163,83,219,182,232,212,190,25,166,204,184,20,203,151,
+46,4,0,244,31,52,28,254,1,129,152,255,237,151,192,25,95,111,249,249,78,116,225,248,231,201,179,148,61,80,40,24,102,179,5,69,133,133,200,57,143,227,44,136,136,170,203,176,171,197,234,166,51,127,154,196,
+159,210,250,86,31,124,248,157,28,59,148,42,15,63,246,162,44,253,121,157,140,26,55,197,176,166,42,149,127,78,12,29,49,238,143,43,173,78,31,182,238,118,151,138,86,222,233,185,213,171,182,136,191,127,128,
+225,247,249,179,202,63,231,76,38,147,168,170,90,113,165,152,162,148,253,186,124,140,159,151,213,207,223,63,64,156,254,254,21,191,78,110,209,74,2,2,3,13,235,26,106,229,159,95,250,113,198,60,61,85,85,165,
+87,223,129,178,105,195,46,41,202,47,148,15,62,248,78,110,191,251,209,74,183,59,254,231,165,247,69,211,220,242,210,171,31,75,235,182,29,4,188,77,136,49,230,5,5,7,135,72,207,62,3,197,108,177,24,230,206,86,
+98,82,99,249,251,63,158,150,87,94,251,68,102,94,125,171,225,42,84,198,24,171,233,120,5,86,61,225,79,144,124,219,148,139,103,226,211,247,222,132,217,102,193,29,127,255,39,222,121,235,63,231,117,200,58,78,
+127,174,136,104,120,232,177,23,240,200,3,183,254,49,113,198,149,87,0,112,96,239,81,244,27,220,15,41,71,15,255,177,230,28,202,63,7,43,19,40,138,82,241,91,87,154,225,231,234,121,83,20,19,76,166,63,191,210,
+173,33,50,155,45,208,52,55,15,172,37,175,21,22,17,137,94,125,6,225,200,225,253,216,186,233,119,12,30,62,14,119,221,118,15,44,22,11,114,114,243,49,126,124,63,40,138,130,220,204,60,140,153,60,5,43,150,45,
+214,255,22,85,22,17,25,133,65,67,199,98,203,230,117,136,138,138,69,167,46,189,112,34,45,5,95,125,249,33,10,242,189,239,160,123,34,242,76,141,154,36,163,111,255,97,152,255,221,108,100,164,159,210,79,255,
+41,171,213,138,184,248,36,4,5,135,32,61,253,4,142,28,58,168,95,66,84,193,207,225,64,227,166,205,49,117,218,149,72,136,141,199,215,223,207,198,130,111,103,243,245,32,85,155,97,87,139,213,93,125,7,14,147,
+79,63,251,65,186,116,239,45,14,135,83,166,92,114,165,92,115,227,221,98,181,217,12,107,153,119,117,235,29,15,201,194,31,87,93,208,249,71,56,125,86,85,249,95,15,31,61,81,86,46,223,104,56,251,106,206,156,
+159,36,54,62,209,240,177,85,169,252,74,172,51,51,169,42,175,24,96,149,178,251,249,85,186,170,236,66,114,58,253,197,98,181,26,198,25,243,214,102,93,127,71,197,215,227,82,151,75,10,115,11,42,126,189,107,
+251,126,9,8,56,255,43,48,157,78,127,249,231,83,175,73,122,90,134,20,23,20,138,166,185,37,55,51,71,162,98,98,13,107,25,99,236,124,11,8,12,146,246,157,186,86,249,74,126,198,170,91,147,228,22,242,143,135,
+158,149,117,107,182,73,65,78,190,188,252,234,199,124,61,200,206,39,195,0,171,195,162,162,99,229,187,111,127,145,180,148,147,101,27,19,238,82,217,187,235,144,56,157,53,243,70,145,249,70,250,205,164,1,131,
+71,200,239,235,118,72,202,225,227,114,241,165,215,24,214,159,111,250,191,15,99,56,125,219,212,148,139,175,148,137,83,47,53,204,157,79,86,155,141,183,16,50,175,238,204,135,96,148,255,144,161,123,175,126,
+242,221,183,203,68,211,220,82,148,95,40,255,121,233,3,89,185,124,163,184,221,165,114,203,237,15,26,126,143,234,20,24,20,36,251,118,31,22,77,115,75,118,122,182,116,235,217,215,176,134,49,198,24,243,244,
+84,179,89,162,99,98,165,101,235,118,226,112,58,13,243,140,253,85,213,190,133,176,252,118,38,186,112,229,255,46,155,181,104,133,93,59,182,2,0,74,75,74,49,120,196,104,172,88,246,147,126,57,53,96,229,183,
+160,1,168,184,13,205,238,231,7,167,211,31,233,167,78,234,86,19,213,172,192,192,32,252,223,67,207,98,203,182,13,248,232,221,215,244,211,213,102,54,155,161,105,26,47,25,39,175,167,63,14,192,102,183,227,133,
+23,223,199,177,212,20,60,254,200,29,80,85,21,45,90,181,133,219,237,198,238,157,219,32,127,118,127,118,21,117,239,213,15,255,121,230,101,220,241,247,219,176,102,213,133,61,20,130,136,136,136,200,27,113,
+3,171,30,149,255,187,12,12,10,198,186,85,27,144,220,50,17,110,87,41,186,245,238,135,141,235,215,232,151,19,85,58,183,170,252,207,33,255,76,82,93,72,106,212,4,110,77,195,209,195,23,126,190,5,63,103,201,
+151,148,125,93,22,40,38,19,180,90,62,231,206,98,177,194,229,242,222,39,144,18,17,17,241,117,32,93,136,63,59,197,249,156,206,252,100,179,217,236,72,110,222,10,65,193,193,149,214,84,213,153,111,198,39,78,
+189,12,227,39,79,175,52,239,203,202,255,224,134,71,68,162,73,114,11,12,30,49,16,147,47,154,137,125,123,143,161,91,247,1,250,229,68,192,233,63,127,229,157,57,118,62,20,197,84,145,55,176,219,253,144,212,
+184,169,126,152,234,200,161,131,251,107,100,243,170,76,181,126,110,66,228,209,202,190,38,11,68,19,152,76,127,124,61,85,85,21,38,85,133,114,250,65,27,53,129,155,87,68,68,228,237,206,247,189,11,17,206,103,
+3,235,76,45,91,183,195,234,229,43,240,254,187,95,193,225,112,234,167,171,236,182,187,30,198,220,47,222,199,215,95,126,132,187,239,123,66,63,237,147,202,255,224,70,68,69,163,115,215,222,56,122,228,16,190,
+254,242,35,220,240,183,155,161,105,238,26,125,193,75,164,247,103,87,114,121,58,151,171,4,233,167,78,232,135,137,206,74,81,148,11,222,160,237,210,189,23,122,245,29,164,31,38,50,16,41,187,45,182,252,7,3,
+110,183,27,154,219,125,65,183,13,18,17,249,138,224,224,16,196,39,54,210,15,83,3,17,28,18,138,9,83,46,69,120,68,164,126,138,168,90,84,0,143,232,7,171,78,208,162,85,119,236,61,176,31,139,22,125,119,30,231,
+153,8,250,13,28,134,79,222,123,3,38,181,236,77,198,176,33,125,113,252,84,49,54,254,254,91,131,120,209,119,234,68,26,54,172,255,173,98,195,234,224,254,189,216,176,126,149,126,25,81,141,41,127,67,95,182,
+113,37,112,58,253,145,216,168,9,74,138,139,60,250,167,251,34,130,146,18,207,253,255,71,85,167,170,106,197,29,236,101,111,246,255,248,235,154,186,58,43,54,62,1,247,222,255,20,14,30,220,141,204,140,116,253,
+116,149,12,25,62,22,243,230,206,69,171,150,157,241,225,135,255,211,79,19,157,69,249,57,163,68,68,84,174,101,235,246,136,137,75,192,161,3,123,245,83,212,0,216,253,252,16,28,28,130,163,135,15,162,164,164,
+88,63,77,84,101,23,244,163,233,180,227,169,152,117,245,20,60,244,192,173,40,117,185,244,211,85,50,102,204,69,80,45,106,165,177,151,159,125,20,193,33,161,149,198,124,93,67,216,172,35,207,81,126,213,213,
+248,201,211,177,113,253,86,172,92,178,12,193,161,97,250,101,6,23,122,53,11,145,94,249,45,177,53,125,213,105,215,238,125,112,239,93,215,98,192,224,49,250,169,42,27,62,98,34,2,67,3,224,114,149,214,248,255,
+63,170,61,33,33,161,23,116,85,56,17,17,213,44,69,81,224,112,250,227,196,241,20,253,20,53,16,89,153,25,88,246,243,143,200,205,205,209,79,17,85,203,5,94,129,5,184,74,74,42,158,138,86,29,229,63,105,63,122,
+236,32,162,34,155,161,101,243,164,178,3,80,75,53,60,248,248,139,88,250,243,130,90,63,12,149,168,97,42,187,234,234,206,191,255,19,255,123,253,223,8,13,15,194,223,31,120,18,63,47,250,94,191,208,160,252,74,
+153,152,216,56,76,156,114,57,108,118,27,82,142,30,214,47,35,58,39,139,213,10,136,24,54,238,107,114,143,40,36,52,28,125,122,246,71,143,206,93,176,230,247,245,56,158,154,82,237,171,98,142,167,29,69,65,145,
+21,31,126,242,54,246,237,217,169,159,38,15,164,40,38,12,26,54,6,22,171,5,105,169,124,163,68,68,228,41,74,221,165,200,204,72,71,81,81,161,126,234,255,217,187,239,240,184,138,179,11,224,231,222,187,189,168,
+75,86,177,220,123,239,54,198,13,27,27,131,177,233,189,247,22,106,8,16,66,18,18,146,124,9,53,16,66,9,161,183,208,123,55,221,24,119,131,109,220,123,147,213,187,182,223,249,254,88,73,150,102,37,89,101,37,
+109,57,191,231,57,96,205,59,187,218,174,221,217,153,185,68,20,33,20,69,65,66,98,18,60,30,183,92,138,40,117,115,221,187,52,138,162,10,77,211,234,127,62,97,209,25,226,170,235,110,23,83,142,158,21,210,151,
+97,152,240,198,102,179,139,29,91,247,10,93,15,136,203,175,185,53,164,222,82,198,79,154,42,242,246,229,11,93,15,136,154,138,106,113,199,239,254,33,122,245,233,23,210,47,220,25,48,104,136,184,224,146,235,
+132,211,153,16,82,139,132,228,246,234,35,206,185,224,74,145,153,149,19,82,139,165,24,77,38,161,40,106,72,123,91,98,50,155,27,189,254,119,86,156,9,9,98,198,49,243,196,180,89,115,187,228,247,133,35,118,135,
+67,88,109,182,144,118,166,245,153,60,117,166,24,61,110,82,72,59,195,48,12,195,48,76,107,98,54,155,197,153,231,94,38,102,206,153,31,82,139,229,152,76,38,113,221,141,191,19,167,159,125,177,80,20,37,164,30,
+33,9,105,232,146,40,138,90,31,185,198,48,76,231,167,255,192,193,98,226,148,105,33,237,71,202,216,9,83,68,209,161,34,161,235,129,250,184,42,171,197,49,115,79,8,233,27,206,92,116,217,13,162,48,175,72,244,
+31,56,56,164,22,238,180,231,117,233,162,203,111,16,53,21,213,226,161,135,159,23,137,73,201,33,245,88,73,112,0,171,99,127,208,12,6,67,212,12,40,117,85,122,247,237,39,38,77,153,38,102,207,59,81,244,238,219,
+249,3,194,12,195,48,12,195,48,76,211,201,202,238,41,106,42,170,197,238,29,251,69,66,98,82,72,61,150,211,167,239,0,49,106,236,132,14,191,223,239,172,116,120,9,97,123,105,154,10,85,85,161,40,128,170,6,255,
+173,170,106,237,230,190,220,19,138,168,179,149,150,20,215,47,255,107,237,230,217,170,166,33,239,192,62,84,122,52,44,56,126,54,0,224,254,135,158,195,187,31,125,138,138,242,82,236,221,179,19,1,191,95,62,
+89,88,148,149,21,225,253,143,63,197,150,205,27,218,181,108,185,109,130,183,197,240,145,99,160,25,52,84,85,86,202,29,66,148,151,21,97,197,218,95,160,106,6,164,103,100,98,231,246,205,240,119,210,109,33,107,
+237,253,215,90,206,132,4,164,165,101,52,185,79,129,30,8,116,248,247,169,106,221,94,106,74,253,178,212,120,54,109,230,177,248,250,179,207,113,202,73,167,226,133,151,159,199,230,141,27,112,244,244,217,176,
+217,236,60,242,102,23,106,120,64,1,34,34,34,138,95,62,159,23,123,14,150,225,189,15,223,199,198,95,126,142,171,173,141,202,202,74,144,31,225,251,213,133,140,106,117,69,12,6,131,48,153,205,194,104,52,9,163,
+201,36,52,77,11,254,108,50,133,244,101,24,38,50,82,55,51,233,232,25,115,196,182,205,187,197,133,151,93,95,95,75,239,145,41,210,51,122,132,156,38,154,82,119,253,20,69,21,103,159,127,133,112,87,187,196,214,
+77,187,68,110,175,62,33,125,155,75,106,90,186,152,57,103,190,112,56,157,33,181,206,72,195,111,71,82,211,210,69,122,143,204,144,62,109,137,213,102,19,107,86,109,18,238,170,26,49,121,234,140,144,58,106,95,
+191,229,182,246,70,85,219,62,219,45,214,114,244,204,99,235,103,51,174,94,177,81,188,249,230,98,81,112,176,80,140,157,48,37,164,47,211,117,105,207,76,76,134,97,24,134,97,24,166,243,210,173,95,53,214,125,
+139,175,170,42,116,253,240,197,168,59,66,26,81,75,140,38,19,244,64,160,11,102,227,80,67,138,162,66,8,29,86,171,21,46,151,171,254,121,28,11,179,38,21,69,129,211,153,128,191,254,253,113,92,119,245,89,245,
+237,91,55,237,193,249,151,94,128,85,203,127,104,212,63,82,228,228,246,194,111,110,251,11,230,205,58,26,197,37,229,216,177,123,31,182,108,223,138,103,254,251,80,155,54,178,30,62,114,12,126,119,231,255,97,
+216,160,190,40,41,171,132,65,211,240,167,255,251,35,190,252,236,131,70,253,44,86,43,60,110,79,135,94,171,51,179,115,112,232,224,1,185,57,110,45,60,229,108,252,251,193,7,209,179,119,15,248,221,62,28,61,
+123,46,86,46,251,94,238,70,157,160,87,159,126,152,54,115,30,182,108,90,135,234,170,74,12,26,50,2,165,37,69,88,242,237,151,29,122,140,19,17,17,17,81,248,133,140,106,49,76,52,36,57,37,85,28,61,99,142,48,
+24,141,33,181,72,76,98,82,178,24,53,118,66,72,123,180,39,214,246,178,203,237,221,87,44,91,186,78,236,216,186,87,252,247,153,183,197,45,183,221,35,62,251,116,169,120,250,153,183,133,221,225,8,233,223,221,
+73,72,76,18,171,87,108,108,180,39,153,174,7,132,207,235,21,67,134,141,12,233,223,82,110,185,237,30,241,238,187,95,139,180,244,12,1,64,204,57,110,161,56,118,254,162,144,126,29,137,213,102,19,255,184,255,
+191,162,180,176,84,220,247,224,211,34,43,167,167,152,126,204,92,113,199,93,247,138,212,180,244,144,254,241,148,94,125,250,138,203,174,254,181,152,114,244,204,144,26,211,121,153,117,236,241,245,7,165,240,
+121,125,98,199,214,189,98,216,200,49,33,253,24,134,97,24,134,97,152,110,79,72,3,195,68,77,50,122,100,138,11,46,185,78,92,114,197,77,17,189,124,109,226,148,105,226,219,175,87,139,243,46,190,38,164,198,68,
+94,28,78,103,253,32,14,106,151,233,37,38,37,11,53,194,54,30,87,20,69,204,59,254,36,81,116,168,88,248,189,190,250,193,171,128,223,47,46,190,252,198,144,254,71,138,221,238,8,235,242,192,166,50,113,202,180,
+70,3,109,133,121,69,194,83,227,22,21,37,21,34,53,61,190,7,176,152,238,137,217,108,22,247,61,248,140,208,245,128,216,176,110,155,200,237,221,55,164,15,195,48,12,195,48,12,211,253,233,182,77,220,137,194,
+161,186,186,10,99,198,77,198,83,143,222,135,74,151,134,31,127,252,6,186,30,89,75,62,166,28,61,11,95,126,252,33,116,93,224,186,235,46,141,184,203,71,161,188,94,47,106,106,170,27,181,121,220,238,136,91,38,
+153,148,156,130,81,99,39,227,169,103,254,139,199,159,124,18,5,133,30,76,26,59,2,127,189,239,73,60,252,64,219,95,218,125,62,47,116,93,239,212,205,172,135,13,31,141,234,26,13,27,55,238,194,144,129,189,225,
+76,118,64,51,104,184,250,134,59,240,227,146,175,228,238,20,165,146,83,82,113,245,117,119,32,35,51,11,91,54,109,144,203,17,37,16,8,96,253,186,149,152,54,117,30,174,250,213,21,216,252,203,58,185,11,17,81,
+68,10,254,173,166,120,213,209,131,234,16,69,171,144,81,45,134,137,166,152,45,22,113,211,173,119,139,27,110,249,99,68,30,4,224,241,39,95,19,186,30,16,167,156,113,65,72,141,137,159,116,198,161,104,53,105,
+70,152,209,100,18,11,78,58,67,100,116,112,35,247,206,140,217,108,22,0,68,74,106,154,216,185,117,175,240,121,188,226,198,95,223,29,114,93,152,232,77,98,98,146,88,189,50,184,172,213,93,237,18,131,134,12,
+15,233,19,73,169,91,2,237,112,56,99,110,73,52,195,48,177,151,62,125,7,136,187,255,242,47,49,188,118,169,243,176,17,163,69,82,114,74,72,191,72,206,128,65,67,132,211,153,80,255,179,162,40,113,121,80,23,254,
+205,97,152,118,37,164,129,97,152,48,166,111,255,129,98,246,188,5,194,84,251,193,157,137,143,104,154,214,232,168,134,0,132,211,153,208,105,203,147,228,55,64,242,207,145,18,85,85,133,102,48,8,69,81,196,228,
+169,51,196,196,41,211,66,250,48,209,157,127,220,255,84,163,101,162,191,186,233,174,144,62,12,195,48,76,251,114,244,204,99,69,254,129,2,241,216,227,255,19,57,185,189,196,224,161,35,132,195,209,53,71,62,
+14,87,62,249,104,137,248,248,163,37,34,37,53,77,40,138,34,46,186,236,122,145,152,148,28,210,143,97,24,70,142,42,79,199,34,162,240,218,181,99,27,190,250,252,35,120,61,30,185,68,49,44,49,41,25,6,163,1,192,
+225,35,171,206,152,61,31,255,126,228,57,244,31,56,88,234,221,113,242,209,210,228,159,35,133,209,100,130,217,100,134,170,106,88,190,244,59,172,92,182,4,154,166,65,211,52,185,43,69,41,121,153,180,197,98,
+107,244,51,17,17,181,143,162,40,88,241,227,119,56,110,209,66,108,217,190,25,247,253,227,9,236,216,182,5,85,85,149,114,215,136,246,216,127,31,197,220,99,39,225,161,135,158,193,239,255,244,16,14,236,223,
+141,138,242,114,185,91,76,50,24,141,56,106,218,49,24,49,106,108,163,246,196,164,36,24,12,198,70,109,68,20,138,123,96,17,17,133,153,162,168,128,208,17,8,4,160,235,58,52,77,67,159,190,253,145,149,211,11,
+103,156,188,8,103,159,121,46,118,238,63,128,237,91,55,201,39,141,121,74,237,27,112,69,1,132,16,181,255,86,32,132,136,184,61,198,168,125,86,174,88,130,128,146,132,163,39,143,197,158,157,7,241,219,223,221,
+130,178,210,18,185,27,17,17,181,131,30,8,224,80,222,1,236,217,189,13,233,217,189,176,97,253,106,184,221,46,185,91,68,219,186,121,3,242,138,92,248,213,21,231,67,83,205,184,231,207,119,196,205,123,128,196,
+228,100,124,255,229,55,184,249,166,235,113,176,168,6,19,38,78,195,201,167,158,135,132,196,36,108,88,183,182,118,146,9,17,53,167,115,118,233,37,34,34,40,138,10,33,116,12,29,49,10,31,188,245,1,138,138,203,
+241,214,135,31,225,31,127,185,13,235,127,218,142,209,227,194,63,19,43,210,105,154,6,85,211,32,132,64,192,31,0,0,168,170,2,93,215,227,230,205,107,188,152,114,244,44,20,228,31,196,206,237,91,229,18,17,17,
+17,250,244,27,128,170,202,10,20,21,22,200,165,152,165,40,42,22,158,114,22,158,123,226,49,56,19,237,80,13,42,238,252,195,3,248,207,227,255,64,105,73,219,191,236,9,110,228,30,185,51,239,137,194,141,3,88,
+20,241,248,194,76,209,174,71,102,54,158,120,236,37,44,58,105,38,222,121,251,43,188,250,230,75,216,189,107,43,86,175,248,81,238,26,243,20,69,129,201,100,130,223,239,71,32,16,128,162,168,208,52,21,66,8,232,
+186,224,243,60,6,212,13,220,54,247,51,17,81,36,73,203,232,129,30,153,217,248,101,221,90,185,68,212,105,178,178,115,112,198,217,151,163,184,56,31,255,123,233,41,4,2,193,47,245,218,170,110,11,134,246,158,
+158,162,71,112,69,199,0,236,216,190,69,46,197,21,14,96,17,17,117,2,85,85,97,183,59,80,85,85,5,33,116,36,38,37,227,152,99,79,192,142,109,155,176,254,231,53,114,247,184,161,40,42,76,38,99,131,1,44,5,90,221,
+140,44,190,249,138,41,252,242,129,136,162,65,74,90,58,18,19,147,176,107,199,54,185,68,212,101,248,101,15,29,201,220,249,139,240,199,59,255,132,27,111,189,14,171,87,44,149,203,113,131,3,88,20,177,204,102,
+51,38,79,157,133,156,158,189,97,182,88,49,122,228,56,100,247,200,196,215,223,127,141,151,158,251,119,212,109,88,73,241,39,167,103,47,20,22,230,115,3,127,137,209,100,130,30,8,212,15,88,241,77,27,17,17,17,
+197,147,134,239,125,90,243,62,168,87,159,126,168,170,172,64,73,113,145,92,162,56,113,193,37,215,225,143,119,220,142,179,46,56,155,3,88,114,35,117,15,187,195,129,196,196,100,28,60,176,79,46,197,165,212,
+180,116,172,94,182,22,189,250,101,201,37,204,153,183,16,95,47,254,88,110,38,162,8,87,183,100,208,239,247,203,37,34,34,34,10,163,17,163,198,98,210,81,179,240,246,235,207,243,96,26,17,168,45,51,149,23,158,
+114,54,14,30,216,131,173,155,126,129,221,233,68,97,254,33,206,92,143,51,73,201,41,72,75,239,17,151,7,129,106,40,248,172,161,136,112,210,169,231,225,187,47,151,96,192,224,161,0,128,209,227,38,34,33,49,73,
+238,22,55,138,139,10,113,222,165,23,193,83,83,59,123,165,118,131,231,29,91,247,97,215,78,110,10,76,20,141,132,208,17,8,28,249,141,26,81,103,114,38,36,96,234,244,217,48,153,205,114,137,136,168,85,20,69,
+145,155,34,78,223,254,131,113,213,197,151,224,132,133,103,192,233,76,144,203,212,205,132,208,91,53,120,5,0,159,125,244,14,202,74,75,112,227,175,239,198,243,207,188,9,187,221,81,95,211,52,13,6,131,161,81,
+127,138,61,101,165,37,113,63,120,5,14,96,69,150,94,189,250,163,223,160,158,120,225,233,255,225,119,127,188,31,231,158,123,37,34,255,79,99,231,250,225,187,47,177,240,180,179,80,86,84,14,40,10,158,122,250,
+109,28,119,226,60,236,222,185,93,238,74,81,202,102,183,195,96,52,34,33,49,17,102,139,5,125,251,15,132,221,225,128,221,113,248,15,51,197,150,214,190,89,163,248,99,50,155,145,156,146,138,225,163,198,98,194,
+228,169,200,232,145,41,119,233,176,193,195,70,224,190,251,159,198,111,127,243,71,24,106,55,191,37,34,106,171,104,56,114,238,154,149,75,113,223,195,15,194,233,76,196,73,167,157,207,65,251,40,150,144,148,
+136,227,142,63,13,195,135,12,131,209,160,193,106,179,213,215,116,93,240,203,65,138,27,92,66,24,65,250,244,27,128,39,254,253,2,230,29,55,25,27,126,222,142,227,78,156,131,188,3,251,229,110,113,105,242,212,
+25,24,50,108,12,254,247,210,127,224,113,187,229,50,69,49,85,85,33,4,144,148,156,12,143,199,141,212,180,116,148,150,20,35,49,41,5,38,147,9,123,119,239,228,20,233,54,234,153,219,27,191,185,237,47,120,238,
+185,71,177,118,245,114,185,76,20,113,6,14,25,134,115,206,189,18,107,215,46,195,212,169,179,113,203,117,23,2,0,230,45,60,25,223,126,249,169,220,189,221,52,77,195,242,165,235,48,116,72,111,204,156,119,28,
+86,45,255,65,238,66,68,212,42,163,198,78,192,249,231,95,13,175,207,135,220,236,28,252,225,143,55,99,207,174,29,114,183,136,208,183,223,64,244,29,48,24,203,127,248,26,213,213,213,114,153,162,64,118,207,
+92,12,31,49,22,155,54,254,140,140,30,217,216,183,103,39,10,11,242,229,110,68,113,65,48,145,147,196,164,100,241,223,103,222,22,179,230,28,31,82,99,152,120,138,162,40,34,57,37,85,104,154,22,82,99,90,78,102,
+86,142,120,225,197,15,196,186,159,182,138,41,71,207,10,169,51,76,164,37,37,53,77,252,233,175,255,18,7,247,30,18,129,128,95,4,252,126,113,222,197,215,8,163,209,20,210,183,163,57,97,209,25,34,255,64,161,
+184,239,161,103,66,106,12,195,48,173,205,229,87,223,42,116,61,32,116,61,32,10,243,10,69,239,190,253,67,250,48,12,195,48,97,79,72,3,211,205,81,85,85,0,16,138,18,252,63,195,48,173,143,162,40,124,238,212,
+102,204,248,201,98,254,137,167,114,16,144,137,138,164,166,167,139,188,125,249,66,215,3,226,194,203,174,15,169,135,51,131,135,14,23,95,46,94,33,102,204,62,46,164,198,48,12,211,154,228,244,236,37,254,247,
+218,103,194,231,245,137,63,222,243,112,72,157,97,24,134,9,127,184,132,144,136,98,138,201,108,134,162,40,92,106,218,64,107,14,207,76,20,9,102,206,62,14,227,38,76,195,195,247,255,17,186,222,185,143,217,220,
+94,125,144,156,154,134,117,107,87,201,37,34,162,22,213,253,93,77,72,76,194,164,163,102,96,223,158,157,216,178,105,131,220,141,136,136,194,140,3,88,68,68,68,68,68,68,68,68,20,209,120,20,66,34,138,43,138,
+194,151,61,34,34,34,106,90,221,251,132,228,212,52,36,167,164,202,101,162,152,162,105,26,140,38,147,220,76,20,177,248,73,142,136,226,130,205,102,7,0,46,165,35,34,162,118,73,73,77,67,223,254,3,145,153,157,
+131,212,244,12,185,76,49,66,8,29,253,7,14,198,146,175,151,97,221,234,245,248,245,237,127,65,106,90,186,220,141,40,38,4,2,1,248,188,94,185,153,40,98,113,0,139,136,98,158,195,225,196,43,175,124,132,135,30,
+121,1,105,233,193,55,161,189,250,244,67,118,78,174,220,53,230,41,138,202,89,104,68,68,237,160,105,26,44,22,43,82,82,210,224,116,38,200,101,138,33,39,44,60,11,67,71,244,69,78,239,30,184,253,198,171,224,
+224,253,77,68,20,17,184,7,22,17,197,188,133,167,156,141,255,61,247,95,88,157,86,252,251,137,215,240,222,251,255,195,223,255,252,127,184,237,174,219,241,213,231,31,202,221,137,136,136,40,6,37,36,38,193,
+231,245,194,229,170,145,75,245,178,123,246,194,15,95,255,128,237,187,14,224,229,55,94,197,170,21,223,99,195,207,107,228,110,68,68,212,13,56,128,69,68,49,237,196,147,207,194,237,55,223,142,183,63,252,16,
+119,220,116,53,210,179,130,251,89,60,244,200,11,184,243,142,107,226,230,104,133,115,231,47,130,106,48,96,205,202,165,40,204,63,36,151,137,136,186,77,175,62,253,176,119,247,78,185,153,168,195,146,146,83,
+48,96,208,80,252,178,110,13,122,100,102,227,232,153,243,240,217,71,111,161,168,176,64,238,90,47,187,103,46,166,205,152,135,79,62,124,3,149,21,21,114,153,136,136,186,17,215,145,16,81,76,211,52,13,79,61,
+255,44,30,186,239,15,56,243,130,11,241,211,234,45,184,242,218,219,112,219,175,47,143,155,193,43,0,176,88,109,120,251,229,23,176,126,245,207,56,231,130,43,49,115,206,124,228,246,234,35,119,35,34,234,50,
+206,132,68,220,113,215,189,152,55,255,20,185,68,20,22,94,143,7,195,71,140,199,75,47,125,128,165,223,253,128,225,67,71,183,56,120,5,0,7,247,239,195,235,175,60,141,202,138,10,46,185,39,34,138,48,156,129,
+69,68,113,197,96,48,194,239,247,201,205,113,225,232,25,115,112,211,245,119,224,196,249,71,227,129,71,159,199,195,15,221,141,194,130,124,185,27,17,81,151,72,78,73,197,130,69,103,97,229,242,239,176,101,211,
+6,185,76,20,22,185,189,251,226,173,215,62,128,217,108,196,213,215,95,141,31,151,124,45,119,33,34,162,40,193,1,44,34,162,56,51,122,236,4,236,222,181,29,229,101,101,114,137,168,93,76,38,19,46,189,242,102,
+236,222,189,13,159,126,248,182,92,166,40,85,183,105,121,117,117,149,92,34,138,42,153,89,217,48,24,140,216,191,111,143,92,34,34,162,40,194,121,177,68,68,113,230,231,181,171,56,120,69,97,101,177,88,113,221,
+229,151,225,131,183,94,197,249,23,95,11,77,211,228,46,20,133,122,230,246,198,148,105,179,228,102,162,168,115,40,239,32,7,175,58,129,211,153,128,57,199,45,132,102,48,200,37,34,162,78,193,1,44,34,34,34,234,
+16,159,207,135,173,219,247,66,51,26,240,215,223,223,9,187,195,41,119,161,78,212,210,62,61,45,213,142,68,215,5,220,110,151,220,76,68,4,212,30,128,225,209,7,31,198,156,121,39,202,165,136,96,52,153,96,181,
+217,228,102,34,138,98,26,128,187,229,70,34,34,34,162,214,178,88,44,152,56,121,38,138,10,202,113,227,111,110,196,206,237,91,185,67,65,23,9,14,80,53,127,91,155,204,38,232,186,104,177,79,115,42,43,202,113,
+40,239,0,2,129,128,92,34,162,46,150,146,150,142,113,19,143,66,73,113,33,124,94,175,92,238,114,147,167,206,192,181,215,222,134,193,3,122,227,140,83,78,134,7,86,172,248,241,91,185,91,183,114,56,28,72,73,
+77,135,223,231,67,70,143,44,212,84,87,65,136,182,191,22,18,81,228,224,0,22,17,17,17,117,136,193,104,196,161,67,7,240,232,163,247,97,247,206,109,237,26,44,161,246,106,249,182,14,14,62,181,220,167,37,28,
+188,34,138,12,253,250,15,194,105,167,93,132,109,219,126,65,89,105,9,172,86,43,252,126,191,220,173,158,193,96,128,174,235,114,115,216,244,204,237,131,0,128,79,191,88,12,183,87,197,246,29,91,241,243,218,
+229,114,183,110,229,241,120,80,81,94,6,85,211,144,221,51,23,174,154,26,120,60,30,185,27,17,69,17,110,226,78,68,68,68,68,68,20,193,18,19,147,112,238,69,215,98,247,174,173,56,120,96,15,182,111,221,132,234,
+170,166,15,176,48,110,194,20,228,228,246,193,250,159,86,97,247,174,237,114,57,46,245,234,211,15,128,192,222,221,187,228,18,17,69,145,246,111,140,64,68,49,199,100,54,203,77,68,68,20,133,146,146,83,160,40,
+138,220,76,68,81,170,188,188,12,223,125,243,9,50,50,178,224,247,249,154,29,188,2,0,171,221,142,1,3,134,193,153,152,40,151,226,214,222,221,59,57,120,69,20,3,184,132,144,168,9,189,251,244,71,82,114,10,202,
+203,74,229,82,204,26,52,100,56,102,28,51,31,27,55,252,36,151,136,136,40,138,76,58,106,58,150,124,245,29,146,210,251,226,171,47,63,146,203,20,39,236,14,7,178,115,114,225,243,121,225,243,249,228,114,92,58,
+210,158,113,109,101,52,153,144,148,148,12,151,171,70,46,117,138,194,252,67,40,46,46,64,81,97,62,60,110,183,92,174,87,152,127,8,121,7,247,226,224,254,189,92,50,71,68,49,37,98,103,96,153,205,22,156,118,214,
+69,152,126,204,60,185,68,212,105,108,54,59,22,158,114,54,86,46,93,134,249,11,78,151,203,49,75,211,52,76,155,49,15,57,57,189,229,18,17,17,69,9,77,211,112,220,130,83,240,212,99,255,69,143,156,52,220,121,
+251,85,56,237,172,139,228,110,81,101,196,232,113,232,63,112,176,220,76,173,112,212,180,99,240,254,219,31,227,252,139,175,235,208,209,40,99,133,162,168,112,38,36,132,245,182,48,153,76,200,232,145,37,55,
+119,170,253,123,119,31,241,11,86,183,219,133,29,219,183,160,162,162,92,46,17,17,69,181,240,189,130,135,217,249,151,92,135,55,94,125,6,143,253,243,223,72,77,75,151,203,212,133,20,69,193,140,99,230,97,242,
+212,25,114,41,166,12,28,60,20,139,63,255,1,111,191,246,34,190,91,250,51,222,121,227,121,185,75,204,234,213,167,31,50,50,178,240,229,226,247,229,18,17,17,69,0,187,221,129,33,195,71,201,205,141,40,138,138,
+25,211,231,193,229,242,96,205,170,45,0,128,39,254,249,0,82,82,211,228,174,81,33,57,37,5,31,190,253,62,150,125,247,3,38,76,62,90,46,211,17,236,217,181,3,111,190,247,17,74,75,10,161,170,92,78,42,132,142,
+202,138,10,8,17,190,141,205,171,171,170,176,121,227,122,185,153,136,136,58,81,221,177,149,35,42,51,103,31,39,190,248,124,153,200,63,80,32,38,79,157,25,82,103,58,63,78,103,130,232,211,111,128,184,253,119,
+127,23,186,30,16,186,30,16,139,78,61,59,164,95,172,100,216,200,49,226,147,143,127,16,103,157,119,185,48,154,76,33,245,88,142,197,98,17,201,169,169,33,237,12,195,48,76,100,196,108,54,139,156,158,189,66,
+218,155,138,209,104,18,3,6,13,17,119,255,229,17,241,240,163,47,137,204,172,236,144,62,209,144,75,175,188,185,254,253,135,187,170,70,156,113,206,37,33,125,24,134,97,24,134,137,159,68,244,81,8,147,83,83,
+145,219,171,47,118,239,220,142,138,242,50,185,76,157,236,156,11,174,196,163,15,252,29,73,41,9,80,106,191,185,43,204,43,193,148,25,83,177,107,199,54,185,123,212,83,20,5,70,163,17,94,175,87,46,17,17,17,81,
+23,187,238,198,187,48,105,252,36,212,184,92,152,119,204,81,40,175,168,198,172,217,83,184,44,138,136,136,40,78,69,244,0,22,117,175,244,140,30,56,229,244,139,240,248,35,127,197,219,239,124,131,191,223,247,
+71,220,121,251,61,248,246,135,239,240,200,131,127,146,187,19,17,17,17,117,10,103,66,2,140,38,19,74,139,75,194,186,4,140,136,136,136,162,7,7,176,232,136,166,207,154,139,189,123,118,98,207,174,29,176,217,
+108,112,38,36,34,255,80,158,220,141,136,136,136,136,136,136,136,168,83,112,0,139,90,77,81,84,126,235,73,68,113,193,110,183,227,236,11,174,130,195,158,128,119,223,126,1,123,118,237,148,187,16,17,81,55,114,
+38,36,194,237,170,129,207,231,147,75,68,68,20,193,250,244,27,0,159,215,139,3,251,247,202,165,35,138,216,163,16,82,248,245,238,219,15,206,132,68,185,185,69,138,162,214,167,238,103,234,60,38,179,25,201,41,
+169,114,51,17,117,177,57,199,45,196,83,143,221,135,135,238,251,61,214,44,91,137,153,115,230,203,93,136,136,168,155,164,166,165,99,209,41,231,224,132,69,103,194,225,112,202,229,35,82,85,190,159,37,34,234,
+46,243,79,56,29,183,255,246,255,218,53,182,208,246,83,80,212,242,184,221,240,183,241,91,170,134,51,174,132,208,35,126,6,86,114,74,10,46,185,226,38,204,63,241,52,185,20,241,20,69,197,148,169,51,49,97,242,
+52,185,68,68,93,236,232,169,115,234,255,157,156,158,132,207,63,120,23,131,135,142,104,212,135,136,136,186,135,213,102,135,166,25,96,183,59,96,182,90,228,242,17,205,158,119,34,166,205,58,150,3,89,68,68,
+221,160,186,186,18,179,166,78,132,197,210,246,215,111,190,106,199,145,67,121,7,225,114,213,200,205,71,20,13,3,87,0,48,122,236,68,44,249,102,57,158,126,242,1,124,252,254,235,248,253,221,15,193,108,54,203,
+221,34,150,213,102,197,200,209,19,225,245,122,228,18,17,117,49,151,219,221,232,103,183,203,131,170,170,138,70,109,221,41,163,71,38,78,61,243,66,88,172,86,185,68,68,20,243,246,239,221,141,23,158,121,20,
+175,188,240,36,138,11,11,229,242,17,57,157,137,120,224,255,30,196,128,65,67,229,82,135,56,19,18,48,97,242,209,72,239,145,41,151,136,136,168,214,119,223,124,138,87,222,122,23,138,34,87,90,71,48,76,180,103,
+250,172,185,162,172,168,76,232,122,160,81,250,13,24,20,210,55,82,163,170,170,72,76,76,10,105,239,72,142,57,246,120,113,230,121,151,137,180,244,140,144,26,195,48,205,103,248,200,49,226,221,119,191,22,123,
+118,30,16,79,62,245,134,24,57,122,92,72,159,238,76,143,172,108,177,249,151,157,226,201,167,222,8,169,49,12,195,48,45,199,153,144,40,102,28,51,79,36,167,166,133,212,58,146,236,156,92,241,221,55,171,197,
+55,95,173,20,163,199,77,12,169,51,12,195,48,193,216,108,54,161,106,90,72,123,43,18,210,192,48,81,151,153,179,143,19,1,191,191,209,224,213,234,149,27,133,51,33,49,164,111,172,71,81,20,161,40,170,56,239,
+226,107,132,171,170,70,108,248,121,155,200,232,145,25,210,143,97,152,35,39,82,95,67,230,157,112,178,240,212,184,197,161,253,5,34,59,39,55,164,206,48,12,195,116,79,102,204,62,78,20,28,44,20,123,118,30,16,
+125,251,15,12,169,51,12,195,48,237,143,6,224,110,121,74,86,60,51,24,12,0,0,171,213,10,179,217,12,175,215,43,119,161,8,180,103,215,14,124,251,195,10,140,26,58,30,9,14,43,62,252,248,7,92,124,217,89,40,42,
+200,151,187,118,153,164,228,20,244,236,213,7,229,101,101,93,190,4,115,220,132,201,120,235,229,23,96,52,25,112,195,111,238,192,202,101,75,228,46,212,65,14,135,147,175,15,113,192,235,137,188,37,189,227,39,
+77,197,127,255,253,36,238,255,215,147,248,240,211,207,81,92,82,128,154,170,42,232,122,0,66,8,185,59,17,17,117,161,61,187,118,96,249,154,159,177,96,254,9,216,188,125,55,54,110,88,43,119,33,34,162,14,8,25,
+213,138,231,104,154,38,84,85,21,102,179,69,88,44,214,144,58,19,217,49,153,205,162,87,159,126,33,237,221,145,83,207,188,80,236,220,182,87,12,26,50,60,164,214,217,25,54,114,140,248,105,245,102,113,217,85,
+183,132,212,152,142,69,81,85,113,249,53,183,138,47,191,88,46,254,244,215,127,9,187,221,17,210,135,137,141,40,138,90,31,185,214,157,201,206,201,21,35,70,141,109,212,102,182,88,132,214,190,105,216,12,195,
+48,76,39,196,106,179,137,228,148,212,136,251,27,194,48,12,19,205,81,106,255,65,20,245,20,69,237,242,153,78,45,201,237,213,7,83,142,62,6,203,150,126,131,125,123,118,201,229,78,151,146,154,134,146,226,34,
+160,27,110,27,69,81,161,170,10,2,129,128,92,138,106,54,155,29,103,159,127,37,254,112,251,175,97,179,154,241,242,155,159,224,15,119,93,143,202,138,114,185,43,17,17,17,181,160,103,110,111,228,246,233,135,
+31,191,255,90,46,17,17,17,53,137,3,88,68,49,78,81,130,7,27,237,202,1,44,135,195,9,135,211,137,234,170,42,84,86,70,206,145,219,58,42,189,71,15,252,225,15,15,98,213,154,101,88,179,122,41,126,89,247,19,116,
+61,182,6,233,136,136,136,186,194,188,19,78,198,251,111,188,138,179,46,188,28,31,188,243,42,116,189,235,222,167,16,81,99,70,147,9,179,230,204,199,194,19,207,194,199,159,188,133,79,63,124,91,238,66,20,17,
+56,128,69,68,97,103,48,24,96,177,88,97,182,88,160,170,42,10,187,113,47,178,112,51,154,76,240,113,239,43,34,34,162,14,201,233,217,11,175,190,252,46,82,146,156,216,182,115,63,254,253,228,67,88,252,233,251,
+114,55,34,234,2,131,134,14,199,247,139,191,65,122,86,10,206,185,240,42,188,246,210,127,229,46,68,17,33,56,53,131,136,40,140,252,126,63,170,170,42,81,85,85,137,1,131,134,65,85,67,95,106,154,106,139,6,241,
+60,120,101,181,217,144,152,152,36,55,19,17,17,181,217,129,253,123,113,210,169,115,177,100,249,90,204,152,58,26,253,250,13,145,187,16,53,201,108,54,99,224,224,161,152,114,244,76,185,68,237,164,170,26,140,
+70,13,123,119,230,225,231,181,203,229,50,81,196,224,12,44,162,56,102,52,153,48,98,212,88,236,218,190,21,101,101,165,114,57,44,6,15,29,129,178,210,98,228,31,202,3,0,156,116,218,121,216,189,107,43,214,255,
+180,26,70,147,9,94,143,183,75,151,55,82,251,13,28,60,20,10,20,108,221,178,81,46,17,17,17,181,139,205,102,135,205,110,71,113,81,33,143,164,74,173,146,152,152,132,17,163,199,99,232,240,177,120,251,245,231,
+234,247,124,165,246,169,219,43,119,248,200,49,40,47,47,195,254,189,187,229,46,68,17,67,3,112,183,220,72,68,241,193,100,52,98,218,140,121,24,48,104,24,182,109,221,136,128,223,47,119,233,48,159,215,3,183,
+171,6,62,159,15,83,167,31,131,69,39,158,9,151,199,131,13,63,175,198,194,147,207,70,121,121,49,170,98,104,159,172,88,230,245,122,80,90,90,2,127,39,60,78,136,136,40,62,249,124,62,212,212,84,203,205,49,65,
+211,52,228,228,246,70,66,98,18,42,202,203,228,50,181,147,199,227,70,81,97,62,106,170,43,144,127,40,143,239,75,58,44,56,112,92,88,112,136,143,83,138,120,28,192,34,138,99,126,191,31,187,118,110,69,89,73,
+49,138,139,138,58,101,66,166,199,227,129,207,231,3,0,12,27,49,6,197,37,197,168,174,174,192,214,205,27,96,119,56,80,94,86,130,234,170,42,249,100,20,129,188,94,47,223,36,18,17,17,181,194,224,161,35,112,222,
+133,215,98,238,220,69,216,179,123,27,14,30,216,39,119,161,14,240,251,124,40,200,63,196,247,37,20,83,38,79,157,129,225,35,199,98,215,142,173,156,145,218,140,232,220,132,134,136,194,166,186,170,10,187,118,
+110,235,146,101,124,139,63,251,0,123,247,110,71,89,105,49,0,96,243,198,117,240,120,60,114,55,162,184,82,119,164,80,34,162,104,167,170,42,250,13,24,4,147,201,36,151,226,138,213,106,195,239,127,247,15,220,
+113,243,53,120,247,189,151,177,106,197,82,168,154,6,139,197,34,119,37,34,170,55,125,198,113,120,249,233,255,98,248,168,177,114,137,106,113,6,22,17,117,25,33,4,246,237,217,133,189,187,119,66,81,84,120,189,
+30,184,221,46,185,27,81,220,168,219,119,194,153,144,128,115,47,184,26,191,190,249,247,176,37,38,226,151,117,107,248,205,27,17,69,157,140,204,44,220,250,155,123,48,124,212,120,172,94,185,52,110,103,199,
+4,2,1,236,220,189,13,159,126,249,21,190,253,242,83,160,118,112,111,202,209,179,80,93,85,9,87,77,141,124,18,34,34,20,23,231,99,236,216,105,112,251,4,86,173,88,210,41,171,99,218,75,81,84,40,138,210,40,221,
+113,249,56,128,69,20,231,172,86,43,156,9,137,112,187,186,122,32,169,235,95,240,136,34,143,64,159,126,3,240,230,255,62,196,245,191,186,8,163,70,13,4,252,86,188,251,254,107,157,178,39,29,17,81,103,89,112,
+210,153,200,202,206,197,37,231,159,135,243,207,91,132,228,212,254,248,238,219,207,225,141,203,163,247,10,28,202,59,128,157,219,183,212,183,168,106,240,195,95,121,121,105,92,31,209,152,26,211,52,141,95,
+88,81,189,226,162,66,124,253,237,98,8,161,227,224,129,189,17,245,94,48,56,96,37,235,250,199,110,247,12,155,17,81,196,112,58,19,224,112,58,145,119,240,128,92,34,162,46,176,232,212,115,240,238,155,47,1,0,
+222,124,243,75,252,243,209,191,99,197,143,223,195,95,187,119,28,17,81,52,120,225,197,15,112,234,194,89,48,219,204,208,12,26,0,96,244,184,73,88,255,211,106,185,107,220,209,52,13,170,166,113,224,138,26,209,
+12,6,216,237,14,84,87,85,34,16,8,200,101,34,106,2,55,222,32,138,115,149,149,21,28,188,34,234,70,75,191,255,18,235,214,110,131,207,227,67,70,90,10,76,38,51,7,175,40,174,213,125,177,66,209,229,205,119,94,
+129,45,193,86,63,120,245,183,127,252,7,219,183,108,146,187,197,165,64,32,192,193,43,10,161,7,116,152,76,38,190,222,81,68,107,184,87,235,177,243,23,97,238,252,69,24,49,106,44,250,244,27,0,131,193,208,204,
+204,172,206,37,24,134,97,24,38,94,146,147,219,75,216,237,142,144,246,238,76,98,82,146,56,249,244,243,197,203,175,124,44,134,142,24,21,82,103,152,120,202,252,19,79,21,63,173,217,44,166,206,152,19,82,99,
+34,55,86,171,77,172,93,181,73,232,122,64,220,114,219,61,33,117,134,97,66,163,40,170,80,20,53,164,157,97,34,37,117,143,207,243,47,185,78,232,122,64,232,122,64,4,252,126,225,174,170,17,243,79,60,53,164,127,
+103,135,75,8,137,136,40,110,76,157,126,12,38,77,153,133,167,159,120,0,149,149,21,114,185,219,153,76,166,56,221,47,134,232,176,236,158,185,184,244,242,155,241,249,103,239,96,197,143,223,203,101,138,64,138,
+162,64,8,129,17,163,198,34,43,167,23,190,248,228,61,185,11,17,17,69,169,65,67,134,225,167,21,43,96,113,88,27,181,159,124,250,5,120,255,237,87,26,181,117,54,14,96,17,17,81,92,24,59,97,10,190,252,248,99,
+156,117,209,197,248,226,147,247,229,50,17,17,133,81,221,81,86,137,136,40,186,221,251,192,127,113,235,205,151,64,232,193,161,35,69,85,224,247,250,49,106,220,4,108,222,184,94,238,222,169,184,7,22,117,41,
+163,201,36,55,17,17,117,58,155,221,142,231,254,243,60,222,120,239,75,14,94,17,17,117,1,14,94,197,182,30,89,217,200,202,233,41,55,19,81,12,218,177,115,155,220,4,8,129,234,234,74,185,181,211,113,0,43,130,
+29,53,109,22,6,12,26,34,55,71,181,137,147,167,225,183,191,191,23,54,187,93,46,17,17,117,154,204,172,28,124,249,253,50,252,246,246,171,229,18,17,17,17,181,82,66,98,34,230,157,112,18,46,187,226,22,12,30,
+50,66,46,19,181,200,96,52,98,222,9,39,99,254,130,83,224,116,38,200,101,138,80,175,190,248,4,214,174,218,2,69,85,160,168,193,77,219,55,109,218,131,194,130,124,185,107,167,211,0,220,45,55,82,228,56,246,184,
+147,49,98,212,56,168,154,138,67,7,247,203,229,168,83,81,94,138,89,199,28,143,51,78,191,0,191,108,90,135,210,146,34,185,11,17,81,216,85,87,87,225,243,207,222,67,117,117,149,92,34,34,34,162,86,178,59,19,
+96,183,59,240,213,226,15,177,113,195,207,114,153,168,69,154,166,97,236,248,163,112,214,25,23,96,211,150,13,56,148,199,35,161,71,3,143,199,131,143,62,249,0,73,201,125,49,122,228,32,172,89,189,5,167,159,
+115,82,183,12,96,113,15,172,8,119,213,175,110,199,57,167,158,129,103,95,126,1,207,63,253,136,92,142,74,38,147,25,15,255,235,5,252,178,105,61,30,123,228,111,208,245,238,157,98,158,157,211,19,38,179,5,123,
+118,237,128,16,124,58,16,17,81,236,176,217,236,240,251,253,240,122,61,114,137,136,40,238,244,238,219,31,21,229,101,40,45,41,150,75,212,133,76,102,51,0,192,235,225,223,166,104,208,112,79,195,113,19,143,
+194,129,125,187,145,127,40,175,91,246,58,228,0,86,20,176,219,29,112,187,221,208,245,64,204,12,176,56,19,18,209,35,51,11,59,182,109,237,242,7,189,108,193,73,103,226,186,43,110,192,103,95,127,129,151,158,
+127,12,197,69,133,114,23,34,34,162,168,52,121,234,76,20,21,30,194,142,109,91,228,18,17,81,183,25,52,100,56,0,129,173,155,55,202,165,78,101,181,217,224,243,249,224,247,249,26,181,15,30,58,2,1,191,31,219,
+183,109,110,212,78,68,193,1,44,72,123,27,170,170,10,33,186,126,191,67,46,33,140,2,62,159,183,203,31,24,157,205,235,241,160,164,184,40,34,198,79,75,138,11,96,113,38,227,230,107,174,64,66,106,46,86,46,255,
+30,30,126,27,64,68,113,162,119,223,254,24,49,106,28,92,174,26,212,84,87,203,101,138,114,9,9,137,72,72,76,198,193,3,251,228,18,17,81,183,233,221,119,0,114,114,251,96,71,23,15,24,249,125,190,144,213,31,41,
+169,105,24,52,120,56,170,170,42,66,190,200,182,88,44,24,48,104,40,82,211,210,97,48,26,81,93,213,245,155,86,19,117,23,179,197,2,161,235,16,66,135,162,40,141,130,110,58,88,7,7,176,40,238,185,106,106,176,
+113,195,90,44,95,179,6,201,41,233,40,40,204,67,97,193,33,185,27,17,81,76,114,56,157,232,213,167,63,74,138,11,144,146,154,6,143,219,3,191,191,241,55,211,212,57,156,9,9,200,204,202,70,77,117,117,200,7,170,
+112,41,46,42,132,215,227,70,114,106,42,84,85,133,199,237,150,187,80,55,208,52,13,131,135,12,135,102,48,64,85,20,46,241,164,14,73,73,77,131,166,105,240,122,189,114,41,98,85,85,85,160,168,168,0,213,85,221,
+187,55,165,170,170,24,55,105,42,138,138,242,177,109,235,166,144,215,98,93,215,225,118,187,32,0,84,86,148,195,23,69,183,49,81,71,40,138,138,140,204,76,184,106,92,208,245,64,237,196,147,96,20,69,105,245,
+224,85,112,246,86,248,38,173,112,9,33,81,3,78,103,2,2,129,0,106,106,56,11,129,136,226,71,143,204,44,56,19,18,49,114,244,68,124,255,237,103,40,42,40,144,187,80,152,245,200,204,194,139,207,191,141,190,189,
+179,49,111,193,177,216,181,163,137,67,84,135,81,110,239,190,8,4,2,56,184,127,175,92,162,110,160,105,26,134,142,24,13,179,201,140,130,252,60,236,219,187,91,238,66,212,42,19,167,76,195,204,89,39,224,149,
+151,30,199,193,253,177,63,211,210,106,181,194,98,181,97,248,168,113,40,41,46,196,198,245,63,201,93,218,68,81,84,244,234,211,23,7,15,236,227,224,20,81,3,138,162,34,37,45,21,21,101,101,240,73,75,110,219,
+42,33,33,17,22,155,13,5,135,242,228,82,155,113,0,139,186,133,201,108,230,166,125,68,68,20,183,174,188,246,54,220,117,235,141,184,230,150,155,241,217,71,239,132,236,199,18,46,54,155,189,91,190,148,49,24,
+141,200,232,145,25,23,31,168,137,186,75,110,239,190,152,53,251,4,252,188,118,25,214,253,180,90,46,199,28,163,201,132,51,207,185,12,22,171,21,59,182,111,194,207,107,86,112,51,246,40,96,182,88,48,126,226,
+84,228,29,220,215,233,95,214,116,38,131,193,128,164,228,20,148,149,150,114,166,122,27,29,123,220,66,244,237,63,4,255,125,252,254,14,239,233,29,220,141,139,186,148,170,170,200,202,233,9,131,193,32,151,226,
+130,170,170,232,153,219,27,154,166,201,37,160,118,112,203,98,181,202,205,20,229,234,214,74,19,17,197,187,161,35,70,193,225,112,98,202,140,41,248,232,221,215,59,109,240,10,0,230,157,112,50,142,153,123,130,
+220,220,233,132,174,115,175,24,162,78,100,179,217,145,157,147,139,119,222,124,33,46,6,175,0,64,83,85,88,172,86,84,148,151,98,213,178,37,28,188,138,18,126,159,15,123,247,236,64,101,69,133,92,138,42,73,201,
+41,184,224,146,95,97,240,176,17,114,137,142,192,227,117,163,172,180,184,195,131,87,224,30,88,93,67,81,20,12,27,57,6,35,199,140,199,174,29,219,96,181,218,240,248,99,47,227,199,229,223,163,162,188,76,238,
+30,7,20,84,87,87,54,251,134,61,16,8,32,16,8,200,205,20,3,146,83,82,145,149,221,19,229,101,101,156,252,73,68,113,43,43,187,39,126,217,176,6,123,118,237,144,75,97,151,222,35,19,41,41,233,40,44,200,67,192,
+223,117,127,95,133,16,220,111,139,168,19,233,186,142,125,123,119,71,213,190,87,29,229,247,251,177,103,215,54,108,248,121,53,92,174,26,185,76,17,74,8,129,138,242,242,110,153,13,28,78,186,174,163,188,172,
+24,251,247,237,129,219,237,146,203,212,130,194,252,67,216,189,107,91,88,86,96,113,6,86,23,16,66,32,61,35,19,255,126,240,17,244,238,219,31,211,143,153,135,169,147,71,198,237,55,147,66,232,71,124,240,134,
+99,116,150,34,203,216,9,83,176,108,201,42,44,60,233,220,86,111,250,71,68,20,139,214,255,180,26,219,183,108,146,155,59,197,247,95,127,129,15,222,125,13,89,57,185,72,76,74,146,203,20,3,12,6,3,108,54,155,
+220,76,97,102,181,70,214,109,220,85,131,209,145,166,164,184,136,71,11,167,110,225,118,187,176,254,231,53,40,43,45,145,75,116,4,46,87,13,202,203,74,195,242,25,159,51,176,186,200,158,93,219,225,133,25,239,
+252,239,37,100,103,15,196,45,183,223,130,205,27,215,203,221,136,98,206,136,209,227,240,240,195,207,226,142,95,223,136,47,191,91,129,71,30,190,39,108,71,156,49,153,76,113,251,6,142,218,175,79,191,1,184,
+248,178,27,81,89,85,142,194,252,248,60,226,232,81,211,102,33,187,103,47,84,148,151,53,250,66,65,211,180,176,188,185,160,200,162,235,58,10,242,243,80,83,29,221,223,126,83,211,178,123,246,66,106,122,6,138,
+139,10,229,82,76,51,154,76,152,191,224,84,100,229,244,236,212,217,140,137,137,73,248,251,189,79,194,158,144,136,95,214,175,145,203,68,68,212,133,56,3,171,11,189,252,252,99,120,244,169,87,113,215,31,111,
+197,119,95,127,38,151,137,98,82,70,70,22,22,206,63,26,105,105,73,248,105,221,154,176,28,125,2,0,142,158,121,44,150,124,187,26,15,61,252,60,50,50,179,228,50,81,179,70,143,157,132,7,255,113,23,238,184,237,
+30,24,141,70,185,28,23,28,206,4,220,117,251,61,120,254,185,119,48,231,184,19,49,98,244,56,92,114,197,77,232,221,183,191,220,149,136,34,88,207,220,222,24,50,108,20,124,158,248,89,70,86,71,85,20,220,251,
+151,191,225,171,207,62,198,223,239,127,10,14,135,83,238,210,97,71,77,59,6,255,124,248,121,140,27,53,2,91,55,243,139,103,34,162,238,198,25,88,93,200,231,243,225,171,197,31,33,239,224,126,185,68,20,179,118,
+237,220,134,23,94,121,21,43,127,218,8,40,10,214,255,188,42,44,51,60,44,22,11,116,213,130,146,210,18,108,222,244,51,42,43,202,229,46,68,77,218,187,103,7,118,237,43,193,130,185,199,226,157,15,222,70,85,101,
+252,45,231,222,185,125,11,54,111,223,132,89,211,143,197,101,23,157,143,148,180,222,120,243,205,231,176,123,199,54,232,58,151,248,18,69,139,140,204,108,120,60,110,236,222,181,29,1,191,95,46,199,180,64,32,
+128,131,69,165,56,117,225,2,76,59,122,28,222,249,224,35,228,29,8,223,123,236,113,19,166,224,206,219,254,140,215,222,122,25,127,254,243,237,216,183,103,151,220,133,136,136,186,152,194,157,148,219,70,81,
+84,238,223,67,212,78,195,70,140,198,182,173,155,224,139,163,13,71,41,114,141,26,59,1,7,246,237,137,187,101,55,13,57,28,78,28,191,240,116,252,180,118,57,182,109,222,40,151,137,136,34,86,221,123,242,19,22,
+157,129,69,11,206,192,95,255,22,222,65,166,145,99,198,67,211,52,252,180,122,133,92,34,34,162,110,194,1,44,162,118,50,154,76,16,186,14,127,156,125,227,73,68,68,68,68,68,68,212,213,184,132,176,21,12,6,3,
+230,157,112,10,166,205,152,11,131,209,128,131,7,246,201,93,40,14,9,93,0,10,143,152,72,68,68,68,68,68,212,29,76,38,19,210,210,51,194,118,144,168,104,214,51,183,55,20,85,133,199,237,150,75,49,131,155,184,
+183,66,32,160,99,226,196,233,120,230,63,15,97,217,247,95,99,254,137,167,201,93,40,14,9,161,67,231,17,240,136,136,136,218,197,96,48,32,49,41,89,110,38,34,34,106,181,191,254,253,9,108,248,105,61,114,114,
+123,203,165,184,146,219,187,47,174,191,241,46,244,31,56,68,46,197,20,206,192,106,21,129,141,191,172,193,49,51,23,32,39,55,3,61,210,122,227,197,151,158,150,59,81,23,80,20,5,118,187,29,170,166,65,81,20,110,
+54,76,68,68,33,52,77,227,236,216,40,144,152,156,140,235,111,252,61,38,76,154,134,210,178,98,20,21,230,203,93,40,138,41,138,138,196,164,164,152,158,9,64,68,221,235,230,223,252,25,119,255,254,122,216,236,
+86,56,156,61,241,209,135,111,202,93,226,70,98,82,50,28,9,137,88,255,211,202,152,62,184,21,7,176,90,65,81,84,212,84,87,225,157,247,222,68,110,238,72,20,20,21,227,131,15,222,144,187,81,23,73,76,74,134,213,
+102,67,70,70,38,42,202,203,248,33,133,136,136,234,229,246,238,131,23,159,127,23,179,231,156,136,13,191,172,69,89,105,137,220,133,34,132,219,229,194,150,45,235,49,110,252,81,176,59,156,88,255,243,106,185,
+11,69,53,129,249,39,158,134,140,30,89,216,187,123,135,92,36,34,234,144,147,78,59,23,207,252,231,33,4,124,193,21,49,19,38,12,135,51,169,55,190,250,234,227,184,156,228,80,81,94,134,159,215,174,136,233,193,
+171,58,130,105,57,138,162,10,69,81,235,127,182,59,28,33,125,152,174,139,166,105,194,100,50,9,139,213,26,82,99,24,134,97,226,55,189,250,244,21,203,127,92,47,116,61,32,116,61,32,138,243,75,196,188,227,79,
+14,233,199,68,94,12,6,99,72,27,19,253,233,213,167,159,248,105,205,102,113,193,37,215,133,212,24,134,97,58,146,73,71,77,23,53,21,213,66,215,3,194,231,246,8,93,15,136,149,203,127,17,6,35,255,158,196,114,
+184,7,86,43,8,161,67,8,29,138,162,0,0,55,136,235,102,129,64,0,94,175,23,110,151,75,46,117,10,85,85,49,233,168,233,184,231,255,30,195,69,151,221,128,164,228,20,185,11,81,220,80,20,21,54,155,93,110,38,138,
+8,41,41,105,24,51,102,96,253,204,220,228,244,68,104,6,77,238,70,17,200,239,247,201,77,20,3,14,236,219,131,183,62,248,4,86,43,255,110,16,81,120,173,248,241,123,76,155,61,7,191,172,219,1,205,100,192,43,175,
+124,130,227,79,60,6,126,31,255,158,196,186,144,81,45,134,97,14,199,225,116,138,187,239,121,184,254,27,253,203,175,190,53,164,15,195,196,75,70,140,26,39,94,121,229,99,113,237,13,119,138,164,164,228,144,
+58,195,116,87,20,69,17,138,162,136,171,126,117,187,40,204,43,18,186,30,16,143,62,254,106,72,63,38,52,86,171,85,104,154,22,210,30,239,225,109,194,196,98,50,179,115,132,205,110,15,105,103,226,47,138,162,
+138,94,189,251,138,30,89,217,66,81,148,144,122,164,167,110,133,84,102,86,142,88,116,234,217,194,96,48,132,244,97,98,47,220,3,139,226,218,208,225,163,224,247,251,224,118,55,63,155,43,45,163,7,210,50,178,
+240,223,103,158,195,107,111,188,131,125,251,118,32,63,239,0,2,60,2,33,197,33,191,223,135,97,163,38,224,142,155,174,66,73,181,192,234,85,75,227,114,159,1,138,60,138,162,66,8,129,181,171,126,68,78,159,145,
+232,147,157,133,243,47,60,29,85,149,21,114,87,106,32,33,33,17,253,7,13,65,85,101,5,188,94,175,92,142,91,227,38,78,193,105,103,94,2,33,2,56,184,127,175,92,38,138,90,19,38,79,195,148,169,199,96,215,206,173,
+240,122,60,114,153,226,136,221,110,199,53,191,250,45,6,12,28,142,173,91,214,119,217,234,150,240,17,80,20,21,85,149,21,216,178,105,3,223,143,198,9,14,96,81,220,58,241,228,179,240,205,226,79,177,255,80,37,
+86,173,88,34,151,235,249,125,62,236,216,177,25,235,214,174,196,214,205,27,96,52,26,49,112,240,112,236,223,187,91,238,74,20,243,92,174,26,44,249,110,49,54,110,223,131,155,175,189,22,75,87,44,195,161,188,
+3,114,55,162,110,32,130,255,21,2,80,128,53,235,54,225,219,175,62,149,59,53,235,216,249,11,113,242,169,231,67,209,20,236,219,179,75,46,199,36,77,211,208,167,255,128,250,101,249,2,2,1,191,95,238,22,119,198,
+77,156,130,103,158,120,14,39,47,152,131,175,191,255,17,155,55,174,147,187,16,69,173,221,59,183,99,212,152,9,120,237,197,87,176,108,213,42,28,224,0,109,220,242,249,188,56,120,112,47,246,236,217,134,131,
+251,247,65,136,104,28,0,10,254,237,167,248,193,1,44,138,59,118,135,3,233,25,153,152,58,237,88,216,204,9,112,121,253,248,230,235,79,161,55,51,163,202,239,247,195,85,83,83,255,115,77,77,53,202,74,75,90,156,
+181,69,20,203,2,1,63,54,111,92,135,159,127,249,5,135,242,246,163,162,60,246,143,118,66,209,101,251,182,77,88,179,106,169,220,220,172,89,199,30,143,143,223,121,19,199,31,127,12,198,140,152,132,207,191,252,
+60,46,142,94,56,120,232,8,12,25,54,10,66,8,104,170,134,140,204,44,4,164,191,121,241,38,187,103,46,254,245,207,255,34,57,201,137,155,239,248,45,62,249,224,77,248,57,168,215,229,122,100,101,163,223,128,65,
+168,172,40,231,126,54,157,32,63,255,32,46,186,224,18,20,148,84,97,217,210,175,229,50,197,145,146,226,34,20,22,228,71,233,224,21,197,35,133,195,150,20,111,134,143,26,139,196,196,100,236,219,187,19,101,165,
+165,200,232,145,5,0,216,179,107,59,223,164,18,17,197,161,43,174,253,13,158,124,244,239,240,123,253,48,152,12,184,228,138,155,241,252,211,143,200,221,98,206,244,89,115,49,116,216,24,184,221,46,20,23,23,
+160,178,162,12,91,54,173,71,254,161,60,185,107,92,176,219,29,56,233,180,243,1,0,159,125,242,54,138,11,11,228,46,212,69,166,205,154,139,79,222,121,11,239,124,240,45,110,187,227,106,28,58,200,153,190,225,
+150,219,171,15,20,85,197,222,221,59,229,18,17,81,196,226,12,44,138,59,133,249,135,176,111,239,46,84,148,151,193,235,241,160,180,164,8,87,94,243,27,28,60,184,7,165,37,197,114,119,34,34,138,113,187,118,110,
+65,69,181,138,146,226,26,188,243,193,231,120,247,237,23,227,98,6,86,121,105,9,204,86,11,122,100,230,160,166,186,18,191,108,248,9,121,7,247,203,221,226,134,16,58,182,110,94,143,181,171,151,193,85,83,13,
+69,81,249,61,111,55,217,187,123,39,54,239,220,143,223,220,120,21,182,239,201,199,207,107,151,203,93,168,131,42,202,203,80,94,86,42,55,19,17,69,52,206,192,34,2,144,148,146,2,175,219,131,154,154,106,185,
+68,68,68,113,194,102,179,161,38,206,150,207,41,138,138,172,236,28,84,84,148,161,170,178,82,46,19,117,171,156,220,94,8,248,253,56,148,119,80,46,17,17,81,28,226,0,22,17,17,17,17,81,39,178,217,237,176,90,
+109,240,184,221,168,170,226,64,33,17,17,81,123,168,114,3,17,17,17,17,17,133,79,66,66,18,122,245,233,15,103,98,162,92,34,34,34,162,86,226,12,44,34,34,162,56,209,35,43,27,195,71,142,69,114,114,26,108,54,
+7,222,125,243,69,84,86,86,200,221,136,226,82,98,82,50,76,38,19,10,11,242,229,82,135,89,44,86,36,36,38,162,168,176,0,186,206,163,125,81,247,210,12,6,4,120,224,34,34,138,66,156,129,69,68,68,20,39,204,102,
+11,188,94,47,118,110,223,140,181,107,126,132,203,237,146,187,16,197,45,33,4,2,129,128,220,28,22,110,183,11,5,249,135,56,120,69,221,74,81,20,156,114,198,5,24,50,116,132,92,34,34,138,10,156,129,213,69,44,
+22,11,20,69,129,203,197,15,11,68,209,196,233,76,128,203,85,3,63,191,169,36,138,89,70,147,9,9,9,137,40,41,46,130,16,124,91,68,68,177,167,103,175,62,24,49,106,28,244,64,0,43,150,125,31,23,71,90,37,162,216,
+195,25,88,93,196,230,112,34,35,51,27,57,185,189,144,146,154,38,151,137,40,2,153,76,38,28,59,255,36,36,38,39,67,211,52,185,76,68,49,194,108,50,33,51,187,39,12,6,131,92,138,90,154,166,193,100,54,203,205,
+68,20,167,146,146,146,177,127,223,110,124,254,201,123,28,188,34,162,168,165,1,184,91,110,164,240,115,187,92,232,221,167,31,6,12,26,6,77,211,112,40,239,128,220,133,136,34,76,70,102,22,44,86,27,242,246,239,
+67,70,102,22,42,202,203,228,46,68,20,3,188,94,47,10,99,104,121,151,162,168,56,251,252,43,96,48,106,56,120,96,159,92,38,162,56,84,144,127,8,5,249,121,114,51,17,81,84,225,12,172,46,34,132,192,190,125,187,
+81,92,84,128,138,242,114,185,76,68,17,168,170,178,18,69,5,135,0,69,129,221,225,132,213,106,147,187,116,187,126,3,6,161,111,191,129,114,51,17,197,177,169,51,142,193,13,87,255,10,14,39,143,120,71,68,109,
+163,40,42,122,246,234,13,51,103,112,18,81,4,226,0,86,23,42,41,42,194,154,149,63,34,239,192,94,185,68,68,17,168,178,162,28,206,132,68,88,44,22,20,28,202,131,215,235,145,187,116,171,1,131,134,226,218,235,
+126,139,223,220,118,15,114,123,245,145,203,68,20,103,20,69,197,252,5,167,226,119,183,253,9,118,155,25,85,60,194,36,17,181,145,16,58,134,13,31,139,27,127,125,55,236,118,135,92,38,34,234,48,187,195,129,180,
+244,12,185,185,85,56,128,213,197,252,126,63,55,114,39,234,4,138,162,194,96,52,202,205,29,182,123,231,54,148,150,150,160,168,176,32,226,54,114,239,63,112,8,46,59,255,100,92,122,254,73,152,116,212,76,185,
+76,68,113,104,200,208,209,24,60,32,23,170,170,192,198,15,159,68,212,14,159,127,242,46,118,239,222,142,147,79,191,0,118,7,95,71,136,40,188,108,118,59,134,141,28,11,155,205,46,151,142,136,3,88,68,20,19,76,
+38,35,18,18,194,191,92,166,32,255,16,188,158,200,154,121,85,103,201,55,95,224,238,191,255,19,101,101,149,176,68,224,242,70,34,234,90,66,232,120,244,159,247,224,172,139,206,197,186,141,59,96,179,241,131,
+103,188,72,73,77,131,197,98,145,155,169,29,210,123,100,118,202,251,137,104,243,250,43,79,195,100,50,99,50,191,32,35,106,179,148,212,52,30,72,165,5,54,155,3,115,230,156,136,63,252,233,159,72,78,73,149,203,
+71,36,152,208,12,28,60,76,156,119,241,53,194,98,181,10,0,98,234,244,99,196,132,73,83,67,250,49,12,195,116,103,84,85,21,195,71,142,17,185,189,251,134,212,152,214,101,206,113,11,197,185,23,94,37,20,69,13,
+169,49,157,19,77,211,132,162,40,33,237,76,248,146,149,221,83,244,200,204,10,105,103,98,43,131,135,14,23,247,252,237,223,98,241,23,203,197,132,201,124,159,218,209,12,26,60,76,188,244,242,135,98,212,152,
+241,33,181,120,140,166,25,132,195,225,12,105,103,24,166,233,88,173,54,113,238,133,87,137,165,75,126,22,163,199,78,12,169,51,193,88,44,86,113,195,45,127,16,27,126,222,38,178,178,115,66,234,45,69,169,253,
+7,53,144,154,150,142,239,190,90,138,161,35,250,225,237,183,191,198,230,109,91,113,231,237,87,97,207,206,60,76,156,58,30,69,5,249,242,73,136,136,40,74,157,123,209,213,72,112,38,225,137,71,255,46,151,168,
+147,40,138,138,99,230,30,143,227,231,159,138,141,155,214,227,205,255,61,131,74,238,215,68,17,198,153,144,8,147,217,140,226,194,2,185,20,17,178,178,115,176,232,212,11,144,155,211,11,107,127,90,142,47,62,
+121,23,21,21,60,80,80,123,25,12,6,92,117,221,237,48,155,45,120,242,223,255,64,117,117,149,220,133,136,168,69,147,167,206,192,183,159,127,6,205,168,97,210,209,51,176,118,213,50,185,11,213,74,76,74,66,239,
+190,3,176,117,243,47,112,183,113,139,165,144,81,173,120,142,166,105,226,157,119,190,18,186,30,104,50,239,189,247,77,200,105,24,134,97,152,232,15,103,4,117,109,94,127,227,139,250,191,173,207,60,251,142,
+208,52,45,164,15,195,116,87,122,100,101,139,229,63,174,23,215,221,248,187,144,90,164,36,53,45,93,76,155,121,172,176,88,130,171,5,152,142,197,100,54,139,9,147,143,22,170,218,117,179,113,13,70,99,253,106,
+15,134,97,162,63,189,251,244,23,183,255,238,239,226,129,127,62,43,122,246,234,19,82,103,58,30,206,192,146,76,156,50,13,203,151,126,43,55,55,50,123,222,137,248,102,241,39,114,51,17,17,17,181,66,90,122,6,
+54,173,219,136,212,30,201,0,128,226,252,82,12,25,57,20,197,69,133,114,87,162,46,55,118,252,100,60,249,232,127,113,224,80,33,110,188,233,50,236,221,179,171,81,189,119,223,254,24,58,124,52,62,251,232,29,
+8,193,183,209,212,126,3,6,13,65,66,98,50,214,172,252,81,46,17,17,81,19,184,137,187,164,162,162,12,1,127,64,110,110,164,119,239,1,114,19,17,117,51,155,221,142,156,220,94,48,155,205,48,24,12,114,153,0,36,
+38,38,97,212,216,9,152,115,220,137,184,246,198,59,49,247,248,147,144,148,20,28,64,32,234,74,3,7,15,71,106,143,100,232,1,29,69,135,74,224,116,218,49,102,220,100,185,27,69,129,41,71,207,66,207,94,125,228,
+230,168,102,119,58,241,226,235,175,227,236,179,79,8,25,188,2,128,30,153,217,184,245,134,219,49,106,236,4,185,68,212,38,213,213,85,112,56,156,176,243,136,161,68,49,65,81,56,188,210,22,227,39,29,133,233,
+199,204,147,155,91,196,25,88,77,248,205,111,255,134,127,252,245,118,185,25,0,240,211,234,45,152,115,220,116,148,150,20,203,37,0,128,201,108,134,30,8,192,239,247,203,37,34,234,68,137,137,73,24,56,120,24,
+242,242,14,160,170,178,28,229,101,101,114,151,184,166,105,26,254,126,223,127,112,230,201,243,145,159,95,130,9,147,135,1,0,238,123,240,89,252,246,182,43,161,235,186,124,18,162,78,147,157,147,139,241,147,
+142,70,85,85,5,188,30,15,236,14,39,118,110,223,140,237,91,55,203,93,41,130,13,31,53,6,95,127,250,5,46,190,250,26,124,252,254,155,114,185,211,168,154,6,61,208,242,151,141,157,201,238,112,96,228,232,9,216,
+189,107,27,14,29,60,32,151,137,90,77,81,84,100,102,101,163,186,170,18,149,149,149,16,130,127,139,137,162,153,162,168,124,30,183,193,175,110,186,11,123,247,238,192,251,111,191,42,151,90,20,178,174,48,222,
+163,105,154,120,232,225,231,67,246,191,218,190,101,143,24,60,108,100,72,255,195,167,51,136,225,35,199,136,225,163,198,132,212,24,134,233,252,216,236,118,97,48,26,67,218,25,8,187,195,33,246,237,62,24,242,
+186,182,115,219,94,222,102,12,195,180,57,14,167,83,188,252,242,71,98,229,242,95,68,191,1,131,66,234,157,149,204,236,28,49,255,196,83,133,221,110,15,169,49,237,203,244,89,115,197,228,169,51,234,127,78,207,
+232,33,108,54,222,190,12,195,48,109,141,162,168,93,186,143,94,180,103,242,212,25,162,103,110,239,144,246,150,194,57,110,77,8,4,2,184,249,198,139,176,224,164,179,80,82,80,6,119,149,27,191,190,227,111,152,
+52,117,60,182,108,92,47,119,175,103,50,153,144,149,211,11,115,231,157,130,185,243,23,113,25,19,81,23,171,169,174,134,223,231,147,155,9,64,117,85,21,238,125,248,137,70,109,85,101,85,184,229,206,223,241,
+54,163,110,161,40,106,125,40,250,76,62,106,38,4,128,69,167,28,135,157,219,183,202,229,78,147,148,148,130,129,3,135,195,238,76,144,75,212,14,55,220,242,71,124,243,229,39,248,246,243,79,113,230,185,151,161,
+223,128,65,200,238,217,11,70,147,81,238,74,68,68,71,32,132,206,85,13,109,176,124,233,119,216,191,111,143,220,124,68,33,163,90,204,225,100,231,228,54,250,102,81,81,90,30,81,237,221,183,191,184,226,154,91,
+197,9,139,206,16,6,3,103,53,48,12,19,57,57,110,193,41,194,85,89,93,63,251,234,253,247,190,17,57,185,189,66,250,49,12,195,28,41,57,185,189,68,175,62,253,66,218,59,59,138,162,136,164,228,20,97,48,24,66,106,
+76,235,163,105,154,248,205,111,255,47,100,86,238,150,141,187,196,5,151,92,199,163,130,50,12,195,48,17,25,238,129,213,9,236,118,7,60,30,55,247,193,138,16,54,187,29,154,166,161,178,162,2,0,160,40,10,18,19,
+147,80,86,86,42,119,37,138,89,138,162,226,143,247,252,19,70,163,9,223,126,243,9,134,14,27,139,27,174,186,20,55,222,118,43,62,124,247,117,185,59,17,17,197,176,163,103,204,193,247,223,124,46,55,3,0,202,139,
+43,113,204,252,121,248,105,245,10,185,68,109,96,50,153,49,108,228,104,252,178,254,39,248,188,94,185,76,68,68,237,192,1,44,138,121,195,71,141,69,118,118,46,190,252,226,35,88,204,22,204,61,254,36,28,60,176,
+23,43,151,45,145,187,18,197,52,187,221,14,151,219,93,191,249,113,239,190,253,81,90,82,132,138,242,114,185,107,179,184,57,37,17,81,244,155,61,119,1,254,247,252,115,72,203,76,145,75,0,128,183,222,250,10,
+103,156,49,87,110,166,54,48,153,204,24,52,100,24,54,111,218,192,165,250,68,68,97,162,1,184,91,110,36,138,37,37,69,133,176,59,157,24,51,110,50,250,244,27,8,183,171,6,75,191,255,10,66,112,236,150,226,139,
+207,231,131,16,162,118,207,33,129,242,178,82,120,60,30,185,91,139,140,38,99,240,155,15,62,127,136,136,58,205,152,113,147,144,146,150,134,194,130,124,185,20,22,69,69,5,40,173,10,224,248,185,179,160,168,
+138,92,198,63,30,120,8,235,126,90,41,55,71,141,148,212,52,184,221,238,110,253,158,62,16,8,160,32,255,16,247,195,33,34,10,35,14,96,81,204,19,66,160,164,184,8,253,7,12,134,162,168,248,236,227,119,248,225,
+155,194,98,244,216,137,56,97,209,153,200,204,202,70,222,129,189,240,69,205,55,172,237,127,252,235,129,0,159,63,68,68,157,36,53,61,29,191,189,235,62,252,253,79,119,227,147,207,63,199,222,61,59,229,46,97,
+225,245,120,176,103,247,54,236,218,87,138,36,71,26,42,43,106,176,121,243,110,188,251,209,87,248,211,61,127,198,251,111,191,26,213,3,47,19,166,76,195,248,137,83,81,81,81,138,202,138,214,207,50,38,234,136,
+164,164,100,120,107,191,44,108,200,96,52,194,98,181,70,209,251,68,162,200,197,37,132,20,87,52,77,67,160,118,249,20,81,91,36,36,36,66,211,52,148,150,150,212,183,245,237,63,16,61,115,251,32,63,255,32,118,
+239,220,14,111,27,103,51,17,17,17,53,244,192,63,159,197,205,55,92,136,119,223,249,6,23,92,120,18,170,171,171,228,46,97,161,40,42,140,38,35,12,154,1,86,155,21,86,155,3,62,175,7,249,135,242,228,174,81,107,
+234,140,217,56,118,206,34,228,23,228,225,249,167,31,174,157,145,69,212,121,78,61,243,66,84,85,150,227,187,175,63,107,244,120,179,59,28,72,76,76,198,193,3,251,26,245,39,162,182,83,199,77,60,74,110,35,138,
+89,28,188,162,246,170,172,172,68,133,244,45,238,174,29,219,240,253,55,95,96,235,166,95,56,120,69,68,68,29,146,219,187,47,6,244,237,139,165,75,214,225,246,59,127,213,105,131,87,117,244,64,0,53,53,213,40,
+46,42,194,254,189,187,235,7,175,130,203,204,163,131,197,106,133,209,100,146,155,1,0,219,54,255,130,241,163,199,224,168,73,83,97,48,26,229,50,81,216,245,235,55,24,255,248,203,63,48,100,248,232,70,237,213,
+85,85,28,188,34,10,19,245,137,71,254,3,103,66,162,220,78,68,68,13,8,161,115,0,148,136,136,58,133,213,106,197,81,71,31,131,123,31,252,11,78,62,237,56,108,219,178,73,238,18,86,193,191,105,58,20,69,13,73,
+52,81,21,5,170,26,122,153,83,211,210,113,243,173,127,194,11,175,62,135,139,47,58,9,85,149,149,114,151,86,25,51,110,18,70,143,155,40,55,19,53,105,221,207,43,160,42,10,116,157,239,23,137,58,139,114,253,205,
+127,16,79,61,126,47,167,213,18,17,17,17,17,117,3,77,211,96,52,154,224,118,187,0,0,189,250,244,195,161,188,3,156,221,219,78,86,155,13,169,169,233,216,191,111,143,92,106,147,63,255,237,223,184,244,188,211,
+112,250,185,103,97,217,15,223,202,101,162,70,20,69,65,78,110,111,148,20,21,160,166,166,70,46,19,81,24,104,43,150,125,123,183,223,239,151,219,137,136,136,0,0,35,70,141,197,130,147,206,65,159,190,3,176,109,
+235,70,136,40,222,216,151,168,51,13,28,60,12,83,167,29,3,103,98,34,242,184,92,132,218,64,8,129,186,247,227,138,162,34,61,163,7,170,42,203,235,219,168,109,252,62,95,200,178,255,246,168,169,169,194,49,51,
+230,160,176,180,10,203,127,228,0,22,29,89,69,121,25,55,107,39,234,68,161,115,110,137,136,136,0,12,28,50,12,175,188,250,9,214,174,92,142,167,159,184,31,111,191,254,60,46,189,242,102,185,27,17,213,206,160,
+201,204,202,65,159,126,131,195,186,53,131,221,238,192,240,81,99,229,102,138,97,66,232,216,190,117,19,92,174,224,108,172,120,48,255,196,211,112,202,25,23,200,205,221,110,249,143,223,97,206,113,211,240,229,
+226,15,160,40,138,92,38,34,162,46,198,1,44,34,162,46,98,50,153,113,194,162,211,209,167,223,0,0,192,130,147,206,68,70,143,76,185,91,196,200,202,234,137,179,207,154,7,205,168,213,183,45,156,127,98,163,62,
+68,20,20,8,4,240,253,55,95,224,209,135,238,193,55,139,63,145,203,237,166,235,58,174,186,242,215,184,248,242,27,155,221,172,154,40,154,93,117,221,237,120,255,205,87,160,170,135,255,214,68,146,210,146,18,
+252,178,110,45,132,224,129,219,137,136,186,155,6,224,110,185,145,136,136,194,207,104,50,225,129,123,31,195,228,41,51,225,213,3,176,90,237,216,182,117,99,253,158,39,145,102,207,238,29,216,188,35,15,167,
+157,180,160,254,155,231,191,223,255,79,252,180,102,185,220,149,136,58,137,223,239,131,205,233,196,51,143,63,4,123,82,47,124,249,197,135,0,248,65,154,162,159,162,168,56,239,226,171,241,143,63,253,14,167,
+157,123,1,62,124,247,53,185,11,17,181,65,114,74,42,28,14,39,106,106,170,229,18,81,204,224,0,22,17,81,23,241,251,253,240,43,42,254,252,199,91,112,238,217,167,227,209,199,30,199,214,77,27,228,110,17,229,
+151,117,107,176,124,245,122,8,221,142,103,158,127,21,47,62,251,47,238,201,66,212,197,118,238,216,130,237,123,242,145,145,158,137,239,190,253,140,71,68,165,152,160,170,10,134,14,27,141,127,63,249,24,190,
+255,250,115,185,76,68,173,164,40,10,70,141,153,128,161,195,71,35,43,39,23,14,135,19,110,87,13,60,158,142,29,164,109,200,240,145,152,54,115,46,50,50,179,177,103,215,14,185,220,165,146,146,83,224,112,114,
+112,142,0,133,95,227,17,17,117,173,147,79,63,31,137,137,201,120,249,249,39,224,247,71,238,70,159,138,162,66,8,110,216,78,20,41,12,6,3,7,144,137,136,168,145,193,195,70,96,230,172,19,96,179,217,16,8,4,80,
+89,89,129,189,123,183,227,171,207,63,146,187,182,201,77,183,222,141,187,239,184,9,15,63,249,34,254,248,187,235,229,114,151,26,53,118,2,20,69,193,207,107,86,202,37,138,51,156,129,69,68,212,197,54,111,92,
+135,159,215,174,128,30,241,71,243,19,80,20,181,118,249,96,240,187,14,69,81,249,189,7,81,55,137,196,215,140,30,153,89,176,218,236,72,76,74,70,85,101,133,92,38,34,162,86,114,56,157,24,63,249,104,148,22,23,
+193,231,243,202,229,102,245,235,63,8,179,102,206,67,110,118,47,120,188,94,148,150,22,97,207,174,109,56,148,119,64,238,218,38,154,65,69,89,165,142,255,62,245,32,202,203,74,229,114,151,202,63,116,16,249,
+121,7,229,102,138,67,156,129,69,68,68,68,68,237,98,50,155,161,42,42,20,85,129,171,166,70,46,19,17,209,17,12,28,60,20,19,39,207,196,146,239,62,71,82,82,50,76,102,11,92,174,26,252,178,110,173,220,181,73,
+14,135,19,103,158,123,57,82,211,50,240,253,183,159,98,235,150,141,40,41,42,148,187,181,153,221,225,128,217,108,65,73,113,145,92,34,234,54,28,192,34,34,34,34,34,34,34,234,6,211,102,30,139,23,158,122,6,87,
+223,116,3,62,255,248,93,204,57,110,33,252,126,31,190,253,242,83,185,107,179,140,38,19,12,154,1,46,23,191,72,160,216,198,37,132,68,68,68,68,68,68,68,221,96,239,158,157,216,184,125,39,102,207,94,128,253,
+251,119,33,239,192,62,120,61,110,20,183,97,22,149,30,8,68,244,190,170,68,225,194,1,44,34,34,34,34,162,56,166,40,10,134,12,31,5,183,171,6,94,111,235,247,222,33,162,240,216,185,125,11,202,43,74,112,202,169,
+23,98,201,119,159,99,255,190,189,114,23,34,226,18,66,34,34,34,34,162,248,166,105,26,54,252,188,21,6,131,134,115,47,190,0,43,151,125,47,119,33,162,35,80,20,21,170,170,32,16,8,200,165,86,59,97,209,25,176,
+219,157,88,250,253,98,28,216,207,65,44,34,25,103,96,17,17,17,17,17,197,49,33,4,118,238,59,128,139,207,63,7,215,94,123,5,252,72,196,242,101,223,118,232,131,56,197,182,158,189,250,192,225,116,162,178,130,
+71,31,173,163,105,42,6,15,27,1,87,27,103,50,106,154,1,154,65,131,174,235,216,190,117,51,238,252,237,95,144,154,145,141,85,43,151,64,231,115,144,58,32,41,57,5,199,206,95,132,154,154,42,84,148,151,203,229,
+168,164,202,13,68,68,68,68,68,20,95,62,249,224,45,76,153,49,29,47,189,252,49,22,206,59,22,78,103,130,220,133,8,0,48,98,244,56,156,116,202,121,176,219,29,114,41,174,9,33,96,181,218,97,52,154,228,82,139,
+146,82,146,113,237,13,119,226,168,233,199,64,81,128,117,191,172,67,90,106,58,84,149,31,213,227,145,209,100,130,162,132,231,190,119,187,93,48,155,45,152,123,220,201,200,202,233,41,151,163,18,151,16,18,17,
+17,17,17,81,61,131,193,0,191,223,47,55,19,97,206,188,19,145,158,145,137,239,191,249,156,75,220,154,160,105,90,155,103,46,106,154,134,73,71,205,192,51,79,252,23,159,127,189,20,95,125,243,9,150,47,253,6,
+135,242,14,202,93,41,198,13,31,57,6,23,94,252,43,252,233,15,55,162,166,186,90,46,183,91,98,82,50,2,126,63,170,170,42,229,82,212,9,207,208,30,17,197,173,132,132,68,126,3,71,68,68,49,237,168,105,199,96,224,
+144,97,114,115,204,226,224,21,53,165,79,223,1,56,225,132,211,177,108,233,55,28,188,106,70,91,7,175,80,123,154,31,151,124,141,11,46,187,16,235,54,172,229,224,85,156,26,56,120,24,158,252,247,179,152,117,
+212,100,8,93,151,203,29,82,94,86,26,19,131,87,224,30,88,68,212,17,153,217,57,56,246,184,147,112,240,192,30,84,87,85,201,101,34,34,162,176,211,12,6,140,28,61,14,170,166,162,170,178,115,247,223,233,63,112,
+48,174,186,246,54,156,112,220,34,252,184,236,91,20,22,228,203,93,136,226,134,162,42,216,176,97,45,118,237,216,42,151,40,12,14,30,216,135,181,171,127,140,153,129,6,106,155,163,103,204,129,197,150,136,251,
+31,250,27,246,236,218,201,133,114,205,224,18,66,34,106,151,17,163,198,98,222,252,83,177,228,251,207,177,226,71,30,173,136,136,136,186,198,144,225,35,177,244,235,239,112,195,109,191,195,75,207,61,38,151,
+195,102,230,236,249,248,232,237,55,160,105,26,166,205,153,131,213,43,126,148,187,80,39,80,20,21,66,132,119,246,1,17,17,197,6,46,33,36,162,54,75,72,72,196,130,133,103,227,251,239,62,139,216,193,171,134,
+155,31,42,138,10,69,81,97,48,24,96,52,181,109,99,77,34,34,138,44,123,118,237,192,130,83,79,197,210,37,139,229,82,88,89,109,54,216,18,108,168,170,106,219,17,197,58,155,205,102,135,221,110,151,155,163,158,
+162,168,112,38,36,32,53,61,93,46,17,69,52,77,211,144,144,152,196,77,215,35,144,162,40,141,126,238,217,171,15,82,211,248,26,19,205,184,132,48,206,217,236,118,248,124,62,185,153,168,69,138,162,98,223,222,
+29,248,101,253,90,185,20,49,12,6,13,138,162,64,8,1,64,64,85,21,152,76,38,152,204,22,248,188,62,78,62,37,138,114,70,147,9,169,105,233,168,169,230,242,229,120,227,247,249,176,127,239,110,148,150,20,203,165,
+176,218,190,117,19,118,237,43,193,49,211,167,97,217,234,159,176,121,227,58,185,75,183,56,227,156,203,112,220,241,167,98,201,119,95,200,165,168,102,54,155,144,158,145,137,138,242,50,12,30,58,2,2,130,207,
+111,138,10,22,171,21,163,199,78,68,254,161,3,237,218,3,139,194,71,81,84,24,77,70,40,181,131,85,16,2,30,143,27,0,208,171,79,63,60,246,175,231,96,178,37,96,213,138,37,242,73,41,74,112,152,56,78,153,45,22,
+156,115,193,149,88,183,102,35,46,189,234,22,185,76,212,34,183,219,133,157,17,190,255,129,223,239,135,213,102,195,25,231,92,138,145,99,198,65,215,117,184,221,30,84,87,87,113,105,2,81,12,80,21,5,26,191,237,
+166,78,246,194,51,143,226,234,155,110,194,204,25,243,194,118,88,243,142,176,88,172,184,245,250,27,112,253,21,23,192,108,54,203,229,168,230,241,120,176,103,247,78,64,0,191,189,237,30,44,88,120,150,220,133,
+40,34,185,106,106,176,118,245,50,120,189,156,20,208,221,140,38,35,146,146,146,97,177,88,97,177,88,224,118,187,234,107,3,7,13,195,204,105,99,26,245,167,232,20,156,158,192,196,85,210,51,122,136,93,219,246,
+9,93,15,136,111,190,90,21,82,103,152,88,200,89,231,93,46,116,61,32,10,243,138,196,168,177,19,66,234,12,195,48,12,211,154,100,229,244,20,154,166,133,180,119,117,76,102,179,248,235,223,31,23,255,119,239,
+147,194,96,48,134,212,99,33,102,179,89,76,157,49,91,244,237,63,40,164,198,48,12,211,154,200,175,215,41,169,105,226,195,15,190,23,91,54,238,18,195,70,142,9,233,207,68,79,184,137,123,28,27,48,120,40,22,127,
+252,5,2,1,29,35,70,15,129,203,85,35,119,33,138,74,61,50,179,112,250,89,151,226,239,119,223,14,123,98,112,159,144,141,235,119,98,202,209,227,120,100,23,34,34,162,8,101,48,24,160,168,42,124,17,180,231,88,
+91,245,236,213,27,135,14,30,132,223,31,59,179,113,38,78,153,14,183,171,26,59,182,111,65,77,117,181,92,166,110,98,54,91,224,247,251,184,108,241,8,156,9,137,184,230,87,119,64,215,117,60,253,159,7,59,125,
+249,57,117,190,144,81,45,38,126,210,187,111,127,113,211,173,127,18,25,61,50,67,106,12,19,173,121,224,159,207,10,93,15,8,93,15,136,64,192,47,116,61,32,10,14,22,10,187,221,17,210,151,97,24,134,97,152,200,
+136,201,100,22,70,163,41,164,61,90,242,235,219,255,42,92,85,53,226,251,111,215,136,126,3,162,99,6,89,191,1,131,196,144,97,35,67,218,21,69,21,99,198,77,18,215,223,252,123,145,183,47,95,236,219,157,39,70,
+142,25,31,210,143,233,250,164,165,103,136,62,253,6,136,9,147,167,138,164,228,148,144,58,211,56,138,162,242,179,110,12,133,155,184,199,185,242,178,82,44,91,250,13,106,106,106,106,31,19,68,209,175,160,48,
+15,58,18,49,184,111,47,88,108,102,8,93,224,194,203,175,197,186,159,86,201,93,137,26,81,20,5,138,162,64,85,85,104,6,67,131,3,1,4,55,13,87,21,5,186,206,61,212,136,136,58,67,32,16,128,174,71,231,108,146,179,
+207,191,2,79,254,251,239,208,12,26,114,115,123,224,204,83,206,196,91,239,189,139,242,178,82,185,107,68,73,74,74,65,175,62,253,144,146,154,142,180,244,12,148,150,20,67,15,4,96,119,216,241,206,27,31,225,
+210,75,78,71,101,121,53,46,185,230,42,172,93,189,156,179,125,34,192,208,17,163,48,116,216,24,4,2,1,236,216,190,5,58,239,147,35,16,168,174,61,32,132,124,84,66,138,62,28,192,162,90,28,188,162,216,160,40,
+42,14,29,220,143,143,63,124,19,175,191,253,54,246,30,168,192,67,15,63,140,143,222,123,93,238,74,49,232,184,5,167,32,59,39,23,123,119,239,148,75,71,100,52,153,160,106,26,0,192,96,52,194,98,182,64,8,1,93,
+23,80,20,192,106,181,65,85,85,30,185,149,136,40,134,140,159,52,21,195,71,142,197,206,237,91,228,82,171,245,236,213,7,239,188,246,26,54,172,219,129,139,175,184,2,175,188,246,6,230,204,58,22,5,165,213,248,
+121,205,242,250,47,66,34,81,89,105,9,118,237,216,134,148,212,52,140,26,61,17,7,247,239,65,77,117,53,252,62,63,14,20,228,163,71,90,111,188,251,241,231,120,225,153,71,161,106,26,210,211,123,160,170,178,66,
+62,27,234,66,169,105,25,24,56,104,4,86,44,251,22,101,165,37,114,153,40,166,113,15,44,34,138,57,138,162,242,72,131,113,232,172,243,46,199,127,30,121,0,167,156,125,46,190,250,226,35,185,76,68,68,212,72,82,
+114,10,254,243,228,255,48,253,168,209,152,57,247,24,108,221,188,81,238,210,42,86,171,13,57,185,189,176,127,223,30,184,93,135,143,122,230,112,58,81,83,83,19,245,51,100,12,6,35,252,126,95,253,12,101,206,
+194,234,94,54,155,13,41,169,233,56,148,119,0,126,191,95,46,19,197,52,14,96,17,81,204,226,64,86,247,178,88,44,152,56,101,58,74,138,11,177,109,203,38,248,253,190,78,91,126,55,98,244,56,124,246,254,71,248,
+203,253,255,194,227,255,250,155,92,38,34,34,10,145,221,51,23,35,71,79,64,66,98,50,82,146,211,241,229,23,239,99,251,214,77,114,183,54,81,20,21,0,248,254,131,136,168,19,112,0,139,136,136,58,133,213,106,195,
+227,79,188,138,147,23,204,196,151,223,174,70,175,158,153,120,250,197,23,241,196,163,127,151,187,118,216,228,169,51,144,157,211,11,239,188,241,146,92,34,34,34,58,162,81,99,39,160,184,168,0,7,246,237,149,
+75,68,68,20,33,56,128,69,68,68,157,38,187,103,46,62,122,247,115,140,30,55,8,0,176,232,212,115,241,225,187,175,201,221,168,147,217,29,14,24,12,198,136,223,76,152,218,207,98,177,192,231,227,225,212,137,136,
+162,65,98,82,18,122,245,233,143,237,91,55,193,85,83,35,151,35,66,74,90,58,50,50,50,177,119,247,78,212,212,84,203,101,162,110,193,77,220,137,136,168,211,84,86,84,224,139,175,190,192,172,105,199,225,246,
+223,255,25,111,188,250,172,220,133,186,64,70,143,76,88,44,86,84,148,151,1,0,6,12,26,130,126,3,6,227,224,129,125,114,87,138,82,131,134,14,135,30,8,240,67,6,81,59,5,151,254,9,40,138,90,127,68,218,224,17,
+203,248,93,127,180,24,60,108,4,78,57,253,2,76,152,52,29,85,149,101,40,46,42,148,187,68,140,169,211,103,99,200,176,209,216,181,99,107,196,14,96,165,166,166,227,226,75,111,192,228,163,102,193,104,54,162,
+224,208,65,248,124,94,185,27,81,151,226,0,22,17,17,117,170,210,146,98,188,254,214,255,176,252,199,111,229,18,117,145,202,138,114,84,148,151,193,96,48,98,242,212,153,152,59,239,100,84,86,150,99,199,182,
+205,114,87,138,82,133,5,249,24,51,126,50,18,147,147,81,144,159,39,151,137,232,136,130,131,87,117,20,5,80,85,37,162,143,32,72,141,5,252,126,152,205,102,228,244,236,131,146,146,66,236,223,183,91,238,18,49,
+220,174,106,108,250,229,103,148,20,23,201,165,136,81,81,81,142,109,219,55,98,200,208,81,56,231,244,115,177,105,235,70,28,216,207,37,182,212,189,248,181,2,17,17,81,156,56,247,162,171,241,210,179,255,134,
+30,208,177,232,180,115,241,217,71,111,35,57,37,21,110,151,11,85,85,149,114,119,138,96,154,166,161,119,223,254,216,181,99,59,82,82,83,49,105,202,12,252,235,129,7,145,157,149,134,133,167,159,133,175,190,
+248,152,155,72,19,181,17,15,254,66,20,42,53,45,29,195,70,142,193,150,141,235,81,144,127,72,46,19,117,41,206,192,34,34,34,138,3,137,73,73,0,4,6,15,24,131,62,253,178,49,111,214,108,124,186,120,113,253,97,
+184,163,113,239,164,241,147,166,194,100,52,197,233,222,94,10,76,38,35,170,171,171,176,224,164,179,240,214,107,207,35,193,105,199,123,31,125,135,181,235,86,99,215,206,109,156,57,66,212,102,2,14,135,19,83,
+167,207,134,35,33,1,35,70,141,195,57,231,95,5,151,187,154,75,174,9,168,29,228,52,154,140,208,163,240,111,102,123,185,106,106,176,119,247,78,84,87,87,201,37,162,110,33,24,134,97,24,134,137,221,56,28,78,
+177,240,148,179,5,0,161,105,154,120,237,181,207,132,174,7,196,196,41,211,66,250,70,83,178,115,114,133,195,233,12,105,143,183,252,250,246,191,136,128,223,47,78,88,116,70,125,155,217,98,9,233,199,48,204,
+145,51,100,248,40,113,96,79,158,200,63,80,32,124,30,175,208,245,128,248,227,61,143,132,244,99,226,51,22,139,69,36,37,167,132,180,51,12,211,53,225,18,66,34,34,162,24,167,105,26,204,102,51,92,46,55,132,208,
+145,158,209,3,99,39,28,133,31,151,124,141,202,138,114,185,59,69,153,227,23,158,142,234,170,10,124,247,245,231,64,131,251,187,166,147,55,6,182,88,44,112,187,221,114,51,81,84,179,90,173,248,244,227,37,152,
+62,115,76,125,219,113,39,156,130,47,62,125,191,81,63,138,79,22,139,21,118,135,35,162,55,136,143,68,14,167,19,186,174,67,8,17,177,155,214,83,116,224,0,22,17,17,81,156,168,59,202,86,172,45,45,75,76,76,130,
+215,231,229,155,226,6,247,177,170,170,157,186,44,212,108,54,35,43,39,23,187,119,110,151,75,68,81,169,110,3,119,33,116,156,114,198,249,120,235,181,231,1,0,43,151,111,196,172,217,147,224,114,185,164,83,80,
+60,50,24,12,112,56,156,40,139,203,165,235,237,163,105,26,146,83,82,97,179,59,224,113,187,144,127,136,7,26,161,246,227,30,88,68,68,157,104,216,200,49,120,238,153,55,96,180,58,241,243,218,229,114,153,168,
+75,5,15,9,31,189,135,134,215,52,13,38,147,169,209,192,76,106,90,26,110,185,237,30,236,221,187,19,69,133,5,141,250,199,19,69,81,161,40,10,44,22,51,20,85,133,223,231,147,187,132,149,209,104,130,201,100,70,
+101,101,133,92,106,19,131,193,128,224,120,106,244,61,30,41,182,4,95,23,1,64,96,247,174,109,240,4,236,240,186,128,43,174,185,128,31,184,169,158,174,235,156,121,218,70,66,8,36,36,38,194,235,243,162,164,164,
+24,186,206,3,37,80,251,69,231,59,88,2,106,167,56,123,189,222,78,253,134,149,136,58,230,183,191,191,15,127,253,211,45,0,128,83,206,184,16,239,189,245,178,220,133,136,90,73,211,52,104,6,3,188,30,15,12,70,
+35,230,47,56,5,9,137,41,216,183,119,39,150,255,240,13,188,94,175,124,146,184,162,40,42,84,85,129,174,139,168,57,146,26,143,250,70,145,164,225,44,44,185,93,110,35,162,214,83,53,45,174,54,190,167,206,19,
+124,149,142,96,154,166,201,77,4,32,187,103,47,204,158,123,34,18,146,146,228,18,197,184,147,78,59,23,119,220,117,47,114,123,247,149,75,49,111,208,224,97,176,217,237,114,115,196,114,58,19,112,195,149,23,
+226,192,222,124,220,243,127,143,227,237,215,159,199,136,81,99,229,110,68,212,74,129,64,0,94,143,7,168,253,6,174,166,166,26,75,191,95,140,239,191,254,60,238,7,175,80,251,161,59,16,8,68,213,7,237,104,186,
+172,20,251,132,208,33,132,94,63,144,213,176,157,136,218,143,131,87,20,46,17,59,128,53,124,212,88,188,240,226,7,24,52,100,184,92,34,0,86,139,21,129,128,31,126,111,231,46,17,160,200,226,112,58,49,239,216,
+133,248,235,159,126,141,177,227,167,200,229,152,102,48,26,49,97,242,116,216,237,14,185,20,177,6,12,30,138,226,146,10,156,123,241,69,184,247,255,238,192,23,159,175,64,159,126,3,229,110,68,212,14,62,159,
+15,95,125,254,17,247,96,34,162,176,139,212,1,43,171,213,134,180,244,12,168,252,130,159,136,226,84,68,46,33,92,112,210,153,120,241,169,39,176,97,227,46,156,122,198,241,113,189,167,5,81,67,125,251,15,196,
+140,89,199,35,239,224,30,172,90,241,3,74,138,139,228,46,49,45,37,45,29,229,165,37,81,179,108,214,96,52,66,81,20,248,26,204,12,49,154,76,141,126,38,34,34,162,206,215,171,79,63,148,20,21,162,170,170,50,42,
+151,4,166,247,200,196,181,191,250,45,246,239,223,131,103,159,250,39,206,62,255,74,44,93,178,152,131,248,212,33,22,139,5,253,6,14,70,193,161,60,126,230,166,168,33,34,41,103,159,127,133,56,176,247,144,56,
+247,194,171,132,197,106,13,169,51,76,107,146,156,156,34,114,123,245,9,105,103,24,134,137,133,140,29,63,89,156,118,214,197,98,240,208,17,33,53,134,97,24,38,52,15,61,242,188,120,235,205,197,194,108,54,11,
+0,66,81,84,161,40,106,72,191,72,205,162,83,207,17,174,202,26,81,116,168,88,92,115,195,157,226,238,191,60,34,50,179,178,67,250,49,76,107,115,194,162,211,197,186,181,91,69,209,161,98,177,102,229,38,113,212,
+180,99,66,250,48,76,4,38,164,161,91,51,116,248,40,49,98,244,184,144,118,134,105,77,28,14,167,232,55,96,144,184,235,238,7,197,130,147,206,12,169,51,225,207,168,49,19,196,212,233,179,27,189,9,212,52,77,36,
+36,38,133,244,101,24,166,227,57,230,216,227,197,254,61,121,162,180,176,84,156,124,250,121,33,117,134,97,24,38,52,147,167,206,16,158,26,151,248,226,243,101,34,183,119,95,129,6,131,88,209,48,144,101,179,
+219,197,209,51,231,136,119,222,249,90,120,170,221,98,202,209,179,66,250,48,76,107,98,181,218,196,93,119,63,36,252,62,159,120,234,233,183,196,212,233,179,197,43,175,126,34,238,125,224,233,144,190,12,19,
+105,209,0,220,45,79,201,234,78,69,133,249,40,200,143,141,67,213,26,12,6,216,236,118,248,253,126,136,224,49,162,169,147,101,244,200,194,181,191,186,19,189,114,122,226,185,103,255,141,154,234,42,185,11,133,
+145,211,153,128,123,239,125,12,163,71,77,192,251,239,191,86,255,56,215,52,3,236,14,7,106,106,170,229,147,16,81,7,12,27,49,26,99,199,77,197,171,111,252,15,79,61,243,12,86,46,251,30,30,15,15,231,77,68,116,
+36,7,246,237,65,81,121,0,215,95,119,1,170,221,70,124,253,229,199,210,231,162,200,230,243,249,176,111,207,46,172,94,187,28,153,89,131,240,218,107,207,162,170,170,82,238,70,212,34,103,66,34,238,189,255,41,
+92,119,249,89,248,207,179,111,225,241,39,238,195,129,253,123,224,13,4,176,114,197,247,216,187,103,167,124,18,162,136,18,145,123,96,69,179,179,206,187,28,11,230,159,132,190,189,114,144,149,153,10,155,205,
+130,223,252,254,110,188,252,220,227,114,87,234,36,23,92,122,29,242,14,238,195,226,79,223,151,75,20,102,61,123,245,193,123,111,125,140,39,159,125,14,255,121,236,94,185,76,68,97,230,76,72,68,77,117,53,2,
+1,191,92,34,34,162,35,48,24,140,152,62,107,46,236,14,39,114,115,251,225,147,143,222,224,30,82,17,36,51,59,7,253,250,15,198,210,239,191,146,75,20,38,179,230,28,143,123,255,122,31,238,253,231,253,248,248,
+253,55,224,245,122,96,181,217,161,105,26,202,74,75,228,238,68,17,41,100,90,86,87,39,163,71,166,176,217,108,33,237,209,152,191,254,253,113,161,235,129,70,57,241,228,179,66,250,49,76,44,68,85,85,145,157,
+147,43,172,214,216,120,254,50,12,195,68,106,172,86,155,152,116,212,116,97,229,254,160,12,211,174,40,138,82,255,239,43,175,189,77,232,122,64,20,231,151,136,217,243,22,212,214,195,183,140,80,211,180,144,
+54,230,200,185,226,154,223,136,130,131,133,162,111,255,65,33,53,38,60,177,88,44,49,243,185,155,137,207,68,196,18,194,132,164,36,248,188,94,120,99,224,200,92,43,151,127,143,126,253,198,97,196,136,254,0,
+128,127,61,246,42,254,243,216,253,240,251,249,109,57,197,30,33,4,42,43,43,224,247,251,228,82,151,209,52,13,211,103,205,197,95,255,242,48,246,236,223,133,188,3,251,229,46,68,49,69,81,212,218,191,225,20,
+79,82,211,210,113,198,89,151,162,178,170,28,7,247,239,149,203,68,97,103,48,24,160,235,209,117,164,190,150,40,138,2,0,232,211,111,0,222,249,223,203,48,89,76,176,218,45,152,113,212,76,172,89,191,1,123,118,
+239,144,79,210,46,138,162,34,51,59,7,53,213,213,220,66,164,141,188,62,55,182,236,60,136,241,19,142,194,230,77,63,195,229,170,145,187,80,7,249,253,126,248,124,221,247,190,157,168,163,34,98,0,171,170,178,
+34,38,6,175,20,69,133,199,227,198,226,47,63,198,166,173,251,241,218,155,239,224,129,127,252,158,131,87,68,157,200,104,52,226,172,115,175,192,77,55,92,136,177,35,167,192,11,13,179,143,93,128,194,194,60,
+148,150,20,203,221,137,98,0,63,16,197,163,234,170,74,120,125,30,244,237,55,24,25,153,89,168,40,47,229,135,59,234,84,154,193,128,5,139,78,71,121,89,9,170,171,162,127,79,209,186,193,255,147,78,61,31,103,
+158,185,176,190,61,41,197,137,212,228,94,248,223,255,158,111,212,191,253,4,114,122,246,198,168,177,19,144,159,183,159,131,5,109,80,144,159,135,53,171,150,34,53,61,29,67,135,143,193,134,117,171,229,46,68,
+20,231,34,98,0,43,118,8,40,138,10,183,219,133,117,63,173,196,47,235,215,202,29,136,40,204,2,129,0,138,138,14,97,200,160,241,56,106,202,8,156,122,202,2,140,29,49,28,255,123,253,245,152,57,32,4,17,197,183,
+186,15,222,7,246,237,65,73,113,62,206,191,240,26,40,170,130,45,155,54,200,93,137,194,70,15,4,48,100,248,104,20,22,28,66,69,121,153,92,142,66,2,35,71,143,195,165,23,93,141,207,22,255,128,247,63,254,2,239,
+190,247,9,50,211,178,241,231,255,251,99,88,247,194,50,91,44,16,66,224,192,254,125,252,210,161,29,182,110,222,0,33,2,40,41,46,228,44,54,34,106,36,44,155,184,59,157,9,168,169,169,70,32,16,144,75,113,41,248,
+70,51,72,136,216,153,122,77,20,137,20,69,133,16,58,82,82,211,240,236,211,111,98,218,81,163,112,219,31,254,130,167,159,124,80,238,74,68,20,149,234,94,231,50,122,100,194,239,247,67,215,3,208,3,58,42,42,202,
+229,174,68,97,149,219,187,47,206,187,224,26,172,90,181,4,235,126,90,137,130,67,209,253,197,80,86,78,79,216,29,78,108,223,178,9,0,176,224,164,51,176,102,213,143,97,221,126,160,71,86,54,52,85,195,193,3,251,
+228,18,17,17,117,208,225,145,150,14,24,57,102,2,190,252,98,57,122,246,234,35,151,226,146,16,122,125,136,168,107,148,20,23,225,154,235,46,192,236,227,143,195,187,111,189,40,151,137,136,162,154,162,168,112,
+185,92,240,121,189,40,43,45,69,69,69,121,163,47,204,136,58,195,208,225,163,241,183,63,255,26,159,127,252,14,150,126,187,12,185,189,163,251,189,126,222,129,253,245,131,87,22,171,21,9,9,201,168,170,168,144,
+187,181,218,136,209,227,112,203,109,247,160,79,191,1,245,109,94,143,7,30,143,187,81,63,34,34,10,143,176,188,243,249,101,221,26,84,86,215,224,161,7,158,66,118,78,174,92,142,104,9,9,137,232,153,219,91,110,
+166,8,119,244,140,57,152,61,111,129,220,76,113,44,41,57,5,62,159,23,63,175,89,137,226,162,66,185,76,68,20,149,26,14,82,85,86,148,163,178,178,2,170,170,114,240,138,186,196,208,97,99,0,0,165,133,229,120,
+244,191,207,161,178,3,131,61,145,66,81,130,207,31,183,203,133,87,95,252,15,42,43,219,119,157,6,13,25,134,171,175,186,21,23,157,125,38,76,102,115,125,123,105,73,49,223,135,16,17,117,146,176,188,251,41,47,
+47,195,194,133,51,240,192,63,255,10,131,209,40,151,35,86,106,90,58,254,116,207,35,24,60,108,148,92,162,8,54,114,204,120,188,253,234,171,208,52,77,46,81,28,170,155,233,88,86,90,130,194,130,124,185,76,68,
+20,51,234,62,120,83,244,73,76,74,198,73,167,157,139,180,140,30,114,41,98,165,164,166,161,79,175,126,184,229,182,191,96,202,140,163,241,207,251,254,136,178,210,18,185,91,212,169,91,37,209,145,231,82,78,
+207,94,184,225,134,187,240,193,71,111,226,132,147,230,226,208,129,253,72,75,207,64,82,114,74,253,209,14,167,205,60,22,215,222,112,39,82,82,211,228,147,19,17,81,59,133,101,15,172,104,99,119,56,112,229,53,
+183,161,111,239,126,120,231,221,151,241,245,226,79,228,46,212,13,82,211,210,225,116,38,98,247,174,230,55,209,204,201,237,133,159,86,174,193,99,255,125,21,127,188,235,122,185,76,68,68,81,72,85,85,100,100,
+102,161,184,168,16,190,24,56,42,113,107,36,36,38,226,162,75,111,64,65,65,30,54,254,178,22,197,133,249,56,40,237,195,211,248,3,182,168,223,204,88,211,52,238,59,26,101,210,210,51,240,250,255,62,194,123,31,
+127,132,135,31,136,142,227,39,217,108,54,56,19,18,145,31,229,251,94,117,6,139,197,10,155,195,142,146,162,162,250,54,171,213,138,11,46,189,30,170,170,225,224,193,61,184,234,146,107,177,248,219,175,240,232,
+195,127,137,155,215,53,34,162,206,22,151,71,33,180,90,109,24,60,100,4,190,248,226,125,44,249,246,75,185,76,221,196,98,177,66,64,160,186,170,82,46,213,75,72,76,132,203,111,198,211,79,61,24,19,211,216,137,
+136,34,209,240,81,99,225,113,185,224,241,120,228,82,39,81,32,244,0,188,62,95,92,28,113,202,96,48,96,192,160,161,24,49,114,2,236,142,4,148,151,21,195,106,179,227,192,254,189,141,250,213,205,228,168,253,
+9,102,179,9,78,103,2,92,174,26,100,102,231,96,208,144,225,40,43,45,129,223,239,107,208,47,246,217,237,14,36,167,166,162,119,223,1,56,245,140,139,48,108,196,24,20,21,29,138,200,247,5,154,166,33,33,49,9,
+149,21,229,216,190,123,39,12,70,35,138,139,11,34,242,178,202,124,62,31,170,171,170,228,102,2,224,247,251,225,170,169,9,105,27,50,124,20,238,191,231,247,184,228,226,115,240,239,39,159,197,99,255,250,27,
+7,175,136,136,194,40,46,7,176,60,30,55,86,175,92,138,3,251,246,200,165,136,50,255,196,83,113,194,137,103,194,108,49,195,235,243,32,51,59,7,66,232,112,187,92,114,215,152,224,118,185,90,28,188,66,237,254,
+31,223,127,251,121,84,188,241,139,117,189,250,244,67,106,90,58,108,54,59,42,121,36,44,162,152,160,170,42,174,189,241,119,248,224,157,87,177,107,95,41,214,172,90,42,119,233,36,2,190,56,25,188,2,0,155,205,
+142,220,222,253,224,114,87,99,251,214,95,176,124,233,183,216,191,111,79,163,235,111,179,217,1,5,8,4,252,80,20,5,66,232,24,48,120,40,6,12,28,138,170,202,10,140,30,51,17,15,223,255,47,172,89,247,51,246,239,
+219,221,232,252,99,221,248,73,83,49,108,196,88,100,100,100,225,63,143,220,135,83,78,94,128,197,95,47,193,142,109,155,229,174,221,206,233,76,192,176,17,99,112,96,255,30,236,222,181,29,235,127,94,13,171,
+213,134,154,154,154,136,95,4,145,152,152,4,93,232,208,99,120,182,95,82,82,50,18,147,146,195,54,80,87,83,93,137,74,183,134,207,23,127,135,39,30,253,59,60,110,110,230,78,68,20,78,113,185,132,48,210,245,200,
+202,198,253,247,62,137,243,206,59,1,0,32,132,64,77,69,13,204,22,19,10,11,202,112,204,113,179,177,117,243,70,249,100,68,93,70,81,20,28,191,240,52,12,29,58,6,107,215,254,136,175,62,255,72,238,66,113,194,
+104,50,65,81,20,120,187,108,166,78,124,153,116,212,116,20,23,23,98,199,214,206,255,96,174,105,26,126,117,243,239,241,215,187,126,13,93,215,241,213,119,107,113,235,109,87,99,123,23,252,238,120,164,40,42,
+250,15,28,132,146,226,34,148,20,31,94,134,84,87,83,85,5,186,174,67,8,1,69,81,33,132,142,241,147,142,194,136,145,19,48,106,228,120,236,222,187,19,189,115,251,224,135,165,95,227,157,55,98,247,200,171,70,
+147,9,0,26,205,98,209,52,13,6,163,17,1,191,31,199,45,56,21,154,166,225,235,47,62,106,247,102,220,157,73,81,20,152,205,102,120,60,222,168,59,58,245,57,23,94,133,21,63,126,131,29,219,182,200,165,152,49,96,
+208,16,36,37,167,96,213,242,174,26,172,39,34,162,142,18,76,228,100,228,152,241,98,255,158,60,161,235,1,161,235,1,225,247,249,234,255,173,235,1,81,156,95,34,178,123,246,10,57,29,195,116,117,76,102,179,200,
+200,204,18,6,163,49,164,198,196,79,78,62,253,124,241,231,191,62,42,18,18,18,67,106,76,199,98,50,153,197,151,139,87,136,71,254,253,178,80,20,53,164,30,238,204,156,51,95,248,60,94,241,227,146,159,197,9,139,
+206,16,235,127,218,42,46,188,236,250,144,126,76,248,211,212,253,43,183,41,138,34,0,8,155,205,38,78,63,251,18,241,250,235,159,139,172,236,158,194,98,177,132,156,54,150,98,181,90,133,213,106,13,105,7,32,
+166,207,154,43,146,146,83,66,218,153,142,167,111,191,129,226,255,238,125,82,172,92,254,139,24,63,105,106,72,157,97,152,174,143,211,153,32,204,49,254,154,31,43,177,88,44,34,57,37,85,100,102,231,240,61,114,
+152,211,254,195,111,68,9,163,201,132,139,46,187,30,39,44,58,67,46,69,164,172,172,92,100,231,102,0,0,132,46,130,251,95,52,88,82,240,135,191,61,128,131,210,30,25,68,221,193,235,241,160,224,80,30,252,190,
+248,218,123,133,14,203,201,237,133,59,111,189,3,227,70,141,134,192,225,215,41,10,143,180,140,30,24,57,172,47,124,93,244,28,171,40,47,197,19,79,191,137,59,239,254,45,62,251,248,29,92,118,205,101,248,230,
+75,206,174,236,10,77,205,204,169,107,171,219,200,189,110,121,97,77,77,13,222,122,237,57,220,252,235,43,144,119,112,63,220,81,178,68,201,96,48,192,108,182,200,205,112,38,36,132,28,85,216,225,116,66,85,131,
+215,219,229,114,193,213,196,214,9,154,166,161,176,224,16,92,174,198,251,16,81,120,140,157,112,20,214,254,180,2,15,63,254,111,20,23,241,8,191,68,145,32,33,49,9,38,99,112,86,42,69,54,163,209,8,163,201,4,
+143,199,13,93,15,253,27,79,29,19,50,170,21,75,113,56,157,226,167,213,155,133,167,198,45,78,88,116,70,72,61,210,242,219,223,223,123,120,198,85,192,127,56,181,109,191,191,251,33,97,48,24,66,78,199,48,12,
+211,213,185,248,242,27,196,178,165,235,196,152,241,147,67,106,205,37,51,59,71,216,29,206,144,118,38,52,99,39,76,22,191,253,253,189,162,119,223,254,33,53,38,254,162,40,106,200,172,44,131,193,32,122,100,
+102,133,180,71,98,52,77,19,19,38,31,45,114,123,247,109,212,62,106,204,248,70,109,138,162,136,81,99,198,11,71,27,94,39,162,225,250,71,91,50,122,100,182,233,62,96,24,166,243,147,152,152,36,172,86,91,72,59,
+195,196,89,66,26,98,46,253,7,14,22,75,190,91,43,188,110,143,152,56,101,122,72,61,82,210,51,183,183,216,185,109,111,163,37,131,77,101,194,100,78,229,102,24,166,123,211,179,87,111,113,243,111,254,212,166,
+193,149,244,140,30,226,249,231,223,19,127,248,243,63,69,70,102,86,72,157,105,28,167,51,65,56,19,18,66,218,153,248,76,195,1,172,186,255,167,166,165,139,241,147,166,70,205,0,206,194,83,206,22,147,166,206,
+104,212,166,170,170,48,155,205,245,63,203,215,49,150,82,183,220,51,22,175,27,195,48,157,31,155,221,30,243,203,198,25,230,72,137,139,163,16,150,150,20,227,237,119,223,192,197,23,92,10,179,45,13,31,127,244,
+150,220,37,34,184,61,110,172,88,251,51,190,91,178,10,39,204,157,13,205,216,120,74,61,0,108,217,184,27,255,122,244,33,84,29,225,104,125,68,68,157,201,238,112,98,195,250,53,216,191,119,79,237,18,39,33,119,
+9,17,8,4,144,156,145,133,43,47,58,31,246,132,76,172,251,121,37,151,255,180,192,235,245,112,115,124,106,32,184,173,128,162,40,64,237,230,224,30,143,27,7,246,239,61,226,243,207,104,50,65,85,213,110,95,198,
+176,117,243,134,144,35,64,11,33,16,104,112,148,187,224,245,171,123,159,26,91,108,54,59,44,22,43,116,161,55,186,206,13,25,12,6,244,238,219,31,101,165,37,114,169,203,181,246,181,157,136,90,71,85,213,14,29,
+109,215,239,15,212,190,118,180,255,60,168,251,241,181,181,99,226,98,0,11,0,220,110,23,222,126,255,61,236,63,176,7,123,118,239,144,203,17,33,16,8,96,239,238,157,216,183,119,39,206,58,253,124,36,167,38,32,
+224,15,4,15,159,29,16,184,253,174,123,113,237,181,23,163,184,168,80,62,105,84,179,219,29,8,4,252,29,122,65,39,162,174,85,85,89,129,170,250,35,126,181,238,185,27,240,251,241,243,218,21,248,110,233,18,36,
+36,166,192,229,174,70,222,129,125,114,55,34,106,86,237,222,152,181,90,59,32,101,177,88,96,181,218,160,170,74,151,237,169,214,208,128,65,67,32,132,128,187,137,189,172,26,82,85,21,14,135,3,94,111,108,14,
+220,122,189,94,164,164,166,163,162,188,172,217,247,60,66,0,206,132,68,104,154,6,175,215,211,108,191,174,209,157,191,155,40,182,216,108,54,92,124,249,77,240,120,93,40,200,207,147,203,173,20,155,131,251,
+241,135,247,97,71,212,125,205,69,17,36,41,57,5,227,38,30,5,183,203,133,170,170,10,100,101,231,66,85,53,124,242,193,155,114,215,152,96,181,90,225,241,122,161,55,243,109,36,17,197,30,69,81,96,177,88,154,
+220,156,153,136,90,86,183,177,123,157,166,54,129,175,163,40,42,132,208,97,50,155,161,170,234,17,7,145,58,67,78,207,94,40,43,43,65,117,85,149,92,10,161,40,74,55,15,218,180,159,193,96,64,118,78,46,74,75,
+139,81,89,81,55,192,223,216,128,65,67,224,118,187,176,127,111,227,153,104,13,13,26,58,28,147,166,204,196,198,13,107,177,123,231,54,148,20,23,201,93,136,40,74,24,77,38,140,30,59,17,46,87,13,78,57,245,66,
+184,92,213,120,229,165,39,144,119,96,191,220,149,136,90,33,110,102,96,69,11,69,81,225,118,213,96,215,142,109,216,183,119,23,242,15,29,196,142,109,155,177,125,235,70,185,107,204,240,251,57,251,138,40,30,
+249,253,126,185,137,136,90,165,238,91,248,35,127,27,95,183,236,48,224,247,119,219,115,174,178,162,28,62,175,87,110,110,151,72,94,122,97,119,56,48,233,168,153,240,122,61,205,206,150,239,145,149,131,193,
+67,70,182,248,190,206,100,50,225,170,43,110,194,193,67,7,113,112,255,30,84,87,31,121,224,143,136,34,83,90,90,58,254,122,207,195,152,56,113,26,14,28,220,135,179,78,57,25,46,159,130,85,43,150,200,93,137,
+168,21,56,128,21,113,26,191,41,83,20,181,193,126,16,68,68,68,68,109,113,120,239,172,195,123,104,69,243,123,10,1,131,193,136,19,79,57,27,41,169,169,40,56,148,215,236,126,82,93,205,102,179,195,96,48,96,255,
+222,221,240,184,221,114,25,0,80,89,94,6,127,192,143,244,30,153,40,43,41,110,242,11,188,170,202,74,236,218,179,29,6,131,1,91,54,111,224,12,117,162,40,230,241,184,177,63,111,63,174,189,226,50,76,30,63,6,
+143,61,253,44,62,120,239,85,84,86,148,203,93,137,168,21,56,128,21,241,142,252,237,42,17,17,17,181,78,66,66,34,204,102,11,60,157,176,65,254,144,97,35,145,154,150,222,236,236,155,238,115,120,239,172,150,
+150,27,202,52,77,131,195,153,16,113,7,19,80,85,21,39,44,60,3,151,95,120,5,54,110,221,88,187,145,125,247,27,50,108,36,10,14,29,64,81,97,129,92,170,23,8,4,80,82,92,132,30,153,217,193,193,172,102,102,197,
+229,231,29,196,190,61,59,17,104,166,78,68,145,203,106,181,194,108,54,195,231,243,65,215,117,236,219,179,11,38,123,26,52,205,130,127,253,235,111,56,176,111,47,20,69,197,105,103,93,8,40,64,81,65,190,124,
+22,68,212,12,45,43,59,231,238,170,74,30,209,142,136,136,136,98,159,213,102,135,217,106,109,213,126,76,50,131,193,16,178,71,147,217,98,65,86,118,14,22,44,58,11,207,60,254,36,46,191,228,82,248,20,59,250,
+13,24,140,209,227,38,97,231,182,205,240,249,218,183,124,46,188,203,229,142,252,133,152,162,168,208,180,195,71,201,50,91,44,48,155,205,97,221,55,43,28,215,73,215,117,236,223,187,19,110,191,192,250,159,87,
+161,188,172,84,238,210,45,116,61,128,138,242,178,86,109,148,95,88,112,168,217,193,171,58,173,221,164,159,136,34,75,223,1,131,208,111,192,16,40,170,130,180,244,12,212,84,87,97,213,202,31,240,233,167,239,
+161,48,255,16,210,123,244,192,57,23,92,141,63,253,246,14,188,255,209,7,56,200,3,218,16,181,154,102,54,91,238,118,213,240,48,230,68,209,202,100,54,163,255,128,193,200,237,221,23,37,37,69,17,179,148,130,
+136,226,135,221,225,128,221,238,128,219,29,190,129,142,206,226,118,187,224,241,180,239,232,110,66,4,247,148,106,120,12,28,85,81,144,148,156,2,187,221,142,29,123,242,48,101,226,56,156,122,210,60,156,120,
+220,92,44,95,179,1,171,86,124,223,170,1,141,58,117,131,72,86,171,13,66,232,97,29,196,168,219,150,64,81,148,70,3,85,135,53,254,217,96,48,192,227,241,180,106,9,155,166,105,208,12,134,250,203,171,170,42,76,
+38,51,0,113,120,64,204,108,134,213,102,11,203,140,174,138,242,50,172,93,253,35,106,170,171,194,122,27,117,68,117,117,85,155,238,107,34,138,77,37,69,133,56,116,232,0,18,18,18,49,107,246,2,236,222,189,13,
+21,229,229,112,187,93,72,75,207,192,105,103,94,138,73,227,39,227,145,199,31,193,55,139,63,150,79,78,68,45,136,246,141,16,40,194,37,36,38,193,83,251,97,129,194,207,96,48,96,194,148,105,200,205,237,7,93,
+247,227,243,143,223,69,101,101,211,71,62,34,34,234,44,215,221,248,59,76,157,52,21,55,220,120,113,4,46,159,235,152,186,163,248,53,252,185,33,77,83,27,205,164,153,119,194,201,248,205,77,119,224,217,151,158,
+197,43,47,60,217,168,111,107,41,138,10,187,221,142,64,192,31,246,35,117,214,93,126,249,114,203,228,235,221,18,69,81,161,170,42,210,123,244,64,73,81,17,188,94,15,12,70,35,156,206,4,84,85,85,214,111,224,
+110,179,217,96,182,88,80,90,82,34,159,5,17,69,152,193,67,71,96,244,216,201,248,122,241,135,40,228,18,183,118,27,62,106,44,138,11,243,113,40,239,32,80,123,84,194,30,153,217,8,248,125,200,59,120,64,238,78,
+68,71,192,61,176,168,83,37,38,37,193,239,247,243,27,201,78,162,235,58,116,61,128,210,146,66,172,94,185,180,205,71,42,74,76,74,134,207,235,109,226,91,120,34,162,214,177,88,172,152,52,101,58,60,94,31,150,
+124,191,184,217,205,171,163,65,112,134,146,220,214,248,231,134,251,73,213,205,148,10,254,141,11,190,142,238,216,182,25,95,44,254,24,171,87,254,216,129,25,177,2,62,159,175,197,1,166,246,170,187,236,186,
+126,164,203,214,150,191,11,2,66,232,168,174,170,174,63,95,93,215,225,118,185,26,205,222,210,117,29,94,111,112,79,24,34,58,172,169,215,158,238,102,177,88,208,51,183,15,10,242,243,34,102,153,110,52,42,204,
+63,4,151,171,166,254,189,182,30,8,46,53,230,22,62,68,237,195,25,88,68,113,106,224,224,161,88,116,242,121,248,246,155,79,176,106,249,15,114,57,102,216,29,14,120,220,30,248,253,28,68,141,7,89,217,61,81,81,
+94,214,230,193,220,174,146,144,144,8,143,215,19,214,65,30,139,197,138,156,220,94,216,177,109,139,92,234,18,61,50,179,96,179,59,176,107,199,54,185,212,229,12,6,99,151,61,215,229,153,88,0,160,170,74,163,
+65,43,85,85,57,88,211,128,166,105,64,237,70,230,68,116,88,221,140,199,81,99,38,224,247,191,251,63,124,240,201,123,120,229,133,39,187,236,245,140,136,40,90,132,190,251,34,162,184,208,127,224,80,156,190,
+104,33,50,179,114,228,82,76,57,229,244,11,113,222,69,87,163,87,159,126,114,137,98,76,122,143,76,244,31,52,20,9,137,137,114,41,98,116,198,96,134,174,7,48,98,212,120,92,126,245,175,145,152,148,36,151,59,
+149,162,168,40,44,44,136,136,193,43,0,72,75,79,71,82,114,138,220,220,101,116,93,64,211,180,218,125,166,212,218,61,179,248,86,171,78,32,16,8,203,224,21,111,83,138,53,117,203,117,147,83,82,113,218,105,179,
+241,220,127,31,198,253,15,62,13,187,221,33,119,37,34,138,107,42,0,156,121,238,101,56,229,204,11,228,26,17,197,176,197,159,125,128,147,79,59,30,159,125,252,174,92,138,41,91,54,175,195,224,193,35,112,255,
+189,79,224,244,179,47,145,203,20,35,198,79,154,138,255,60,254,10,14,236,219,141,188,131,7,144,152,148,140,158,189,250,200,221,58,157,162,168,200,238,153,139,212,180,116,185,4,0,168,170,170,12,203,236,43,
+85,85,145,158,209,3,170,170,194,235,245,226,189,183,94,65,122,122,38,190,255,102,5,142,158,49,71,238,222,105,132,208,91,181,193,119,87,41,42,42,132,171,166,58,172,3,28,89,217,57,48,153,205,114,51,132,208,
+155,220,35,74,215,69,237,4,247,230,251,116,165,224,210,164,195,183,71,56,111,155,182,50,26,77,77,222,150,109,165,170,10,12,6,131,220,220,33,102,139,5,9,9,145,59,248,221,213,228,199,77,93,27,117,142,132,
+196,36,12,26,50,12,75,190,93,140,227,23,158,142,234,242,106,220,240,171,243,48,118,194,20,185,43,17,81,92,211,22,158,114,246,221,111,189,246,28,206,58,237,36,124,251,195,10,236,222,181,93,238,67,68,49,
+72,215,117,84,87,85,70,212,135,207,206,112,112,255,94,44,251,241,27,236,207,219,15,40,192,246,45,27,229,46,20,229,52,77,195,35,15,63,139,147,79,153,133,189,7,203,241,243,154,229,112,38,36,192,108,182,160,
+172,180,171,55,139,22,208,180,224,145,216,194,49,80,213,28,69,81,96,52,154,224,245,30,62,154,222,238,221,219,80,94,227,67,254,161,3,216,183,119,151,124,146,184,160,235,122,237,12,159,240,236,142,160,170,
+42,52,205,0,143,219,221,236,236,185,186,61,165,154,22,158,203,209,94,141,7,28,130,151,165,238,40,132,221,113,217,52,67,112,118,90,71,103,97,9,33,160,235,58,84,85,13,219,110,24,54,155,13,66,4,103,208,153,
+76,166,184,222,187,83,81,84,168,170,82,255,152,31,62,106,12,134,13,31,141,131,7,247,117,248,190,163,166,25,141,70,232,186,142,202,202,10,236,216,182,25,43,126,90,143,239,126,88,131,101,63,124,133,234,170,
+200,92,18,79,68,212,45,230,157,112,178,112,87,187,132,174,7,196,255,254,247,169,48,24,12,162,246,157,0,195,48,12,195,68,124,250,13,24,36,230,28,183,80,172,93,181,73,4,2,1,241,232,99,175,8,135,211,25,210,
+47,18,163,40,170,80,85,53,164,61,222,163,105,154,48,91,44,33,237,109,141,162,40,33,109,225,140,162,168,205,70,238,219,82,58,235,49,208,220,229,104,174,221,98,177,8,171,213,26,210,222,25,49,153,205,33,109,
+29,73,240,118,111,249,254,110,238,190,113,56,156,34,51,59,71,216,29,14,161,105,154,80,53,45,164,79,87,198,28,230,219,166,45,169,123,77,170,187,157,254,252,215,71,197,235,175,127,46,114,123,247,17,25,153,
+89,34,189,71,166,200,204,202,22,70,147,41,228,180,225,140,162,40,98,220,196,41,66,235,230,251,162,59,98,52,154,132,221,238,8,105,103,24,134,1,32,146,146,147,197,248,137,71,137,148,212,180,144,90,60,68,
+253,242,179,15,112,204,113,39,224,182,59,255,142,213,63,175,193,160,161,35,228,49,46,34,34,162,136,181,111,239,110,124,249,217,7,56,246,248,153,88,186,228,103,204,158,62,41,44,203,148,186,66,114,106,42,
+6,14,30,38,55,183,137,201,108,134,211,153,16,83,203,123,20,69,129,166,6,55,252,110,143,186,219,34,57,37,21,89,57,61,143,48,75,170,101,77,45,165,170,35,47,15,148,127,62,18,147,217,12,139,197,2,147,201,212,
+161,203,216,26,23,95,113,35,46,187,234,22,160,133,203,153,156,154,134,228,212,52,185,57,236,84,85,133,195,225,172,223,212,253,72,140,38,147,220,20,34,120,157,142,124,27,54,117,221,157,9,137,48,24,12,168,
+169,174,65,32,16,232,214,153,201,102,179,25,3,6,15,109,245,109,211,89,132,208,49,103,222,137,184,235,183,215,96,209,130,233,152,124,212,49,152,48,233,104,156,125,238,149,24,52,100,36,76,198,35,223,39,29,
+49,117,250,108,124,243,217,231,232,55,112,176,92,138,104,38,147,9,67,134,141,132,193,104,148,75,71,84,247,58,99,182,152,225,140,224,189,28,137,168,251,12,30,58,2,171,150,253,132,149,203,151,224,179,143,
+191,105,118,203,138,88,215,104,68,43,220,223,136,49,12,195,48,76,87,197,96,48,70,205,236,43,212,206,52,178,116,112,166,145,209,100,18,54,155,61,164,61,22,146,152,148,220,232,254,52,153,205,109,154,145,
+161,105,90,253,172,26,185,214,218,52,55,107,39,28,49,153,205,205,190,239,210,52,173,67,179,226,27,94,238,153,179,143,19,53,21,213,194,235,246,136,133,167,156,19,210,183,171,99,48,26,219,116,159,24,140,
+198,35,206,174,138,149,40,138,26,17,215,87,211,12,98,211,134,29,66,215,3,66,215,3,194,231,246,8,175,219,35,174,189,225,119,33,125,195,157,233,199,204,19,91,55,237,18,186,30,16,247,252,237,223,157,62,219,
+43,156,49,24,12,98,200,240,145,98,224,224,97,33,53,134,97,152,142,196,96,48,136,79,62,254,161,254,117,89,215,3,226,190,7,159,14,233,23,235,9,249,74,209,235,241,200,77,68,68,68,81,193,239,247,161,170,178,
+82,110,142,88,129,64,0,238,14,238,149,229,243,122,81,83,83,45,55,199,4,85,85,97,179,59,234,103,163,212,237,125,212,90,129,64,0,213,85,85,29,218,183,167,51,55,98,247,122,60,205,190,239,50,153,76,176,90,
+109,114,115,35,22,171,21,78,103,130,220,12,212,94,110,69,85,112,205,13,119,226,203,207,62,132,197,97,129,193,100,192,123,111,189,132,179,47,184,82,238,222,33,6,163,17,14,167,19,41,173,152,189,149,148,156,
+2,179,217,220,166,251,196,239,243,213,239,245,22,235,132,208,187,253,250,154,204,102,156,119,241,53,216,180,117,15,14,237,47,4,0,104,38,3,22,127,185,18,207,63,253,176,220,61,172,140,38,19,254,113,207,189,
+24,48,184,23,94,122,249,99,28,127,236,44,156,119,225,53,114,183,136,229,247,251,225,170,169,65,98,82,178,92,34,34,234,16,69,85,49,124,200,225,3,20,9,93,96,239,190,221,141,250,196,3,13,192,221,114,35,17,
+145,213,106,171,253,224,214,125,111,162,41,60,186,123,41,10,81,123,185,93,174,224,160,85,32,0,85,211,160,7,2,109,126,77,10,46,203,105,219,105,34,129,223,239,135,215,219,244,224,86,29,147,217,12,131,102,
+128,199,19,58,8,170,40,10,32,4,76,22,51,60,94,11,38,140,27,6,69,81,224,115,123,241,229,55,75,177,102,213,82,249,36,237,86,183,161,186,174,235,240,249,188,114,185,17,69,85,224,113,187,219,124,63,118,150,
+104,125,124,116,38,139,197,130,228,228,84,60,251,204,163,88,252,237,119,88,52,127,1,62,253,124,25,46,185,236,116,84,148,151,117,234,109,166,7,2,216,176,121,35,242,11,221,248,191,191,221,129,23,95,122,22,
+170,170,96,239,158,157,114,215,136,165,105,26,60,110,55,42,42,202,229,18,17,81,187,233,129,0,214,111,222,134,158,89,3,240,233,226,31,112,205,117,87,225,189,183,94,150,187,197,188,240,28,186,37,138,245,
+237,63,16,35,71,79,192,226,207,62,64,77,53,143,242,65,228,112,58,209,183,255,32,28,58,184,31,165,37,197,240,251,253,114,23,138,50,138,162,118,218,12,146,88,164,25,12,48,155,76,168,169,169,145,75,212,197,
+26,62,118,147,83,211,96,54,153,113,40,239,128,220,173,83,53,220,255,42,154,158,71,117,151,91,8,29,89,57,61,177,110,245,79,216,127,160,8,103,159,127,58,182,109,217,8,187,221,1,85,85,81,94,94,38,159,180,
+89,70,147,9,122,32,208,166,217,83,109,97,48,26,97,50,153,80,83,221,53,51,10,131,71,28,52,195,96,52,192,85,83,195,191,119,77,24,63,105,42,70,142,158,136,215,94,250,15,92,46,87,147,127,79,52,77,131,209,104,
+132,63,16,128,63,76,71,111,204,202,233,137,170,138,10,84,86,86,200,37,34,34,138,99,113,63,3,43,33,33,9,207,62,245,44,102,204,152,143,47,22,127,4,183,203,37,119,33,138,43,70,147,9,126,191,31,5,135,242,218,
+180,84,135,34,89,92,127,79,209,102,67,135,143,68,82,114,42,10,11,242,229,18,117,57,81,187,137,58,224,113,187,97,182,90,96,50,155,187,244,111,117,195,205,213,131,255,142,142,231,147,162,40,8,94,116,5,85,
+149,21,208,13,137,120,254,197,167,177,106,249,15,193,217,79,10,144,156,156,10,87,77,117,171,95,235,109,54,27,236,14,7,124,94,111,171,79,211,22,186,174,3,138,2,161,11,24,77,70,136,78,248,29,13,9,33,16,8,
+4,96,179,219,1,33,224,11,211,224,75,44,168,155,101,165,170,42,182,110,90,135,178,178,210,6,131,185,141,159,3,6,131,17,9,181,155,142,123,189,45,207,192,107,173,170,202,138,35,206,64,36,106,73,102,118,14,
+50,179,114,144,153,221,19,133,5,135,228,50,17,69,169,184,31,192,42,47,47,197,202,181,107,48,110,220,20,20,20,23,98,231,246,45,114,151,136,96,177,90,249,205,32,117,9,159,215,27,85,123,8,17,133,155,223,231,
+67,121,89,41,60,205,236,77,68,93,231,240,7,230,224,192,145,215,227,129,170,170,93,58,208,32,31,29,48,56,48,212,56,242,7,122,89,176,95,243,203,174,84,85,69,78,110,47,84,87,85,133,109,105,93,221,0,150,170,
+42,208,117,29,75,151,124,133,93,59,183,213,47,41,14,248,253,168,172,40,111,211,239,243,249,252,240,121,189,8,4,244,102,175,75,71,233,129,64,253,109,26,188,104,193,223,163,105,90,253,101,213,52,13,22,139,
+21,66,136,144,217,64,109,39,224,118,185,186,244,49,21,29,130,131,199,21,229,101,168,174,170,106,52,163,79,38,132,128,171,166,166,217,253,220,90,162,105,26,84,85,109,211,227,144,142,172,225,235,141,193,
+96,232,148,1,231,72,150,156,146,138,187,238,186,15,115,143,93,128,21,43,150,32,255,208,65,185,75,76,169,187,191,83,211,210,177,240,148,115,224,118,215,160,180,164,24,118,135,3,131,135,142,64,121,121,41,
+2,252,28,73,49,34,100,19,247,120,180,114,217,18,92,117,229,153,248,105,245,50,185,212,237,50,179,114,48,126,242,84,36,36,38,193,102,183,55,90,202,16,141,178,114,122,98,230,236,227,228,102,34,162,136,81,
+90,90,194,189,75,34,132,201,100,132,170,42,181,31,154,21,248,253,254,218,1,246,198,131,74,178,214,254,173,108,109,191,35,105,238,124,234,218,157,9,9,208,180,166,251,0,128,217,108,70,70,143,108,168,97,222,
+175,78,8,64,215,69,163,65,184,224,7,217,224,128,90,112,57,88,219,6,14,252,126,95,147,131,24,225,36,132,142,64,32,208,232,247,212,45,91,84,20,21,138,170,66,211,52,152,205,102,168,106,243,183,43,117,76,195,
+219,63,184,39,102,211,247,123,75,181,35,9,116,226,146,84,2,166,205,60,22,103,95,112,37,236,118,135,92,10,139,112,191,102,133,139,162,170,176,88,44,216,184,101,19,182,109,217,40,151,99,74,112,0,88,71,114,
+74,42,222,127,231,11,252,239,197,255,224,131,183,62,194,85,191,186,29,207,62,243,54,158,121,242,5,24,13,70,249,100,68,81,235,200,95,27,82,183,89,112,210,25,120,224,111,255,64,143,30,201,120,225,213,15,
+81,85,83,141,167,159,122,16,59,183,111,149,187,70,5,163,209,136,207,62,93,10,139,217,132,169,211,70,203,101,34,34,162,70,84,77,131,208,15,207,178,105,56,80,212,84,91,93,123,112,96,230,200,31,168,229,211,
+182,85,115,191,163,238,247,215,157,191,166,169,8,4,154,255,144,239,112,58,49,120,232,72,252,188,102,37,252,254,240,204,4,106,233,186,53,119,57,58,83,221,109,82,183,217,123,56,4,7,230,234,6,56,137,168,161,
+126,3,6,225,213,23,223,132,208,5,174,187,249,26,172,94,17,190,3,55,68,3,187,221,1,175,215,19,211,179,43,235,94,87,211,51,122,224,179,143,191,193,152,113,131,228,46,56,245,204,11,241,238,155,241,183,209,
+55,197,174,230,223,221,80,183,179,88,108,232,211,39,11,137,41,9,184,254,186,115,81,92,92,136,130,252,60,185,91,212,152,52,117,38,246,236,59,128,11,46,57,83,46,17,17,81,55,83,20,5,105,233,25,17,245,141,
+122,240,168,131,161,179,64,154,26,176,16,66,135,197,98,70,98,82,114,163,193,173,230,6,114,20,69,133,166,169,245,123,247,180,71,83,231,47,255,140,218,89,38,77,93,230,58,110,151,27,27,215,175,13,219,224,
+85,75,90,186,28,71,146,148,148,140,196,164,36,185,185,69,154,166,33,33,225,240,109,172,170,106,88,102,77,5,111,103,14,94,117,5,69,81,97,179,217,96,177,88,228,18,69,168,177,19,38,227,169,199,95,196,196,
+201,195,49,97,210,48,92,122,201,245,56,97,209,25,114,183,46,37,47,199,238,108,213,213,85,49,61,120,133,6,175,231,23,95,118,99,147,131,87,249,7,138,240,253,55,159,203,205,68,81,173,227,239,32,168,211,188,
+245,218,243,152,113,236,60,236,216,178,15,1,127,0,95,124,246,78,84,239,77,148,148,148,130,63,252,241,38,236,216,22,153,251,140,17,17,197,51,131,193,8,147,217,2,161,71,223,196,236,186,217,78,94,175,23,46,
+87,77,200,32,82,83,3,77,193,129,48,129,234,170,74,168,170,2,131,209,208,168,222,22,117,231,47,255,142,195,234,246,192,106,154,223,239,131,43,204,27,211,119,198,192,142,170,105,208,3,109,59,95,33,4,76,102,
+51,44,22,11,12,6,3,52,77,107,176,39,88,112,127,30,131,33,120,219,43,138,90,255,239,35,105,110,32,147,194,79,51,104,240,122,189,240,249,124,205,14,66,168,170,10,131,177,237,203,148,12,70,35,140,38,19,172,
+86,43,76,38,179,92,166,118,48,91,44,88,116,210,121,56,102,206,4,0,128,170,169,88,52,127,38,42,43,187,111,105,252,212,233,179,113,215,221,15,226,247,127,122,16,231,94,116,117,187,30,43,225,86,247,26,52,
+109,230,177,120,228,223,47,225,180,179,47,134,213,106,147,187,69,52,77,211,112,218,89,23,227,158,223,221,36,151,224,169,246,224,194,43,175,68,113,81,161,92,106,51,163,209,4,187,163,115,150,161,198,11,135,
+195,17,17,143,251,88,33,152,200,78,191,1,131,196,220,249,139,66,218,163,45,73,201,41,66,81,148,144,118,134,97,24,134,9,71,20,69,13,105,107,41,117,253,21,69,13,249,119,184,35,255,238,174,136,124,25,154,
+186,28,205,181,135,51,6,163,81,152,76,38,97,50,153,132,213,106,19,154,166,53,250,189,13,127,191,92,107,46,71,170,51,225,79,221,125,35,183,3,16,14,135,83,36,36,36,134,180,31,41,189,250,244,19,137,73,201,
+34,49,41,89,216,108,182,144,58,211,250,40,138,42,52,77,19,154,166,137,172,236,28,113,233,149,55,139,130,188,66,81,89,90,33,38,29,53,61,164,127,195,104,154,22,210,22,206,244,233,55,64,124,243,245,42,161,
+235,1,241,192,63,159,19,102,179,57,164,79,119,229,140,115,46,21,126,159,79,232,122,64,252,238,143,15,132,212,35,57,39,44,58,67,232,122,64,232,122,64,248,188,222,250,127,111,218,176,67,76,57,122,102,72,
+255,246,38,189,71,166,24,50,108,100,72,59,211,250,36,167,164,10,83,4,61,238,163,57,173,222,3,171,103,175,62,48,24,12,216,189,115,187,92,34,162,118,48,24,12,60,178,36,17,81,152,53,156,233,212,218,25,58,
+45,205,142,58,146,134,191,163,169,243,105,237,101,232,44,77,93,166,58,242,101,63,210,101,109,77,159,150,52,60,125,75,231,213,114,77,169,95,130,216,145,205,191,237,118,7,140,38,19,92,53,213,240,249,124,
+97,219,151,43,28,52,77,11,185,110,70,147,9,66,215,161,168,42,84,69,137,184,163,164,214,205,204,106,235,65,1,236,14,7,124,62,95,187,142,96,72,141,41,138,90,123,212,209,195,251,6,142,159,52,21,0,176,122,
+197,210,102,159,87,86,155,13,191,186,241,46,56,29,9,184,239,31,191,67,101,39,29,196,228,152,185,39,224,132,227,79,199,63,31,186,27,7,246,237,149,203,221,102,250,172,185,120,239,245,215,144,148,150,136,
+21,203,126,193,148,169,163,228,46,17,107,194,228,163,113,235,205,191,135,195,110,67,223,222,217,240,120,188,120,239,211,47,240,175,127,222,131,146,226,34,185,123,187,105,154,6,69,85,225,143,241,37,153,
+20,61,66,70,181,154,202,77,183,254,73,20,230,21,137,129,131,135,134,212,24,134,105,123,154,251,22,147,97,24,134,233,120,90,154,117,212,84,154,234,219,240,60,154,75,115,231,211,92,189,171,35,95,158,186,
+203,36,183,181,230,178,134,99,22,117,107,126,79,75,81,106,103,153,200,237,109,77,114,74,170,72,72,76,20,14,135,83,24,77,166,144,122,119,165,185,235,231,112,56,133,213,106,19,38,179,89,216,108,246,144,122,
+36,36,28,143,15,166,253,105,233,249,220,210,204,70,131,209,40,126,117,211,93,194,235,246,136,21,63,174,23,19,38,31,29,210,167,163,73,75,207,16,57,185,189,133,213,106,13,169,117,119,174,250,213,237,162,
+232,80,145,88,182,116,157,152,60,53,124,179,150,186,50,14,167,83,244,237,63,64,216,29,142,250,182,166,238,107,134,137,133,104,0,238,150,71,180,154,242,171,107,111,197,228,163,70,98,248,208,73,248,234,219,
+197,168,40,47,147,187,16,81,155,8,185,129,136,168,73,193,89,52,193,215,140,148,212,84,40,138,82,191,31,77,195,90,71,152,204,102,8,33,218,60,131,34,114,137,250,89,33,193,255,7,175,87,106,90,58,18,18,146,
+80,93,37,239,41,89,247,222,232,176,230,246,251,169,211,212,108,134,134,167,105,170,222,245,130,183,67,240,178,52,188,142,135,111,31,33,116,152,204,38,24,107,247,231,104,110,54,146,166,105,200,201,237,13,
+183,219,21,50,67,168,181,52,77,133,205,110,135,166,6,143,204,216,240,190,105,157,198,143,209,150,30,255,70,147,9,14,135,3,138,162,132,204,120,118,187,92,240,120,60,240,122,189,208,219,121,93,154,99,48,
+26,97,54,91,234,55,229,87,20,5,6,131,17,138,162,4,247,3,51,91,224,243,121,229,147,213,106,250,57,232,245,122,225,247,251,16,8,4,194,178,49,181,170,170,152,115,220,137,72,78,73,67,222,129,125,114,185,93,
+130,51,227,20,24,77,70,216,109,118,120,189,156,85,213,181,14,63,167,81,63,91,81,169,125,254,215,246,104,226,53,73,215,117,108,88,183,10,191,108,221,135,179,79,59,9,187,15,22,99,249,143,223,202,221,218,
+109,208,144,225,56,239,194,107,81,84,156,143,61,187,118,200,229,110,55,108,196,88,124,183,116,5,238,188,243,70,108,223,186,73,46,71,5,175,215,139,178,210,18,248,188,13,95,87,66,95,71,136,98,65,171,7,176,
+242,139,242,241,245,183,203,224,241,9,204,156,57,15,107,86,255,136,154,234,106,185,27,17,17,17,133,81,195,101,31,67,134,143,194,247,95,45,193,164,41,199,226,139,197,31,193,237,114,117,232,77,106,195,15,
+255,195,71,142,65,85,85,37,188,141,222,0,71,187,186,1,155,224,117,84,20,5,70,163,17,186,208,107,111,187,35,105,252,129,48,84,83,183,125,227,223,25,25,154,187,44,135,47,167,174,11,4,2,254,218,15,186,77,
+247,87,85,21,102,179,25,46,151,171,3,131,62,10,172,54,43,12,6,35,220,110,87,147,3,88,6,131,1,170,170,54,59,144,214,80,83,167,175,147,156,146,2,139,197,10,159,215,215,236,17,30,91,26,0,107,47,163,209,4,
+205,160,213,127,152,84,20,21,70,147,17,6,131,1,1,93,135,162,32,100,64,173,171,245,200,204,198,19,143,62,141,74,151,15,203,151,126,35,151,219,69,8,1,77,83,97,177,90,33,116,209,194,32,29,117,158,208,215,
+172,208,193,235,80,62,159,15,191,172,95,131,215,222,124,3,27,214,175,70,85,101,133,220,165,93,236,118,7,142,158,49,23,27,55,174,197,234,21,75,59,240,186,209,57,20,69,197,150,205,235,176,124,233,183,112,
+187,92,80,85,181,201,1,100,34,138,44,13,223,105,181,42,61,123,245,22,137,73,201,33,237,12,19,237,113,56,131,83,244,229,246,112,69,81,84,145,147,219,91,56,156,78,49,229,232,89,98,196,232,113,33,125,24,134,
+97,154,202,241,11,79,19,251,118,29,172,223,164,117,231,182,125,226,154,235,127,43,18,18,19,219,188,84,64,94,74,50,253,152,185,226,55,191,253,155,72,75,207,168,175,203,167,137,150,132,251,178,203,203,114,
+154,91,162,19,137,57,124,89,155,95,218,213,213,215,67,254,125,13,111,203,186,255,107,154,38,12,6,67,139,151,59,82,163,105,90,179,75,18,229,235,222,157,73,74,78,17,87,93,119,155,24,57,102,124,72,173,35,
+81,20,85,168,77,44,129,236,72,18,19,147,68,114,74,106,72,123,87,196,108,54,11,167,51,33,164,157,105,93,250,246,31,40,62,252,224,123,145,149,157,19,82,139,180,68,210,243,147,97,152,230,211,252,215,86,68,
+113,104,214,156,227,161,40,192,215,139,63,145,75,97,161,40,10,102,207,91,128,193,67,70,65,85,53,188,243,230,243,17,181,145,37,117,159,186,13,133,203,74,75,228,18,197,57,69,9,46,245,249,224,141,255,193,
+108,55,35,224,245,3,138,2,205,168,193,239,241,97,240,136,17,216,181,163,249,3,172,52,181,113,111,112,73,137,128,195,225,196,253,15,62,141,43,46,61,21,138,170,224,130,75,174,195,203,207,63,209,168,111,188,
+11,206,208,57,76,190,45,35,89,221,101,87,85,165,209,146,191,186,118,33,116,228,246,238,139,242,178,210,86,111,13,209,212,227,169,37,173,233,95,119,121,52,45,248,127,191,223,223,232,50,182,134,166,105,208,
+117,189,219,103,79,40,138,10,69,105,126,25,102,36,234,221,183,63,172,86,27,54,111,92,47,151,34,130,201,108,134,162,40,240,184,221,114,169,83,165,166,165,99,198,49,243,225,118,213,160,32,255,32,126,90,179,
+162,221,75,103,227,149,193,96,68,159,126,253,177,125,235,102,160,149,175,7,68,68,45,105,245,18,66,162,120,80,82,92,136,130,67,7,225,118,183,102,105,73,251,148,151,149,192,96,48,96,217,210,175,177,111,207,
+110,185,76,113,202,225,116,194,104,50,161,166,186,74,46,81,156,51,24,52,12,27,49,6,70,83,50,70,12,239,31,220,215,196,160,66,4,116,156,122,246,133,88,190,244,251,144,37,35,141,53,254,64,31,28,24,8,238,83,
+243,167,123,30,193,13,215,157,87,127,250,145,67,70,224,179,197,159,163,180,164,36,228,116,145,174,110,41,152,221,238,128,174,7,32,132,128,197,106,133,197,106,173,253,208,25,220,11,166,173,215,75,190,109,
+219,115,30,205,177,90,173,176,90,109,29,222,43,200,102,179,193,96,48,54,90,38,215,112,224,77,136,224,229,62,124,217,235,150,25,137,250,165,122,173,63,10,92,219,174,123,227,223,219,156,186,125,186,130,251,
+63,213,221,230,109,249,160,171,170,106,171,151,29,118,174,166,247,176,106,45,85,85,225,116,38,64,116,240,40,139,13,213,61,55,154,163,105,26,220,110,87,139,91,131,104,154,214,161,235,213,17,129,64,0,129,
+110,88,114,169,42,42,106,106,170,224,170,169,70,114,106,58,10,11,242,27,61,79,76,102,115,237,243,151,75,37,155,163,235,58,74,138,139,208,187,111,127,184,92,53,8,212,15,78,119,207,99,137,136,98,67,253,116,
+44,134,97,24,166,123,98,181,217,68,82,114,10,167,176,51,205,38,53,45,93,188,248,210,135,66,215,3,162,186,188,82,204,63,241,212,250,90,123,30,55,151,95,115,107,253,114,196,64,192,95,255,239,11,46,185,46,
+42,151,110,41,138,42,140,38,147,72,75,207,16,170,166,9,69,81,132,166,105,194,110,119,212,46,71,107,223,210,191,134,167,107,207,233,91,74,90,122,134,232,145,153,21,210,222,218,88,173,54,97,179,217,69,106,
+90,186,112,38,36,54,170,53,92,150,215,212,229,110,170,237,72,177,217,237,34,33,177,241,239,105,41,205,253,238,166,34,247,109,237,233,162,41,154,166,9,85,109,254,58,153,204,102,225,76,72,16,233,25,61,132,
+205,102,139,152,235,111,177,88,69,106,122,70,139,151,61,150,147,153,149,45,250,244,27,208,168,205,106,181,138,180,140,12,209,127,208,144,144,254,76,227,244,238,219,95,108,218,176,67,76,156,50,93,160,157,
+127,175,24,134,97,26,36,164,129,97,24,134,233,166,216,29,14,97,50,155,67,218,187,34,217,61,115,197,19,255,121,93,76,156,50,173,83,247,130,99,218,22,249,205,254,209,51,230,136,177,19,38,55,91,111,109,174,
+189,225,78,225,174,118,53,26,196,250,230,235,85,98,200,176,145,33,125,163,33,77,13,126,52,188,109,26,182,181,245,54,107,239,233,58,59,206,132,68,225,112,58,67,218,155,74,115,151,189,181,215,77,81,84,97,
+48,26,133,201,108,110,85,223,182,156,111,48,74,72,255,166,78,171,40,170,208,52,77,152,45,150,144,246,166,250,31,41,237,57,205,145,162,40,106,253,160,105,195,118,163,209,36,12,6,131,0,32,12,6,131,72,76,
+76,106,52,40,212,210,254,89,221,25,69,81,197,168,49,19,68,207,94,125,66,106,93,145,186,199,134,220,222,157,209,106,7,201,81,123,249,228,58,19,124,220,88,44,22,113,203,109,247,8,93,15,136,205,191,236,20,
+195,71,141,13,233,199,48,12,211,198,132,52,48,12,195,48,221,20,77,211,132,22,230,13,112,91,155,164,228,20,241,234,171,159,136,130,131,133,98,205,170,77,98,216,200,49,33,125,152,174,79,221,135,123,121,246,
+67,221,108,142,166,62,216,41,138,218,98,13,128,80,85,85,76,159,53,87,124,245,229,10,161,235,1,113,239,3,79,139,129,131,135,133,244,143,182,212,13,100,52,76,75,237,173,73,91,250,134,227,116,173,73,74,106,
+154,232,213,167,175,192,17,62,64,167,165,103,136,132,132,230,55,250,111,237,109,17,236,87,247,129,61,60,183,173,124,154,186,88,109,182,218,1,130,166,207,167,169,223,35,255,124,164,254,117,49,24,12,194,
+104,12,14,26,53,215,167,173,81,106,7,217,228,246,186,26,106,159,127,54,155,189,217,126,29,77,107,175,135,217,98,105,85,95,139,197,218,109,95,174,40,181,3,130,114,59,3,49,117,250,49,221,182,193,125,75,169,
+123,76,77,156,50,77,248,189,190,250,47,74,174,191,249,247,33,125,25,134,97,218,146,198,59,147,18,17,81,183,10,4,2,97,219,247,164,173,202,74,75,112,243,45,151,97,203,182,125,24,51,110,16,206,60,243,82,185,
+11,117,131,224,62,64,74,253,62,70,170,170,54,216,47,168,185,125,130,4,12,70,163,220,8,212,158,159,162,4,247,10,250,254,155,47,112,197,213,23,224,134,95,223,141,167,254,115,63,182,109,217,8,72,251,39,69,
+154,186,203,214,220,101,172,187,61,132,208,235,255,221,92,223,230,219,21,104,154,86,255,115,211,183,113,203,154,59,239,246,10,110,14,126,56,30,183,171,254,160,15,13,247,38,170,251,189,38,179,25,19,167,
+76,195,37,151,223,140,140,204,172,35,94,135,214,93,94,37,164,159,252,179,76,81,84,24,12,198,250,203,141,218,141,157,77,102,179,220,21,168,189,173,77,38,51,236,118,71,253,99,85,86,119,223,54,188,78,242,
+207,168,221,79,202,106,181,66,85,15,239,99,38,223,142,129,64,160,209,166,241,128,104,242,119,182,150,162,4,247,151,107,110,47,174,186,203,168,235,58,106,106,170,143,248,122,175,105,90,179,207,229,150,168,
+106,221,222,99,45,243,122,60,33,183,155,166,105,33,183,129,219,237,106,195,62,105,225,37,132,14,127,59,247,192,58,188,7,91,108,154,61,103,33,198,77,60,74,110,142,24,13,15,76,83,152,87,140,111,190,254,184,
+81,157,136,168,173,184,137,59,17,17,1,0,28,14,39,126,125,219,95,48,103,230,100,188,241,206,98,60,243,204,35,40,200,207,147,187,81,183,8,126,241,116,248,67,165,82,251,161,243,240,192,69,83,132,8,30,217,
+205,110,119,64,23,2,186,174,67,85,85,24,140,6,8,61,184,89,118,73,113,17,86,44,251,14,37,197,69,181,31,92,235,62,236,181,124,222,221,71,192,233,76,128,102,208,96,179,217,17,8,248,235,7,11,234,62,236,7,127,
+174,187,252,117,183,221,225,15,177,70,147,17,168,189,61,100,138,162,194,106,181,5,7,0,84,181,254,118,170,187,253,143,188,33,121,80,240,131,115,112,16,165,35,155,95,39,36,38,193,106,179,193,227,118,55,184,
+207,5,124,62,31,60,77,14,40,8,24,77,38,220,120,203,31,113,231,173,183,227,177,39,254,137,245,63,173,134,162,168,48,26,141,208,245,195,3,38,193,141,185,107,79,37,116,56,157,9,48,24,12,240,249,124,181,143,
+181,134,3,99,205,15,2,4,7,154,66,55,187,175,187,254,137,201,201,80,20,192,231,245,6,7,149,108,54,152,77,102,248,124,222,250,223,223,240,116,62,159,23,138,2,4,2,117,247,79,251,110,63,85,85,161,105,6,248,
+124,193,193,143,186,219,175,241,101,149,175,87,199,30,255,6,131,1,6,131,1,126,127,160,221,231,81,71,85,85,36,167,164,194,233,116,162,166,166,186,77,143,163,182,244,149,239,235,224,105,91,127,250,72,162,
+170,193,215,59,175,215,11,77,211,160,170,26,236,118,123,135,15,148,16,105,178,123,230,98,228,232,9,248,252,211,119,160,11,29,227,38,78,133,223,239,67,121,89,169,220,181,155,4,31,63,229,101,37,168,116,27,
+48,160,119,95,220,240,155,219,241,221,87,159,201,29,137,136,218,164,253,95,49,17,17,81,76,153,114,244,44,252,250,87,23,225,146,107,174,193,101,151,156,130,13,63,175,145,187,80,55,107,106,230,73,115,2,129,
+64,125,63,187,195,1,85,13,254,201,55,154,76,48,155,204,245,231,211,112,166,133,174,183,52,171,171,235,4,7,63,154,127,139,226,114,213,192,227,246,192,104,50,65,109,48,83,42,33,49,9,137,137,73,71,188,252,
+1,191,31,186,222,244,7,116,131,209,0,0,240,120,188,16,77,12,112,181,70,221,101,215,117,189,217,223,211,26,138,162,194,239,243,162,186,186,234,136,215,169,33,85,81,176,127,255,110,252,227,161,7,176,124,
+233,183,0,0,179,217,132,140,30,153,210,253,45,205,188,49,24,26,205,60,107,173,186,243,12,189,140,74,240,113,168,235,48,214,206,34,18,2,112,213,212,160,188,188,92,234,123,152,174,235,112,185,218,118,52,
+224,166,30,47,129,64,0,46,87,77,253,207,13,47,103,115,207,165,166,218,218,194,239,247,215,95,246,166,46,83,91,232,186,14,127,237,64,101,27,198,163,154,100,119,56,96,183,59,228,230,122,154,166,181,235,190,
+143,52,138,162,192,31,56,60,163,78,8,29,110,143,91,238,22,181,234,6,209,133,16,40,45,45,66,97,65,62,252,126,63,156,206,196,110,155,33,215,146,64,32,128,7,239,253,61,38,76,25,131,15,222,121,53,100,160,155,
+136,168,173,90,247,53,34,17,17,197,188,228,148,84,88,109,54,28,220,191,79,46,17,117,169,186,15,210,71,90,94,213,80,240,131,93,112,246,72,115,179,79,154,26,80,144,7,43,154,31,140,105,27,69,81,59,124,30,
+225,18,252,208,168,64,85,149,218,65,202,208,203,37,95,222,134,63,55,117,187,201,154,58,109,83,183,101,83,231,165,105,106,112,134,96,131,251,187,169,203,131,218,243,106,120,30,135,47,99,240,131,113,83,247,
+125,83,253,91,34,255,238,246,144,47,111,71,207,175,163,140,38,19,132,222,252,82,60,77,211,160,168,42,252,62,159,92,138,42,135,31,123,193,199,60,90,121,159,71,147,134,143,39,85,13,46,7,143,84,242,99,95,
+254,57,22,100,100,102,33,57,57,5,7,15,236,71,101,69,243,3,243,157,205,106,181,97,226,148,105,56,176,127,15,118,108,219,34,151,137,98,6,151,16,18,17,17,0,192,237,114,161,178,162,2,168,255,240,21,250,65,
+144,40,28,20,69,133,166,169,208,52,13,102,179,57,228,67,117,75,131,80,205,107,205,105,130,75,163,14,15,118,52,245,65,42,92,203,167,194,113,30,29,23,252,192,24,188,78,45,47,13,171,91,162,90,87,63,220,175,
+53,179,38,234,150,86,90,44,22,40,170,82,59,24,213,212,239,107,188,132,79,211,130,31,192,235,238,59,139,213,10,163,209,88,59,131,176,225,105,27,46,229,60,124,250,224,108,189,224,96,69,115,247,127,203,247,
+119,144,166,105,208,12,134,218,217,45,135,207,87,211,66,7,220,90,227,240,101,20,208,52,21,6,163,17,74,237,128,67,112,47,177,174,253,14,89,15,4,90,28,232,16,205,44,169,109,45,139,197,10,163,209,4,191,63,
+188,3,96,170,170,34,37,53,13,170,162,194,231,243,202,229,38,132,62,110,235,238,203,195,143,149,174,187,221,195,173,110,96,244,240,117,57,252,220,83,218,176,196,185,161,148,180,52,204,61,254,100,248,124,
+30,4,2,1,120,194,58,99,77,190,92,109,187,108,209,160,79,191,129,72,239,145,137,210,146,34,212,84,87,203,229,46,225,76,72,68,191,1,131,144,157,211,27,255,248,203,253,24,52,108,2,214,175,91,137,234,234,42,
+185,43,81,212,227,0,22,17,17,53,33,246,222,100,82,235,56,19,18,209,127,224,96,84,148,151,181,105,6,84,91,104,154,10,147,201,4,69,85,97,54,91,194,252,129,233,200,130,131,20,237,255,176,30,93,218,242,92,
+14,237,219,112,246,210,145,40,138,2,163,209,0,93,136,250,189,195,154,250,64,125,120,112,7,181,179,230,128,186,69,1,154,166,193,153,144,8,159,207,23,242,248,171,59,191,186,25,54,135,103,218,52,63,56,213,
+248,242,55,119,253,4,44,86,43,236,118,7,12,6,3,60,30,119,163,193,129,224,239,10,61,109,67,13,15,174,208,240,119,214,181,29,94,158,219,240,84,13,7,91,130,167,55,154,140,80,107,15,178,208,90,6,163,17,170,
+166,181,233,52,109,97,168,31,216,107,254,54,200,238,217,11,170,166,162,38,204,31,152,133,8,238,121,151,154,150,142,138,242,178,22,47,67,40,121,191,179,160,166,30,147,209,162,238,113,223,240,186,29,126,
+236,55,255,156,107,142,162,40,80,160,32,187,103,47,76,154,60,19,23,95,116,53,242,10,14,226,224,254,189,114,215,14,136,205,129,171,58,149,229,101,40,46,42,68,73,113,145,92,234,50,125,251,15,68,98,82,10,
+138,138,242,145,221,179,63,46,187,224,20,244,234,59,10,95,126,249,113,68,46,45,37,234,8,14,96,17,17,17,17,28,78,39,146,83,211,96,52,153,96,48,24,81,93,85,1,95,39,45,39,18,66,192,239,247,35,224,247,119,
+249,224,21,164,25,11,177,252,193,170,142,209,100,66,66,66,98,237,166,239,109,187,190,77,13,0,180,196,231,243,65,132,236,251,213,252,0,86,195,241,8,69,81,224,247,251,81,83,93,13,189,193,230,249,104,184,
+65,127,32,80,63,64,100,50,155,208,220,102,252,8,25,188,66,19,151,163,174,46,32,244,224,222,87,94,159,183,126,246,152,162,40,245,179,195,26,206,34,81,85,21,102,179,57,56,208,230,245,66,8,1,205,96,64,106,
+90,58,140,38,19,220,174,154,250,211,215,254,166,6,191,245,48,69,81,96,48,212,13,60,5,251,155,76,38,8,161,215,222,46,242,237,216,52,83,237,115,182,238,246,169,27,228,81,20,21,70,147,177,246,254,104,221,
+121,213,81,20,181,126,67,122,155,221,1,40,104,113,121,97,85,101,5,170,42,43,235,127,54,153,204,33,3,144,237,85,93,93,133,210,146,98,24,12,70,164,164,166,194,96,52,182,248,186,81,247,188,14,189,255,131,
+131,61,137,73,73,48,25,77,81,186,177,187,128,221,238,128,205,110,175,221,27,77,135,102,48,96,246,220,5,72,72,76,196,161,188,3,80,148,224,160,99,106,90,122,163,25,65,9,137,73,80,85,181,209,44,57,165,118,
+102,219,142,109,155,81,85,85,142,147,23,158,14,183,95,199,202,101,223,213,247,105,200,96,48,192,104,50,33,208,204,82,212,120,228,247,251,225,118,183,109,207,190,112,43,41,42,196,190,189,187,112,40,239,
+0,62,253,228,29,252,244,203,86,244,204,237,131,125,251,119,227,208,193,253,114,119,162,168,214,250,33,122,34,138,11,70,147,41,248,225,178,133,55,170,177,110,238,241,39,65,85,84,124,241,233,123,205,126,
+48,34,138,53,67,135,143,66,191,1,131,177,99,251,102,236,221,189,19,174,26,87,179,179,90,98,69,221,7,220,88,191,158,154,166,193,100,50,193,237,14,126,224,109,139,166,6,1,218,170,185,223,217,154,243,174,
+59,109,221,12,167,224,107,114,112,22,138,221,238,128,215,231,133,207,219,244,210,178,166,207,63,120,148,198,224,105,14,207,96,81,142,176,87,79,195,199,138,213,106,173,107,133,199,227,174,255,59,97,181,
+218,16,208,3,205,206,120,168,59,15,85,13,254,94,85,211,96,208,180,70,247,139,201,100,66,66,98,18,170,171,42,91,181,145,189,211,153,0,159,207,7,191,223,7,171,213,134,154,154,234,70,3,71,242,245,104,45,165,
+118,153,111,240,72,156,58,2,129,182,109,110,31,60,18,227,145,7,57,18,18,18,81,93,93,117,196,193,174,186,235,225,116,38,0,138,210,236,94,67,117,131,87,135,247,209,59,124,153,235,46,191,193,96,4,16,28,68,
+63,18,163,201,4,135,195,137,210,146,98,185,212,109,130,71,97,53,160,172,180,4,169,105,233,24,60,116,36,70,142,158,136,229,63,126,141,159,86,175,0,106,159,243,169,105,233,40,44,40,168,191,222,169,105,233,
+240,184,221,168,170,58,60,208,8,233,177,173,170,26,140,70,67,51,71,56,13,158,175,170,170,157,246,229,6,133,143,197,98,129,193,104,108,52,176,76,20,11,56,128,69,68,141,36,38,38,33,57,53,13,187,119,110,151,
+75,49,207,100,54,227,238,63,63,140,59,126,115,5,14,237,47,68,223,65,125,224,113,55,255,45,47,81,44,49,153,205,72,75,207,128,209,104,66,85,101,5,116,93,143,168,15,109,212,113,237,25,204,104,122,16,168,109,
+154,251,157,173,57,111,85,13,30,145,178,110,128,163,225,128,86,75,95,48,180,116,222,70,147,17,126,191,191,126,54,87,115,151,175,161,134,253,130,51,171,90,191,12,245,240,224,219,225,183,220,193,235,21,156,
+113,214,240,188,85,85,133,213,106,131,219,237,106,118,195,253,134,130,179,192,60,181,179,113,130,179,142,142,116,154,214,106,205,121,181,166,79,115,84,85,133,197,98,129,203,229,62,226,121,52,28,100,105,
+201,225,251,61,56,83,174,225,109,104,50,155,33,132,104,118,192,179,41,86,171,21,86,155,29,165,37,37,71,252,221,93,161,225,237,109,181,218,112,210,105,231,97,203,230,117,88,255,211,234,70,3,114,242,253,
+34,255,220,80,195,231,74,115,125,136,136,34,69,243,127,221,41,106,104,90,251,14,123,77,212,148,154,154,26,20,21,228,203,205,113,225,152,99,79,192,29,191,185,2,1,159,31,215,255,230,142,184,25,188,82,148,
+224,7,196,195,63,243,79,67,60,242,122,60,56,184,127,31,202,203,74,224,245,122,90,185,97,50,69,139,186,231,117,91,158,223,109,233,27,14,242,135,103,33,116,168,90,112,70,136,16,135,103,0,89,173,214,144,215,
+172,134,215,239,72,151,219,235,241,212,238,209,213,244,135,250,186,243,80,20,21,38,179,25,154,166,53,234,39,196,145,7,150,234,212,45,55,52,153,76,141,218,3,129,0,2,129,198,71,84,4,0,33,130,75,230,90,51,
+35,73,85,85,84,86,148,195,237,118,35,184,49,124,211,215,167,189,90,58,47,187,221,1,155,205,222,98,159,35,17,2,240,122,189,248,127,246,222,59,206,146,163,186,251,254,85,85,199,155,38,207,108,94,101,9,161,
+136,50,8,137,40,68,198,128,13,24,99,140,13,54,142,128,141,205,99,108,108,140,3,224,240,24,39,192,175,49,6,28,72,150,9,6,195,99,19,77,78,66,66,57,167,213,230,221,201,55,117,168,247,143,83,213,93,29,238,
+157,153,221,89,105,67,127,63,159,218,157,219,93,93,93,117,170,170,111,215,185,231,156,114,28,27,80,214,61,118,78,78,26,221,255,43,245,111,90,159,84,97,168,243,79,78,78,99,124,98,210,200,13,212,106,53,88,
+150,149,57,102,18,4,129,138,189,117,232,237,92,111,116,123,106,245,58,246,239,219,141,31,253,240,251,137,242,106,144,108,214,38,187,138,138,138,138,163,151,193,79,177,67,160,213,26,201,31,170,88,103,158,
+248,228,107,240,43,111,120,11,252,90,13,92,8,188,252,149,191,136,255,247,185,111,192,243,188,124,214,138,138,67,34,8,250,5,243,242,19,1,219,113,112,209,227,30,143,15,127,248,243,120,252,213,79,197,117,
+31,253,192,208,23,189,227,5,90,240,72,76,77,79,227,113,151,92,1,84,47,177,39,60,115,179,179,88,92,200,198,179,169,168,88,45,150,109,193,86,10,137,181,33,225,251,181,196,189,14,234,249,20,244,251,25,87,
+58,207,247,209,28,25,5,51,242,173,149,149,158,237,230,51,48,10,195,140,229,212,90,209,74,154,188,75,150,169,108,202,42,199,82,165,214,160,103,113,122,94,197,6,27,162,128,57,28,180,146,172,140,94,175,135,
+32,12,214,28,35,205,68,202,24,182,237,192,243,200,37,83,74,169,226,143,21,97,140,118,45,61,140,219,97,255,254,189,133,93,226,90,35,163,112,92,55,115,204,36,138,226,21,149,137,143,36,90,145,7,0,7,246,239,
+195,23,254,223,127,34,82,150,132,230,184,46,27,59,249,99,90,166,249,227,21,21,21,21,71,51,235,226,66,56,50,58,134,215,253,250,239,227,9,151,94,138,31,127,201,179,176,48,63,151,207,82,177,14,92,245,228,
+103,224,191,63,243,73,56,190,131,79,126,226,43,152,156,24,197,149,87,93,128,191,123,207,71,240,171,191,252,242,124,246,138,138,138,85,194,24,71,163,209,192,216,196,4,30,188,255,190,252,233,227,26,189,136,
+218,180,101,43,254,254,221,255,138,47,124,245,75,120,207,223,252,9,250,107,112,177,168,168,168,56,126,89,73,217,99,98,217,22,92,199,69,175,223,75,226,38,17,18,121,151,187,124,185,140,1,174,235,162,223,
+239,39,10,35,51,191,237,56,216,188,121,27,192,128,157,15,63,84,26,103,42,95,230,106,209,247,49,149,74,249,178,86,179,200,31,25,29,67,16,244,51,74,146,97,229,12,82,84,153,245,24,132,190,86,43,252,242,113,
+175,56,103,135,173,120,177,108,27,142,237,160,221,206,42,125,242,120,158,143,102,171,133,125,135,97,189,61,72,22,250,28,99,192,228,244,12,150,23,23,209,237,118,134,182,109,37,69,78,182,79,104,108,98,72,
+222,178,227,71,18,215,117,225,184,222,192,56,95,38,249,49,59,172,174,150,101,193,247,107,88,92,92,0,148,37,227,248,228,20,30,126,136,118,28,228,156,227,180,51,30,131,7,239,191,71,89,245,85,12,98,216,120,
+173,168,168,56,178,28,218,55,189,129,101,89,120,213,171,95,135,223,251,237,95,198,127,126,254,115,232,15,217,21,164,226,240,56,249,148,51,224,248,14,162,32,194,11,126,236,73,184,242,170,11,208,94,104,227,
+157,239,252,157,124,214,138,138,138,85,50,50,50,138,90,141,94,232,180,242,42,239,82,119,188,162,127,121,109,141,140,226,169,215,60,31,207,120,198,101,248,203,63,123,11,158,241,236,23,230,179,86,84,84,84,
+172,72,28,69,232,245,123,8,131,48,81,94,113,206,48,50,58,6,207,247,96,89,54,108,199,41,13,123,32,37,208,233,80,220,39,141,249,28,182,44,75,237,94,73,193,202,215,19,82,144,208,226,223,118,28,181,153,201,
+224,133,41,229,207,154,2,209,245,18,144,244,29,162,161,114,202,93,14,165,97,77,163,209,202,39,10,52,158,30,51,101,97,254,29,199,178,84,153,147,151,35,99,20,91,43,95,239,97,68,97,184,170,64,242,181,122,
+29,211,27,54,13,180,214,50,241,125,127,64,255,23,101,97,34,37,112,112,255,126,244,122,189,85,91,196,229,203,203,203,81,29,205,125,38,180,156,164,140,87,213,174,245,68,239,106,183,154,190,50,219,152,111,
+111,158,40,138,209,233,180,147,114,123,189,30,246,236,218,153,201,179,127,223,158,85,5,183,63,209,49,199,235,106,250,169,162,162,98,253,16,0,222,154,63,184,22,44,219,198,228,244,12,254,225,125,239,199,
+199,62,252,254,234,161,119,4,185,231,174,219,208,9,60,92,120,238,217,240,235,228,50,248,224,3,187,241,167,127,246,39,3,77,174,43,142,47,44,203,26,26,180,182,98,109,120,158,7,199,117,177,188,188,148,108,
+59,158,146,255,124,252,81,111,52,176,117,251,201,176,45,27,175,254,217,95,193,99,207,58,5,247,220,189,3,55,222,114,59,126,248,253,111,229,179,87,84,28,85,208,66,244,145,157,167,181,90,13,182,237,32,142,
+227,146,103,198,163,131,86,120,48,198,214,92,167,84,17,99,198,10,202,150,177,150,197,153,148,64,20,133,133,107,184,224,240,107,117,196,113,4,193,5,108,219,70,191,223,43,228,203,127,6,0,33,40,134,84,24,
+132,152,61,184,31,221,78,23,81,20,34,82,193,207,233,7,7,74,135,130,148,113,114,173,235,58,176,109,7,18,82,149,159,150,41,4,135,16,22,28,199,129,101,145,2,38,251,125,44,209,235,117,17,4,65,166,94,66,112,
+218,109,208,182,17,71,164,204,26,78,209,90,13,144,240,107,62,44,33,192,56,89,35,121,158,135,48,12,85,253,243,253,168,235,173,239,37,161,149,104,195,222,33,202,250,95,127,30,166,196,137,226,8,221,78,27,
+99,227,19,144,82,14,180,224,101,140,163,222,104,38,1,244,87,143,4,99,12,113,28,169,250,231,235,152,69,183,223,148,9,65,114,48,147,206,203,57,131,237,56,74,57,70,215,52,154,77,180,70,70,177,245,164,147,
+149,27,232,35,243,35,253,48,87,202,195,67,102,250,95,202,226,231,78,167,61,116,140,84,0,79,122,234,51,49,57,61,141,165,165,69,60,239,133,63,137,159,120,233,207,226,161,135,238,173,54,61,169,168,120,132,
+24,252,109,180,74,250,189,30,62,117,221,191,225,43,95,252,124,254,84,197,58,179,180,180,136,127,254,224,223,161,221,238,226,55,223,252,14,252,253,251,174,195,175,252,198,27,214,180,155,74,197,177,139,101,
+219,56,249,212,211,135,190,68,86,172,141,94,175,135,217,131,7,74,127,189,62,222,97,140,163,221,110,99,207,238,157,56,231,252,139,241,228,39,94,132,95,122,195,155,113,206,5,103,226,31,223,251,23,249,236,
+21,21,71,37,69,107,138,35,75,44,37,194,18,5,205,163,137,212,86,67,246,218,226,78,153,178,211,127,175,100,193,177,26,242,125,18,199,49,122,221,46,194,126,31,81,20,161,215,235,42,235,146,149,251,78,183,109,
+124,114,10,92,80,254,126,191,135,94,183,187,170,235,87,130,115,6,223,247,193,57,83,73,160,219,237,148,150,111,219,14,124,223,71,24,69,8,130,160,52,0,123,94,142,82,197,120,170,215,27,112,148,85,23,41,155,
+40,95,254,122,13,89,119,100,149,52,65,16,0,74,41,67,74,162,162,11,165,198,180,14,49,209,177,146,242,212,234,117,108,221,118,18,132,146,113,30,223,247,49,54,62,1,0,176,44,27,181,90,61,51,7,72,49,7,180,70,
+71,11,245,214,48,198,224,186,46,41,249,134,188,183,230,223,113,72,9,72,10,195,213,204,187,124,251,242,159,243,152,86,52,182,101,129,115,150,196,149,221,118,210,169,152,222,176,17,253,94,175,80,175,138,
+19,24,6,156,127,193,229,120,239,123,254,13,239,127,247,95,225,204,83,79,199,220,236,129,124,174,138,138,138,35,68,254,167,137,138,99,128,141,155,182,96,239,158,93,39,228,162,251,68,70,191,252,85,113,9,
+42,214,3,115,161,85,111,52,240,236,231,189,4,95,255,223,255,198,206,29,15,229,179,86,84,28,149,172,118,97,250,72,224,184,46,44,203,42,4,136,94,13,156,115,212,234,117,180,219,237,67,182,186,176,29,7,150,
+16,232,118,123,171,106,119,94,118,135,114,205,218,144,144,146,118,253,91,27,18,156,147,117,81,26,79,107,125,113,28,27,76,185,255,105,183,234,78,39,171,96,51,3,203,167,214,41,233,49,83,126,101,109,228,60,
+221,17,15,57,165,73,107,100,4,81,24,97,121,121,121,104,63,104,197,149,89,126,89,126,243,217,78,237,162,60,181,122,29,181,90,29,7,15,236,79,218,160,207,59,142,131,90,189,129,133,133,249,194,24,100,140,43,
+197,22,67,24,6,224,156,99,122,102,35,58,157,101,204,207,81,204,91,206,57,182,108,59,9,7,15,236,43,108,254,96,59,14,184,234,191,102,171,137,94,183,135,118,123,57,83,55,0,24,159,152,128,235,122,216,189,107,
+87,230,122,109,93,24,69,49,108,199,134,235,184,232,116,40,6,214,176,246,15,130,115,134,209,177,113,204,205,30,76,222,163,77,153,1,192,101,143,191,10,23,92,120,57,126,249,213,175,198,155,255,224,45,248,
+204,39,63,154,228,43,187,231,177,194,200,232,24,32,37,230,171,88,197,135,205,51,159,251,98,124,246,83,31,197,155,127,239,207,241,215,127,249,182,67,122,246,87,84,84,28,26,195,159,242,21,71,37,187,118,238,
+168,148,87,39,32,82,202,74,121,181,78,172,244,130,123,60,195,74,98,169,44,47,45,225,99,255,246,143,216,185,227,161,194,249,138,138,245,98,53,227,106,165,241,167,207,15,203,163,89,75,222,181,194,114,187,
+179,57,142,131,86,107,52,147,103,37,24,35,151,37,41,129,110,167,3,185,202,184,62,101,196,81,132,112,192,130,126,24,114,128,165,78,25,171,205,87,206,234,227,10,210,125,180,44,24,226,56,62,98,225,41,164,
+140,105,55,189,160,143,32,232,195,245,220,76,236,41,77,28,203,36,149,197,76,26,54,214,164,204,238,98,103,202,81,74,138,95,149,87,164,148,83,148,161,121,95,243,254,66,20,173,188,164,148,8,250,253,140,242,
+74,255,223,239,247,49,55,123,176,116,12,74,73,242,15,67,178,0,139,227,24,7,14,236,67,24,164,125,194,24,195,236,193,3,165,139,120,199,182,201,45,83,198,152,155,157,43,85,94,1,0,227,28,65,24,20,142,155,49,
+190,44,203,162,93,3,141,24,101,166,76,210,182,14,30,171,92,144,11,43,79,172,186,178,215,51,198,113,231,237,183,64,8,11,253,126,128,249,185,131,25,217,154,249,7,97,246,71,89,122,180,176,236,35,179,91,229,
+137,200,221,119,222,130,231,191,232,229,248,243,119,252,78,233,184,175,168,168,56,114,84,22,88,21,21,21,39,20,218,21,225,68,84,2,23,95,156,211,69,98,114,100,200,139,127,69,197,161,226,184,46,4,231,43,6,
+132,118,92,55,89,104,155,20,199,238,218,89,207,177,45,84,76,163,222,97,254,168,160,173,106,202,16,66,172,24,107,75,203,229,80,218,198,148,18,65,255,159,61,71,207,132,252,189,215,163,31,86,194,113,72,129,
+212,239,107,151,57,170,207,48,43,44,106,7,203,60,203,214,66,153,50,100,16,82,5,245,38,209,20,159,161,121,180,85,87,153,5,150,73,89,63,228,177,44,11,218,18,106,53,117,53,201,151,61,236,122,178,122,226,137,
+210,42,207,134,141,155,96,217,14,14,236,219,139,78,167,13,199,117,49,54,54,142,61,187,179,214,83,131,224,156,15,140,179,100,202,129,234,72,74,67,198,82,235,183,97,117,135,146,249,32,25,49,206,16,71,81,
+242,46,64,101,210,114,136,115,158,81,150,217,182,99,4,61,95,221,247,100,217,61,203,24,86,198,35,205,225,60,71,78,68,86,51,87,43,42,42,142,28,135,29,196,189,162,162,162,226,88,194,118,28,132,42,150,200,
+137,68,246,5,85,130,130,215,242,146,152,34,131,23,203,21,21,135,74,28,203,161,86,52,122,28,90,150,165,92,131,104,28,150,143,209,67,165,124,108,51,198,96,89,22,5,217,142,117,80,231,242,188,26,41,41,200,
+247,145,130,41,11,47,83,193,165,101,65,10,29,90,216,91,150,128,22,143,16,34,113,101,92,93,221,116,185,12,92,168,29,244,140,123,115,206,97,41,75,21,237,86,182,126,125,81,14,231,12,142,235,130,113,14,169,
+148,119,156,51,120,190,15,25,151,7,32,103,140,44,224,192,24,148,86,41,57,78,202,163,149,250,50,45,115,165,246,217,182,133,137,169,105,116,187,93,101,173,52,92,105,38,101,156,236,252,71,10,21,26,91,245,
+70,3,245,122,3,174,231,101,226,109,173,52,246,164,148,0,211,138,197,52,0,249,106,160,177,179,186,128,247,140,49,56,142,13,41,201,245,51,79,28,147,194,176,94,111,96,105,113,1,81,20,97,121,105,201,80,56,
+101,209,199,25,227,216,178,109,59,226,56,70,191,71,65,252,235,245,6,162,40,4,41,169,168,94,181,90,13,190,95,67,175,215,133,16,2,140,177,140,194,112,165,250,167,27,222,148,228,83,187,68,234,50,40,31,185,
+143,198,177,196,198,77,155,1,101,241,30,134,1,132,16,112,85,192,124,168,62,173,213,106,0,35,69,88,30,93,46,253,167,229,71,227,88,31,59,154,236,7,178,10,183,180,78,205,86,11,245,122,3,221,21,126,116,56,
+209,216,178,117,59,70,70,199,176,80,185,97,86,84,60,106,172,238,103,130,138,138,138,138,227,132,64,253,170,127,98,34,209,108,182,240,130,23,255,20,174,125,206,11,149,85,64,156,44,128,171,95,20,43,142,20,
+178,36,40,53,212,226,137,22,80,228,78,103,89,54,60,207,79,206,173,39,131,202,147,42,174,144,37,68,38,214,81,30,198,120,98,181,113,164,145,202,109,139,49,102,4,103,167,69,176,148,18,182,178,82,178,109,7,
+150,109,171,197,63,71,173,86,39,101,206,26,145,57,197,144,84,174,109,122,183,184,65,178,91,111,162,40,66,24,4,112,108,7,80,59,241,49,206,97,9,75,107,4,212,34,91,42,125,85,156,236,240,87,175,55,148,5,31,
+181,133,11,145,236,22,56,140,181,180,45,142,37,122,157,78,65,94,26,41,99,67,81,65,101,119,58,237,100,103,66,202,67,59,191,69,33,237,164,104,142,41,33,132,178,178,74,175,55,145,198,238,116,249,115,69,138,
+243,109,181,196,113,49,100,65,58,87,129,118,123,25,19,147,211,25,151,52,125,78,231,35,5,172,110,51,201,75,43,20,251,106,55,63,198,24,54,110,222,10,207,243,213,51,130,82,28,167,74,108,207,243,149,18,16,
+216,188,117,59,236,85,140,239,126,191,135,82,229,149,218,137,81,42,183,206,40,138,212,252,161,177,199,57,131,95,171,101,148,185,81,20,193,177,29,53,247,86,167,236,212,113,187,164,148,152,222,176,17,151,
+92,126,37,192,200,29,182,236,57,120,52,32,101,140,77,91,182,97,219,73,167,96,100,116,12,163,99,19,24,29,163,192,253,71,2,219,113,112,210,41,167,13,149,227,209,200,194,194,28,14,236,219,147,63,92,113,2,
+226,56,14,174,122,202,51,176,117,251,73,249,83,21,71,152,202,2,171,162,162,226,4,227,232,124,121,60,242,80,187,47,186,244,241,248,216,135,62,128,87,253,204,203,177,115,95,27,183,223,250,35,244,251,125,
+245,18,121,162,202,230,248,99,195,198,205,232,245,123,165,22,2,71,19,122,241,34,101,12,174,118,27,139,99,82,156,172,247,194,198,92,124,10,33,148,27,24,141,249,56,166,157,229,180,181,68,57,229,214,40,71,
+18,125,187,122,163,129,56,138,149,165,10,48,58,54,142,177,241,9,204,30,60,128,56,138,192,57,199,232,216,24,22,23,22,208,233,180,179,133,172,72,190,77,105,59,101,98,129,163,23,244,135,223,39,212,15,229,
+214,67,122,209,31,4,125,181,203,31,89,85,197,50,86,138,180,52,31,93,207,32,99,153,200,37,138,162,36,142,19,231,28,177,148,37,113,157,244,103,42,76,43,5,87,86,8,145,60,186,221,78,230,90,170,51,253,61,50,
+58,150,4,25,55,219,103,14,27,198,24,130,160,143,126,191,135,126,191,159,83,180,164,117,163,114,99,212,106,117,140,140,142,161,215,235,38,245,52,231,205,32,89,58,142,51,208,229,114,117,80,187,82,89,171,
+163,234,115,175,215,197,242,210,18,194,48,202,181,53,134,239,251,216,122,210,73,152,159,61,8,41,37,28,215,69,179,217,66,175,215,195,252,220,108,98,233,40,101,140,133,249,121,68,81,8,198,56,154,173,38,130,
+32,64,16,4,232,247,201,66,43,12,195,196,173,143,115,142,32,8,212,115,173,216,102,77,153,60,8,134,70,179,129,107,159,243,34,156,125,206,133,56,120,112,31,54,109,222,138,31,127,233,207,2,76,98,239,158,93,
+56,176,111,47,130,64,127,39,50,0,18,189,94,55,249,155,234,45,73,33,85,242,124,213,242,137,162,8,167,158,113,22,254,231,179,95,196,207,254,244,79,227,195,31,251,40,252,90,13,147,83,51,152,159,155,83,229,
+231,199,230,163,65,58,191,207,62,247,2,252,225,91,255,2,183,223,117,43,110,187,249,198,35,186,179,222,201,167,156,134,51,206,124,44,238,187,239,238,129,10,225,163,17,138,153,119,34,255,16,90,161,153,217,
+184,9,191,253,166,63,194,15,126,248,29,236,217,189,51,127,186,226,8,82,41,176,42,42,142,32,147,83,211,176,44,11,189,222,224,237,174,43,42,30,9,104,113,38,113,96,223,94,204,119,128,107,158,122,21,158,255,
+188,103,224,169,79,126,30,254,243,179,159,192,242,82,118,231,168,227,25,198,56,166,103,102,208,233,180,31,113,133,196,35,1,99,28,142,227,160,123,12,180,79,47,52,245,162,80,7,139,94,141,50,97,237,164,178,
+72,21,51,135,143,86,40,28,153,5,41,45,152,29,215,77,92,121,46,127,194,213,248,196,199,62,141,203,46,127,50,62,241,201,143,42,119,65,82,6,80,220,168,245,174,67,218,198,245,32,149,85,57,82,82,255,152,68,
+97,152,244,153,30,43,102,22,41,129,32,232,171,133,176,82,238,196,229,202,43,219,182,97,219,182,178,196,49,149,29,131,235,100,98,214,157,115,1,128,44,170,108,199,65,189,222,192,252,252,188,106,67,12,33,
+40,86,150,76,98,116,65,245,105,58,102,178,231,178,202,46,64,194,178,168,190,221,110,199,104,191,86,92,209,115,93,143,147,44,74,209,178,70,116,217,229,101,166,244,122,93,101,89,150,205,195,24,131,132,68,
+191,171,21,116,36,115,97,217,134,34,40,205,27,199,17,226,56,198,200,232,40,54,108,218,130,253,123,247,24,227,45,59,167,58,237,182,225,70,58,184,110,131,144,50,198,233,103,158,141,255,250,196,117,120,197,
+43,126,2,103,159,117,25,30,216,241,32,222,251,174,63,195,129,185,0,95,254,226,127,25,114,77,45,174,210,231,17,213,37,142,73,161,90,6,181,41,198,134,77,155,241,181,47,126,13,167,158,177,21,126,205,195,228,
+212,105,120,253,175,190,14,150,55,130,175,125,245,191,51,237,58,90,120,218,53,207,195,79,253,196,11,240,158,127,120,15,102,15,236,207,159,94,87,106,181,58,38,38,167,113,223,61,119,30,210,56,173,168,120,
+180,233,116,58,184,251,158,59,112,255,189,119,169,103,91,197,35,137,20,66,72,198,56,125,91,85,169,74,85,90,183,116,201,229,87,202,39,92,245,212,194,241,42,85,233,145,78,140,241,228,57,207,133,144,223,251,
+206,45,50,10,67,249,47,255,250,89,57,53,61,83,200,127,60,39,33,132,156,158,217,80,56,94,165,71,62,233,113,153,79,195,206,29,106,202,223,251,112,83,190,92,206,143,204,189,24,99,18,128,60,243,49,231,200,
+247,188,247,35,178,179,184,44,227,56,146,113,28,201,215,191,241,173,82,8,171,112,205,122,167,188,44,15,37,65,61,123,44,203,146,182,227,72,219,118,10,121,134,39,38,57,231,146,115,46,133,176,50,242,78,202,
+207,29,27,148,244,123,175,89,118,62,15,99,76,90,150,93,200,155,202,131,21,174,203,203,171,213,26,145,150,69,253,163,143,89,150,157,201,171,63,151,149,83,150,132,16,153,148,239,31,42,211,74,206,229,207,
+235,52,72,86,174,235,202,86,107,68,58,174,91,56,183,218,100,214,55,255,121,165,99,249,178,40,165,125,159,151,121,254,190,249,99,249,243,205,86,75,190,224,197,47,151,247,222,245,160,236,46,181,101,123,97,
+89,254,241,59,222,35,39,38,167,100,189,222,144,80,227,168,88,63,154,135,249,250,230,19,99,92,58,174,43,95,255,198,63,72,230,105,208,235,203,56,142,100,191,219,147,143,57,231,188,194,53,71,67,58,249,212,
+211,229,47,191,254,119,229,41,167,157,94,56,119,36,146,16,66,54,155,173,194,241,42,85,169,74,85,90,41,9,0,111,37,205,183,204,43,182,42,42,42,14,147,93,15,63,132,61,187,31,62,33,119,188,123,36,153,158,217,
+128,179,30,123,30,118,61,252,80,254,84,6,203,162,56,42,39,226,175,125,250,87,114,198,24,158,247,99,47,133,100,46,126,253,141,175,199,223,252,213,219,79,184,45,160,165,148,88,94,94,202,31,174,120,84,40,
+183,242,40,59,118,184,104,139,23,157,6,189,247,216,182,157,88,121,88,150,5,215,245,10,187,177,177,100,23,42,137,141,155,183,192,117,93,53,143,116,123,202,203,54,73,173,103,134,163,243,61,233,169,207,196,
+59,223,254,102,88,142,133,176,23,96,239,158,89,204,47,244,208,237,119,113,207,93,183,231,47,91,55,214,203,26,206,113,29,114,219,84,125,193,249,224,93,5,7,195,96,219,22,70,70,71,209,239,245,213,179,92,194,
+113,28,120,190,191,234,13,58,138,95,1,197,241,38,165,132,231,121,0,99,136,194,48,113,95,108,54,91,202,229,141,92,236,76,210,190,167,113,16,4,125,21,103,48,141,5,69,22,96,14,92,215,133,235,121,112,92,23,
+161,202,55,108,252,48,70,113,226,164,148,144,202,157,142,42,64,178,76,235,66,127,80,57,69,107,55,41,99,52,155,77,120,158,135,110,55,239,234,24,163,86,175,99,114,106,6,35,35,163,152,61,184,31,76,237,2,41,
+44,1,72,169,62,103,138,44,33,173,191,57,223,90,173,17,76,205,108,196,194,252,44,0,160,94,111,96,122,195,6,44,46,204,27,249,138,100,207,149,231,1,160,98,195,101,173,243,8,178,222,219,178,109,59,166,103,
+54,225,107,95,249,31,92,127,211,205,248,217,159,249,105,216,158,141,91,110,185,23,17,0,48,137,243,46,188,4,59,119,60,80,186,233,4,99,28,150,37,80,111,52,19,235,178,34,18,150,109,227,201,79,121,22,78,221,
+182,29,141,134,15,174,2,209,191,250,151,222,136,47,124,254,211,73,91,166,103,54,160,223,239,35,142,87,126,71,36,25,172,238,153,113,168,220,252,163,239,99,215,195,59,50,238,213,71,10,41,165,138,85,86,81,
+81,81,177,54,42,23,194,138,138,35,204,161,42,175,46,186,244,241,152,156,154,198,190,61,187,243,167,42,114,156,126,230,217,248,196,71,62,142,91,239,190,111,248,66,142,81,188,148,245,124,1,60,255,113,151,
+224,241,87,62,21,247,221,123,231,42,119,254,122,180,72,21,5,81,20,226,43,95,250,28,238,184,237,230,124,166,138,138,71,129,114,37,214,145,129,22,252,233,223,69,132,176,18,197,136,118,91,51,119,191,203,187,
+19,189,230,181,111,196,219,126,239,143,112,223,142,135,240,224,253,247,36,110,71,43,65,238,101,229,117,48,209,139,247,189,123,118,34,102,163,184,224,236,51,113,203,109,247,225,255,254,221,123,241,177,143,
+254,19,246,236,121,24,179,7,15,230,47,91,55,214,171,111,24,0,198,57,194,128,148,65,97,184,218,239,70,221,103,84,15,146,7,16,70,33,100,44,193,57,135,109,59,240,253,26,162,48,28,24,63,45,239,170,103,82,118,
+142,115,150,196,91,98,140,67,88,22,38,38,38,193,4,71,183,211,65,92,112,79,36,108,199,134,16,34,217,89,47,239,50,23,134,161,218,61,146,220,231,210,178,82,197,147,110,163,9,231,28,158,235,65,106,151,202,
+56,85,212,228,221,14,105,92,105,121,229,199,154,132,235,185,228,230,167,118,2,212,199,1,32,12,2,114,197,100,12,237,229,37,72,73,50,118,93,55,243,62,195,18,69,150,190,87,118,110,213,235,13,128,233,93,254,
+0,203,182,104,55,191,40,64,183,211,5,99,164,140,180,29,23,203,75,43,253,136,34,33,44,11,200,185,142,154,72,25,195,117,156,1,129,210,73,201,23,71,49,14,30,216,167,118,217,100,120,112,215,2,26,110,11,253,
+32,196,179,175,121,6,184,211,192,77,63,250,62,246,236,217,5,150,236,80,168,131,235,219,136,162,144,198,155,101,147,203,106,225,62,212,79,97,16,224,150,155,175,199,127,127,233,75,56,255,220,203,176,117,
+219,12,94,255,155,111,195,223,255,237,59,193,24,35,229,35,24,92,215,69,127,149,177,10,233,154,226,253,214,139,110,183,131,110,167,83,120,190,85,84,84,84,28,141,232,111,205,42,85,169,74,71,81,186,226,202,
+39,203,31,127,217,171,50,110,0,85,42,79,155,183,110,147,15,221,191,75,118,22,151,229,115,127,236,165,242,113,151,92,33,175,184,242,201,133,124,235,157,78,58,249,52,249,199,239,120,143,252,169,159,249,37,
+233,215,106,133,243,71,123,50,221,42,170,116,108,38,237,230,147,63,126,172,165,188,171,207,145,74,249,251,30,74,210,229,108,216,180,89,190,225,55,223,38,23,14,46,36,174,66,175,250,249,215,39,174,89,249,
+235,14,37,233,122,155,223,3,151,92,126,165,188,238,186,47,202,231,189,240,101,133,252,235,157,242,242,123,228,19,185,233,229,235,130,156,187,160,101,219,210,117,221,130,187,159,118,1,28,214,30,206,83,183,
+190,178,164,221,201,26,141,166,220,178,117,123,161,44,237,202,199,180,139,90,179,149,184,70,233,60,249,107,242,50,46,251,108,219,78,169,139,32,165,225,110,116,229,215,164,231,132,114,229,52,243,113,206,
+165,231,251,25,247,185,122,189,46,55,108,220,148,228,211,46,124,166,59,159,254,219,76,0,100,189,209,144,158,231,73,40,151,198,205,91,182,201,90,189,46,161,250,206,188,79,190,158,135,154,202,202,2,32,199,
+198,39,228,150,109,39,37,242,156,156,154,146,51,27,168,93,155,183,110,151,123,30,222,39,227,56,146,191,251,214,191,144,205,86,75,58,174,155,200,71,215,223,245,188,76,153,230,88,211,249,244,253,205,49,247,
+187,111,253,191,242,101,63,253,11,201,103,33,68,233,51,194,118,200,165,214,60,102,38,186,95,214,141,113,45,201,118,28,233,56,78,70,238,102,42,107,75,149,170,84,165,42,29,141,169,178,192,170,56,225,56,235,
+236,115,113,225,197,87,96,239,158,157,202,4,252,232,100,199,131,247,227,206,219,111,73,118,87,58,26,104,52,154,120,249,43,127,9,18,17,246,236,58,122,118,220,88,92,152,199,57,231,61,1,23,95,122,14,94,250,
+19,47,196,249,143,189,20,159,250,207,255,192,238,93,15,231,179,174,27,27,55,111,193,11,95,252,211,248,238,119,254,23,159,186,238,95,87,237,186,114,180,96,186,180,84,28,187,212,234,117,68,81,152,177,16,
+58,54,145,16,194,12,108,157,63,191,94,28,126,193,100,177,34,113,217,21,87,227,221,127,249,78,52,199,26,201,57,223,30,193,71,63,246,207,171,114,9,90,13,218,58,70,202,212,138,102,231,142,7,241,131,31,126,
+7,55,255,232,122,4,65,63,177,230,88,143,182,153,172,151,235,224,225,194,24,131,16,86,166,125,89,107,41,9,168,13,0,242,86,84,174,235,130,169,29,225,132,16,112,93,47,247,157,74,238,94,150,176,212,230,1,102,
+128,116,250,91,170,157,255,194,48,192,194,194,130,58,151,62,63,61,207,7,148,101,43,99,28,189,94,87,237,160,103,202,143,234,174,235,39,4,79,250,173,248,12,166,188,113,28,37,247,46,146,51,207,202,160,229,
+84,102,217,152,214,67,91,125,153,121,44,97,169,103,9,141,39,219,118,96,59,142,218,217,146,44,177,56,23,106,23,65,192,178,237,140,249,23,185,75,210,28,238,247,122,170,79,56,24,163,221,219,72,46,122,76,83,
+121,218,218,177,88,215,181,147,47,67,202,24,150,101,227,226,203,30,143,131,7,246,99,121,105,9,140,49,180,151,151,177,188,188,4,46,4,22,230,102,113,227,173,119,224,161,29,243,120,231,219,127,59,201,3,195,
+2,75,21,166,230,53,245,73,222,101,19,153,239,85,234,99,128,225,135,63,248,38,126,240,189,111,2,202,146,139,172,58,117,254,212,189,210,117,93,72,25,151,62,203,25,35,11,56,178,90,60,180,121,238,251,62,182,
+110,63,25,81,16,160,219,45,11,56,45,97,89,2,66,88,235,246,252,170,168,168,168,56,18,172,255,27,79,69,197,81,206,204,134,77,56,227,172,199,98,203,214,83,240,220,103,62,31,223,249,193,119,176,123,247,195,
+184,231,158,219,240,253,111,127,35,159,189,194,224,237,127,250,247,120,211,27,95,141,217,125,243,184,244,202,43,112,207,93,119,228,179,60,42,120,158,135,79,125,242,203,120,250,53,151,226,166,27,239,198,
+203,126,250,37,184,245,166,27,242,217,214,149,70,163,137,122,163,129,61,187,119,229,79,157,48,52,155,45,0,192,226,226,66,254,84,69,197,170,209,139,62,223,247,209,87,219,215,7,253,254,128,133,251,250,80,
+84,26,0,182,227,224,204,179,30,139,29,15,222,143,185,57,138,209,83,6,45,94,99,52,91,45,156,114,234,25,120,223,123,63,128,139,46,121,12,246,239,62,136,151,190,242,103,240,229,47,124,14,147,83,83,216,191,
+111,95,233,125,86,194,84,142,152,50,96,140,22,198,204,112,203,162,197,175,94,180,211,142,117,113,28,29,178,235,58,140,251,63,250,144,43,156,109,219,104,52,91,104,47,47,169,31,157,178,202,43,173,108,96,
+37,187,19,50,21,191,41,142,37,56,103,224,66,168,29,13,211,60,156,107,101,5,29,108,52,26,104,142,140,96,113,97,30,167,157,113,54,118,61,252,32,118,239,218,153,200,69,247,131,102,116,108,20,221,110,23,157,
+118,27,140,145,107,90,164,220,14,117,249,163,99,227,232,118,59,88,94,162,216,123,158,231,131,49,218,197,106,80,127,231,199,206,160,126,25,118,29,99,28,194,18,104,54,91,152,155,165,49,205,24,197,158,234,
+116,218,153,24,100,90,247,35,44,11,113,20,129,11,129,56,162,177,196,133,0,231,28,142,82,104,205,171,249,225,251,53,132,81,136,48,8,193,57,195,200,232,24,22,23,23,16,244,251,202,141,146,198,33,41,170,72,
+22,122,254,104,215,220,233,13,27,17,4,125,204,30,56,48,176,141,135,131,174,215,242,242,18,60,215,195,194,194,130,170,7,53,88,88,22,194,32,72,234,42,132,0,18,229,149,222,37,146,39,227,17,185,190,200,203,
+59,253,155,198,158,89,110,118,124,146,2,47,142,101,82,134,150,205,145,130,148,83,241,192,123,88,150,5,97,89,232,149,42,184,42,42,42,42,142,14,42,11,172,67,128,115,142,83,78,59,3,221,110,231,152,179,186,
+168,0,150,151,22,241,224,253,247,98,126,254,32,150,58,29,180,219,203,248,209,13,223,197,131,247,221,51,224,87,169,138,102,179,133,87,189,230,245,248,173,215,253,60,190,252,149,31,96,203,166,41,92,249,132,
+167,225,161,93,59,113,239,61,119,230,179,63,242,48,134,137,153,45,248,230,183,111,192,235,94,247,106,220,127,239,221,249,28,235,78,191,223,79,22,35,39,42,205,86,11,150,109,163,221,94,41,126,73,197,241,
+132,94,204,173,21,198,200,194,74,91,48,232,50,82,107,135,8,113,68,22,8,121,75,138,245,199,92,136,210,223,79,191,246,121,248,171,63,255,107,124,255,134,31,98,199,131,247,231,242,167,104,171,137,94,175,139,
+61,187,119,226,214,59,239,192,255,126,253,251,120,235,219,222,130,31,124,239,91,16,130,35,138,35,68,202,130,102,173,152,10,25,19,206,25,234,141,6,250,61,82,242,153,202,43,41,99,212,106,53,248,53,31,113,
+28,175,57,30,159,121,175,252,125,215,142,94,232,175,205,170,134,178,202,164,77,26,203,178,80,171,213,17,4,1,130,128,172,164,160,20,2,169,178,136,193,243,124,68,81,84,176,222,211,159,165,204,89,212,40,36,
+25,112,169,191,99,108,222,186,21,141,70,11,245,70,19,79,191,230,5,120,120,231,131,216,191,119,143,146,57,48,58,54,142,48,12,148,37,151,164,184,84,177,68,16,80,80,239,122,189,129,70,179,133,94,183,3,41,
+99,184,174,135,177,241,9,244,187,93,72,21,23,51,12,67,82,12,113,82,120,104,235,195,172,242,77,199,194,50,3,152,103,225,156,2,187,83,12,37,157,71,194,113,93,8,203,66,20,134,20,187,107,114,26,221,206,50,
+194,144,98,56,141,142,79,168,216,91,116,157,176,72,185,18,199,49,44,33,96,219,14,38,166,166,33,227,24,129,138,137,53,54,49,1,64,98,121,105,17,156,83,125,131,160,15,105,88,93,77,78,205,160,219,166,251,72,
+41,49,179,97,19,234,245,58,150,213,70,33,174,235,98,106,102,3,22,230,231,19,37,202,228,212,12,186,157,14,205,25,21,28,127,61,137,227,24,157,78,27,130,11,212,27,13,196,113,132,126,159,230,144,148,18,190,
+231,35,12,201,138,213,178,108,212,234,117,21,220,94,43,163,180,53,94,218,57,181,90,141,158,87,133,241,84,54,230,211,254,51,199,25,231,28,181,90,61,87,206,218,159,23,107,129,100,62,248,30,135,242,236,168,
+168,168,168,120,164,97,67,159,100,21,5,28,199,193,83,175,121,46,186,189,14,190,249,181,47,85,191,82,84,156,16,156,127,225,37,248,233,87,254,18,62,252,225,247,225,142,91,111,194,217,231,94,128,95,127,221,
+239,224,203,95,255,10,222,251,55,111,207,103,127,212,201,191,108,86,164,28,233,95,120,43,78,12,44,203,42,221,165,107,16,122,49,104,90,139,152,86,7,143,52,121,139,135,199,93,114,5,206,61,255,18,220,113,
+219,143,112,203,77,215,99,113,129,172,10,181,53,70,153,69,83,190,29,233,177,212,82,227,80,24,38,15,199,117,212,238,123,36,199,236,189,73,161,181,154,249,93,236,15,170,175,182,18,25,20,160,124,53,88,182,
+133,122,189,129,110,167,147,83,4,12,70,202,24,182,227,64,112,142,94,79,187,246,231,235,80,84,232,65,89,78,49,166,173,124,14,175,238,82,198,112,92,23,167,157,126,22,206,57,239,98,220,121,199,77,184,241,
+250,239,101,44,111,44,155,44,148,6,221,199,243,60,8,75,160,211,110,103,172,107,132,16,104,141,140,66,8,129,253,251,246,2,133,190,150,153,254,43,158,67,169,12,132,101,33,232,167,63,166,74,25,163,209,108,
+2,18,88,90,90,132,16,2,190,95,67,183,219,45,40,136,164,178,232,75,21,44,186,157,100,41,5,6,10,232,110,160,229,93,6,41,159,211,177,213,26,25,133,227,58,216,191,119,47,152,178,78,227,66,168,31,127,245,61,
+169,252,241,137,9,56,142,155,177,118,59,92,132,160,224,251,122,206,0,64,189,94,7,64,46,141,218,2,77,143,37,168,182,211,124,207,214,207,60,47,132,40,125,254,149,245,153,237,56,0,80,232,35,77,126,30,87,84,
+84,84,84,12,167,82,96,173,145,122,189,142,167,93,251,2,124,247,219,95,197,174,135,119,228,79,87,84,28,151,152,47,88,51,27,54,226,140,179,206,193,252,252,44,126,244,195,239,231,179,86,84,84,84,12,101,189,
+22,167,135,194,160,133,227,111,189,249,29,232,247,123,120,215,159,255,126,225,220,32,204,133,58,0,112,33,212,206,112,195,175,91,13,121,25,13,42,211,172,103,190,62,121,132,160,216,69,208,138,26,199,193,
+134,77,91,112,112,255,62,44,45,45,130,49,134,70,179,133,48,232,103,92,219,214,10,41,106,70,208,105,183,209,233,144,91,157,70,43,154,244,226,63,127,14,74,169,146,133,20,59,43,177,146,18,75,230,92,237,202,
+208,178,219,118,210,41,168,213,235,184,253,150,155,50,231,181,188,203,20,21,100,105,83,238,222,169,203,245,60,15,174,231,39,22,72,101,245,241,124,15,156,113,180,219,109,117,164,92,121,165,41,43,71,31,99,
+202,221,49,159,39,25,179,202,2,204,36,111,37,4,213,22,211,50,178,216,71,36,127,82,128,153,10,178,236,216,212,245,49,235,165,241,253,26,198,38,38,177,115,199,131,133,246,148,51,124,92,72,25,195,245,60,184,
+174,139,133,249,121,192,168,71,173,94,35,139,190,190,142,33,71,117,79,21,207,197,54,172,134,252,28,100,74,225,9,41,17,134,209,154,202,170,120,116,209,115,189,162,162,226,232,163,82,96,85,84,60,138,76,76,
+78,97,105,105,241,152,178,228,115,92,23,182,109,159,240,238,115,21,21,43,241,72,188,0,187,158,135,56,142,17,28,197,27,82,12,131,49,218,74,30,128,97,121,179,254,112,78,113,144,204,254,48,251,103,235,246,
+147,193,24,195,67,15,220,151,44,94,135,245,157,182,64,203,47,180,7,93,99,89,22,98,41,149,171,215,202,12,42,151,49,14,198,89,162,40,51,173,174,202,20,20,26,58,167,149,87,228,194,201,57,185,221,117,187,29,
+67,225,83,92,192,175,5,41,227,76,236,35,141,150,245,200,232,24,194,32,72,226,240,116,187,221,66,91,243,228,219,54,140,90,189,134,48,8,208,55,172,93,52,182,99,3,57,75,24,147,188,204,202,48,199,140,150,169,
+204,4,35,71,105,127,96,72,249,58,159,62,223,104,54,33,132,192,252,220,92,146,71,199,144,34,134,43,110,86,130,49,82,182,218,182,141,32,8,18,151,177,180,29,105,93,76,5,86,62,158,85,30,169,20,94,230,185,50,
+89,193,40,163,76,38,121,185,13,162,76,198,101,232,124,230,189,204,122,14,43,167,172,126,101,164,243,139,150,85,166,5,102,113,204,172,190,220,67,69,43,171,143,244,125,142,119,242,227,166,162,162,226,232,
+160,138,129,85,81,241,40,18,199,49,194,32,56,44,119,147,71,154,40,138,142,217,197,242,35,129,16,2,155,183,110,199,210,226,194,97,245,107,250,66,92,113,172,66,202,5,137,171,159,114,45,158,120,245,53,184,
+251,174,91,17,172,115,220,68,215,113,17,169,221,215,104,209,114,244,191,108,51,67,121,18,199,49,192,152,218,5,174,232,146,179,94,148,47,150,211,249,181,48,63,135,249,185,89,229,66,87,150,151,176,44,27,
+96,12,156,83,80,235,116,87,178,225,174,123,150,109,131,171,184,65,171,233,35,109,233,146,66,117,101,12,224,134,53,140,101,217,144,106,225,76,11,113,125,93,254,217,81,252,44,165,142,219,68,202,11,106,7,
+207,40,71,56,103,112,28,7,177,140,139,69,24,144,171,150,128,239,249,106,140,211,216,39,139,35,47,217,149,79,143,81,41,37,162,56,70,172,226,87,13,66,88,2,142,114,193,226,156,198,141,249,92,213,65,193,245,
+92,227,74,209,146,127,246,114,21,128,28,144,201,110,131,121,24,75,119,45,148,146,250,64,8,14,203,182,33,227,52,182,81,179,213,2,3,16,69,49,44,219,70,205,175,41,87,52,234,7,199,177,49,62,49,129,32,232,39,
+113,178,76,225,233,241,239,215,106,36,155,94,143,118,127,179,44,138,165,213,15,208,237,118,0,0,181,90,29,245,70,19,189,94,250,35,151,235,186,153,93,226,24,211,49,180,104,156,15,135,148,84,99,99,227,16,
+150,64,208,239,35,138,34,184,174,75,110,159,221,46,132,224,176,29,7,181,90,29,97,152,62,175,70,70,199,192,57,55,250,55,45,147,49,134,90,189,14,169,226,104,233,241,213,108,141,36,178,2,24,124,223,195,196,
+228,20,218,203,203,0,36,132,16,164,212,140,40,176,126,89,191,228,161,121,38,49,179,97,35,250,65,63,121,254,229,243,212,106,53,216,182,165,234,68,242,178,109,7,190,239,129,115,142,40,162,56,93,142,75,207,
+80,221,79,217,120,100,229,2,117,28,39,163,164,165,251,83,29,164,148,56,237,140,179,240,156,23,188,12,183,221,122,35,162,48,196,200,232,24,197,151,74,92,56,139,229,10,33,224,184,46,98,53,150,56,231,20,243,
+238,16,222,183,38,166,166,17,171,88,107,21,171,231,204,199,156,131,95,123,253,91,112,230,99,206,195,77,55,126,239,168,218,5,188,162,162,34,165,252,39,135,138,227,10,33,4,46,186,244,10,212,27,233,86,223,
+21,71,7,189,110,183,240,75,117,197,177,205,197,151,61,1,95,249,159,175,226,229,175,252,197,252,169,163,2,90,236,29,250,163,223,113,221,195,186,126,24,71,170,220,71,11,173,208,120,217,75,127,22,239,125,
+215,59,241,164,167,60,19,158,239,231,179,29,22,82,198,96,134,11,204,209,142,217,199,174,231,129,169,224,207,81,110,219,118,41,7,239,148,181,22,116,57,171,45,139,148,31,131,243,134,97,0,206,24,106,245,90,
+102,17,58,232,26,198,24,28,165,100,164,221,239,86,215,71,102,121,249,178,77,75,152,214,200,8,44,203,74,206,173,165,173,72,250,99,184,210,32,12,67,200,18,151,60,141,148,49,56,167,88,97,48,172,118,104,1,
+222,132,109,145,229,19,0,44,47,47,33,138,66,82,100,25,59,245,149,33,101,12,75,88,240,124,31,150,37,104,172,148,184,188,1,18,142,227,128,49,138,159,101,238,172,7,85,142,109,235,58,148,183,85,231,105,52,
+91,240,60,63,145,163,16,66,213,159,218,175,143,105,203,12,193,41,198,146,84,202,67,41,41,16,184,237,144,101,164,101,219,112,93,55,145,137,186,27,132,16,168,215,27,137,226,69,143,11,97,9,48,150,206,19,97,
+89,137,2,15,0,108,219,130,235,121,24,25,29,85,247,212,199,29,114,97,53,250,222,140,235,148,66,10,190,229,165,37,116,150,151,213,238,129,156,44,178,148,12,227,88,194,177,29,212,155,205,204,149,245,70,147,
+148,121,37,99,88,74,218,225,142,230,51,141,251,116,124,218,134,60,45,184,158,175,148,196,18,194,162,120,105,90,118,43,33,101,140,102,179,5,203,34,235,49,12,248,222,96,140,163,223,239,161,223,239,35,86,
+22,135,80,202,191,154,82,212,73,117,124,122,102,35,132,16,16,66,224,252,11,47,134,95,171,37,22,137,101,223,151,140,113,48,206,51,125,234,121,46,132,72,173,117,44,219,193,171,95,241,51,184,252,241,87,99,
+251,201,167,226,137,79,186,6,158,55,252,217,223,26,25,69,163,209,76,202,224,156,195,117,189,228,254,190,239,195,247,107,153,107,244,88,204,51,63,55,155,40,167,143,36,36,159,236,56,43,171,207,177,64,173,
+94,199,63,255,211,71,240,150,55,255,18,222,243,55,127,130,247,253,227,117,24,27,31,207,103,171,168,168,56,10,168,44,176,78,0,24,99,216,184,113,11,30,184,255,94,48,198,112,238,249,143,195,242,210,194,186,
+91,2,84,84,156,232,88,182,141,23,188,232,21,184,250,241,151,225,105,79,190,26,119,222,191,3,119,222,126,75,62,219,138,164,47,128,197,133,194,225,82,171,249,112,28,231,176,94,110,87,99,65,114,40,88,106,
+39,172,227,13,102,9,48,222,196,69,23,94,2,238,120,184,233,198,245,139,29,71,202,5,218,185,239,216,144,93,106,201,210,237,180,33,37,16,71,177,178,244,48,119,240,210,109,33,171,136,252,34,105,37,104,17,120,
+100,228,33,165,68,24,134,171,182,110,208,202,157,50,203,160,65,232,103,192,240,69,61,67,167,211,134,140,99,112,206,176,97,211,102,212,106,53,44,47,175,197,189,155,228,107,126,54,101,173,21,13,195,96,202,
+34,44,142,99,101,105,69,86,82,140,49,244,123,61,244,122,116,76,231,245,60,82,130,175,100,89,194,24,67,24,6,164,132,136,99,68,81,156,236,154,167,161,250,129,172,208,164,28,96,129,68,214,64,84,199,226,46,
+133,80,247,226,130,163,219,233,36,22,70,186,93,212,207,105,253,187,157,54,162,136,20,86,81,20,169,64,245,169,213,86,16,4,137,5,238,232,232,40,32,41,96,56,93,79,174,134,82,146,50,175,223,35,203,52,169,119,
+72,84,114,211,101,245,122,221,164,63,165,148,96,156,147,66,40,150,70,153,44,217,69,207,236,187,180,28,74,230,241,32,232,35,12,67,88,150,5,219,118,16,244,251,73,59,244,249,197,133,133,164,60,198,24,230,
+231,102,209,235,149,185,124,82,158,94,226,138,170,5,204,176,48,63,167,92,109,169,220,126,191,135,249,185,217,228,115,28,197,88,88,152,203,88,184,13,135,148,149,97,24,96,121,121,169,52,214,153,134,228,44,
+65,67,131,230,81,191,223,87,214,95,73,46,44,47,45,98,203,182,237,216,126,242,105,232,117,187,216,187,103,119,201,152,207,206,17,173,140,38,89,144,34,46,86,243,155,49,142,249,217,131,120,224,225,29,56,233,
+148,51,241,202,87,252,2,62,246,209,15,96,239,158,93,0,0,219,182,225,121,110,225,29,60,232,247,51,115,55,142,99,116,218,109,37,23,169,92,173,105,124,165,148,43,254,116,93,70,70,70,17,75,178,116,132,10,40,
+111,91,214,186,253,112,202,84,220,179,201,169,105,92,245,148,103,96,246,224,190,100,87,226,43,174,124,18,226,40,194,226,34,109,136,113,180,115,233,21,87,225,183,127,243,215,192,5,141,239,243,206,59,29,
+91,182,156,139,255,252,244,199,143,216,59,79,69,69,197,161,145,255,22,170,56,14,137,227,24,63,248,222,183,240,162,151,188,18,31,248,224,167,240,183,239,250,255,224,184,94,62,91,69,69,41,131,126,225,171,
+40,114,213,147,174,193,43,95,250,82,188,254,255,252,54,222,241,174,119,227,247,255,207,91,112,237,179,95,152,207,182,34,150,109,81,224,215,35,64,167,211,53,130,3,175,157,245,122,241,45,67,111,189,126,188,
+241,159,159,248,8,94,255,250,87,225,7,55,94,143,139,30,119,57,166,166,103,242,89,14,139,99,77,102,218,26,35,255,119,217,103,243,248,145,198,180,100,210,150,5,101,207,62,169,20,88,171,133,92,201,214,86,
+255,65,114,40,162,221,9,57,126,229,215,126,23,31,250,192,117,120,204,57,231,229,51,61,98,48,198,147,197,158,148,18,177,82,34,208,194,158,22,188,189,94,15,203,25,37,66,22,221,118,169,98,19,145,226,41,85,
+138,228,97,140,22,236,131,148,25,84,134,68,20,69,165,253,160,245,38,65,159,148,58,131,202,209,228,199,132,86,64,153,36,253,55,192,101,84,247,109,190,44,153,184,224,17,52,14,121,210,238,48,8,176,184,48,
+143,133,133,121,117,223,108,126,83,118,102,59,24,99,240,60,47,177,202,210,229,198,113,148,88,120,233,126,162,148,182,75,43,215,210,186,148,147,158,99,73,125,243,249,205,50,6,201,96,16,82,198,56,249,212,
+211,225,122,94,105,252,185,213,80,214,134,40,138,112,202,105,103,225,202,171,158,129,251,239,189,43,227,54,185,210,60,212,231,76,107,122,198,104,206,223,116,227,247,225,185,62,206,60,141,226,235,209,57,
+82,54,106,229,163,201,160,239,86,125,143,229,229,229,68,57,148,63,151,71,183,179,215,235,101,226,238,113,229,254,188,30,232,241,55,54,62,142,255,248,248,231,240,95,159,254,56,62,253,137,47,224,23,127,237,
+183,241,236,231,255,4,162,40,198,252,252,108,254,178,163,150,157,15,63,128,32,200,62,215,151,219,237,129,50,174,168,168,120,244,168,44,176,78,16,132,16,120,205,107,222,128,159,127,245,139,240,218,95,249,
+85,220,252,163,235,243,89,42,42,74,177,109,135,22,8,37,47,225,21,89,78,58,229,116,48,81,195,191,127,236,159,240,191,95,254,60,238,121,224,1,244,250,61,60,112,223,221,249,172,67,177,44,43,177,170,89,127,
+204,95,200,87,134,94,246,87,159,191,162,156,110,167,131,219,111,191,17,177,140,176,107,231,67,88,90,90,204,156,231,66,128,113,142,201,169,105,216,182,115,76,109,236,112,164,161,197,88,81,113,49,12,109,
+181,176,22,116,12,34,61,71,168,140,181,151,147,71,199,213,58,220,114,138,164,115,153,49,134,107,158,241,2,252,228,75,158,137,239,92,127,11,110,189,233,135,137,98,83,8,145,180,131,49,158,184,227,233,120,
+84,92,8,120,158,167,148,76,107,147,115,22,9,33,44,112,21,208,92,91,217,232,50,181,146,199,84,184,22,111,71,49,137,108,219,6,23,66,197,55,42,42,42,72,185,69,238,106,122,238,232,246,24,185,18,69,202,32,60,
+207,133,235,122,228,26,170,220,194,76,75,38,125,31,130,234,45,165,204,184,231,101,243,16,122,252,9,65,177,210,194,48,128,237,56,144,113,12,128,98,107,217,142,83,136,223,84,246,119,218,86,6,203,38,55,61,
+58,46,225,215,106,16,156,92,7,245,24,163,216,79,78,81,201,106,124,143,155,242,99,140,43,235,192,212,237,144,49,202,195,57,75,226,142,173,52,62,6,201,202,188,134,148,1,233,216,192,64,87,199,34,76,41,225,
+58,237,118,193,122,41,157,91,105,44,184,180,62,52,238,77,121,230,233,247,186,184,235,206,91,48,55,123,48,83,6,99,212,254,116,76,211,247,161,16,2,150,109,15,216,148,129,161,86,171,225,244,51,207,198,245,
+63,248,22,190,254,205,175,225,193,7,238,73,100,76,125,181,186,103,129,101,81,127,175,54,127,10,201,56,12,179,49,86,163,40,202,40,232,14,15,137,70,179,137,247,255,227,117,120,198,181,87,0,0,182,110,155,
+193,179,175,125,10,54,77,159,140,63,249,147,223,61,166,226,165,206,205,30,68,55,174,225,154,167,61,17,0,240,71,239,120,47,126,239,119,126,181,84,217,8,232,239,165,244,251,41,29,211,107,237,171,138,138,
+138,181,82,205,180,19,0,250,149,36,198,197,151,61,1,23,95,242,68,188,247,111,223,145,207,82,81,81,177,78,136,146,29,184,214,138,227,186,8,250,253,67,120,105,93,95,244,203,186,89,15,189,192,59,18,216,14,
+185,178,28,111,232,5,184,94,56,89,150,133,90,189,129,246,242,18,194,48,132,237,56,184,240,162,203,193,24,5,19,15,130,62,118,237,220,145,236,244,105,89,20,136,248,112,199,213,177,74,153,2,99,53,148,45,84,
+87,195,161,45,24,203,97,140,195,113,29,132,106,193,189,30,125,168,231,165,239,251,176,29,39,217,173,238,164,83,78,197,217,143,189,16,150,109,227,224,193,125,248,250,87,190,144,191,20,150,101,129,11,129,
+160,31,208,206,136,113,4,206,5,60,223,67,183,219,133,99,219,232,7,1,130,126,191,84,238,180,96,163,29,29,77,164,140,225,249,62,106,181,58,250,189,30,150,151,151,18,133,129,16,22,192,128,48,103,221,48,8,
+215,117,224,215,106,8,195,8,139,202,210,72,195,24,185,96,57,174,155,184,130,209,51,55,6,83,138,134,160,31,144,98,203,216,25,176,108,151,69,97,9,56,182,131,56,142,208,235,245,193,57,5,34,143,227,24,203,
+75,75,96,140,195,83,1,191,59,109,114,119,181,29,27,158,231,99,121,105,49,81,143,9,203,82,155,177,80,249,58,54,146,238,107,223,175,65,74,137,122,163,142,249,249,121,132,65,128,70,163,137,102,107,4,75,75,
+11,88,94,90,42,92,43,149,101,85,189,209,128,109,217,88,90,90,68,20,197,168,213,107,144,177,76,130,188,55,154,45,112,206,16,133,169,171,214,196,212,20,130,94,31,139,139,166,146,156,106,171,251,207,182,237,
+140,11,167,239,83,64,249,131,7,246,131,49,138,93,101,219,54,14,236,223,79,231,107,62,38,167,102,112,96,255,222,68,54,121,26,205,38,250,189,46,2,37,11,97,9,140,143,79,96,110,246,96,114,175,241,137,73,4,
+253,62,22,23,23,146,119,211,153,13,27,209,235,245,50,187,46,154,112,181,131,40,140,57,109,222,95,202,152,126,104,227,164,148,13,195,16,65,191,15,71,237,110,10,0,125,165,132,24,25,29,69,28,75,44,46,204,
+3,106,62,120,158,159,252,160,32,132,128,235,186,232,7,65,50,103,27,141,38,122,253,94,102,252,10,75,0,37,150,152,186,77,91,182,109,199,11,94,248,211,248,167,247,253,101,242,28,223,188,101,27,14,30,220,143,
+206,26,44,160,167,55,108,68,103,121,121,205,110,120,90,89,154,175,159,9,205,207,212,5,81,168,157,41,245,53,171,113,121,254,245,55,253,33,254,252,237,111,206,28,219,187,235,0,174,125,238,115,112,195,245,
+223,205,28,63,154,209,253,230,215,106,120,206,243,95,138,217,131,251,240,133,255,247,159,249,108,9,101,227,223,228,80,191,123,42,42,42,86,71,101,129,117,66,64,191,26,237,220,241,32,190,255,221,175,231,
+79,86,28,231,56,174,139,173,219,79,194,220,236,177,99,202,125,44,179,210,11,223,106,88,143,69,238,225,146,42,93,36,54,111,221,134,215,188,246,141,56,253,172,115,112,195,245,223,201,103,93,55,82,235,151,
+99,27,178,184,49,219,97,90,28,144,66,144,118,248,10,105,145,16,75,108,220,180,25,151,92,122,21,118,237,122,16,15,239,120,0,158,231,39,11,116,223,247,33,143,146,113,113,40,48,227,23,106,33,184,90,246,151,
+247,179,153,55,149,217,218,160,197,67,121,249,80,11,55,173,4,202,163,119,156,43,59,183,18,229,229,74,196,106,183,58,219,182,213,110,103,135,102,89,161,173,121,200,138,67,194,247,107,152,156,154,193,252,
+220,44,160,226,97,221,115,215,109,136,227,8,179,7,247,97,126,110,62,35,71,203,34,171,145,48,8,200,242,138,51,52,91,45,112,206,177,188,180,140,56,142,141,69,235,96,185,151,85,153,49,6,25,199,8,148,242,203,
+132,92,0,245,216,29,92,174,38,12,169,126,113,84,116,231,35,5,22,185,188,153,10,34,0,8,130,0,12,58,254,22,40,94,148,16,32,55,62,237,222,69,247,183,109,27,158,239,163,219,233,34,8,250,96,202,213,207,177,
+29,8,46,208,239,7,144,106,39,59,33,4,122,221,30,164,36,107,53,199,182,17,132,97,34,8,198,104,251,63,186,175,57,102,233,239,32,232,163,57,50,66,174,99,42,120,120,20,69,96,156,98,84,165,202,47,130,250,87,
+187,236,41,165,76,20,209,88,146,18,204,136,67,216,235,245,16,6,129,138,105,72,247,107,47,47,103,226,142,105,210,177,192,225,56,110,162,168,208,221,45,99,137,40,10,149,197,21,89,0,107,107,29,41,37,100,28,
+163,223,235,21,250,68,195,57,67,24,166,74,15,166,158,233,122,135,65,64,210,28,136,34,101,65,69,239,166,189,126,15,145,234,243,50,104,158,164,127,151,181,43,86,241,195,244,152,144,18,224,140,43,215,82,178,
+122,99,202,34,73,203,155,49,6,48,32,150,49,60,215,69,28,199,16,198,188,212,59,100,70,145,142,119,71,253,171,173,231,180,82,44,95,23,64,98,105,113,17,15,60,112,55,150,23,41,78,23,99,52,63,73,145,87,46,191,
+50,122,93,26,159,156,211,110,152,229,22,95,69,184,146,209,32,153,2,192,232,216,24,4,23,70,60,76,154,39,169,165,216,202,245,20,150,192,73,219,206,198,246,109,27,192,56,195,219,254,248,239,240,115,175,126,
+57,238,185,235,142,124,214,163,26,61,174,130,160,143,91,111,254,33,238,189,231,78,117,60,255,60,79,243,15,67,143,131,138,138,138,35,67,53,195,42,42,142,115,28,215,197,95,254,213,7,177,227,225,7,241,103,
+111,255,157,117,52,31,175,56,22,73,21,83,131,95,108,205,60,207,124,238,139,240,247,127,253,55,152,153,25,195,111,188,249,79,240,183,239,250,195,124,246,19,6,189,176,89,9,46,4,100,28,195,117,105,145,168,
+23,138,230,175,182,121,249,251,190,143,241,137,41,101,13,210,197,193,3,7,50,231,143,54,86,178,10,203,143,51,253,153,115,10,124,61,8,83,70,43,163,251,34,187,152,200,203,22,74,249,19,199,18,82,237,34,167,
+255,206,195,212,47,241,26,91,89,232,12,171,179,38,223,102,147,212,53,173,216,190,178,252,101,112,78,10,141,124,93,210,50,201,130,71,159,207,215,135,49,158,88,179,232,99,228,94,104,90,40,29,46,74,27,114,
+152,228,199,77,22,82,22,105,107,37,29,64,187,172,13,230,58,83,43,81,160,100,201,133,40,88,133,233,251,106,69,161,58,170,218,68,138,136,56,166,49,36,117,144,112,69,162,72,41,169,55,229,39,5,97,30,189,24,
+214,215,215,235,13,52,154,77,236,223,183,215,232,203,162,210,102,37,69,99,30,206,25,252,90,13,157,118,27,113,76,110,144,186,254,90,105,166,101,90,108,71,218,214,252,115,204,28,103,249,118,231,143,229,199,
+186,57,223,242,215,30,46,195,238,149,103,235,246,147,225,184,46,14,236,219,171,220,8,135,195,24,71,163,217,64,24,4,232,116,200,26,46,63,223,204,188,101,199,215,2,99,28,27,55,109,198,226,226,66,98,61,118,
+184,164,202,240,67,175,151,230,202,39,61,29,147,147,51,248,228,191,255,11,176,130,172,143,102,202,198,96,89,59,204,121,145,159,247,249,103,108,69,69,197,250,147,153,169,35,35,163,152,152,156,50,15,85,172,
+192,196,212,52,108,99,139,227,71,138,107,159,253,66,252,228,43,95,155,63,92,81,81,160,223,235,225,221,239,126,39,254,224,205,175,195,187,223,251,225,252,105,92,122,197,19,49,53,61,157,63,92,113,156,34,
+87,8,74,171,145,50,198,185,231,63,14,31,255,231,15,96,203,246,25,116,218,61,236,223,191,59,159,237,132,98,53,202,43,24,59,64,57,142,11,174,20,4,48,100,95,38,255,78,167,131,135,119,60,136,185,185,217,100,
+17,169,41,123,169,198,144,227,71,18,125,207,97,191,236,231,49,23,51,113,76,241,99,138,11,242,98,112,101,147,50,153,113,21,179,104,144,92,201,202,73,215,55,141,91,68,22,6,197,242,242,139,46,203,34,215,183,
+50,197,72,25,101,117,208,104,121,153,117,29,148,119,16,177,178,144,202,147,150,69,11,39,83,150,249,123,228,23,86,81,164,45,46,214,86,23,77,241,186,212,37,169,28,173,48,25,214,254,114,69,73,10,245,35,45,
+190,41,248,122,28,167,229,153,242,77,229,14,104,37,12,45,56,101,193,82,12,128,178,196,72,149,87,84,142,238,127,83,225,163,21,58,89,37,208,200,232,40,92,215,45,180,45,12,3,68,81,132,70,163,137,209,177,49,
+42,45,55,230,83,5,17,83,27,237,104,197,22,87,127,235,118,83,144,245,84,121,69,125,106,222,147,166,23,149,199,149,107,29,64,110,156,101,227,153,41,151,75,168,118,20,231,162,89,151,108,255,233,191,139,215,
+12,70,183,189,88,103,34,47,191,65,228,219,61,232,152,62,62,8,206,57,26,245,38,230,231,230,10,207,38,19,223,247,177,97,227,102,72,25,99,251,73,167,14,221,16,41,237,223,244,217,179,22,25,153,72,25,99,239,
+158,221,104,175,105,135,209,225,152,115,230,112,249,250,87,254,39,163,188,90,111,24,99,104,141,140,96,211,150,173,249,83,235,138,30,59,102,202,99,182,207,84,94,77,76,78,65,14,80,82,87,84,84,172,47,25,23,
+194,48,12,208,15,250,171,54,81,173,0,174,122,242,53,216,180,101,27,238,191,119,109,65,154,15,135,151,252,212,171,241,137,143,127,8,47,124,193,179,81,107,109,195,189,247,222,142,217,131,7,242,217,42,42,
+18,246,237,217,141,235,111,190,19,127,242,214,223,194,141,183,221,141,59,111,191,37,57,55,53,179,1,237,229,229,66,80,233,138,71,15,253,210,187,94,88,150,189,38,133,3,32,97,89,22,30,119,201,21,184,225,230,
+123,80,247,70,48,62,218,196,61,15,236,198,87,191,252,249,76,78,219,118,74,95,242,214,3,90,200,185,153,23,194,162,123,94,202,225,200,109,80,185,164,32,41,30,135,186,159,101,13,14,208,221,235,245,86,245,
+50,107,219,54,234,13,250,53,63,232,247,11,187,68,210,162,154,92,87,200,122,136,228,205,24,131,239,251,0,178,59,145,13,131,202,161,88,39,233,34,124,245,208,226,142,174,203,95,107,202,159,49,138,49,68,193,
+164,181,213,39,45,228,28,199,73,174,181,29,135,92,125,98,114,215,41,34,1,48,216,142,157,180,83,231,147,106,119,52,168,123,51,21,112,89,91,203,100,235,40,135,186,7,146,123,94,54,8,184,46,223,28,223,150,
+101,37,187,120,233,178,45,203,74,172,128,214,78,26,96,186,222,168,67,198,105,95,174,125,60,147,114,38,127,140,20,19,20,0,220,243,105,193,173,235,170,239,109,219,69,249,174,140,132,235,121,185,49,46,97,
+89,52,182,202,176,212,125,124,191,6,169,234,145,191,159,16,22,229,83,113,160,104,156,123,144,208,110,198,20,139,10,170,15,24,83,215,88,22,162,40,181,168,178,44,27,142,227,32,12,169,126,169,27,86,58,127,
+56,167,185,165,231,176,105,149,194,84,208,112,102,196,253,227,156,220,199,180,18,73,223,155,198,91,140,209,209,49,48,193,209,235,102,221,203,244,188,113,92,23,142,227,162,215,235,38,215,83,61,56,44,203,
+130,227,184,104,183,151,177,48,175,227,65,209,120,213,50,162,58,249,106,92,146,44,116,187,24,104,204,230,169,213,235,112,61,23,189,94,143,220,44,25,205,39,105,244,53,231,20,8,95,203,83,215,203,236,26,82,
+8,107,5,23,181,39,11,125,111,232,60,82,198,176,29,71,201,151,242,214,235,117,180,70,70,212,110,122,18,245,122,3,174,71,177,170,210,185,71,99,168,88,126,25,148,71,8,26,199,171,125,14,230,89,152,159,199,
+254,125,123,96,217,22,92,199,41,9,18,79,140,140,142,225,57,207,127,41,92,215,193,131,15,220,131,185,217,57,213,63,218,242,38,189,127,42,91,14,199,113,140,113,84,222,46,215,165,31,60,204,231,136,237,56,
+128,122,142,153,125,254,104,65,113,243,86,146,49,141,217,245,100,106,122,6,103,157,125,30,218,75,75,202,101,250,209,35,157,139,52,102,199,198,39,240,103,127,241,143,120,247,187,254,47,156,198,12,30,124,
+240,110,204,205,30,60,132,231,119,69,69,197,106,201,168,201,163,40,42,253,69,170,98,48,223,253,214,255,226,222,187,31,57,95,239,95,248,229,55,225,195,31,250,251,228,243,111,190,225,85,184,233,7,215,227,
+53,191,248,155,153,124,21,135,198,204,198,77,56,237,140,179,242,135,31,21,206,62,247,124,140,141,79,228,15,31,50,159,253,212,199,240,172,31,251,113,252,243,63,252,61,46,189,226,170,228,248,13,63,248,46,
+118,239,122,56,147,183,226,200,160,23,139,208,1,83,215,104,189,233,121,62,78,58,229,180,252,225,21,105,182,90,107,186,23,83,219,99,255,215,167,255,29,127,245,23,111,197,139,127,226,89,248,218,183,126,4,
+215,73,131,226,82,62,134,205,91,183,193,53,130,229,174,39,82,202,66,156,145,50,235,1,0,216,184,105,11,102,54,108,204,31,94,53,182,109,39,125,163,25,27,159,192,150,109,39,101,142,229,241,124,31,205,102,
+51,127,120,141,48,52,91,35,67,183,55,151,50,134,227,56,24,159,152,76,126,1,150,50,134,165,2,194,175,246,87,111,97,89,104,52,154,24,159,152,60,164,197,208,32,101,37,99,28,27,55,111,73,2,39,75,73,46,148,
+35,202,218,68,231,137,227,56,81,40,72,41,225,123,62,108,219,74,174,49,145,50,70,163,217,130,231,121,240,92,47,99,205,166,33,37,162,5,33,200,154,67,47,36,233,250,108,251,104,99,132,242,250,71,37,187,115,
+13,250,5,190,209,108,194,243,82,203,11,203,182,209,106,141,100,242,152,8,33,48,53,61,147,196,110,42,67,202,24,51,27,54,193,247,253,100,28,214,27,117,52,155,173,124,214,2,230,184,53,235,76,227,195,198,248,
+196,36,38,167,166,84,27,67,120,158,7,215,243,148,34,38,134,16,28,163,99,163,240,60,31,181,122,189,180,205,38,230,121,173,12,210,212,235,13,184,110,121,59,165,140,97,91,54,92,215,35,23,84,53,151,185,218,
+233,78,231,113,28,155,158,89,54,41,169,24,3,234,141,6,28,165,44,103,12,24,29,29,83,59,39,166,138,38,79,197,194,162,50,57,38,38,39,225,122,126,34,147,122,189,129,209,209,177,140,124,28,165,52,0,104,71,191,
+70,179,153,88,43,73,21,152,222,247,211,50,60,223,199,228,212,180,122,70,198,176,109,27,211,51,27,32,44,26,195,251,246,238,65,191,219,131,239,251,137,219,160,134,49,142,165,197,197,36,48,186,86,18,65,141,
+63,33,44,140,140,141,37,247,135,82,24,232,24,95,36,27,23,205,86,43,81,44,73,25,99,116,108,28,205,86,171,228,217,200,0,48,196,81,140,122,189,73,22,133,106,60,234,58,147,69,30,104,76,56,110,162,0,115,93,
+15,141,70,19,245,122,35,105,251,196,228,36,154,173,145,228,115,107,100,20,227,147,147,201,221,70,70,71,49,57,53,165,20,97,228,142,56,179,97,99,210,79,82,198,168,55,155,120,242,211,158,131,11,30,119,41,
+154,173,22,46,185,226,137,120,245,47,188,17,103,159,123,65,162,44,174,213,235,216,178,109,123,82,238,74,172,246,217,7,144,123,183,73,179,217,66,173,86,131,148,20,240,92,8,129,214,104,250,204,202,179,184,
+48,143,126,208,195,83,158,250,28,112,181,251,35,0,248,190,135,70,238,123,64,159,139,162,8,182,237,36,178,28,68,163,217,194,212,244,76,230,216,228,228,52,106,245,122,230,216,74,140,141,79,168,31,54,214,
+23,198,56,154,173,145,53,201,123,189,8,130,0,97,24,224,225,135,31,204,159,122,212,136,227,24,211,27,54,226,171,95,252,38,126,249,181,47,193,212,198,113,252,209,91,223,128,235,191,243,125,92,246,248,171,
+135,246,117,69,69,197,225,113,66,7,113,127,254,139,126,18,255,246,193,143,226,222,135,30,58,100,37,84,183,211,121,196,126,13,56,251,220,243,241,95,159,254,88,254,48,108,215,198,115,159,253,52,220,247,208,
+65,220,248,195,99,103,215,143,163,141,151,191,242,23,241,137,143,126,20,191,241,134,215,225,11,95,249,58,118,60,116,127,62,203,35,198,150,173,219,241,75,191,252,127,96,187,46,30,184,255,238,117,83,44,223,
+119,207,157,216,124,210,121,232,116,59,184,233,198,239,231,79,87,28,97,244,47,209,167,159,121,54,126,253,141,111,195,121,23,92,2,48,137,125,123,119,39,193,157,117,190,178,95,238,46,189,226,42,188,238,117,
+191,131,251,30,184,27,123,119,239,202,159,30,72,175,219,3,23,20,208,118,117,72,181,248,161,58,180,151,151,241,185,207,127,10,63,188,254,219,5,75,189,197,133,249,129,191,86,31,25,138,114,129,82,64,45,47,
+45,22,148,16,171,37,138,226,76,155,1,250,179,124,203,118,13,197,128,210,65,167,87,67,217,175,178,113,28,97,113,97,97,160,37,151,62,22,134,33,186,221,78,38,95,191,223,67,44,99,32,183,91,228,32,164,164,114,
+150,151,151,86,93,103,49,116,203,120,130,49,134,40,12,16,134,161,178,154,225,136,162,180,190,169,146,69,91,174,208,226,58,12,3,4,65,8,33,56,188,18,107,158,40,12,33,1,68,113,164,238,159,85,214,48,101,37,
+162,219,34,149,213,84,153,156,53,182,237,40,43,145,242,243,101,208,34,156,250,91,39,61,159,163,40,86,22,53,131,202,99,136,98,114,43,45,183,0,35,11,142,185,217,131,153,96,220,145,138,159,54,120,92,16,182,
+237,0,185,246,144,92,72,54,253,94,15,253,160,143,40,164,177,74,223,39,137,41,13,226,56,70,183,219,85,202,12,89,80,132,80,172,36,93,46,89,54,65,89,107,229,45,231,164,148,201,46,116,156,51,165,36,161,190,
+97,140,33,12,67,21,188,60,70,16,132,96,202,250,72,203,146,242,4,8,130,64,61,19,41,175,14,98,30,69,164,192,162,192,229,36,27,198,128,48,76,127,128,101,202,29,142,113,134,118,123,57,145,75,42,83,109,125,
+198,32,65,193,201,181,188,34,181,177,130,238,131,48,12,32,227,88,221,151,100,213,235,118,213,115,134,218,221,239,247,84,156,59,122,126,208,28,160,32,237,169,165,35,201,71,247,137,254,219,36,138,34,180,
+151,169,190,218,157,15,73,207,167,174,143,221,110,39,177,228,225,156,35,12,2,116,59,131,199,159,148,49,98,245,99,128,190,103,191,215,85,242,37,171,200,80,205,93,45,7,82,230,88,224,156,171,128,240,28,221,
+94,23,253,30,5,188,7,24,184,10,252,174,251,81,202,24,157,78,7,145,81,78,187,189,156,217,81,119,121,105,9,123,118,63,140,199,95,249,52,92,251,172,23,65,74,224,135,215,127,19,247,222,125,7,122,189,30,160,
+250,99,105,105,17,177,148,153,97,175,231,187,137,254,44,149,59,233,176,121,66,164,207,120,173,80,143,162,244,153,21,134,33,150,140,29,255,244,115,132,169,31,159,162,40,196,173,55,253,16,223,251,222,215,
+149,187,33,29,15,195,48,153,187,102,29,180,28,250,253,30,122,221,158,82,180,151,215,177,215,237,162,189,220,206,60,151,59,237,101,21,116,190,252,154,50,226,56,70,164,158,195,195,224,156,99,106,122,70,61,
+163,87,83,190,68,183,211,89,133,140,215,159,94,175,139,61,187,119,38,241,36,31,77,244,88,31,159,152,196,135,62,240,31,120,252,149,231,211,9,245,48,242,107,30,126,112,195,29,248,193,119,191,145,191,180,
+162,226,176,24,29,27,83,22,188,197,13,36,78,68,228,137,152,38,166,166,228,39,63,241,101,249,165,47,124,87,94,245,148,103,20,206,31,141,233,148,211,206,144,115,251,231,100,28,71,229,41,10,229,207,188,230,
+117,133,235,170,180,114,122,214,243,126,60,35,203,219,111,190,71,94,116,233,21,133,124,143,84,170,215,27,242,130,199,93,42,47,123,194,213,210,247,107,133,243,135,147,124,223,151,99,227,19,133,227,85,122,
+100,210,200,200,168,252,251,127,248,184,140,227,72,182,23,150,229,252,129,121,249,201,79,124,89,62,230,156,243,10,121,205,228,186,174,60,245,244,51,229,191,255,251,23,228,142,7,118,201,159,122,213,47,75,
+33,172,76,30,33,68,154,223,243,100,173,86,47,148,179,218,196,24,207,164,252,249,163,41,153,237,94,77,98,140,73,206,143,92,155,6,201,139,100,201,10,199,243,201,113,93,105,89,217,190,53,147,16,34,115,158,
+49,46,109,219,25,120,223,195,77,150,101,73,223,247,37,212,189,135,201,78,215,193,28,55,250,111,203,178,10,227,138,49,38,25,227,146,115,46,71,199,198,75,251,146,49,46,133,16,73,222,195,109,167,101,219,133,
+251,8,33,164,237,56,3,219,54,62,49,41,107,181,236,179,120,80,61,86,211,199,58,113,78,114,209,229,13,74,249,235,86,74,101,215,14,42,135,242,165,117,206,223,59,159,28,215,205,200,47,127,47,253,183,101,219,
+210,118,104,92,230,83,254,186,124,202,159,167,207,197,254,79,243,80,253,139,215,100,63,151,29,27,246,185,88,110,254,243,224,107,244,152,210,178,50,207,155,227,158,115,125,140,254,231,188,56,222,211,107,
+210,235,244,255,131,218,165,203,214,247,55,63,155,247,54,143,235,191,117,153,102,185,250,179,190,247,160,243,249,122,148,165,151,189,226,231,229,15,190,123,171,188,234,201,215,72,40,89,153,114,202,151,
+35,132,144,142,235,202,70,163,57,112,236,173,230,190,101,105,80,254,124,153,249,178,245,223,249,227,101,105,80,25,217,60,171,127,110,172,71,98,140,75,223,247,7,214,167,74,195,211,41,167,157,33,247,238,
+220,87,88,139,221,117,219,253,114,195,198,205,133,252,85,170,210,225,166,43,159,244,116,249,148,107,158,45,253,220,187,200,9,154,10,7,78,136,244,196,39,61,93,254,212,207,252,82,225,248,209,158,126,245,
+13,111,41,60,44,205,116,219,205,247,20,94,62,170,180,114,122,195,111,190,77,134,65,32,227,56,146,253,78,87,198,113,36,151,230,22,229,212,244,76,33,111,149,170,116,56,233,220,243,31,39,23,103,23,100,28,
+71,50,138,194,100,238,62,225,170,167,20,242,234,196,24,151,211,51,27,36,0,249,119,239,249,176,140,227,72,134,65,32,207,56,235,108,9,64,218,142,35,175,188,250,105,114,100,116,44,185,102,122,195,70,185,113,
+211,150,66,89,107,73,195,94,182,143,150,196,148,98,36,127,252,72,37,203,178,87,37,147,195,89,140,144,220,7,95,239,121,158,28,159,152,204,44,228,90,35,163,137,146,41,45,195,92,108,177,204,249,67,77,34,167,
+60,51,147,237,56,201,223,186,13,249,133,91,62,153,139,105,243,120,182,28,202,167,243,150,229,49,23,191,166,92,6,37,243,122,250,204,18,5,91,62,47,0,89,171,213,6,182,59,95,30,41,109,6,247,95,254,186,213,
+166,252,181,43,165,181,94,159,207,63,168,255,204,188,249,191,139,229,148,151,49,60,165,138,26,157,242,229,114,206,165,99,40,199,56,231,210,117,221,204,56,202,143,169,124,50,149,54,116,172,168,156,90,107,
+130,161,240,213,239,98,182,227,36,115,67,231,179,44,91,58,185,250,82,34,5,22,29,47,151,29,12,37,82,89,157,57,231,210,243,252,130,66,74,255,189,26,133,86,179,217,146,147,211,51,82,8,43,169,7,221,135,234,
+167,63,155,117,209,247,201,143,9,81,50,111,78,63,235,108,121,205,179,94,32,183,110,63,89,50,99,126,231,219,162,147,237,56,114,100,116,76,218,182,45,185,82,238,149,61,15,244,49,93,142,89,159,178,191,203,
+62,15,170,195,176,52,168,156,178,242,242,231,242,121,242,199,171,116,244,166,211,207,124,140,252,192,135,62,45,163,32,144,157,197,101,249,219,111,249,211,195,126,239,170,82,149,6,165,243,46,188,88,190,
+254,55,255,64,110,217,182,189,112,238,4,76,133,3,39,68,90,205,11,238,209,152,206,187,224,34,185,56,187,88,80,92,233,244,139,191,246,219,133,107,170,180,186,116,206,249,143,147,47,123,197,207,203,238,82,
+91,198,113,36,127,237,215,127,95,58,174,91,200,87,165,42,29,78,242,107,53,249,95,159,253,122,162,132,250,246,55,127,36,175,125,206,139,10,249,204,164,95,106,159,247,194,151,201,249,3,243,114,231,131,187,
+229,39,63,241,101,249,216,243,46,148,80,22,59,27,55,109,201,188,252,86,47,194,235,159,108,199,145,27,55,111,89,213,115,193,92,204,153,86,24,235,149,180,34,137,22,61,180,192,20,66,72,223,175,201,102,179,
+37,145,27,3,156,243,130,5,145,78,181,90,93,78,76,78,22,142,15,74,150,101,21,218,99,89,182,28,27,159,72,23,203,66,72,199,113,50,74,6,161,172,40,204,133,90,171,53,34,27,141,166,209,142,116,209,174,203,214,
+159,205,114,204,69,180,16,66,214,106,245,68,38,131,44,169,180,210,32,127,220,76,230,98,221,188,46,191,56,55,207,55,154,77,217,104,54,11,101,173,38,233,246,148,91,167,101,23,189,249,251,174,148,6,149,161,
+23,255,195,242,67,89,2,107,121,229,203,98,140,73,203,182,101,173,86,207,200,198,178,236,76,159,151,41,26,86,74,181,122,93,142,140,142,37,125,193,57,151,158,231,101,148,19,141,102,83,206,108,216,152,124,
+118,93,87,206,108,216,152,88,165,10,33,164,231,121,133,178,205,50,234,141,134,156,222,176,49,105,31,148,133,172,182,122,54,243,231,147,150,95,254,56,0,217,104,52,229,244,204,134,36,143,235,186,210,247,
+107,153,177,85,175,55,228,196,228,148,180,108,91,194,80,38,89,150,149,252,45,132,144,173,145,81,105,217,164,52,103,140,73,215,117,101,179,213,202,40,141,220,220,156,114,61,79,110,220,180,37,81,154,121,
+158,39,91,173,145,164,76,33,132,156,152,156,146,174,178,164,19,66,200,70,163,153,148,3,64,158,123,193,69,242,185,63,246,210,140,82,122,203,214,237,114,70,201,11,74,105,174,173,185,117,93,54,110,218,172,
+218,74,229,140,79,78,202,153,13,155,134,206,31,145,81,34,14,78,250,90,223,247,101,173,86,203,40,5,109,219,145,141,102,51,83,95,0,178,217,26,145,245,122,35,201,199,114,138,234,201,169,105,217,108,165,207,
+75,203,178,100,107,100,116,96,191,15,74,205,86,43,51,167,116,249,102,30,109,141,104,214,47,159,86,58,95,165,163,35,233,62,213,159,175,121,230,243,229,101,143,191,42,115,62,127,77,149,170,180,30,233,194,
+139,47,75,222,241,78,228,116,194,198,192,90,157,191,247,209,71,28,199,232,198,62,46,62,239,28,184,126,49,80,234,223,254,221,123,112,207,93,183,229,15,87,12,65,199,56,216,187,103,23,26,205,6,126,254,23,
+126,14,127,248,246,119,227,157,127,252,166,85,237,32,118,162,242,172,231,189,24,87,63,229,89,184,254,251,223,204,159,170,24,0,99,28,65,208,199,87,191,254,37,236,216,181,132,79,126,250,115,248,205,55,254,
+18,110,189,249,134,124,214,12,20,231,67,162,209,108,225,43,223,248,14,254,240,143,223,138,127,251,215,127,196,174,157,20,124,63,74,226,118,152,207,181,99,243,25,119,36,16,66,64,136,213,236,158,52,28,166,
+226,148,232,216,60,195,100,108,126,199,212,106,53,10,4,173,250,202,68,199,80,209,125,60,136,124,28,42,51,174,14,221,139,226,23,113,193,81,171,213,208,105,183,51,229,233,216,68,101,212,234,117,88,150,141,
+246,242,114,254,84,41,105,220,153,52,54,76,28,71,112,108,7,150,101,163,175,98,17,217,182,141,241,201,41,180,151,151,146,184,87,12,233,78,93,76,237,136,232,215,235,232,247,186,136,99,10,252,156,198,92,210,
+245,55,119,97,163,221,186,226,56,78,242,72,41,17,197,20,80,27,0,100,28,195,243,124,21,47,37,149,1,23,2,50,142,87,49,14,210,107,108,219,129,227,164,109,2,128,70,163,129,40,162,152,86,0,224,122,30,28,199,
+69,167,147,238,30,217,104,52,193,133,88,69,204,150,52,222,145,142,107,148,143,243,147,6,3,30,60,62,76,116,159,20,209,101,167,187,194,105,242,129,153,117,188,31,25,235,216,112,38,18,0,245,101,173,94,71,
+16,244,17,199,49,60,207,67,163,213,66,208,239,171,152,114,20,103,135,11,129,56,166,184,82,180,91,156,142,87,84,68,202,24,150,109,195,178,108,4,125,42,23,96,180,75,103,20,38,187,12,218,182,131,48,10,209,
+239,167,49,153,226,36,16,127,186,179,96,190,157,102,224,109,198,24,194,32,64,24,70,42,190,18,135,109,219,136,34,138,61,150,206,203,98,28,48,199,113,16,69,20,116,220,148,181,237,216,112,108,7,139,75,139,
+42,78,26,71,20,81,156,37,221,207,82,74,184,158,11,199,113,16,71,81,178,51,32,212,156,145,70,28,50,198,25,108,203,166,88,92,82,194,243,124,212,27,77,44,45,46,168,250,1,181,90,61,57,175,223,103,186,157,54,
+66,21,155,202,182,41,56,124,123,121,25,113,44,193,133,192,200,232,40,186,157,78,18,179,110,114,122,6,82,82,124,45,203,182,193,57,109,44,177,188,184,160,98,167,133,16,150,133,160,223,71,175,215,5,212,6,
+22,156,115,116,58,109,37,239,152,234,18,4,232,247,41,70,139,99,59,224,130,163,213,26,193,210,226,98,50,206,168,189,217,177,95,62,102,83,244,249,88,205,225,70,163,9,198,25,130,160,79,59,0,74,137,160,223,
+135,227,184,180,194,145,18,163,163,99,185,58,234,157,38,105,46,232,190,78,228,205,232,89,27,27,187,129,14,130,198,17,149,99,59,118,38,86,149,57,118,160,198,143,235,186,8,130,236,51,41,143,150,75,173,86,
+83,99,167,122,7,61,58,161,126,215,253,117,207,221,119,224,225,135,30,0,51,54,17,25,214,207,21,71,23,66,88,16,86,118,23,226,163,149,221,59,31,78,158,175,39,50,52,243,42,142,25,28,215,197,69,151,60,30,87,
+63,233,153,248,173,95,123,13,70,39,211,29,138,122,203,93,92,122,229,19,113,211,141,215,103,174,169,24,142,254,194,137,162,8,231,156,255,56,92,124,201,19,241,129,247,253,85,62,27,0,96,106,102,3,78,57,245,
+76,124,247,91,95,59,33,119,24,97,106,231,165,167,63,243,249,248,252,103,174,3,99,12,255,252,47,159,197,111,189,233,181,216,179,107,103,62,123,69,14,253,242,190,214,177,115,168,215,85,16,181,90,13,150,237,
+24,91,211,151,147,85,36,12,198,92,236,175,166,79,180,2,141,113,90,48,83,176,236,236,117,43,245,49,83,193,174,143,196,130,198,86,187,187,173,172,108,41,98,214,91,8,161,22,133,180,176,215,74,183,126,207,
+220,132,130,148,31,250,111,173,148,139,99,9,223,247,147,0,213,121,133,74,25,121,89,145,130,74,130,113,6,174,2,43,31,46,76,41,217,204,178,132,16,43,246,131,235,121,73,16,118,141,231,251,74,97,82,172,87,
+89,255,235,231,237,90,24,36,55,206,85,144,114,165,88,210,229,154,247,29,116,109,158,52,47,41,15,245,117,174,235,128,115,129,118,123,217,40,43,93,232,49,206,193,185,10,156,173,2,169,155,152,229,166,164,
+99,133,174,149,201,125,145,212,159,254,214,74,9,82,96,169,171,84,144,119,13,93,151,30,144,106,183,188,122,189,65,129,182,85,192,242,225,152,117,73,17,150,64,189,94,199,210,226,18,162,40,13,80,159,87,162,
+105,89,48,198,32,227,88,41,172,226,76,91,211,215,115,165,244,227,60,163,252,54,149,105,131,230,11,23,92,149,159,206,79,77,20,69,201,243,206,84,180,72,41,97,219,54,130,32,128,227,56,112,92,23,103,157,125,
+62,238,184,237,166,100,195,162,252,88,53,239,157,63,70,125,202,96,217,54,194,32,132,176,72,137,172,149,123,140,145,82,209,178,4,122,153,231,196,112,164,140,81,171,213,16,197,177,122,190,208,152,168,215,
+27,184,252,9,79,194,77,55,126,31,123,247,236,206,95,86,90,215,178,227,101,242,68,238,92,218,86,189,1,1,199,216,248,56,160,118,60,93,92,92,200,149,179,242,70,27,76,205,249,90,173,134,48,140,170,133,234,
+0,180,156,54,111,221,134,151,191,226,151,240,229,47,125,6,223,251,246,215,243,217,30,17,202,198,138,57,182,42,142,94,60,159,126,232,178,45,27,156,115,44,47,47,229,179,84,28,165,156,176,22,88,199,42,81,
+20,97,215,195,15,97,215,238,135,240,224,238,57,108,154,220,4,215,177,225,215,60,220,118,235,253,248,139,191,124,103,245,133,183,102,232,37,145,49,134,189,187,119,226,134,235,191,3,168,69,138,169,227,221,
+118,210,41,120,219,31,188,11,174,95,199,183,191,249,229,92,25,39,10,18,151,92,126,37,190,248,185,255,132,176,232,101,248,252,243,206,192,139,159,255,18,124,238,11,255,141,3,251,247,229,47,56,38,169,213,
+235,216,182,253,20,204,30,60,144,63,117,72,164,139,44,74,233,231,114,44,203,202,88,160,208,66,40,107,53,97,89,86,242,226,124,34,209,108,181,192,141,95,226,87,130,49,14,97,9,244,122,189,36,63,231,28,150,
+101,43,171,16,194,178,108,52,155,45,244,122,189,161,50,205,46,94,6,231,51,145,122,247,58,181,0,213,229,143,141,79,224,228,83,78,195,242,210,162,97,133,49,184,76,125,157,16,162,80,71,115,76,149,181,111,
+24,113,28,37,178,209,139,202,252,243,79,195,148,194,63,85,32,144,229,5,83,59,122,105,75,10,58,14,132,97,106,93,162,74,200,252,29,69,33,164,148,176,44,129,102,107,4,129,218,69,178,172,11,244,98,88,255,109,
+194,24,131,224,100,233,147,42,4,202,25,52,255,132,16,165,10,135,56,142,225,251,126,162,180,26,214,15,154,40,183,123,160,16,2,182,101,33,150,50,179,155,163,227,186,128,209,94,198,128,122,189,174,172,183,
+82,139,57,207,243,192,87,161,56,203,62,103,82,133,136,148,18,182,227,64,88,105,185,230,194,43,219,71,121,116,27,41,79,179,217,204,236,220,166,209,187,7,22,23,116,105,217,81,24,170,157,24,179,8,65,150,90,
+116,142,25,73,99,90,64,209,185,180,206,58,111,170,76,35,178,214,108,116,125,182,157,122,252,250,190,143,56,166,121,186,18,212,231,37,242,146,82,45,136,130,164,141,230,92,208,150,25,140,145,181,152,182,
+226,43,150,103,182,11,0,36,132,82,252,73,165,140,50,219,149,239,59,41,99,88,150,192,197,151,62,1,253,126,15,203,106,231,216,65,215,48,181,187,161,46,123,219,73,39,35,142,99,44,47,45,161,215,235,225,192,
+254,61,232,117,123,74,25,72,242,74,191,155,178,125,173,219,11,85,15,58,79,243,92,63,55,116,57,26,122,94,89,165,138,221,65,48,70,150,87,122,199,67,61,15,39,167,166,112,237,179,94,140,7,30,188,7,7,246,237,
+205,95,150,147,85,106,65,106,146,255,172,161,254,75,219,214,108,209,15,200,122,62,11,193,81,171,213,209,110,47,39,223,55,166,44,232,123,189,56,246,77,180,252,226,152,198,71,217,115,234,68,162,236,89,77,
+22,114,49,38,167,166,241,255,62,243,37,188,252,229,207,197,139,159,247,66,220,124,231,61,216,241,224,253,135,188,19,241,161,147,62,115,211,84,113,44,32,213,143,30,65,191,159,177,178,174,56,250,201,191,
+101,84,28,3,68,81,132,187,239,184,13,31,122,255,95,227,57,47,120,6,158,240,228,171,241,146,151,191,6,191,245,150,255,147,217,254,183,98,245,72,169,93,1,104,74,208,98,44,107,37,49,57,53,131,27,110,186,30,
+255,244,190,119,25,87,158,88,108,63,249,84,124,246,19,159,132,229,146,171,142,230,164,211,54,227,159,254,191,127,129,101,89,153,227,199,42,174,235,161,53,58,154,63,124,200,228,23,219,249,207,121,38,167,
+166,225,121,180,176,205,163,199,104,173,222,128,165,92,166,242,216,142,83,88,88,28,47,132,1,185,226,112,195,154,96,24,82,198,96,96,16,198,182,244,156,11,212,27,245,236,34,142,51,196,114,53,238,101,89,132,
+16,165,227,158,22,34,197,62,144,82,162,94,175,227,217,207,255,113,124,227,171,223,197,215,190,244,21,188,226,85,191,2,199,117,147,113,49,104,1,53,12,114,57,161,235,226,56,134,235,121,24,159,152,200,103,
+27,138,174,175,16,2,194,178,32,68,177,254,66,240,68,233,98,98,142,105,253,60,69,201,2,151,148,41,105,94,178,78,35,11,39,173,48,230,34,117,243,202,51,248,184,60,164,133,75,126,28,49,70,174,62,174,231,101,
+142,215,234,13,184,170,221,180,232,45,42,186,242,152,117,141,227,24,237,118,27,65,238,37,89,47,88,211,188,12,142,235,97,116,148,44,57,52,81,28,195,247,107,133,122,13,194,148,187,86,202,69,97,8,94,24,151,
+212,6,178,208,50,14,103,206,145,229,148,101,91,240,60,47,211,255,102,27,181,92,76,72,97,65,121,242,22,75,26,41,99,184,174,7,223,243,105,190,38,46,56,217,60,233,223,100,237,164,127,68,1,0,198,180,82,63,
+57,4,83,41,148,239,171,124,189,231,231,231,208,235,117,209,108,54,201,221,119,192,56,227,156,149,142,127,168,122,205,29,60,136,56,138,192,57,89,95,197,49,89,62,57,78,26,242,65,215,69,143,33,83,201,33,101,
+108,180,65,130,49,202,167,21,107,169,18,76,231,73,219,162,175,7,128,48,12,113,207,221,183,193,182,29,216,234,222,230,189,180,178,89,31,215,215,10,33,176,243,225,29,8,149,187,49,99,12,221,110,87,185,40,
+102,223,147,244,61,77,232,115,42,107,125,13,141,65,146,81,158,40,138,208,110,167,238,183,107,69,202,24,83,211,51,184,250,169,215,194,118,92,56,142,11,219,42,255,110,76,221,187,8,83,102,43,145,31,191,90,
+73,169,251,51,138,34,236,223,183,23,157,118,91,41,238,181,156,164,122,190,103,21,170,195,136,99,221,247,171,203,127,252,66,178,29,25,29,195,217,231,94,0,40,57,111,222,186,29,255,253,185,175,226,188,11,
+79,71,28,198,24,155,26,193,103,62,249,81,188,255,253,215,161,217,26,201,149,81,113,52,192,57,41,120,243,223,17,143,38,81,20,101,92,127,43,142,29,42,11,172,99,152,126,175,135,197,197,5,236,223,183,23,183,
+222,252,67,220,115,215,237,249,44,21,107,70,63,196,138,191,162,236,218,185,3,223,251,206,215,208,235,82,252,135,19,141,90,173,134,127,249,208,39,113,238,249,167,229,79,1,0,182,110,155,193,183,190,119,19,
+238,190,243,216,143,193,214,237,116,176,91,197,151,122,52,232,118,59,185,88,25,166,235,1,253,223,239,247,7,46,216,41,142,10,185,166,28,111,132,33,185,96,229,99,73,13,67,8,14,48,166,126,173,167,69,163,86,
+36,208,162,130,22,154,189,110,87,189,92,13,150,91,186,160,160,60,141,102,19,158,71,174,111,217,124,28,66,80,185,121,46,185,252,74,124,228,3,31,192,182,83,54,194,175,123,112,173,38,62,243,217,79,160,86,
+171,35,232,247,51,150,59,101,148,245,107,24,146,37,147,134,172,53,200,18,201,60,46,132,80,241,161,202,198,78,250,220,115,93,79,253,34,153,189,87,156,113,255,41,46,166,179,228,45,96,98,56,174,75,238,68,
+202,50,139,107,87,42,73,101,143,140,142,193,182,109,116,187,157,194,181,200,40,102,6,91,50,14,90,244,229,251,142,49,114,53,212,242,73,22,152,106,172,152,114,235,180,219,202,253,142,22,150,90,57,1,0,190,
+239,195,118,156,100,209,191,22,180,165,150,30,43,140,1,157,78,27,157,78,27,151,61,254,106,60,235,121,63,129,253,251,119,225,224,129,253,202,253,52,237,79,33,4,28,215,133,224,169,101,150,235,121,176,44,
+203,176,22,139,209,106,141,0,140,220,154,194,48,132,101,145,229,152,46,199,182,109,140,142,141,171,120,64,169,197,156,95,171,193,178,44,4,1,89,91,213,106,53,216,182,141,133,249,121,68,81,4,203,178,208,
+26,25,69,208,39,235,28,169,92,159,60,223,87,113,146,36,26,205,38,234,141,38,58,109,138,65,84,102,185,100,89,22,98,25,35,140,66,160,100,145,207,57,131,237,56,136,13,247,199,137,201,41,8,33,208,235,117,33,
+165,76,126,116,208,113,220,164,148,152,156,154,74,158,23,0,89,182,121,190,143,158,154,171,158,231,162,209,32,215,65,45,143,145,209,49,132,17,185,110,81,61,100,166,206,156,11,229,98,71,115,163,152,135,226,
+84,141,140,142,42,165,12,185,0,142,140,142,162,31,80,108,48,26,98,12,150,109,193,247,60,53,119,201,10,172,217,106,161,223,35,43,122,41,37,70,199,198,49,50,58,138,165,165,69,196,113,12,207,247,49,57,57,
+141,94,191,135,40,12,33,4,199,244,204,6,244,250,189,196,18,200,113,93,76,78,77,99,223,158,61,120,204,99,207,199,43,95,245,43,184,224,113,151,227,230,155,190,143,94,175,7,128,97,98,114,18,150,176,18,249,
+93,120,241,101,152,154,154,193,238,93,59,17,133,33,26,205,38,166,103,54,36,177,182,164,148,152,217,176,17,50,150,170,237,192,232,216,56,90,35,35,202,194,139,100,113,242,169,167,34,138,226,68,198,51,27,
+54,162,86,171,171,152,124,26,146,23,89,100,209,145,124,159,175,68,94,233,52,49,57,141,103,92,251,66,140,140,142,193,245,106,184,247,158,219,177,119,207,174,228,188,126,94,121,158,167,172,52,233,158,58,
+173,21,198,24,250,253,94,50,207,124,223,135,235,121,8,250,253,204,179,17,106,225,238,58,46,60,191,6,199,118,84,31,20,161,239,38,253,140,33,133,114,179,217,66,191,31,36,207,172,149,24,244,76,60,22,49,21,
+188,127,243,119,255,130,247,252,213,159,2,246,56,184,96,120,231,31,255,21,174,188,234,2,196,17,61,15,101,20,131,11,142,115,206,57,21,31,254,200,199,75,221,71,43,30,109,24,28,215,73,172,174,43,42,14,135,
+163,71,13,122,156,177,101,219,73,216,184,105,75,254,112,69,197,49,203,21,79,124,10,174,121,198,101,249,195,25,46,184,96,248,249,138,213,161,23,52,195,24,118,190,215,237,174,202,21,230,88,194,92,20,148,
+189,252,12,91,136,244,251,65,178,40,212,104,151,25,19,173,28,25,246,11,33,231,180,32,213,116,218,237,92,204,31,237,126,71,253,104,162,243,44,44,204,103,234,250,184,243,207,192,25,103,61,22,174,114,19,27,
+214,183,131,200,95,19,134,129,170,87,214,226,38,54,22,160,131,144,18,232,7,253,66,153,26,90,236,155,150,11,229,114,71,174,94,140,113,196,145,118,51,164,133,22,5,184,214,139,122,142,94,183,131,94,183,83,
+232,3,82,116,101,143,229,203,166,255,7,215,133,115,14,33,132,81,14,197,62,212,48,70,177,134,160,126,153,205,163,239,39,149,75,168,137,46,123,16,116,223,242,186,233,248,84,48,198,182,14,72,254,186,95,248,
+121,188,249,205,239,196,204,198,77,144,57,183,89,46,132,138,31,102,182,129,98,118,81,89,36,231,78,167,131,208,112,237,163,113,153,214,37,142,35,244,186,93,132,74,193,11,85,167,40,113,113,139,225,215,106,
+232,245,122,73,32,112,243,90,168,123,9,33,84,96,245,108,28,41,173,240,44,131,169,128,232,113,20,33,12,242,74,233,244,62,142,227,100,172,103,218,237,229,204,156,150,82,42,5,23,41,91,44,203,166,141,27,140,
+73,110,142,89,198,56,194,40,130,84,10,60,168,62,154,159,155,69,71,205,103,41,99,184,174,171,20,45,234,58,206,16,169,54,235,54,153,150,176,140,113,196,113,100,4,151,167,31,27,22,230,231,16,171,113,78,249,
+232,15,46,172,164,28,41,101,34,3,41,105,76,117,218,203,152,61,120,64,41,92,56,130,32,64,167,189,172,22,246,116,221,242,210,82,198,45,181,217,108,225,148,211,206,194,185,231,63,14,83,211,27,240,162,231,
+60,19,147,19,83,42,32,63,201,161,215,37,197,149,102,121,105,17,227,147,211,24,25,33,203,227,249,185,89,44,204,207,171,231,145,146,151,250,94,98,202,210,174,223,235,161,211,161,185,74,9,152,159,155,67,96,
+244,191,118,67,204,106,185,233,239,172,114,95,102,250,123,37,242,227,233,161,7,238,195,158,61,59,241,212,39,95,139,179,78,63,11,251,12,229,149,73,167,211,45,88,93,30,42,186,221,244,55,197,51,43,35,142,
+37,150,151,151,16,6,125,244,86,25,226,131,198,42,141,137,188,213,216,48,6,61,179,143,69,164,82,234,254,225,159,252,29,126,238,85,47,128,237,217,120,219,239,189,14,95,250,159,207,226,41,79,186,8,7,246,206,
+130,171,239,98,225,144,21,244,239,190,245,47,143,139,31,81,143,71,164,36,183,228,252,119,103,69,197,161,162,191,53,170,180,78,105,108,124,66,190,255,159,62,33,239,190,227,1,249,196,39,61,189,112,190,74,
+85,58,150,146,222,14,248,130,139,46,149,97,63,144,113,28,149,166,123,238,124,80,110,221,126,114,225,250,42,85,233,145,72,182,237,72,191,86,43,28,71,201,150,215,230,214,230,101,199,242,231,6,37,198,88,225,
+24,0,105,59,142,180,44,171,112,92,151,201,24,147,79,123,198,115,229,157,183,221,47,227,56,146,223,250,198,141,242,180,51,206,146,76,109,227,110,230,29,150,56,231,153,173,219,211,251,148,215,107,165,36,
+132,144,190,239,23,142,229,243,153,105,53,178,74,219,157,230,101,140,169,84,46,115,198,184,228,156,228,193,24,181,115,80,190,236,189,138,109,231,124,229,58,230,203,240,124,191,180,172,65,201,247,107,210,
+118,156,194,241,180,204,193,117,208,109,203,230,167,123,63,238,146,43,228,231,63,247,13,249,166,223,121,167,116,28,183,112,109,254,30,249,191,181,156,7,229,211,121,92,207,75,250,154,49,150,212,169,217,
+26,145,39,159,122,186,60,245,244,179,100,189,209,24,56,174,153,26,187,233,125,139,253,52,60,233,241,144,222,155,169,49,160,255,215,127,155,237,209,249,132,16,201,253,117,126,215,117,115,227,134,229,202,
+161,191,133,16,201,113,36,227,133,198,102,190,111,234,141,134,244,60,154,35,105,185,197,118,232,114,245,223,90,174,250,184,89,110,217,248,212,117,203,183,83,127,214,245,77,203,206,158,119,61,79,254,228,
+79,191,86,94,119,221,23,229,83,158,254,108,217,104,54,51,117,44,43,183,53,50,42,175,125,206,11,229,25,103,61,182,112,126,88,93,204,227,249,99,249,107,6,167,180,255,139,199,242,121,139,247,23,66,200,211,
+207,124,140,124,254,139,94,46,127,239,109,239,146,167,157,113,214,192,58,228,159,37,235,145,44,203,90,177,220,124,61,242,245,27,148,204,254,26,150,124,191,38,189,220,243,251,88,79,111,250,157,119,200,56,
+142,100,20,134,50,232,245,147,247,205,183,255,233,223,203,179,30,123,174,252,250,255,254,80,198,113,36,31,186,111,167,188,234,41,207,40,92,95,165,42,85,233,184,77,133,3,85,58,204,100,217,182,124,238,11,
+95,38,227,56,146,253,110,79,158,124,218,233,133,60,85,170,210,177,148,244,203,214,75,95,241,243,5,197,85,28,71,242,224,222,131,242,212,146,23,198,42,29,153,36,132,144,141,70,179,112,252,120,79,101,139,
+129,181,38,166,22,48,230,130,76,31,215,73,47,228,87,74,142,235,14,172,75,89,57,140,113,233,184,110,162,4,184,228,242,43,229,117,215,125,81,62,233,169,215,102,242,208,255,233,162,37,95,78,179,217,146,173,
+145,145,82,89,88,150,45,107,3,20,121,43,37,173,60,208,159,107,181,186,220,180,121,107,65,49,163,23,248,250,154,124,29,242,41,127,62,223,143,131,22,169,66,8,233,184,110,70,225,144,230,165,186,110,218,188,
+85,122,158,87,122,159,65,41,159,47,223,110,172,208,183,101,73,215,41,127,92,167,50,37,69,89,242,124,95,78,78,77,101,20,137,155,183,110,147,79,124,242,211,101,189,209,40,228,207,167,162,108,203,239,75,202,
+30,38,253,90,205,80,154,50,105,89,86,70,17,117,205,51,95,32,239,189,235,33,249,183,239,254,55,57,58,54,38,1,200,145,145,209,140,188,204,123,30,126,162,254,109,52,155,114,100,100,212,40,159,148,63,102,222,
+226,189,211,113,148,87,236,232,164,149,74,102,153,58,209,241,84,1,149,191,151,237,56,114,124,98,98,64,217,212,247,150,101,73,219,113,140,50,179,247,73,149,87,52,230,242,247,225,156,75,207,243,146,50,242,
+117,208,247,53,235,157,175,11,212,120,251,195,63,249,59,249,234,215,254,70,105,63,149,127,102,242,159,62,248,41,249,241,143,255,143,172,215,105,172,153,245,202,231,207,167,178,243,230,177,225,201,84,46,
+154,202,67,83,137,149,85,104,65,41,234,102,54,108,204,40,86,159,112,213,83,229,99,30,123,222,192,186,61,114,169,252,185,166,83,94,126,101,105,181,249,0,200,107,158,249,124,121,245,113,166,196,121,223,251,
+255,163,240,190,249,174,191,249,231,228,253,103,108,124,66,254,204,107,94,47,79,63,243,49,133,107,171,84,165,42,29,191,169,138,129,117,4,136,227,24,119,222,118,51,190,252,191,223,198,158,3,61,124,243,235,
+95,196,210,34,237,2,83,81,113,44,162,221,179,110,190,241,251,216,181,191,135,231,60,235,169,201,185,206,98,7,215,60,247,121,184,233,134,31,100,174,169,56,146,80,44,129,124,220,163,227,157,196,237,70,5,
+72,62,148,182,235,177,204,84,92,151,90,173,14,223,175,33,82,174,88,250,28,185,185,12,47,159,76,225,7,229,41,110,153,46,4,197,66,225,156,129,113,142,135,30,184,15,159,249,236,117,184,235,14,114,121,72,221,
+98,242,101,102,235,34,4,71,28,69,8,130,242,216,40,218,245,75,67,229,102,243,149,29,3,82,23,54,250,27,136,226,144,100,147,49,251,39,249,11,97,193,113,178,241,214,200,173,134,100,232,121,46,106,245,58,250,
+61,114,41,18,130,195,118,156,140,171,141,231,185,96,70,60,41,147,212,45,204,68,187,211,164,46,119,122,231,66,161,2,69,151,181,203,132,250,55,173,47,212,142,118,102,219,135,247,109,22,207,243,32,141,13,
+0,44,203,134,171,130,54,107,87,47,33,204,128,221,131,203,213,238,77,150,237,36,241,177,22,230,231,240,224,253,247,38,174,118,249,113,149,69,187,28,165,46,102,101,110,69,140,124,54,33,212,142,94,218,93,
+201,117,93,216,182,141,48,12,113,218,25,103,225,55,94,255,187,120,194,19,47,192,227,206,59,11,179,75,192,93,119,222,76,177,156,66,138,139,69,200,129,73,207,217,213,67,249,61,151,130,213,247,122,20,139,
+74,8,114,17,210,253,235,121,126,18,139,42,189,7,253,79,77,203,30,211,80,63,211,223,220,216,216,65,31,51,159,13,230,181,186,223,4,39,87,80,138,135,70,8,75,160,209,104,32,138,98,8,97,161,53,50,66,227,210,
+112,137,212,245,97,106,199,191,70,179,9,203,182,147,246,105,164,140,225,249,53,8,206,11,113,234,24,99,176,29,27,92,240,100,14,209,49,7,80,187,251,233,99,0,112,203,173,63,196,119,190,249,149,196,101,71,
+7,234,231,156,161,217,106,169,224,197,72,198,99,189,222,64,187,215,197,13,63,186,30,253,126,23,7,15,236,79,250,145,198,51,141,19,168,103,80,173,94,135,109,217,153,157,39,83,119,216,193,46,221,229,80,76,
+44,198,24,132,101,81,32,127,53,95,116,138,99,10,6,79,197,82,69,60,207,131,239,215,49,63,63,151,148,212,237,180,17,70,33,22,23,230,211,210,87,93,23,213,192,76,220,51,61,38,146,67,37,200,36,80,61,86,241,
+29,101,206,73,243,153,217,108,53,233,185,17,167,115,104,16,218,109,115,114,106,154,98,49,250,53,76,207,108,132,95,171,35,142,66,44,47,47,229,47,57,102,208,223,79,223,248,198,151,112,243,237,15,226,188,
+179,206,65,205,119,241,170,215,190,1,127,246,246,55,163,223,239,67,8,129,118,123,25,55,92,255,109,28,60,176,63,113,211,30,36,243,138,138,138,227,7,250,70,62,70,97,73,192,195,138,138,138,35,137,126,81,210,
+11,150,231,254,216,75,241,151,111,127,7,218,221,62,94,254,51,47,171,148,87,143,18,39,234,51,80,47,150,180,82,96,181,49,21,82,5,81,186,128,24,29,27,7,32,49,55,59,91,88,240,115,206,97,217,118,33,126,214,
+225,178,101,219,73,152,59,120,0,75,106,123,123,148,244,165,25,36,124,37,242,215,174,6,166,2,168,175,70,118,101,139,2,206,57,132,101,169,24,76,20,39,73,43,167,162,136,98,13,53,26,77,212,27,13,236,217,77,
+241,104,60,207,195,228,244,12,118,61,188,35,185,239,228,212,52,194,48,196,220,236,193,76,255,12,66,170,24,60,249,5,96,62,79,25,66,8,76,76,78,225,224,193,3,135,20,112,29,0,108,219,1,227,44,51,38,26,141,
+38,98,25,39,1,196,133,16,24,159,156,194,252,220,108,146,143,49,14,206,73,121,49,168,126,38,142,235,82,76,169,32,64,24,70,36,95,219,65,163,217,68,187,189,156,108,38,162,21,24,102,125,106,245,58,226,56,70,
+183,67,129,180,117,80,119,83,201,88,38,63,243,216,248,196,36,126,241,87,126,27,123,246,236,130,16,2,207,122,250,51,113,214,25,219,241,130,159,120,62,110,187,249,71,73,62,19,166,20,98,140,243,204,110,139,
+249,254,25,14,41,2,106,181,58,122,189,110,178,181,249,232,232,24,186,221,14,186,221,46,56,231,24,29,27,71,167,211,70,183,83,220,84,197,84,96,233,120,93,156,51,248,181,26,162,48,66,167,67,1,197,91,42,222,
+211,194,252,92,34,147,102,107,4,66,136,129,227,145,169,192,218,203,203,203,201,24,118,28,7,141,86,19,237,165,37,116,187,61,212,27,117,8,46,48,175,202,101,12,112,93,23,253,126,159,148,178,49,221,135,115,
+134,160,175,99,213,165,247,210,245,47,236,122,39,99,212,235,13,88,150,133,133,5,218,113,218,178,45,52,91,45,117,111,189,9,69,182,47,133,16,168,55,154,232,118,59,232,247,122,16,66,96,114,106,26,7,15,30,
+72,250,169,217,26,193,198,77,91,112,231,237,183,0,106,94,114,206,177,180,184,152,212,143,145,78,9,140,81,220,176,122,131,148,45,179,7,15,36,242,171,215,235,8,194,48,25,143,158,231,33,150,50,81,98,15,67,
+191,99,76,77,207,160,53,50,138,251,239,189,27,113,44,209,108,54,33,44,11,182,109,99,78,205,41,82,246,140,64,198,49,22,135,236,190,45,132,128,231,121,232,116,58,5,5,148,148,180,91,107,28,199,153,248,107,
+190,79,27,88,232,77,27,106,181,26,250,65,80,18,163,141,202,112,92,23,158,235,97,121,121,169,208,103,101,228,231,191,217,103,19,147,83,232,180,151,87,189,43,163,237,56,56,227,172,179,147,221,15,91,35,163,
+184,244,242,171,240,240,142,251,241,157,111,254,111,62,251,49,133,249,156,154,158,217,128,209,177,137,100,124,106,197,187,202,105,92,85,148,111,69,69,197,241,199,49,169,192,154,222,176,17,87,94,245,116,
+124,254,51,255,142,118,187,93,120,25,171,168,168,56,124,204,69,171,126,193,162,5,24,89,91,180,90,35,224,130,99,110,118,54,119,101,69,197,145,69,63,243,233,215,248,108,32,238,97,232,113,108,42,99,87,162,
+76,121,179,90,202,174,101,140,193,117,93,244,122,180,243,217,122,32,68,186,11,221,106,17,66,128,11,145,81,52,12,98,181,223,177,230,66,204,188,198,92,184,106,165,99,186,208,35,133,69,217,194,79,47,152,243,
+199,242,125,151,150,47,1,80,192,237,178,58,39,138,145,126,175,208,110,157,159,41,107,169,124,0,126,77,153,226,207,243,125,68,81,148,148,201,24,135,227,58,232,247,210,64,248,166,12,204,122,217,182,182,164,
+44,151,111,254,186,90,189,142,160,31,100,2,241,231,199,153,182,68,208,138,68,179,95,210,107,210,246,106,204,207,142,235,96,203,214,237,216,183,119,15,22,230,231,240,152,115,206,131,109,59,184,229,71,63,
+4,6,4,185,183,44,11,150,109,131,41,203,41,221,79,230,61,86,66,202,24,150,101,163,222,104,96,121,105,49,233,7,207,247,1,41,19,37,77,189,78,253,168,149,10,180,160,165,221,229,84,73,200,91,209,120,30,237,
+142,168,229,226,184,46,28,219,193,114,178,115,97,140,177,137,9,132,253,0,139,106,247,61,34,187,64,214,65,181,227,152,44,147,226,56,202,200,35,142,105,167,74,32,85,248,112,78,155,51,72,101,41,37,101,140,
+145,145,81,56,174,139,253,251,246,37,215,174,6,173,8,213,127,235,190,212,101,155,232,122,120,158,143,40,10,213,142,118,217,190,134,82,132,57,182,141,118,187,147,140,147,153,141,155,176,180,176,128,229,
+229,165,66,31,230,149,177,249,243,154,65,202,184,97,216,142,13,215,113,209,233,180,17,69,17,56,231,224,66,192,115,61,117,140,238,169,55,211,200,143,115,24,237,19,130,163,53,50,138,249,185,217,210,58,20,
+159,71,116,255,56,138,146,251,56,46,237,48,90,118,61,84,25,194,178,208,239,173,252,44,213,228,231,162,121,92,247,167,137,101,89,120,204,99,207,195,157,119,220,106,40,175,139,243,218,113,93,156,119,193,
+197,184,235,142,91,48,63,151,90,165,29,139,228,229,146,30,39,11,191,188,140,42,42,42,78,28,142,9,5,150,126,152,63,246,220,11,240,180,107,94,128,102,179,133,47,126,225,211,248,238,183,190,150,152,20,151,
+189,76,85,84,28,14,249,69,193,137,6,45,8,178,214,2,131,94,40,42,142,61,88,206,170,238,88,128,49,134,13,27,55,99,255,190,189,201,2,222,247,125,72,181,176,93,9,253,93,50,54,62,14,25,75,204,205,145,242,117,
+45,202,156,60,186,76,198,24,106,245,58,218,203,237,100,110,184,174,139,214,200,40,246,237,221,147,228,53,149,35,150,69,110,81,131,148,37,171,165,222,104,192,243,124,28,216,191,250,133,112,217,226,39,143,
+109,59,176,44,129,110,183,87,154,79,8,1,215,245,208,237,118,16,39,59,11,150,99,46,204,178,249,244,51,182,232,226,67,150,16,129,178,30,162,29,225,92,215,67,187,211,78,44,168,204,118,112,206,209,104,182,
+0,195,170,6,37,174,156,249,103,123,189,209,128,140,101,98,105,226,184,14,164,148,8,148,197,204,90,49,219,169,229,166,159,167,80,237,138,165,68,183,211,129,109,59,25,5,136,121,205,90,225,156,131,243,116,
+124,229,23,122,249,254,201,247,133,153,47,25,195,158,135,48,160,62,0,200,197,145,43,165,113,153,108,108,219,6,227,28,145,49,166,7,45,252,7,161,159,75,186,254,24,80,87,174,92,182,164,178,76,234,7,253,156,
+101,93,209,50,35,95,6,114,114,49,149,67,195,198,38,33,225,56,14,130,196,21,143,142,165,138,47,64,38,110,163,249,191,233,188,176,4,162,112,237,239,175,166,114,183,108,140,229,49,229,85,70,94,22,230,24,204,
+143,155,60,101,114,93,233,154,149,208,245,165,191,211,99,135,114,159,213,230,211,228,243,231,63,231,201,203,110,37,76,217,154,228,239,153,63,215,108,181,176,180,180,152,113,231,78,175,145,153,185,94,81,
+81,81,113,60,179,186,167,237,163,140,148,49,70,70,199,240,223,159,249,60,254,242,207,222,130,223,252,213,159,195,142,135,238,79,94,160,42,229,85,197,122,179,113,243,22,252,198,155,254,8,63,249,202,215,
+98,98,114,42,127,250,132,64,47,26,77,164,218,134,60,127,188,98,125,153,156,154,166,184,38,71,24,207,247,209,104,54,51,11,174,163,25,41,37,130,176,159,89,79,214,155,77,184,158,111,102,3,180,82,202,136,113,
+3,99,81,32,99,9,215,163,24,59,80,138,164,177,241,9,88,150,109,228,78,25,182,48,113,93,39,81,162,197,81,4,199,117,146,251,134,97,136,142,178,18,134,186,191,25,59,135,11,129,70,179,5,199,117,147,99,131,250,
+98,208,113,168,251,148,41,19,134,97,206,97,33,4,68,201,214,242,158,239,99,100,108,28,82,198,165,231,227,56,134,101,219,176,108,146,91,254,217,80,246,57,139,94,208,83,219,180,101,139,38,8,67,112,65,174,
+119,140,113,4,65,0,199,115,81,175,55,50,249,116,185,113,28,35,142,162,129,74,140,180,31,210,248,80,140,113,64,34,137,163,37,101,140,48,8,224,251,181,161,50,31,134,174,143,182,62,97,140,44,72,244,57,198,
+57,132,26,35,65,208,207,41,29,202,251,113,108,124,98,197,103,66,222,18,111,100,116,12,182,83,62,166,145,83,86,12,234,39,219,178,81,83,242,102,140,131,1,24,25,37,203,161,50,130,32,64,28,69,20,199,40,81,
+214,228,251,125,48,90,49,99,142,11,58,158,237,11,83,25,195,24,39,37,106,20,37,215,228,243,235,124,249,207,249,99,217,190,160,58,8,193,75,199,63,192,148,37,165,254,76,227,217,180,132,50,149,87,250,127,115,
+174,102,199,42,197,47,203,207,131,60,140,65,201,151,62,115,206,97,89,246,192,113,164,243,173,246,199,138,181,244,151,44,81,246,172,7,140,105,229,100,246,152,73,254,243,32,134,229,43,171,111,62,127,254,
+115,158,178,113,164,209,115,203,76,131,48,207,229,203,147,50,198,194,252,92,162,188,42,222,83,143,123,58,158,191,190,162,162,162,226,120,226,176,158,112,142,235,14,124,225,95,111,182,108,219,142,141,91,
+73,145,208,28,107,224,164,83,78,207,103,169,168,88,55,4,23,216,178,121,27,174,184,244,42,204,108,220,156,63,93,113,2,195,24,207,40,63,214,27,198,56,122,221,238,17,87,204,211,194,131,92,66,87,194,118,156,
+100,33,110,46,12,27,205,38,154,45,178,120,89,47,132,16,104,181,70,10,11,80,33,4,108,199,193,254,189,123,17,6,97,242,146,78,177,95,40,214,79,38,191,101,65,40,11,167,60,115,115,179,73,92,38,198,56,250,253,
+0,75,11,11,20,56,216,192,178,108,248,181,90,178,176,40,91,20,80,0,99,146,77,167,211,129,231,249,104,182,70,0,165,4,94,90,90,76,92,93,160,228,238,215,106,73,220,162,165,197,5,200,88,26,202,137,242,197,171,
+237,56,168,213,234,201,103,83,62,189,174,14,184,76,199,243,202,57,223,247,51,223,213,182,237,100,218,21,169,56,86,26,237,130,214,237,118,50,86,93,158,239,231,22,242,12,139,11,11,8,250,20,196,89,8,161,148,
+121,49,24,35,235,184,70,179,153,228,182,29,7,245,70,170,124,34,139,161,180,188,252,88,12,131,0,81,24,26,74,0,96,126,118,14,75,139,11,16,66,192,178,41,128,60,99,12,190,239,67,8,11,97,24,162,215,35,107,60,
+223,247,225,121,158,209,111,228,242,37,4,185,115,1,0,99,228,238,22,6,161,178,56,179,16,199,18,11,243,115,74,145,82,92,12,230,199,102,30,166,226,243,80,253,200,138,85,8,1,215,35,165,207,242,210,18,150,151,
+117,92,33,42,91,255,63,72,17,25,6,1,44,33,200,149,110,0,100,9,68,215,51,198,208,239,147,155,170,182,244,27,180,128,246,124,63,201,163,209,253,220,15,250,232,247,41,158,145,190,118,97,126,97,104,12,49,173,
+72,140,162,24,113,156,42,11,7,41,130,164,140,97,89,22,28,215,73,198,0,141,13,6,173,212,201,207,101,82,110,164,109,137,227,101,240,45,179,0,0,57,124,73,68,65,84,172,27,88,153,24,169,219,74,78,0,201,241,
+124,215,10,33,80,171,55,224,56,78,169,236,210,126,139,225,121,30,132,101,129,115,14,207,115,19,197,174,145,219,72,234,136,49,182,56,231,176,109,27,220,24,159,101,72,153,87,124,1,113,156,253,190,48,149,
+247,140,49,140,142,141,195,27,242,189,85,111,52,50,115,85,147,31,251,38,156,179,68,145,169,231,124,189,209,200,28,211,249,142,70,164,114,35,61,212,250,13,154,79,88,225,220,48,244,117,36,207,252,115,135,
+54,193,208,177,219,202,48,239,169,175,31,25,25,197,153,103,159,131,205,91,183,23,126,212,169,168,168,168,56,22,57,172,39,217,255,249,157,119,226,231,94,251,235,249,195,71,132,203,175,120,10,230,246,207,
+227,246,91,238,199,29,183,222,143,48,8,50,47,194,21,21,235,201,142,135,30,192,7,63,248,183,120,255,63,253,53,238,184,245,166,252,233,138,19,24,97,137,130,5,200,122,34,37,5,165,205,238,250,118,100,88,94,
+90,66,123,121,121,224,162,89,195,85,160,104,207,163,157,213,52,82,202,100,119,176,50,24,227,133,133,241,74,48,198,208,26,29,43,252,56,194,75,44,170,0,160,221,110,163,167,226,226,152,47,252,253,94,49,206,
+209,48,218,237,229,66,126,97,9,248,126,45,249,92,182,32,137,162,8,157,78,55,57,23,168,197,126,54,79,241,58,189,142,14,195,16,65,208,71,163,209,132,109,167,139,228,124,123,44,33,224,215,204,186,148,247,
+153,16,2,53,35,31,192,148,245,79,121,126,141,217,54,219,113,96,59,14,56,99,137,76,162,40,66,173,86,207,44,202,243,139,180,56,142,147,29,201,226,56,134,237,184,20,104,89,229,177,132,200,244,107,28,107,11,
+106,93,183,252,66,146,220,185,204,60,25,139,37,37,3,206,57,154,173,17,56,142,131,126,159,98,47,49,198,17,132,1,34,181,176,215,178,204,247,69,28,199,8,195,0,82,198,176,109,82,122,82,187,202,229,69,229,228,
+21,157,169,181,17,0,88,54,237,66,104,25,115,163,86,171,37,86,93,166,210,163,12,157,135,243,84,225,179,184,184,128,48,140,134,42,33,76,164,148,52,183,227,56,177,254,74,207,101,45,66,56,167,133,177,174,151,
+16,2,182,77,10,213,126,175,151,113,7,140,162,8,65,208,31,170,96,39,153,22,227,122,69,17,237,242,105,42,116,161,218,43,101,140,40,140,84,29,40,208,57,89,202,49,56,142,11,223,35,197,104,122,13,253,136,90,
+6,231,28,150,157,202,94,91,53,49,245,28,75,21,22,18,90,65,70,50,167,186,232,177,38,101,12,215,117,32,132,64,167,163,45,41,211,107,76,197,7,83,22,130,122,119,64,109,105,149,90,17,229,199,118,145,56,150,
+232,247,251,137,130,190,140,116,152,209,174,120,186,238,217,225,154,29,187,113,28,163,223,235,33,30,48,166,165,114,193,164,160,236,169,140,73,33,237,173,90,193,19,199,49,28,199,133,173,230,80,122,188,252,
+190,107,103,45,229,232,221,56,7,195,24,185,186,174,165,84,141,110,95,89,63,229,199,253,32,202,174,213,99,84,127,111,234,60,76,185,245,182,90,35,216,126,210,41,3,239,97,150,41,101,12,207,247,113,238,133,
+151,96,243,230,237,56,247,252,139,176,109,251,201,43,90,114,86,84,84,84,28,237,164,223,212,107,228,234,167,94,139,207,252,251,199,241,157,239,223,138,107,158,113,69,225,151,211,245,164,86,171,227,131,31,
+252,36,62,122,221,191,226,187,223,250,42,78,62,237,76,92,251,140,31,195,187,254,242,15,176,103,215,206,124,246,138,138,138,138,19,14,190,134,93,235,14,5,90,212,218,153,88,83,92,237,68,151,87,252,172,6,
+118,24,49,184,178,47,254,180,80,212,47,248,71,2,93,182,86,160,233,58,179,146,128,222,171,193,247,125,196,82,38,193,120,161,172,162,242,193,160,15,21,203,34,75,36,141,200,185,150,113,35,118,208,48,108,199,
+65,20,134,153,62,42,147,179,62,150,95,144,229,23,121,249,207,42,151,250,63,27,171,201,188,71,190,92,66,170,87,24,66,47,86,179,86,56,100,217,147,87,90,233,115,38,249,123,210,49,150,185,135,217,70,51,175,
+80,59,98,105,165,151,57,23,205,114,7,93,139,92,80,116,207,247,17,26,214,84,131,198,132,174,95,190,222,135,130,227,186,228,126,25,134,16,66,168,160,212,69,101,172,73,190,95,242,245,96,198,206,139,43,99,
+246,103,58,38,24,163,93,254,194,40,202,196,138,226,156,193,243,60,116,187,93,163,124,218,16,64,74,9,203,182,213,216,77,21,25,250,111,51,63,149,165,231,181,204,220,219,204,99,126,214,202,74,150,9,78,158,
+150,37,213,78,131,230,115,67,235,142,242,99,97,53,20,199,54,181,147,113,158,40,204,168,46,113,230,62,233,61,210,103,228,32,116,189,104,44,167,253,37,4,47,157,63,26,125,159,124,223,107,134,221,115,45,172,
+126,28,65,185,161,154,227,233,145,99,144,28,242,152,114,49,101,216,108,141,192,243,60,204,206,30,204,88,217,229,251,50,123,108,48,39,157,114,10,22,22,230,113,96,223,62,76,205,204,192,182,29,236,221,189,
+235,176,227,46,86,84,84,84,60,154,28,178,2,235,37,47,127,53,254,244,15,255,0,174,99,225,249,63,241,227,71,116,187,86,109,194,189,184,48,159,28,155,156,154,198,254,125,123,51,249,42,42,42,14,159,97,47,163,
+135,74,163,217,132,235,122,107,10,50,93,177,122,56,231,216,182,253,20,236,222,181,99,85,193,204,143,6,24,227,168,55,234,168,213,234,216,187,103,119,254,116,1,61,46,109,199,65,28,197,136,34,178,82,240,124,
+15,156,115,44,47,45,229,47,25,136,227,56,112,61,63,249,78,113,93,23,245,102,19,179,7,14,150,142,125,189,16,247,107,117,196,81,132,118,155,118,45,19,202,213,110,208,98,96,108,124,2,81,20,97,97,158,118,131,
+18,130,172,247,218,237,212,234,205,175,213,208,237,116,134,148,49,142,70,179,133,135,30,184,63,57,230,251,62,181,89,237,158,86,134,231,121,202,162,163,168,132,88,75,240,248,188,50,198,68,202,56,81,188,
+153,139,203,213,47,54,205,107,56,198,39,38,49,63,55,139,32,8,1,72,120,30,185,32,238,219,187,71,221,155,22,238,40,177,234,144,70,156,174,252,57,203,182,212,98,48,187,160,213,125,93,171,215,201,74,165,223,
+71,28,69,176,29,138,107,182,188,180,132,184,100,35,11,33,200,149,54,24,226,70,151,95,160,154,199,180,66,34,138,34,88,150,5,153,139,229,201,133,0,27,162,184,66,98,245,197,19,165,167,109,59,176,29,27,157,
+118,219,88,224,102,131,213,187,158,7,206,24,58,29,114,185,213,138,170,40,12,135,222,203,132,41,23,213,56,142,17,244,201,114,173,236,59,35,63,86,242,100,101,82,84,54,232,114,41,15,50,22,70,90,126,218,66,
+75,247,55,231,180,145,66,183,219,69,208,239,103,20,71,131,224,156,193,182,109,132,97,132,48,36,235,193,114,101,154,206,79,10,42,42,55,205,39,141,93,81,233,179,4,231,2,158,71,59,231,233,58,250,190,15,198,
+24,218,237,182,89,236,80,180,101,152,46,67,42,75,28,219,117,112,64,237,96,216,104,52,193,133,72,54,47,112,221,188,210,175,40,227,60,186,13,101,50,51,251,107,80,159,151,177,210,56,24,70,153,226,145,49,36,
+174,194,41,186,255,233,7,149,84,233,62,168,189,43,203,162,140,252,115,192,28,163,249,115,230,28,31,132,158,159,218,146,176,223,235,41,11,85,114,41,111,181,70,177,103,247,206,130,12,205,251,150,97,246,149,
+237,216,43,42,162,43,42,42,42,142,53,6,63,1,87,224,147,255,254,207,120,218,51,159,142,55,191,237,29,56,231,220,139,143,168,73,106,20,69,201,66,67,191,28,84,202,171,138,138,35,131,227,216,201,66,112,189,
+224,134,43,204,241,138,95,171,225,213,175,253,13,252,248,203,126,54,127,234,176,176,172,149,251,35,142,99,28,216,191,23,209,33,88,51,61,90,72,25,163,211,110,99,94,41,119,86,66,191,148,143,140,142,37,177,
+90,164,36,151,21,207,163,88,71,122,81,191,18,66,88,168,213,106,137,92,109,219,129,231,250,133,248,55,26,189,96,160,109,232,211,197,64,164,44,86,6,193,57,71,164,130,131,67,125,127,105,133,87,20,69,112,84,
+60,147,188,139,151,73,183,211,41,44,64,56,23,73,236,40,198,120,169,91,25,197,31,42,95,60,69,3,118,144,203,227,251,62,70,199,198,147,207,249,5,43,231,156,98,74,229,92,134,244,247,244,74,80,190,52,89,150,
+173,22,208,180,248,20,66,36,46,137,64,170,176,208,177,175,82,36,44,203,134,227,56,37,231,144,9,238,77,231,168,237,186,220,56,138,0,41,19,107,22,215,113,19,249,74,101,197,149,159,131,218,194,102,16,249,
+5,109,62,47,99,212,190,40,138,11,139,92,138,31,85,222,119,154,40,231,202,39,101,12,75,88,153,119,49,179,143,181,162,44,204,88,226,9,184,78,185,27,158,38,95,111,40,197,87,218,79,233,252,96,202,253,201,30,
+16,47,10,202,162,135,115,106,187,46,219,178,237,100,193,79,72,165,164,165,99,230,120,98,42,128,57,0,101,69,72,74,13,74,228,18,22,71,228,138,56,124,136,75,0,18,92,185,181,74,73,27,18,8,75,36,99,69,67,74,
+83,178,182,156,156,154,134,109,147,146,193,44,199,113,221,140,21,158,84,238,125,194,178,50,1,252,109,199,28,227,170,61,57,151,202,60,82,166,74,89,45,59,58,1,156,121,246,57,216,184,121,11,226,152,230,52,
+181,59,166,218,169,42,74,229,18,59,108,90,234,246,107,5,113,30,122,118,145,107,166,227,186,96,140,250,205,156,23,101,99,229,80,209,99,74,247,117,70,65,174,198,144,137,86,24,106,5,225,32,164,140,33,68,26,
+0,127,53,144,252,138,227,89,203,58,143,84,174,123,181,122,26,179,176,12,169,44,5,101,44,85,172,63,142,48,12,16,134,33,56,163,248,98,101,115,105,181,114,150,146,92,71,161,174,25,212,183,21,21,21,21,199,
+26,44,253,138,59,116,44,203,86,47,196,197,7,121,69,69,69,197,137,192,51,159,251,98,124,246,83,31,197,254,221,7,113,205,115,159,141,27,175,255,254,186,60,19,107,181,58,164,140,19,171,137,227,29,215,117,
+49,58,62,129,125,123,118,151,186,23,10,33,192,133,128,231,122,96,156,163,189,188,132,48,12,49,179,113,19,218,75,75,88,92,92,200,228,231,156,195,178,139,191,66,51,101,73,83,111,52,147,248,87,122,97,48,168,
+223,202,172,101,6,45,98,76,28,215,93,179,149,75,153,130,169,236,94,190,79,65,227,247,237,221,91,56,135,1,215,232,248,145,43,89,173,89,106,241,157,151,157,70,151,109,254,127,232,20,221,156,116,189,203,203,
+77,173,40,132,16,104,52,155,88,90,90,132,140,227,82,235,11,93,150,118,207,43,83,60,210,125,178,187,196,121,158,135,90,189,142,197,197,69,4,253,62,106,245,58,56,231,232,13,137,177,102,59,14,26,141,38,122,
+221,14,218,198,46,148,26,169,2,249,11,33,176,180,184,152,57,103,162,199,58,128,129,247,202,147,31,59,140,113,52,154,13,64,2,253,126,15,189,146,190,36,139,60,134,208,80,182,162,100,236,104,249,100,149,129,
+41,181,90,13,140,113,132,81,152,184,199,230,219,110,59,54,108,203,66,20,69,232,170,216,117,190,239,35,142,35,244,122,125,146,141,95,131,95,243,177,180,180,132,126,175,7,161,92,52,205,254,150,82,7,136,207,
+20,191,130,210,42,75,163,209,80,86,75,244,3,169,16,20,179,79,91,46,73,25,99,108,124,28,50,150,152,155,155,5,231,28,99,227,227,232,180,59,234,121,76,99,197,245,60,204,108,216,136,217,3,7,176,184,184,0,166,
+220,163,161,20,157,121,197,129,105,189,69,138,183,162,197,98,217,124,34,217,248,240,107,117,28,60,176,31,51,27,54,226,87,95,255,123,216,185,243,33,124,244,223,254,1,7,246,239,75,174,49,175,167,107,106,
+152,61,120,160,84,62,82,237,244,221,108,181,240,240,67,15,229,79,67,170,96,231,150,114,69,142,162,8,113,28,195,243,72,89,68,22,102,20,71,139,49,134,40,138,208,233,144,133,89,190,13,235,65,153,108,212,25,
+48,78,59,101,166,223,29,233,0,145,50,198,244,204,6,56,174,135,135,31,122,48,57,110,194,85,76,49,237,54,153,31,227,80,243,91,42,55,81,232,255,115,212,27,13,200,56,30,106,105,215,104,182,80,175,215,51,27,
+138,104,164,82,40,106,101,92,24,20,159,87,121,202,234,10,0,211,51,27,112,242,169,103,226,251,223,249,6,162,104,229,114,42,42,42,42,142,118,4,128,183,230,15,174,21,122,120,151,124,43,86,84,84,28,81,108,
+199,73,22,3,21,143,30,63,246,227,175,192,223,252,217,159,227,155,223,186,9,127,253,222,247,162,213,26,195,3,247,223,133,254,42,23,157,195,8,6,44,182,243,164,139,203,99,27,198,148,27,80,167,83,186,48,144,
+82,34,142,34,248,190,143,122,163,129,110,167,131,40,138,176,188,180,152,236,8,168,229,192,148,43,135,227,56,5,119,47,90,52,70,112,28,23,97,98,181,161,23,59,69,57,210,98,222,116,29,50,23,28,197,252,38,182,
+109,131,29,66,172,172,60,142,235,20,202,96,156,35,232,247,212,241,98,61,76,121,104,100,28,103,98,44,13,178,88,144,18,153,0,222,121,200,42,131,174,205,222,167,88,30,45,58,41,240,117,113,17,157,151,39,97,
+150,111,162,173,88,82,11,51,137,32,232,167,139,202,220,162,213,108,63,197,196,42,183,64,163,123,101,229,229,56,14,98,41,149,2,137,1,18,136,194,40,177,120,41,131,1,136,226,8,97,16,40,75,173,108,27,244,216,
+211,125,224,40,43,182,124,223,214,235,13,156,126,230,217,88,152,159,27,168,192,242,107,181,100,17,205,152,138,139,148,81,96,129,234,31,244,1,198,18,43,51,19,206,57,124,191,70,121,50,100,219,167,229,163,
+251,50,237,31,202,167,219,208,239,245,148,18,71,159,51,218,175,20,192,65,64,187,75,74,25,131,113,14,40,197,7,99,12,80,59,67,102,231,36,140,114,204,122,81,249,44,231,102,104,82,50,132,32,101,12,215,243,
+32,227,24,189,94,55,233,147,201,169,25,216,142,141,118,178,75,36,41,246,180,66,163,211,233,100,250,158,115,158,184,239,185,174,135,197,197,5,56,142,173,172,177,82,55,56,19,150,4,139,39,242,245,230,156,
+172,12,243,207,63,146,151,68,24,133,136,194,16,203,75,75,112,125,15,75,75,11,184,253,182,155,212,248,161,114,117,249,82,198,240,107,164,116,29,244,35,8,51,98,249,117,59,237,92,221,210,58,196,177,84,193,
+249,201,173,86,143,237,48,76,251,45,138,163,76,220,188,210,49,112,152,100,199,68,14,21,60,159,238,151,205,199,24,131,140,35,245,163,71,249,179,56,185,116,64,140,192,153,141,155,192,57,5,236,215,27,173,
+152,223,189,122,204,244,251,61,195,122,116,208,192,4,250,189,174,241,253,46,1,21,99,141,49,70,227,31,128,235,122,232,247,123,165,237,214,115,177,172,174,154,126,208,199,193,253,251,148,130,90,247,71,197,
+137,128,227,186,234,71,27,114,203,175,168,56,94,168,158,100,21,21,199,48,163,99,227,24,25,29,195,3,247,221,147,63,85,241,8,242,243,191,252,91,248,217,159,252,41,124,240,35,31,134,109,59,248,204,167,63,
+140,123,239,190,51,159,109,85,232,95,235,139,139,151,236,175,179,131,208,249,134,229,57,22,32,133,81,218,6,122,121,103,176,29,59,89,60,10,21,200,184,51,228,87,110,77,190,60,243,152,94,24,14,202,167,143,
+163,68,174,131,242,151,193,148,213,215,74,10,73,114,45,43,95,96,161,36,72,123,30,29,184,60,43,191,242,250,235,115,101,199,87,131,46,215,140,87,131,92,160,97,93,118,186,152,203,46,196,180,171,149,86,124,
+172,132,101,91,136,35,51,238,86,246,53,70,26,150,92,101,237,26,166,196,26,132,57,70,210,99,249,49,74,237,43,203,103,146,175,147,169,64,48,177,109,91,41,88,3,108,220,188,21,15,61,112,159,82,242,164,247,
+173,215,235,232,247,3,21,135,76,197,48,74,220,38,179,148,181,65,147,151,87,190,45,249,207,195,208,115,21,170,111,37,0,89,98,97,68,121,139,253,173,231,100,126,156,164,164,139,124,168,50,168,63,83,203,28,
+243,239,252,103,169,98,61,229,159,177,66,8,212,106,117,244,250,61,4,125,82,120,167,245,76,235,98,202,209,247,107,136,162,16,61,101,41,246,216,243,46,4,231,28,55,252,224,187,137,204,200,77,44,221,85,49,
+138,226,161,10,55,203,182,224,58,110,38,118,150,137,217,22,250,190,32,165,96,153,44,177,130,172,53,197,113,92,28,167,195,48,199,100,25,131,250,229,145,38,219,159,131,198,87,138,217,166,70,163,137,45,219,
+78,194,61,119,223,145,88,236,50,206,96,9,43,113,45,31,212,182,188,124,135,201,10,70,57,52,78,138,207,76,141,89,206,204,134,141,24,29,155,192,29,183,221,156,201,163,25,54,255,143,70,60,207,131,231,215,48,
+55,123,48,127,170,98,149,76,77,207,96,108,124,18,247,221,115,103,225,71,188,138,138,99,153,117,177,192,170,56,58,241,253,26,166,103,102,10,46,53,21,199,15,189,94,23,237,246,114,178,104,172,120,116,248,
+193,247,190,129,235,62,249,49,76,78,79,163,219,237,224,235,95,253,159,124,150,132,90,173,14,223,175,37,174,60,204,112,55,129,90,144,108,221,126,50,245,171,90,132,166,49,103,232,151,111,199,113,176,253,
+164,83,177,176,48,87,242,66,74,99,97,203,182,147,112,254,133,151,96,247,174,135,143,216,248,160,186,175,254,119,16,215,243,160,127,33,247,107,53,180,70,70,74,149,79,233,34,32,95,46,93,103,9,43,177,188,
+242,60,31,174,231,13,117,115,75,23,159,84,158,235,121,24,29,29,67,187,157,90,89,248,190,15,199,117,75,131,158,167,11,14,82,140,216,142,157,180,195,172,163,16,66,197,87,25,180,80,160,197,108,153,181,13,
+212,2,67,199,148,33,55,41,148,200,128,130,142,187,158,63,176,205,113,28,195,175,249,96,32,171,18,168,133,144,30,67,36,95,179,220,226,61,44,203,42,44,240,243,232,58,146,108,104,23,52,64,66,8,1,215,243,224,
+186,46,250,106,161,71,241,201,202,23,237,36,70,137,90,173,142,40,10,75,243,152,144,117,139,204,44,234,164,148,105,28,52,67,57,193,5,7,144,181,20,114,28,135,2,165,43,37,136,148,42,230,146,160,216,98,131,
+98,135,65,141,5,91,197,108,138,99,173,52,208,21,206,86,220,178,108,248,181,26,130,128,130,157,3,18,190,239,97,116,108,28,189,94,87,213,95,95,67,127,235,242,152,82,202,196,113,132,151,252,212,107,240,215,
+127,241,87,216,125,96,14,247,223,119,151,10,204,77,174,107,218,34,136,115,14,191,86,67,191,31,0,146,218,109,217,118,70,145,229,184,174,202,147,183,180,130,170,7,197,18,19,194,74,92,141,210,231,19,201,169,
+209,108,226,133,63,241,74,108,217,118,18,118,239,218,145,88,228,152,164,243,87,45,190,213,56,102,156,27,34,74,101,102,42,135,160,230,65,217,130,93,8,145,140,33,41,99,212,106,53,114,115,85,113,161,72,9,
+152,90,26,152,229,218,14,197,173,18,150,5,87,89,100,106,89,215,235,13,140,140,142,130,115,129,110,143,2,192,235,75,185,17,152,93,151,169,173,221,56,231,202,186,179,159,140,201,51,206,122,44,246,237,221,
+141,185,217,131,96,74,49,201,149,11,100,164,54,8,24,25,27,69,191,215,87,227,39,219,78,221,150,48,10,7,238,254,103,94,163,173,193,244,15,31,101,232,113,62,12,115,126,232,177,176,54,202,243,235,231,101,28,
+199,112,93,7,158,231,175,106,142,31,41,82,89,12,151,7,144,42,219,166,166,167,81,175,55,176,117,219,73,56,176,127,31,218,203,75,137,245,25,164,142,135,55,92,198,140,209,143,47,12,52,126,117,254,172,220,
+117,222,124,95,22,203,213,207,19,147,102,107,4,190,95,59,110,98,4,219,182,3,206,88,169,219,115,197,234,232,118,58,56,120,96,127,233,251,70,69,197,177,76,254,41,89,113,156,112,202,105,103,224,7,223,253,
+17,110,185,225,102,60,225,170,167,230,79,87,28,39,72,41,209,239,245,86,252,53,175,226,200,51,123,240,0,62,241,241,127,193,71,255,245,125,249,83,25,108,199,70,115,100,52,249,44,85,128,93,77,28,75,236,219,
+187,59,179,240,140,99,153,44,102,104,97,27,99,223,190,221,133,133,163,134,49,142,249,217,131,216,241,208,253,56,237,244,179,208,26,25,201,103,89,19,230,11,53,45,104,179,65,169,243,159,7,97,91,118,242,55,
+103,28,174,91,12,62,142,228,229,156,202,165,69,107,90,246,242,210,18,150,151,151,192,148,75,31,45,10,237,129,129,208,203,230,134,80,65,148,169,12,229,10,195,185,218,1,170,136,89,134,101,89,168,213,234,
+165,139,21,82,166,145,59,88,25,218,194,67,12,88,108,10,21,243,200,175,213,200,237,176,120,11,0,64,95,237,176,102,162,119,178,210,180,90,163,240,252,84,190,90,86,234,83,162,40,43,131,169,0,194,150,101,171,
+128,213,69,56,231,24,27,159,72,202,49,101,148,88,141,228,22,254,249,58,155,80,31,144,187,231,234,73,23,218,140,145,91,143,212,46,155,234,214,121,203,31,0,232,118,187,136,194,16,92,8,114,223,83,202,15,33,
+196,138,247,23,150,128,235,185,137,188,203,198,151,134,148,205,110,198,141,44,8,2,116,187,29,56,142,147,4,239,54,199,146,46,47,93,60,111,192,19,46,191,26,59,119,237,7,0,52,155,173,36,15,231,164,76,131,
+10,234,174,21,154,82,198,144,177,44,196,205,145,70,160,122,36,177,175,82,232,217,146,110,76,192,148,107,18,41,72,168,142,39,159,122,6,94,254,19,175,192,248,248,52,54,109,222,90,162,224,33,43,67,64,239,
+222,168,207,177,210,190,128,174,175,33,71,33,104,247,62,215,53,251,66,194,117,73,241,168,101,211,239,7,74,201,23,171,32,254,217,57,96,150,107,9,218,224,193,182,108,132,137,181,82,170,232,210,115,131,25,
+74,100,42,67,215,153,148,30,113,76,241,160,180,60,116,220,48,125,221,13,215,127,7,247,223,123,79,246,249,152,252,69,238,187,58,190,214,160,103,102,217,179,101,16,174,231,193,247,107,3,159,127,135,67,126,
+124,12,195,117,93,92,120,209,101,56,251,156,243,51,27,9,216,142,13,199,166,64,228,97,24,82,160,120,213,135,199,2,83,211,211,184,248,178,43,113,229,213,215,96,124,98,10,11,11,115,244,140,246,253,53,183,
+193,182,172,204,243,165,108,220,155,99,79,8,14,199,117,10,223,3,131,238,107,219,14,162,33,202,247,99,141,78,167,141,5,99,247,249,138,181,19,39,49,33,43,42,142,47,138,170,255,138,99,158,147,78,57,13,95,
+252,252,151,112,242,105,155,1,0,253,78,15,127,243,247,31,193,187,254,242,173,3,3,87,86,84,84,28,29,104,165,138,254,219,196,92,244,232,191,7,189,204,106,60,207,67,24,81,188,157,245,34,95,47,147,149,234,
+51,58,54,142,229,229,165,36,166,79,89,27,152,138,93,101,110,27,239,184,174,250,53,150,2,61,155,114,24,84,206,74,232,107,242,50,31,86,142,185,229,121,30,198,104,39,61,191,230,99,113,97,177,80,142,86,148,
+172,100,202,191,214,141,81,152,177,93,58,83,22,51,230,162,188,12,46,4,226,40,74,254,207,83,171,215,209,239,209,46,119,101,245,224,156,99,116,108,28,139,139,11,133,248,76,121,121,66,245,147,222,237,45,142,
+181,114,35,59,150,164,140,33,114,1,187,7,147,127,117,49,149,40,212,254,50,247,43,199,117,16,6,164,248,128,97,105,182,210,75,190,80,110,157,164,80,37,69,198,74,215,192,104,95,179,213,68,183,219,77,198,141,
+231,251,176,44,107,104,16,247,137,201,73,60,233,105,207,193,221,119,220,140,157,15,63,136,125,123,247,38,245,128,82,102,213,234,13,236,217,189,51,185,38,63,126,201,242,141,23,226,91,57,174,139,70,163,137,
+131,7,72,49,134,66,191,49,52,91,45,44,47,45,33,82,10,159,90,173,134,107,159,243,98,236,217,189,3,223,252,218,151,224,186,110,105,140,62,234,67,234,99,179,127,203,96,202,69,202,84,198,115,206,209,104,182,
+16,69,20,231,73,151,65,241,211,116,28,58,168,49,64,241,175,106,245,58,226,40,70,187,189,156,148,163,209,237,210,202,54,93,183,209,209,49,72,72,204,207,165,59,161,142,141,79,160,223,235,41,37,57,197,227,
+147,177,84,214,154,164,132,157,154,222,128,133,249,89,116,58,20,168,222,84,80,166,138,176,180,221,186,222,26,178,216,41,202,69,207,17,199,113,208,235,117,115,227,151,148,206,166,85,22,99,164,52,143,227,
+8,97,24,33,12,211,29,59,15,21,115,236,152,99,109,37,78,61,253,76,188,229,119,255,20,66,8,188,227,157,191,139,91,110,186,1,80,99,52,12,131,76,252,173,195,173,227,145,196,28,179,82,198,24,27,159,192,19,174,
+122,26,0,96,255,190,61,184,233,134,239,33,140,34,248,134,107,219,160,246,228,199,191,237,216,16,67,98,145,121,158,7,97,165,214,197,182,227,192,115,61,44,229,54,219,40,123,30,155,117,174,168,168,168,56,
+222,169,92,8,143,51,56,231,248,135,255,239,163,120,252,19,206,75,142,9,219,194,227,47,191,0,63,186,245,62,220,248,195,239,102,242,87,28,121,90,173,17,92,112,209,101,88,92,152,87,110,35,171,195,118,156,
+36,86,75,197,137,4,185,15,229,173,50,88,193,69,65,187,222,20,23,233,38,161,17,80,119,61,24,244,178,174,25,86,39,198,56,152,138,215,162,23,113,229,47,220,228,18,163,215,124,218,186,129,169,128,202,58,79,
+94,86,131,238,77,150,63,101,231,200,237,76,38,219,204,15,170,15,97,59,14,38,38,166,176,188,180,56,80,166,113,76,187,116,209,130,53,123,63,57,96,199,170,60,148,39,95,215,97,164,214,85,66,112,8,49,60,70,
+22,84,93,0,36,219,184,231,239,167,149,10,131,235,203,208,85,59,177,21,101,155,253,91,247,11,41,4,26,202,133,77,221,223,178,32,44,129,40,162,109,228,169,94,43,41,175,8,83,41,144,157,27,40,117,81,146,50,
+6,103,28,177,161,48,137,19,119,196,148,212,186,138,220,244,26,141,38,98,25,35,82,22,36,182,101,21,148,144,52,47,210,114,252,90,13,12,44,113,105,115,28,151,130,231,171,126,137,34,10,118,45,165,36,203,61,
+215,43,40,153,198,198,38,176,188,188,136,155,110,188,30,237,229,101,114,123,84,109,165,190,137,208,235,117,115,223,17,217,182,88,182,141,137,201,41,116,59,221,76,95,10,203,42,236,198,72,207,152,228,35,
+108,219,65,24,234,96,255,18,174,235,162,219,109,227,198,235,191,139,88,181,69,74,178,120,51,221,46,105,46,165,125,110,162,159,101,89,178,227,135,174,7,122,221,174,81,86,89,159,166,245,237,245,40,104,118,
+25,212,46,186,7,61,119,82,247,45,221,14,157,15,144,137,203,146,238,27,25,199,137,203,161,190,38,72,2,244,103,199,94,106,145,150,142,227,108,27,168,17,69,25,164,253,170,229,154,135,206,155,159,211,231,123,
+234,142,152,150,91,38,107,122,190,21,251,37,37,219,15,101,8,33,50,231,108,199,193,121,23,94,130,39,92,113,21,190,253,189,111,227,59,223,250,10,150,151,151,96,89,54,194,40,84,241,196,116,187,7,127,127,148,
+213,141,113,237,119,108,214,55,255,217,100,216,185,225,164,207,126,26,239,0,16,6,1,246,237,221,141,249,185,131,216,189,235,33,204,207,205,33,10,67,116,187,166,18,170,40,79,93,150,62,206,213,238,134,65,
+24,22,198,187,38,138,98,132,201,46,129,52,206,6,187,251,230,161,57,83,81,113,56,48,181,43,172,227,22,55,190,169,168,56,154,168,20,88,199,25,140,49,156,255,184,43,112,229,19,46,202,159,194,185,103,157,131,
+143,126,252,35,88,94,30,190,117,122,197,250,49,50,50,138,199,95,245,84,236,219,187,27,187,119,238,24,178,24,44,98,89,22,44,33,170,47,145,99,8,178,118,24,20,255,104,48,190,95,203,236,148,103,190,12,231,
+95,132,161,94,134,235,141,70,102,39,185,60,150,101,163,94,111,148,198,116,58,28,242,47,234,121,134,41,128,0,90,156,233,121,160,227,189,104,101,22,84,12,30,174,2,90,155,247,138,194,208,88,104,154,202,130,
+252,226,129,44,21,116,63,112,21,27,136,100,75,215,88,150,5,199,165,221,7,165,148,137,91,199,176,216,71,0,0,181,99,92,175,75,202,0,243,62,38,107,81,64,229,21,31,131,208,214,91,186,77,249,123,106,164,138,
+147,86,171,213,210,221,193,84,249,141,70,179,240,60,17,92,91,60,165,229,209,66,157,172,180,152,42,179,8,201,93,159,50,239,83,132,142,75,181,131,164,94,208,235,107,104,183,57,83,14,195,199,24,193,146,152,
+58,150,101,33,8,250,96,106,151,67,141,148,49,185,224,24,125,171,99,6,13,130,49,6,207,243,84,16,124,117,80,198,232,245,72,233,102,89,22,181,163,160,244,203,150,169,199,181,30,235,253,126,79,245,77,154,79,
+255,109,219,180,49,65,94,233,216,237,118,177,123,215,195,128,86,170,169,252,186,204,88,197,85,130,234,179,122,163,174,172,233,210,190,16,42,70,84,183,155,253,241,36,50,92,5,53,76,89,16,50,101,21,213,239,
+211,206,142,154,32,8,176,127,223,94,213,127,169,162,166,44,166,27,245,47,0,176,140,18,66,31,203,99,142,7,198,88,50,55,245,185,52,31,185,113,66,41,185,0,45,150,242,62,53,21,38,233,124,165,207,65,208,79,
+20,83,156,83,28,188,126,159,172,14,45,229,238,197,25,197,213,210,150,79,36,151,94,50,47,204,185,168,255,214,227,27,74,17,175,219,198,24,109,86,96,171,77,24,204,118,173,140,142,189,53,232,26,150,145,171,
+148,49,234,245,6,192,232,217,201,24,131,80,113,209,24,163,29,60,205,178,180,242,104,37,24,163,50,204,254,150,113,140,115,207,191,8,237,110,31,95,252,159,79,97,199,142,7,193,133,128,109,145,85,104,126,158,
+80,31,100,149,85,244,204,162,248,144,253,126,47,25,43,150,109,211,92,82,129,239,181,27,169,150,63,212,243,158,20,68,116,76,143,189,172,229,219,32,185,17,101,223,91,190,239,195,182,29,204,207,207,97,110,
+246,32,218,37,241,26,53,197,126,209,247,213,237,85,207,12,117,88,143,15,19,198,244,46,161,249,178,242,20,251,137,37,202,255,71,22,243,57,80,113,236,99,126,167,102,149,180,21,21,71,23,149,2,235,56,67,74,
+137,31,254,240,219,120,246,181,47,196,244,204,120,230,220,248,196,8,110,187,107,39,110,184,254,219,153,227,21,71,14,207,243,176,176,48,135,123,238,188,125,77,202,43,12,88,96,84,28,221,52,155,45,184,158,
+191,230,47,254,201,169,105,216,142,157,196,118,50,209,47,135,230,139,190,235,121,216,178,245,36,204,207,205,37,129,164,243,47,145,205,86,11,147,211,51,235,190,131,79,241,69,221,92,252,172,237,37,150,94,
+234,83,75,172,122,189,129,145,177,49,116,187,221,76,188,156,84,137,167,22,131,156,22,107,180,80,33,165,133,126,119,23,130,130,38,67,45,36,165,76,21,90,218,85,174,53,50,138,214,200,24,22,23,230,105,193,
+163,226,31,69,3,230,155,237,56,137,226,165,211,110,39,115,121,116,108,28,76,45,236,87,130,20,3,89,101,151,16,2,182,227,12,188,175,137,110,11,84,253,93,199,29,24,220,86,168,32,234,100,61,67,50,105,182,70,
+208,15,72,33,161,203,161,133,108,54,14,11,65,121,44,203,82,214,107,122,177,72,8,33,0,164,139,208,116,124,230,23,100,164,8,179,29,82,34,209,53,148,71,8,129,122,163,142,80,89,178,8,65,125,171,111,195,24,
+37,130,14,154,86,121,82,198,112,93,15,156,211,98,60,12,67,88,150,128,235,186,144,134,18,145,22,236,122,238,228,235,71,10,212,252,241,56,138,224,122,169,197,20,41,27,232,28,89,15,82,76,168,84,142,44,167,
+128,35,165,65,254,153,111,42,107,179,242,98,176,109,11,161,10,206,174,45,6,211,64,234,12,19,147,83,8,131,32,177,200,200,223,207,245,92,76,76,76,97,105,113,33,115,223,40,138,208,237,116,192,57,41,30,44,
+219,30,56,222,24,99,112,92,39,163,120,163,227,116,47,45,71,243,25,197,57,47,184,39,167,231,41,63,87,253,42,101,76,99,129,105,133,98,58,118,24,163,113,74,34,77,231,54,201,35,157,227,140,145,194,159,233,
+152,103,146,202,24,140,62,47,209,104,52,97,219,54,122,189,110,82,190,110,19,231,52,224,244,110,129,142,227,192,245,124,44,46,204,35,138,226,196,130,70,74,9,219,113,232,185,193,24,89,214,41,203,46,40,25,
+82,157,178,229,67,197,134,179,108,11,190,95,67,24,69,3,99,130,149,33,4,5,141,207,143,213,146,199,49,160,242,211,14,150,97,114,31,215,117,224,216,14,160,126,72,48,235,102,59,54,89,39,174,248,158,98,198,
+210,35,24,227,216,179,251,97,220,114,243,245,120,232,129,251,17,6,33,185,195,9,97,88,240,153,144,12,245,124,160,50,72,193,198,185,72,44,208,56,103,112,29,23,12,72,230,134,227,184,136,147,184,145,84,174,
+239,251,100,73,10,82,166,233,242,138,109,41,10,43,85,164,101,231,147,16,2,205,214,8,162,40,66,16,144,21,165,137,153,63,255,157,157,127,158,166,243,38,127,255,162,92,210,255,203,21,125,80,229,100,199,111,
+42,139,71,26,173,80,204,143,137,138,99,147,40,138,208,237,118,215,252,14,91,81,241,72,83,41,176,134,144,255,66,59,22,96,140,163,211,94,198,87,190,254,85,252,220,43,126,6,150,67,65,56,239,191,231,97,252,
+211,191,124,10,251,14,236,197,173,183,252,112,224,11,108,197,250,210,235,117,177,48,159,198,215,168,56,190,233,245,186,216,176,105,51,24,211,238,85,43,195,24,199,210,226,66,169,242,74,163,95,100,245,11,
+107,20,134,152,61,184,95,61,159,138,47,182,128,68,208,239,103,226,219,172,31,250,101,217,76,135,135,174,55,231,12,253,94,95,185,218,22,203,79,94,226,115,183,36,249,164,159,99,229,162,72,231,82,11,8,178,
+234,226,232,117,187,88,90,92,72,100,21,71,17,226,40,198,200,232,40,130,156,213,9,148,133,76,28,21,23,58,97,16,194,178,236,130,235,151,101,209,174,91,38,186,238,102,217,82,202,164,220,60,73,91,7,32,132,
+85,26,135,11,170,220,126,175,167,148,59,180,216,59,229,180,51,176,103,247,46,196,113,26,11,72,143,169,178,251,67,187,185,25,22,61,169,245,17,41,156,178,11,234,180,12,203,178,64,230,16,0,64,113,131,244,
+117,250,190,92,8,90,96,39,174,88,169,66,72,43,9,88,110,17,202,121,186,11,29,99,100,65,19,199,228,230,23,42,75,26,219,113,193,32,19,203,154,48,12,84,144,107,82,180,152,227,129,49,70,59,245,41,107,42,243,
+156,140,165,225,174,154,37,29,111,84,95,146,161,41,163,244,28,212,98,216,247,125,181,8,167,5,174,217,189,82,146,165,148,182,14,211,202,17,93,6,231,60,137,139,147,151,119,189,209,64,171,53,130,165,197,165,
+196,181,181,236,221,69,170,93,30,155,173,22,218,203,237,204,121,198,24,154,205,22,192,128,64,89,32,153,232,186,216,14,237,10,166,149,79,150,69,138,210,188,2,55,63,118,117,149,25,99,100,61,149,40,63,245,
+241,108,190,236,162,157,20,208,182,227,64,42,197,90,20,69,176,108,11,210,136,165,54,12,198,56,26,13,178,70,234,246,186,20,251,205,176,212,131,146,143,182,84,210,202,67,173,232,162,50,200,122,170,213,106,
+129,51,142,110,183,11,191,86,195,200,200,24,92,215,193,242,242,50,164,148,104,54,91,104,52,27,144,50,70,24,70,74,113,151,42,32,162,48,74,218,75,115,127,117,148,41,146,161,126,168,16,66,144,85,152,42,88,
+43,10,93,215,203,236,242,26,4,1,108,199,38,43,88,195,194,85,202,24,245,90,29,188,36,62,31,231,249,121,158,82,175,215,113,230,99,206,193,210,226,2,22,23,23,208,235,118,225,215,200,138,173,223,239,33,138,
+194,228,25,164,203,210,22,182,174,154,223,52,79,169,30,97,24,36,214,87,80,50,15,195,80,41,144,0,128,62,155,63,78,64,89,166,149,41,140,245,53,217,255,83,164,178,250,154,156,154,78,118,235,214,115,135,27,
+150,187,174,235,194,243,253,76,8,8,82,170,146,92,242,227,61,63,247,152,178,36,163,221,47,201,82,180,44,159,137,174,199,196,228,20,152,110,247,64,6,151,115,164,105,182,70,18,23,219,99,17,33,4,70,199,39,
+192,212,247,221,216,196,4,162,136,230,71,69,69,197,209,203,49,169,192,98,140,195,175,249,153,95,253,202,94,216,14,151,141,155,55,227,236,115,46,192,195,59,30,0,114,247,96,140,225,113,151,92,142,169,153,
+13,153,0,170,143,54,76,253,146,185,111,239,30,124,238,11,95,198,232,200,86,184,150,141,55,253,254,91,241,193,247,255,13,110,186,241,123,171,94,88,87,84,84,172,29,97,9,60,245,154,231,225,224,129,189,88,
+90,26,28,160,57,37,93,56,15,35,127,94,191,188,103,143,145,165,64,186,0,200,156,62,138,161,69,64,24,6,42,16,49,83,214,18,244,194,15,227,249,75,237,206,254,58,93,148,131,249,93,64,10,170,116,81,158,46,56,
+178,139,95,137,209,209,49,180,90,163,201,98,70,147,46,108,233,222,26,173,200,169,55,154,232,41,23,45,33,4,234,245,58,44,219,206,4,55,79,23,92,249,239,171,242,239,173,124,127,155,68,97,152,4,108,23,130,
+147,21,87,65,233,64,214,44,182,99,227,103,95,243,122,60,230,236,11,112,224,192,110,156,126,230,217,248,141,55,254,1,118,237,222,129,61,187,118,26,237,26,6,157,55,229,42,165,196,246,147,79,133,148,50,105,
+187,134,226,106,169,221,29,153,105,73,148,198,24,139,85,124,23,215,115,81,171,213,17,4,125,165,152,34,165,146,76,220,227,210,5,168,86,184,81,53,180,18,138,206,134,97,136,56,142,16,36,1,218,245,28,96,228,
+98,216,167,242,243,232,190,53,229,29,171,152,66,80,253,89,171,213,50,202,163,52,111,118,156,33,145,81,90,47,130,161,53,50,2,198,88,198,165,87,247,159,148,164,140,163,58,155,247,32,229,28,201,82,223,43,
+219,95,155,183,108,67,28,199,88,90,92,80,139,105,114,135,211,117,181,109,82,24,0,64,20,133,202,130,176,184,56,107,141,140,192,182,109,180,151,139,65,208,147,182,169,254,212,10,208,72,41,138,125,223,207,
+45,96,101,38,101,100,27,105,217,166,74,68,178,208,75,21,99,217,114,64,227,216,8,182,47,37,197,174,227,74,193,49,12,61,230,124,191,6,41,165,114,165,212,177,239,76,151,78,234,179,116,76,49,35,169,249,27,
+199,16,156,172,138,162,40,166,182,68,122,204,153,177,141,116,108,45,146,179,101,211,110,158,90,89,19,40,165,109,254,185,53,140,108,93,245,177,24,158,239,131,49,134,94,47,85,96,49,70,90,94,218,161,56,205,
+111,222,219,236,19,253,103,107,116,20,221,78,167,48,207,243,99,46,129,49,180,151,150,208,110,147,242,142,49,134,88,41,2,161,174,213,74,37,221,15,181,122,13,156,83,125,131,32,107,5,166,199,131,70,74,74,
+121,210,99,70,223,228,118,243,77,161,62,212,207,142,44,18,182,77,22,135,253,94,86,177,36,37,5,238,15,130,62,184,224,24,25,29,199,162,177,35,158,217,31,217,58,23,149,104,76,89,182,49,78,238,201,253,190,
+190,87,89,125,9,166,20,250,58,12,128,30,75,38,250,251,239,72,172,127,86,75,20,83,44,191,114,229,225,209,13,99,28,66,185,10,147,117,50,205,239,190,114,247,174,168,168,56,122,25,254,4,61,74,177,44,11,35,
+99,227,56,184,127,127,242,101,81,171,211,175,71,195,118,244,89,43,190,239,227,204,179,207,69,28,75,236,220,241,0,246,239,219,139,122,163,129,87,189,250,13,216,184,97,19,174,187,238,67,216,183,103,23,182,
+110,63,5,223,250,250,151,143,154,7,30,125,153,165,95,164,167,156,118,6,22,230,103,177,127,223,190,92,206,138,138,138,245,66,47,28,227,56,198,147,159,254,108,220,126,235,141,216,185,227,161,124,182,129,
+232,121,11,53,119,233,215,221,244,179,153,71,88,180,115,92,254,145,67,47,199,189,204,238,85,101,47,212,199,2,19,147,147,8,250,1,22,141,103,58,231,230,118,247,244,210,46,74,118,230,42,91,236,153,202,19,
+19,223,175,33,8,3,132,65,128,153,13,27,81,171,55,112,223,61,119,101,242,104,185,155,247,215,248,190,143,230,200,40,246,237,217,157,220,115,100,116,12,140,49,204,205,30,132,237,56,133,93,250,76,210,197,
+79,214,42,101,53,104,69,2,203,45,228,245,226,7,0,182,159,124,10,174,255,246,247,208,26,109,226,206,219,31,192,201,39,111,66,28,199,184,236,137,79,76,118,10,211,215,64,45,204,86,3,99,28,91,182,109,195,236,
+193,131,88,50,20,126,90,206,230,255,208,46,90,202,141,74,35,101,140,233,153,13,136,162,16,7,15,28,80,215,43,171,168,40,202,244,43,84,25,122,81,156,159,47,102,255,50,229,186,104,206,31,51,191,73,94,230,
+249,239,79,189,91,95,217,110,139,195,112,61,15,130,11,116,58,157,100,62,11,165,72,211,187,49,146,69,96,218,87,101,228,219,105,194,57,199,232,216,24,5,150,86,227,114,122,102,3,150,151,150,146,88,151,182,
+237,160,86,175,161,219,237,22,20,141,140,49,48,206,225,56,14,234,245,6,122,189,46,218,203,203,133,197,104,94,182,90,73,163,229,234,184,14,250,106,119,208,244,26,114,207,212,138,191,50,249,115,206,32,213,
+28,162,192,216,197,77,78,116,95,50,99,247,64,40,55,90,203,178,214,220,47,131,199,99,26,207,138,250,195,84,118,164,159,179,99,41,175,148,206,246,145,62,38,4,253,159,31,207,229,164,113,179,86,147,95,215,
+71,63,247,136,188,162,102,56,82,198,240,60,15,35,99,227,216,191,119,143,26,151,197,246,28,14,122,12,113,206,1,101,225,152,39,59,198,214,74,190,237,105,249,36,79,138,171,152,158,75,227,229,153,237,205,163,
+229,91,214,175,186,255,205,107,203,228,101,142,3,97,89,232,247,104,188,14,203,171,89,73,38,101,245,59,92,252,90,13,221,78,119,93,203,172,168,200,195,140,221,147,43,42,214,202,49,105,129,69,47,175,244,165,
+147,124,97,43,87,131,252,226,226,112,8,195,16,187,119,61,140,231,253,216,79,226,167,95,241,11,248,209,77,63,192,227,159,248,20,124,240,31,255,26,79,124,194,69,24,31,63,9,123,15,236,71,179,57,130,219,111,
+253,81,254,242,71,17,153,249,242,158,61,120,96,104,240,201,138,138,99,21,203,182,41,72,113,105,188,139,71,22,219,182,113,222,133,23,35,142,34,220,124,227,245,88,92,200,90,241,12,194,243,253,76,16,100,198,
+232,5,210,84,72,216,142,13,203,136,23,98,89,22,38,167,103,208,237,118,18,55,26,223,247,177,121,235,54,204,205,30,76,158,145,80,86,14,71,211,239,20,244,34,190,114,125,58,237,54,250,253,64,5,128,166,99,102,
+31,51,101,9,210,26,25,85,214,59,148,73,88,2,245,90,29,81,68,65,160,203,242,52,91,45,156,118,250,89,56,120,96,63,194,48,196,73,167,156,134,45,91,183,227,190,123,239,198,236,193,3,201,61,52,90,185,67,255,
+103,229,41,165,132,140,179,113,82,244,238,110,76,253,184,146,198,234,41,226,121,30,26,205,150,82,46,164,121,134,201,201,175,213,80,171,213,169,255,75,118,10,180,109,7,35,202,154,194,178,45,92,125,245,179,
+176,101,243,20,38,167,70,97,123,54,254,232,79,223,131,207,124,234,163,176,109,27,126,173,14,75,237,90,56,168,142,121,244,98,106,126,110,182,176,73,128,86,168,165,11,47,250,123,106,102,3,124,223,87,174,
+178,169,60,219,203,75,232,116,186,74,174,0,64,46,178,102,85,164,36,75,183,90,189,174,15,100,172,72,244,255,100,13,215,128,239,249,153,248,96,250,124,158,252,2,205,92,152,250,190,15,207,247,193,25,67,59,
+137,123,70,125,47,6,4,239,55,137,163,24,142,67,207,39,33,68,102,7,194,122,163,169,172,151,104,206,235,120,64,101,187,65,66,89,48,53,154,13,8,206,147,50,116,93,59,237,54,164,148,240,107,53,92,120,209,101,
+120,248,161,7,208,235,209,238,125,80,227,83,7,43,167,29,31,173,140,123,140,227,186,168,215,235,56,120,96,191,138,175,85,246,188,48,199,37,61,179,192,200,85,23,208,22,55,217,107,28,215,133,109,155,155,35,
+20,93,173,164,164,127,2,53,95,166,55,108,196,214,109,39,227,192,126,250,177,141,41,197,140,231,251,128,178,150,211,244,251,125,120,158,167,118,70,204,7,10,31,76,58,102,72,89,165,175,27,25,29,75,148,166,
+164,148,48,235,154,254,157,141,213,102,90,1,166,99,81,39,141,44,81,168,151,35,33,132,133,122,163,65,174,153,253,172,5,85,89,27,245,88,28,84,223,213,192,148,245,235,242,210,98,210,166,148,226,61,243,207,
+166,252,231,50,50,117,44,201,42,101,140,86,107,4,245,70,19,157,246,114,97,172,12,71,247,87,58,118,153,178,236,131,148,176,109,27,158,239,35,142,99,112,165,68,114,108,199,216,173,117,240,189,210,241,82,
+236,87,125,63,150,177,6,46,67,231,33,183,228,52,127,22,150,88,79,154,199,242,247,36,164,140,177,121,235,86,120,158,183,174,27,51,217,182,141,77,91,182,97,126,126,110,149,99,182,162,226,208,96,198,143,28,
+21,21,107,165,92,165,127,12,208,94,94,206,188,132,5,253,254,17,211,226,126,226,223,63,4,206,57,62,242,47,255,1,33,108,188,233,119,222,137,7,238,217,137,23,191,232,41,248,212,117,255,130,135,119,220,159,
+191,164,226,40,97,227,230,45,248,227,119,190,23,191,249,219,111,71,107,100,36,127,186,226,24,71,198,228,194,113,52,188,104,5,65,31,119,221,126,43,230,230,102,243,167,134,50,54,62,129,77,155,183,66,74,10,
+166,109,219,54,54,110,218,146,188,228,74,25,163,230,215,208,104,182,146,151,222,48,8,0,229,110,5,245,11,115,16,4,216,241,208,3,144,74,105,99,190,244,210,66,240,209,127,220,175,229,151,98,93,223,252,47,
+245,102,91,162,40,194,210,210,34,152,114,145,130,146,77,16,244,97,217,182,202,207,224,186,110,114,30,74,94,103,159,251,56,108,218,178,21,147,83,211,184,248,178,171,240,193,127,252,23,156,116,202,169,73,
+30,219,118,104,1,164,22,11,80,214,26,249,250,199,113,140,229,156,219,85,20,69,8,250,20,159,41,12,195,164,46,101,132,97,136,78,39,251,3,195,160,190,98,140,39,187,209,13,11,178,42,85,12,28,168,120,96,190,
+231,98,231,206,253,216,187,103,22,115,251,231,241,95,159,253,56,132,37,16,197,145,178,58,171,23,218,181,18,50,177,252,72,147,121,206,132,49,142,133,185,89,44,46,204,231,218,38,115,139,199,226,66,13,122,
+97,39,4,194,32,64,20,70,16,150,165,118,252,204,231,99,136,163,56,19,171,102,181,56,174,171,226,87,81,221,253,90,29,12,70,96,111,99,28,234,96,232,101,240,36,102,16,141,11,87,149,75,11,81,146,83,123,121,
+137,20,156,74,22,142,227,96,116,116,44,177,212,49,209,115,198,113,156,210,123,10,33,112,230,217,231,224,69,47,249,25,156,122,218,99,192,148,149,160,227,186,104,52,155,144,202,210,139,130,82,183,80,171,
+213,50,215,247,123,253,140,245,27,244,14,184,86,241,94,0,41,99,56,163,54,174,68,156,91,212,235,231,25,12,11,40,122,118,211,223,205,102,11,79,191,246,199,112,233,21,87,81,188,45,101,209,10,0,34,119,63,41,
+99,44,204,207,97,105,105,237,139,119,41,99,180,70,70,224,121,244,227,1,192,208,239,245,16,171,239,17,207,243,114,49,178,210,157,238,202,190,107,56,231,176,108,138,55,122,120,208,51,191,215,237,24,74,9,
+153,36,83,153,81,166,216,160,207,229,115,104,176,114,133,200,207,97,147,252,57,166,44,226,204,207,43,145,127,38,232,99,230,113,166,172,47,215,142,217,47,105,101,244,26,33,8,2,44,171,113,34,99,137,48,8,
+84,255,22,149,255,131,24,84,255,65,231,202,144,218,2,77,201,180,12,211,66,117,24,140,113,28,216,183,23,11,133,103,234,225,17,134,17,30,188,255,222,99,62,6,20,99,12,23,94,124,25,46,189,226,170,68,1,126,
+168,48,198,33,196,122,204,239,227,11,253,157,150,167,236,88,25,82,198,71,108,221,94,113,98,144,126,59,86,105,96,106,141,140,202,55,253,206,59,228,133,23,95,46,1,200,231,188,224,37,50,10,67,249,193,15,125,
+90,142,140,142,21,242,87,233,232,72,175,249,197,55,202,56,142,100,28,71,242,215,127,235,15,11,231,171,84,165,71,59,113,206,165,227,56,18,128,100,140,75,33,132,228,156,39,159,203,82,122,158,37,159,25,99,
+73,121,58,229,175,203,223,251,104,78,131,234,158,255,60,40,175,150,71,62,233,243,150,101,201,77,91,182,202,63,121,231,123,229,187,223,251,17,249,107,191,254,251,210,243,125,9,37,67,203,178,165,173,250,
+101,165,84,86,39,157,108,219,145,66,136,194,113,243,218,180,12,234,79,33,132,116,61,47,115,29,23,66,110,216,184,73,142,141,79,72,203,178,10,229,232,50,132,16,210,182,237,228,216,204,134,141,242,142,91,
+239,147,223,252,250,13,242,5,63,254,83,242,43,95,250,190,124,234,53,207,73,242,14,146,147,78,150,101,13,148,67,89,155,205,126,16,66,72,203,178,51,249,116,27,211,246,166,159,1,200,122,189,33,183,110,63,
+169,48,126,61,37,15,157,207,113,93,105,219,105,189,204,50,243,245,48,203,111,54,91,133,246,48,85,87,83,222,58,191,89,214,160,207,102,226,185,190,214,115,53,127,173,110,139,254,219,245,188,76,185,101,117,
+207,151,3,64,206,108,216,36,63,252,225,207,201,155,127,116,151,156,217,176,49,57,87,171,213,228,228,212,180,4,32,39,167,166,101,163,217,92,85,127,51,198,164,101,217,178,213,26,145,142,235,22,238,153,151,
+67,122,60,91,110,62,175,89,62,99,172,32,39,157,206,124,204,57,242,170,39,95,35,47,184,232,50,217,108,182,10,231,215,43,57,174,43,167,102,102,228,248,228,148,180,29,71,50,198,164,16,66,214,235,13,57,50,
+58,150,140,17,221,54,26,203,86,233,243,149,158,23,86,161,207,14,39,233,103,58,99,44,249,155,243,244,251,161,172,30,217,185,149,38,203,178,101,179,53,146,25,115,171,73,105,251,41,213,106,117,89,171,213,
+19,25,94,122,197,85,242,105,207,120,174,172,215,27,5,249,230,199,131,57,15,116,217,217,252,197,249,117,36,211,176,251,231,235,96,89,182,172,213,106,234,243,240,249,163,147,95,171,201,137,201,169,228,179,
+16,66,110,216,180,57,121,198,12,187,223,74,41,127,125,190,172,42,65,218,182,45,191,244,197,239,201,56,142,228,47,252,242,155,10,231,135,37,253,60,208,159,107,181,186,220,188,117,123,33,223,225,166,179,
+206,62,87,158,115,222,133,178,86,79,231,212,209,158,152,241,221,165,191,223,243,231,45,227,253,163,74,85,58,82,233,152,116,33,124,52,232,245,186,248,206,183,190,2,41,99,8,33,176,103,215,14,252,231,127,
+253,55,222,255,190,191,206,4,118,172,56,122,168,215,27,120,235,91,254,4,189,78,31,223,255,193,109,184,228,194,243,241,201,79,95,135,118,187,44,72,109,69,197,163,131,148,230,182,228,82,253,154,60,56,102,
+15,97,90,89,165,191,204,155,191,138,211,47,203,43,187,55,208,125,6,159,211,247,88,137,181,228,93,29,244,61,149,214,63,123,92,99,202,73,183,147,142,101,235,162,219,169,235,24,199,49,46,189,252,42,92,120,
+225,165,248,200,71,254,17,31,255,240,251,225,249,62,198,198,39,176,188,68,65,137,83,87,204,149,200,214,201,68,151,163,41,202,155,234,171,93,147,98,21,164,26,82,130,11,138,117,6,229,102,230,56,46,252,90,
+13,237,118,59,137,219,66,65,186,181,165,10,185,42,145,49,2,89,141,44,46,46,224,206,251,238,199,167,63,243,41,124,225,243,159,198,127,127,225,115,152,159,159,69,163,217,194,210,226,194,170,44,16,202,92,
+160,44,219,46,184,238,58,174,75,109,80,174,101,181,90,29,158,239,39,214,98,217,49,173,5,107,90,114,48,72,213,55,189,110,207,232,79,178,42,210,85,96,204,12,6,94,44,151,49,178,138,73,235,157,206,145,56,113,
+229,203,246,1,205,59,42,59,61,70,80,160,117,115,44,81,166,242,241,158,61,150,151,27,213,5,201,189,200,10,133,54,26,200,207,125,179,253,233,252,166,242,244,223,167,159,249,24,92,112,254,165,248,196,127,
+254,39,70,70,199,176,48,127,16,113,28,97,251,41,167,227,193,251,239,5,84,60,46,203,18,70,128,251,225,72,9,178,228,202,5,103,214,237,206,215,129,254,79,235,38,18,119,231,124,219,85,31,39,86,87,197,243,7,
+246,239,197,254,253,123,48,123,112,63,218,106,103,191,65,232,103,206,32,203,168,97,68,81,132,110,167,67,241,136,212,181,90,198,180,227,35,109,136,97,206,127,125,143,84,14,197,115,69,116,91,243,100,143,
+83,191,103,229,155,82,98,121,165,254,151,82,194,247,107,16,130,220,75,243,117,147,50,70,189,209,4,0,116,187,157,204,249,236,61,179,227,13,202,141,214,220,57,115,102,227,102,76,76,78,99,110,246,32,198,198,
+39,112,237,179,94,12,46,56,126,116,195,247,146,113,162,45,16,205,113,35,132,72,254,214,214,137,66,8,176,220,46,166,233,119,200,145,39,145,99,34,235,172,204,205,122,112,78,27,117,132,1,237,208,73,155,14,
+12,235,115,192,18,2,156,115,21,239,138,242,73,25,163,223,15,212,231,252,181,116,108,88,251,205,239,113,93,127,26,3,43,63,195,79,36,152,138,119,214,14,66,156,113,202,99,240,145,143,255,27,238,187,231,206,
+124,182,129,228,173,207,130,32,64,123,121,169,180,191,133,176,224,186,238,138,155,73,148,97,217,180,35,232,220,220,236,170,190,135,143,14,210,239,84,89,18,190,0,107,176,106,172,168,56,28,202,223,32,42,
+134,114,242,169,167,97,247,206,135,209,169,118,243,59,170,153,154,158,193,87,190,240,13,188,231,159,62,132,111,125,227,11,120,218,211,159,143,239,124,231,43,248,202,23,62,151,207,90,81,177,46,212,27,13,
+184,174,135,131,7,246,231,79,173,137,236,2,54,253,108,34,51,238,8,105,112,113,125,76,88,22,164,36,119,9,147,180,44,138,183,34,149,139,81,25,108,13,46,127,48,226,177,28,202,203,92,25,186,126,43,189,16,233,
+5,146,118,241,43,147,31,99,105,12,45,253,121,114,106,26,167,159,249,88,220,122,211,15,49,59,123,16,27,54,109,134,239,215,112,223,61,119,101,100,190,22,25,172,132,227,186,112,108,7,157,14,41,161,160,148,
+83,158,231,161,189,188,156,40,166,204,123,90,150,5,215,245,224,184,46,186,157,54,186,137,114,135,220,157,108,135,118,210,10,130,32,49,201,55,101,96,42,194,232,28,67,171,53,130,165,165,197,82,183,200,149,
+96,74,225,70,241,130,210,107,109,199,73,98,61,209,253,105,145,110,230,209,227,51,206,5,98,39,178,65,177,105,157,78,193,187,161,218,194,146,205,18,164,114,185,211,187,28,210,194,79,223,171,209,108,34,8,
+130,36,112,185,41,143,122,189,129,56,142,11,174,155,38,164,132,25,46,27,33,196,128,151,248,193,48,70,238,102,245,122,3,237,246,114,161,191,96,180,211,28,191,101,245,96,140,227,226,203,30,15,199,113,177,
+253,164,211,241,198,95,123,29,94,252,210,231,227,193,251,239,69,173,86,199,130,250,113,205,178,40,174,210,210,226,98,102,174,175,230,30,38,186,142,90,254,102,126,221,223,141,102,51,217,17,143,118,193,27,
+254,138,185,154,251,106,242,138,17,172,241,250,65,232,50,116,60,22,61,246,226,152,142,73,21,19,75,203,46,223,239,164,148,209,101,209,152,37,69,4,141,205,244,57,166,21,23,244,234,173,127,132,144,74,89,13,
+0,97,160,159,157,74,153,161,118,209,164,103,121,152,184,54,114,46,32,37,205,181,145,209,49,184,174,139,126,175,87,234,194,238,184,46,24,160,250,37,251,108,212,228,229,40,132,64,189,209,192,226,194,98,114,
+220,85,49,199,182,110,63,5,239,248,163,119,225,179,255,253,57,124,224,31,255,106,197,157,173,205,231,51,140,241,109,206,119,141,57,15,30,9,242,114,48,49,101,181,113,211,102,68,81,4,46,4,70,70,199,176,111,
+207,238,53,125,207,231,229,91,134,217,118,45,163,213,92,179,218,188,39,10,143,164,44,70,199,198,81,111,52,241,240,67,180,91,125,69,69,197,35,67,165,192,170,56,174,169,55,26,73,236,3,0,168,215,235,133,120,
+53,21,235,203,212,244,12,182,108,59,25,123,118,237,192,238,93,59,11,11,142,163,145,83,78,59,19,97,24,96,255,190,61,3,182,145,95,29,173,145,81,248,190,143,61,187,119,229,79,37,139,175,209,177,113,4,253,
+222,208,113,88,246,2,102,190,220,58,142,141,209,177,113,236,223,183,23,80,214,4,83,211,51,0,99,216,183,103,55,0,96,102,195,70,112,46,176,107,231,142,66,25,140,1,92,8,76,79,111,192,210,210,34,22,230,231,
+146,60,135,195,122,42,176,70,71,199,192,132,192,242,210,34,124,191,134,133,249,121,72,25,99,100,116,12,203,75,75,8,195,84,49,167,219,197,57,131,176,44,120,174,135,197,197,116,225,229,121,30,226,56,70,191,
+223,39,101,79,20,21,22,224,180,107,28,71,187,221,78,126,81,141,84,236,32,40,25,155,88,150,173,172,130,210,50,24,227,240,125,95,237,106,24,22,250,16,106,199,53,198,56,186,221,14,226,152,130,239,115,33,208,
+94,110,67,202,24,142,235,194,117,92,196,113,140,229,229,37,88,150,133,177,241,9,44,44,204,23,118,145,3,168,31,153,170,127,24,134,137,66,100,116,108,12,203,203,203,73,61,180,226,72,74,146,147,110,15,83,
+139,117,189,67,30,99,28,140,107,43,170,193,148,141,209,60,230,2,176,53,50,10,206,57,230,102,15,194,178,44,216,182,173,130,111,35,89,172,91,150,5,169,99,188,169,126,107,142,140,98,255,222,61,136,99,138,
+3,229,215,234,180,189,125,191,15,215,117,225,249,53,44,46,204,39,10,4,45,127,93,127,179,157,154,122,189,14,41,101,178,185,73,107,100,4,237,54,197,213,212,138,49,223,175,161,215,239,33,12,130,210,103,152,
+16,2,142,235,162,215,237,150,158,183,109,7,97,24,194,243,92,112,46,208,110,183,147,121,7,73,193,253,59,157,118,178,131,158,86,130,172,70,166,58,143,86,184,0,192,212,244,52,28,215,195,158,93,59,33,13,171,
+78,51,127,190,207,152,82,68,250,126,13,203,203,75,136,227,24,205,86,11,253,126,31,189,110,55,61,95,171,37,202,85,206,57,60,223,71,208,167,88,115,121,124,223,71,183,219,133,239,83,32,253,252,188,209,216,
+182,3,203,18,232,245,122,165,242,43,67,43,123,178,199,86,30,135,38,90,177,100,94,35,132,160,77,17,122,221,68,129,196,24,208,106,141,160,211,161,205,36,0,137,122,163,1,203,178,49,63,55,11,198,24,70,70,199,
+192,57,199,236,193,3,201,248,227,156,129,171,128,252,122,30,233,192,249,81,20,83,236,185,48,2,99,100,129,17,199,49,100,28,195,117,61,196,113,132,158,218,161,78,43,184,160,118,74,5,128,165,165,69,165,88,
+165,128,231,97,24,98,121,121,9,66,8,140,142,141,193,178,236,194,119,143,57,238,205,113,160,142,40,229,92,81,134,148,167,168,128,22,66,224,218,231,188,16,39,159,124,22,62,246,225,127,192,94,245,125,179,
+18,90,238,218,154,209,84,230,149,223,251,200,33,75,126,228,88,13,19,147,83,56,247,130,139,241,240,67,15,224,129,251,239,41,40,159,7,149,101,42,70,205,62,224,156,193,117,189,210,31,195,117,29,7,149,105,
+226,122,30,162,48,92,151,239,221,245,160,217,26,65,167,189,124,212,212,103,173,172,86,238,88,99,222,99,9,75,197,6,204,190,103,21,159,157,121,6,61,55,42,42,214,155,35,251,45,81,81,241,40,99,42,175,0,12,
+85,26,84,172,15,155,183,110,199,139,95,252,74,188,228,39,95,131,77,91,182,229,79,31,149,92,120,209,229,184,236,138,171,113,234,105,103,193,63,140,128,159,81,152,90,124,228,209,11,175,126,175,139,96,133,
+23,187,178,47,126,153,4,188,77,23,29,48,126,213,54,23,195,80,102,239,230,203,7,140,114,165,164,0,248,115,179,7,135,90,161,64,189,144,152,105,24,113,108,186,67,30,30,189,126,15,158,231,161,86,171,39,193,
+181,153,82,252,228,229,147,182,139,172,34,184,16,202,18,34,117,203,243,107,180,131,157,238,135,124,25,180,136,166,157,171,44,219,86,47,112,212,166,178,192,186,180,203,97,177,30,244,146,87,44,31,234,5,48,
+12,35,82,150,168,69,123,16,4,20,44,92,253,150,20,71,17,192,88,178,227,158,231,251,136,162,8,253,30,41,151,242,104,165,139,105,125,5,0,206,255,223,222,181,228,52,12,3,209,231,95,18,218,116,3,133,35,32,36,
+142,201,5,88,112,19,86,44,184,12,8,9,181,27,254,105,84,103,204,98,108,39,78,19,160,18,31,33,245,73,85,163,81,154,186,51,246,164,158,204,155,201,11,152,168,55,14,236,5,176,126,210,107,57,63,30,231,8,50,
+22,28,31,167,179,104,163,99,161,248,49,116,117,64,196,193,143,80,52,59,5,219,168,216,155,96,58,45,225,60,245,79,74,5,99,178,24,28,32,114,80,154,131,3,82,74,212,117,141,44,207,48,153,180,69,232,3,173,176,
+241,122,193,200,134,152,179,182,120,140,85,245,6,21,179,97,184,145,194,170,94,161,177,22,74,235,193,207,3,64,99,155,209,224,139,243,157,19,137,40,206,21,109,140,159,3,107,60,61,62,196,245,42,132,140,25,
+53,99,8,129,212,84,167,237,239,91,46,22,184,187,189,65,211,164,25,149,225,124,182,103,20,3,64,143,182,234,133,46,93,35,220,69,81,131,136,125,14,17,113,17,247,129,130,243,0,80,85,21,178,60,143,116,197,33,
+221,9,33,97,237,154,139,241,111,81,180,187,31,188,98,217,184,206,134,32,37,7,229,18,153,82,216,159,207,99,192,8,158,6,115,112,120,20,59,41,58,231,160,181,137,243,147,136,80,206,102,56,62,57,69,89,114,177,
+252,46,156,227,6,35,240,221,19,121,62,11,8,79,113,21,158,106,27,214,157,109,44,108,226,59,217,88,188,182,219,14,170,240,99,81,90,35,47,138,40,163,78,151,203,46,120,222,105,20,69,218,200,130,209,250,170,
+33,59,245,55,161,194,103,150,93,95,93,226,226,252,108,35,120,21,174,209,247,27,97,227,139,141,7,1,45,101,182,251,250,41,116,215,66,192,54,223,103,140,193,235,203,51,150,139,251,196,215,134,130,240,67,80,
+74,33,203,88,247,93,93,134,227,254,123,23,67,178,62,132,144,158,78,253,249,185,191,133,60,207,147,251,205,95,96,27,187,246,145,54,112,248,24,95,177,209,127,68,240,55,225,190,3,239,59,63,211,141,240,244,
+125,165,55,255,99,236,176,195,119,226,29,225,20,33,126,93,131,20,171,0,0,0,0,73,69,78,68,174,66,96,130 };
+
+const char* bg_png = (const char*) temp_binary_data_0;
+
+
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes);
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
+{
+    unsigned int hash = 0;
+
+    if (resourceNameUTF8 != nullptr)
+        while (*resourceNameUTF8 != 0)
+            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
+
+    switch (hash)
+    {
+        case 0xad13432f:  numBytes = 145816; return bg_png;
+        default: break;
+    }
+
+    numBytes = 0;
+    return nullptr;
+}
+
+const char* namedResourceList[] =
+{
+    "bg_png"
+};
+
+const char* originalFilenames[] =
+{
+    "bg.png"
+};
+
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)
+{
+    for (unsigned int i = 0; i < (sizeof (namedResourceList) / sizeof (namedResourceList[0])); ++i)
+        if (strcmp (namedResourceList[i], resourceNameUTF8) == 0)
+            return originalFilenames[i];
+
+    return nullptr;
+}
+
+}
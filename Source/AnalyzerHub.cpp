@@ -0,0 +1,329 @@
+#include "AnalyzerHub.h"
+
+namespace
+{
+    const AnalyzerQuality qualityLadder[AnalyzerHub::numQualityLevels] =
+    {
+        { 11, 4, 60, std::numeric_limits<int>::max(), "full" },
+        { 11, 2, 30, 8, "reduced" },
+        { 10, 1, 20, 4, "low" },
+        { 9, 1, 10, 1, "minimal" },
+    };
+}
+
+//==============================================================================
+AnalyzerTap::AnalyzerTap(int tapId, const juce::String& tapName)
+    : id(tapId), name(tapName)
+{
+    for (int i = 0; i < numFftOrders; ++i)
+    {
+        auto size = (size_t)1 << (minFftOrder + i);
+        forwardFFTs[(size_t)i] = std::make_unique<juce::dsp::FFT>(minFftOrder + i);
+        windows[(size_t)i] = std::make_unique<juce::dsp::WindowingFunction<float>>(size, juce::dsp::WindowingFunction<float>::blackmanHarris);
+
+        for (int fraction = 1; fraction < OctaveSmoothing::numFractions; ++fraction)
+            smoothers[(size_t)i][(size_t)fraction] = std::make_unique<OctaveSmoothing>((int)size, OctaveSmoothing::getBandsPerOctave(fraction));
+    }
+
+    setQuality(qualityLadder[0]);
+}
+
+void AnalyzerTap::setQuality(const AnalyzerQuality& quality) noexcept
+{
+    frameOrder.store(quality.fftOrder, std::memory_order_relaxed);
+    hopSize.store((1 << quality.fftOrder) / quality.overlap, std::memory_order_relaxed);
+}
+
+void AnalyzerTap::handOverFrame() noexcept
+{
+    streamPosition += samplesSinceFrame;
+    samplesSinceFrame = 0;
+
+    // If the worker hasn't taken the previous frame yet, this one is dropped.
+    if (nextFFTBlockReady.load(std::memory_order_acquire))
+        return;
+
+    auto order = frameOrder.load(std::memory_order_relaxed);
+    auto size = 1 << order;
+
+    // Oldest sample first: the run from the read position to the end of the
+    // ring, then the wrapped part.
+    auto start = (fifoIndex - size) & (fftSize - 1);
+    auto firstPart = juce::jmin(size, fftSize - start);
+
+    std::memcpy(fftData, fifo + start, sizeof(float) * (size_t)firstPart);
+    std::memcpy(fftData + firstPart, fifo, sizeof(float) * (size_t)(size - firstPart));
+    juce::zeromem(fftData + size, sizeof(float) * (size_t)size);
+
+    readyOrder = order;
+    readyPosition = streamPosition;
+    nextFFTBlockReady.store(true, std::memory_order_release);
+}
+
+void AnalyzerTap::drawNextFrameOfSpectrum()
+{
+    auto index = (size_t)(readyOrder - minFftOrder);
+    auto size = 1 << readyOrder;
+
+    windows[index]->multiplyWithWindowingTable(fftData, (size_t)size);
+    forwardFFTs[index]->performFrequencyOnlyForwardTransform(fftData);
+
+    // The detector wants the raw bins, so it goes before the display smoothing.
+    if (detectingResonances.load(std::memory_order_relaxed))
+    {
+        if (! std::exchange(detectorRunning, true))
+            resonanceDetector.reset();
+
+        std::memcpy(detectorBaseline, fftData, sizeof(float) * (size_t)(size / 2 + 1));
+        smoothers[index][OctaveSmoothing::thirdOctave]->process(detectorBaseline);
+        resonanceDetector.process(fftData, detectorBaseline, size, sampleRate.load(std::memory_order_relaxed));
+    }
+    else
+    {
+        detectorRunning = false;
+    }
+
+    if (auto fraction = smoothing.load(std::memory_order_relaxed); fraction > 0)
+        smoothers[index][(size_t)fraction]->process(fftData);
+
+    auto mindB = -100.0f;
+    auto maxdB = 0.0f;
+
+    auto* dest = scopeData[1 - publishedScope.load(std::memory_order_relaxed)];
+
+    for (int i = 0; i < scopeSize; ++i)
+    {
+        auto skewedProportionX = 1.0f - std::exp(std::log(1.0f - (float)i / (float)scopeSize) * 0.2f);
+        auto fftDataIndex = juce::jlimit(0, size / 2, (int)(skewedProportionX * (float)size * 0.5f));
+        auto level = juce::jmap(
+            juce::jlimit(mindB, maxdB,
+                juce::Decibels::gainToDecibels(fftData[fftDataIndex])
+                - juce::Decibels::gainToDecibels((float)size)),
+            mindB, maxdB, 0.0f, 1.0f);
+
+        dest[i] = level;
+    }
+
+    publishedScope.store(1 - publishedScope.load(std::memory_order_relaxed), std::memory_order_release);
+    frameCount.fetch_add(1, std::memory_order_acq_rel);
+
+    if (auto writer = getCapture())
+        writer->append(readyPosition, readyOrder, hopSize.load(std::memory_order_relaxed), dest);
+
+    nextFFTBlockReady.store(false, std::memory_order_release);
+}
+
+int AnalyzerTap::getResonances(ResonanceDetector::Candidate* dest) const noexcept
+{
+    return detectingResonances.load() ? resonanceDetector.getCandidates(dest) : 0;
+}
+
+juce::uint32 AnalyzerTap::copyScopeData(float* dest) const noexcept
+{
+    auto count = frameCount.load(std::memory_order_acquire);
+    std::memcpy(dest, scopeData[publishedScope.load(std::memory_order_acquire)], sizeof(float) * scopeSize);
+    return count;
+}
+
+juce::Result AnalyzerTap::startCapture(const juce::File& file)
+{
+    stopCapture();
+
+    auto order = frameOrder.load(std::memory_order_relaxed);
+    auto writer = std::make_shared<SpectrumCapture::Writer>(file, sampleRate.load(std::memory_order_relaxed),
+        1 << order, hopSize.load(std::memory_order_relaxed), scopeSize);
+
+    if (writer->getStatus().failed())
+        return writer->getStatus();
+
+    const juce::SpinLock::ScopedLockType sl(captureLock);
+    capture = std::move(writer);
+    return juce::Result::ok();
+}
+
+void AnalyzerTap::stopCapture()
+{
+    std::shared_ptr<SpectrumCapture::Writer> writer;
+    {
+        const juce::SpinLock::ScopedLockType sl(captureLock);
+        std::swap(writer, capture);
+    }
+
+    // A worker still holding it writes its last frame when it lets go.
+    if (writer != nullptr)
+        writer->flush();
+}
+
+bool AnalyzerTap::isCapturing() const
+{
+    return getCapture() != nullptr;
+}
+
+juce::File AnalyzerTap::getCaptureFile() const
+{
+    auto writer = getCapture();
+    return writer != nullptr ? writer->getFile() : juce::File();
+}
+
+std::shared_ptr<SpectrumCapture::Writer> AnalyzerTap::getCapture() const
+{
+    const juce::SpinLock::ScopedLockType sl(captureLock);
+    return capture;
+}
+
+void AnalyzerTap::flushCapture()
+{
+    if (auto writer = getCapture())
+        writer->flushIfDue();
+}
+
+//==============================================================================
+AnalyzerHub::AnalyzerHub()
+    : juce::Thread("darQ Analyzer Hub"),
+      pool(getNumWorkers())
+{
+    startThread();
+}
+
+AnalyzerHub::~AnalyzerHub()
+{
+    stopThread(1000);
+    pool.removeAllJobs(true, 1000);
+}
+
+int AnalyzerHub::getNumWorkers()
+{
+    // Leave the remaining cores to the host's audio threads.
+    return juce::jlimit(1, 4, juce::SystemStats::getNumCpus() / 2);
+}
+
+AnalyzerTap::Ptr AnalyzerHub::registerTap()
+{
+    const juce::ScopedLock sl(tapLock);
+
+    auto tapId = nextTapId++;
+    AnalyzerTap::Ptr tap = new AnalyzerTap(tapId, "darQ #" + juce::String(tapId));
+    tap->setQuality(getQuality(getQualityLevel()));
+    taps.add(tap);
+    return tap;
+}
+
+void AnalyzerHub::unregisterTap(AnalyzerTap* tap)
+{
+    // Queued jobs keep their own reference, so the tap outlives any FFT in flight.
+    const juce::ScopedLock sl(tapLock);
+    taps.removeObject(tap);
+}
+
+juce::ReferenceCountedArray<AnalyzerTap> AnalyzerHub::getTaps() const
+{
+    const juce::ScopedLock sl(tapLock);
+    return taps;
+}
+
+AnalyzerTap::Ptr AnalyzerHub::findTap(int tapId) const
+{
+    const juce::ScopedLock sl(tapLock);
+
+    for (auto* tap : taps)
+        if (tap->getId() == tapId)
+            return tap;
+
+    return nullptr;
+}
+
+const AnalyzerQuality& AnalyzerHub::getQuality(int level) noexcept
+{
+    return qualityLadder[juce::jlimit(0, numQualityLevels - 1, level)];
+}
+
+void AnalyzerHub::setLoadThresholds(float stepDown, float stepUp) noexcept
+{
+    jassert(stepUp < stepDown);
+    stepDownLoad.store(stepDown);
+    stepUpLoad.store(juce::jmin(stepUp, stepDown));
+}
+
+void AnalyzerHub::run()
+{
+    while (! threadShouldExit())
+    {
+        updateQuality();
+        scheduleJobs();
+        flushCaptures();
+        wait(1000 / getQuality(getQualityLevel()).frameRateHz);
+    }
+}
+
+void AnalyzerHub::updateQuality()
+{
+    const juce::ScopedLock sl(tapLock);
+
+    auto load = 0.0f;
+    for (auto* tap : taps)
+        load = juce::jmax(load, tap->getCallbackLoad());
+
+    currentLoad.store(load, std::memory_order_relaxed);
+
+    auto level = getQualityLevel();
+    auto elapsedMs = 1000 / getQuality(level).frameRateHz;
+
+    msAboveThreshold = load > stepDownLoad.load() ? msAboveThreshold + elapsedMs : 0;
+    msBelowThreshold = load < stepUpLoad.load() ? msBelowThreshold + elapsedMs : 0;
+
+    auto newLevel = level;
+
+    if (msAboveThreshold >= stepDownAfterMs && level < numQualityLevels - 1)
+        newLevel = level + 1;
+    else if (msBelowThreshold >= stepUpAfterMs && level > 0)
+        newLevel = level - 1;
+
+    if (newLevel == level)
+        return;
+
+    msAboveThreshold = msBelowThreshold = 0;
+    qualityLevel.store(newLevel, std::memory_order_relaxed);
+
+    for (auto* tap : taps)
+        tap->setQuality(getQuality(newLevel));
+}
+
+void AnalyzerHub::flushCaptures()
+{
+    // Captures are written from here in batches, never from the workers.
+    for (auto* tap : getTaps())
+        tap->flushCapture();
+}
+
+void AnalyzerHub::scheduleJobs()
+{
+    const juce::ScopedLock sl(tapLock);
+
+    if (taps.isEmpty())
+        return;
+
+    // Round robin, so a capped level still reaches every tap in turn.
+    auto maxJobs = getQuality(getQualityLevel()).maxTapsPerFrame;
+    auto numTaps = taps.size();
+    auto first = nextTapToSchedule % numTaps;
+    auto scheduled = 0;
+
+    for (int i = 0; i < numTaps && scheduled < maxJobs; ++i)
+    {
+        auto* tap = taps.getUnchecked((first + i) % numTaps);
+
+        if (! tap->isFFTReady() || tap->jobPending.exchange(true))
+            continue;
+
+        ++scheduled;
+        nextTapToSchedule = (first + i + 1) % numTaps;
+
+        AnalyzerTap::Ptr job(tap);
+
+        pool.addJob([job]
+            {
+                job->drawNextFrameOfSpectrum();
+                job->jobPending.store(false);
+            });
+    }
+}
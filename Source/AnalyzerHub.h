@@ -0,0 +1,221 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "OctaveSmoothing.h"
+#include "ResonanceDetector.h"
+#include "SpectrumCapture.h"
+
+//==============================================================================
+/** One step of the analyzer's quality ladder. */
+struct AnalyzerQuality
+{
+    int fftOrder;       // frame length is 1 << fftOrder
+    int overlap;        // frames per frame length
+    int frameRateHz;    // how often the hub schedules FFTs
+    int maxTapsPerFrame;
+    const char* name;
+};
+
+//==============================================================================
+/**
+    One analyzer input registered with the AnalyzerHub.
+
+    The audio thread feeds samples through pushSamples(). Every hop (frame
+    length / overlap) the latest frame is handed to one of the hub's workers,
+    which turns it into a scope frame and publishes it. Editors (of this or any
+    other instance in the process) read the latest frame with copyScopeData().
+
+    Frame length and hop follow the hub's quality level, and the owning
+    processor reports its callback load here for the hub to act on.
+
+    While a capture is running, every published frame is also appended to a
+    SpectrumCapture file; the hub's thread writes it out in batches.
+*/
+class AnalyzerTap : public juce::ReferenceCountedObject
+{
+public:
+    using Ptr = juce::ReferenceCountedObjectPtr<AnalyzerTap>;
+
+    // Full quality; lower levels use the shorter frames down to minFftOrder.
+    static constexpr int fftOrder = 11;
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int minFftOrder = 9;
+    static constexpr int scopeSize = 1024;
+
+    AnalyzerTap(int tapId, const juce::String& tapName);
+
+    int getId() const noexcept { return id; }
+    const juce::String& getName() const noexcept { return name; }
+
+    // Audio thread
+    template <typename SampleType>
+    void pushSamples(const SampleType* samples, int numSamples) noexcept
+    {
+        auto hop = hopSize.load(std::memory_order_relaxed);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            fifo[fifoIndex] = (float)samples[i];
+            fifoIndex = (fifoIndex + 1) & (fftSize - 1);
+
+            if (++samplesSinceFrame >= hop)
+                handOverFrame();
+        }
+    }
+
+    /** Smoothed proportion of the block duration the owner's callback takes. */
+    void setCallbackLoad(float load) noexcept { callbackLoad.store(load, std::memory_order_relaxed); }
+    float getCallbackLoad() const noexcept { return callbackLoad.load(std::memory_order_relaxed); }
+
+    /** Fractional-octave smoothing of published frames, as an
+        OctaveSmoothing fraction (0 is off). Any thread. */
+    void setSmoothing(int fraction) noexcept { smoothing.store(juce::jlimit(0, OctaveSmoothing::numFractions - 1, fraction)); }
+    int getSmoothing() const noexcept { return smoothing.load(); }
+
+    /** Runs a ResonanceDetector on the raw frames. Any thread. */
+    void setResonanceDetection(bool shouldDetect) noexcept { detectingResonances.store(shouldDetect); }
+    bool isDetectingResonances() const noexcept { return detectingResonances.load(); }
+
+    /** Best first, at most ResonanceDetector::maxCandidates; 0 while detection is off. */
+    int getResonances(ResonanceDetector::Candidate* dest) const noexcept;
+
+    /** The owner's sample rate, recorded in capture files. */
+    void setSampleRate(double rate) noexcept { sampleRate.store(rate, std::memory_order_relaxed); }
+    double getSampleRate() const noexcept { return sampleRate.load(std::memory_order_relaxed); }
+
+    // Message thread
+    juce::Result startCapture(const juce::File& file);
+    void stopCapture();
+    bool isCapturing() const;
+    juce::File getCaptureFile() const;
+
+    // Worker thread
+    bool isFFTReady() const noexcept { return nextFFTBlockReady.load(std::memory_order_acquire); }
+    void drawNextFrameOfSpectrum();
+
+    // Any thread. Returns the number of frames published so far, so callers can
+    // skip repaints when nothing new has arrived.
+    juce::uint32 getFrameCount() const noexcept { return frameCount.load(std::memory_order_acquire); }
+    juce::uint32 copyScopeData(float* dest) const noexcept;
+
+private:
+    friend class AnalyzerHub;
+
+    void handOverFrame() noexcept;
+    void setQuality(const AnalyzerQuality& quality) noexcept;
+
+    std::shared_ptr<SpectrumCapture::Writer> getCapture() const;
+    void flushCapture();
+
+    const int id;
+    const juce::String name;
+
+    static constexpr int numFftOrders = fftOrder - minFftOrder + 1;
+    std::array<std::unique_ptr<juce::dsp::FFT>, numFftOrders> forwardFFTs;
+    std::array<std::unique_ptr<juce::dsp::WindowingFunction<float>>, numFftOrders> windows;
+
+    // Band edges for every FFT size and fraction, built up front; index 0 (off) stays empty.
+    std::array<std::array<std::unique_ptr<OctaveSmoothing>, OctaveSmoothing::numFractions>, numFftOrders> smoothers;
+    std::atomic<int> smoothing{ 0 };
+
+    ResonanceDetector resonanceDetector;
+    float detectorBaseline[fftSize / 2 + 1] = {};
+    std::atomic<bool> detectingResonances{ false };
+    bool detectorRunning = false;   // worker side, to reset the tracks on restart
+
+    // Ring of the most recent samples; a frame is the last (1 << order) of them.
+    float fifo[fftSize] = { 0 };
+    float fftData[2 * fftSize] = { 0 };
+    int fifoIndex = 0, samplesSinceFrame = 0;
+    int readyOrder = fftOrder;   // order of the frame in fftData
+    juce::int64 streamPosition = 0, readyPosition = 0;
+    std::atomic<bool> nextFFTBlockReady{ false };
+
+    std::atomic<int> frameOrder{ fftOrder }, hopSize{ fftSize };
+    std::atomic<float> callbackLoad{ 0.0f };
+    std::atomic<double> sampleRate{ 44100.0 };
+
+    // Double-buffered so a reader never sees the frame that is being written.
+    float scopeData[2][scopeSize] = {};
+    std::atomic<int> publishedScope{ 0 };
+    std::atomic<juce::uint32> frameCount{ 0 };
+
+    std::atomic<bool> jobPending{ false };
+
+    // Held by the workers only for as long as it takes to copy the pointer.
+    mutable juce::SpinLock captureLock;
+    std::shared_ptr<SpectrumCapture::Writer> capture;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalyzerTap)
+};
+
+//==============================================================================
+/**
+    Process-wide analyzer service shared by every plugin instance.
+
+    Hold it through a juce::SharedResourcePointer<AnalyzerHub>: the first
+    instance creates it and the last one to go away tears it down. A single
+    scheduler thread polls the registered taps at display rate and queues one
+    FFT job per ready frame on a small worker pool, so the FFT cost no longer
+    lands on the message thread of every open editor.
+
+    The hub also watches the callback load the taps' processors report. When
+    the highest one stays above the step-down threshold it moves one level
+    down the quality ladder (shorter frames, less overlap, lower frame rate,
+    fewer taps per frame); once it has stayed below the step-up threshold for
+    a second it moves back up.
+*/
+class AnalyzerHub : private juce::Thread
+{
+public:
+    AnalyzerHub();
+    ~AnalyzerHub() override;
+
+    AnalyzerTap::Ptr registerTap();
+    void unregisterTap(AnalyzerTap* tap);
+
+    /** Snapshot of the taps currently registered, in registration order. */
+    juce::ReferenceCountedArray<AnalyzerTap> getTaps() const;
+    AnalyzerTap::Ptr findTap(int tapId) const;
+
+    static constexpr int frameRateHz = 60;
+
+    static constexpr int numQualityLevels = 4;
+    static const AnalyzerQuality& getQuality(int level) noexcept;
+
+    /** 0 is full quality. */
+    int getQualityLevel() const noexcept { return qualityLevel.load(std::memory_order_relaxed); }
+
+    /** Highest callback load reported by any tap, as last seen by the hub. */
+    float getLoad() const noexcept { return currentLoad.load(std::memory_order_relaxed); }
+
+    /** Loads are proportions of the block duration; stepUp must be below stepDown. */
+    void setLoadThresholds(float stepDown, float stepUp) noexcept;
+
+    static constexpr float defaultStepDownLoad = 0.7f, defaultStepUpLoad = 0.5f;
+
+private:
+    void run() override;
+    void scheduleJobs();
+    void updateQuality();
+    void flushCaptures();
+
+    static int getNumWorkers();
+
+    juce::ThreadPool pool;
+
+    mutable juce::CriticalSection tapLock;
+    juce::ReferenceCountedArray<AnalyzerTap> taps;
+    int nextTapId = 1;
+    int nextTapToSchedule = 0;
+
+    std::atomic<int> qualityLevel{ 0 };
+    std::atomic<float> currentLoad{ 0.0f };
+    std::atomic<float> stepDownLoad{ defaultStepDownLoad }, stepUpLoad{ defaultStepUpLoad };
+
+    // Scheduler thread: how long the load has been past either threshold.
+    int msAboveThreshold = 0, msBelowThreshold = 0;
+    static constexpr int stepDownAfterMs = 100, stepUpAfterMs = 1000;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalyzerHub)
+};
@@ -0,0 +1,108 @@
+#include "BackgroundCache.h"
+#include <BinaryData.h>
+
+BackgroundCache::BackgroundCache()
+    : juce::Thread("darQ Background Cache")
+{
+    startThread(juce::Thread::Priority::low);
+}
+
+BackgroundCache::~BackgroundCache()
+{
+    stopThread(2000);
+}
+
+juce::Image BackgroundCache::get(juce::Point<int> pixelSize, std::function<void()> onReady)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    if (pixelSize.x <= 0 || pixelSize.y <= 0)
+        return {};
+
+    {
+        const juce::ScopedLock sl(lock);
+
+        for (auto& entry : rendered)
+            if (entry.first == pixelSize)
+                return entry.second;
+
+        // The size being rendered right now needs no second pass.
+        if (pixelSize != renderingSize)
+            requestedSize = pixelSize;
+
+        waiting.push_back(std::move(onReady));
+    }
+
+    notify();
+    return {};
+}
+
+void BackgroundCache::run()
+{
+    // Software images can be decoded and drawn into away from the message thread.
+    source = juce::SoftwareImageType().convert(juce::ImageFileFormat::loadFrom(BinaryData::bg_png, (size_t)BinaryData::bg_pngSize));
+
+    while (! threadShouldExit())
+    {
+        juce::Point<int> pixelSize;
+        {
+            const juce::ScopedLock sl(lock);
+            pixelSize = renderingSize = std::exchange(requestedSize, {});
+        }
+
+        if (pixelSize.x <= 0 || pixelSize.y <= 0)
+        {
+            wait(-1);
+            continue;
+        }
+
+        auto image = render(pixelSize);
+
+        std::vector<std::function<void()>> callbacks;
+        {
+            const juce::ScopedLock sl(lock);
+
+            auto exists = std::any_of(rendered.begin(), rendered.end(),
+                [pixelSize](const auto& entry) { return entry.first == pixelSize; });
+
+            if (! exists)
+            {
+                if (rendered.size() >= maxCachedSizes)
+                    rendered.erase(rendered.begin());
+
+                rendered.emplace_back(pixelSize, image);
+            }
+
+            renderingSize = {};
+
+            // Requests that came in during the render wait for the next one.
+            if (requestedSize == juce::Point<int>())
+                std::swap(callbacks, waiting);
+        }
+
+        if (! callbacks.empty())
+        {
+            juce::MessageManager::callAsync([callbacks = std::move(callbacks)]
+            {
+                for (auto& callback : callbacks)
+                    callback();
+            });
+        }
+    }
+}
+
+juce::Image BackgroundCache::render(juce::Point<int> pixelSize) const
+{
+    juce::Image image(juce::Image::RGB, pixelSize.x, pixelSize.y, true, juce::SoftwareImageType());
+
+    juce::Graphics g(image);
+    g.fillAll(juce::Colours::black);
+
+    if (source.isValid())
+    {
+        g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+        g.drawImage(source, image.getBounds().toFloat());
+    }
+
+    return image;
+}
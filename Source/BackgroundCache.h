@@ -0,0 +1,46 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Pre-rendered editor backgrounds, shared by every editor in the process.
+
+    Hold it through a juce::SharedResourcePointer<BackgroundCache>. The image
+    asset is decoded once on the cache's own thread. Editors ask for the
+    background at their size in physical pixels, so each display scale factor
+    gets its own entry; a size that isn't there yet is rendered on the same
+    thread and the editor is told to repaint when it is. Only the most recent
+    size asked for is pending at any time. Until then editors
+    paint their plain fill, so opening one never waits for image work.
+*/
+class BackgroundCache : private juce::Thread
+{
+public:
+    BackgroundCache();
+    ~BackgroundCache() override;
+
+    /** The background at this pixel size, or an invalid image if it isn't
+        ready yet; in that case onReady is called on the message thread once
+        it is. Message thread. */
+    juce::Image get(juce::Point<int> pixelSize, std::function<void()> onReady);
+
+private:
+    void run() override;
+    juce::Image render(juce::Point<int> pixelSize) const;
+
+    juce::CriticalSection lock;
+    std::vector<std::pair<juce::Point<int>, juce::Image>> rendered;   // oldest first
+
+    // A single slot: a newer size replaces one that hasn't been started, so
+    // dragging a window only ever renders the latest size. Everyone waiting
+    // is told when it is done, and asks again for the size it now needs.
+    juce::Point<int> requestedSize, renderingSize;
+    std::vector<std::function<void()>> waiting;
+
+    juce::Image source;   // cache thread only
+
+    static constexpr size_t maxCachedSizes = 8;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BackgroundCache)
+};
@@ -0,0 +1,135 @@
+#include "CoefficientTables.h"
+
+CoefficientTables::CoefficientTables()
+{
+	log2MinFrequency = std::log2(minNormalisedFrequency);
+	numFrequencies = (int)std::ceil((std::log2(maxNormalisedFrequency) - log2MinFrequency) * pointsPerOctave) + 1;
+
+	cutSections.resize((size_t)(numCutSections * numFrequencies));
+	peakCos.resize((size_t)numFrequencies);
+	peakSin.resize((size_t)numFrequencies);
+
+	for (int i = 0; i < numFrequencies; ++i)
+	{
+		auto frequency = juce::jmin(maxNormalisedFrequency, std::exp2(log2MinFrequency + (double)i / pointsPerOctave));
+		auto n = 1.0 / std::tan(juce::MathConstants<double>::pi * frequency);
+		auto nSquared = n * n;
+
+		// Same sections as FilterDesign's even-order Butterworth methods.
+		for (int cutOrder = 0; cutOrder < ChainCoefficients::maxCutSections; ++cutOrder)
+		{
+			auto order = 2 * (cutOrder + 1);
+
+			for (int section = 0; section <= cutOrder; ++section)
+			{
+				auto q = 1.0 / (2.0 * std::cos((2.0 * section + 1.0) * juce::MathConstants<double>::pi / (order * 2.0)));
+				auto c1 = 1.0 / (1.0 + n / q + nSquared);
+
+				cutSections[(size_t)(getSectionIndex(cutOrder, section) * numFrequencies + i)]
+					= { c1 * 2.0 * (1.0 - nSquared), c1 * (1.0 - n / q + nSquared) };
+			}
+		}
+
+		auto omega = juce::MathConstants<double>::twoPi * frequency;
+		peakCos[(size_t)i] = std::cos(omega);
+		peakSin[(size_t)i] = std::sin(omega);
+	}
+
+	auto numGains = (int)((maxGainInDecibels - minGainInDecibels) * gainPointsPerDecibel) + 1;
+	peakAmplitude.resize((size_t)numGains);
+
+	for (int i = 0; i < numGains; ++i)
+		peakAmplitude[(size_t)i] = std::pow(10.0, (minGainInDecibels + (double)i / gainPointsPerDecibel) / 40.0);
+}
+
+int CoefficientTables::getSectionIndex(int cutOrder, int section) noexcept
+{
+	return cutOrder * (cutOrder + 1) / 2 + section;
+}
+
+CoefficientTables::Position CoefficientTables::getFrequencyPosition(double normalisedFrequency) const noexcept
+{
+	auto frequency = juce::jlimit(minNormalisedFrequency, maxNormalisedFrequency, normalisedFrequency);
+	auto position = (std::log2(frequency) - log2MinFrequency) * pointsPerOctave;
+	auto index = juce::jlimit(0, numFrequencies - 2, (int)position);
+
+	return { index, juce::jlimit(0.0, 1.0, position - index) };
+}
+
+BiquadCoefficients CoefficientTables::makeCutSection(int cutOrder, int section, bool highPass,
+	double frequency, double sampleRate) const noexcept
+{
+	auto p = getFrequencyPosition(frequency / sampleRate);
+	auto* row = cutSections.data() + getSectionIndex(cutOrder, section) * numFrequencies + p.index;
+
+	auto a1 = row[0].a1 + p.fraction * (row[1].a1 - row[0].a1);
+	auto a2 = row[0].a2 + p.fraction * (row[1].a2 - row[0].a2);
+
+	// Zeros sit at DC (high pass) or Nyquist (low pass); scale for unity gain
+	// at the other end, which is exact for the interpolated poles too.
+	if (highPass)
+	{
+		auto g = 0.25 * (1.0 - a1 + a2);
+		return { g, -2.0 * g, g, a1, a2 };
+	}
+
+	auto g = 0.25 * (1.0 + a1 + a2);
+	return { g, 2.0 * g, g, a1, a2 };
+}
+
+BiquadCoefficients CoefficientTables::makePeak(double frequency, double quality, double gainInDecibels,
+	double sampleRate, int design) const noexcept
+{
+	if (design == PeakDesign_Matched)
+		return makeMatchedPeak(frequency, quality, gainInDecibels, sampleRate);
+
+	auto p = getFrequencyPosition(juce::jmax(frequency, 2.0) / sampleRate);
+	auto i = (size_t)p.index;
+
+	auto cosOmega = peakCos[i] + p.fraction * (peakCos[i + 1] - peakCos[i]);
+	auto sinOmega = peakSin[i] + p.fraction * (peakSin[i + 1] - peakSin[i]);
+
+	auto gainPosition = (juce::jlimit(minGainInDecibels, maxGainInDecibels, gainInDecibels) - minGainInDecibels) * gainPointsPerDecibel;
+	auto g = juce::jmin((size_t)gainPosition, peakAmplitude.size() - 2);
+	auto A = peakAmplitude[g] + (gainPosition - (double)g) * (peakAmplitude[g + 1] - peakAmplitude[g]);
+
+	auto alpha = sinOmega / (quality * 2.0);
+	auto c2 = -2.0 * cosOmega;
+	auto alphaTimesA = alpha * A;
+	auto alphaOverA = alpha / A;
+	auto inv = 1.0 / (1.0 + alphaOverA);
+
+	return { (1.0 + alphaTimesA) * inv, c2 * inv, (1.0 - alphaTimesA) * inv, c2 * inv, (1.0 - alphaOverA) * inv };
+}
+
+BiquadCoefficients CoefficientTables::makeBandPass(double frequency, double quality, double sampleRate) const noexcept
+{
+	auto p = getFrequencyPosition(juce::jmax(frequency, 2.0) / sampleRate);
+	auto i = (size_t)p.index;
+
+	auto cosOmega = peakCos[i] + p.fraction * (peakCos[i + 1] - peakCos[i]);
+	auto sinOmega = peakSin[i] + p.fraction * (peakSin[i + 1] - peakSin[i]);
+
+	auto alpha = sinOmega / (quality * 2.0);
+	auto inv = 1.0 / (1.0 + alpha);
+
+	return { alpha * inv, 0.0, -alpha * inv, -2.0 * cosOmega * inv, (1.0 - alpha) * inv };
+}
+
+ChainCoefficients CoefficientTables::makeChainCoefficients(const ChainSettings& chainSettings, double sampleRate) const noexcept
+{
+	ChainCoefficients result;
+
+	result.numLowCut = juce::jlimit(1, ChainCoefficients::maxCutSections, chainSettings.lowCutSlope + 1);
+	for (int i = 0; i < result.numLowCut; ++i)
+		result.lowCut[i] = makeCutSection(result.numLowCut - 1, i, true, chainSettings.lowCutFreq, sampleRate);
+
+	result.numHighCut = juce::jlimit(1, ChainCoefficients::maxCutSections, chainSettings.highCutSlope + 1);
+	for (int i = 0; i < result.numHighCut; ++i)
+		result.highCut[i] = makeCutSection(result.numHighCut - 1, i, false, chainSettings.highCutFreq, sampleRate);
+
+	result.peak = makePeak(chainSettings.peakFreq, chainSettings.peakQuality, chainSettings.peakGainInDecibels, sampleRate,
+		chainSettings.peakDesign);
+
+	return result;
+}
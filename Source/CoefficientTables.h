@@ -0,0 +1,77 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "EQDesign.h"
+
+//==============================================================================
+/**
+	Precomputed design data for the chain, so coefficients for any setting
+	come out of a table lookup and a few dozen flops instead of trig and pow.
+
+	Everything is tabulated against normalised frequency (f / sampleRate) on a
+	dense log grid, which makes one set of tables valid at every host and
+	oversampled rate. Hold it through a juce::SharedResourcePointer: the tables
+	are built once per process and shared by every instance.
+
+	- Butterworth sections: the denominators (a1, a2) of every section of
+	  every slope. The bilinear high- and low-pass sections share them, and
+	  the numerators follow exactly from unity gain at Nyquist or DC. Linear
+	  interpolation happens in (a1, a2), whose stability region is a triangle,
+	  so any blend of two stable sections is stable.
+	- Peak and band pass: cos and sin of the centre frequency, plus the RBJ
+	  amplitude A over gain. The Q term is a single division. The matched
+	  peak design is closed form already, so it is computed directly.
+*/
+class CoefficientTables
+{
+public:
+	CoefficientTables();
+
+	ChainCoefficients makeChainCoefficients(const ChainSettings& chainSettings, double sampleRate) const noexcept;
+
+	/** One section of a cut; cutOrder is the slope index (0 = 12 dB/oct). */
+	BiquadCoefficients makeCutSection(int cutOrder, int section, bool highPass, double frequency, double sampleRate) const noexcept;
+	BiquadCoefficients makePeak(double frequency, double quality, double gainInDecibels, double sampleRate,
+		int design = PeakDesign_Bilinear) const noexcept;
+
+	/** RBJ band pass (0 dB peak gain), e.g. for a detector tuned to the peak band. */
+	BiquadCoefficients makeBandPass(double frequency, double quality, double sampleRate) const noexcept;
+
+	static constexpr int pointsPerOctave = 256;
+	// The chain is designed at the oversampled rate, so the grid has to reach
+	// 2 Hz (the lowest any design asks for) at the highest host rate times the
+	// largest oversampling factor: 2 / (384 kHz * 8), about 6.5e-7.
+	static constexpr double maxHostSampleRate = 384000.0;
+	static constexpr int maxOversamplingFactor = 8;
+	static constexpr double minNormalisedFrequency = 2.0 / (maxHostSampleRate * maxOversamplingFactor);
+	static constexpr double maxNormalisedFrequency = 0.4999;
+
+	static constexpr double minGainInDecibels = -48.0, maxGainInDecibels = 48.0;
+	static constexpr int gainPointsPerDecibel = 16;
+
+private:
+	struct Position
+	{
+		int index;
+		double fraction;
+	};
+
+	Position getFrequencyPosition(double normalisedFrequency) const noexcept;
+
+	static constexpr int numCutSections = ChainCoefficients::maxCutSections * (ChainCoefficients::maxCutSections + 1) / 2;
+	static int getSectionIndex(int cutOrder, int section) noexcept;
+
+	struct Denominator
+	{
+		double a1, a2;
+	};
+
+	int numFrequencies = 0;
+	double log2MinFrequency = 0.0;
+
+	std::vector<Denominator> cutSections;   // [section][frequency]
+	std::vector<double> peakCos, peakSin;   // [frequency]
+	std::vector<double> peakAmplitude;      // [gain]
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CoefficientTables)
+};
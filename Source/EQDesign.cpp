@@ -0,0 +1,306 @@
+#include "EQDesign.h"
+
+ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts)
+{
+	return ChainParameters(apvts).load();
+}
+
+ChainParameters::ChainParameters(juce::AudioProcessorValueTreeState& apvts, const juce::String& prefix)
+	: lowCutFreq(apvts.getRawParameterValue(prefix + "LowCut Freq")),
+	highCutFreq(apvts.getRawParameterValue(prefix + "HighCut Freq")),
+	peakFreq(apvts.getRawParameterValue(prefix + "Peak Freq")),
+	peakGain(apvts.getRawParameterValue(prefix + "Peak Gain")),
+	peakQuality(apvts.getRawParameterValue(prefix + "Peak Quality")),
+	lowCutSlope(apvts.getRawParameterValue(prefix + "LowCut Slope")),
+	highCutSlope(apvts.getRawParameterValue(prefix + "HighCut Slope")),
+	peakDesign(apvts.getRawParameterValue("Peak Design"))
+{
+	jassert(lowCutFreq != nullptr && highCutFreq != nullptr && peakFreq != nullptr && peakGain != nullptr
+		&& peakQuality != nullptr && lowCutSlope != nullptr && highCutSlope != nullptr && peakDesign != nullptr);
+}
+
+ChainSettings ChainParameters::load() const noexcept
+{
+	ChainSettings settings;
+
+	settings.lowCutFreq = lowCutFreq->load();
+	settings.highCutFreq = highCutFreq->load();
+	settings.peakFreq = peakFreq->load();
+	settings.peakGainInDecibels = peakGain->load();
+	settings.peakQuality = peakQuality->load();
+	settings.lowCutSlope = static_cast<Slope>(lowCutSlope->load());
+	settings.highCutSlope = static_cast<Slope>(highCutSlope->load());
+	settings.peakDesign = (int)peakDesign->load();
+
+	return settings;
+}
+
+DynamicParameters::DynamicParameters(juce::AudioProcessorValueTreeState& apvts, const juce::String& prefix)
+	: enabled(apvts.getRawParameterValue(prefix + "Peak Dynamic")),
+	threshold(apvts.getRawParameterValue(prefix + "Peak Threshold")),
+	ratio(apvts.getRawParameterValue(prefix + "Peak Ratio")),
+	attack(apvts.getRawParameterValue(prefix + "Peak Attack")),
+	release(apvts.getRawParameterValue(prefix + "Peak Release"))
+{
+	jassert(enabled != nullptr && threshold != nullptr && ratio != nullptr && attack != nullptr && release != nullptr);
+}
+
+DynamicSettings DynamicParameters::load() const noexcept
+{
+	DynamicSettings settings;
+
+	settings.enabled = enabled->load() > 0.5f;
+	settings.thresholdInDecibels = threshold->load();
+	settings.ratio = ratio->load();
+	settings.attackMs = attack->load();
+	settings.releaseMs = release->load();
+
+	return settings;
+}
+
+namespace
+{
+	float interpolateLinear(float a, float b, float amount) noexcept
+	{
+		return a + (b - a) * amount;
+	}
+
+	float interpolateLog(float a, float b, float amount) noexcept
+	{
+		return a * std::pow(b / a, amount);
+	}
+}
+
+ChainSettings interpolateSettings(const ChainSettings& a, const ChainSettings& b, float amount) noexcept
+{
+	ChainSettings settings;
+
+	settings.lowCutFreq = interpolateLog(a.lowCutFreq, b.lowCutFreq, amount);
+	settings.highCutFreq = interpolateLog(a.highCutFreq, b.highCutFreq, amount);
+	settings.peakFreq = interpolateLog(a.peakFreq, b.peakFreq, amount);
+	settings.peakGainInDecibels = interpolateLinear(a.peakGainInDecibels, b.peakGainInDecibels, amount);
+	settings.peakQuality = interpolateLog(a.peakQuality, b.peakQuality, amount);
+	settings.lowCutSlope = amount < 0.5f ? a.lowCutSlope : b.lowCutSlope;
+	settings.highCutSlope = amount < 0.5f ? a.highCutSlope : b.highCutSlope;
+	settings.peakDesign = amount < 0.5f ? a.peakDesign : b.peakDesign;
+
+	return settings;
+}
+
+DynamicSettings interpolateSettings(const DynamicSettings& a, const DynamicSettings& b, float amount) noexcept
+{
+	DynamicSettings settings;
+
+	settings.enabled = a.enabled || b.enabled;
+	settings.thresholdInDecibels = interpolateLinear(a.enabled ? a.thresholdInDecibels : 0.f,
+		b.enabled ? b.thresholdInDecibels : 0.f, amount);
+	settings.ratio = interpolateLinear(a.enabled ? a.ratio : 1.f, b.enabled ? b.ratio : 1.f, amount);
+	settings.attackMs = interpolateLinear(a.attackMs, b.attackMs, amount);
+	settings.releaseMs = interpolateLinear(a.releaseMs, b.releaseMs, amount);
+
+	return settings;
+}
+
+Coefficients makePeakFilter(const ChainSettings& chainSettings, double sampleRate)
+{
+	if (chainSettings.peakDesign == PeakDesign_Matched)
+	{
+		auto c = makeMatchedPeak(chainSettings.peakFreq, chainSettings.peakQuality, chainSettings.peakGainInDecibels, sampleRate);
+		return new juce::dsp::IIR::Coefficients<float>((float)c.b0, (float)c.b1, (float)c.b2, 1.0f, (float)c.a1, (float)c.a2);
+	}
+
+	return juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate,
+		chainSettings.peakFreq,
+		chainSettings.peakQuality,
+		juce::Decibels::decibelsToGain(chainSettings.peakGainInDecibels));
+}
+
+namespace
+{
+	// Same designs as juce::dsp::IIR::Coefficients and FilterDesign, written
+	// out so the audio thread can run them without allocating.
+
+	BiquadCoefficients normalise(double b0, double b1, double b2, double a0, double a1, double a2) noexcept
+	{
+		auto inv = 1.0 / a0;
+		return { b0 * inv, b1 * inv, b2 * inv, a1 * inv, a2 * inv };
+	}
+
+	BiquadCoefficients makeButterworthSection(double frequency, double sampleRate, double q, bool highPass) noexcept
+	{
+		auto n = 1.0 / std::tan(juce::MathConstants<double>::pi * frequency / sampleRate);
+		auto nSquared = n * n;
+		auto invQ = 1.0 / q;
+		auto c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+		auto a1 = c1 * 2.0 * (1.0 - nSquared);
+		auto a2 = c1 * (1.0 - invQ * n + nSquared);
+
+		if (highPass)
+			return { c1 * nSquared, -2.0 * c1 * nSquared, c1 * nSquared, a1, a2 };
+
+		return { c1, c1 * 2.0, c1, a1, a2 };
+	}
+
+	// Even-order Butterworth as order / 2 biquads, in FilterDesign's order.
+	int makeButterworth(BiquadCoefficients* sections, double frequency, double sampleRate, int order, bool highPass) noexcept
+	{
+		auto numSections = juce::jmin(order / 2, ChainCoefficients::maxCutSections);
+
+		for (int i = 0; i < numSections; ++i)
+		{
+			auto q = 1.0 / (2.0 * std::cos((2.0 * i + 1.0) * juce::MathConstants<double>::pi / (order * 2.0)));
+			sections[i] = makeButterworthSection(frequency, sampleRate, q, highPass);
+		}
+
+		return numSections;
+	}
+
+	BiquadCoefficients makePeakSection(double frequency, double sampleRate, double q, double gainFactor) noexcept
+	{
+		auto A = std::sqrt(juce::jmax(0.0, gainFactor));
+		auto omega = (juce::MathConstants<double>::twoPi * juce::jmax(frequency, 2.0)) / sampleRate;
+		auto alpha = std::sin(omega) / (q * 2.0);
+		auto c2 = -2.0 * std::cos(omega);
+		auto alphaTimesA = alpha * A;
+		auto alphaOverA = alpha / A;
+
+		return normalise(1.0 + alphaTimesA, c2, 1.0 - alphaTimesA, 1.0 + alphaOverA, c2, 1.0 - alphaOverA);
+	}
+}
+
+ChainCoefficients makeChainCoefficients(const ChainSettings& chainSettings, double sampleRate)
+{
+	ChainCoefficients result;
+
+	result.numLowCut = makeButterworth(result.lowCut, chainSettings.lowCutFreq, sampleRate,
+		2 * (chainSettings.lowCutSlope + 1), true);
+
+	result.numHighCut = makeButterworth(result.highCut, chainSettings.highCutFreq, sampleRate,
+		2 * (chainSettings.highCutSlope + 1), false);
+
+	if (chainSettings.peakDesign == PeakDesign_Matched)
+		result.peak = makeMatchedPeak(chainSettings.peakFreq, chainSettings.peakQuality, chainSettings.peakGainInDecibels, sampleRate);
+	else
+		result.peak = makePeakSection(chainSettings.peakFreq, sampleRate, chainSettings.peakQuality,
+			juce::Decibels::decibelsToGain((double)chainSettings.peakGainInDecibels));
+
+	return result;
+}
+
+BiquadCoefficients makeMatchedPeak(double frequency, double quality, double gainInDecibels, double sampleRate) noexcept
+{
+	auto G = std::pow(10.0, gainInDecibels / 20.0);
+	auto omega = juce::MathConstants<double>::twoPi * juce::jlimit(2.0, 0.4999 * sampleRate, frequency) / sampleRate;
+
+	// Poles of s^2 + s / (A Q) + 1, mapped by impulse invariance.
+	auto zeta = 1.0 / (2.0 * quality * std::sqrt(G));
+	auto a2 = std::exp(-2.0 * zeta * omega);
+	double a1;
+
+	if (zeta <= 1.0)
+	{
+		a1 = -2.0 * std::exp(-zeta * omega) * std::cos(std::sqrt(1.0 - zeta * zeta) * omega);
+	}
+	else
+	{
+		auto root = std::sqrt(zeta * zeta - 1.0);
+		a1 = -(std::exp((root - zeta) * omega) + std::exp((-root - zeta) * omega));
+	}
+
+	// Squared magnitudes in the basis phi0 = cos^2(w/2), phi1 = sin^2(w/2),
+	// phi2 = 4 phi0 phi1, where |H|^2 is linear in the coefficients.
+	auto phi1 = juce::square(std::sin(omega * 0.5));
+	auto phi0 = 1.0 - phi1;
+	auto phi2 = 4.0 * phi0 * phi1;
+
+	auto A0 = juce::square(1.0 + a1 + a2);
+	auto A1 = juce::square(1.0 - a1 + a2);
+	auto A2 = -4.0 * a2;
+
+	// Gain and slope of the numerator at the centre, then DC.
+	auto R1 = (A0 * phi0 + A1 * phi1 + A2 * phi2) * G * G;
+	auto R2 = (-A0 + A1 + 4.0 * (phi0 - phi1) * A2) * G * G;
+
+	auto B0 = A0;
+	auto B2 = (R1 - R2 * phi1 - B0) / (4.0 * phi1 * phi1);
+	auto B1 = R2 + B0 + 4.0 * (phi1 - phi0) * B2;
+
+	// Back from squared magnitudes to a minimum-phase numerator.
+	auto rootB0 = std::sqrt(B0);
+	auto rootB1 = std::sqrt(juce::jmax(0.0, B1));
+	auto W = 0.5 * (rootB0 + rootB1);
+	auto b0 = 0.5 * (W + std::sqrt(juce::jmax(0.0, W * W + B2)));
+	auto b1 = 0.5 * (rootB0 - rootB1);
+	auto b2 = -B2 / (4.0 * b0);
+
+	return { b0, b1, b2, a1, a2 };
+}
+
+void updateCoefficients(Coefficients& old, const Coefficients& replacements)
+{
+	*old = *replacements;
+}
+
+void updateMonoChain(MonoChain& chain, const ChainSettings& chainSettings, double sampleRate)
+{
+	updateCutFilter(chain.get<ChainPositions::LowCut>(), makeLowCutFilter(chainSettings, sampleRate),
+		static_cast<Slope>(chainSettings.lowCutSlope));
+
+	updateCoefficients(chain.get<ChainPositions::Peak>().coefficients, makePeakFilter(chainSettings, sampleRate));
+
+	updateCutFilter(chain.get<ChainPositions::HighCut>(), makeHighCutFilter(chainSettings, sampleRate),
+		static_cast<Slope>(chainSettings.highCutSlope));
+}
+
+void getChainMagnitudes(const ChainSettings& chainSettings, double sampleRate,
+	const double* frequencies, double* magnitudes, size_t numFrequencies)
+{
+	auto peak = makePeakFilter(chainSettings, sampleRate);
+	auto lowCut = makeLowCutFilter(chainSettings, sampleRate);
+	auto highCut = makeHighCutFilter(chainSettings, sampleRate);
+
+	peak->getMagnitudeForFrequencyArray(frequencies, magnitudes, numFrequencies, sampleRate);
+
+	juce::HeapBlock<double> stage(numFrequencies);
+
+	auto applyStage = [&](const juce::dsp::IIR::Coefficients<float>& coefficients)
+	{
+		coefficients.getMagnitudeForFrequencyArray(frequencies, stage.get(), numFrequencies, sampleRate);
+
+		for (size_t i = 0; i < numFrequencies; ++i)
+			magnitudes[i] *= stage[i];
+	};
+
+	for (auto* c : lowCut)
+		applyStage(*c);
+
+	for (auto* c : highCut)
+		applyStage(*c);
+}
+
+void getChainPhases(const ChainSettings& chainSettings, double sampleRate,
+	const double* frequencies, double* phases, size_t numFrequencies)
+{
+	auto peak = makePeakFilter(chainSettings, sampleRate);
+	auto lowCut = makeLowCutFilter(chainSettings, sampleRate);
+	auto highCut = makeHighCutFilter(chainSettings, sampleRate);
+
+	for (size_t i = 0; i < numFrequencies; ++i)
+	{
+		auto phase = peak->getPhaseForFrequency(frequencies[i], sampleRate);
+
+		for (auto* c : lowCut)
+			phase += c->getPhaseForFrequency(frequencies[i], sampleRate);
+
+		for (auto* c : highCut)
+			phase += c->getPhaseForFrequency(frequencies[i], sampleRate);
+
+		// Each section's phase is wrapped; remove the jumps between neighbours.
+		if (i > 0)
+			phase -= juce::MathConstants<double>::twoPi
+				* std::round((phase - phases[i - 1]) / juce::MathConstants<double>::twoPi);
+
+		phases[i] = phase;
+	}
+}
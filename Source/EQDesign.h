@@ -0,0 +1,206 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+enum Slope
+{
+	Slope_12,
+	Slope_24,
+	Slope_36,
+	Slope_48
+};
+
+/** How the peak band is mapped from its analog prototype. The bilinear
+	design cramps towards Nyquist; the matched one keeps the analog
+	magnitude all the way up, at the native rate. */
+enum PeakDesign
+{
+	PeakDesign_Bilinear,
+	PeakDesign_Matched
+};
+
+struct ChainSettings
+{
+	float peakFreq{ 0 }, peakGainInDecibels{ 0 }, peakQuality{ 1.f };
+	float lowCutFreq{ 0 }, highCutFreq{ 0 };
+	int lowCutSlope{ Slope::Slope_12 }, highCutSlope{ Slope::Slope_12 };
+	int peakDesign{ PeakDesign_Bilinear };
+};
+
+inline bool operator==(const ChainSettings& a, const ChainSettings& b)
+{
+	return a.peakFreq == b.peakFreq && a.peakGainInDecibels == b.peakGainInDecibels && a.peakQuality == b.peakQuality
+		&& a.lowCutFreq == b.lowCutFreq && a.highCutFreq == b.highCutFreq
+		&& a.lowCutSlope == b.lowCutSlope && a.highCutSlope == b.highCutSlope
+		&& a.peakDesign == b.peakDesign;
+}
+
+inline bool operator!=(const ChainSettings& a, const ChainSettings& b) { return !(a == b); }
+
+ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts);
+
+/** Cached pointers to one set of chain parameters, so the audio thread reads
+	them without looking IDs up. The prefix selects e.g. the side-channel set;
+	the peak design is shared by both sets. */
+struct ChainParameters
+{
+	explicit ChainParameters(juce::AudioProcessorValueTreeState& apvts, const juce::String& prefix = {});
+
+	ChainSettings load() const noexcept;
+
+	std::atomic<float>* lowCutFreq;
+	std::atomic<float>* highCutFreq;
+	std::atomic<float>* peakFreq;
+	std::atomic<float>* peakGain;
+	std::atomic<float>* peakQuality;
+	std::atomic<float>* lowCutSlope;
+	std::atomic<float>* highCutSlope;
+	std::atomic<float>* peakDesign;
+};
+
+/** Optional dynamics for the peak band: above the threshold, the band's gain
+	is pulled down by the detector level's overshoot times (1 - 1 / ratio). */
+struct DynamicSettings
+{
+	bool enabled{ false };
+	float thresholdInDecibels{ -20.f }, ratio{ 2.f }, attackMs{ 5.f }, releaseMs{ 100.f };
+};
+
+struct DynamicParameters
+{
+	explicit DynamicParameters(juce::AudioProcessorValueTreeState& apvts, const juce::String& prefix = {});
+
+	DynamicSettings load() const noexcept;
+
+	std::atomic<float>* enabled;
+	std::atomic<float>* threshold;
+	std::atomic<float>* ratio;
+	std::atomic<float>* attack;
+	std::atomic<float>* release;
+};
+
+/** Settings between a (amount 0) and b (amount 1): frequencies and Q move on a
+	log scale, gains and times linearly, slopes and the peak design snap at the
+	midpoint. Every
+	intermediate point is a valid design, so the morphed filter stays stable. */
+ChainSettings interpolateSettings(const ChainSettings& a, const ChainSettings& b, float amount) noexcept;
+DynamicSettings interpolateSettings(const DynamicSettings& a, const DynamicSettings& b, float amount) noexcept;
+
+//==============================================================================
+// Coefficient design for the three stages of the chain, shared by the IIR
+// path and everything that needs to know the chain's response.
+
+using Filter = juce::dsp::IIR::Filter<float>;
+using Coefficients = Filter::CoefficientsPtr;
+
+Coefficients makePeakFilter(const ChainSettings& chainSettings, double sampleRate);
+
+inline auto makeLowCutFilter(const ChainSettings& chainSettings, double sampleRate)
+{
+	return juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(chainSettings.lowCutFreq,
+		sampleRate,
+		2 * (chainSettings.lowCutSlope + 1));
+}
+
+inline auto makeHighCutFilter(const ChainSettings& chainSettings, double sampleRate)
+{
+	return juce::dsp::FilterDesign<float>::designIIRLowpassHighOrderButterworthMethod(chainSettings.highCutFreq,
+		sampleRate,
+		2 * (chainSettings.highCutSlope + 1));
+}
+
+//==============================================================================
+// Plain, normalised (a0 == 1) coefficients for engines that don't use
+// juce::dsp::IIR::Filter. Designed in double precision.
+
+struct BiquadCoefficients
+{
+	double b0{ 1 }, b1{ 0 }, b2{ 0 }, a1{ 0 }, a2{ 0 };
+};
+
+struct ChainCoefficients
+{
+	static constexpr int maxCutSections = 4;
+
+	BiquadCoefficients lowCut[maxCutSections], peak, highCut[maxCutSections];
+	int numLowCut{ 0 }, numHighCut{ 0 };
+};
+
+/** Same designs as the juce::dsp versions above, but allocation-free, so the
+	audio thread can call it every block. */
+ChainCoefficients makeChainCoefficients(const ChainSettings& chainSettings, double sampleRate);
+
+/** Peak band matched to the analog prototype (the same one the bilinear
+	design starts from) after M. Vicanek, "Matched Second Order Digital
+	Filters" (2016): impulse-invariant poles, and zeros that give unity gain
+	at DC and the full gain, with zero slope, at the centre. Closed form and
+	allocation-free, so it can follow a moving gain within a block. */
+BiquadCoefficients makeMatchedPeak(double frequency, double quality, double gainInDecibels, double sampleRate) noexcept;
+
+//==============================================================================
+// The juce::dsp::IIR chain the plugin originally ran, one per channel. Kept as
+// the reference the SIMD engine is checked against.
+
+using CutFilter = juce::dsp::ProcessorChain<Filter, Filter, Filter, Filter>;
+
+using MonoChain = juce::dsp::ProcessorChain<CutFilter, Filter, CutFilter>;
+
+enum ChainPositions
+{
+	LowCut,
+	Peak,
+	HighCut
+};
+
+void updateCoefficients(Coefficients& old, const Coefficients& replacements);
+
+template<int Index, typename ChainType, typename CoefficientType>
+void update(ChainType& chain, const CoefficientType& coefficients)
+{
+	updateCoefficients(chain.template get<Index>().coefficients, coefficients[Index]);
+	chain.template setBypassed<Index>(false);
+}
+
+template<typename ChainType, typename CoefficientType>
+void updateCutFilter(ChainType& chain,
+	const CoefficientType& coefficients,
+	const Slope& slope)
+{
+	chain.template setBypassed<0>(true);
+	chain.template setBypassed<1>(true);
+	chain.template setBypassed<2>(true);
+	chain.template setBypassed<3>(true);
+
+	switch (slope)
+	{
+	case Slope_48:
+	{
+		update<3>(chain, coefficients);
+	}
+	case Slope_36:
+	{
+		update<2>(chain, coefficients);
+
+	}
+	case Slope_24:
+	{
+		update<1>(chain, coefficients);
+	}
+	case Slope_12:
+	{
+		update<0>(chain, coefficients);
+	}
+	}
+}
+
+void updateMonoChain(MonoChain& chain, const ChainSettings& chainSettings, double sampleRate);
+
+/** Magnitude of the whole chain (low cut, peak, high cut) at each of the given frequencies. */
+void getChainMagnitudes(const ChainSettings& chainSettings, double sampleRate,
+	const double* frequencies, double* magnitudes, size_t numFrequencies);
+
+/** Phase of the chain in radians: the sum of the per-section phases,
+	unwrapped along the frequencies, which must be ascending and dense enough
+	that the phase moves by less than pi between neighbours. */
+void getChainPhases(const ChainSettings& chainSettings, double sampleRate,
+	const double* frequencies, double* phases, size_t numFrequencies);
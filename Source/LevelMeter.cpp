@@ -0,0 +1,159 @@
+#include "LevelMeter.h"
+
+LevelMeter::LevelMeter()
+{
+    for (int ch = 0; ch < maxChannels; ++ch)
+    {
+        heldPeak[ch].store(0.0f);
+        heldTruePeak[ch].store(0.0f);
+        rms[ch].store(0.0f);
+    }
+}
+
+void LevelMeter::prepare(double sampleRate)
+{
+    // Interpolator: Blackman-windowed sinc at the original Nyquist, split into
+    // four phases, each normalised to unity gain at DC. It is centred on a
+    // tap of phase 0 (the window is zero at k = 0), so phase 0 is the input
+    // itself and the others fall a quarter, half and three quarters between.
+    constexpr int length = truePeakFactor * truePeakTaps;
+    constexpr int centre = length / 2;
+
+    for (int p = 0; p < truePeakFactor; ++p)
+    {
+        double sum = 0;
+
+        for (int t = 0; t < truePeakTaps; ++t)
+        {
+            auto k = p + truePeakFactor * t;
+            auto x = (double)(k - centre) / truePeakFactor;
+
+            // Exact zeros on the other samples, rather than sin(pi n) rounding.
+            auto sinc = k == centre ? 1.0
+                : p == 0 ? 0.0
+                : std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+            auto window = 0.42 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * k / length)
+                + 0.08 * std::cos(2.0 * juce::MathConstants<double>::twoPi * k / length);
+
+            phaseCoefficients[t][p] = (float)(sinc * window);
+            sum += sinc * window;
+        }
+
+        for (int t = 0; t < truePeakTaps; ++t)
+            phaseCoefficients[t][p] = (float)(phaseCoefficients[t][p] / sum);
+    }
+
+    // K-weighting (BS.1770-4), designed for any rate from the analogue prototypes.
+    {
+        const auto f0 = 1681.974450955533, gain = 3.999843853973347, q = 0.7071752369554196;
+        auto k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        auto vh = std::pow(10.0, gain / 20.0);
+        auto vb = std::pow(vh, 0.4996667741545416);
+        auto a0 = 1.0 + k / q + k * k;
+
+        kCoefficients[0] = { (vh + vb * k / q + k * k) / a0, 2.0 * (k * k - vh) / a0, (vh - vb * k / q + k * k) / a0,
+            2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0 };
+    }
+
+    {
+        const auto f0 = 38.13547087602444, q = 0.5003270373238773;
+        auto k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        auto a0 = 1.0 + k / q + k * k;
+
+        kCoefficients[1] = { 1.0, -2.0, 1.0, 2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0 };
+    }
+
+    binLength = juce::jmax(1, juce::roundToInt(sampleRate / binsPerSecond));
+    reset();
+}
+
+void LevelMeter::reset() noexcept
+{
+    for (auto& history : truePeakHistory)
+        history.fill(0.0f);
+
+    truePeakPosition.fill(0);
+    std::memset(kState, 0, sizeof(kState));
+
+    binFill = 0;
+    binWeightedSquares = 0;
+    std::fill(std::begin(binSquares), std::end(binSquares), 0.0);
+
+    loudnessBins.fill(0.0);
+    for (auto& bins : squareBins)
+        bins.fill(0.0);
+
+    loudnessBinIndex = 0;
+    binsFilled = 0;
+
+    for (int ch = 0; ch < maxChannels; ++ch)
+    {
+        heldPeak[ch].store(0.0f, std::memory_order_relaxed);
+        heldTruePeak[ch].store(0.0f, std::memory_order_relaxed);
+        rms[ch].store(0.0f, std::memory_order_relaxed);
+    }
+
+    momentary.store(silenceLufs, std::memory_order_relaxed);
+    shortTerm.store(silenceLufs, std::memory_order_relaxed);
+}
+
+void LevelMeter::finishBin(int numChannels) noexcept
+{
+    loudnessBinIndex = (loudnessBinIndex + 1) % shortTermBins;
+    binsFilled = juce::jmin(binsFilled + 1, shortTermBins);
+
+    loudnessBins[(size_t)loudnessBinIndex] = binWeightedSquares / binLength;
+    binWeightedSquares = 0;
+
+    auto windowMean = [this](int numBins)
+    {
+        numBins = juce::jmin(numBins, binsFilled);
+        double sum = 0;
+
+        for (int i = 0; i < numBins; ++i)
+            sum += loudnessBins[(size_t)((loudnessBinIndex - i + shortTermBins) % shortTermBins)];
+
+        return sum / juce::jmax(1, numBins);
+    };
+
+    momentary.store(toLufs(windowMean(momentaryBins)), std::memory_order_relaxed);
+    shortTerm.store(toLufs(windowMean(shortTermBins)), std::memory_order_relaxed);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto& bins = squareBins[(size_t)ch];
+        bins[(size_t)(loudnessBinIndex % rmsBins)] = binSquares[ch] / binLength;
+        binSquares[ch] = 0;
+
+        auto mean = std::accumulate(bins.begin(), bins.end(), 0.0) / rmsBins;
+        rms[ch].store((float)std::sqrt(mean), std::memory_order_relaxed);
+    }
+
+    binFill = 0;
+}
+
+float LevelMeter::toLufs(double meanSquare) noexcept
+{
+    if (meanSquare <= 0.0)
+        return silenceLufs;
+
+    return juce::jmax(silenceLufs, (float)(-0.691 + 10.0 * std::log10(meanSquare)));
+}
+
+LevelMeter::Readings LevelMeter::getReadings() noexcept
+{
+    Readings readings;
+    readings.numChannels = publishedChannels.load(std::memory_order_relaxed);
+
+    for (int ch = 0; ch < maxChannels; ++ch)
+    {
+        readings.peak[ch] = heldPeak[ch].exchange(0.0f, std::memory_order_relaxed);
+        readings.truePeak[ch] = heldTruePeak[ch].exchange(0.0f, std::memory_order_relaxed);
+        readings.rms[ch] = rms[ch].load(std::memory_order_relaxed);
+    }
+
+    readings.momentaryLufs = momentary.load(std::memory_order_relaxed);
+    readings.shortTermLufs = shortTerm.load(std::memory_order_relaxed);
+
+    return readings;
+}
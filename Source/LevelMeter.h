@@ -0,0 +1,210 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "EQDesign.h"
+
+//==============================================================================
+/**
+    Input/output metering for one bus: block peak and RMS, 4x oversampled true
+    peak, and K-weighted momentary (400 ms) and short-term (3 s) loudness as
+    in ITU-R BS.1770.
+
+    The audio thread calls process(); the results are published through
+    atomics, so any thread can read them with getReadings(). Peaks are held
+    until they are read, so a 30 Hz display never misses one.
+*/
+class LevelMeter
+{
+public:
+    static constexpr int maxChannels = 2;
+    static constexpr int truePeakFactor = 4;
+    static constexpr int truePeakTaps = 12;          // per phase
+    static constexpr int binsPerSecond = 10;         // loudness is gated in 100 ms bins
+    static constexpr int momentaryBins = 4;
+    static constexpr int shortTermBins = 30;
+    static constexpr int rmsBins = 3;
+    static constexpr float silenceLufs = -100.0f;
+
+    struct Readings
+    {
+        int numChannels = 0;
+        float peak[maxChannels] = {}, truePeak[maxChannels] = {}, rms[maxChannels] = {};   // linear
+        float momentaryLufs = silenceLufs, shortTermLufs = silenceLufs;
+    };
+
+    LevelMeter();
+
+    void prepare(double sampleRate);
+
+    // Audio thread
+    void reset() noexcept;
+
+    template <typename SampleType>
+    void process(const SampleType* const* channels, int numChannels, int numSamples) noexcept
+    {
+        numChannels = juce::jmin(numChannels, maxChannels);
+        publishedChannels.store(numChannels, std::memory_order_relaxed);
+
+        for (int start = 0; start < numSamples;)
+        {
+            // Chunks end on loudness bin boundaries.
+            auto num = juce::jmin(numSamples - start, binLength - binFill);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto* x = channels[ch] + start;
+
+                SampleType peak{};
+                double sumSquares = 0;
+                measurePeakAndPower(x, num, peak, sumSquares);
+
+                holdMaximum(heldPeak[ch], (float)peak);
+                // Never below the sample peak, whatever the interpolator rounds to.
+                holdMaximum(heldTruePeak[ch], juce::jmax((float)peak, measureTruePeak(ch, x, num)));
+
+                binSquares[ch] += sumSquares;
+                binWeightedSquares += kWeightedPower(ch, x, num);
+            }
+
+            binFill += num;
+            start += num;
+
+            if (binFill == binLength)
+                finishBin(numChannels);
+        }
+    }
+
+    // Any thread
+    Readings getReadings() noexcept;
+
+    static float toLufs(double meanSquare) noexcept;
+
+private:
+    //==============================================================================
+    /** Max |x| and sum of x^2, vectorised over the aligned middle of the buffer. */
+    template <typename SampleType>
+    static void measurePeakAndPower(const SampleType* x, int n, SampleType& peak, double& sumSquares) noexcept
+    {
+        using Vec = juce::dsp::SIMDRegister<SampleType>;
+        constexpr auto width = (int)Vec::SIMDNumElements;
+
+        SampleType scalarPeak{}, scalarSum{};
+        int i = 0;
+
+        for (; i < n && ! Vec::isSIMDAligned(x + i); ++i)
+        {
+            scalarPeak = juce::jmax(scalarPeak, std::abs(x[i]));
+            scalarSum += x[i] * x[i];
+        }
+
+        auto vecPeak = Vec::expand(SampleType(0));
+        auto vecSum = Vec::expand(SampleType(0));
+
+        for (; i + width <= n; i += width)
+        {
+            auto v = Vec::fromRawArray(x + i);
+            vecPeak = Vec::max(vecPeak, Vec::abs(v));
+            vecSum += v * v;
+        }
+
+        for (; i < n; ++i)
+        {
+            scalarPeak = juce::jmax(scalarPeak, std::abs(x[i]));
+            scalarSum += x[i] * x[i];
+        }
+
+        for (size_t lane = 0; lane < Vec::SIMDNumElements; ++lane)
+            scalarPeak = juce::jmax(scalarPeak, vecPeak.get(lane));
+
+        peak = scalarPeak;
+        sumSquares = (double)scalarSum + (double)vecSum.sum();
+    }
+
+    /** Polyphase 4x interpolation; returns the largest |x| on and between
+        samples (phase 0 reproduces the input, delayed). */
+    template <typename SampleType>
+    float measureTruePeak(int ch, const SampleType* x, int n) noexcept
+    {
+        auto& history = truePeakHistory[(size_t)ch];
+        auto& position = truePeakPosition[(size_t)ch];
+        float peak = 0;
+
+        for (int i = 0; i < n; ++i)
+        {
+            // The history is stored twice, so the taps are always one contiguous run.
+            position = position == 0 ? truePeakTaps - 1 : position - 1;
+            history[(size_t)position] = history[(size_t)(position + truePeakTaps)] = (float)x[i];
+
+            const auto* taps = history.data() + position;
+            float acc[truePeakFactor] = {};
+
+            // Phases are the inner dimension so this vectorises as one 4-wide MAC per tap.
+            for (int t = 0; t < truePeakTaps; ++t)
+                for (int p = 0; p < truePeakFactor; ++p)
+                    acc[p] += phaseCoefficients[t][p] * taps[t];
+
+            for (int p = 0; p < truePeakFactor; ++p)
+                peak = juce::jmax(peak, std::abs(acc[p]));
+        }
+
+        return peak;
+    }
+
+    /** Sum of the K-weighted (pre-filter, then RLB high pass) squares. */
+    template <typename SampleType>
+    double kWeightedPower(int ch, const SampleType* x, int n) noexcept
+    {
+        auto& state = kState[(size_t)ch];
+        double sum = 0;
+
+        for (int i = 0; i < n; ++i)
+        {
+            auto y = (double)x[i];
+
+            for (int s = 0; s < 2; ++s)
+            {
+                auto& c = kCoefficients[s];
+                auto out = c.b0 * y + state[s][0];
+                state[s][0] = c.b1 * y - c.a1 * out + state[s][1];
+                state[s][1] = c.b2 * y - c.a2 * out;
+                y = out;
+            }
+
+            sum += y * y;
+        }
+
+        return sum;
+    }
+
+    static void holdMaximum(std::atomic<float>& held, float value) noexcept
+    {
+        auto current = held.load(std::memory_order_relaxed);
+        while (value > current && ! held.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    void finishBin(int numChannels) noexcept;
+
+    //==============================================================================
+    alignas(16) float phaseCoefficients[truePeakTaps][truePeakFactor] = {};
+    std::array<std::array<float, 2 * truePeakTaps>, maxChannels> truePeakHistory{};
+    std::array<int, maxChannels> truePeakPosition{};
+
+    BiquadCoefficients kCoefficients[2];
+    double kState[maxChannels][2][2] = {};   // per channel, per stage: s1, s2
+
+    int binLength = 4410, binFill = 0;
+    double binSquares[maxChannels] = {};
+    double binWeightedSquares = 0;
+
+    // Ring of finished bins, newest at loudnessBinIndex.
+    std::array<double, shortTermBins> loudnessBins{};
+    std::array<std::array<double, rmsBins>, maxChannels> squareBins{};
+    int loudnessBinIndex = 0, binsFilled = 0;
+
+    // Published
+    std::atomic<int> publishedChannels{ 0 };
+    std::atomic<float> heldPeak[maxChannels], heldTruePeak[maxChannels], rms[maxChannels];
+    std::atomic<float> momentary{ silenceLufs }, shortTerm{ silenceLufs };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeter)
+};
@@ -0,0 +1,118 @@
+#include "LevelMeterView.h"
+
+LevelMeterView::LevelMeterView(SimpleEQAudioProcessor& processorToWatch)
+    : processor(processorToWatch)
+{
+}
+
+void LevelMeterView::start()
+{
+    if (std::exchange(started, true))
+        return;
+
+    processor.addMeterViewer();
+    startTimerHz(refreshRateHz);
+}
+
+LevelMeterView::~LevelMeterView()
+{
+    if (started)
+        processor.removeMeterViewer();
+}
+
+void LevelMeterView::update(Display& display, const LevelMeter::Readings& readings, float decayDb)
+{
+    display.numChannels = readings.numChannels;
+
+    for (int ch = 0; ch < LevelMeter::maxChannels; ++ch)
+    {
+        auto peak = juce::Decibels::gainToDecibels(readings.peak[ch], minDecibels);
+        display.peakDb[ch] = juce::jmax(peak, display.peakDb[ch] - decayDb);
+        display.rmsDb[ch] = juce::Decibels::gainToDecibels(readings.rms[ch], minDecibels);
+    }
+}
+
+void LevelMeterView::timerCallback()
+{
+    // Peaks fall at 20 dB/s once the signal drops.
+    constexpr auto decayDb = 20.0f / refreshRateHz;
+
+    update(input, processor.getInputMeter().getReadings(), decayDb);
+
+    auto readings = processor.getOutputMeter().getReadings();
+    update(output, readings, decayDb);
+
+    for (int ch = 0; ch < readings.numChannels; ++ch)
+        maxTruePeakDb = juce::jmax(maxTruePeakDb, juce::Decibels::gainToDecibels(readings.truePeak[ch], minDecibels));
+
+    momentaryLufs = readings.momentaryLufs;
+    shortTermLufs = readings.shortTermLufs;
+
+    repaint();
+}
+
+void LevelMeterView::mouseDown(const juce::MouseEvent&)
+{
+    maxTruePeakDb = minDecibels;
+    repaint();
+}
+
+void LevelMeterView::paintBars(juce::Graphics& g, juce::Rectangle<float> area, const Display& display, const juce::String& label) const
+{
+    g.setColour(juce::Colours::white.withAlpha(0.8f));
+    g.drawText(label, area.removeFromTop(14.0f), juce::Justification::centred);
+
+    auto toY = [&area](float db)
+    {
+        return juce::jmap(juce::jlimit(minDecibels, maxDecibels, db), minDecibels, maxDecibels, area.getBottom(), area.getY());
+    };
+
+    auto numChannels = juce::jmax(1, display.numChannels);
+    auto barWidth = area.getWidth() / (float)numChannels;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto bar = area.withX(area.getX() + ch * barWidth).withWidth(barWidth).reduced(2.0f, 0.0f);
+
+        g.setColour(juce::Colours::white.withAlpha(0.1f));
+        g.fillRect(bar);
+
+        auto rmsTop = toY(display.rmsDb[ch]);
+        g.setColour(display.peakDb[ch] > 0.0f ? juce::Colours::orangered : juce::Colours::lightgreen.withAlpha(0.8f));
+        g.fillRect(bar.withTop(rmsTop));
+
+        g.setColour(juce::Colours::white);
+        g.fillRect(bar.withY(toY(display.peakDb[ch])).withHeight(1.5f));
+    }
+
+    // 0 dBFS
+    g.setColour(juce::Colours::white.withAlpha(0.4f));
+    g.drawHorizontalLine(juce::roundToInt(toY(0.0f)), area.getX(), area.getRight());
+}
+
+void LevelMeterView::paint(juce::Graphics& g)
+{
+    g.setColour(juce::Colours::black.withAlpha(0.6f));
+    g.fillRoundedRectangle(getLocalBounds().toFloat(), 4.0f);
+
+    g.setFont(juce::FontOptions(11.0f));
+
+    auto area = getLocalBounds().toFloat().reduced(4.0f);
+    auto readouts = area.removeFromBottom(42.0f);
+
+    auto half = area.getWidth() / 2.0f;
+    paintBars(g, area.removeFromLeft(half).reduced(2.0f, 0.0f), input, "IN");
+    paintBars(g, area.reduced(2.0f, 0.0f), output, "OUT");
+
+    auto format = [](float value, const juce::String& unit)
+    {
+        return value <= LevelMeter::silenceLufs || value <= minDecibels ? "-inf " + unit : juce::String(value, 1) + " " + unit;
+    };
+
+    g.setColour(maxTruePeakDb > 0.0f ? juce::Colours::orangered : juce::Colours::white);
+    g.drawText("TP " + format(maxTruePeakDb, "dB"), readouts.removeFromTop(14.0f), juce::Justification::centredLeft);
+
+    g.setColour(juce::Colours::white);
+    g.drawText("M " + format(momentaryLufs, "LUFS"), readouts.removeFromTop(14.0f), juce::Justification::centredLeft);
+    g.drawText("S " + format(shortTermLufs, "LUFS"), readouts.removeFromTop(14.0f), juce::Justification::centredLeft);
+}
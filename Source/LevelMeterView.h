@@ -0,0 +1,50 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/**
+    Input and output bars (RMS fill, decaying peak line) plus the output's
+    maximum true peak and momentary/short-term loudness. Registers itself as
+    a meter viewer from start() until it is destroyed; click it to reset the
+    maximum.
+*/
+class LevelMeterView : public juce::Component,
+                       private juce::Timer
+{
+public:
+    explicit LevelMeterView(SimpleEQAudioProcessor& processorToWatch);
+    ~LevelMeterView() override;
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent&) override;
+
+    void start();
+
+    static constexpr float minDecibels = -60.0f, maxDecibels = 6.0f;
+
+private:
+    void timerCallback() override;
+
+    struct Display
+    {
+        int numChannels = 0;
+        float peakDb[LevelMeter::maxChannels] = { minDecibels, minDecibels };
+        float rmsDb[LevelMeter::maxChannels] = { minDecibels, minDecibels };
+    };
+
+    static void update(Display& display, const LevelMeter::Readings& readings, float decayDb);
+    void paintBars(juce::Graphics& g, juce::Rectangle<float> area, const Display& display, const juce::String& label) const;
+
+    SimpleEQAudioProcessor& processor;
+    bool started = false;
+
+    Display input, output;
+    float maxTruePeakDb = minDecibels;
+    float momentaryLufs = LevelMeter::silenceLufs, shortTermLufs = LevelMeter::silenceLufs;
+
+    static constexpr int refreshRateHz = 30;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeterView)
+};
@@ -0,0 +1,149 @@
+#include "LinearPhaseEQ.h"
+
+LinearPhaseEQ::LinearPhaseEQ()
+    : juce::Thread("darQ Linear Phase Designer")
+{
+}
+
+LinearPhaseEQ::~LinearPhaseEQ()
+{
+    stopThread(2000);
+}
+
+void LinearPhaseEQ::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    convolution.prepare(spec);
+
+    {
+        const juce::SpinLock::ScopedLockType sl(targetLock);
+        target.sampleRate = spec.sampleRate;
+    }
+
+    if (! isThreadRunning())
+        startThread(juce::Thread::Priority::low);
+
+    notify();
+}
+
+void LinearPhaseEQ::reset()
+{
+    convolution.reset();
+}
+
+void LinearPhaseEQ::setTarget(const ChainSettings& mid, const ChainSettings& side, int firOrder, bool midSide)
+{
+    firOrder = juce::jlimit(minFirOrder, maxFirOrder, firOrder);
+
+    // Never wait on the designer; if it holds the lock we'll try next block.
+    const juce::SpinLock::ScopedTryLockType sl(targetLock);
+    DARQ_RT_NOTE_LOCK("LinearPhaseEQ::setTarget (try-lock)");
+
+    if (! sl.isLocked())
+        return;
+
+    auto next = target;
+    next.mid = mid;
+    next.side = midSide ? side : mid;
+    next.firOrder = firOrder;
+    next.midSide = midSide;
+
+    if (next == target)
+        return;
+
+    target = next;
+
+    // Signalling the designer takes the thread's event mutex.
+    DARQ_RT_NOTE_LOCK("LinearPhaseEQ::setTarget (notify)");
+    notify();
+}
+
+void LinearPhaseEQ::process(juce::dsp::AudioBlock<float>& block)
+{
+    juce::dsp::ProcessContextReplacing<float> context(block);
+    convolution.process(context);
+}
+
+void LinearPhaseEQ::run()
+{
+    Target designed;
+
+    while (! threadShouldExit())
+    {
+        Target next;
+
+        {
+            const juce::SpinLock::ScopedLockType sl(targetLock);
+            next = target;
+        }
+
+        // Parameter moves arrive every block; coalesce them rather than
+        // designing a kernel for each intermediate value.
+        if (next.firOrder > 0 && next != designed)
+        {
+            designKernel(next);
+            designed = next;
+        }
+
+        wait(-1);
+    }
+}
+
+void LinearPhaseEQ::designKernel(const Target& t)
+{
+    juce::AudioBuffer<float> kernel(t.midSide ? 2 : 1, 1 << t.firOrder);
+
+    designChannel(t.mid, t.firOrder, t.sampleRate, kernel.getWritePointer(0));
+
+    if (t.midSide)
+        designChannel(t.side, t.firOrder, t.sampleRate, kernel.getWritePointer(1));
+
+    convolution.loadImpulseResponse(std::move(kernel), t.sampleRate,
+        t.midSide ? juce::dsp::Convolution::Stereo::yes : juce::dsp::Convolution::Stereo::no,
+        juce::dsp::Convolution::Trim::no,
+        juce::dsp::Convolution::Normalise::no);
+}
+
+void LinearPhaseEQ::designChannel(const ChainSettings& chainSettings, int firOrder, double sampleRate, float* h)
+{
+    const auto firLength = 1 << firOrder;
+    const auto numBins = firLength / 2 + 1;
+
+    juce::HeapBlock<double> frequencies(numBins), magnitudes(numBins);
+
+    for (int i = 0; i < numBins; ++i)
+        frequencies[i] = sampleRate * i / firLength;
+
+    getChainMagnitudes(chainSettings, sampleRate, frequencies.get(), magnitudes.get(), (size_t)numBins);
+
+    // Zero-phase spectrum -> real, even impulse centred on sample 0.
+    juce::dsp::FFT fft(firOrder);
+    juce::HeapBlock<float> data(2 * firLength, true);
+
+    auto expectedEnergy = 0.0;
+
+    for (int i = 0; i < numBins; ++i)
+    {
+        data[2 * i] = (float)magnitudes[i];
+        expectedEnergy += magnitudes[i] * magnitudes[i] * ((i == 0 || i == numBins - 1) ? 1.0 : 2.0);
+    }
+
+    fft.performRealOnlyInverseTransform(data.get());
+
+    // Rotate by half a length so the kernel is causal and symmetric about
+    // firLength / 2, then taper it.
+    auto actualEnergy = 0.0;
+
+    for (int n = 0; n < firLength; ++n)
+    {
+        auto tap = data[(n + firLength / 2) % firLength];
+        actualEnergy += (double)tap * tap;
+
+        auto w = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * n / firLength);
+        h[n] = (float)(tap * w);
+    }
+
+    // Parseval: whatever scaling the inverse FFT applies, match the energy
+    // of the requested response.
+    if (actualEnergy > 0.0)
+        juce::FloatVectorOperations::multiply(h, (float)std::sqrt(expectedEnergy / firLength / actualEnergy), firLength);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "EQDesign.h"
+#include "RealtimeMonitor.h"
+
+//==============================================================================
+/**
+    Linear-phase version of the EQ chain.
+
+    The magnitude response of the current ChainSettings is turned into a
+    symmetric FIR on a background thread and run through a non-uniformly
+    partitioned juce::dsp::Convolution, which crossfades to each new kernel as
+    it arrives. The audio thread only hands over settings; it never designs.
+
+    The FIR is centred in its buffer, so the added latency is half its length.
+*/
+class LinearPhaseEQ : private juce::Thread
+{
+public:
+    static constexpr int minFirOrder = 12;   // 4096 taps
+    static constexpr int maxFirOrder = 16;   // 65536 taps
+
+    LinearPhaseEQ();
+    ~LinearPhaseEQ() override;
+
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    /** Audio thread: requests a new kernel if the settings or length changed.
+        With midSide set the kernel is stereo: channel 0 filters mid with the
+        first settings and channel 1 side with the second; the caller encodes
+        and decodes around process(). */
+    void setTarget(const ChainSettings& mid, const ChainSettings& side, int firOrder, bool midSide);
+
+    void process(juce::dsp::AudioBlock<float>& block);
+
+    /** The latency of the kernel the convolution runs now, which lags a new
+        length until its kernel has been designed and loaded. */
+    int getCurrentLatencySamples() const { return convolution.getCurrentIRSize() / 2; }
+
+    /** True once the convolution runs a kernel of the given length. */
+    bool isKernelReady(int firOrder) const { return convolution.getCurrentIRSize() == (1 << firOrder); }
+
+private:
+    void run() override;
+    struct Target
+    {
+        ChainSettings mid, side;
+        int firOrder = -1;
+        bool midSide = false;
+        double sampleRate = 44100.0;
+
+        bool operator==(const Target& other) const
+        {
+            return mid == other.mid && side == other.side && firOrder == other.firOrder
+                && midSide == other.midSide && sampleRate == other.sampleRate;
+        }
+
+        bool operator!=(const Target& other) const { return !(*this == other); }
+    };
+
+    void designKernel(const Target& target);
+    static void designChannel(const ChainSettings& chainSettings, int firOrder, double sampleRate, float* dest);
+
+    // Head partition of the convolution; later partitions grow, which keeps
+    // the cost of 64k-tap kernels manageable without adding latency.
+    static constexpr int headSize = 512;
+
+    juce::dsp::Convolution convolution{ juce::dsp::Convolution::NonUniform{ headSize } };
+
+    juce::SpinLock targetLock;
+    Target target;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearPhaseEQ)
+};
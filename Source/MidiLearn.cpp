@@ -0,0 +1,154 @@
+#include "MidiLearn.h"
+
+MidiLearn::MidiLearn(juce::AudioProcessorValueTreeState& apvts)
+{
+	for (auto* p : apvts.processor.getParameters())
+		if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(p))
+			targets.push_back({ ranged, apvts.getRawParameterValue(ranged->getParameterID()) });
+
+	latestValues = std::make_unique<std::atomic<float>[]>(targets.size());
+	pendingNotification = std::make_unique<std::atomic<bool>[]>(targets.size());
+
+	for (size_t i = 0; i < targets.size(); ++i)
+	{
+		latestValues[i].store(0.0f);
+		pendingNotification[i].store(false);
+	}
+
+	clearAllMappings();
+	startTimerHz(30);
+}
+
+MidiLearn::~MidiLearn()
+{
+	stopTimer();
+}
+
+int MidiLearn::indexOf(const juce::String& parameterID) const
+{
+	for (size_t i = 0; i < targets.size(); ++i)
+		if (targets[i].parameter->getParameterID() == parameterID)
+			return (int)i;
+
+	return -1;
+}
+
+juce::String MidiLearn::getParameterID(int index) const
+{
+	return juce::isPositiveAndBelow(index, getNumParameters()) ? targets[(size_t)index].parameter->getParameterID() : juce::String();
+}
+
+//==============================================================================
+int MidiLearn::getController(int parameterIndex) const noexcept
+{
+	for (int controller = 0; controller < numControllers; ++controller)
+		if (parameterForController[(size_t)controller].load(std::memory_order_relaxed) == parameterIndex)
+			return controller;
+
+	return -1;
+}
+
+void MidiLearn::clearMapping(int parameterIndex) noexcept
+{
+	for (auto& mapped : parameterForController)
+		if (mapped.load(std::memory_order_relaxed) == parameterIndex)
+			mapped.store(-1, std::memory_order_relaxed);
+}
+
+void MidiLearn::clearAllMappings() noexcept
+{
+	for (auto& mapped : parameterForController)
+		mapped.store(-1, std::memory_order_relaxed);
+}
+
+std::vector<std::pair<int, int>> MidiLearn::getMappings() const
+{
+	std::vector<std::pair<int, int>> mappings;
+
+	for (int controller = 0; controller < numControllers; ++controller)
+	{
+		auto parameter = parameterForController[(size_t)controller].load(std::memory_order_relaxed);
+		if (parameter >= 0)
+			mappings.emplace_back(controller, parameter);
+	}
+
+	return mappings;
+}
+
+void MidiLearn::setMappings(const std::vector<std::pair<int, int>>& mappings) noexcept
+{
+	clearAllMappings();
+
+	for (auto& [controller, parameter] : mappings)
+		if (juce::isPositiveAndBelow(controller, numControllers) && juce::isPositiveAndBelow(parameter, getNumParameters()))
+			parameterForController[(size_t)controller].store(parameter, std::memory_order_relaxed);
+}
+
+juce::String MidiLearn::describeController(int controller)
+{
+	return "CC " + juce::String(controller % 128) + " (ch " + juce::String(controller / 128 + 1) + ")";
+}
+
+//==============================================================================
+MidiLearn::Change MidiLearn::resolve(const juce::MidiMessage& message) noexcept
+{
+	if (! message.isController())
+		return {};
+
+	auto controller = (message.getChannel() - 1) * 128 + message.getControllerNumber();
+	auto& mapped = parameterForController[(size_t)controller];
+
+	auto learningParameter = learning.load(std::memory_order_relaxed);
+	if (learningParameter >= 0 && learning.compare_exchange_strong(learningParameter, -1))
+	{
+		// One controller per parameter: drop the parameter's previous mapping.
+		clearMapping(learningParameter);
+		mapped.store(learningParameter, std::memory_order_relaxed);
+	}
+
+	auto parameter = mapped.load(std::memory_order_relaxed);
+	if (parameter < 0)
+		return {};
+
+	auto& target = targets[(size_t)parameter];
+	auto normalised = (float)message.getControllerValue() / 127.0f;
+	auto value = target.parameter->convertFrom0to1(normalised);
+
+	if (target.rawValue->load(std::memory_order_relaxed) == value)
+		return {};
+
+	return { parameter, value };
+}
+
+void MidiLearn::apply(const Change& change) noexcept
+{
+	if (change.parameter < 0)
+		return;
+
+	auto index = (size_t)change.parameter;
+	targets[index].rawValue->store(change.value, std::memory_order_relaxed);
+	latestValues[index].store(change.value, std::memory_order_relaxed);
+	pendingNotification[index].store(true, std::memory_order_release);
+}
+
+void MidiLearn::reassertPending() noexcept
+{
+	for (size_t i = 0; i < targets.size(); ++i)
+		if (pendingNotification[i].load(std::memory_order_acquire))
+			targets[i].rawValue->store(latestValues[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void MidiLearn::timerCallback()
+{
+	for (size_t i = 0; i < targets.size(); ++i)
+	{
+		if (! pendingNotification[i].exchange(false, std::memory_order_acq_rel))
+			continue;
+
+		auto* parameter = targets[i].parameter;
+		auto normalised = parameter->convertTo0to1(latestValues[i].load(std::memory_order_relaxed));
+
+		if (parameter->getValue() != normalised)
+			parameter->setValueNotifyingHost(normalised);
+	}
+}
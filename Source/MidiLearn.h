@@ -0,0 +1,87 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+	MIDI CC to parameter mapping.
+
+	The audio thread resolves each controller message to a parameter and
+	writes the new value straight into the value the DSP reads, so the
+	processor can split the block at the event and pick it up sample
+	accurately. The host is told on the message thread: the audio thread only
+	stores the latest value per parameter and flags it, and a timer pushes
+	the flagged ones through setValueNotifyingHost. Any number of events per
+	block costs a few atomic stores each and never allocates or locks.
+
+	Parameters are addressed by their index in getParameters() order, the
+	same order PresetBank and the saved state use.
+*/
+class MidiLearn : private juce::Timer
+{
+public:
+	static constexpr int numControllers = 16 * 128;
+
+	explicit MidiLearn(juce::AudioProcessorValueTreeState& apvts);
+	~MidiLearn() override;
+
+	int getNumParameters() const noexcept { return (int)targets.size(); }
+	int indexOf(const juce::String& parameterID) const;
+	juce::String getParameterID(int index) const;
+
+	//==============================================================================
+	// Message thread
+	void startLearning(int parameterIndex) noexcept { learning.store(parameterIndex); }
+	void stopLearning() noexcept { learning.store(-1); }
+	int getLearningParameter() const noexcept { return learning.load(); }
+
+	/** Controller (channel * 128 + CC number) mapped to the parameter, or -1. */
+	int getController(int parameterIndex) const noexcept;
+	void clearMapping(int parameterIndex) noexcept;
+	void clearAllMappings() noexcept;
+
+	/** (controller, parameter index) pairs, for saving. */
+	std::vector<std::pair<int, int>> getMappings() const;
+	void setMappings(const std::vector<std::pair<int, int>>& mappings) noexcept;
+
+	static juce::String describeController(int controller);
+
+	//==============================================================================
+	// Audio thread
+	struct Change
+	{
+		int parameter = -1;
+		float value = 0;
+	};
+
+	/** The parameter change the message maps to, if any. While learning, the
+		first controller that arrives is mapped to the learning parameter. */
+	Change resolve(const juce::MidiMessage& message) noexcept;
+
+	/** Makes the change visible to the DSP and queues it for the host. */
+	void apply(const Change& change) noexcept;
+
+	/** Re-applies values the host hasn't been told about yet, in case a
+		notification carrying an older value overwrote them. */
+	void reassertPending() noexcept;
+
+private:
+	void timerCallback() override;
+
+	struct Target
+	{
+		juce::RangedAudioParameter* parameter = nullptr;
+		std::atomic<float>* rawValue = nullptr;
+	};
+
+	std::vector<Target> targets;
+
+	// One entry per controller; -1 when unmapped.
+	std::array<std::atomic<int>, numControllers> parameterForController;
+	std::atomic<int> learning{ -1 };
+
+	std::unique_ptr<std::atomic<float>[]> latestValues;
+	std::unique_ptr<std::atomic<bool>[]> pendingNotification;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MidiLearn)
+};
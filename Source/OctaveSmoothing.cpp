@@ -0,0 +1,51 @@
+#include "OctaveSmoothing.h"
+
+int OctaveSmoothing::getBandsPerOctave(int fraction) noexcept
+{
+    constexpr int bands[numFractions] = { 0, 1, 3, 6, 12, 24 };
+    return bands[juce::jlimit(0, numFractions - 1, fraction)];
+}
+
+const char* OctaveSmoothing::getName(int fraction) noexcept
+{
+    constexpr const char* names[numFractions] = { "Off", "1/1 octave", "1/3 octave", "1/6 octave", "1/12 octave", "1/24 octave" };
+    return names[juce::jlimit(0, numFractions - 1, fraction)];
+}
+
+OctaveSmoothing::OctaveSmoothing(int fftSize, int bandsPerOctave)
+    : lowEdge((size_t)(fftSize / 2 + 1)),
+      highEdge(lowEdge.size()),
+      prefix(lowEdge.size() + 1)
+{
+    jassert(bandsPerOctave > 0);
+
+    auto lastBin = fftSize / 2;
+    auto halfBand = std::pow(2.0, 0.5 / bandsPerOctave);
+
+    // DC has no octave around it and stays as it is.
+    lowEdge[0] = highEdge[0] = 0;
+
+    for (int bin = 1; bin <= lastBin; ++bin)
+    {
+        lowEdge[(size_t)bin] = juce::jlimit(1, bin, juce::roundToInt(bin / halfBand));
+        highEdge[(size_t)bin] = juce::jlimit(bin, lastBin, juce::roundToInt(bin * halfBand));
+    }
+}
+
+void OctaveSmoothing::process(float* magnitudes) noexcept
+{
+    auto numBins = lowEdge.size();
+
+    prefix[0] = 0.0;
+    for (size_t bin = 0; bin < numBins; ++bin)
+        prefix[bin + 1] = prefix[bin] + (double)magnitudes[bin] * (double)magnitudes[bin];
+
+    for (size_t bin = 0; bin < numBins; ++bin)
+    {
+        auto low = (size_t)lowEdge[bin];
+        auto high = (size_t)highEdge[bin];
+        auto power = (prefix[high + 1] - prefix[low]) / (double)(high - low + 1);
+
+        magnitudes[bin] = (float)std::sqrt(juce::jmax(0.0, power));
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Fractional-octave smoothing of a magnitude spectrum.
+
+    Every bin is replaced by the RMS of the bins within half a band either
+    side of it. The band edges of each bin depend only on the FFT size and
+    the fraction (bins are proportional to frequency whatever the sample
+    rate), so they are worked out once up front; process() is then a
+    prefix sum over the power spectrum and one subtraction per bin, linear
+    in the number of bins however wide the bands are.
+*/
+class OctaveSmoothing
+{
+public:
+    /** Off, 1/1, 1/3, 1/6, 1/12 and 1/24 octave. */
+    static constexpr int numFractions = 6;
+    static constexpr int thirdOctave = 2;
+    static int getBandsPerOctave(int fraction) noexcept;
+    static const char* getName(int fraction) noexcept;
+
+    OctaveSmoothing(int fftSize, int bandsPerOctave);
+
+    int getNumBins() const noexcept { return (int)lowEdge.size(); }
+
+    /** Smooths fftSize / 2 + 1 magnitudes in place. */
+    void process(float* magnitudes) noexcept;
+
+private:
+    std::vector<int> lowEdge, highEdge;   // inclusive
+    std::vector<double> prefix;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OctaveSmoothing)
+};
@@ -12,17 +12,18 @@
 //==============================================================================
 SimpleEQAudioProcessorEditor::SimpleEQAudioProcessorEditor(SimpleEQAudioProcessor& p)
 	: AudioProcessorEditor(&p), audioProcessor(p),
-	peakFreqSliderAttachment(audioProcessor.apvts, "Peak Freq", peakFreqSlider),
 	spectrumAnalyzer(audioProcessor),
-	peakGainSliderAttachment(audioProcessor.apvts, "Peak Gain", peakGainSlider),
-	peakQualitySliderAttachment(audioProcessor.apvts, "Peak Quality", peakQualitySlider),
-	lowCutFreqSliderAttachment(audioProcessor.apvts, "LowCut Freq", lowCutFreqSlider),
-	highCutFreqSliderAttachment(audioProcessor.apvts, "HighCut Freq", highCutFreqSlider),
-	lowCutSlopeSliderAttachment(audioProcessor.apvts, "LowCut Slope", lowCutSlopeSlider),
-	highCutSlopeSliderAttachment(audioProcessor.apvts, "HighCut Slope", highCutSlopeSlider)
+	levelMeterView(audioProcessor),
+	stereoScopeView(audioProcessor)
+#if DARQ_INSTRUMENTATION
+	, realtimeMonitorView(audioProcessor.getRealtimeMonitor())
+#endif
 {
+	attachSliders({});
 
 	addAndMakeVisible(spectrumAnalyzer);
+	addAndMakeVisible(levelMeterView);
+	addAndMakeVisible(stereoScopeView);
 
 
 	for (auto* comp : getComps())
@@ -48,6 +49,10 @@ SimpleEQAudioProcessorEditor::SimpleEQAudioProcessorEditor(SimpleEQAudioProcesso
 	highCutFreqSlider.setLookAndFeel(&customLookAndFeel);
 	lowCutSlopeSlider.setLookAndFeel(&customLookAndFeel);
 	highCutSlopeSlider.setLookAndFeel(&customLookAndFeel);
+	peakThresholdSlider.setLookAndFeel(&customLookAndFeel);
+	peakRatioSlider.setLookAndFeel(&customLookAndFeel);
+	peakAttackSlider.setLookAndFeel(&customLookAndFeel);
+	peakReleaseSlider.setLookAndFeel(&customLookAndFeel);
 
 	peakFreqSlider.setName("Peak Freq");
 	peakGainSlider.setName("Gain");
@@ -56,8 +61,51 @@ SimpleEQAudioProcessorEditor::SimpleEQAudioProcessorEditor(SimpleEQAudioProcesso
 	lowCutSlopeSlider.setName("Low Slope");
 	highCutFreqSlider.setName("High Cut Freq");
 	highCutSlopeSlider.setName("High Slope");
+	peakThresholdSlider.setName("Threshold");
+	peakRatioSlider.setName("Ratio");
+	peakAttackSlider.setName("Attack");
+	peakReleaseSlider.setName("Release");
 
-	//backgroundImage = juce::ImageCache::getFromMemory(BinaryData::bg_png, BinaryData::bg_pngSize);
+	initChoiceBox(oversamplingBox, oversamplingAttachment, "Oversampling");
+	initChoiceBox(oversamplingFilterBox, oversamplingFilterAttachment, "Oversampling Filter");
+	initToggle(linearPhaseButton, linearPhaseAttachment, "Linear Phase");
+	initChoiceBox(firLengthBox, firLengthAttachment, "FIR Length");
+	initToggle(doublePrecisionButton, doublePrecisionAttachment, "Double Precision");
+	initChoiceBox(stereoModeBox, stereoModeAttachment, "Stereo Mode");
+	initChoiceBox(peakDesignBox, peakDesignAttachment, "Peak Design");
+	initChoiceBox(crossoverBox, crossoverAttachment, "Crossover");
+	initToggle(sidechainButton, sidechainAttachment, "Sidechain");
+	addAndMakeVisible(peakDynamicButton);
+
+	editSideButton.onClick = [this]
+	{
+		attachSliders(editSideButton.getToggleState() ? SimpleEQAudioProcessor::sideParameterPrefix : juce::String());
+	};
+	addAndMakeVisible(editSideButton);
+
+	initPresetControls();
+
+	learnableControls.insert(learnableControls.end(),
+	{
+		{ &peakFreqSlider, "Peak Freq", true },
+		{ &peakGainSlider, "Peak Gain", true },
+		{ &peakQualitySlider, "Peak Quality", true },
+		{ &lowCutFreqSlider, "LowCut Freq", true },
+		{ &highCutFreqSlider, "HighCut Freq", true },
+		{ &lowCutSlopeSlider, "LowCut Slope", true },
+		{ &highCutSlopeSlider, "HighCut Slope", true },
+		{ &peakThresholdSlider, "Peak Threshold", true },
+		{ &peakRatioSlider, "Peak Ratio", true },
+		{ &peakAttackSlider, "Peak Attack", true },
+		{ &peakReleaseSlider, "Peak Release", true },
+		{ &peakDynamicButton, "Peak Dynamic", true },
+		{ &morphAmountSlider, "Morph Amount", false }
+	});
+	addMouseListener(this, true);
+
+#if DARQ_INSTRUMENTATION
+	addAndMakeVisible(realtimeMonitorView);
+#endif
 
 	setResizable(true, true);
 	setResizeLimits(300, 200, 1200, 800);
@@ -76,19 +124,120 @@ SimpleEQAudioProcessorEditor::~SimpleEQAudioProcessorEditor()
 	highCutFreqSlider.setLookAndFeel(nullptr);
 	lowCutSlopeSlider.setLookAndFeel(nullptr);
 	highCutSlopeSlider.setLookAndFeel(nullptr);
+	peakThresholdSlider.setLookAndFeel(nullptr);
+	peakRatioSlider.setLookAndFeel(nullptr);
+	peakAttackSlider.setLookAndFeel(nullptr);
+	peakReleaseSlider.setLookAndFeel(nullptr);
 }
 
 //==============================================================================
 void SimpleEQAudioProcessorEditor::paint(juce::Graphics& g)
 {
-	//g.drawImage(backgroundImage, getLocalBounds().toFloat());
 	g.fillAll(juce::Colours::black);
+
+	// Drawn 1:1 at the display's pixel size; until the cache has it, the
+	// plain fill above is the first frame.
+	auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+	juce::Point<int> pixelSize(juce::roundToInt((float)getWidth() * scale), juce::roundToInt((float)getHeight() * scale));
+
+	auto background = backgroundCache->get(pixelSize,
+		[safeThis = juce::Component::SafePointer<SimpleEQAudioProcessorEditor>(this)]
+		{
+			if (safeThis != nullptr)
+				safeThis->repaint();
+		});
+
+	if (background.isValid())
+		g.drawImage(background, getLocalBounds().toFloat());
+
+	if (! viewsStarted)
+	{
+		viewsStarted = true;
+
+		juce::MessageManager::callAsync([safeThis = juce::Component::SafePointer<SimpleEQAudioProcessorEditor>(this)]
+		{
+			if (safeThis != nullptr)
+				safeThis->startViews();
+		});
+	}
+}
+
+void SimpleEQAudioProcessorEditor::startViews()
+{
+	spectrumAnalyzer.start();
+	levelMeterView.start();
+	stereoScopeView.start();
+}
+
+void SimpleEQAudioProcessorEditor::mouseDown(const juce::MouseEvent& e)
+{
+	if (! e.mods.isPopupMenu() || e.eventComponent == this)
+		return;
+
+	for (auto& control : learnableControls)
+	{
+		if (control.component == e.eventComponent || control.component->isParentOf(e.eventComponent))
+		{
+			showMidiLearnMenu(control);
+			return;
+		}
+	}
+}
+
+void SimpleEQAudioProcessorEditor::showMidiLearnMenu(const LearnableControl& control)
+{
+	auto& midiLearn = audioProcessor.getMidiLearn();
+
+	auto prefix = control.followsEditSide && editSideButton.getToggleState() ? SimpleEQAudioProcessor::sideParameterPrefix : juce::String();
+	auto index = midiLearn.indexOf(prefix + control.parameterID);
+	if (index < 0)
+		return;
+
+	auto controller = midiLearn.getController(index);
+	auto learning = midiLearn.getLearningParameter() == index;
+
+	juce::PopupMenu menu;
+	menu.addSectionHeader(prefix + control.parameterID);
+	menu.addItem(learning ? "Cancel MIDI Learn" : "MIDI Learn", [&midiLearn, index, learning]
+	{
+		if (learning)
+			midiLearn.stopLearning();
+		else
+			midiLearn.startLearning(index);
+	});
+	menu.addItem("Clear " + (controller >= 0 ? MidiLearn::describeController(controller) : juce::String("MIDI mapping")),
+		controller >= 0, false, [&midiLearn, index] { midiLearn.clearMapping(index); });
+
+	menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(control.component));
 }
 
 void SimpleEQAudioProcessorEditor::resized()
 {
 	auto bounds = getLocalBounds().reduced(20); // margen general
 
+	auto optionsArea = bounds.removeFromTop(24);
+	auto options = getOptionComps();
+	auto optionWidth = optionsArea.getWidth() / (int)options.size();
+	for (auto* comp : options)
+		comp->setBounds(optionsArea.removeFromLeft(optionWidth).reduced(4, 0));
+
+	auto presetArea = bounds.removeFromTop(28).withTrimmedTop(4);
+	auto presets = getPresetComps();
+	auto presetWidth = presetArea.getWidth() / (int)presets.size();
+	for (auto* comp : presets)
+		comp->setBounds(presetArea.removeFromLeft(presetWidth).reduced(4, 0));
+
+	auto meterColumn = bounds.removeFromRight(90).withTrimmedTop(8);
+	stereoScopeView.setBounds(meterColumn.removeFromTop(meterColumn.getWidth() + 22));
+	levelMeterView.setBounds(meterColumn.withTrimmedTop(4));
+
+	// Dynamic peak controls along the bottom
+	auto dynamicsArea = bounds.removeFromBottom(bounds.getHeight() / 5);
+	auto dynamics = getDynamicComps();
+	auto dynamicsWidth = dynamicsArea.getWidth() / (int)dynamics.size();
+	for (auto* comp : dynamics)
+		comp->setBounds(dynamicsArea.removeFromLeft(dynamicsWidth).reduced(10, 0));
+
 	// Dividir en tres columnas iguales: izquierda, centro, derecha
 	auto columnWidth = bounds.getWidth() / 3;
 
@@ -112,6 +261,10 @@ void SimpleEQAudioProcessorEditor::resized()
 
 	spectrumAnalyzer.setBounds(getLocalBounds());
 
+#if DARQ_INSTRUMENTATION
+	realtimeMonitorView.setBounds(getLocalBounds().removeFromBottom(110).removeFromLeft(360).reduced(8));
+#endif
+
 }
 
 
@@ -127,6 +280,191 @@ std::vector<juce::Component*> SimpleEQAudioProcessorEditor::getComps()
 		&lowCutFreqSlider,
 		&highCutFreqSlider,
 		&lowCutSlopeSlider,
-		&highCutSlopeSlider
+		&highCutSlopeSlider,
+		&peakThresholdSlider,
+		&peakRatioSlider,
+		&peakAttackSlider,
+		&peakReleaseSlider
+	};
+}
+
+std::vector<juce::Component*> SimpleEQAudioProcessorEditor::getDynamicComps()
+{
+	return
+	{
+		&peakThresholdSlider,
+		&peakRatioSlider,
+		&peakAttackSlider,
+		&peakReleaseSlider
+	};
+}
+
+std::vector<juce::Component*> SimpleEQAudioProcessorEditor::getOptionComps()
+{
+	return
+	{
+		&oversamplingBox,
+		&oversamplingFilterBox,
+		&linearPhaseButton,
+		&firLengthBox,
+		&doublePrecisionButton,
+		&stereoModeBox,
+		&editSideButton,
+		&peakDesignBox,
+		&peakDynamicButton,
+		&sidechainButton,
+		&crossoverBox
+	};
+}
+
+std::vector<juce::Component*> SimpleEQAudioProcessorEditor::getPresetComps()
+{
+	return
+	{
+		&presetBox,
+		&abButton,
+		&copyButton,
+		&morphButton,
+		&morphAmountSlider,
+		&matchButton
+	};
+}
+
+void SimpleEQAudioProcessorEditor::initPresetControls()
+{
+	auto& bank = audioProcessor.getPresetBank();
+
+	for (int i = 0; i < bank.getNumPresets(); ++i)
+		presetBox.addItem(bank.getName(i), i + 1);
+
+	presetBox.setSelectedId(audioProcessor.getCurrentProgram() + 1, juce::dontSendNotification);
+	presetBox.onChange = [this]
+	{
+		audioProcessor.setCurrentProgram(presetBox.getSelectedId() - 1);
+	};
+	addAndMakeVisible(presetBox);
+
+	abButton.onClick = [this]
+	{
+		audioProcessor.selectABSlot(1 - audioProcessor.getActiveABSlot());
+		updateABButtons();
 	};
+	addAndMakeVisible(abButton);
+
+	copyButton.onClick = [this] { audioProcessor.copyABSlot(); };
+	addAndMakeVisible(copyButton);
+
+	// Morphing runs between the stored slots, so store the live edits first.
+	initToggle(morphButton, morphAttachment, "Morph");
+	morphButton.onClick = [this]
+	{
+		if (morphButton.getToggleState())
+			audioProcessor.storeActiveABSlot();
+	};
+
+	morphAmountAttachment = std::make_unique<Attachment>(audioProcessor.apvts, "Morph Amount", morphAmountSlider);
+	addAndMakeVisible(morphAmountSlider);
+
+	matchButton.onClick = [this] { showMatchMenu(); };
+	addAndMakeVisible(matchButton);
+
+	updateABButtons();
+}
+
+void SimpleEQAudioProcessorEditor::showMatchMenu()
+{
+	auto& match = audioProcessor.getSpectralMatch();
+	auto status = match.getStatus();
+	auto reference = match.getReferenceFile();
+
+	enum { loadReference = 1, learn, resetLearned, apply };
+
+	juce::PopupMenu menu;
+	menu.addSectionHeader("Match to reference");
+
+	menu.addItem(loadReference, reference == juce::File() ? "Load reference..."
+		: "Reference: " + reference.getFileName() + " (" + juce::String(juce::roundToInt(status.referenceProgress * 100.0f)) + "%)");
+
+	menu.addItem(learn, "Learn input (" + juce::String(status.learnedSeconds, 0) + " s)", true, match.isLearning());
+	menu.addItem(resetLearned, "Forget learned input", status.learnedSeconds > 0.0);
+	menu.addSeparator();
+	menu.addItem(apply, status.hasResult ? "Apply match (" + juce::String(status.errorInDecibels, 1) + " dB RMS off)"
+		: "Apply match", status.hasResult);
+
+	if (status.error.isNotEmpty())
+		menu.addItem(-1, status.error, false);
+
+	menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&matchButton),
+		[safeThis = juce::Component::SafePointer<SimpleEQAudioProcessorEditor>(this)](int result)
+		{
+			if (safeThis == nullptr)
+				return;
+
+			auto& matcher = safeThis->audioProcessor.getSpectralMatch();
+
+			switch (result)
+			{
+			case loadReference:
+				safeThis->referenceChooser = std::make_unique<juce::FileChooser>("Reference track", juce::File(), "*.wav;*.aif;*.aiff;*.flac;*.ogg");
+				safeThis->referenceChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+					[safeThis](const juce::FileChooser& chooser)
+					{
+						if (safeThis != nullptr && chooser.getResult() != juce::File())
+							safeThis->audioProcessor.getSpectralMatch().loadReference(chooser.getResult());
+					});
+				break;
+
+			case learn:        matcher.setLearning(! matcher.isLearning()); break;
+			case resetLearned: matcher.resetLearnedInput(); break;
+			case apply:        safeThis->audioProcessor.applySpectralMatch(); break;
+			default: break;
+			}
+		});
+}
+
+void SimpleEQAudioProcessorEditor::updateABButtons()
+{
+	auto active = audioProcessor.getActiveABSlot();
+	abButton.setButtonText(active == 0 ? "A" : "B");
+	copyButton.setButtonText(active == 0 ? "Copy to B" : "Copy to A");
+}
+
+void SimpleEQAudioProcessorEditor::initChoiceBox(juce::ComboBox& box,
+	std::unique_ptr<ComboAttachment>& attachment,
+	const juce::String& paramID)
+{
+	// Items have to exist before the attachment picks the current choice.
+	if (auto* choice = dynamic_cast<juce::AudioParameterChoice*>(audioProcessor.apvts.getParameter(paramID)))
+		box.addItemList(choice->choices, 1);
+
+	attachment = std::make_unique<ComboAttachment>(audioProcessor.apvts, paramID, box);
+	addAndMakeVisible(box);
+	learnableControls.push_back({ &box, paramID, false });
+}
+
+void SimpleEQAudioProcessorEditor::initToggle(juce::ToggleButton& button,
+	std::unique_ptr<ButtonAttachment>& attachment,
+	const juce::String& paramID)
+{
+	attachment = std::make_unique<ButtonAttachment>(audioProcessor.apvts, paramID, button);
+	addAndMakeVisible(button);
+	learnableControls.push_back({ &button, paramID, false });
+}
+
+void SimpleEQAudioProcessorEditor::attachSliders(const juce::String& prefix)
+{
+	auto& apvts = audioProcessor.apvts;
+
+	peakFreqSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Freq", peakFreqSlider);
+	peakGainSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Gain", peakGainSlider);
+	peakQualitySliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Quality", peakQualitySlider);
+	lowCutFreqSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "LowCut Freq", lowCutFreqSlider);
+	highCutFreqSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "HighCut Freq", highCutFreqSlider);
+	lowCutSlopeSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "LowCut Slope", lowCutSlopeSlider);
+	highCutSlopeSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "HighCut Slope", highCutSlopeSlider);
+	peakThresholdSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Threshold", peakThresholdSlider);
+	peakRatioSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Ratio", peakRatioSlider);
+	peakAttackSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Attack", peakAttackSlider);
+	peakReleaseSliderAttachment = std::make_unique<Attachment>(apvts, prefix + "Peak Release", peakReleaseSlider);
+	peakDynamicAttachment = std::make_unique<ButtonAttachment>(apvts, prefix + "Peak Dynamic", peakDynamicButton);
 }
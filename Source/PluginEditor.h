@@ -12,6 +12,9 @@
 #include "PluginProcessor.h"
 #include "MinimalKnobLook.h"
 #include "SpectrumAnalyzer.h"
+#include "LevelMeterView.h"
+#include "StereoScopeView.h"
+#include "RealtimeMonitorView.h"
 
 
 struct CustomRotarySlider : juce::Slider
@@ -35,7 +38,9 @@ public:
     //==============================================================================
     void paint (juce::Graphics&) override;
     void resized() override;
-    //juce::Image backgroundImage;
+
+    // Right-click on any control offers MIDI learn for its parameter.
+    void mouseDown (const juce::MouseEvent&) override;
 
 
 private:
@@ -43,7 +48,19 @@ private:
     // access the processor object that created it.
     SimpleEQAudioProcessor& audioProcessor;
 
+    // Pre-rendered per size and scale factor; see BackgroundCache.
+    juce::SharedResourcePointer<BackgroundCache> backgroundCache;
+
+    // The analyzer and meters only start once the first frame is on screen.
     SpectrumAnalyzer spectrumAnalyzer;
+    LevelMeterView levelMeterView;
+    StereoScopeView stereoScopeView;
+    bool viewsStarted = false;
+    void startViews();
+
+#if DARQ_INSTRUMENTATION
+    RealtimeMonitorView realtimeMonitorView;
+#endif
 
 
     MinimalKnobLook customLookAndFeel;
@@ -54,20 +71,93 @@ private:
         lowCutFreqSlider,
         highCutFreqSlider,
         lowCutSlopeSlider,
-        highCutSlopeSlider;
+        highCutSlopeSlider,
+        peakThresholdSlider,
+        peakRatioSlider,
+        peakAttackSlider,
+        peakReleaseSlider;
 
     using APVTS = juce::AudioProcessorValueTreeState;
     using Attachment = APVTS::SliderAttachment;
 
-    Attachment peakFreqSliderAttachment,
+    std::unique_ptr<Attachment> peakFreqSliderAttachment,
         peakGainSliderAttachment,
         peakQualitySliderAttachment,
         lowCutFreqSliderAttachment,
         highCutFreqSliderAttachment,
         lowCutSlopeSliderAttachment,
-        highCutSlopeSliderAttachment;
+        highCutSlopeSliderAttachment,
+        peakThresholdSliderAttachment,
+        peakRatioSliderAttachment,
+        peakAttackSliderAttachment,
+        peakReleaseSliderAttachment;
+
+    // The knobs (and the Dynamic toggle) edit either the main (mid) set or the side set.
+    void attachSliders(const juce::String& prefix);
+
+    using ComboAttachment = APVTS::ComboBoxAttachment;
+
+    using ButtonAttachment = APVTS::ButtonAttachment;
+
+    juce::ComboBox oversamplingBox,
+        oversamplingFilterBox,
+        firLengthBox,
+        stereoModeBox,
+        peakDesignBox,
+        crossoverBox;
+
+    juce::ToggleButton linearPhaseButton{ "Linear Phase" },
+        doublePrecisionButton{ "64-bit" },
+        editSideButton{ "Edit Side" },
+        peakDynamicButton{ "Dynamic" },
+        sidechainButton{ "Sidechain" };
+
+    std::unique_ptr<ComboAttachment> oversamplingAttachment,
+        oversamplingFilterAttachment,
+        firLengthAttachment,
+        stereoModeAttachment,
+        peakDesignAttachment,
+        crossoverAttachment;
+
+    std::unique_ptr<ButtonAttachment> linearPhaseAttachment,
+        doublePrecisionAttachment,
+        peakDynamicAttachment,
+        sidechainAttachment;
+
+    // Presets, A/B compare and morphing
+    juce::ComboBox presetBox;
+    juce::TextButton abButton{ "A" },
+        copyButton{ "Copy to B" };
+    juce::ToggleButton morphButton{ "Morph A-B" };
+    juce::Slider morphAmountSlider{ juce::Slider::LinearHorizontal, juce::Slider::NoTextBox };
+    std::unique_ptr<ButtonAttachment> morphAttachment;
+    std::unique_ptr<Attachment> morphAmountAttachment;
+
+    // Reference matching
+    juce::TextButton matchButton{ "Match..." };
+    std::unique_ptr<juce::FileChooser> referenceChooser;
+
+    void initPresetControls();
+    void showMatchMenu();
+
+    struct LearnableControl
+    {
+        juce::Component* component;
+        juce::String parameterID;
+        bool followsEditSide;   // the knobs edit the side set while "Edit Side" is on
+    };
+
+    std::vector<LearnableControl> learnableControls;
+    void showMidiLearnMenu(const LearnableControl& control);
+    void updateABButtons();
+
+    void initChoiceBox(juce::ComboBox& box, std::unique_ptr<ComboAttachment>& attachment, const juce::String& paramID);
+    void initToggle(juce::ToggleButton& button, std::unique_ptr<ButtonAttachment>& attachment, const juce::String& paramID);
 
     std::vector<juce::Component*> getComps();
+    std::vector<juce::Component*> getDynamicComps();
+    std::vector<juce::Component*> getOptionComps();
+    std::vector<juce::Component*> getPresetComps();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimpleEQAudioProcessorEditor)
 };
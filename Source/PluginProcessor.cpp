@@ -7,7 +7,11 @@
 */
 
 #include "PluginProcessor.h"
-#include "PluginEditor.h"
+#include "PluginState.h"
+
+#if ! DARQ_HEADLESS
+ #include "PluginEditor.h"
+#endif
 
 //==============================================================================
 SimpleEQAudioProcessor::SimpleEQAudioProcessor()
@@ -16,16 +20,28 @@ SimpleEQAudioProcessor::SimpleEQAudioProcessor()
 #if ! JucePlugin_IsMidiEffect
 #if ! JucePlugin_IsSynth
 		.withInput("Input", juce::AudioChannelSet::stereo(), true)
+		.withInput("Sidechain", juce::AudioChannelSet::stereo(), false)
 #endif
 		.withOutput("Output", juce::AudioChannelSet::stereo(), true)
+		.withOutput("Band 1", juce::AudioChannelSet::stereo(), false)
+		.withOutput("Band 2", juce::AudioChannelSet::stereo(), false)
+		.withOutput("Band 3", juce::AudioChannelSet::stereo(), false)
+		.withOutput("Band 4", juce::AudioChannelSet::stereo(), false)
 #endif
 	)
 #endif
 {
+	analyzerTap = analyzerHub->registerTap();
+	postMorphEndpoints();
+
+	for (int split = 0; split < maxCrossoverBands - 1; ++split)
+		crossoverFrequencies[split] = apvts.getRawParameterValue("Crossover " + juce::String(split + 1) + " Freq");
 }
 
 SimpleEQAudioProcessor::~SimpleEQAudioProcessor()
 {
+	cancelPendingUpdate();
+	analyzerHub->unregisterTap(analyzerTap.get());
 }
 
 //==============================================================================
@@ -68,26 +84,200 @@ double SimpleEQAudioProcessor::getTailLengthSeconds() const
 
 int SimpleEQAudioProcessor::getNumPrograms()
 {
-	return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-	// so this should be at least 1, even if you're not really implementing programs.
+	return presetBank.getNumPresets();
 }
 
 int SimpleEQAudioProcessor::getCurrentProgram()
 {
-	return 0;
+	return currentProgram;
 }
 
 void SimpleEQAudioProcessor::setCurrentProgram(int index)
 {
+	if (! juce::isPositiveAndBelow(index, presetBank.getNumPresets()))
+		return;
+
+	currentProgram = index;
+	recall(presetBank.getValues(index), presetBank.getSnapshot(index, getSampleRate()));
 }
 
 const juce::String SimpleEQAudioProcessor::getProgramName(int index)
 {
-	return {};
+	return presetBank.getName(index);
 }
 
 void SimpleEQAudioProcessor::changeProgramName(int index, const juce::String& newName)
 {
+	presetBank.setName(index, newName);
+}
+
+//==============================================================================
+void SimpleEQAudioProcessor::selectABSlot(int slot)
+{
+	slot &= 1;
+	if (slot == presetBank.getActiveSlot())
+		return;
+
+	presetBank.getSlot(presetBank.getActiveSlot()) = presetBank.captureParameters();
+	presetBank.setActiveSlot(slot);
+	postMorphEndpoints();
+
+	recall(presetBank.getSlot(slot), nullptr);
+}
+
+void SimpleEQAudioProcessor::copyABSlot()
+{
+	presetBank.getSlot(1 - presetBank.getActiveSlot()) = presetBank.captureParameters();
+	postMorphEndpoints();
+}
+
+void SimpleEQAudioProcessor::storeActiveABSlot()
+{
+	presetBank.getSlot(presetBank.getActiveSlot()) = presetBank.captureParameters();
+	postMorphEndpoints();
+}
+
+bool SimpleEQAudioProcessor::applySpectralMatch()
+{
+	ChainSettings match;
+	if (! spectralMatch.getResult(match))
+		return false;
+
+	// The cut slopes aren't fitted; they stay as they are.
+	setParametersFromEditor({
+		{ "Peak Freq", match.peakFreq },
+		{ "Peak Gain", match.peakGainInDecibels },
+		{ "Peak Quality", match.peakQuality },
+		{ "LowCut Freq", match.lowCutFreq },
+		{ "HighCut Freq", match.highCutFreq },
+	});
+
+	return true;
+}
+
+void SimpleEQAudioProcessor::placeNotch(float frequency, float q, float depthInDecibels)
+{
+	setParametersFromEditor({
+		{ "Peak Freq", frequency },
+		{ "Peak Quality", q },
+		{ "Peak Gain", -std::abs(depthInDecibels) },
+	});
+}
+
+void SimpleEQAudioProcessor::setParametersFromEditor(std::initializer_list<std::pair<const char*, float>> values)
+{
+	for (auto& [id, value] : values)
+	{
+		if (auto* parameter = apvts.getParameter(id))
+		{
+			parameter->beginChangeGesture();
+			parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+			parameter->endChangeGesture();
+		}
+	}
+}
+
+void SimpleEQAudioProcessor::postMorphEndpoints()
+{
+	MorphEndpoint a = presetBank.makeMorphEndpoint(presetBank.getSlot(0));
+	MorphEndpoint b = presetBank.makeMorphEndpoint(presetBank.getSlot(1));
+
+	const juce::SpinLock::ScopedLockType sl(morphLock);
+	morphEndpoints[0] = a;
+	morphEndpoints[1] = b;
+	morphEndpointsChanged = true;
+}
+
+void SimpleEQAudioProcessor::recall(const PresetBank::Values& values, const CoefficientSnapshot* snapshot)
+{
+	auto prepared = snapshot != nullptr ? *snapshot : presetBank.makeSnapshot(values, getSampleRate());
+	juce::uint32 generation;
+
+	{
+		const juce::ScopedLock sl(pendingValuesLock);
+		generation = ++recallGeneration;
+		pendingValues = values;
+	}
+
+	{
+		const juce::SpinLock::ScopedLockType sl(recallLock);
+		pendingRecall = { prepared, generation };
+		recallPending = true;
+	}
+
+	// Hosts may change programs from any thread; the parameters themselves are
+	// always set from the message thread (or directly when there is none).
+	auto* messageManager = juce::MessageManager::getInstanceWithoutCreating();
+
+	if (messageManager == nullptr || messageManager->isThisTheMessageThread())
+	{
+		cancelPendingUpdate();
+		handleAsyncUpdate();
+	}
+	else
+	{
+		triggerAsyncUpdate();
+	}
+}
+
+void SimpleEQAudioProcessor::handleAsyncUpdate()
+{
+	auto latency = pendingLatency.load(std::memory_order_relaxed);
+	if (latency != getLatencySamples())
+		setLatencySamples(latency);
+
+	PresetBank::Values values;
+	juce::uint32 generation;
+
+	{
+		const juce::ScopedLock sl(pendingValuesLock);
+		values.swap(pendingValues);
+		generation = recallGeneration;
+	}
+
+	if (values.empty())
+		return;
+
+	presetBank.applyToParameters(values);
+	appliedGeneration.store(generation, std::memory_order_release);
+}
+
+void SimpleEQAudioProcessor::beginPendingRecall() noexcept
+{
+	{
+		const juce::SpinLock::ScopedTryLockType sl(recallLock);
+		DARQ_RT_NOTE_LOCK("preset recall (try-lock)");
+
+		// If the message thread holds the lock we'll pick it up next block.
+		if (! sl.isLocked() || ! recallPending)
+			return;
+
+		heldSnapshot = pendingRecall.snapshot;
+		heldGeneration = pendingRecall.generation;
+		recallPending = false;
+	}
+
+	// The convolution crossfades between kernels by itself.
+	if (linearPhaseActive)
+		return;
+
+	// Keep the outgoing settings (and their filter state) running for the fade.
+	if (doubleChainActive)
+		fadeDoubleChain.copyStateFrom(doubleChain);
+	else
+		fadeFloatChain.copyStateFrom(floatChain);
+
+	fadeLength = fadeRemaining = juce::jmax(1, juce::roundToInt(fadeSeconds * processingSampleRate));
+}
+
+bool SimpleEQAudioProcessor::isHoldingSnapshot() const noexcept
+{
+	// A snapshot is only valid for the rate and stereo mode it was designed
+	// for; a recall that changes either waits for the parameters (and the mode
+	// change resets the chains anyway).
+	return heldGeneration > appliedGeneration.load(std::memory_order_acquire)
+		&& heldSnapshot.sampleRate == processingSampleRate
+		&& heldSnapshot.midSide == midSideActive;
 }
 
 //==============================================================================
@@ -95,15 +285,52 @@ void SimpleEQAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 {
 	juce::dsp::ProcessSpec spec;
 
-	spec.maximumBlockSize = samplesPerBlock;
+	spec.maximumBlockSize = samplesPerBlock << maxOversamplingOrder;
 
 	spec.numChannels = 1;
 
 	spec.sampleRate = sampleRate;
 
-	leftChain.prepare(spec);
-	rightChain.prepare(spec);
-
+	floatChain.prepare((int)spec.maximumBlockSize);
+	doubleChain.prepare((int)spec.maximumBlockSize);
+	fadeFloatChain.prepare((int)spec.maximumBlockSize);
+	fadeDoubleChain.prepare((int)spec.maximumBlockSize);
+	// The fade runs on the oversampled block, so its copy is sized for one.
+	fadeScratch.setSize(2, samplesPerBlock << maxOversamplingOrder);
+	doubleFadeScratch.setSize(2, samplesPerBlock << maxOversamplingOrder);
+	fadeRemaining = 0;
+
+	presetBank.prepare(sampleRate);
+
+	loadMeasurer.reset(sampleRate, samplesPerBlock);
+	analyzerTap->setSampleRate(sampleRate);
+	spectralMatch.prepare(sampleRate);
+
+	inputMeter.prepare(sampleRate);
+	outputMeter.prepare(sampleRate);
+	stereoScope.prepare(sampleRate);
+	meteringActive = false;
+
+	floatCrossover.reset();
+	doubleCrossover.reset();
+
+	for (auto& o : oversamplers) o.reset();
+	for (auto& o : doubleOversamplers) o.reset();
+
+	if (isUsingDoublePrecision())
+		createOversamplers(doubleOversamplers, samplesPerBlock);
+	else
+		createOversamplers(oversamplers, samplesPerBlock);
+
+	juce::dsp::ProcessSpec stereoSpec{ sampleRate, (juce::uint32)samplesPerBlock, 2 };
+	linearPhaseEQ.prepare(stereoSpec);
+	linearPhaseScratch.setSize(2, samplesPerBlock);
+
+	processingSampleRate = sampleRate;
+	activeOversamplingIndex = -1;
+	doubleChainActive = false;
+	midSideActive = false;
+	updateProcessingMode();
 	updateFilters();
 
 }
@@ -133,16 +360,70 @@ bool SimpleEQAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
 #if ! JucePlugin_IsSynth
 	if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
 		return false;
+
+	// The sidechain only keys the dynamic peak; mono or stereo, or off.
+	if (layouts.inputBuses.size() > 1)
+	{
+		auto sidechain = layouts.getChannelSet(true, 1);
+
+		if (! sidechain.isDisabled()
+			&& sidechain != juce::AudioChannelSet::mono()
+			&& sidechain != juce::AudioChannelSet::stereo())
+			return false;
+	}
 #endif
 
+	// Band outputs carry the main output split up, so they match it or are off.
+	for (int bus = 1; bus < layouts.outputBuses.size(); ++bus)
+	{
+		auto band = layouts.getChannelSet(false, bus);
+
+		if (! band.isDisabled() && band != layouts.getMainOutputChannelSet())
+			return false;
+	}
+
 	return true;
 #endif
 }
 #endif
 
 void SimpleEQAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+	processSamples(buffer, midiMessages);
+}
+
+void SimpleEQAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+	processSamples(buffer, midiMessages);
+}
+
+void SimpleEQAudioProcessor::processBlockBypassed(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+	processBypassedSamples(buffer);
+}
+
+void SimpleEQAudioProcessor::processBlockBypassed(juce::AudioBuffer<double>& buffer, juce::MidiBuffer&)
+{
+	processBypassedSamples(buffer);
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::processBypassedSamples(juce::AudioBuffer<SampleType>& buffer)
+{
+	// The main bus passes through dry. Everything after it is silenced: Band 1
+	// shares its channels with the sidechain input, which must not leak out.
+	for (auto ch = getChannelCountOfBus(false, 0); ch < buffer.getNumChannels(); ++ch)
+		buffer.clear(ch, 0, buffer.getNumSamples());
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::processSamples(juce::AudioBuffer<SampleType>& buffer, const juce::MidiBuffer& midiMessages)
 {
 	juce::ScopedNoDenormals noDenormals;
+	DARQ_RT_SCOPED_BLOCK(realtimeMonitor, buffer.getNumSamples(), getSampleRate());
+
+	analyzerTap->setCallbackLoad((float)loadMeasurer.getLoadAsProportion());
+	const juce::AudioProcessLoadMeasurer::ScopedTimer loadTimer(loadMeasurer, buffer.getNumSamples());
 	auto totalNumInputChannels = getTotalNumInputChannels();
 	auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -155,175 +436,655 @@ void SimpleEQAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
 	for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
 		buffer.clear(i, 0, buffer.getNumSamples());
 
-	updateFilters();
-	juce::dsp::AudioBlock<float> block(buffer);
+	midiLearn.reassertPending();
+
+	// Start the meters clean whenever an editor starts watching them.
+	auto metering = meterViewers.load(std::memory_order_relaxed) > 0;
+	if (metering && ! meteringActive)
+	{
+		inputMeter.reset();
+		outputMeter.reset();
+		stereoScope.reset();
+	}
+	meteringActive = metering;
+
+	// Split the block wherever a learned controller moves a parameter, so
+	// the change (and the coefficients designed from it) lands on its sample.
+	auto numSamples = buffer.getNumSamples();
+	auto start = 0;
+
+	for (const auto metadata : midiMessages)
+	{
+		auto change = midiLearn.resolve(metadata.getMessage());
+		if (change.parameter < 0)
+			continue;
+
+		auto position = juce::jlimit(start, numSamples, metadata.samplePosition);
+		if (position > start)
+		{
+			processSegment(buffer, start, position - start);
+			start = position;
+		}
+
+		midiLearn.apply(change);
+	}
+
+	if (start < numSamples)
+		processSegment(buffer, start, numSamples - start);
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::processSegment(juce::AudioBuffer<SampleType>& wholeBuffer, int startSample, int numSamples)
+{
+	// Refers to the host's channels; no allocation for up to 32 of them.
+	juce::AudioBuffer<SampleType> buffer(wholeBuffer.getArrayOfWritePointers(), wholeBuffer.getNumChannels(),
+		startSample, numSamples);
+
+	{
+		DARQ_RT_SECTION("updateProcessingMode");
+		updateProcessingMode();
+		beginPendingRecall();
+	}
+
+	// The buffer also carries the sidechain bus; the chain only sees the main bus.
+	auto mainBuffer = getBusBuffer(buffer, false, 0);
+	juce::dsp::AudioBlock<SampleType> block(mainBuffer);
+
+	if (meteringActive)
+	{
+		DARQ_RT_SECTION("input meter");
+		inputMeter.process(mainBuffer.getArrayOfReadPointers(), mainBuffer.getNumChannels(), mainBuffer.getNumSamples());
+	}
+
+	spectralMatch.pushInput(mainBuffer.getArrayOfReadPointers(), mainBuffer.getNumChannels(), mainBuffer.getNumSamples());
+
+	juce::AudioBuffer<SampleType> sidechainBuffer;
+	SidechainInput<SampleType> sidechain;
+
+	if (getBusCount(true) > 1 && apvts.getRawParameterValue("Sidechain")->load() > 0.5f)
+	{
+		sidechainBuffer = getBusBuffer(buffer, true, 1);
+		sidechain.channels = sidechainBuffer.getArrayOfReadPointers();
+		sidechain.numChannels = sidechainBuffer.getNumChannels();
+	}
+
+	if (linearPhaseActive)
+	{
+		DARQ_RT_SECTION("linear phase");
+		auto target = loadChainTarget();
+		linearPhaseEQ.setTarget(target.mid, target.side, getFirOrder(), midSideActive);
+		processLinearPhase(block);
+	}
+	else if (auto* oversampler = getActiveOversampler<SampleType>())
+	{
+		updateFilters();
+		DARQ_RT_SECTION("oversampled chain");
+		auto oversampledBlock = oversampler->processSamplesUp(block);
+		sidechain.step = (int)oversampler->getOversamplingFactor();
+		processChains(oversampledBlock, sidechain);
+		oversampler->processSamplesDown(block);
+	}
+	else
+	{
+		updateFilters();
+		DARQ_RT_SECTION("processChains");
+		processChains(block, sidechain);
+	}
 
-	auto leftBlock = block.getSingleChannelBlock(0);
-	auto rightBlock = block.getSingleChannelBlock(1);
+	if (meteringActive)
+	{
+		DARQ_RT_SECTION("output meter");
+		outputMeter.process(mainBuffer.getArrayOfReadPointers(), mainBuffer.getNumChannels(), mainBuffer.getNumSamples());
+	}
+
+	if (meteringActive && mainBuffer.getNumChannels() > 0)
+	{
+		// A mono bus shows as a vertical line at +1.
+		DARQ_RT_SECTION("stereo scope");
+		auto right = juce::jmin(1, mainBuffer.getNumChannels() - 1);
+		stereoScope.process(mainBuffer.getReadPointer(0), mainBuffer.getReadPointer(right), mainBuffer.getNumSamples());
+	}
 
-	juce::dsp::ProcessContextReplacing<float> leftContext(leftBlock);
-	juce::dsp::ProcessContextReplacing<float> rightContext(rightBlock);
+	if (getBusCount(false) > 1)
+	{
+		DARQ_RT_SECTION("crossover");
+		processCrossover(buffer, mainBuffer);
+	}
 
-	leftChain.process(leftContext);
-	rightChain.process(rightContext);
+	DARQ_RT_SECTION("latency and analyzer");
+	updateLatency();
 
 	if (buffer.getNumChannels() > 0)
+		analyzerTap->pushSamples(buffer.getReadPointer(0), buffer.getNumSamples());
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::processChains(juce::dsp::AudioBlock<SampleType>& block,
+	const SidechainInput<SampleType>& sidechain)
+{
+	auto& scratch = [this]() -> juce::AudioBuffer<SampleType>&
+	{
+		if constexpr (std::is_same_v<SampleType, float>)
+			return fadeScratch;
+		else
+			return doubleFadeScratch;
+	}();
+
+	jassert(block.getNumChannels() <= (size_t)scratch.getNumChannels());
+
+	// The scratch holds a full oversampled block at the size the host asked
+	// for; a host that sends more gets its recall faded piece by piece.
+	auto maxPiece = (size_t)(scratch.getNumSamples() - scratch.getNumSamples() % sidechain.step);
+
+	if (fadeRemaining > 0 && maxPiece > 0 && block.getNumSamples() > maxPiece)
+	{
+		const SampleType* sidechainChannels[2] = {};
+		auto piece = sidechain;
+		piece.numChannels = juce::jmin(sidechain.numChannels, 2);
+
+		if (sidechain.channels != nullptr)
+			piece.channels = sidechainChannels;
+
+		for (size_t start = 0; start < block.getNumSamples(); start += maxPiece)
+		{
+			for (int ch = 0; ch < piece.numChannels; ++ch)
+				sidechainChannels[ch] = sidechain.channels[ch] + start / (size_t)sidechain.step;
+
+			auto subBlock = block.getSubBlock(start, juce::jmin(maxPiece, block.getNumSamples() - start));
+			processChains(subBlock, piece);
+		}
+
+		return;
+	}
+
+	// During a recall the outgoing chain runs on a copy of the input.
+	juce::dsp::AudioBlock<SampleType> outgoing;
+
+	if (fadeRemaining > 0)
 	{
-		auto* channelData = buffer.getReadPointer(0);
-		for (int i = 0; i < buffer.getNumSamples(); ++i)
-			pushNextSampleIntoFifo(channelData[i]);
+		outgoing = juce::dsp::AudioBlock<SampleType>(scratch)
+			.getSubsetChannelBlock(0, block.getNumChannels())
+			.getSubBlock(0, block.getNumSamples());
+		outgoing.copyFrom(block);
+
+		if (doubleChainActive)
+			fadeDoubleChain.process(outgoing, midSideActive, sidechain);
+		else
+			fadeFloatChain.process(outgoing, midSideActive, sidechain);
 	}
+
+	// M/S encode and decode happen in the engines' load and store.
+	if (doubleChainActive)
+		doubleChain.process(block, midSideActive, sidechain);
+	else
+		floatChain.process(block, midSideActive, sidechain);
+
+	if (fadeRemaining > 0)
+		crossfadeChains(block, outgoing);
 }
 
-void SimpleEQAudioProcessor::pushNextSampleIntoFifo(float sample) noexcept
+template <typename SampleType>
+void SimpleEQAudioProcessor::processCrossover(juce::AudioBuffer<SampleType>& buffer, const juce::AudioBuffer<SampleType>& mainBuffer)
 {
-	if (fifoIndex == fftSize)
+	auto& crossover = [this]() -> SimdCrossover<SampleType>&
+	{
+		if constexpr (std::is_same_v<SampleType, float>)
+			return floatCrossover;
+		else
+			return doubleCrossover;
+	}();
+
+	constexpr auto maxChannels = SimdCrossover<SampleType>::numLanes;
+
+	auto numBands = (int)apvts.getRawParameterValue("Crossover")->load() + 1;
+
+	SampleType* bandChannels[maxCrossoverBands][maxChannels] = {};
+	SampleType* const* bands[maxCrossoverBands] = {};
+	auto anyBand = false;
+
+	for (int band = 0; band < maxCrossoverBands && band + 1 < getBusCount(false); ++band)
 	{
-		if (!nextFFTBlockReady)
+		// Disabled buses come back with no channels.
+		auto bus = getBusBuffer(buffer, false, band + 1);
+		if (bus.getNumChannels() == 0)
+			continue;
+
+		if (band >= numBands)
 		{
-			juce::zeromem(fftData, sizeof(fftData));
-			std::memcpy(fftData, fifo, sizeof(fifo));
-			nextFFTBlockReady = true;
+			bus.clear();
+			continue;
 		}
 
-		fifoIndex = 0;
+		for (int ch = 0; ch < juce::jmin(bus.getNumChannels(), (int)maxChannels); ++ch)
+			bandChannels[band][ch] = bus.getWritePointer(ch);
+
+		bands[band] = bandChannels[band];
+		anyBand = true;
+	}
+
+	if (! anyBand)
+		return;
+
+	float frequencies[maxCrossoverBands - 1];
+	for (int split = 0; split < numBands - 1; ++split)
+		frequencies[split] = crossoverFrequencies[split]->load();
+
+	crossover.setCrossovers(frequencies, numBands, *coefficientTables, getSampleRate());
+	crossover.process(mainBuffer.getArrayOfReadPointers(), mainBuffer.getNumChannels(), bands, mainBuffer.getNumSamples());
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::crossfadeChains(juce::dsp::AudioBlock<SampleType>& block,
+	const juce::dsp::AudioBlock<SampleType>& outgoing) noexcept
+{
+	auto numSamples = (int)block.getNumSamples();
+	auto done = fadeLength - fadeRemaining;
+	auto step = SampleType(1) / (SampleType)fadeLength;
+
+	for (size_t ch = 0; ch < block.getNumChannels(); ++ch)
+	{
+		auto* incoming = block.getChannelPointer(ch);
+		auto* old = outgoing.getChannelPointer(ch);
+
+		for (int i = 0; i < numSamples; ++i)
+		{
+			auto gain = juce::jmin(SampleType(1), (SampleType)(done + i) * step);
+			incoming[i] = old[i] + gain * (incoming[i] - old[i]);
+		}
 	}
 
-	fifo[fifoIndex++] = sample;
+	fadeRemaining = juce::jmax(0, fadeRemaining - numSamples);
+}
+
+void SimpleEQAudioProcessor::processLinearPhase(juce::dsp::AudioBlock<float>& block)
+{
+	if (midSideActive)
+		encodeMidSide(block);
+
+	linearPhaseEQ.process(block);
+
+	if (midSideActive)
+		decodeMidSide(block);
+}
+
+void SimpleEQAudioProcessor::processLinearPhase(juce::dsp::AudioBlock<double>& block)
+{
+	// juce::dsp::Convolution is float-only, so this is the one mode where a
+	// 64-bit host does pay for a conversion.
+	auto numChannels = juce::jmin((size_t)linearPhaseScratch.getNumChannels(), block.getNumChannels());
+	auto numSamples = juce::jmin((size_t)linearPhaseScratch.getNumSamples(), block.getNumSamples());
+
+	juce::dsp::AudioBlock<float> scratch(linearPhaseScratch.getArrayOfWritePointers(), numChannels, numSamples);
+
+	for (size_t ch = 0; ch < numChannels; ++ch)
+		for (size_t i = 0; i < numSamples; ++i)
+			scratch.setSample((int)ch, (int)i, (float)block.getSample((int)ch, (int)i));
+
+	processLinearPhase(scratch);
+
+	for (size_t ch = 0; ch < numChannels; ++ch)
+		for (size_t i = 0; i < numSamples; ++i)
+			block.setSample((int)ch, (int)i, (double)scratch.getSample((int)ch, (int)i));
+}
+
+void SimpleEQAudioProcessor::encodeMidSide(juce::dsp::AudioBlock<float>& block) noexcept
+{
+	if (block.getNumChannels() < 2)
+		return;
+
+	auto* left = block.getChannelPointer(0);
+	auto* right = block.getChannelPointer(1);
+
+	for (size_t i = 0; i < block.getNumSamples(); ++i)
+	{
+		auto mid = 0.5f * (left[i] + right[i]);
+		auto side = 0.5f * (left[i] - right[i]);
+		left[i] = mid;
+		right[i] = side;
+	}
 }
 
-void SimpleEQAudioProcessor::drawNextFrameOfSpectrum()
+void SimpleEQAudioProcessor::decodeMidSide(juce::dsp::AudioBlock<float>& block) noexcept
 {
-	window.multiplyWithWindowingTable(fftData, fftSize);
-	forwardFFT.performFrequencyOnlyForwardTransform(fftData);
+	if (block.getNumChannels() < 2)
+		return;
 
-	auto mindB = -100.0f;
-	auto maxdB = 0.0f;
+	auto* mid = block.getChannelPointer(0);
+	auto* side = block.getChannelPointer(1);
 
-	for (int i = 0; i < scopeSize; ++i)
+	for (size_t i = 0; i < block.getNumSamples(); ++i)
 	{
-		auto skewedProportionX = 1.0f - std::exp(std::log(1.0f - (float)i / (float)scopeSize) * 0.2f);
-		auto fftDataIndex = juce::jlimit(0, fftSize / 2, (int)(skewedProportionX * (float)fftSize * 0.5f));
-		auto level = juce::jmap(
-			juce::jlimit(mindB, maxdB,
-				juce::Decibels::gainToDecibels(fftData[fftDataIndex])
-				- juce::Decibels::gainToDecibels((float)fftSize)),
-			mindB, maxdB, 0.0f, 1.0f);
+		auto left = mid[i] + side[i];
+		auto right = mid[i] - side[i];
+		mid[i] = left;
+		side[i] = right;
+	}
+}
 
-		scopeData[i] = level;
+template <typename SampleType>
+void SimpleEQAudioProcessor::createOversamplers(OversamplerSet<SampleType>& set, int samplesPerBlock)
+{
+	using Oversampler = juce::dsp::Oversampling<SampleType>;
+
+	for (int i = 0; i < (int)set.size(); ++i)
+	{
+		auto filterType = i < maxOversamplingOrder ? Oversampler::filterHalfBandPolyphaseIIR
+			: Oversampler::filterHalfBandFIREquiripple;
+		auto order = (size_t)(i % maxOversamplingOrder) + 1;
+
+		// Not max quality: the cheaper half-band designs are still far below
+		// the noise floor and keep the cost reasonable across a mix bus.
+		set[i] = std::make_unique<Oversampler>(2, order, filterType, false, true);
+		set[i]->initProcessing((size_t)samplesPerBlock);
 	}
 }
 
+template <typename SampleType>
+juce::dsp::Oversampling<SampleType>* SimpleEQAudioProcessor::getActiveOversampler() noexcept
+{
+	if (activeOversamplingIndex < 0)
+		return nullptr;
+
+	if constexpr (std::is_same_v<SampleType, float>)
+		return oversamplers[activeOversamplingIndex].get();
+	else
+		return doubleOversamplers[activeOversamplingIndex].get();
+}
+
+int SimpleEQAudioProcessor::getOversamplingIndex() const
+{
+	auto order = (int)apvts.getRawParameterValue("Oversampling")->load();
+	if (order <= 0)
+		return -1;
+
+	auto filterType = (int)apvts.getRawParameterValue("Oversampling Filter")->load();
+	return filterType * maxOversamplingOrder + juce::jmin(order, maxOversamplingOrder) - 1;
+}
+
+int SimpleEQAudioProcessor::getFirOrder() const
+{
+	return LinearPhaseEQ::minFirOrder + (int)apvts.getRawParameterValue("FIR Length")->load();
+}
+
+void SimpleEQAudioProcessor::updateProcessingMode()
+{
+	auto linearPhase = apvts.getRawParameterValue("Linear Phase")->load() > 0.5f;
+
+	if (linearPhase != linearPhaseActive)
+	{
+		linearPhaseActive = linearPhase;
+		linearPhaseEQ.reset();
+	}
+
+	auto useDoubleChain = isUsingDoublePrecision() || apvts.getRawParameterValue("Double Precision")->load() > 0.5f;
+
+	// The band buses don't count: M/S needs a stereo main bus.
+	auto midSide = getMainBusNumOutputChannels() > 1
+		&& apvts.getRawParameterValue("Stereo Mode")->load() > 0.5f;
+
+	if (useDoubleChain != doubleChainActive || midSide != midSideActive)
+	{
+		doubleChainActive = useDoubleChain;
+		midSideActive = midSide;
+		doubleChain.reset();
+		floatChain.reset();
+		linearPhaseEQ.reset();
+		fadeRemaining = 0;
+	}
+
+	// The FIR path runs at the host rate; oversampling only applies to the IIR chains.
+	auto index = linearPhaseActive ? -1 : getOversamplingIndex();
+	if (index == activeOversamplingIndex)
+		return;
+
+	activeOversamplingIndex = index;
+
+	if (auto* oversampler = getActiveOversampler<float>())
+		oversampler->reset();
+
+	if (auto* oversampler = getActiveOversampler<double>())
+		oversampler->reset();
+
+	// The chains' state belongs to the previous rate, so start them clean.
+	floatChain.reset();
+	doubleChain.reset();
+	fadeRemaining = 0;
 
-ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts)
+	processingSampleRate = getSampleRate() * (index >= 0 ? 1 << (index % maxOversamplingOrder + 1) : 1);
+	updateLatency();
+}
+
+void SimpleEQAudioProcessor::updateLatency()
 {
-	ChainSettings settings;
+	auto latency = 0;
+
+	if (linearPhaseActive)
+		latency = linearPhaseEQ.getCurrentLatencySamples();
+	else if (auto* oversampler = getActiveOversampler<float>())
+		latency = juce::roundToInt(oversampler->getLatencyInSamples());
+	else if (auto* doubleOversampler = getActiveOversampler<double>())
+		latency = juce::roundToInt(doubleOversampler->getLatencyInSamples());
+
+	if (latency == pendingLatency.load(std::memory_order_relaxed))
+		return;
+
+	pendingLatency.store(latency, std::memory_order_relaxed);
 
-	settings.lowCutFreq = apvts.getRawParameterValue("LowCut Freq")->load();
-	settings.highCutFreq = apvts.getRawParameterValue("HighCut Freq")->load();
-	settings.peakFreq = apvts.getRawParameterValue("Peak Freq")->load();
-	settings.peakGainInDecibels = apvts.getRawParameterValue("Peak Gain")->load();
-	settings.peakQuality = apvts.getRawParameterValue("Peak Quality")->load();
-	settings.lowCutSlope = apvts.getRawParameterValue("LowCut Slope")->load();
-	settings.highCutSlope = apvts.getRawParameterValue("HighCut Slope")->load();
-	settings.lowCutSlope = static_cast<Slope>(apvts.getRawParameterValue("LowCut Slope")->load());
-	settings.highCutSlope = static_cast<Slope>(apvts.getRawParameterValue("HighCut Slope")->load());
+	// Offline renders publish at once, from whatever thread they render on:
+	// the tools run the processor on pool threads and never pump messages,
+	// and a render has no realtime deadline for the host's listeners to miss.
+	auto* messageManager = juce::MessageManager::getInstanceWithoutCreating();
 
-	return settings;
+	if (isNonRealtime() || messageManager == nullptr || messageManager->isThisTheMessageThread())
+		setLatencySamples(latency);
+	else
+		triggerAsyncUpdate();
+}
+
+bool SimpleEQAudioProcessor::isReadyToRender() const
+{
+	auto linearPhase = apvts.getRawParameterValue("Linear Phase")->load() > 0.5f;
+	return ! linearPhase || (linearPhaseActive && linearPhaseEQ.isKernelReady(getFirOrder())
+		&& getLatencySamples() == linearPhaseEQ.getCurrentLatencySamples());
+}
+
+void SimpleEQAudioProcessor::getFrequencyResponse(double hostSampleRate, const double* frequencies,
+	double* magnitudes, double* phases, size_t numFrequencies, bool side) const
+{
+	auto settings = side ? sideParameters.load() : mainParameters.load();
+	auto linearPhase = apvts.getRawParameterValue("Linear Phase")->load() > 0.5f;
+
+	// The IIR chains are designed at the oversampled rate; the FIR at the host rate.
+	auto designRate = hostSampleRate;
+	auto index = getOversamplingIndex();
+	if (! linearPhase && index >= 0)
+		designRate *= 1 << (index % maxOversamplingOrder + 1);
+
+	getChainMagnitudes(settings, designRate, frequencies, magnitudes, numFrequencies);
+
+	if (phases == nullptr)
+		return;
+
+	// The linear-phase kernel is a pure delay of half its length.
+	if (linearPhase)
+		std::fill(phases, phases + numFrequencies, 0.0);
+	else
+		getChainPhases(settings, designRate, frequencies, phases, numFrequencies);
 }
 
 //==============================================================================
 bool SimpleEQAudioProcessor::hasEditor() const
 {
+#if DARQ_HEADLESS
+	return false;
+#else
 	return true; // (change this to false if you choose to not supply an editor)
+#endif
 }
 
 juce::AudioProcessorEditor* SimpleEQAudioProcessor::createEditor()
 {
+#if DARQ_HEADLESS
+	return nullptr;
+#else
 	return new SimpleEQAudioProcessorEditor (*this);
 	//return new juce::GenericAudioProcessorEditor(*this);
+#endif
 }
 
 //==============================================================================
 void SimpleEQAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-	// You should use this method to store your parameters in the memory block.
-	// You could do that either as raw data, or use the XML or ValueTree classes
-	// as intermediaries to make it easy to save and load complex data.
-	juce::MemoryOutputStream mos(destData, true);
-	apvts.state.writeToStream(mos);
+	// Compact binary layout (see PluginState.h): a header and the plain
+	// parameter values, so large sessions load with a few memcpys.
+	PluginState::Contents contents;
+	contents.parameters = presetBank.captureParameters();
+	contents.slots[0] = presetBank.getSlot(0);
+	contents.slots[1] = presetBank.getSlot(1);
+	contents.program = currentProgram;
+	contents.activeSlot = presetBank.getActiveSlot();
+	contents.midiMappings = midiLearn.getMappings();
+
+	PluginState::write(presetBank, contents, destData);
 }
 
 void SimpleEQAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-	// You should use this method to restore your parameters from this memory block,
-	// whose contents will have been created by the getStateInformation() call.
-	auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
-	if (tree.isValid()) {
-		apvts.replaceState(tree);
-		updateFilters();
+	// A loaded state supersedes any recall that is still on its way.
+	juce::uint32 generation;
+
+	{
+		const juce::ScopedLock sl(pendingValuesLock);
+		pendingValues.clear();
+		generation = ++recallGeneration;
 	}
-}
-void SimpleEQAudioProcessor::updatePeakFilter(const ChainSettings& chainSettings)
-{
-	auto peakCoefficients = juce::dsp::IIR::Coefficients<float>::makePeakFilter(getSampleRate(),
-		chainSettings.peakFreq,
-		chainSettings.peakQuality,
-		juce::Decibels::decibelsToGain(chainSettings.peakGainInDecibels));
 
-	updateCoefficients(leftChain.get<ChainPositions::Peak>().coefficients, peakCoefficients);
-	updateCoefficients(rightChain.get<ChainPositions::Peak>().coefficients, peakCoefficients);
-}
+	PluginState::Contents contents;
 
-void SimpleEQAudioProcessor::updateCoefficients(Coefficients& old, const Coefficients& replacements)
-{
-	*old = *replacements;
+	if (PluginState::read(presetBank, data, (size_t)juce::jmax(0, sizeInBytes), contents))
+	{
+		currentProgram = juce::jlimit(0, presetBank.getNumPresets() - 1, contents.program);
+		presetBank.getSlot(0) = std::move(contents.slots[0]);
+		presetBank.getSlot(1) = std::move(contents.slots[1]);
+		presetBank.setActiveSlot(contents.activeSlot);
+		presetBank.applyToParameters(contents.parameters, true);
+		midiLearn.setMappings(contents.midiMappings);
+	}
+	else
+	{
+		// Sessions saved before the binary format carry the whole ValueTree.
+		auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
+		if (tree.isValid()) {
+			currentProgram = juce::jlimit(0, presetBank.getNumPresets() - 1, (int)tree.getProperty("program", 0));
+			presetBank.loadLegacyState(tree);
+			apvts.replaceState(tree);
+			midiLearn.clearAllMappings();
+		}
+	}
+
+	appliedGeneration.store(generation, std::memory_order_release);
+	postMorphEndpoints();
 }
 
-void SimpleEQAudioProcessor::updateLowCutFilters(const ChainSettings& chainSettings)
+void SimpleEQAudioProcessor::updateFilters()
 {
-	auto cutCoefficients = juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(chainSettings.lowCutFreq,
-		getSampleRate(),
-		2 * (chainSettings.lowCutSlope + 1));
-	auto& leftLowCut = leftChain.get<ChainPositions::LowCut>();
-	auto& rightLowCut = rightChain.get<ChainPositions::LowCut>();
+	DARQ_RT_SECTION("updateFilters");
 
-	updateCutFilter(rightLowCut, cutCoefficients, static_cast<Slope>(chainSettings.lowCutSlope));
-	updateCutFilter(leftLowCut, cutCoefficients, static_cast<Slope>(chainSettings.lowCutSlope));
-}
+	ChainSettings midSettings, sideSettings;
+	DynamicSettings midDynamicSettings, sideDynamicSettings;
+	ChainCoefficients mid, side;
 
-void SimpleEQAudioProcessor::updateHighCutFilters(const ChainSettings& chainSettings)
-{
-	auto highCutCoefficients = juce::dsp::FilterDesign<float>::designIIRLowpassHighOrderButterworthMethod(chainSettings.highCutFreq,
-		getSampleRate(),
-		2 * (chainSettings.highCutSlope + 1));
+	if (isHoldingSnapshot())
+	{
+		// A recalled preset whose parameters haven't landed yet: its
+		// coefficients were designed when it was posted.
+		midSettings = heldSnapshot.mid;
+		sideSettings = heldSnapshot.side;
+		midDynamicSettings = heldSnapshot.midDynamics;
+		sideDynamicSettings = heldSnapshot.sideDynamics;
+		mid = heldSnapshot.midCoefficients;
+		side = heldSnapshot.sideCoefficients;
+	}
+	else
+	{
+		auto target = loadChainTarget();
+		midSettings = target.mid;
+		sideSettings = target.side;
+		midDynamicSettings = target.midDynamics;
+		sideDynamicSettings = target.sideDynamics;
+		mid = coefficientTables->makeChainCoefficients(midSettings, processingSampleRate);
+		side = midSideActive ? coefficientTables->makeChainCoefficients(sideSettings, processingSampleRate) : mid;
+	}
 
-	auto& leftHighCut = leftChain.get<ChainPositions::HighCut>();
-	auto& rightHighCut = rightChain.get<ChainPositions::HighCut>();
+	auto apply = [&](auto& chain)
+	{
+		chain.setCoefficients(mid);
+		chain.setCoefficients(1, side);
 
-	updateCutFilter(leftHighCut, highCutCoefficients, static_cast<Slope>(chainSettings.highCutSlope));
-	updateCutFilter(rightHighCut, highCutCoefficients, static_cast<Slope>(chainSettings.highCutSlope));
+		// In stereo mode each channel gets its own (unlinked) detector. Lanes
+		// past the stereo pair carry no audio and stay static.
+		for (size_t lane = 0; lane < std::decay_t<decltype(chain)>::numLanes; ++lane)
+		{
+			auto dynamics = lane == 0 ? midDynamicSettings : lane == 1 ? sideDynamicSettings : DynamicSettings{};
+			chain.setDynamics(lane, lane == 1 ? sideSettings : midSettings, dynamics, *coefficientTables, processingSampleRate);
+		}
+	};
+
+	if (doubleChainActive)
+		apply(doubleChain);
+	else
+		apply(floatChain);
 }
 
-void SimpleEQAudioProcessor::updateFilters()
+MorphEndpoint SimpleEQAudioProcessor::loadChainTarget() noexcept
 {
-	auto chainSettings = getChainSettings(apvts);
+	MorphEndpoint target;
+
+	if (morphEnabled->load() > 0.5f)
+	{
+		{
+			const juce::SpinLock::ScopedTryLockType sl(morphLock);
+			DARQ_RT_NOTE_LOCK("morph endpoints (try-lock)");
+
+			if (sl.isLocked() && morphEndpointsChanged)
+			{
+				activeMorphEndpoints[0] = morphEndpoints[0];
+				activeMorphEndpoints[1] = morphEndpoints[1];
+				morphEndpointsChanged = false;
+			}
+		}
+
+		auto amount = morphAmount->load();
+		auto& a = activeMorphEndpoints[0];
+		auto& b = activeMorphEndpoints[1];
 
-	updateLowCutFilters(chainSettings);
-	updatePeakFilter(chainSettings);
-	updateHighCutFilters(chainSettings);
+		target.mid = interpolateSettings(a.mid, b.mid, amount);
+		target.side = interpolateSettings(a.side, b.side, amount);
+		target.midDynamics = interpolateSettings(a.midDynamics, b.midDynamics, amount);
+		target.sideDynamics = interpolateSettings(a.sideDynamics, b.sideDynamics, amount);
+	}
+	else
+	{
+		target = { mainParameters.load(), sideParameters.load(), mainDynamics.load(), sideDynamics.load() };
+	}
+
+	if (! midSideActive)
+	{
+		target.side = target.mid;
+		target.sideDynamics = target.midDynamics;
+	}
+
+	return target;
 }
 
-juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::createParameterLayout()
+static void addChainParameters(juce::AudioProcessorValueTreeState::ParameterLayout& layout, const juce::String& prefix)
 {
-	juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
 	// LowCut Range con centro visual en 1000 Hz
 	auto lowCutFreqRange = juce::NormalisableRange<float>(20.f, 20000.f, 0.00001f);
 	lowCutFreqRange.setSkewForCentre(1000.f);
 	layout.add(std::make_unique<juce::AudioParameterFloat>(
-		"LowCut Freq",
-		"LowCut Freq",
+		prefix + "LowCut Freq",
+		prefix + "LowCut Freq",
 		lowCutFreqRange,
 		20.f
 	));
@@ -332,8 +1093,8 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::crea
 	auto highCutFreqRange = juce::NormalisableRange<float>(20.f, 20000.f, 0.00001f);
 	highCutFreqRange.setSkewForCentre(1000.f);
 	layout.add(std::make_unique<juce::AudioParameterFloat>(
-		"HighCut Freq",
-		"HighCut Freq",
+		prefix + "HighCut Freq",
+		prefix + "HighCut Freq",
 		highCutFreqRange,
 		20000.f
 	));
@@ -342,15 +1103,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::crea
 	auto peakFreqRange = juce::NormalisableRange<float>(20.f, 20000.f, 0.00001f);
 	peakFreqRange.setSkewForCentre(1000.f);
 	layout.add(std::make_unique<juce::AudioParameterFloat>(
-		"Peak Freq",
-		"Peak Freq",
+		prefix + "Peak Freq",
+		prefix + "Peak Freq",
 		peakFreqRange,
 		1000.f
 	));
 
 	layout.add(std::make_unique<juce::AudioParameterFloat>(
-		"Peak Gain",
-		"Peak Gain",
+		prefix + "Peak Gain",
+		prefix + "Peak Gain",
 		juce::NormalisableRange<float>(-20.f, 20.f, 0.1f, 1.f),
 		0.0f
 	));
@@ -360,8 +1121,8 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::crea
 	peakQualityRange.setSkewForCentre(1.00f);
 
 	layout.add(std::make_unique<juce::AudioParameterFloat>(
-		"Peak Quality",
-		"Peak Quality",
+		prefix + "Peak Quality",
+		prefix + "Peak Quality",
 		peakQualityRange,
 		1.f
 	));
@@ -375,8 +1136,86 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::crea
 		stringArray.add(str);
 	}
 
-	layout.add(std::make_unique<juce::AudioParameterChoice>("LowCut Slope", "LowCut Slope", stringArray, 0));
-	layout.add(std::make_unique<juce::AudioParameterChoice>("HighCut Slope", "HighCut Slope", stringArray, 0));
+	layout.add(std::make_unique<juce::AudioParameterChoice>(prefix + "LowCut Slope", prefix + "LowCut Slope", stringArray, 0));
+	layout.add(std::make_unique<juce::AudioParameterChoice>(prefix + "HighCut Slope", prefix + "HighCut Slope", stringArray, 0));
+}
+
+static void addDynamicParameters(juce::AudioProcessorValueTreeState::ParameterLayout& layout, const juce::String& prefix)
+{
+	layout.add(std::make_unique<juce::AudioParameterBool>(prefix + "Peak Dynamic", prefix + "Peak Dynamic", false));
+
+	layout.add(std::make_unique<juce::AudioParameterFloat>(
+		prefix + "Peak Threshold",
+		prefix + "Peak Threshold",
+		juce::NormalisableRange<float>(-60.f, 0.f, 0.1f),
+		-20.f
+	));
+
+	auto ratioRange = juce::NormalisableRange<float>(1.f, 20.f, 0.01f);
+	ratioRange.setSkewForCentre(4.f);
+	layout.add(std::make_unique<juce::AudioParameterFloat>(prefix + "Peak Ratio", prefix + "Peak Ratio", ratioRange, 2.f));
+
+	auto attackRange = juce::NormalisableRange<float>(0.1f, 100.f, 0.01f);
+	attackRange.setSkewForCentre(5.f);
+	layout.add(std::make_unique<juce::AudioParameterFloat>(prefix + "Peak Attack", prefix + "Peak Attack", attackRange, 5.f));
+
+	auto releaseRange = juce::NormalisableRange<float>(5.f, 1000.f, 0.1f);
+	releaseRange.setSkewForCentre(100.f);
+	layout.add(std::make_unique<juce::AudioParameterFloat>(prefix + "Peak Release", prefix + "Peak Release", releaseRange, 100.f));
+}
+
+juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::createParameterLayout()
+{
+	juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+	addChainParameters(layout, {});
+
+	layout.add(std::make_unique<juce::AudioParameterChoice>("Oversampling", "Oversampling",
+		juce::StringArray{ "Off", "2x", "4x", "8x" }, 0));
+	layout.add(std::make_unique<juce::AudioParameterChoice>("Oversampling Filter", "Oversampling Filter",
+		juce::StringArray{ "Minimum Phase", "Linear Phase" }, 0));
+
+	// Matched keeps the peak's analog shape up to Nyquist without oversampling.
+	layout.add(std::make_unique<juce::AudioParameterChoice>("Peak Design", "Peak Design",
+		juce::StringArray{ "Bilinear", "Matched" }, 0));
+
+	layout.add(std::make_unique<juce::AudioParameterBool>("Linear Phase", "Linear Phase", false));
+	layout.add(std::make_unique<juce::AudioParameterBool>("Double Precision", "Double Precision", false));
+
+	layout.add(std::make_unique<juce::AudioParameterChoice>("Stereo Mode", "Stereo Mode",
+		juce::StringArray{ "Stereo", "Mid/Side" }, 0));
+	addChainParameters(layout, sideParameterPrefix);
+
+	juce::StringArray firLengths;
+	for (int order = LinearPhaseEQ::minFirOrder; order <= LinearPhaseEQ::maxFirOrder; ++order)
+		firLengths.add(juce::String(1 << order) + " taps");
+
+	layout.add(std::make_unique<juce::AudioParameterChoice>("FIR Length", "FIR Length", firLengths, 2));
+
+	addDynamicParameters(layout, {});
+	addDynamicParameters(layout, sideParameterPrefix);
+	layout.add(std::make_unique<juce::AudioParameterBool>("Sidechain", "Sidechain", false));
+
+	// Band outputs; with the crossover off, Band 1 carries the whole output.
+	juce::StringArray crossoverModes{ "Off" };
+	for (int bands = 2; bands <= maxCrossoverBands; ++bands)
+		crossoverModes.add(juce::String(bands) + " Bands");
+
+	layout.add(std::make_unique<juce::AudioParameterChoice>("Crossover", "Crossover", crossoverModes, 0));
+
+	const float crossoverDefaults[] = { 120.f, 1000.f, 5000.f };
+	for (int split = 1; split < maxCrossoverBands; ++split)
+	{
+		auto crossoverRange = juce::NormalisableRange<float>(20.f, 20000.f, 0.00001f);
+		crossoverRange.setSkewForCentre(1000.f);
+
+		auto id = "Crossover " + juce::String(split) + " Freq";
+		layout.add(std::make_unique<juce::AudioParameterFloat>(id, id, crossoverRange, crossoverDefaults[split - 1]));
+	}
+
+	layout.add(std::make_unique<juce::AudioParameterBool>("Morph", "Morph", false));
+	layout.add(std::make_unique<juce::AudioParameterFloat>("Morph Amount", "Morph Amount",
+		juce::NormalisableRange<float>(0.f, 1.f, 0.001f), 0.f));
 
 	return layout;
 }
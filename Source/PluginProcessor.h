@@ -9,41 +9,74 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-enum Slope
-{
-	Slope_12,
-	Slope_24,
-	Slope_36,
-	Slope_48
-};
-
-struct ChainSettings
-{
-	float peakFreq{ 0 }, peakGainInDecibels{ 0 }, peakQuality{ 1.f };
-	float lowCutFreq{ 0 }, highCutFreq{ 0 };
-	int lowCutSlope{ Slope::Slope_12 }, highCutSlope{ Slope::Slope_12 };
-};
-
-ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts);
+#include "AnalyzerHub.h"
+#include "CoefficientTables.h"
+#include "EQDesign.h"
+#include "LevelMeter.h"
+#include "StereoScope.h"
+#include "LinearPhaseEQ.h"
+#include "MidiLearn.h"
+#include "PresetBank.h"
+#include "RealtimeMonitor.h"
+#include "SimdCrossover.h"
+#include "SimdFilterChain.h"
+#include "SpectralMatch.h"
+
+#if ! DARQ_HEADLESS
+ #include "BackgroundCache.h"
+#endif
 
 
 //==============================================================================
 /**
 */
-class SimpleEQAudioProcessor : public juce::AudioProcessor
+class SimpleEQAudioProcessor : public juce::AudioProcessor,
+	private juce::AsyncUpdater
 {
 public:
-	static constexpr int fftOrder = 11;
-	static constexpr int fftSize = 1 << fftOrder;
-	static constexpr int scopeSize = 1024;
-
-	bool isFFTReady() const { return nextFFTBlockReady; }
-	void setFFTReady(bool ready) { nextFFTBlockReady = ready; }
-
-	void pushNextSampleIntoFifo(float sample) noexcept;
-	void drawNextFrameOfSpectrum();
-	const float* getScopeData() const { return scopeData; }
+	static constexpr int maxOversamplingOrder = 3;
+	static_assert((1 << maxOversamplingOrder) <= CoefficientTables::maxOversamplingFactor,
+		"CoefficientTables' frequency grid must cover the oversampled design rate");
+
+	AnalyzerHub& getAnalyzerHub() { return *analyzerHub; }
+	AnalyzerTap& getAnalyzerTap() { return *analyzerTap; }
+
+	/** Smoothed proportion of the block duration processBlock takes. The
+		analyzer hub steps its quality down when this gets too high. */
+	double getCallbackLoad() const { return loadMeasurer.getLoadAsProportion(); }
+
+	PresetBank& getPresetBank() { return presetBank; }
+	MidiLearn& getMidiLearn() { return midiLearn; }
+	SpectralMatch& getSpectralMatch() { return spectralMatch; }
+
+	/** Sets the main bands to the latest reference-match fit, through the
+		parameters so the host records it like any other edit. Message thread. */
+	bool applySpectralMatch();
+
+	/** Puts the main peak band on a resonance as a cut, at the frequency and Q
+		the detector measured. Message thread. */
+	void placeNotch(float frequency, float q, float depthInDecibels);
+
+	/** Main-bus meters before and after the EQ. They only run while at least
+		one viewer is registered, so a closed editor costs nothing. */
+	LevelMeter& getInputMeter() { return inputMeter; }
+	LevelMeter& getOutputMeter() { return outputMeter; }
+	StereoScope& getStereoScope() { return stereoScope; }
+	void addMeterViewer() noexcept { meterViewers.fetch_add(1); }
+	void removeMeterViewer() noexcept { meterViewers.fetch_sub(1); }
+
+	/** A/B compare: stores the live settings in the active slot and recalls
+		the other one. Message thread. */
+	void selectABSlot(int slot);
+	/** Copies the live settings into the inactive slot. */
+	void copyABSlot();
+	/** Stores the live settings in the active slot, e.g. before morphing. */
+	void storeActiveABSlot();
+	int getActiveABSlot() const noexcept { return presetBank.getActiveSlot(); }
+
+#if DARQ_INSTRUMENTATION
+	RealtimeMonitor& getRealtimeMonitor() { return realtimeMonitor; }
+#endif
 	//==============================================================================
 	SimpleEQAudioProcessor();
 	~SimpleEQAudioProcessor() override;
@@ -57,6 +90,12 @@ public:
 #endif
 
 	void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+	void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+	void processBlockBypassed(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+	void processBlockBypassed(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+	bool supportsDoublePrecisionProcessing() const override { return true; }
 
 	//==============================================================================
 	juce::AudioProcessorEditor* createEditor() override;
@@ -81,86 +120,194 @@ public:
 	void getStateInformation(juce::MemoryBlock& destData) override;
 	void setStateInformation(const void* data, int sizeInBytes) override;
 
+	//==============================================================================
+	/** False while a freshly requested linear-phase kernel is still being
+		designed, or its latency hasn't been reported yet. Offline renderers
+		call setNonRealtime(true) (so the latency is reported from their own
+		thread) and keep processing silence until this is true, then feed
+		audio. */
+	bool isReadyToRender() const;
+
+	/** Response of the chain as currently configured (including the
+		oversampled design rate), for the mid/main or side settings. Phases are
+		in radians and may be null. */
+	void getFrequencyResponse(double hostSampleRate, const double* frequencies,
+		double* magnitudes, double* phases, size_t numFrequencies, bool side = false) const;
+
 	static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+	static inline const juce::String sideParameterPrefix{ "Side " };
+
+	// Optional band outputs, after the main bus: "Band 1" (lowest) and up.
+	static constexpr int maxCrossoverBands = SimdCrossover<float>::maxBands;
+
 	juce::AudioProcessorValueTreeState apvts{ *this, nullptr, "Parameters", createParameterLayout() };
 
 private:
-	juce::dsp::FFT forwardFFT{ fftOrder };
-	juce::dsp::WindowingFunction<float> window{ fftSize, juce::dsp::WindowingFunction<float>::blackmanHarris };
-
-	float fifo[fftSize] = { 0 };
-	float fftData[2 * fftSize] = { 0 };
-	int fifoIndex = 0;
-	bool nextFFTBlockReady = false;
+	juce::SharedResourcePointer<AnalyzerHub> analyzerHub;
+	AnalyzerTap::Ptr analyzerTap;
+	juce::AudioProcessLoadMeasurer loadMeasurer;
+
+#if ! DARQ_HEADLESS
+	// Held here rather than by the editor, so the background is decoded by the
+	// time anyone opens one and survives editors being closed.
+	juce::SharedResourcePointer<BackgroundCache> backgroundCache;
+#endif
 
-	float scopeData[scopeSize] = { 0 };
+#if DARQ_INSTRUMENTATION
+	RealtimeMonitor realtimeMonitor;
+#endif
 
 	//==============================================================================
 
-	using Filter = juce::dsp::IIR::Filter<float>;
+	// Mid and side (or, in stereo mode, both channels) use the main
+	// parameters for lane 0; lane 1 uses the "Side" set when in M/S.
+	ChainParameters mainParameters{ apvts }, sideParameters{ apvts, sideParameterPrefix };
+	DynamicParameters mainDynamics{ apvts }, sideDynamics{ apvts, sideParameterPrefix };
+
+	// Coefficients for every block come from these shared tables.
+	juce::SharedResourcePointer<CoefficientTables> coefficientTables;
+
+	PresetBank presetBank{ *this, *coefficientTables };
+	int currentProgram = 0;
+
+	MidiLearn midiLearn{ apvts };
+	SpectralMatch spectralMatch{ apvts };
+
+	LevelMeter inputMeter, outputMeter;
+	StereoScope stereoScope;
+	std::atomic<int> meterViewers{ 0 };
+	bool meteringActive = false;
+
+	// Both engines filter every channel in one pass, one channel per SIMD lane.
+	SimdFilterChain<float> floatChain;
+
+	// Double-precision chain, used when the host renders in 64-bit and, on
+	// request, as internal state for the float path. Keeps the 48 dB/oct cuts
+	// clean when their poles sit right next to the unit circle.
+	SimdFilterChain<double> doubleChain;
+	bool doubleChainActive = false;
+	bool midSideActive = false;
+
+	// One oversampler per (filter type, factor), built up front so the audio
+	// thread can switch between them without allocating. Only the set that
+	// matches the host's processing precision is created.
+	template <typename SampleType>
+	using OversamplerSet = std::array<std::unique_ptr<juce::dsp::Oversampling<SampleType>>, 2 * maxOversamplingOrder>;
 
-	using CutFilter = juce::dsp::ProcessorChain<Filter, Filter, Filter, Filter>;
+	OversamplerSet<float> oversamplers;
+	OversamplerSet<double> doubleOversamplers;
+	int activeOversamplingIndex = -1;
 
-	using MonoChain = juce::dsp::ProcessorChain<CutFilter, Filter, CutFilter>;
+	template <typename SampleType>
+	static void createOversamplers(OversamplerSet<SampleType>& set, int samplesPerBlock);
 
-	MonoChain leftChain, rightChain;
+	template <typename SampleType>
+	juce::dsp::Oversampling<SampleType>* getActiveOversampler() noexcept;
 
+	// Rate the filter chains actually run at, i.e. the host rate times the
+	// oversampling factor.
+	double processingSampleRate = 44100.0;
 
-	enum ChainPositions
+	// Splits the EQ'd output onto the band buses, at the host's precision.
+	SimdCrossover<float> floatCrossover;
+	SimdCrossover<double> doubleCrossover;
+	std::atomic<float>* crossoverFrequencies[maxCrossoverBands - 1] = {};
+
+	LinearPhaseEQ linearPhaseEQ;
+	bool linearPhaseActive = false;
+	juce::AudioBuffer<float> linearPhaseScratch;
+
+	int getOversamplingIndex() const;
+	int getFirOrder() const;
+	void updateProcessingMode();
+
+	// Audio thread: works out the latency of what is running now. The host is
+	// told from the message thread (handleAsyncUpdate), as setLatencySamples
+	// calls its listeners; non-realtime renders tell it straight away.
+	void updateLatency();
+	std::atomic<int> pendingLatency{ 0 };
+
+	template <typename SampleType>
+	void processSamples(juce::AudioBuffer<SampleType>& buffer, const juce::MidiBuffer& midiMessages);
+
+	template <typename SampleType>
+	void processBypassedSamples(juce::AudioBuffer<SampleType>& buffer);
+
+	template <typename SampleType>
+	void processSegment(juce::AudioBuffer<SampleType>& wholeBuffer, int startSample, int numSamples);
+
+	template <typename SampleType>
+	void processChains(juce::dsp::AudioBlock<SampleType>& block,
+		const SidechainInput<SampleType>& sidechain);
+
+	template <typename SampleType>
+	void processCrossover(juce::AudioBuffer<SampleType>& buffer, const juce::AudioBuffer<SampleType>& mainBuffer);
+
+	void processLinearPhase(juce::dsp::AudioBlock<float>& block);
+	void processLinearPhase(juce::dsp::AudioBlock<double>& block);
+
+	static void encodeMidSide(juce::dsp::AudioBlock<float>& block) noexcept;
+	static void decodeMidSide(juce::dsp::AudioBlock<float>& block) noexcept;
+
+	void updateFilters();
+	MorphEndpoint loadChainTarget() noexcept;
+
+	// Message thread: sets plain values with change gestures, as a user edit would.
+	void setParametersFromEditor(std::initializer_list<std::pair<const char*, float>> values);
+
+	//==============================================================================
+	// Preset recall. The snapshot (settings plus coefficients designed ahead of
+	// time) is posted to the audio thread under a spin lock, which the audio
+	// thread only ever try-locks. It switches to the snapshot at once and
+	// crossfades from a copy of the outgoing chain, and keeps using the
+	// snapshot until the parameters have caught up on the message thread.
+	struct PendingRecall
 	{
-		LowCut,
-		Peak,
-		HighCut
+		CoefficientSnapshot snapshot;
+		juce::uint32 generation{ 0 };
 	};
 
+	void recall(const PresetBank::Values& values, const CoefficientSnapshot* snapshot);
+	void handleAsyncUpdate() override;
+	void beginPendingRecall() noexcept;
+	bool isHoldingSnapshot() const noexcept;
 
-	void updatePeakFilter(const ChainSettings& chainSettings);
-	using Coefficients = Filter::CoefficientsPtr;
-	static void updateCoefficients(Coefficients& old, const Coefficients& replacements);
+	juce::SpinLock recallLock;
+	PendingRecall pendingRecall;
+	bool recallPending = false;
 
-	template<int Index, typename ChainType, typename CoefficientType>
-	void update(ChainType& chain, const CoefficientType& coefficients)
-	{
-		updateCoefficients(chain.template get<Index>().coefficients, coefficients[Index]);
-		chain.template setBypassed<Index>(false);
-	}
-
-	template<typename ChainType, typename CoefficientType>
-	void updateCutFilter(ChainType& chain,
-		const CoefficientType& coefficients,
-		const Slope& slope)
-	{
-		chain.template setBypassed<0>(true);
-		chain.template setBypassed<1>(true);
-		chain.template setBypassed<2>(true);
-		chain.template setBypassed<3>(true);
-
-		switch (slope)
-		{
-		case Slope_48:
-		{
-			update<3>(chain, coefficients);
-		}
-		case Slope_36:
-		{
-			update<2>(chain, coefficients);
-
-		}
-		case Slope_24:
-		{
-			update<1>(chain, coefficients);
-		}
-		case Slope_12:
-		{
-			update<0>(chain, coefficients);
-		}
-		}
-	}
-
-	void updateLowCutFilters(const ChainSettings& chainSettings);
-	void updateHighCutFilters(const ChainSettings& chainSettings);
+	juce::CriticalSection pendingValuesLock;
+	PresetBank::Values pendingValues;
+	juce::uint32 recallGeneration = 0;
+	std::atomic<juce::uint32> appliedGeneration{ 0 };
 
-	void updateFilters();
+	// Audio thread
+	CoefficientSnapshot heldSnapshot;
+	juce::uint32 heldGeneration = 0;
+
+	static constexpr double fadeSeconds = 0.02;
+	SimdFilterChain<float> fadeFloatChain;
+	SimdFilterChain<double> fadeDoubleChain;
+	juce::AudioBuffer<float> fadeScratch;
+	juce::AudioBuffer<double> doubleFadeScratch;
+	int fadeLength = 0, fadeRemaining = 0;
+
+	template <typename SampleType>
+	void crossfadeChains(juce::dsp::AudioBlock<SampleType>& block,
+		const juce::dsp::AudioBlock<SampleType>& outgoing) noexcept;
+
+	//==============================================================================
+	// Morphing between the A and B slots. It interpolates settings rather than
+	// coefficients, so every point on the way is a stable design.
+	void postMorphEndpoints();
+
+	std::atomic<float>* morphEnabled = apvts.getRawParameterValue("Morph");
+	std::atomic<float>* morphAmount = apvts.getRawParameterValue("Morph Amount");
+
+	juce::SpinLock morphLock;
+	MorphEndpoint morphEndpoints[2];
+	bool morphEndpointsChanged = false;
+	MorphEndpoint activeMorphEndpoints[2];   // audio thread
 
 	//==============================================================================
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimpleEQAudioProcessor)
@@ -0,0 +1,144 @@
+#include "PluginState.h"
+
+namespace PluginState
+{
+	namespace
+	{
+		constexpr char magic[4] = { 'd', 'a', 'r', 'Q' };
+		constexpr char midiTag[4] = { 'M', 'I', 'D', 'I' };
+
+		static_assert(std::is_trivially_copyable_v<Header>, "the header is read with memcpy");
+	}
+
+	void write(const PresetBank& bank, const Contents& contents, juce::MemoryBlock& dest)
+	{
+		auto numParameters = (size_t)bank.getParameterIDs().size();
+		jassert(contents.parameters.size() == numParameters
+			&& contents.slots[0].size() == numParameters && contents.slots[1].size() == numParameters);
+
+		Header header;
+		std::memcpy(header.magic, magic, sizeof(magic));
+		header.version = currentVersion;
+		header.headerSize = (juce::uint16)sizeof(Header);
+		header.layoutHash = bank.getLayoutHash();
+		header.numParameters = (juce::uint32)numParameters;
+		header.program = contents.program;
+		header.activeSlot = contents.activeSlot;
+
+		juce::MemoryOutputStream out(dest, false);
+		out.write(&header, sizeof(header));
+
+		for (auto* values : { &contents.parameters, &contents.slots[0], &contents.slots[1] })
+			out.write(values->data(), numParameters * sizeof(float));
+
+		for (auto& id : bank.getParameterIDs())
+			out.write(id.toRawUTF8(), id.getNumBytesAsUTF8() + 1);
+
+		out.write(midiTag, sizeof(midiTag));
+		out.writeInt((int)contents.midiMappings.size());
+
+		for (auto& [controller, parameter] : contents.midiMappings)
+		{
+			out.writeShort((short)controller);
+			out.writeShort((short)parameter);
+		}
+	}
+
+	bool read(const PresetBank& bank, const void* data, size_t sizeInBytes, Contents& contents)
+	{
+		Header header;
+
+		if (sizeInBytes < sizeof(Header))
+			return false;
+
+		std::memcpy(&header, data, sizeof(Header));
+
+		if (std::memcmp(header.magic, magic, sizeof(magic)) != 0
+			|| header.version > currentVersion
+			|| header.headerSize < sizeof(Header))
+			return false;
+
+		auto* bytes = static_cast<const char*>(data);
+		auto numStored = (size_t)header.numParameters;
+		auto blockSize = numStored * sizeof(float);
+		auto valuesEnd = (size_t)header.headerSize + 3 * blockSize;
+
+		if (valuesEnd > sizeInBytes)
+			return false;
+
+		const float* blocks[3];
+		for (size_t b = 0; b < 3; ++b)
+			blocks[b] = reinterpret_cast<const float*>(bytes + header.headerSize + b * blockSize);
+
+		PresetBank::Values* targets[] = { &contents.parameters, &contents.slots[0], &contents.slots[1] };
+		auto numParameters = (size_t)bank.getParameterIDs().size();
+
+		contents.program = header.program;
+		contents.activeSlot = header.activeSlot & 1;
+
+		auto layoutMatches = header.layoutHash == bank.getLayoutHash() && numStored == numParameters;
+
+		// Position in this build's layout of each stored value; only needed
+		// when the blob comes from a build with a different parameter layout.
+		std::vector<int> storedToBank;
+
+		if (layoutMatches)
+		{
+			for (size_t b = 0; b < 3; ++b)
+			{
+				targets[b]->resize(numParameters);
+				std::memcpy(targets[b]->data(), blocks[b], blockSize);
+			}
+		}
+		else
+		{
+			for (auto* target : targets)
+				*target = bank.getValues(0);
+
+			storedToBank.assign(numStored, -1);
+		}
+
+		// Walk the ID table (mapping by ID if the layouts differ) to find the
+		// sections behind it.
+		auto* id = bytes + valuesEnd;
+		auto* end = bytes + sizeInBytes;
+
+		for (size_t i = 0; i < numStored && id < end; ++i)
+		{
+			auto length = strnlen(id, (size_t)(end - id));
+
+			if (! layoutMatches)
+			{
+				auto index = bank.getParameterIDs().indexOf(juce::String::fromUTF8(id, (int)length));
+				storedToBank[i] = index;
+
+				if (index >= 0)
+					for (size_t b = 0; b < 3; ++b)
+						std::memcpy(targets[b]->data() + index, blocks[b] + i, sizeof(float));
+			}
+
+			id += length + 1;
+		}
+
+		contents.midiMappings.clear();
+
+		if (header.version >= 2 && end - id >= 8 && std::memcmp(id, midiTag, sizeof(midiTag)) == 0)
+		{
+			juce::MemoryInputStream in(id + sizeof(midiTag), (size_t)(end - id) - sizeof(midiTag), false);
+			auto count = in.readInt();
+
+			for (int i = 0; i < count && in.getNumBytesRemaining() >= 4; ++i)
+			{
+				auto controller = (int)(juce::uint16)in.readShort();
+				auto stored = (int)(juce::uint16)in.readShort();
+				auto parameter = layoutMatches ? stored
+					: juce::isPositiveAndBelow(stored, (int)storedToBank.size()) ? storedToBank[(size_t)stored] : -1;
+
+				if (parameter >= 0)
+					contents.midiMappings.emplace_back(controller, parameter);
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "PresetBank.h"
+
+//==============================================================================
+/**
+	Binary plugin state.
+
+	A fixed header, then three blocks of plain parameter values in
+	getParameters() order (the live parameters, then A/B slots A and B), then
+	the parameter IDs as null-terminated UTF-8 strings. Version 2 appends the
+	MIDI learn table, as (controller, parameter index) pairs of uint16:
+
+		Header | float live[n] | float slotA[n] | float slotB[n] | IDs
+			| "MIDI" | uint32 count | mappings[count]
+
+	When the header's layout hash matches this build, loading is three
+	memcpys. Otherwise the ID table maps the values by name, and parameters
+	missing from the blob keep their defaults. Values are stored in the
+	machine's byte order (little-endian on every platform the plugin ships
+	for).
+
+	States written before this format are ValueTrees; read() returns false
+	for them and the caller falls back to the legacy loader.
+*/
+namespace PluginState
+{
+	constexpr juce::uint16 currentVersion = 2;
+
+	struct Header
+	{
+		char magic[4];
+		juce::uint16 version;
+		juce::uint16 headerSize;
+		juce::uint32 layoutHash;
+		juce::uint32 numParameters;
+		juce::int32 program;
+		juce::int32 activeSlot;
+	};
+
+	struct Contents
+	{
+		PresetBank::Values parameters, slots[2];
+		int program = 0;
+		int activeSlot = 0;
+
+		/** (controller, parameter index) pairs; see MidiLearn. */
+		std::vector<std::pair<int, int>> midiMappings;
+	};
+
+	void write(const PresetBank& bank, const Contents& contents, juce::MemoryBlock& dest);
+
+	/** False if the data isn't in this format (or comes from a newer version). */
+	bool read(const PresetBank& bank, const void* data, size_t sizeInBytes, Contents& contents);
+}
@@ -0,0 +1,232 @@
+#include "PresetBank.h"
+#include "PluginProcessor.h"
+
+namespace
+{
+	struct FactoryPreset
+	{
+		const char* name;
+		std::vector<std::pair<const char*, float>> values;   // everything else at its default
+	};
+
+	const FactoryPreset factoryPresets[] =
+	{
+		{ "Default", {} },
+		{ "Low Cut 80 Hz", { { "LowCut Freq", 80.f }, { "LowCut Slope", 2.f } } },
+		{ "Air", { { "LowCut Freq", 30.f }, { "Peak Freq", 12000.f }, { "Peak Gain", 4.f }, { "Peak Quality", 0.5f } } },
+		{ "Telephone", { { "LowCut Freq", 300.f }, { "LowCut Slope", 3.f }, { "HighCut Freq", 3400.f }, { "HighCut Slope", 3.f },
+			{ "Peak Freq", 1500.f }, { "Peak Gain", 4.f } } },
+		{ "De-Esser", { { "Peak Freq", 6500.f }, { "Peak Quality", 2.f }, { "Peak Dynamic", 1.f }, { "Peak Threshold", -30.f },
+			{ "Peak Ratio", 4.f }, { "Peak Attack", 1.f }, { "Peak Release", 60.f } } },
+		{ "Wide Top", { { "Stereo Mode", 1.f }, { "Side LowCut Freq", 150.f }, { "Side LowCut Slope", 1.f },
+			{ "Side Peak Freq", 8000.f }, { "Side Peak Gain", 3.f }, { "Side Peak Quality", 0.5f } } },
+	};
+}
+
+PresetBank::PresetBank(juce::AudioProcessor& processor, const CoefficientTables& tables)
+	: coefficientTables(tables)
+{
+	for (auto* p : processor.getParameters())
+	{
+		if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(p))
+		{
+			parameters.add(ranged);
+			parameterIDs.add(ranged->getParameterID());
+		}
+	}
+
+	// FNV-1a over the IDs, so a saved state can tell whether its values line up.
+	layoutHash = 2166136261u;
+	for (auto& id : parameterIDs)
+	{
+		for (auto* c = id.toRawUTF8(); ; ++c)
+		{
+			layoutHash = (layoutHash ^ (juce::uint8)*c) * 16777619u;
+			if (*c == 0)
+				break;
+		}
+	}
+
+	for (auto& factory : factoryPresets)
+	{
+		Preset preset{ factory.name, {} };
+
+		for (auto* p : parameters)
+			preset.values.push_back(p->convertFrom0to1(p->getDefaultValue()));
+
+		for (auto& [id, value] : factory.values)
+		{
+			jassert(parameterIDs.contains(id));
+			preset.values[(size_t)parameterIDs.indexOf(id)] = value;
+		}
+
+		presets.add(preset);
+	}
+
+	slots[0] = slots[1] = presets.getReference(0).values;
+}
+
+juce::String PresetBank::getName(int index) const
+{
+	return juce::isPositiveAndBelow(index, presets.size()) ? presets.getReference(index).name : juce::String();
+}
+
+void PresetBank::setName(int index, const juce::String& newName)
+{
+	if (juce::isPositiveAndBelow(index, presets.size()))
+		presets.getReference(index).name = newName;
+}
+
+const PresetBank::Values& PresetBank::getValues(int index) const
+{
+	return presets.getReference(juce::jlimit(0, presets.size() - 1, index)).values;
+}
+
+bool PresetBank::isMorphParameter(const juce::String& parameterID)
+{
+	return parameterID == "Morph" || parameterID == "Morph Amount";
+}
+
+//==============================================================================
+float PresetBank::getValue(const Values& values, const juce::String& parameterID) const
+{
+	auto index = parameterIDs.indexOf(parameterID);
+	return index >= 0 ? values[(size_t)index] : 0.0f;
+}
+
+ChainSettings PresetBank::readChainSettings(const Values& values, const juce::String& prefix) const
+{
+	ChainSettings settings;
+
+	settings.lowCutFreq = getValue(values, prefix + "LowCut Freq");
+	settings.highCutFreq = getValue(values, prefix + "HighCut Freq");
+	settings.peakFreq = getValue(values, prefix + "Peak Freq");
+	settings.peakGainInDecibels = getValue(values, prefix + "Peak Gain");
+	settings.peakQuality = getValue(values, prefix + "Peak Quality");
+	settings.lowCutSlope = (int)getValue(values, prefix + "LowCut Slope");
+	settings.highCutSlope = (int)getValue(values, prefix + "HighCut Slope");
+	settings.peakDesign = (int)getValue(values, "Peak Design");
+
+	return settings;
+}
+
+DynamicSettings PresetBank::readDynamicSettings(const Values& values, const juce::String& prefix) const
+{
+	DynamicSettings settings;
+
+	settings.enabled = getValue(values, prefix + "Peak Dynamic") > 0.5f;
+	settings.thresholdInDecibels = getValue(values, prefix + "Peak Threshold");
+	settings.ratio = getValue(values, prefix + "Peak Ratio");
+	settings.attackMs = getValue(values, prefix + "Peak Attack");
+	settings.releaseMs = getValue(values, prefix + "Peak Release");
+
+	return settings;
+}
+
+CoefficientSnapshot PresetBank::makeSnapshot(const Values& values, double hostSampleRate) const
+{
+	// The IIR chains of an oversampled preset run at the oversampled rate.
+	auto order = (int)getValue(values, "Oversampling");
+	auto linearPhase = getValue(values, "Linear Phase") > 0.5f;
+	auto factor = linearPhase ? 1 : 1 << juce::jlimit(0, SimpleEQAudioProcessor::maxOversamplingOrder, order);
+
+	CoefficientSnapshot snapshot;
+	snapshot.sampleRate = hostSampleRate * factor;
+
+	auto midSide = getValue(values, "Stereo Mode") > 0.5f;
+	snapshot.midSide = midSide;
+	auto endpoint = makeMorphEndpoint(values);
+
+	snapshot.mid = endpoint.mid;
+	snapshot.side = midSide ? endpoint.side : endpoint.mid;
+	snapshot.midDynamics = endpoint.midDynamics;
+	snapshot.sideDynamics = midSide ? endpoint.sideDynamics : endpoint.midDynamics;
+	snapshot.midCoefficients = coefficientTables.makeChainCoefficients(snapshot.mid, snapshot.sampleRate);
+	snapshot.sideCoefficients = coefficientTables.makeChainCoefficients(snapshot.side, snapshot.sampleRate);
+
+	return snapshot;
+}
+
+MorphEndpoint PresetBank::makeMorphEndpoint(const Values& values) const
+{
+	auto sidePrefix = SimpleEQAudioProcessor::sideParameterPrefix;
+
+	return { readChainSettings(values, {}), readChainSettings(values, sidePrefix),
+		readDynamicSettings(values, {}), readDynamicSettings(values, sidePrefix) };
+}
+
+void PresetBank::prepare(double hostSampleRate)
+{
+	{
+		const juce::ScopedLock sl(snapshotLock);
+
+		if (snapshotsByRate.find(hostSampleRate) != snapshotsByRate.end())
+			return;
+	}
+
+	// Designed outside the lock, so a recall meanwhile only waits for the insert.
+	std::vector<CoefficientSnapshot> snapshots;
+
+	for (auto& preset : presets)
+		snapshots.push_back(makeSnapshot(preset.values, hostSampleRate));
+
+	const juce::ScopedLock sl(snapshotLock);
+	snapshotsByRate.emplace(hostSampleRate, std::move(snapshots));
+}
+
+const CoefficientSnapshot* PresetBank::getSnapshot(int index, double hostSampleRate) const noexcept
+{
+	const juce::ScopedLock sl(snapshotLock);
+	auto it = snapshotsByRate.find(hostSampleRate);
+
+	if (it == snapshotsByRate.end() || ! juce::isPositiveAndBelow(index, (int)it->second.size()))
+		return nullptr;
+
+	return &it->second[(size_t)index];
+}
+
+//==============================================================================
+PresetBank::Values PresetBank::captureParameters() const
+{
+	Values values;
+
+	for (auto* p : parameters)
+		values.push_back(p->convertFrom0to1(p->getValue()));
+
+	return values;
+}
+
+void PresetBank::applyToParameters(const Values& values, bool includingMorph) const
+{
+	for (int i = 0; i < parameters.size() && i < (int)values.size(); ++i)
+	{
+		auto* p = parameters.getUnchecked(i);
+
+		if (! includingMorph && isMorphParameter(p->getParameterID()))
+			continue;
+
+		auto normalised = p->convertTo0to1(values[(size_t)i]);
+
+		if (p->getValue() != normalised)
+			p->setValueNotifyingHost(normalised);
+	}
+}
+
+//==============================================================================
+void PresetBank::loadLegacyState(const juce::ValueTree& parent)
+{
+	auto slotsTree = parent.getChildWithName("ABSlots");
+	if (! slotsTree.isValid())
+		return;
+
+	activeSlot = (int)slotsTree.getProperty("active", 0) & 1;
+
+	for (int s = 0; s < 2 && s < slotsTree.getNumChildren(); ++s)
+	{
+		auto slot = slotsTree.getChild(s);
+
+		for (int i = 0; i < parameterIDs.size(); ++i)
+			if (slot.hasProperty(parameterIDs[i]))
+				slots[s][(size_t)i] = (float)slot.getProperty(parameterIDs[i]);
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "EQDesign.h"
+#include "CoefficientTables.h"
+
+//==============================================================================
+/** Everything the audio thread needs to switch to a preset without designing
+	anything: the settings, and the coefficients designed for the rate the
+	preset's chains run at. */
+struct CoefficientSnapshot
+{
+	double sampleRate{ 0 };
+	bool midSide{ false };
+	ChainSettings mid, side;
+	DynamicSettings midDynamics, sideDynamics;
+	ChainCoefficients midCoefficients, sideCoefficients;
+};
+
+/** The chain settings of one A/B slot, as morphing reads them. */
+struct MorphEndpoint
+{
+	ChainSettings mid, side;
+	DynamicSettings midDynamics, sideDynamics;
+};
+
+//==============================================================================
+/**
+	Program bank plus A/B compare slots.
+
+	A preset is the plain value of every parameter (in getParameters() order)
+	except the morph controls. For each host sample rate the bank designs every
+	preset's coefficients once, in prepare(), so a recall from any thread is a
+	lookup; the processor then swaps them in and crossfades on the audio
+	thread while the parameters catch up on the message thread.
+*/
+class PresetBank
+{
+public:
+	using Values = std::vector<float>;
+
+	PresetBank(juce::AudioProcessor& processor, const CoefficientTables& tables);
+
+	int getNumPresets() const noexcept { return presets.size(); }
+	juce::String getName(int index) const;
+	void setName(int index, const juce::String& newName);
+	const Values& getValues(int index) const;
+
+	/** Designs every preset for the given host rate, once per rate. Not
+		concurrent with the audio thread (call from prepareToPlay), but recalls
+		from other threads may look snapshots up meanwhile. */
+	void prepare(double hostSampleRate);
+
+	/** The snapshot prepare() made for this rate, or nullptr. Any thread; a
+		snapshot is never changed or removed once it is made, so the pointer
+		stays valid. */
+	const CoefficientSnapshot* getSnapshot(int index, double hostSampleRate) const noexcept;
+
+	CoefficientSnapshot makeSnapshot(const Values& values, double hostSampleRate) const;
+	MorphEndpoint makeMorphEndpoint(const Values& values) const;
+
+	Values captureParameters() const;
+
+	/** Pushes the values to the parameters, notifying the host. Recalls leave
+		the morph controls alone; loading a session restores them too. */
+	void applyToParameters(const Values& values, bool includingMorph = false) const;
+
+	/** IDs in the order the values are stored in, and a hash of that order. */
+	const juce::StringArray& getParameterIDs() const noexcept { return parameterIDs; }
+	juce::uint32 getLayoutHash() const noexcept { return layoutHash; }
+
+	//==============================================================================
+	// A/B compare. The live parameters belong to the active slot; the other
+	// slot holds what switching will recall.
+	int getActiveSlot() const noexcept { return activeSlot; }
+	void setActiveSlot(int slot) noexcept { activeSlot = slot; }
+	Values& getSlot(int slot) { return slots[slot & 1]; }
+
+	/** Reads the A/B slots from a legacy ValueTree state. */
+	void loadLegacyState(const juce::ValueTree& parent);
+
+	static bool isMorphParameter(const juce::String& parameterID);
+
+private:
+	struct Preset
+	{
+		juce::String name;
+		Values values;
+	};
+
+	float getValue(const Values& values, const juce::String& parameterID) const;
+	ChainSettings readChainSettings(const Values& values, const juce::String& prefix) const;
+	DynamicSettings readDynamicSettings(const Values& values, const juce::String& prefix) const;
+
+	juce::Array<juce::RangedAudioParameter*> parameters;
+	juce::StringArray parameterIDs;
+	juce::uint32 layoutHash = 0;
+	const CoefficientTables& coefficientTables;
+
+	juce::Array<Preset> presets;
+	std::map<double, std::vector<CoefficientSnapshot>> snapshotsByRate;
+	mutable juce::CriticalSection snapshotLock;
+
+	Values slots[2];
+	int activeSlot = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBank)
+};
@@ -0,0 +1,277 @@
+#include "RealtimeMonitor.h"
+
+#if DARQ_INSTRUMENTATION
+
+#include <new>
+
+namespace
+{
+    // The monitor of the block running on this thread, and what it is doing.
+    thread_local RealtimeMonitor* currentMonitor = nullptr;
+    thread_local const char* currentSection = "processBlock";
+
+    template <typename Type>
+    void storeMax(std::atomic<Type>& target, Type value) noexcept
+    {
+        auto current = target.load(std::memory_order_relaxed);
+        while (value > current && ! target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // 0, then 1 us and quarter octaves up from it.
+    const auto bucketEdges = []
+    {
+        std::array<double, RealtimeMonitor::numBuckets + 1> edges{};
+
+        for (int i = 1; i < RealtimeMonitor::numBuckets; ++i)
+            edges[(size_t)i] = std::exp2((double)(i - 1) / RealtimeMonitor::bucketsPerOctave);
+
+        edges.back() = std::numeric_limits<double>::infinity();
+        return edges;
+    }();
+}
+
+//==============================================================================
+// Every allocation in the plugin goes through here; only those made while a
+// ScopedBlock is alive on the calling thread are reported.
+void* operator new(std::size_t size)
+{
+    RealtimeMonitor::noteAllocation();
+
+    if (auto* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    RealtimeMonitor::noteAllocation();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+//==============================================================================
+const std::array<double, RealtimeMonitor::numBuckets + 1>& RealtimeMonitor::getBucketEdgesMicros() noexcept
+{
+    return bucketEdges;
+}
+
+int RealtimeMonitor::getBucket(double micros) noexcept
+{
+    // The bucket whose lower edge is the last one at or below micros.
+    auto above = std::upper_bound(bucketEdges.begin() + 1, bucketEdges.end() - 1, micros);
+    return (int)(above - bucketEdges.begin()) - 1;
+}
+
+double RealtimeMonitor::Snapshot::getPercentileMicros(double fraction) const noexcept
+{
+    juce::uint64 total = 0;
+    for (auto count : histogram)
+        total += count;
+
+    if (total == 0)
+        return 0.0;
+
+    auto target = (juce::uint64)std::ceil(fraction * (double)total);
+    juce::uint64 seen = 0;
+
+    for (int i = 0; i < numBuckets; ++i)
+    {
+        seen += histogram[(size_t)i];
+        if (seen >= target)
+            return juce::jmin(bucketEdges[(size_t)i + 1], maxMicros);
+    }
+
+    return maxMicros;
+}
+
+RealtimeMonitor::Snapshot RealtimeMonitor::getSnapshot() const
+{
+    Snapshot s;
+
+    for (size_t i = 0; i < histogram.size(); ++i)
+        s.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+
+    s.blocks = blocks.load(std::memory_order_relaxed);
+    s.overruns = overruns.load(std::memory_order_relaxed);
+    s.allocations = allocations.load(std::memory_order_relaxed);
+    s.locks = locks.load(std::memory_order_relaxed);
+    s.maxMicros = maxMicros.load(std::memory_order_relaxed);
+    s.lastLoad = lastLoad.load(std::memory_order_relaxed);
+
+    auto samples = (double)juce::jmax((juce::int64)1, stageSamples.load(std::memory_order_relaxed));
+    auto nanosPerTick = 1.0e9 / (double)juce::Time::getHighResolutionTicksPerSecond();
+
+    for (size_t i = 0; i < stageTicks.size(); ++i)
+        s.stageNanosPerSample[i] = (double)stageTicks[i].load(std::memory_order_relaxed) * nanosPerTick / samples;
+
+    auto newest = nextEvent.load(std::memory_order_acquire);
+    for (juce::uint32 i = 0; i < (juce::uint32)maxEvents && i < newest; ++i)
+    {
+        auto& e = events[(newest - 1 - i) % maxEvents];
+        if (auto* where = e.where.load(std::memory_order_relaxed))
+            s.recentEvents.add(juce::String(e.type.load(std::memory_order_relaxed) == (int)EventType::lock ? "lock: " : "alloc: ") + where);
+    }
+
+    return s;
+}
+
+void RealtimeMonitor::reset() noexcept
+{
+    for (auto& bucket : histogram)
+        bucket.store(0, std::memory_order_relaxed);
+
+    for (auto& ticks : stageTicks)
+        ticks.store(0, std::memory_order_relaxed);
+
+    blocks = 0;
+    overruns = 0;
+    allocations = 0;
+    locks = 0;
+    maxMicros = 0.0;
+    stageSamples = 0;
+    nextEvent = 0;
+}
+
+bool RealtimeMonitor::dumpToFile(const juce::File& file) const
+{
+    auto s = getSnapshot();
+
+    juce::Array<juce::var> buckets;
+    for (int i = 0; i < numBuckets; ++i)
+    {
+        if (s.histogram[(size_t)i] == 0)
+            continue;
+
+        auto* bucket = new juce::DynamicObject();
+        auto to = bucketEdges[(size_t)i + 1];
+        bucket->setProperty("from_us", bucketEdges[(size_t)i]);
+        bucket->setProperty("to_us", std::isfinite(to) ? juce::var(to) : juce::var());
+        bucket->setProperty("count", (juce::int64)s.histogram[(size_t)i]);
+        buckets.add(juce::var(bucket));
+    }
+
+    auto* stages = new juce::DynamicObject();
+    stages->setProperty("low_cut_ns_per_sample", s.stageNanosPerSample[lowCut]);
+    stages->setProperty("peak_ns_per_sample", s.stageNanosPerSample[peak]);
+    stages->setProperty("high_cut_ns_per_sample", s.stageNanosPerSample[highCut]);
+
+    juce::Array<juce::var> recent;
+    for (auto& e : s.recentEvents)
+        recent.add(e);
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("time", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("blocks", (juce::int64)s.blocks);
+    root->setProperty("overruns", (juce::int64)s.overruns);
+    root->setProperty("p50_us", s.getPercentileMicros(0.5));
+    root->setProperty("p99_us", s.getPercentileMicros(0.99));
+    root->setProperty("max_us", s.maxMicros);
+    root->setProperty("allocations", (juce::int64)s.allocations);
+    root->setProperty("locks", (juce::int64)s.locks);
+    root->setProperty("recent_events", recent);
+    root->setProperty("stages", juce::var(stages));
+    root->setProperty("histogram", buckets);
+
+    return file.replaceWithText(juce::JSON::toString(juce::var(root)));
+}
+
+//==============================================================================
+void RealtimeMonitor::recordEvent(EventType type, const char* where) noexcept
+{
+    auto& e = events[nextEvent.load(std::memory_order_relaxed) % maxEvents];
+    e.type.store((int)type, std::memory_order_relaxed);
+    e.where.store(where, std::memory_order_relaxed);
+    nextEvent.fetch_add(1, std::memory_order_release);
+}
+
+void RealtimeMonitor::noteLock(const char* site) noexcept
+{
+    if (auto* monitor = currentMonitor)
+    {
+        monitor->locks.fetch_add(1, std::memory_order_relaxed);
+        monitor->recordEvent(EventType::lock, site);
+    }
+}
+
+void RealtimeMonitor::noteAllocation() noexcept
+{
+    if (auto* monitor = currentMonitor)
+    {
+        monitor->allocations.fetch_add(1, std::memory_order_relaxed);
+        monitor->recordEvent(EventType::allocation, currentSection);
+    }
+}
+
+//==============================================================================
+RealtimeMonitor::ScopedBlock::ScopedBlock(RealtimeMonitor& monitorToUse, int samples, double sampleRate) noexcept
+    : monitor(monitorToUse),
+      previous(currentMonitor),
+      startTicks(juce::Time::getHighResolutionTicks()),
+      blockMicros(sampleRate > 0.0 ? 1.0e6 * samples / sampleRate : 0.0),
+      numSamples(samples)
+{
+    currentMonitor = &monitor;
+}
+
+RealtimeMonitor::ScopedBlock::~ScopedBlock() noexcept
+{
+    currentMonitor = previous;
+
+    auto micros = 1.0e6 * juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+
+    monitor.histogram[(size_t)getBucket(micros)].fetch_add(1, std::memory_order_relaxed);
+    monitor.blocks.fetch_add(1, std::memory_order_relaxed);
+    monitor.stageSamples.fetch_add(numSamples, std::memory_order_relaxed);
+    storeMax(monitor.maxMicros, micros);
+
+    if (blockMicros > 0.0)
+    {
+        monitor.lastLoad.store(micros / blockMicros, std::memory_order_relaxed);
+
+        if (micros > blockMicros)
+            monitor.overruns.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+RealtimeMonitor::ScopedSection::ScopedSection(const char* name) noexcept
+    : previous(currentSection)
+{
+    currentSection = name;
+}
+
+RealtimeMonitor::ScopedSection::~ScopedSection() noexcept
+{
+    currentSection = previous;
+}
+
+RealtimeMonitor::ScopedStage::ScopedStage(Stage stageToTime) noexcept
+    : stage(stageToTime),
+      startTicks(currentMonitor != nullptr ? juce::Time::getHighResolutionTicks() : 0)
+{
+}
+
+RealtimeMonitor::ScopedStage::~ScopedStage() noexcept
+{
+    if (auto* monitor = currentMonitor)
+        monitor->stageTicks[(size_t)stage].fetch_add(juce::Time::getHighResolutionTicks() - startTicks,
+                                                      std::memory_order_relaxed);
+}
+
+#endif
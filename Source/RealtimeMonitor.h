@@ -0,0 +1,147 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// Opt-in realtime-safety instrumentation. Build with DARQ_INSTRUMENTATION=1
+// to enable it; otherwise every DARQ_RT_* macro expands to nothing and the
+// monitor is not compiled into the processor at all.
+#ifndef DARQ_INSTRUMENTATION
+ #define DARQ_INSTRUMENTATION 0
+#endif
+
+#if DARQ_INSTRUMENTATION
+
+//==============================================================================
+/**
+    Audio-thread statistics for one processor instance.
+
+    Everything the audio thread writes is a relaxed atomic, so recording never
+    blocks and the editor can read a snapshot at any time:
+
+    - processBlock wall time, in a histogram of quarter-octave buckets
+    - blocks that took longer than the audio they produced (overruns)
+    - accumulated time per filter group (low cut, peak, high cut)
+    - heap allocations and lock acquisitions made inside a monitored block,
+      with the section that was running when they happened
+
+    Allocations are caught by replacing the global operator new in
+    RealtimeMonitor.cpp. Locks are reported by DARQ_RT_NOTE_LOCK at the lock
+    sites in this code base.
+*/
+class RealtimeMonitor
+{
+public:
+    enum Stage { lowCut, peak, highCut, numStages };
+
+    static constexpr int numBuckets = 64;
+    static constexpr int bucketsPerOctave = 4;
+    static constexpr int maxEvents = 8;
+
+    /** Bucket edges in microseconds, the one table both recording and
+        reporting use: bucket b holds times from edge b up to edge b + 1.
+        Bucket 0 is everything under 1 us; the last is open-ended (its upper
+        edge is infinite). */
+    static const std::array<double, numBuckets + 1>& getBucketEdgesMicros() noexcept;
+    static int getBucket(double micros) noexcept;
+
+    struct Snapshot
+    {
+        std::array<juce::uint32, numBuckets> histogram{};
+        juce::uint64 blocks = 0, overruns = 0, allocations = 0, locks = 0;
+        double maxMicros = 0.0, lastLoad = 0.0;
+        std::array<double, numStages> stageNanosPerSample{};
+        juce::StringArray recentEvents;
+
+        /** Block time below which the given fraction of blocks finished. */
+        double getPercentileMicros(double fraction) const noexcept;
+    };
+
+    Snapshot getSnapshot() const;
+    void reset() noexcept;
+
+    /** Writes the current snapshot as JSON. */
+    bool dumpToFile(const juce::File& file) const;
+
+    //==============================================================================
+    /** Times one processBlock call and makes this the monitor that allocation
+        and lock events on this thread are charged to. */
+    class ScopedBlock
+    {
+    public:
+        ScopedBlock(RealtimeMonitor& monitorToUse, int numSamples, double sampleRate) noexcept;
+        ~ScopedBlock() noexcept;
+
+    private:
+        RealtimeMonitor& monitor;
+        RealtimeMonitor* previous;
+        juce::int64 startTicks;
+        double blockMicros;
+        int numSamples;
+    };
+
+    /** Names the code that runs until it goes out of scope, for event reports. */
+    class ScopedSection
+    {
+    public:
+        explicit ScopedSection(const char* name) noexcept;
+        ~ScopedSection() noexcept;
+
+    private:
+        const char* previous;
+    };
+
+    /** Adds the time spent in its scope to a filter group. */
+    class ScopedStage
+    {
+    public:
+        explicit ScopedStage(Stage stageToTime) noexcept;
+        ~ScopedStage() noexcept;
+
+    private:
+        Stage stage;
+        juce::int64 startTicks;
+    };
+
+    static void noteLock(const char* site) noexcept;
+    static void noteAllocation() noexcept;
+
+private:
+    enum class EventType { allocation, lock };
+
+    void recordEvent(EventType type, const char* where) noexcept;
+
+    std::array<std::atomic<juce::uint32>, numBuckets> histogram{};
+    std::atomic<juce::uint64> blocks{ 0 }, overruns{ 0 }, allocations{ 0 }, locks{ 0 };
+    std::atomic<double> maxMicros{ 0.0 }, lastLoad{ 0.0 };
+
+    std::array<std::atomic<juce::int64>, numStages> stageTicks{};
+    std::atomic<juce::int64> stageSamples{ 0 };
+
+    // Ring of recent offenders. Section names are string literals, so storing
+    // the pointer is enough.
+    struct Event
+    {
+        std::atomic<const char*> where{ nullptr };
+        std::atomic<int> type{ 0 };
+    };
+
+    std::array<Event, maxEvents> events;
+    std::atomic<juce::uint32> nextEvent{ 0 };
+};
+
+ #define DARQ_RT_SCOPED_BLOCK(monitor, numSamples, sampleRate) \
+    RealtimeMonitor::ScopedBlock darqRtBlock (monitor, numSamples, sampleRate)
+ #define DARQ_RT_SECTION(name) \
+    RealtimeMonitor::ScopedSection JUCE_JOIN_MACRO (darqRtSection, __LINE__) (name)
+ #define DARQ_RT_STAGE(stage) \
+    RealtimeMonitor::ScopedStage JUCE_JOIN_MACRO (darqRtStage, __LINE__) (RealtimeMonitor::stage)
+ #define DARQ_RT_NOTE_LOCK(site) RealtimeMonitor::noteLock (site)
+
+#else
+
+ #define DARQ_RT_SCOPED_BLOCK(monitor, numSamples, sampleRate)
+ #define DARQ_RT_SECTION(name)
+ #define DARQ_RT_STAGE(stage)
+ #define DARQ_RT_NOTE_LOCK(site)
+
+#endif
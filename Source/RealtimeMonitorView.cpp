@@ -0,0 +1,75 @@
+#include "RealtimeMonitorView.h"
+
+#if DARQ_INSTRUMENTATION
+
+RealtimeMonitorView::RealtimeMonitorView(RealtimeMonitor& monitorToShow)
+    : monitor(monitorToShow)
+{
+    dumpButton.onClick = [this]
+    {
+        auto file = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+                        .getNonexistentChildFile("darQ-realtime", ".json");
+
+        lastDump = monitor.dumpToFile(file) ? "Saved " + file.getFileName() : "Couldn't write " + file.getFullPathName();
+        repaint();
+    };
+
+    resetButton.onClick = [this] { monitor.reset(); };
+
+    addAndMakeVisible(dumpButton);
+    addAndMakeVisible(resetButton);
+
+    setInterceptsMouseClicks(false, true);
+    startTimerHz(4);
+}
+
+void RealtimeMonitorView::timerCallback()
+{
+    snapshot = monitor.getSnapshot();
+    repaint();
+}
+
+void RealtimeMonitorView::paint(juce::Graphics& g)
+{
+    g.setColour(juce::Colours::black.withAlpha(0.7f));
+    g.fillRoundedRectangle(getLocalBounds().toFloat(), 4.0f);
+
+    auto us = [](double value) { return juce::String(value, 1) + " us"; };
+    auto ns = [](double value) { return juce::String(value, 2); };
+
+    juce::StringArray lines;
+    lines.add("blocks " + juce::String((juce::int64)snapshot.blocks)
+              + "   overruns " + juce::String((juce::int64)snapshot.overruns)
+              + "   load " + juce::String(snapshot.lastLoad * 100.0, 1) + "%");
+    lines.add("p50 " + us(snapshot.getPercentileMicros(0.5))
+              + "   p99 " + us(snapshot.getPercentileMicros(0.99))
+              + "   max " + us(snapshot.maxMicros));
+    lines.add("ns/sample  low " + ns(snapshot.stageNanosPerSample[RealtimeMonitor::lowCut])
+              + "  peak " + ns(snapshot.stageNanosPerSample[RealtimeMonitor::peak])
+              + "  high " + ns(snapshot.stageNanosPerSample[RealtimeMonitor::highCut]));
+    lines.add("allocs " + juce::String((juce::int64)snapshot.allocations)
+              + "   locks " + juce::String((juce::int64)snapshot.locks)
+              + (snapshot.recentEvents.isEmpty() ? juce::String() : "   last " + snapshot.recentEvents[0]));
+
+    if (lastDump.isNotEmpty())
+        lines.add(lastDump);
+
+    auto problems = snapshot.allocations > 0 || snapshot.locks > 0 || snapshot.overruns > 0;
+
+    g.setColour(problems ? juce::Colours::orange : juce::Colours::lightgreen);
+    g.setFont(juce::FontOptions(12.0f));
+
+    auto area = getLocalBounds().reduced(6, 4).withTrimmedBottom(24);
+    for (auto& line : lines)
+        g.drawFittedText(line, area.removeFromTop(15), juce::Justification::centredLeft, 1);
+}
+
+void RealtimeMonitorView::resized()
+{
+    auto buttons = getLocalBounds().reduced(6, 4).removeFromBottom(20);
+    resetButton.setBounds(buttons.removeFromRight(60));
+    buttons.removeFromRight(4);
+    dumpButton.setBounds(buttons.removeFromRight(60));
+}
+
+#endif
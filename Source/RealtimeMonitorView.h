@@ -0,0 +1,35 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "RealtimeMonitor.h"
+
+#if DARQ_INSTRUMENTATION
+
+//==============================================================================
+/**
+    Editor overlay for a RealtimeMonitor: block-time percentiles, overruns,
+    audio-thread allocations and locks, and per-group filter cost. "Dump"
+    writes the full snapshot as JSON to the user's documents folder.
+*/
+class RealtimeMonitorView : public juce::Component,
+                            private juce::Timer
+{
+public:
+    explicit RealtimeMonitorView(RealtimeMonitor& monitorToShow);
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+private:
+    void timerCallback() override;
+
+    RealtimeMonitor& monitor;
+    RealtimeMonitor::Snapshot snapshot;
+
+    juce::TextButton dumpButton{ "Dump" }, resetButton{ "Reset" };
+    juce::String lastDump;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeMonitorView)
+};
+
+#endif
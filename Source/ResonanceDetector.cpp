@@ -0,0 +1,224 @@
+#include "ResonanceDetector.h"
+
+namespace
+{
+    constexpr float minProminenceDb = 6.0f;
+    constexpr float minLevelDb = -90.0f;
+
+    // -3 dB width of the analyzer's Blackman-Harris window, in bins; taken out
+    // of the measured bandwidth so the Q isn't capped by the window.
+    constexpr double windowBandwidthBins = 1.9;
+
+    constexpr float trackSmoothing = 0.2f;
+    constexpr float presenceAttack = 0.05f, presenceDecay = 0.95f;
+    constexpr float minCandidatePresence = 0.5f;
+    constexpr int minCandidateFrames = 10;
+}
+
+void ResonanceDetector::reset() noexcept
+{
+    tracks = {};
+
+    const juce::SpinLock::ScopedLockType sl(publishLock);
+    numPublished = 0;
+}
+
+void ResonanceDetector::process(const float* magnitudes, const float* baseline, int fftSize, double sampleRate) noexcept
+{
+    auto numPeaks = findPeaks(magnitudes, baseline, fftSize, sampleRate);
+    updateTracks(numPeaks, sampleRate / fftSize);
+    publish();
+}
+
+int ResonanceDetector::findPeaks(const float* magnitudes, const float* baseline, int fftSize, double sampleRate) noexcept
+{
+    auto lastBin = fftSize / 2;
+    auto binWidth = sampleRate / fftSize;
+    auto floor = juce::Decibels::decibelsToGain(minLevelDb) * (float)fftSize;
+    auto numPeaks = 0;
+
+    for (int bin = 2; bin < lastBin - 1; ++bin)
+    {
+        auto level = magnitudes[bin];
+
+        if (level <= floor || level <= magnitudes[bin - 1] || level < magnitudes[bin + 1])
+            continue;
+
+        auto prominence = juce::Decibels::gainToDecibels(level / juce::jmax(baseline[bin], 1.0e-20f));
+        if (prominence < minProminenceDb)
+            continue;
+
+        // Keep the most prominent few, sorted, by insertion.
+        if (numPeaks == maxPeaksPerFrame && prominence <= peaks[maxPeaksPerFrame - 1].prominenceDb)
+            continue;
+
+        // Parabolic interpolation on the log magnitudes for the centre.
+        auto left = std::log(juce::jmax(magnitudes[bin - 1], 1.0e-20f));
+        auto centre = std::log(level);
+        auto right = std::log(juce::jmax(magnitudes[bin + 1], 1.0e-20f));
+        auto denominator = left - 2.0f * centre + right;
+        auto offset = denominator < 0.0f ? 0.5f * (left - right) / denominator : 0.0f;
+
+        // -3 dB points either side, interpolated between bins.
+        auto halfPower = level * juce::MathConstants<float>::sqrt2 * 0.5f;
+        auto edge = [&](int direction)
+        {
+            for (int step = 1; step <= maxBandwidthSearch; ++step)
+            {
+                auto index = bin + direction * step;
+                if (index <= 0 || index >= lastBin)
+                    break;
+
+                if (magnitudes[index] < halfPower)
+                {
+                    auto previous = magnitudes[index - direction];
+                    auto fraction = (previous - halfPower) / juce::jmax(previous - magnitudes[index], 1.0e-20f);
+                    return (double)(step - 1) + (double)fraction;
+                }
+            }
+
+            return (double)maxBandwidthSearch;
+        };
+
+        auto measuredBins = edge(-1) + edge(1);
+        auto bandwidthBins = std::sqrt(juce::jmax(measuredBins * measuredBins - windowBandwidthBins * windowBandwidthBins, 0.25));
+        auto frequency = ((double)bin + (double)offset) * binWidth;
+
+        Peak peak{ (float)frequency, (float)(frequency / (bandwidthBins * binWidth)), prominence };
+
+        auto position = juce::jmin(numPeaks, maxPeaksPerFrame - 1);
+        while (position > 0 && peaks[(size_t)position - 1].prominenceDb < prominence)
+        {
+            peaks[(size_t)position] = peaks[(size_t)position - 1];
+            --position;
+        }
+
+        peaks[(size_t)position] = peak;
+        numPeaks = juce::jmin(numPeaks + 1, maxPeaksPerFrame);
+    }
+
+    return numPeaks;
+}
+
+void ResonanceDetector::updateTracks(int numPeaks, double binWidth) noexcept
+{
+    std::array<bool, maxTracks> hit{};
+
+    for (int p = 0; p < numPeaks; ++p)
+    {
+        auto& peak = peaks[(size_t)p];
+
+        // Within 1/24 octave, or a bin and a half where bins are wider than that.
+        auto tolerance = juce::jmax((double)peak.frequency * (std::pow(2.0, 1.0 / 24.0) - 1.0), 1.5 * binWidth);
+
+        Track* match = nullptr;
+        auto closest = tolerance;
+
+        for (auto& track : tracks)
+        {
+            auto distance = std::abs((double)(track.frequency - peak.frequency));
+
+            if (track.active && distance <= closest)
+            {
+                closest = distance;
+                match = &track;
+            }
+        }
+
+        if (match == nullptr)
+        {
+            // A free slot, or the weakest track if it is weaker than a new one would be.
+            auto weakest = std::min_element(tracks.begin(), tracks.end(), [](const Track& a, const Track& b)
+                {
+                    return (a.active ? a.presence : -1.0f) < (b.active ? b.presence : -1.0f);
+                });
+
+            if (weakest->active && weakest->presence > presenceAttack)
+                continue;
+
+            *weakest = { true, peak.frequency, peak.q, peak.prominenceDb, 0.0f, 0 };
+            match = &*weakest;
+        }
+        else
+        {
+            match->frequency += trackSmoothing * (peak.frequency - match->frequency);
+            match->q += trackSmoothing * (peak.q - match->q);
+            match->prominenceDb += trackSmoothing * (peak.prominenceDb - match->prominenceDb);
+        }
+
+        hit[(size_t)(match - tracks.data())] = true;
+    }
+
+    for (size_t t = 0; t < tracks.size(); ++t)
+    {
+        auto& track = tracks[t];
+        if (! track.active)
+            continue;
+
+        if (hit[t])
+        {
+            track.presence += presenceAttack * (1.0f - track.presence);
+            ++track.frames;
+        }
+        else
+        {
+            track.presence *= presenceDecay;
+            track.active = track.presence > 0.01f;
+        }
+    }
+
+    // Tracks that drifted onto the same peak: keep the stronger one.
+    for (size_t a = 0; a < tracks.size(); ++a)
+    {
+        for (size_t b = a + 1; b < tracks.size(); ++b)
+        {
+            if (! tracks[a].active || ! tracks[b].active)
+                continue;
+
+            auto tolerance = juce::jmax((double)tracks[a].frequency * (std::pow(2.0, 1.0 / 24.0) - 1.0), 1.5 * binWidth);
+
+            if (std::abs((double)(tracks[a].frequency - tracks[b].frequency)) < tolerance)
+                (tracks[a].presence < tracks[b].presence ? tracks[a] : tracks[b]).active = false;
+        }
+    }
+}
+
+void ResonanceDetector::publish() noexcept
+{
+    std::array<Candidate, maxCandidates> best{};
+    auto count = 0;
+
+    auto score = [](const Candidate& c) { return c.presence * c.prominenceDb; };
+
+    for (auto& track : tracks)
+    {
+        if (! track.active || track.presence < minCandidatePresence || track.frames < minCandidateFrames)
+            continue;
+
+        Candidate candidate{ track.frequency, track.q, track.prominenceDb, track.presence };
+
+        if (count == maxCandidates && score(candidate) <= score(best[maxCandidates - 1]))
+            continue;
+
+        auto position = juce::jmin(count, maxCandidates - 1);
+        while (position > 0 && score(best[(size_t)position - 1]) < score(candidate))
+        {
+            best[(size_t)position] = best[(size_t)position - 1];
+            --position;
+        }
+
+        best[(size_t)position] = candidate;
+        count = juce::jmin(count + 1, maxCandidates);
+    }
+
+    const juce::SpinLock::ScopedLockType sl(publishLock);
+    published = best;
+    numPublished = count;
+}
+
+int ResonanceDetector::getCandidates(Candidate* dest) const noexcept
+{
+    const juce::SpinLock::ScopedLockType sl(publishLock);
+    std::copy(published.begin(), published.begin() + numPublished, dest);
+    return numPublished;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Finds ringing resonances in the analyzer's frames.
+
+    Each frame, local maxima that stand out from the spectrum's 1/3-octave
+    baseline are measured (interpolated frequency, -3 dB bandwidth and so Q)
+    and matched against a fixed set of tracks. A track's presence rises
+    while its peak keeps showing up and decays when it doesn't, so only
+    narrow peaks that persist become candidates, ranked by presence times
+    prominence.
+
+    Runs on the analyzer worker that handles the frame, after the FFT the
+    analyzer does anyway. The work per frame is one pass over the bins plus
+    a bounded number of peaks and tracks.
+*/
+class ResonanceDetector
+{
+public:
+    struct Candidate
+    {
+        float frequency = 0.0f, q = 0.0f;
+        float prominenceDb = 0.0f;   // above the 1/3-octave baseline
+        float presence = 0.0f;       // 0..1
+    };
+
+    static constexpr int maxCandidates = 8;
+
+    void reset() noexcept;
+
+    /** Worker thread. Both spectra hold fftSize / 2 + 1 magnitudes. */
+    void process(const float* magnitudes, const float* baseline, int fftSize, double sampleRate) noexcept;
+
+    /** Best first; returns how many there are. Any thread. */
+    int getCandidates(Candidate* dest) const noexcept;
+
+private:
+    struct Peak
+    {
+        float frequency, q, prominenceDb;
+    };
+
+    struct Track
+    {
+        bool active = false;
+        float frequency = 0.0f, q = 0.0f, prominenceDb = 0.0f, presence = 0.0f;
+        int frames = 0;
+    };
+
+    int findPeaks(const float* magnitudes, const float* baseline, int fftSize, double sampleRate) noexcept;
+    void updateTracks(int numPeaks, double binWidth) noexcept;
+    void publish() noexcept;
+
+    static constexpr int maxPeaksPerFrame = 16, maxTracks = 32, maxBandwidthSearch = 64;
+
+    std::array<Peak, maxPeaksPerFrame> peaks{};
+    std::array<Track, maxTracks> tracks{};
+
+    mutable juce::SpinLock publishLock;
+    std::array<Candidate, maxCandidates> published{};
+    int numPublished = 0;
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "SimdFilterChain.h"
+
+//==============================================================================
+/**
+    Splits a bus into up to maxBands bands with 24 dB/oct Linkwitz-Riley
+    crossovers, all channels at once (one per SIMD lane, as in
+    SimdFilterChain).
+
+    The split is a tree: each band takes the low pass of what is left at its
+    crossover, and the high pass goes on to the next split. An LR4 low or high
+    pass is the cut filters' 12 dB/oct Butterworth section (same tables, same
+    SimdBiquad kernel) run twice. A band below the last split also runs
+    through the allpass of every split above it, so every band gets the same
+    phase and the bands sum back to an allpass: flat in magnitude.
+
+    Band outputs that are null are skipped, apart from the high passes the
+    bands above them need.
+*/
+template <typename SampleType>
+class SimdCrossover
+{
+public:
+    using Vec = juce::dsp::SIMDRegister<SampleType>;
+
+    static constexpr size_t numLanes = Vec::SIMDNumElements;
+    static constexpr int maxBands = 4;
+    static constexpr int maxSplits = maxBands - 1;
+    static constexpr int blockSize = 256;
+
+    void reset() noexcept
+    {
+        for (auto& split : splits)
+            for (auto* sections : { &split.lowPass, &split.highPass })
+                for (auto& section : *sections)
+                    section.reset();
+
+        for (auto& band : allpasses)
+            for (auto& section : band)
+                section.reset();
+    }
+
+    int getNumBands() const noexcept { return numBands; }
+
+    /** numBandsToUse - 1 crossover frequencies; any that are out of order are
+        raised to the one below. Allocation-free, so it can be called every
+        block. */
+    void setCrossovers(const float* frequencies, int numBandsToUse, const CoefficientTables& tables, double sampleRate) noexcept
+    {
+        numBandsToUse = juce::jlimit(1, maxBands, numBandsToUse);
+
+        if (numBandsToUse != numBands)
+        {
+            numBands = numBandsToUse;
+            reset();
+        }
+
+        auto frequency = 0.0;
+
+        for (int split = 0; split < numBands - 1; ++split)
+        {
+            frequency = juce::jmax(frequency, (double)frequencies[split]);
+
+            auto lowPass = tables.makeCutSection(0, 0, false, frequency, sampleRate);
+            auto highPass = tables.makeCutSection(0, 0, true, frequency, sampleRate);
+
+            // LR4 low pass plus high pass: the allpass over the same poles.
+            BiquadCoefficients allpass{ lowPass.a2, lowPass.a1, 1.0, lowPass.a1, lowPass.a2 };
+
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                for (auto& section : splits[(size_t)split].lowPass)
+                    section.setCoefficients(lane, lowPass);
+
+                for (auto& section : splits[(size_t)split].highPass)
+                    section.setCoefficients(lane, highPass);
+
+                for (int band = 0; band < split; ++band)
+                    allpasses[(size_t)band][(size_t)split].setCoefficients(lane, allpass);
+            }
+        }
+    }
+
+    /** bands[b][ch] receives band b (lowest first) of input channel ch. */
+    template <typename IOType>
+    void process(const IOType* const* input, int numChannels, IOType* const* const* bands, int numSamples) noexcept
+    {
+        numChannels = juce::jmin(numChannels, (int)numLanes);
+
+        for (int start = 0; start < numSamples;)
+        {
+            auto num = juce::jmin(numSamples - start, blockSize);
+
+            load(input, numChannels, start, num);
+
+            for (int split = 0; split < numBands - 1; ++split)
+            {
+                if (bands[split] != nullptr)
+                {
+                    std::copy(rest.begin(), rest.begin() + num, band.begin());
+
+                    for (auto& section : splits[(size_t)split].lowPass)
+                        section.process(band.data(), num);
+
+                    for (int above = split + 1; above < numBands - 1; ++above)
+                        allpasses[(size_t)split][(size_t)above].process(band.data(), num);
+
+                    store(band, bands[split], numChannels, start, num);
+                }
+
+                for (auto& section : splits[(size_t)split].highPass)
+                    section.process(rest.data(), num);
+            }
+
+            if (bands[numBands - 1] != nullptr)
+                store(rest, bands[numBands - 1], numChannels, start, num);
+
+            start += num;
+        }
+    }
+
+private:
+    using Frames = std::array<Vec, (size_t)blockSize>;
+
+    template <typename IOType>
+    void load(const IOType* const* input, int numChannels, int start, int numSamples) noexcept
+    {
+        auto* dest = reinterpret_cast<SampleType*>(rest.data());
+
+        for (int i = 0; i < numSamples; ++i, dest += numLanes)
+            for (int ch = 0; ch < (int)numLanes; ++ch)
+                dest[ch] = ch < numChannels ? (SampleType)input[ch][start + i] : SampleType(0);
+    }
+
+    template <typename IOType>
+    static void store(const Frames& frames, IOType* const* channels, int numChannels, int start, int numSamples) noexcept
+    {
+        auto* src = reinterpret_cast<const SampleType*>(frames.data());
+
+        for (int i = 0; i < numSamples; ++i, src += numLanes)
+            for (int ch = 0; ch < numChannels; ++ch)
+                channels[ch][start + i] = (IOType)src[ch];
+    }
+
+    struct Split
+    {
+        std::array<SimdBiquad<SampleType>, 2> lowPass, highPass;
+    };
+
+    std::array<Split, maxSplits> splits;
+    std::array<std::array<SimdBiquad<SampleType>, maxSplits>, maxSplits> allpasses;   // [band][split above it]
+    int numBands = 1;
+
+    Frames rest, band;
+};
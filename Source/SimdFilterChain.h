@@ -0,0 +1,449 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "EQDesign.h"
+#include "CoefficientTables.h"
+#include "RealtimeMonitor.h"
+
+//==============================================================================
+/** External detector input for SimdFilterChain. Each sample is held for
+    `step` samples, so a host-rate sidechain can drive an oversampled chain. */
+template <typename SampleType>
+struct SidechainInput
+{
+    const SampleType* const* channels = nullptr;
+    int numChannels = 0;
+    int step = 1;
+};
+
+//==============================================================================
+/** One biquad per SIMD lane, in transposed direct form II (same as
+    juce::dsp::IIR::Filter). The kernel behind SimdFilterChain's stages and
+    SimdCrossover's sections. */
+template <typename SampleType>
+struct SimdBiquad
+{
+    using Vec = juce::dsp::SIMDRegister<SampleType>;
+
+    Vec b0 = Vec::expand(SampleType(1)), b1 = Vec::expand(SampleType(0)), b2 = Vec::expand(SampleType(0));
+    Vec a1 = Vec::expand(SampleType(0)), a2 = Vec::expand(SampleType(0));
+    Vec s1 = Vec::expand(SampleType(0)), s2 = Vec::expand(SampleType(0));
+
+    void setCoefficients(size_t lane, const BiquadCoefficients& c) noexcept
+    {
+        b0.set(lane, (SampleType)c.b0);
+        b1.set(lane, (SampleType)c.b1);
+        b2.set(lane, (SampleType)c.b2);
+        a1.set(lane, (SampleType)c.a1);
+        a2.set(lane, (SampleType)c.a2);
+    }
+
+    void reset() noexcept
+    {
+        s1 = s2 = Vec::expand(SampleType(0));
+    }
+
+    void process(Vec* x, int numSamples) noexcept
+    {
+        const auto c0 = b0, c1 = b1, c2 = b2, d1 = a1, d2 = a2;
+        auto z1 = s1, z2 = s2;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto in = x[i];
+            auto out = c0 * in + z1;
+            z1 = c1 * in - d1 * out + z2;
+            z2 = c2 * in - d2 * out;
+            x[i] = out;
+        }
+
+        s1 = z1;
+        s2 = z2;
+    }
+};
+
+//==============================================================================
+/**
+    The EQ chain (4 low-cut sections, peak, 4 high-cut sections) run on all
+    channels at once: each channel is one lane of a juce::dsp::SIMDRegister,
+    and every lane has its own coefficients and state.
+
+    Samples are interleaved into the lanes on the way in and converted to the
+    chain's SampleType, so a float buffer can be filtered in double precision
+    without a separate conversion pass. In mid/side mode the encode is folded
+    into that load and the decode into the store, so lane 0 carries mid and
+    lane 1 side, each with its own settings.
+
+    The peak band can be made dynamic per lane (setDynamics). A detector runs
+    on a band-passed copy of the input, or of a sidechain, across all lanes at
+    once, and every dynamicInterval samples the peak's gain is lowered by the
+    detected overshoot through the CoefficientTables fast path.
+*/
+template <typename SampleType>
+class SimdFilterChain
+{
+public:
+    using Vec = juce::dsp::SIMDRegister<SampleType>;
+
+    static constexpr size_t numLanes = Vec::SIMDNumElements;
+    static constexpr int numStages = 2 * ChainCoefficients::maxCutSections + 1;
+    static constexpr int peakStage = ChainCoefficients::maxCutSections;
+    static constexpr int dynamicInterval = 16;
+
+    void prepare(int maximumBlockSize)
+    {
+        frames.resize((size_t)juce::jmax(1, maximumBlockSize));
+        detectorFrames.resize(frames.size());
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto& stage : stages)
+            stage.reset();
+
+        detector.s1 = detector.s2 = detector.peak = detector.envelope = Vec::expand(SampleType(0));
+    }
+
+    /** Takes over the other chain's coefficients and filter state, e.g. to keep
+        the outgoing settings running for a crossfade. Does not allocate; both
+        chains must already be prepared. */
+    void copyStateFrom(const SimdFilterChain& other) noexcept
+    {
+        stages = other.stages;
+        laneDynamics = other.laneDynamics;
+        detector = other.detector;
+        dynamicsActive = other.dynamicsActive;
+        coefficientTables = other.coefficientTables;
+    }
+
+    void setCoefficients(const ChainCoefficients& coefficients) noexcept
+    {
+        for (size_t lane = 0; lane < numLanes; ++lane)
+            setCoefficients(lane, coefficients);
+    }
+
+    void setCoefficients(size_t lane, const ChainCoefficients& coefficients) noexcept
+    {
+        jassert(lane < numLanes);
+
+        for (int i = 0; i < ChainCoefficients::maxCutSections; ++i)
+        {
+            setStage(i, lane, coefficients.lowCut[i], i < coefficients.numLowCut);
+            setStage(peakStage + 1 + i, lane, coefficients.highCut[i], i < coefficients.numHighCut);
+        }
+
+        setStage(peakStage, lane, coefficients.peak, true);
+    }
+
+    /** Makes the peak band of one lane dynamic (or static again). Call after
+        setCoefficients, with the same settings; cheap enough to call every
+        block. */
+    void setDynamics(size_t lane, const ChainSettings& settings, const DynamicSettings& dynamics,
+                     const CoefficientTables& tables, double sampleRate) noexcept
+    {
+        jassert(lane < numLanes);
+
+        auto& d = laneDynamics[lane];
+        d.enabled = dynamics.enabled;
+        d.frequency = settings.peakFreq;
+        d.quality = settings.peakQuality;
+        d.gainInDecibels = settings.peakGainInDecibels;
+        d.design = settings.peakDesign;
+        d.thresholdInDecibels = dynamics.thresholdInDecibels;
+        d.slope = 1.0f - 1.0f / juce::jmax(1.0f, dynamics.ratio);
+        d.sampleRate = sampleRate;
+
+        coefficientTables = &tables;
+
+        auto band = dynamics.enabled ? tables.makeBandPass(settings.peakFreq, settings.peakQuality, sampleRate)
+                                     : BiquadCoefficients{ 0, 0, 0, 0, 0 };
+
+        detector.b0.set(lane, (SampleType)band.b0);
+        detector.negB0.set(lane, (SampleType)-band.b0);
+        detector.a1.set(lane, (SampleType)band.a1);
+        detector.a2.set(lane, (SampleType)band.a2);
+
+        auto timeConstant = [sampleRate](float ms)
+        {
+            return (SampleType)std::exp(-1.0 / (juce::jmax(0.01, (double)ms) * 0.001 * sampleRate));
+        };
+
+        detector.attack.set(lane, timeConstant(dynamics.attackMs));
+        detector.release.set(lane, timeConstant(dynamics.releaseMs));
+
+        if (! dynamics.enabled)
+        {
+            detector.s1.set(lane, SampleType(0));
+            detector.s2.set(lane, SampleType(0));
+            detector.peak.set(lane, SampleType(0));
+            detector.envelope.set(lane, SampleType(0));
+        }
+
+        dynamicsActive = std::any_of(laneDynamics.begin(), laneDynamics.end(),
+                                     [](const LaneDynamics& l) { return l.enabled; });
+    }
+
+    template <typename IOType>
+    void process(juce::dsp::AudioBlock<IOType>& block, bool midSide = false,
+                 const SidechainInput<IOType>& sidechain = {}) noexcept
+    {
+        IOType* channels[numLanes] = {};
+        auto numChannels = juce::jmin(numLanes, block.getNumChannels());
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+            channels[ch] = block.getChannelPointer(ch);
+
+        process(channels, (int)numChannels, (int)block.getNumSamples(), midSide, sidechain);
+    }
+
+    template <typename IOType>
+    void process(IOType* const* channels, int numChannels, int numSamples, bool midSide = false,
+                 const SidechainInput<IOType>& sidechain = {}) noexcept
+    {
+        jassert(numChannels <= (int)numLanes);
+
+        midSide = midSide && numChannels == 2;
+
+        for (int start = 0; start < numSamples;)
+        {
+            auto num = juce::jmin(numSamples - start, (int)frames.size());
+
+            if (midSide)
+                interleave<true>(channels, numChannels, start, num);
+            else
+                interleave<false>(channels, numChannels, start, num);
+
+            // The detector listens to the unfiltered input (or the sidechain).
+            if (dynamicsActive)
+            {
+                if (sidechain.channels != nullptr && sidechain.numChannels > 0)
+                    interleaveSidechain(sidechain, start, num, midSide);
+                else
+                    std::copy(frames.begin(), frames.begin() + num, detectorFrames.begin());
+            }
+
+            {
+                DARQ_RT_STAGE(lowCut);
+                processStages(0, peakStage, num);
+            }
+
+            {
+                DARQ_RT_STAGE(peak);
+
+                if (dynamicsActive)
+                    processDynamicPeak(num);
+                else
+                    processStages(peakStage, peakStage + 1, num);
+            }
+
+            {
+                DARQ_RT_STAGE(highCut);
+                processStages(peakStage + 1, numStages, num);
+            }
+
+            if (midSide)
+                deinterleave<true>(channels, numChannels, start, num);
+            else
+                deinterleave<false>(channels, numChannels, start, num);
+
+            start += num;
+        }
+    }
+
+private:
+    struct Stage : SimdBiquad<SampleType>
+    {
+        std::array<bool, numLanes> laneActive{};
+
+        bool isActive() const noexcept
+        {
+            return std::find(laneActive.begin(), laneActive.end(), true) != laneActive.end();
+        }
+    };
+
+    void setStage(int index, size_t lane, const BiquadCoefficients& c, bool active) noexcept
+    {
+        auto& stage = stages[(size_t)index];
+
+        // An inactive lane is a unity pass-through, so a stage can be shared by
+        // lanes that use it and lanes that don't.
+        stage.setCoefficients(lane, active ? c : BiquadCoefficients{});
+
+        if (! active && stage.laneActive[lane])
+        {
+            stage.s1.set(lane, SampleType(0));
+            stage.s2.set(lane, SampleType(0));
+        }
+
+        stage.laneActive[lane] = active;
+    }
+
+    void processStages(int first, int last, int numSamples) noexcept
+    {
+        for (auto i = first; i < last; ++i)
+            if (stages[(size_t)i].isActive())
+                stages[(size_t)i].process(frames.data(), numSamples);
+    }
+
+    void processDynamicPeak(int numSamples) noexcept
+    {
+        for (int start = 0; start < numSamples; start += dynamicInterval)
+        {
+            auto num = juce::jmin(dynamicInterval, numSamples - start);
+
+            detect(start, num);
+            updateDynamicPeak();
+            stages[(size_t)peakStage].process(frames.data() + start, num);
+        }
+    }
+
+    void detect(int start, int numSamples) noexcept
+    {
+        // Band pass (b1 == 0, b2 == -b0), then a branch-free peak detector:
+        // instant rise with exponential release, smoothed by the attack.
+        const auto b0 = detector.b0, negB0 = detector.negB0, a1 = detector.a1, a2 = detector.a2;
+        const auto attack = detector.attack, release = detector.release;
+        const auto one = Vec::expand(SampleType(1));
+
+        auto s1 = detector.s1, s2 = detector.s2, peak = detector.peak, envelope = detector.envelope;
+        auto* x = detectorFrames.data() + start;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto in = x[i];
+            auto out = b0 * in + s1;
+            s1 = s2 - a1 * out;
+            s2 = negB0 * in - a2 * out;
+
+            auto level = Vec::abs(out);
+            peak = Vec::max(level, release * peak + (one - release) * level);
+            envelope = attack * envelope + (one - attack) * peak;
+        }
+
+        detector.s1 = s1;
+        detector.s2 = s2;
+        detector.peak = peak;
+        detector.envelope = envelope;
+    }
+
+    void updateDynamicPeak() noexcept
+    {
+        for (size_t lane = 0; lane < numLanes; ++lane)
+        {
+            const auto& d = laneDynamics[lane];
+
+            if (! d.enabled)
+                continue;
+
+            auto level = juce::Decibels::gainToDecibels((float)detector.envelope.get(lane), -120.0f);
+            auto reduction = juce::jmax(0.0f, level - d.thresholdInDecibels) * d.slope;
+
+            setStage(peakStage, lane,
+                     coefficientTables->makePeak(d.frequency, d.quality, d.gainInDecibels - reduction, d.sampleRate, d.design),
+                     true);
+        }
+    }
+
+    template <typename IOType>
+    void interleaveSidechain(const SidechainInput<IOType>& sidechain, int start, int numSamples, bool midSide) noexcept
+    {
+        auto* dest = reinterpret_cast<SampleType*>(detectorFrames.data());
+        const auto step = juce::jmax(1, sidechain.step);
+
+        // Mono sidechains key every lane, mid and side included (M/S of a mono
+        // key would leave the side with nothing). Stereo ones follow the lane
+        // layout.
+        const auto encode = midSide && sidechain.numChannels > 1;
+
+        for (int i = 0; i < numSamples; ++i, dest += numLanes)
+        {
+            auto index = (start + i) / step;
+            auto left = (SampleType)sidechain.channels[0][index];
+            auto right = sidechain.numChannels > 1 ? (SampleType)sidechain.channels[1][index] : left;
+
+            dest[0] = encode ? SampleType(0.5) * (left + right) : left;
+
+            if (numLanes > 1)
+                dest[1] = encode ? SampleType(0.5) * (left - right) : right;
+
+            for (size_t ch = 2; ch < numLanes; ++ch)
+                dest[ch] = SampleType(0);
+        }
+    }
+
+    template <bool midSide, typename IOType>
+    void interleave(IOType* const* channels, int numChannels, int start, int numSamples) noexcept
+    {
+        auto* dest = reinterpret_cast<SampleType*>(frames.data());
+
+        for (int i = 0; i < numSamples; ++i, dest += numLanes)
+        {
+            int ch = 0;
+
+            if constexpr (midSide)
+            {
+                auto left = (SampleType)channels[0][start + i];
+                auto right = (SampleType)channels[1][start + i];
+                dest[0] = SampleType(0.5) * (left + right);
+                dest[1] = SampleType(0.5) * (left - right);
+                ch = 2;
+            }
+            else
+            {
+                for (; ch < numChannels; ++ch)
+                    dest[ch] = (SampleType)channels[ch][start + i];
+            }
+
+            for (; ch < (int)numLanes; ++ch)
+                dest[ch] = SampleType(0);
+        }
+    }
+
+    template <bool midSide, typename IOType>
+    void deinterleave(IOType* const* channels, int numChannels, int start, int numSamples) noexcept
+    {
+        auto* src = reinterpret_cast<const SampleType*>(frames.data());
+
+        for (int i = 0; i < numSamples; ++i, src += numLanes)
+        {
+            if constexpr (midSide)
+            {
+                channels[0][start + i] = (IOType)(src[0] + src[1]);
+                channels[1][start + i] = (IOType)(src[0] - src[1]);
+            }
+            else
+            {
+                for (int ch = 0; ch < numChannels; ++ch)
+                    channels[ch][start + i] = (IOType)src[ch];
+            }
+        }
+    }
+
+    std::array<Stage, numStages> stages;
+    std::vector<Vec> frames;
+
+    struct LaneDynamics
+    {
+        bool enabled = false;
+        float frequency = 1000.0f, quality = 1.0f, gainInDecibels = 0.0f;
+        float thresholdInDecibels = 0.0f, slope = 0.0f;
+        int design = PeakDesign_Bilinear;
+        double sampleRate = 44100.0;
+    };
+
+    struct Detector
+    {
+        Vec b0 = Vec::expand(SampleType(0)), negB0 = Vec::expand(SampleType(0));
+        Vec a1 = Vec::expand(SampleType(0)), a2 = Vec::expand(SampleType(0));
+        Vec attack = Vec::expand(SampleType(0)), release = Vec::expand(SampleType(0));
+        Vec s1 = Vec::expand(SampleType(0)), s2 = Vec::expand(SampleType(0));
+        Vec peak = Vec::expand(SampleType(0)), envelope = Vec::expand(SampleType(0));
+    };
+
+    std::array<LaneDynamics, numLanes> laneDynamics{};
+    Detector detector;
+    bool dynamicsActive = false;
+    const CoefficientTables* coefficientTables = nullptr;
+    std::vector<Vec> detectorFrames;
+};
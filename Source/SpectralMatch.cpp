@@ -0,0 +1,414 @@
+#include "SpectralMatch.h"
+
+namespace
+{
+	constexpr int referenceChunkSize = 16384;
+
+	// Outside this range the ear (and most playback systems) care less.
+	constexpr double weightedLow = 40.0, weightedHigh = 16000.0;
+
+	enum FitParameter { peakFreq, peakGain, peakQuality, lowCutFreq, highCutFreq, numFitParameters };
+
+	ChainSettings withStep(ChainSettings settings, int parameter, double delta)
+	{
+		auto octaves = [delta](float value) { return (float)(value * std::pow(2.0, delta)); };
+
+		switch (parameter)
+		{
+		case peakFreq:    settings.peakFreq = juce::jlimit(20.f, 20000.f, octaves(settings.peakFreq)); break;
+		case peakGain:    settings.peakGainInDecibels = juce::jlimit(-20.f, 20.f, settings.peakGainInDecibels + (float)delta); break;
+		case peakQuality: settings.peakQuality = juce::jlimit(0.1f, 10.f, octaves(settings.peakQuality)); break;
+		case lowCutFreq:  settings.lowCutFreq = juce::jlimit(20.f, settings.highCutFreq, octaves(settings.lowCutFreq)); break;
+		case highCutFreq: settings.highCutFreq = juce::jlimit(settings.lowCutFreq, 20000.f, octaves(settings.highCutFreq)); break;
+		default: break;
+		}
+
+		return settings;
+	}
+}
+
+//==============================================================================
+SpectralMatch::AverageSpectrum::AverageSpectrum()
+	: frame((size_t)size), fftData((size_t)size * 2), power((size_t)size / 2 + 1)
+{
+}
+
+void SpectralMatch::AverageSpectrum::reset(double newSampleRate)
+{
+	sampleRate = newSampleRate;
+	filled = 0;
+	numFrames = 0;
+	std::fill(power.begin(), power.end(), 0.0);
+}
+
+void SpectralMatch::AverageSpectrum::push(const float* samples, int numSamples)
+{
+	while (numSamples > 0)
+	{
+		auto num = juce::jmin(numSamples, size - filled);
+		std::copy(samples, samples + num, frame.begin() + filled);
+
+		filled += num;
+		samples += num;
+		numSamples -= num;
+
+		if (filled == size)
+		{
+			analyseFrame();
+
+			// Half-overlapping frames.
+			std::copy(frame.begin() + hopSize, frame.end(), frame.begin());
+			filled = size - hopSize;
+		}
+	}
+}
+
+void SpectralMatch::AverageSpectrum::analyseFrame()
+{
+	std::copy(frame.begin(), frame.end(), fftData.begin());
+	window.multiplyWithWindowingTable(fftData.data(), (size_t)size);
+	fft.performFrequencyOnlyForwardTransform(fftData.data());
+
+	for (size_t bin = 0; bin < power.size(); ++bin)
+		power[bin] += (double)fftData[bin] * (double)fftData[bin];
+
+	++numFrames;
+}
+
+void SpectralMatch::AverageSpectrum::getLevels(const double* frequencies, double* levels, int num) const
+{
+	auto binWidth = sampleRate / size;
+	auto norm = 1.0 / ((double)juce::jmax((juce::int64)1, numFrames) * size * size);
+
+	for (int i = 0; i < num; ++i)
+	{
+		auto first = juce::jlimit(1, (int)power.size() - 1, (int)std::ceil(frequencies[i] * std::pow(2.0, -1.0 / 6.0) / binWidth));
+		auto last = juce::jlimit(1, (int)power.size() - 1, (int)std::floor(frequencies[i] * std::pow(2.0, 1.0 / 6.0) / binWidth));
+
+		// Low bands can be narrower than a bin; take the nearest one.
+		if (last < first)
+			first = last = juce::jlimit(1, (int)power.size() - 1, juce::roundToInt(frequencies[i] / binWidth));
+
+		auto sum = 0.0;
+		for (int bin = first; bin <= last; ++bin)
+			sum += power[(size_t)bin];
+
+		levels[i] = 10.0 * std::log10(sum * norm / (last - first + 1) + 1.0e-20);
+	}
+}
+
+//==============================================================================
+SpectralMatch::SpectralMatch(juce::AudioProcessorValueTreeState& apvts)
+	: juce::Thread("darQ Spectral Match"),
+	  parameters(apvts)
+{
+	for (int i = 0; i < numPoints; ++i)
+	{
+		frequencies[i] = lowestFrequency * std::pow(highestFrequency / lowestFrequency, (double)i / (numPoints - 1));
+		weights[i] = frequencies[i] >= weightedLow && frequencies[i] <= weightedHigh ? 1.0 : 0.25;
+	}
+}
+
+SpectralMatch::~SpectralMatch()
+{
+	stopThread(2000);
+}
+
+void SpectralMatch::prepare(double sampleRate)
+{
+	if (sampleRate != inputSampleRate.exchange(sampleRate))
+	{
+		resetRequested = true;
+		notify();
+	}
+}
+
+void SpectralMatch::startIfNeeded()
+{
+	if (isThreadRunning())
+		return;
+
+	inputBuffer.resize((size_t)inputFifo.getTotalSize());
+	startThread(juce::Thread::Priority::low);
+}
+
+void SpectralMatch::setLearning(bool shouldLearn)
+{
+	if (shouldLearn)
+		startIfNeeded();
+
+	learning = shouldLearn;
+	notify();
+}
+
+void SpectralMatch::resetLearnedInput()
+{
+	resetRequested = true;
+	notify();
+}
+
+void SpectralMatch::loadReference(const juce::File& file)
+{
+	{
+		const juce::ScopedLock sl(lock);
+		pendingReference = file;
+	}
+
+	startIfNeeded();
+	notify();
+}
+
+juce::File SpectralMatch::getReferenceFile() const
+{
+	const juce::ScopedLock sl(lock);
+	return referenceFile;
+}
+
+SpectralMatch::Status SpectralMatch::getStatus() const
+{
+	const juce::ScopedLock sl(lock);
+	return status;
+}
+
+bool SpectralMatch::getResult(ChainSettings& dest) const
+{
+	const juce::ScopedLock sl(lock);
+
+	if (! status.hasResult)
+		return false;
+
+	dest = result;
+	return true;
+}
+
+//==============================================================================
+void SpectralMatch::run()
+{
+	formatManager.registerBasicFormats();
+	inputSpectrum = std::make_unique<AverageSpectrum>();
+	referenceSpectrum = std::make_unique<AverageSpectrum>();
+	inputSpectrum->reset(inputSampleRate.load());
+
+	while (! threadShouldExit())
+	{
+		juce::File newReference;
+		{
+			const juce::ScopedLock sl(lock);
+			std::swap(newReference, pendingReference);
+		}
+
+		if (newReference != juce::File())
+		{
+			referenceReader.reset(formatManager.createReaderFor(newReference));
+			referencePosition = 0;
+
+			const juce::ScopedLock sl(lock);
+			referenceFile = newReference;
+			status.referenceProgress = 0.0f;
+			status.hasResult = false;
+			status.error = referenceReader == nullptr ? "Can't read " + newReference.getFileName() : juce::String();
+
+			if (referenceReader != nullptr)
+				referenceSpectrum->reset(referenceReader->sampleRate);
+		}
+
+		auto busy = drainInput();
+		busy = readReferenceChunk() || busy;
+
+		if (spectraChanged)
+			updateTarget();
+
+		busy = fitStep() || busy;
+
+		if (! busy)
+			wait(learning ? 50 : -1);
+	}
+}
+
+bool SpectralMatch::drainInput()
+{
+	if (resetRequested.exchange(false))
+	{
+		// The FIFO can't be reset under the audio thread; drop what is in it instead.
+		inputFifo.finishedRead(inputFifo.getNumReady());
+		inputSpectrum->reset(inputSampleRate.load());
+		spectraChanged = true;
+
+		const juce::ScopedLock sl(lock);
+		status.learnedSeconds = 0.0;
+		status.hasResult = false;
+	}
+
+	auto numReady = inputFifo.getNumReady();
+	if (numReady == 0)
+		return false;
+
+	int start1, size1, start2, size2;
+	inputFifo.prepareToRead(numReady, start1, size1, start2, size2);
+
+	inputSpectrum->push(inputBuffer.data() + start1, size1);
+	inputSpectrum->push(inputBuffer.data() + start2, size2);
+	inputFifo.finishedRead(size1 + size2);
+
+	spectraChanged = true;
+
+	const juce::ScopedLock sl(lock);
+	status.learnedSeconds = inputSpectrum->getSeconds();
+	return true;
+}
+
+bool SpectralMatch::readReferenceChunk()
+{
+	if (referenceReader == nullptr)
+		return false;
+
+	auto length = referenceReader->lengthInSamples;
+	auto num = (int)juce::jmin((juce::int64)referenceChunkSize, length - referencePosition);
+	auto numChannels = (int)juce::jmax(1u, referenceReader->numChannels);
+
+	if (num > 0)
+	{
+		referenceChunk.setSize(numChannels, referenceChunkSize, false, false, true);
+		monoChunk.resize((size_t)referenceChunkSize);
+
+		referenceReader->read(&referenceChunk, 0, num, referencePosition, true, true);
+		referencePosition += num;
+
+		std::fill(monoChunk.begin(), monoChunk.end(), 0.0f);
+		for (int ch = 0; ch < numChannels; ++ch)
+			juce::FloatVectorOperations::addWithMultiply(monoChunk.data(), referenceChunk.getReadPointer(ch),
+				1.0f / (float)numChannels, num);
+
+		referenceSpectrum->push(monoChunk.data(), num);
+		spectraChanged = true;
+	}
+
+	auto finished = num <= 0 || referencePosition >= length;
+
+	{
+		const juce::ScopedLock sl(lock);
+		status.referenceProgress = length > 0 ? (float)referencePosition / (float)length : 1.0f;
+	}
+
+	if (finished)
+		referenceReader.reset();
+
+	return true;
+}
+
+void SpectralMatch::updateTarget()
+{
+	spectraChanged = false;
+
+	if (inputSpectrum->getNumFrames() == 0 || referenceSpectrum->getNumFrames() == 0)
+		return;
+
+	double inputLevels[numPoints], referenceLevels[numPoints];
+	inputSpectrum->getLevels(frequencies, inputLevels, numPoints);
+	referenceSpectrum->getLevels(frequencies, referenceLevels, numPoints);
+
+	// Only the shape matters: an overall level difference isn't for the EQ to fix.
+	auto sum = 0.0, weightSum = 0.0;
+	for (int i = 0; i < numPoints; ++i)
+	{
+		target[i] = referenceLevels[i] - inputLevels[i];
+		sum += weights[i] * target[i];
+		weightSum += weights[i];
+	}
+
+	auto largest = 0;
+	for (int i = 0; i < numPoints; ++i)
+	{
+		target[i] = juce::jlimit(-20.0, 20.0, target[i] - sum / weightSum);
+
+		if (weights[i] == 1.0 && std::abs(target[i]) > std::abs(target[largest]))
+			largest = i;
+	}
+
+	bool hasResult;
+	{
+		const juce::ScopedLock sl(lock);
+		hasResult = status.hasResult;
+	}
+
+	if (! hasResult)
+	{
+		// Start with the peak band on the biggest difference and the cuts open.
+		best.peakFreq = (float)frequencies[largest];
+		best.peakGainInDecibels = (float)target[largest];
+		best.peakQuality = 1.f;
+		best.lowCutFreq = 20.f;
+		best.highCutFreq = 20000.f;
+		steps = { 1.0, 3.0, 1.0, 1.0, 1.0 };
+	}
+	else
+	{
+		// Warm start: the target usually only moved a little.
+		steps = { 0.25, 1.0, 0.25, 0.25, 0.25 };
+	}
+
+	auto current = parameters.load();
+	best.lowCutSlope = current.lowCutSlope;
+	best.highCutSlope = current.highCutSlope;
+
+	bestError = measureError(best);
+	converged = false;
+}
+
+bool SpectralMatch::fitStep()
+{
+	if (converged)
+		return false;
+
+	// One sweep: each parameter tries a step either way and keeps an improvement.
+	auto improved = false;
+
+	for (int parameter = 0; parameter < numFitParameters; ++parameter)
+	{
+		for (auto direction : { 1.0, -1.0 })
+		{
+			auto candidate = withStep(best, parameter, direction * steps[(size_t)parameter]);
+			auto error = measureError(candidate);
+
+			if (error < bestError)
+			{
+				best = candidate;
+				bestError = error;
+				improved = true;
+				break;
+			}
+		}
+	}
+
+	if (! improved)
+	{
+		for (auto& step : steps)
+			step *= 0.5;
+
+		// Finer than 1/64 octave or 0.05 dB makes no audible difference.
+		converged = steps[peakGain] < 0.05 && steps[peakFreq] < 1.0 / 64.0;
+	}
+
+	const juce::ScopedLock sl(lock);
+	result = best;
+	status.hasResult = true;
+	status.errorInDecibels = (float)std::sqrt(bestError);
+	return true;
+}
+
+double SpectralMatch::measureError(const ChainSettings& settings)
+{
+	// Any rate comfortably above 40 kHz shows the bands up to 20 kHz.
+	auto designRate = juce::jmax(48000.0, inputSampleRate.load());
+	getChainMagnitudes(settings, designRate, frequencies, response, (size_t)numPoints);
+
+	auto sum = 0.0, weightSum = 0.0;
+	for (int i = 0; i < numPoints; ++i)
+	{
+		auto difference = juce::Decibels::gainToDecibels(response[i], -200.0) - target[i];
+		sum += weights[i] * difference * difference;
+		weightSum += weights[i];
+	}
+
+	return sum / weightSum;
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "EQDesign.h"
+
+//==============================================================================
+/**
+	Reference-track matching.
+
+	Builds long-term average spectra of the live input and of a reference
+	file, and fits the main chain's bands (peak frequency, gain and Q, low and
+	high cut frequencies; the cut slopes stay where they are) to the smoothed
+	difference between them.
+
+	Everything heavy runs on the matcher's own thread: the audio thread only
+	copies input into a FIFO while learning, the reference is decoded a chunk
+	at a time (never loaded whole), and the fit takes a few pattern-search
+	steps between chunks, restarting from its last result whenever either
+	spectrum has moved. The result is read on the message thread and applied
+	through the parameters like any other edit.
+
+	An instance that is never asked to match costs nothing: the thread, the
+	input FIFO, the spectra and the audio formats are only set up on the first
+	setLearning(true) or loadReference().
+*/
+class SpectralMatch : private juce::Thread
+{
+public:
+	explicit SpectralMatch(juce::AudioProcessorValueTreeState& apvts);
+	~SpectralMatch() override;
+
+	void prepare(double sampleRate);
+
+	// Audio thread. Does nothing unless learning.
+	template <typename SampleType>
+	void pushInput(const SampleType* const* channels, int numChannels, int numSamples) noexcept
+	{
+		// Acquire: learning is only ever set once inputBuffer exists.
+		if (! learning.load(std::memory_order_acquire) || numChannels == 0)
+			return;
+
+		int start1, size1, start2, size2;
+		inputFifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+		auto gain = 1.0f / (float)numChannels;
+		auto write = [&](int dest, int source, int num)
+		{
+			for (int i = 0; i < num; ++i)
+			{
+				auto sum = 0.0f;
+				for (int ch = 0; ch < numChannels; ++ch)
+					sum += (float)channels[ch][source + i];
+
+				inputBuffer[(size_t)(dest + i)] = sum * gain;
+			}
+		};
+
+		write(start1, 0, size1);
+		write(start2, size1, size2);
+		inputFifo.finishedWrite(size1 + size2);
+	}
+
+	// Message thread
+	void setLearning(bool shouldLearn);
+	bool isLearning() const noexcept { return learning.load(); }
+	void resetLearnedInput();
+
+	void loadReference(const juce::File& file);
+	juce::File getReferenceFile() const;
+
+	struct Status
+	{
+		double learnedSeconds = 0.0;
+		float referenceProgress = 0.0f;   // 1 once the whole file is in
+		bool hasResult = false;
+		float errorInDecibels = 0.0f;     // RMS distance of the fit from the target
+		juce::String error;
+	};
+
+	Status getStatus() const;
+
+	/** The latest fit. False until both spectra exist. */
+	bool getResult(ChainSettings& result) const;
+
+	/** Log-spaced points the spectra are compared at. */
+	static constexpr int numPoints = 96;
+	static constexpr double lowestFrequency = 20.0, highestFrequency = 20000.0;
+
+private:
+	class AverageSpectrum
+	{
+	public:
+		AverageSpectrum();
+
+		void reset(double newSampleRate);
+		void push(const float* samples, int numSamples);
+
+		juce::int64 getNumFrames() const noexcept { return numFrames; }
+		double getSeconds() const noexcept { return (double)numFrames * hopSize / sampleRate; }
+
+		/** Power averaged over 1/3 octave around each point, in dB. */
+		void getLevels(const double* frequencies, double* levels, int num) const;
+
+	private:
+		void analyseFrame();
+
+		static constexpr int order = 13, size = 1 << order, hopSize = size / 2;
+
+		juce::dsp::FFT fft{ order };
+		juce::dsp::WindowingFunction<float> window{ (size_t)size, juce::dsp::WindowingFunction<float>::hann };
+
+		std::vector<float> frame, fftData;
+		std::vector<double> power;
+		int filled = 0;
+		juce::int64 numFrames = 0;
+		double sampleRate = 44100.0;
+	};
+
+	void startIfNeeded();
+	void run() override;
+
+	bool drainInput();
+	bool readReferenceChunk();
+	void updateTarget();
+	bool fitStep();
+
+	double measureError(const ChainSettings& settings);
+
+	ChainParameters parameters;
+
+	std::atomic<bool> learning{ false }, resetRequested{ false };
+	std::atomic<double> inputSampleRate{ 44100.0 };
+
+	juce::AbstractFifo inputFifo{ 1 << 16 };
+	std::vector<float> inputBuffer;   // allocated by startIfNeeded()
+
+	// Matcher thread; the spectra are built when it starts.
+	std::unique_ptr<AverageSpectrum> inputSpectrum, referenceSpectrum;
+	std::unique_ptr<juce::AudioFormatReader> referenceReader;
+	juce::AudioBuffer<float> referenceChunk;
+	juce::int64 referencePosition = 0;
+	std::vector<float> monoChunk;
+
+	double frequencies[numPoints] = {}, target[numPoints] = {}, weights[numPoints] = {}, response[numPoints] = {};
+	bool spectraChanged = false, converged = true;
+
+	// Pattern search over log frequency, gain and log Q.
+	ChainSettings best;
+	double bestError = 0.0;
+	std::array<double, 5> steps{};
+
+	juce::AudioFormatManager formatManager;
+
+	mutable juce::CriticalSection lock;
+	juce::File referenceFile, pendingReference;
+	Status status;
+	ChainSettings result;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectralMatch)
+};
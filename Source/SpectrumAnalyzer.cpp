@@ -1,50 +1,412 @@
 #include "SpectrumAnalyzer.h"
 
+namespace
+{
+    juce::String describeFrequency(float hz)
+    {
+        return hz >= 1000.0f ? juce::String(hz / 1000.0f, 2) + " kHz" : juce::String(juce::roundToInt(hz)) + " Hz";
+    }
+}
+
 SpectrumAnalyzer::SpectrumAnalyzer(SimpleEQAudioProcessor& p)
     : audioProcessor(p)
 {
-    startTimerHz(60); 
 }
 
-void SpectrumAnalyzer::paint(juce::Graphics& g)
+void SpectrumAnalyzer::start()
 {
-    g.setColour(juce::Colours::black);
-    g.fillAll();
+    startTimerHz(AnalyzerHub::frameRateHz);
+}
 
+void SpectrumAnalyzer::paint(juce::Graphics& g)
+{
+    // Transparent: the editor's cached background shows through.
+    drawOverlay(g);
     drawSpectrum(g);
+    drawQualityNote(g);
+    drawReplayNote(g);
+    drawResonances(g);
 }
 
 void SpectrumAnalyzer::timerCallback()
 {
-    if (audioProcessor.isFFTReady())
+    // The FFT itself runs on the hub's workers; here we only pick up the result.
+    auto needsRepaint = false;
+
+    if (replay != nullptr)
+        needsRepaint = updateReplayFrame();
+    else if (auto& tap = audioProcessor.getAnalyzerTap(); tap.getFrameCount() != lastFrame)
+    {
+        lastFrame = tap.copyScopeData(scopeData);
+        needsRepaint = true;
+    }
+
+    if (auto& tap = audioProcessor.getAnalyzerTap(); tap.isDetectingResonances() || numResonances > 0)
+    {
+        numResonances = replay != nullptr ? 0 : tap.getResonances(resonances);
+        needsRepaint = true;
+    }
+
+    if (overlayTap != nullptr && overlayTap->getFrameCount() != lastOverlayFrame)
+    {
+        lastOverlayFrame = overlayTap->copyScopeData(overlayData);
+        needsRepaint = true;
+    }
+
+    if (needsRepaint)
+        repaint();
+}
+
+bool SpectrumAnalyzer::updateReplayFrame()
+{
+    auto now = juce::Time::getMillisecondCounterHiRes();
+    auto elapsed = (now - lastTick) / 1000.0;
+    lastTick = now;
+
+    // Plays back in real time unless the user is scrubbing. A capture that is
+    // still being written keeps growing, so look for new frames at the end.
+    if (! scrubbing)
+    {
+        replayTime += elapsed;
+
+        if (replayTime > replay->getDuration())
+        {
+            replay->refresh();
+            replayTime = juce::jmin(replayTime, replay->getDuration());
+        }
+    }
+
+    auto frame = replay->findFrame(replayTime);
+    if (frame < 0 || frame == replayFrame)
+        return false;
+
+    replayFrame = frame;
+    std::memcpy(scopeData, replay->getBins(frame),
+        sizeof(float) * (size_t)juce::jmin((int)replay->getHeader().scopeSize, AnalyzerTap::scopeSize));
+    return true;
+}
+
+void SpectrumAnalyzer::mouseDown(const juce::MouseEvent& e)
+{
+    if (e.mods.isPopupMenu())
+    {
+        showOverlayMenu();
+        return;
+    }
+
+    if (replay != nullptr)
     {
-        audioProcessor.drawNextFrameOfSpectrum();
-        audioProcessor.setFFTReady(false);
+        scrubbing = true;
+        mouseDrag(e);
+        return;
+    }
+
+    if (auto resonance = findResonanceAt(e.position); resonance >= 0)
+        placeNotch(resonance);
+}
+
+float SpectrumAnalyzer::frequencyToX(float frequency) const
+{
+    // Inverse of the skewed bin mapping drawNextFrameOfSpectrum uses.
+    auto nyquist = (float)audioProcessor.getAnalyzerTap().getSampleRate() * 0.5f;
+    auto proportion = juce::jlimit(0.0f, 1.0f, frequency / nyquist);
+    auto index = (1.0f - std::pow(1.0f - proportion, 5.0f)) * (float)AnalyzerTap::scopeSize;
+
+    return juce::jmap(index, 0.0f, (float)(AnalyzerTap::scopeSize - 1), 0.0f, (float)getWidth());
+}
+
+int SpectrumAnalyzer::findResonanceAt(juce::Point<float> position) const
+{
+    if (position.y > 40.0f)
+        return -1;
+
+    for (int i = 0; i < numResonances; ++i)
+        if (std::abs(frequencyToX(resonances[i].frequency) - position.x) < 8.0f)
+            return i;
+
+    return -1;
+}
+
+void SpectrumAnalyzer::placeNotch(int resonance)
+{
+    // Cuts by the measured prominence, but never more than 12 dB in one click.
+    auto& candidate = resonances[resonance];
+    audioProcessor.placeNotch(candidate.frequency, juce::jlimit(0.5f, 20.0f, candidate.q),
+        juce::jmin(candidate.prominenceDb, 12.0f));
+}
+
+void SpectrumAnalyzer::mouseDrag(const juce::MouseEvent& e)
+{
+    if (! scrubbing || replay == nullptr)
+        return;
+
+    auto proportion = juce::jlimit(0.0, 1.0, (double)e.position.x / juce::jmax(1, getWidth()));
+    replayTime = proportion * replay->getDuration();
+
+    if (updateReplayFrame())
         repaint();
+}
+
+void SpectrumAnalyzer::mouseUp(const juce::MouseEvent&)
+{
+    scrubbing = false;
+}
+
+void SpectrumAnalyzer::showOverlayMenu()
+{
+    juce::PopupMenu menu;
+    menu.addSectionHeader("Overlay");
+    menu.addItem(-1, "None", true, overlayTap == nullptr);
+
+    auto ownId = audioProcessor.getAnalyzerTap().getId();
+
+    for (auto* tap : audioProcessor.getAnalyzerHub().getTaps())
+        if (tap->getId() != ownId)
+            menu.addItem(tap->getId(), tap->getName(), true,
+                overlayTap != nullptr && overlayTap->getId() == tap->getId());
+
+    // Capture items use negative IDs below the "None" overlay entry.
+    enum { startCapture = -100, stopCapture, openReplay, backToLive };
+
+    auto& ownTap = audioProcessor.getAnalyzerTap();
+
+    // One smoothing item per fraction, numbered up from smoothingBase.
+    constexpr int smoothingBase = -200;
+
+    menu.addSectionHeader("Smoothing");
+
+    for (int fraction = 0; fraction < OctaveSmoothing::numFractions; ++fraction)
+        menu.addItem(smoothingBase + fraction, OctaveSmoothing::getName(fraction), true, ownTap.getSmoothing() == fraction);
+
+    constexpr int detectResonances = -300, resonanceBase = -299;
+
+    menu.addSectionHeader("Resonances");
+    menu.addItem(detectResonances, "Detect resonances", true, ownTap.isDetectingResonances());
+
+    for (int i = 0; i < numResonances; ++i)
+        menu.addItem(resonanceBase + i, juce::String(i + 1) + ": notch " + describeFrequency(resonances[i].frequency)
+            + ", Q " + juce::String(resonances[i].q, 1) + " (+" + juce::String(resonances[i].prominenceDb, 1) + " dB)");
+
+    menu.addSectionHeader("Capture");
+
+    if (ownTap.isCapturing())
+        menu.addItem(stopCapture, "Stop capture to " + ownTap.getCaptureFile().getFileName());
+    else
+        menu.addItem(startCapture, "Capture spectrum to file...");
+
+    menu.addItem(openReplay, "Replay capture...");
+
+    if (replay != nullptr)
+        menu.addItem(backToLive, "Back to live");
+
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(this),
+        [safeThis = juce::Component::SafePointer<SpectrumAnalyzer>(this)](int result)
+        {
+            if (safeThis == nullptr || result == 0)
+                return;
+
+            if (result == detectResonances)
+            {
+                auto& tap = safeThis->audioProcessor.getAnalyzerTap();
+                tap.setResonanceDetection(! tap.isDetectingResonances());
+                return;
+            }
+
+            if (result >= resonanceBase && result < resonanceBase + safeThis->numResonances)
+            {
+                safeThis->placeNotch(result - resonanceBase);
+                return;
+            }
+
+            if (result >= smoothingBase && result < smoothingBase + OctaveSmoothing::numFractions)
+            {
+                safeThis->audioProcessor.getAnalyzerTap().setSmoothing(result - smoothingBase);
+                return;
+            }
+
+            switch (result)
+            {
+                case startCapture: safeThis->chooseCaptureFile(false); break;
+                case stopCapture:  safeThis->audioProcessor.getAnalyzerTap().stopCapture(); break;
+                case openReplay:   safeThis->chooseCaptureFile(true); break;
+                case backToLive:   safeThis->setReplayFile({}); break;
+                default:           safeThis->setOverlayTap(result); break;
+            }
+        });
+}
+
+void SpectrumAnalyzer::chooseCaptureFile(bool forReplay)
+{
+    auto defaultFile = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+        .getChildFile("darQ capture " + juce::Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S") + ".darqspec");
+
+    fileChooser = std::make_unique<juce::FileChooser>(forReplay ? "Replay spectrum capture" : "Capture spectrum to",
+        forReplay ? defaultFile.getParentDirectory() : defaultFile, "*.darqspec");
+
+    auto flags = juce::FileBrowserComponent::canSelectFiles
+        | (forReplay ? juce::FileBrowserComponent::openMode
+                     : juce::FileBrowserComponent::saveMode | juce::FileBrowserComponent::warnAboutOverwriting);
+
+    fileChooser->launchAsync(flags,
+        [safeThis = juce::Component::SafePointer<SpectrumAnalyzer>(this), forReplay](const juce::FileChooser& chooser)
+        {
+            auto file = chooser.getResult();
+            if (safeThis == nullptr || file == juce::File())
+                return;
+
+            if (forReplay)
+            {
+                safeThis->setReplayFile(file);
+                return;
+            }
+
+            auto result = safeThis->audioProcessor.getAnalyzerTap().startCapture(file.withFileExtension("darqspec"));
+            if (result.failed())
+                juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon,
+                    "Spectrum capture", result.getErrorMessage());
+        });
+}
+
+void SpectrumAnalyzer::setReplayFile(const juce::File& file)
+{
+    replay.reset();
+    replayFrame = -1;
+    replayTime = 0.0;
+    lastTick = juce::Time::getMillisecondCounterHiRes();
+    lastFrame = 0;
+
+    if (file != juce::File())
+    {
+        auto reader = std::make_unique<SpectrumCapture::Reader>(file);
+
+        if (! reader->isValid())
+        {
+            juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon,
+                "Spectrum capture", file.getFileName() + " isn't a spectrum capture.");
+            return;
+        }
+
+        replay = std::move(reader);
+        updateReplayFrame();
+    }
+
+    repaint();
+}
+
+void SpectrumAnalyzer::setOverlayTap(int tapId)
+{
+    overlayTap = tapId > 0 ? audioProcessor.getAnalyzerHub().findTap(tapId) : nullptr;
+    lastOverlayFrame = 0;
+    juce::zeromem(overlayData, sizeof(overlayData));
+    repaint();
+}
+
+void SpectrumAnalyzer::drawQualityNote(juce::Graphics& g)
+{
+    // Only shown while the hub has backed off because of callback load.
+    auto& hub = audioProcessor.getAnalyzerHub();
+    auto level = hub.getQualityLevel();
+    if (level == 0)
+        return;
+
+    auto text = juce::String("Analyzer ") + AnalyzerHub::getQuality(level).name
+        + " (load " + juce::String(juce::roundToInt(hub.getLoad() * 100.0f)) + "%)";
+
+    g.setColour(juce::Colours::orange.withAlpha(0.8f));
+    g.setFont(juce::FontOptions(11.0f));
+    g.drawText(text, getLocalBounds().reduced(8).removeFromBottom(14), juce::Justification::bottomLeft);
+}
+
+void SpectrumAnalyzer::drawReplayNote(juce::Graphics& g)
+{
+    auto& tap = audioProcessor.getAnalyzerTap();
+    auto area = getLocalBounds().reduced(8).removeFromTop(14);
+
+    g.setFont(juce::FontOptions(11.0f));
+
+    if (tap.isCapturing())
+    {
+        g.setColour(juce::Colours::red.withAlpha(0.8f));
+        g.drawText("REC " + tap.getCaptureFile().getFileName(), area, juce::Justification::topRight);
     }
+
+    if (replay == nullptr)
+        return;
+
+    auto duration = replay->getDuration();
+    auto time = replayFrame >= 0 ? replay->getFrameTime(replayFrame) : 0.0;
+
+    g.setColour(juce::Colours::white.withAlpha(0.8f));
+    g.drawText("Replay " + replay->getFile().getFileName() + "  " + juce::String(time, 1)
+        + " / " + juce::String(duration, 1) + " s", area, juce::Justification::topLeft);
+
+    // Playhead; click or drag anywhere to scrub.
+    auto x = duration > 0.0 ? (float)(time / duration) * (float)getWidth() : 0.0f;
+    g.setColour(juce::Colours::white.withAlpha(0.3f));
+    g.drawVerticalLine(juce::roundToInt(x), 0.0f, (float)getHeight());
+}
+
+void SpectrumAnalyzer::drawResonances(juce::Graphics& g)
+{
+    // Numbered markers along the top, best first; click one to notch it.
+    g.setFont(juce::FontOptions(11.0f));
+
+    for (int i = 0; i < numResonances; ++i)
+    {
+        auto x = frequencyToX(resonances[i].frequency);
+
+        juce::Path marker;
+        marker.addTriangle(x - 5.0f, 24.0f, x + 5.0f, 24.0f, x, 32.0f);
+
+        g.setColour(juce::Colours::yellow.withAlpha(juce::jmap(resonances[i].presence, 0.5f, 1.0f, 0.4f, 0.9f)));
+        g.fillPath(marker);
+        g.drawText(juce::String(i + 1), juce::Rectangle<float>(x - 10.0f, 10.0f, 20.0f, 14.0f), juce::Justification::centred);
+    }
+}
+
+void SpectrumAnalyzer::drawOverlay(juce::Graphics& g)
+{
+    if (overlayTap == nullptr)
+        return;
+
+    auto bounds = getLocalBounds().toFloat();
+    juce::Path path;
+
+    for (int i = 0; i < AnalyzerTap::scopeSize; ++i)
+    {
+        auto x = juce::jmap((float)i, 0.0f, (float)(AnalyzerTap::scopeSize - 1), bounds.getX(), bounds.getRight());
+        auto y = juce::jmap(overlayData[i], 0.0f, 1.0f, bounds.getBottom(), bounds.getY());
+
+        if (i == 0)
+            path.startNewSubPath(x, y);
+        else
+            path.lineTo(x, y);
+    }
+
+    g.setColour(juce::Colours::white.withAlpha(0.35f));
+    g.strokePath(path, juce::PathStrokeType(1.0f));
 }
 void SpectrumAnalyzer::drawSpectrum(juce::Graphics& g)
 {
-    auto* scopeData = audioProcessor.getScopeData();
     auto bounds = getLocalBounds().toFloat();
 
     constexpr float silenceThreshold = 0.001f; // Umbral bajo para evitar ruido residual
 
-    for (int i = 1; i < SimpleEQAudioProcessor::scopeSize; ++i)
+    for (int i = 1; i < AnalyzerTap::scopeSize; ++i)
     {
         // Omitir segmentos si alguno de los extremos est por debajo del umbral
         if (scopeData[i - 1] < silenceThreshold && scopeData[i] < silenceThreshold)
             continue;
 
-        float x1 = juce::jmap((float)(i - 1), 0.0f, (float)(SimpleEQAudioProcessor::scopeSize - 1),
+        float x1 = juce::jmap((float)(i - 1), 0.0f, (float)(AnalyzerTap::scopeSize - 1),
             bounds.getX(), bounds.getRight());
         float y1 = juce::jmap(scopeData[i - 1], 0.0f, 1.0f, bounds.getBottom(), bounds.getY());
 
-        float x2 = juce::jmap((float)i, 0.0f, (float)(SimpleEQAudioProcessor::scopeSize - 1),
+        float x2 = juce::jmap((float)i, 0.0f, (float)(AnalyzerTap::scopeSize - 1),
             bounds.getX(), bounds.getRight());
         float y2 = juce::jmap(scopeData[i], 0.0f, 1.0f, bounds.getBottom(), bounds.getY());
 
-        float t = (float)i / (SimpleEQAudioProcessor::scopeSize - 1);
+        float t = (float)i / (AnalyzerTap::scopeSize - 1);
 
         juce::Colour lowFreqColour = juce::Colour(0, 0, 255);     // Azul
         juce::Colour highFreqColour = juce::Colour(255, 0, 0);    // Rojo
@@ -12,12 +12,51 @@ public:
 
     void paint(juce::Graphics&) override;
     void resized() override {}
+    void mouseDown(const juce::MouseEvent&) override;
+    void mouseDrag(const juce::MouseEvent&) override;
+    void mouseUp(const juce::MouseEvent&) override;
     void timerCallback() override;
 
+    // Starts picking up frames; the editor calls it after its first paint.
+    void start();
+
+    // Overlays the spectrum of another instance registered with the hub.
+    void setOverlayTap(int tapId);
+
+    // Shows a capture file instead of the live spectrum; an empty file goes back to live.
+    void setReplayFile(const juce::File& file);
+
 private:
     void drawSpectrum(juce::Graphics&);
+    void drawOverlay(juce::Graphics&);
+    void drawQualityNote(juce::Graphics&);
+    void drawReplayNote(juce::Graphics&);
+    void drawResonances(juce::Graphics&);
+    void showOverlayMenu();
+    void chooseCaptureFile(bool forReplay);
+    bool updateReplayFrame();
+
+    float frequencyToX(float frequency) const;
+    int findResonanceAt(juce::Point<float> position) const;
+    void placeNotch(int resonance);
 
     SimpleEQAudioProcessor& audioProcessor;
 
+    float scopeData[AnalyzerTap::scopeSize] = {};
+    float overlayData[AnalyzerTap::scopeSize] = {};
+    juce::uint32 lastFrame = 0, lastOverlayFrame = 0;
+
+    AnalyzerTap::Ptr overlayTap;
+
+    ResonanceDetector::Candidate resonances[ResonanceDetector::maxCandidates];
+    int numResonances = 0;
+
+    std::unique_ptr<SpectrumCapture::Reader> replay;
+    double replayTime = 0.0, lastTick = 0.0;
+    int replayFrame = -1;
+    bool scrubbing = false;
+
+    std::unique_ptr<juce::FileChooser> fileChooser;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyzer)
 };
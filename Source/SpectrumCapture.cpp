@@ -0,0 +1,198 @@
+#include "SpectrumCapture.h"
+
+namespace SpectrumCapture
+{
+    namespace
+    {
+        const char magic[4] = { 'd', 'Q', 'S', 'C' };
+
+        static_assert(std::is_trivially_copyable_v<FileHeader>, "the header is written with memcpy");
+        static_assert(sizeof(FrameHeader) == 16, "frames must keep the bins float-aligned");
+    }
+
+    //==============================================================================
+    Writer::Writer(const juce::File& f, double sampleRate, int fftSize, int hopSize, int numBins)
+        : file(f),
+          scopeSize(numBins),
+          frameSize(sizeof(FrameHeader) + sizeof(float) * (size_t)numBins)
+    {
+        file.deleteFile();
+        stream = std::make_unique<juce::FileOutputStream>(file);
+
+        if (stream->failedToOpen())
+        {
+            status = stream->getStatus();
+            stream.reset();
+            return;
+        }
+
+        FileHeader header{};
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = currentVersion;
+        header.headerSize = (juce::uint32)sizeof(FileHeader);
+        header.frameSize = (juce::uint32)frameSize;
+        header.sampleRate = sampleRate;
+        header.fftSize = (juce::uint32)fftSize;
+        header.hopSize = (juce::uint32)hopSize;
+        header.scopeSize = (juce::uint32)scopeSize;
+        header.startTime = juce::Time::currentTimeMillis();
+
+        if (! stream->write(&header, sizeof(header)))
+            status = juce::Result::fail("can't write " + file.getFullPathName());
+
+        pending.setSize(frameSize * batchFrames);
+        writing.setSize(frameSize * batchFrames);
+        lastFlush = juce::Time::getMillisecondCounter();
+    }
+
+    Writer::~Writer()
+    {
+        flush();
+    }
+
+    void Writer::append(juce::int64 samplePosition, int fftOrder, int hopSize, const float* bins)
+    {
+        if (stream == nullptr)
+            return;
+
+        FrameHeader frame{ samplePosition, fftOrder, hopSize };
+
+        const juce::ScopedLock sl(batchLock);
+
+        // Only grows if the hub falls behind; a batch is normally preallocated.
+        if (pending.getSize() < pendingBytes + frameSize)
+            pending.setSize(2 * (pendingBytes + frameSize));
+
+        auto* dest = static_cast<char*>(pending.getData()) + pendingBytes;
+        std::memcpy(dest, &frame, sizeof(frame));
+        std::memcpy(dest + sizeof(frame), bins, sizeof(float) * (size_t)scopeSize);
+        pendingBytes += frameSize;
+    }
+
+    void Writer::flushIfDue()
+    {
+        size_t bytes;
+        {
+            const juce::ScopedLock sl(batchLock);
+            bytes = pendingBytes;
+        }
+
+        if (bytes >= frameSize * batchFrames
+            || (bytes > 0 && juce::Time::getMillisecondCounter() - lastFlush >= maxBatchAgeMs))
+            flush();
+    }
+
+    void Writer::flush()
+    {
+        const juce::ScopedLock wl(writeLock);
+
+        if (stream == nullptr)
+            return;
+
+        size_t bytes;
+        {
+            // Swap batches so the workers can keep appending while this one is written.
+            const juce::ScopedLock sl(batchLock);
+            std::swap(pending, writing);
+            bytes = pendingBytes;
+            pendingBytes = 0;
+        }
+
+        lastFlush = juce::Time::getMillisecondCounter();
+
+        if (bytes == 0)
+            return;
+
+        if (! stream->write(writing.getData(), bytes))
+        {
+            status = juce::Result::fail("can't write " + file.getFullPathName());
+            return;
+        }
+
+        stream->flush();
+        framesWritten += (juce::int64)(bytes / frameSize);
+    }
+
+    //==============================================================================
+    Reader::Reader(const juce::File& f)
+        : file(f)
+    {
+        refresh();
+    }
+
+    void Reader::refresh()
+    {
+        numFrames = -1;
+        map = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+
+        auto size = map->getSize();
+        if (map->getData() == nullptr || size < sizeof(FileHeader))
+            return;
+
+        std::memcpy(&header, map->getData(), sizeof(FileHeader));
+
+        if (std::memcmp(header.magic, magic, sizeof(magic)) != 0
+            || header.version > currentVersion
+            || header.headerSize < sizeof(FileHeader)
+            || header.frameSize != sizeof(FrameHeader) + sizeof(float) * header.scopeSize
+            || header.sampleRate <= 0.0
+            || size < header.headerSize)
+            return;
+
+        // A frame still being written when the file was mapped isn't counted.
+        numFrames = (int)juce::jmin((size_t)std::numeric_limits<int>::max(),
+            (size - header.headerSize) / header.frameSize);
+    }
+
+    const char* Reader::getFrameData(int index) const noexcept
+    {
+        jassert(juce::isPositiveAndBelow(index, getNumFrames()));
+        return static_cast<const char*>(map->getData()) + header.headerSize + (size_t)index * header.frameSize;
+    }
+
+    const FrameHeader& Reader::getFrameHeader(int index) const noexcept
+    {
+        return *reinterpret_cast<const FrameHeader*>(getFrameData(index));
+    }
+
+    const float* Reader::getBins(int index) const noexcept
+    {
+        return reinterpret_cast<const float*>(getFrameData(index) + sizeof(FrameHeader));
+    }
+
+    double Reader::getFrameTime(int index) const noexcept
+    {
+        if (getNumFrames() == 0)
+            return 0.0;
+
+        auto first = getFrameHeader(0).samplePosition;
+        return (double)(getFrameHeader(index).samplePosition - first) / header.sampleRate;
+    }
+
+    double Reader::getDuration() const noexcept
+    {
+        return getNumFrames() > 0 ? getFrameTime(getNumFrames() - 1) : 0.0;
+    }
+
+    int Reader::findFrame(double seconds) const noexcept
+    {
+        if (getNumFrames() == 0)
+            return -1;
+
+        // Positions only grow, so this is a binary search straight over the mapping.
+        auto target = getFrameHeader(0).samplePosition + (juce::int64)(seconds * header.sampleRate);
+        int low = 0, high = getNumFrames() - 1;
+
+        while (low < high)
+        {
+            auto mid = (low + high + 1) / 2;
+
+            if (getFrameHeader(mid).samplePosition <= target)
+                low = mid;
+            else
+                high = mid - 1;
+        }
+
+        return low;
+    }
+}
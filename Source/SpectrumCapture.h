@@ -0,0 +1,124 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Spectrum capture files.
+
+    An append-only recording of the analyzer's scope frames, so a problem
+    frequency a client reports can be looked at again later. A fixed header
+    is followed by frames of a fixed stride, each a FrameHeader and
+    scopeSize floats:
+
+        FileHeader | FrameHeader bins[scopeSize] | FrameHeader bins[scopeSize] | ...
+
+    The frame count follows from the file size, so nothing is patched after
+    the fact and a capture that was cut short is still readable up to its
+    last whole frame. Values are stored in the machine's byte order.
+
+    The Writer batches frames in memory and is flushed from the analyzer
+    hub's thread; the Reader memory-maps the file, so replaying or scrubbing
+    an hour-long capture doesn't load it into RAM.
+*/
+namespace SpectrumCapture
+{
+    constexpr juce::uint32 currentVersion = 1;
+
+    struct FileHeader
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::uint32 headerSize;
+        juce::uint32 frameSize;     // stride in bytes, FrameHeader included
+        double sampleRate;
+        juce::uint32 fftSize;       // at the start; frames record their own
+        juce::uint32 hopSize;
+        juce::uint32 scopeSize;
+        juce::uint32 reserved;
+        juce::int64 startTime;      // milliseconds since 1970
+    };
+
+    struct FrameHeader
+    {
+        juce::int64 samplePosition; // end of the analysed frame in the stream
+        juce::int32 fftOrder;
+        juce::int32 hopSize;
+    };
+
+    //==============================================================================
+    class Writer
+    {
+    public:
+        Writer(const juce::File& file, double sampleRate, int fftSize, int hopSize, int scopeSize);
+        ~Writer();
+
+        juce::Result getStatus() const { return status; }
+        const juce::File& getFile() const noexcept { return file; }
+
+        /** Analyzer workers. Only copies the frame into the pending batch. */
+        void append(juce::int64 samplePosition, int fftOrder, int hopSize, const float* bins);
+
+        /** Writes the pending batch once it is big or old enough. */
+        void flushIfDue();
+        void flush();
+
+        juce::int64 getNumFramesWritten() const noexcept { return framesWritten.load(); }
+
+    private:
+        const juce::File file;
+        const int scopeSize;
+        const size_t frameSize;
+
+        juce::Result status{ juce::Result::ok() };
+        std::unique_ptr<juce::FileOutputStream> stream;
+
+        juce::CriticalSection batchLock;
+        juce::MemoryBlock pending, writing;
+        size_t pendingBytes = 0;
+
+        juce::CriticalSection writeLock;
+        juce::uint32 lastFlush = 0;
+        std::atomic<juce::int64> framesWritten{ 0 };
+
+        static constexpr int batchFrames = 64;
+        static constexpr juce::uint32 maxBatchAgeMs = 500;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Writer)
+    };
+
+    //==============================================================================
+    class Reader
+    {
+    public:
+        explicit Reader(const juce::File& file);
+
+        bool isValid() const noexcept { return numFrames >= 0; }
+        const juce::File& getFile() const noexcept { return file; }
+        const FileHeader& getHeader() const noexcept { return header; }
+
+        int getNumFrames() const noexcept { return juce::jmax(0, numFrames); }
+        const FrameHeader& getFrameHeader(int index) const noexcept;
+        const float* getBins(int index) const noexcept;
+
+        /** Seconds from the first frame. */
+        double getFrameTime(int index) const noexcept;
+        double getDuration() const noexcept;
+
+        /** Last frame at or before the given time. */
+        int findFrame(double seconds) const noexcept;
+
+        /** Maps the file again to pick up frames written since. */
+        void refresh();
+
+    private:
+        const char* getFrameData(int index) const noexcept;
+
+        const juce::File file;
+        std::unique_ptr<juce::MemoryMappedFile> map;
+        FileHeader header{};
+        int numFrames = -1;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Reader)
+    };
+}
@@ -0,0 +1,56 @@
+#include "StereoScope.h"
+
+void StereoScope::prepare(double sampleRate)
+{
+    binLength = juce::jmax(1, juce::roundToInt(sampleRate / binsPerSecond));
+    decimation = juce::jmax(1, juce::roundToInt(sampleRate / pointRate));
+    reset();
+}
+
+void StereoScope::reset() noexcept
+{
+    // The FIFO belongs to the reader as much as to us, so it is left alone;
+    // the reader drains whatever is still in it.
+    binFill = 0;
+    binSums = {};
+    bins.fill({});
+    binIndex = 0;
+    nextPoint = 0;
+
+    correlation.store(0.0f, std::memory_order_relaxed);
+}
+
+void StereoScope::finishBin() noexcept
+{
+    binIndex = (binIndex + 1) % correlationBins;
+    bins[(size_t)binIndex] = binSums;
+    binSums = {};
+    binFill = 0;
+
+    Sums window;
+
+    for (const auto& bin : bins)
+    {
+        window.lr += bin.lr;
+        window.ll += bin.ll;
+        window.rr += bin.rr;
+    }
+
+    // Below -120 dBFS on either side there is nothing to correlate.
+    const auto floor = 1.0e-12 * binLength * correlationBins;
+    auto value = window.ll > floor && window.rr > floor ? window.lr / std::sqrt(window.ll * window.rr) : 0.0;
+
+    correlation.store((float)juce::jlimit(-1.0, 1.0, value), std::memory_order_relaxed);
+}
+
+int StereoScope::readPoints(Point* dest, int maxPoints) noexcept
+{
+    int copied = 0;
+
+    fifo.read(juce::jmin(maxPoints, fifo.getNumReady())).forEach([&](int index)
+        {
+            dest[copied++] = points[(size_t)index];
+        });
+
+    return copied;
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Feeds the goniometer and correlation meter from one stereo bus.
+
+    The audio thread calls process() with the left and right channels. Every
+    few samples (about pointRate per second, whatever the sample rate) one
+    mid/side point goes into a lock-free FIFO for a single reader to drain
+    with readPoints(); points that don't fit are dropped. The correlation
+    coefficient sum(LR) / sqrt(sum(L^2) sum(R^2)) is taken from running sums
+    over 100 ms bins, published over the last correlationBins of them.
+*/
+class StereoScope
+{
+public:
+    static constexpr int pointRate = 12000;
+    static constexpr int fifoSize = 8192;
+    static constexpr int binsPerSecond = 10;
+    static constexpr int correlationBins = 3;
+
+    /** Scaled so a full-scale mono signal reaches mid = 1 and one hard-panned
+        channel lies on the diagonal. */
+    struct Point
+    {
+        float mid = 0, side = 0;
+    };
+
+    StereoScope() = default;
+
+    void prepare(double sampleRate);
+
+    // Audio thread
+    void reset() noexcept;
+
+    template <typename SampleType>
+    void process(const SampleType* left, const SampleType* right, int numSamples) noexcept
+    {
+        for (int start = 0; start < numSamples;)
+        {
+            // Chunks end on bin boundaries.
+            auto num = juce::jmin(numSamples - start, binLength - binFill);
+
+            accumulateProducts(left + start, right + start, num, binSums);
+
+            binFill += num;
+            start += num;
+
+            if (binFill == binLength)
+                finishBin();
+        }
+
+        pushPoints(left, right, numSamples);
+    }
+
+    // Any thread
+    float getCorrelation() const noexcept { return correlation.load(std::memory_order_relaxed); }
+
+    // Reader thread, one at a time. Returns the number of points copied.
+    int readPoints(Point* dest, int maxPoints) noexcept;
+
+private:
+    //==============================================================================
+    struct Sums
+    {
+        double lr = 0, ll = 0, rr = 0;
+    };
+
+    /** Adds sum(LR), sum(L^2) and sum(R^2), vectorised where both channels
+        share an alignment (they do in every host we've seen). */
+    template <typename SampleType>
+    static void accumulateProducts(const SampleType* l, const SampleType* r, int n, Sums& sums) noexcept
+    {
+        using Vec = juce::dsp::SIMDRegister<SampleType>;
+        constexpr auto width = (int)Vec::SIMDNumElements;
+
+        SampleType lr{}, ll{}, rr{};
+        int i = 0;
+
+        for (; i < n && ! Vec::isSIMDAligned(l + i); ++i)
+        {
+            lr += l[i] * r[i];
+            ll += l[i] * l[i];
+            rr += r[i] * r[i];
+        }
+
+        auto vecLR = Vec::expand(SampleType(0));
+        auto vecLL = Vec::expand(SampleType(0));
+        auto vecRR = Vec::expand(SampleType(0));
+
+        if (Vec::isSIMDAligned(r + i))
+        {
+            for (; i + width <= n; i += width)
+            {
+                auto vl = Vec::fromRawArray(l + i);
+                auto vr = Vec::fromRawArray(r + i);
+                vecLR += vl * vr;
+                vecLL += vl * vl;
+                vecRR += vr * vr;
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            lr += l[i] * r[i];
+            ll += l[i] * l[i];
+            rr += r[i] * r[i];
+        }
+
+        sums.lr += (double)lr + (double)vecLR.sum();
+        sums.ll += (double)ll + (double)vecLL.sum();
+        sums.rr += (double)rr + (double)vecRR.sum();
+    }
+
+    template <typename SampleType>
+    void pushPoints(const SampleType* left, const SampleType* right, int numSamples) noexcept
+    {
+        if (nextPoint >= numSamples)
+        {
+            nextPoint -= numSamples;
+            return;
+        }
+
+        auto first = nextPoint;
+        auto numPoints = (numSamples - first + decimation - 1) / decimation;
+        nextPoint = first + numPoints * decimation - numSamples;
+
+        // Writes as many as fit; the rest of the block's points are lost.
+        int point = 0;
+        fifo.write(numPoints).forEach([&](int index)
+            {
+                auto i = first + point++ * decimation;
+                auto l = (float)left[i], r = (float)right[i];
+                points[(size_t)index] = { 0.5f * (l + r), 0.5f * (l - r) };
+            });
+    }
+
+    void finishBin() noexcept;
+
+    //==============================================================================
+    int binLength = 4410, binFill = 0;
+    Sums binSums;
+
+    // Ring of finished bins, newest at binIndex.
+    std::array<Sums, correlationBins> bins{};
+    int binIndex = 0;
+
+    int decimation = 4, nextPoint = 0;
+
+    juce::AbstractFifo fifo{ fifoSize };
+    std::array<Point, fifoSize> points{};
+
+    // Published
+    std::atomic<float> correlation{ 0.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StereoScope)
+};
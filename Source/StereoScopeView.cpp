@@ -0,0 +1,136 @@
+#include "StereoScopeView.h"
+
+StereoScopeView::StereoScopeView(SimpleEQAudioProcessor& processorToWatch)
+    : processor(processorToWatch)
+{
+}
+
+void StereoScopeView::start()
+{
+    if (std::exchange(started, true))
+        return;
+
+    processor.addMeterViewer();
+    startTimerHz(refreshRateHz);
+}
+
+StereoScopeView::~StereoScopeView()
+{
+    if (started)
+        processor.removeMeterViewer();
+}
+
+juce::Rectangle<int> StereoScopeView::getScopeArea() const
+{
+    auto area = getLocalBounds().reduced(4);
+    area.removeFromBottom(22);
+
+    auto side = juce::jmin(area.getWidth(), area.getHeight());
+    return area.withSizeKeepingCentre(side, side);
+}
+
+void StereoScopeView::resized()
+{
+    auto area = getScopeArea();
+    auto scale = juce::Component::getApproximateScaleFactorForComponent(this);
+    auto size = juce::jmax(1, juce::roundToInt((float)area.getWidth() * scale));
+
+    // Software backed, so plotting and decay touch the pixels directly.
+    phosphor = juce::Image(juce::Image::ARGB, size, size, true, juce::SoftwareImageType());
+}
+
+void StereoScopeView::plotPoints(const StereoScope::Point* newPoints, int numPoints)
+{
+    juce::Image::BitmapData data(phosphor, juce::Image::BitmapData::readWrite);
+
+    auto centre = (float)data.width * 0.5f;
+
+    auto brighten = [](juce::uint8 value, int amount)
+    {
+        return (juce::uint8)juce::jmin(255, value + amount);
+    };
+
+    for (int i = 0; i < numPoints; ++i)
+    {
+        // Left-only signals lean up to the left, right-only up to the right.
+        auto x = juce::roundToInt(centre - newPoints[i].side * centre);
+        auto y = juce::roundToInt(centre - newPoints[i].mid * centre);
+
+        if (! juce::isPositiveAndBelow(x, data.width) || ! juce::isPositiveAndBelow(y, data.height))
+            continue;
+
+        // Premultiplied: every channel gains no more than alpha does.
+        auto* pixel = reinterpret_cast<juce::PixelARGB*>(data.getPixelPointer(x, y));
+        pixel->setARGB(brighten(pixel->getAlpha(), 72), brighten(pixel->getRed(), 24),
+            brighten(pixel->getGreen(), 72), brighten(pixel->getBlue(), 40));
+    }
+}
+
+void StereoScopeView::timerCallback()
+{
+    if (! phosphor.isValid())
+        return;
+
+    static const auto decay = std::pow(0.5f, 1.0f / (halfLifeSeconds * (float)refreshRateHz));
+    phosphor.multiplyAllAlphas(decay);
+
+    auto& scope = processor.getStereoScope();
+
+    // Whatever arrived since the last frame, at most a full FIFO's worth.
+    for (int drained = 0; drained < StereoScope::fifoSize;)
+    {
+        auto numPoints = scope.readPoints(pointBuffer.data(), (int)pointBuffer.size());
+        if (numPoints == 0)
+            break;
+
+        plotPoints(pointBuffer.data(), numPoints);
+        drained += numPoints;
+    }
+
+    correlation = scope.getCorrelation();
+    repaint();
+}
+
+void StereoScopeView::paint(juce::Graphics& g)
+{
+    g.setColour(juce::Colours::black.withAlpha(0.6f));
+    g.fillRoundedRectangle(getLocalBounds().toFloat(), 4.0f);
+
+    g.setFont(juce::FontOptions(11.0f));
+
+    auto scope = getScopeArea().toFloat();
+    auto centre = scope.getCentre();
+
+    g.setColour(juce::Colours::white.withAlpha(0.15f));
+    g.drawLine(centre.x, scope.getY(), centre.x, scope.getBottom());
+    g.drawLine(scope.getX(), scope.getY(), scope.getRight(), scope.getBottom());
+    g.drawLine(scope.getRight(), scope.getY(), scope.getX(), scope.getBottom());
+
+    g.setColour(juce::Colours::white.withAlpha(0.5f));
+    g.drawText("L", scope.withSize(12.0f, 12.0f), juce::Justification::topLeft);
+    g.drawText("R", scope.withLeft(scope.getRight() - 12.0f).withHeight(12.0f), juce::Justification::topRight);
+
+    if (phosphor.isValid())
+        g.drawImage(phosphor, scope);
+
+    // Correlation, -1 to +1
+    auto bar = getLocalBounds().toFloat().reduced(4.0f).removeFromBottom(18.0f);
+    auto track = bar.removeFromTop(6.0f).reduced(2.0f, 0.0f);
+
+    g.setColour(juce::Colours::white.withAlpha(0.1f));
+    g.fillRect(track);
+
+    auto zero = track.getCentreX();
+    auto value = track.getX() + (correlation + 1.0f) * 0.5f * track.getWidth();
+
+    g.setColour(correlation < 0.0f ? juce::Colours::orangered : juce::Colours::lightgreen.withAlpha(0.8f));
+    g.fillRect(juce::Rectangle<float>::leftTopRightBottom(juce::jmin(zero, value), track.getY(), juce::jmax(zero, value), track.getBottom()));
+
+    g.setColour(juce::Colours::white.withAlpha(0.4f));
+    g.drawVerticalLine(juce::roundToInt(zero), track.getY() - 1.0f, track.getBottom() + 1.0f);
+
+    g.setColour(juce::Colours::white);
+    g.drawText("-1", bar, juce::Justification::centredLeft);
+    g.drawText(juce::String(correlation, 2), bar, juce::Justification::centred);
+    g.drawText("+1", bar, juce::Justification::centredRight);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/**
+    Goniometer (mid up, side across) over a correlation bar for the output.
+
+    Points are plotted straight into a persistent phosphor image that loses a
+    fixed share of its brightness every frame, so a frame costs one pass over
+    the image plus the new points, however long the trace lingers. Registers
+    itself as a meter viewer from start() until it is destroyed.
+*/
+class StereoScopeView : public juce::Component,
+                        private juce::Timer
+{
+public:
+    explicit StereoScopeView(SimpleEQAudioProcessor& processorToWatch);
+    ~StereoScopeView() override;
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+    void start();
+
+private:
+    void timerCallback() override;
+    void plotPoints(const StereoScope::Point* newPoints, int numPoints);
+
+    juce::Rectangle<int> getScopeArea() const;
+
+    SimpleEQAudioProcessor& processor;
+    bool started = false;
+
+    // Premultiplied, drawn at the display's scale so points stay one pixel.
+    juce::Image phosphor;
+    float correlation = 0;
+
+    std::array<StereoScope::Point, 1024> pointBuffer;
+
+    static constexpr int refreshRateHz = 30;
+    static constexpr float halfLifeSeconds = 0.1f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StereoScopeView)
+};
@@ -0,0 +1,47 @@
+#include "AllocationCounter.h"
+
+#include <new>
+
+// Counts heap allocations made by each thread. Other threads (the analyzer
+// hub, the linear-phase designer) are not the audio thread and are
+// deliberately kept out of the benchmarking thread's count.
+namespace
+{
+	thread_local juce::int64 allocationCount = 0;
+}
+
+juce::int64 getThreadAllocationCount() noexcept
+{
+	return allocationCount;
+}
+
+void* operator new(std::size_t size)
+{
+	++allocationCount;
+
+	if (auto* p = std::malloc(size == 0 ? 1 : size))
+		return p;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	++allocationCount;
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+/** Number of heap allocations made so far by the calling thread. The tool
+	replaces the global operator new to count them. */
+juce::int64 getThreadAllocationCount() noexcept;
@@ -0,0 +1,382 @@
+/*
+  ==============================================================================
+
+	darQBench: DSP benchmarks for the darQ processor.
+
+	Drives SimpleEQAudioProcessor::processBlock across a sweep of block sizes,
+	sample rates, channel counts, cut slopes and static/automated parameters,
+	plus the analyzer's drawNextFrameOfSpectrum and the level meter, and
+	reports ns/sample, cycles/sample and heap allocations per block as JSON.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+#include "AllocationCounter.h"
+#include "Verify.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace
+{
+	//==============================================================================
+	inline juce::int64 readCycleCounter() noexcept
+	{
+	#if JUCE_INTEL
+		return (juce::int64)__rdtsc();
+	#else
+		return 0;
+	#endif
+	}
+
+	constexpr bool hasCycleCounter =
+	#if JUCE_INTEL
+		true;
+	#else
+		false;
+	#endif
+
+	struct Measurement
+	{
+		juce::int64 samples = 0, blocks = 0, allocations = 0, cycles = 0;
+		double seconds = 0.0;
+
+		double nsPerSample() const { return seconds * 1.0e9 / (double)juce::jmax((juce::int64)1, samples); }
+		double cyclesPerSample() const { return (double)cycles / (double)juce::jmax((juce::int64)1, samples); }
+		double allocationsPerBlock() const { return (double)allocations / (double)juce::jmax((juce::int64)1, blocks); }
+	};
+
+	/** Times hostSide and call together, but only counts call's allocations:
+		whatever the host does between blocks (automation, say) isn't ours. */
+	template <typename HostSide, typename Function>
+	Measurement measure(juce::int64 samplesPerCall, juce::int64 totalSamples, HostSide&& hostSide, Function&& call)
+	{
+		Measurement m;
+
+		auto ticksBefore = juce::Time::getHighResolutionTicks();
+		auto cyclesBefore = readCycleCounter();
+
+		while (m.samples < totalSamples)
+		{
+			hostSide(m.blocks);
+
+			auto allocationsBefore = getThreadAllocationCount();
+			call(m.blocks);
+			m.allocations += getThreadAllocationCount() - allocationsBefore;
+
+			m.samples += samplesPerCall;
+			++m.blocks;
+		}
+
+		m.cycles = readCycleCounter() - cyclesBefore;
+		m.seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - ticksBefore);
+		return m;
+	}
+
+	template <typename Function>
+	Measurement measure(juce::int64 samplesPerCall, juce::int64 totalSamples, Function&& call)
+	{
+		return measure(samplesPerCall, totalSamples, [](juce::int64) {}, std::forward<Function>(call));
+	}
+
+	//==============================================================================
+	struct BenchOptions
+	{
+		juce::Array<int> blockSizes{ 1, 16, 64, 256, 1024, 4096 };
+		juce::Array<double> sampleRates{ 44100.0, 48000.0, 96000.0, 192000.0, 384000.0 };
+		juce::Array<int> channelCounts{ 1, 2 };
+		juce::Array<int> slopes{ 0, 1, 2, 3 };
+		juce::StringPairArray parameters;
+		double secondsPerCase = 0.25;
+		bool doublePrecision = false;
+	};
+
+	void setParameter(SimpleEQAudioProcessor& processor, const juce::String& id, float value)
+	{
+		if (auto* parameter = processor.apvts.getParameter(id))
+			parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+	}
+
+	juce::var makeCase(const juce::String& name, const Measurement& m)
+	{
+		auto* result = new juce::DynamicObject();
+		result->setProperty("name", name);
+		result->setProperty("ns_per_sample", m.nsPerSample());
+		result->setProperty("cycles_per_sample", hasCycleCounter ? juce::var(m.cyclesPerSample()) : juce::var());
+		result->setProperty("allocations_per_block", m.allocationsPerBlock());
+		result->setProperty("blocks", m.blocks);
+		return juce::var(result);
+	}
+
+	template <typename SampleType>
+	Measurement runProcessBlock(const BenchOptions& options, double sampleRate, int blockSize,
+		int numChannels, int slope, bool automated)
+	{
+		SimpleEQAudioProcessor processor;
+
+		auto layout = processor.getBusesLayout();
+		auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+		layout.inputBuses.getReference(0) = channelSet;
+		layout.outputBuses.getReference(0) = channelSet;
+		processor.setBusesLayout(layout);
+
+		for (auto& id : options.parameters.getAllKeys())
+			setParameter(processor, id, options.parameters[id].getFloatValue());
+
+		setParameter(processor, "LowCut Slope", (float)slope);
+		setParameter(processor, "HighCut Slope", (float)slope);
+		setParameter(processor, "LowCut Freq", 40.0f);
+		setParameter(processor, "HighCut Freq", 16000.0f);
+		setParameter(processor, "Peak Gain", 6.0f);
+
+		processor.setProcessingPrecision(std::is_same_v<SampleType, double> ? juce::AudioProcessor::doublePrecision
+			: juce::AudioProcessor::singlePrecision);
+		processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+		processor.prepareToPlay(sampleRate, blockSize);
+
+		juce::AudioBuffer<SampleType> buffer(numChannels, blockSize);
+		juce::MidiBuffer midi;
+		juce::Random random(0x64617251);
+
+		auto fillNoise = [&]
+		{
+			for (int ch = 0; ch < numChannels; ++ch)
+				for (int i = 0; i < blockSize; ++i)
+					buffer.setSample(ch, i, (SampleType)(random.nextFloat() * 2.0f - 1.0f) * (SampleType)0.25);
+		};
+
+		// Warm up: settle mode switches and first-touch allocations.
+		fillNoise();
+		for (int i = 0; i < juce::jmax(8, 4096 / blockSize); ++i)
+			processor.processBlock(buffer, midi);
+
+		auto* peakFreq = processor.apvts.getParameter("Peak Freq");
+		auto* peakGain = processor.apvts.getParameter("Peak Gain");
+		auto* lowCutFreq = processor.apvts.getParameter("LowCut Freq");
+
+		auto total = (juce::int64)(sampleRate * options.secondsPerCase);
+
+		return measure(blockSize, total,
+			[&](juce::int64 blockIndex)
+			{
+				if (automated)
+				{
+					// One slow sweep per second of audio, written the way a host would.
+					auto phase = (float)std::fmod((double)(blockIndex * blockSize) / sampleRate, 1.0);
+					peakFreq->setValueNotifyingHost(phase);
+					peakGain->setValueNotifyingHost(1.0f - phase);
+					lowCutFreq->setValueNotifyingHost(phase * 0.25f);
+				}
+			},
+			[&](juce::int64)
+			{
+				processor.processBlock(buffer, midi);
+			});
+	}
+
+	Measurement runSpectrumFrame(double secondsPerCase)
+	{
+		AnalyzerTap tap(0, "bench");
+
+		std::vector<float> input(AnalyzerTap::fftSize + 1);
+		juce::Random random(0x64617251);
+		for (auto& s : input)
+			s = random.nextFloat() * 2.0f - 1.0f;
+
+		auto frames = juce::jmax((juce::int64)64, (juce::int64)(secondsPerCase * 4000.0));
+
+		return measure(AnalyzerTap::fftSize, frames * AnalyzerTap::fftSize, [&](juce::int64)
+			{
+				tap.pushSamples(input.data(), (int)input.size());
+				tap.drawNextFrameOfSpectrum();
+			});
+	}
+
+	Measurement runLevelMeter(double secondsPerCase)
+	{
+		constexpr int blockSize = 512;
+		constexpr double sampleRate = 48000.0;
+
+		LevelMeter meter;
+		meter.prepare(sampleRate);
+
+		juce::AudioBuffer<float> buffer(2, blockSize);
+		juce::Random random(0x64617251);
+		for (int ch = 0; ch < 2; ++ch)
+			for (int i = 0; i < blockSize; ++i)
+				buffer.setSample(ch, i, random.nextFloat() * 2.0f - 1.0f);
+
+		return measure(blockSize, (juce::int64)(sampleRate * secondsPerCase), [&](juce::int64)
+			{
+				meter.process(buffer.getArrayOfReadPointers(), 2, blockSize);
+			});
+	}
+
+	//==============================================================================
+	juce::var runAll(const BenchOptions& options)
+	{
+		juce::Array<juce::var> cases;
+
+		auto report = [&cases](const juce::String& name, const Measurement& m)
+		{
+			std::cerr << name << ": " << juce::String(m.nsPerSample(), 2) << " ns/sample, "
+				<< juce::String(m.allocationsPerBlock(), 3) << " allocs/block\n";
+			cases.add(makeCase(name, m));
+		};
+
+		report("spectrum/drawNextFrameOfSpectrum", runSpectrumFrame(options.secondsPerCase));
+		report("meter/process/ch2/sr48000/bs512", runLevelMeter(options.secondsPerCase));
+
+		for (auto automated : { false, true })
+			for (auto slope : options.slopes)
+				for (auto numChannels : options.channelCounts)
+					for (auto sampleRate : options.sampleRates)
+						for (auto blockSize : options.blockSizes)
+						{
+							auto name = juce::String("processBlock/") + (automated ? "automated" : "static")
+								+ "/slope" + juce::String(12 * (slope + 1))
+								+ "/ch" + juce::String(numChannels)
+								+ "/sr" + juce::String((int)sampleRate)
+								+ "/bs" + juce::String(blockSize);
+
+							report(name, options.doublePrecision
+								? runProcessBlock<double>(options, sampleRate, blockSize, numChannels, slope, automated)
+								: runProcessBlock<float>(options, sampleRate, blockSize, numChannels, slope, automated));
+						}
+
+		auto* root = new juce::DynamicObject();
+		root->setProperty("tool", "darQBench");
+		root->setProperty("version", DARQ_VERSION);
+		root->setProperty("cpu", juce::SystemStats::getCpuModel());
+		root->setProperty("cpu_mhz", juce::SystemStats::getCpuSpeedInMegahertz());
+		root->setProperty("os", juce::SystemStats::getOperatingSystemName());
+		root->setProperty("precision", options.doublePrecision ? "double" : "float");
+		root->setProperty("seconds_per_case", options.secondsPerCase);
+		root->setProperty("cycle_counter", hasCycleCounter ? "rdtsc" : "none");
+		root->setProperty("cases", cases);
+		return juce::var(root);
+	}
+
+	// Prints the relative change of each case against a previous run.
+	void compareWithBaseline(const juce::var& current, const juce::var& baseline)
+	{
+		std::map<juce::String, double> previous;
+		if (auto* baseCases = baseline["cases"].getArray())
+			for (auto& c : *baseCases)
+				previous[c["name"].toString()] = (double)c["ns_per_sample"];
+
+		if (auto* currentCases = current["cases"].getArray())
+		{
+			for (auto& c : *currentCases)
+			{
+				auto it = previous.find(c["name"].toString());
+				if (it == previous.end() || it->second <= 0.0)
+					continue;
+
+				auto change = ((double)c["ns_per_sample"] / it->second - 1.0) * 100.0;
+				std::cout << c["name"].toString() << "  " << (change >= 0.0 ? "+" : "")
+					<< juce::String(change, 1) << "%\n";
+			}
+		}
+	}
+
+	template <typename Type>
+	juce::Array<Type> parseList(const juce::String& text)
+	{
+		juce::Array<Type> values;
+		for (auto& token : juce::StringArray::fromTokens(text, ",", {}))
+			values.add((Type)token.trim().getDoubleValue());
+		return values;
+	}
+
+	void printUsage()
+	{
+		std::cout << "Usage: darQBench [options]\n"
+			"\n"
+			"  --output <file.json>     Write results as JSON (default: stdout)\n"
+			"  --baseline <file.json>   Print per-case change against a previous run\n"
+			"  --block-sizes <list>     Comma separated (default: 1,16,64,256,1024,4096)\n"
+			"  --sample-rates <list>    Comma separated (default: 44100,48000,96000,192000,384000)\n"
+			"  --channels <list>        Comma separated (default: 1,2)\n"
+			"  --slopes <list>          Slope choice indices (default: 0,1,2,3)\n"
+			"  --seconds <s>            Audio time processed per case (default: 0.25)\n"
+			"  --double                 Use the double-precision processBlock\n"
+			"  --param \"<id>=<value>\"   Set a parameter before every case, e.g. --param \"Oversampling=2\"\n"
+			"\n"
+			"  --verify                 Run the differential, analytic, fuzz and latency checks instead\n"
+			"  --seed <n>               Random seed for --verify (default: time)\n"
+			"  --trials <n>             Trials per check for --verify (default: 50)\n";
+	}
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+	juce::ScopedJuceInitialiser_GUI juceInitialiser;
+	juce::ArgumentList args(argc, argv);
+
+	if (args.containsOption("--help|-h"))
+	{
+		printUsage();
+		return 0;
+	}
+
+	if (args.containsOption("--verify"))
+		return runVerification(args);
+
+	BenchOptions options;
+
+	if (args.containsOption("--block-sizes"))
+		options.blockSizes = parseList<int>(args.getValueForOption("--block-sizes"));
+
+	if (args.containsOption("--sample-rates"))
+		options.sampleRates = parseList<double>(args.getValueForOption("--sample-rates"));
+
+	if (args.containsOption("--channels"))
+		options.channelCounts = parseList<int>(args.getValueForOption("--channels"));
+
+	if (args.containsOption("--slopes"))
+		options.slopes = parseList<int>(args.getValueForOption("--slopes"));
+
+	if (args.containsOption("--seconds"))
+		options.secondsPerCase = juce::jmax(0.001, args.getValueForOption("--seconds").getDoubleValue());
+
+	options.doublePrecision = args.containsOption("--double");
+
+	while (args.containsOption("--param"))
+	{
+		auto assignment = args.removeValueForOption("--param");
+		options.parameters.set(assignment.upToLastOccurrenceOf("=", false, false).trim(),
+			assignment.fromLastOccurrenceOf("=", false, false).trim());
+	}
+
+	auto results = runAll(options);
+	auto json = juce::JSON::toString(results);
+
+	if (args.containsOption("--output"))
+	{
+		auto file = args.getFileForOption("--output");
+		if (! file.replaceWithText(json))
+		{
+			std::cerr << "Can't write " << file.getFullPathName() << "\n";
+			return 1;
+		}
+	}
+	else
+	{
+		std::cout << json << "\n";
+	}
+
+	if (args.containsOption("--baseline"))
+		compareWithBaseline(results, juce::JSON::parse(args.getExistingFileForOption("--baseline")));
+
+	return 0;
+}
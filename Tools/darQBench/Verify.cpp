@@ -0,0 +1,724 @@
+/*
+  ==============================================================================
+
+	Differential and stress checks for the darQ DSP paths.
+
+	1. Differential: SimdFilterChain (float and double) against the
+	   juce::dsp::IIR chain on random settings and signals, as a null test.
+	2. Analytic: the double engine's measured magnitude response, and the
+	   response of the interpolated CoefficientTables, against the
+	   closed-form Butterworth (bilinear, prewarped) and RBJ peak responses.
+	   The matched peak design against its analog prototype: exact at DC
+	   and the centre, and never further off at Nyquist than the bilinear.
+	   The crossover's bands against the input: they must sum to an allpass.
+	3. Fuzz: processBlock with random block sizes, channel layouts (band
+	   outputs included) and per-block automation of every parameter,
+	   asserting no allocations on the calling thread and no NaN, Inf,
+	   denormal or runaway output on any bus.
+	4. Latency: an offline render on a worker thread, as darQRender and
+	   darQGraph do it, with oversampling or linear phase on must see the
+	   processor report its latency, without the message loop running.
+
+  ==============================================================================
+*/
+
+#include "Verify.h"
+#include "AllocationCounter.h"
+#include "../../Source/PluginProcessor.h"
+
+#include <complex>
+#include <thread>
+
+namespace
+{
+	constexpr double pi = juce::MathConstants<double>::pi;
+
+	struct Result
+	{
+		juce::String name;
+		int checks = 0, failures = 0;
+		double worst = -std::numeric_limits<double>::infinity();
+		juce::String worstCase;
+
+		void check(bool ok, double metric, const juce::String& description)
+		{
+			++checks;
+
+			if (metric > worst)
+			{
+				worst = metric;
+				worstCase = description;
+			}
+
+			if (! ok)
+			{
+				if (failures < 10)
+					std::cout << "  FAIL " << name << ": " << description << "\n";
+
+				++failures;
+			}
+		}
+
+		bool report(const juce::String& unit) const
+		{
+			std::cout << (failures == 0 ? "PASS " : "FAIL ") << name << ": " << checks << " checks, "
+				<< failures << " failed, worst " << juce::String(worst, 3) << " " << unit
+				<< " (" << worstCase << ")\n";
+			return failures == 0;
+		}
+	};
+
+	double logUniform(juce::Random& random, double low, double high)
+	{
+		return low * std::pow(high / low, random.nextDouble());
+	}
+
+	ChainSettings randomSettings(juce::Random& random, double sampleRate)
+	{
+		auto nyquistLimit = juce::jmin(20000.0, 0.45 * sampleRate);
+
+		ChainSettings s;
+		s.lowCutFreq = (float)logUniform(random, 20.0, 2000.0);
+		s.highCutFreq = (float)logUniform(random, 1000.0, nyquistLimit);
+		s.peakFreq = (float)logUniform(random, 20.0, nyquistLimit);
+		s.peakGainInDecibels = (float)(random.nextDouble() * 48.0 - 24.0);
+		s.peakQuality = (float)logUniform(random, 0.1, 10.0);
+		s.lowCutSlope = random.nextInt(4);
+		s.highCutSlope = random.nextInt(4);
+		return s;
+	}
+
+	juce::String describe(const ChainSettings& s, double sampleRate)
+	{
+		return "sr " + juce::String(sampleRate) + ", lc " + juce::String(s.lowCutFreq, 1) + " Hz/" + juce::String(12 * (s.lowCutSlope + 1))
+			+ ", hc " + juce::String(s.highCutFreq, 1) + " Hz/" + juce::String(12 * (s.highCutSlope + 1))
+			+ ", peak " + juce::String(s.peakFreq, 1) + " Hz " + juce::String(s.peakGainInDecibels, 1)
+			+ " dB Q " + juce::String(s.peakQuality, 2);
+	}
+
+	double residualDecibels(const std::vector<double>& reference, const std::vector<double>& test)
+	{
+		double signal = 0.0, error = 0.0;
+
+		for (size_t i = 0; i < reference.size(); ++i)
+		{
+			signal += reference[i] * reference[i];
+			error += (reference[i] - test[i]) * (reference[i] - test[i]);
+		}
+
+		if (error == 0.0)
+			return -400.0;
+
+		return 10.0 * std::log10(error / juce::jmax(signal, 1.0e-300));
+	}
+
+	//==============================================================================
+	// The juce::dsp::IIR chain in double precision, for the double engine.
+	template <typename SampleType>
+	struct ReferenceChain
+	{
+		using IIRFilter = juce::dsp::IIR::Filter<SampleType>;
+		using IIRCoefficients = juce::dsp::IIR::Coefficients<SampleType>;
+
+		std::vector<IIRFilter> filters;
+
+		ReferenceChain(const ChainSettings& s, double sampleRate)
+		{
+			using Design = juce::dsp::FilterDesign<SampleType>;
+
+			for (auto* c : Design::designIIRHighpassHighOrderButterworthMethod(s.lowCutFreq, sampleRate, 2 * (s.lowCutSlope + 1)))
+				filters.emplace_back(c);
+
+			filters.emplace_back(IIRCoefficients::makePeakFilter(sampleRate, (SampleType)s.peakFreq, (SampleType)s.peakQuality,
+				(SampleType)juce::Decibels::decibelsToGain((double)s.peakGainInDecibels)));
+
+			for (auto* c : Design::designIIRLowpassHighOrderButterworthMethod(s.highCutFreq, sampleRate, 2 * (s.highCutSlope + 1)))
+				filters.emplace_back(c);
+
+			for (auto& f : filters)
+				f.reset();
+		}
+
+		SampleType process(SampleType x) noexcept
+		{
+			for (auto& f : filters)
+				x = f.processSample(x);
+
+			return x;
+		}
+	};
+
+	// The plugin's original float chain.
+	struct MonoChainReference
+	{
+		MonoChain chain;
+
+		MonoChainReference(const ChainSettings& s, double sampleRate)
+		{
+			chain.prepare({ sampleRate, 1, 1 });
+			updateMonoChain(chain, s, sampleRate);
+		}
+
+		float process(float x) noexcept
+		{
+			float* channels[] = { &x };
+			juce::dsp::AudioBlock<float> block(channels, 1, 1);
+			chain.process(juce::dsp::ProcessContextReplacing<float>(block));
+			return x;
+		}
+	};
+
+	//==============================================================================
+	template <typename SampleType, typename ReferenceType>
+	double runDifferential(const ChainSettings& mid, const ChainSettings& side, double sampleRate, bool midSide,
+		const std::vector<double>& left, const std::vector<double>& right)
+	{
+		const auto numSamples = (int)left.size();
+
+		// Reference: encode, one chain per channel, decode.
+		ReferenceType refA(mid, sampleRate), refB(midSide ? side : mid, sampleRate);
+		std::vector<double> expected(2 * left.size());
+
+		for (int i = 0; i < numSamples; ++i)
+		{
+			auto a = left[(size_t)i], b = right[(size_t)i];
+
+			if (midSide)
+			{
+				auto m = 0.5 * (a + b), s = 0.5 * (a - b);
+				a = m;
+				b = s;
+			}
+
+			using RefSample = decltype(refA.process(0));
+			auto outA = (double)refA.process((RefSample)a);
+			auto outB = (double)refB.process((RefSample)b);
+
+			if (midSide)
+			{
+				auto l = outA + outB, r = outA - outB;
+				outA = l;
+				outB = r;
+			}
+
+			expected[(size_t)(2 * i)] = outA;
+			expected[(size_t)(2 * i + 1)] = outB;
+		}
+
+		SimdFilterChain<SampleType> engine;
+		engine.prepare(512);
+		engine.setCoefficients(makeChainCoefficients(mid, sampleRate));
+		engine.setCoefficients(1, makeChainCoefficients(midSide ? side : mid, sampleRate));
+
+		juce::AudioBuffer<SampleType> buffer(2, numSamples);
+		for (int i = 0; i < numSamples; ++i)
+		{
+			buffer.setSample(0, i, (SampleType)left[(size_t)i]);
+			buffer.setSample(1, i, (SampleType)right[(size_t)i]);
+		}
+
+		juce::dsp::AudioBlock<SampleType> block(buffer);
+		engine.process(block, midSide);
+
+		std::vector<double> actual(expected.size());
+		for (int i = 0; i < numSamples; ++i)
+		{
+			actual[(size_t)(2 * i)] = (double)buffer.getSample(0, i);
+			actual[(size_t)(2 * i + 1)] = (double)buffer.getSample(1, i);
+		}
+
+		return residualDecibels(expected, actual);
+	}
+
+	bool verifyDifferential(juce::Random& random, int trials)
+	{
+		// Bounds: the double engine runs the same TDF-II recursion as the
+		// double reference, so only summation order differs. The float engine
+		// is held to the plugin's original float chain, whose own coefficient
+		// rounding dominates the residual.
+		constexpr double doubleBoundDb = -140.0;
+		constexpr double floatBoundDb = -50.0;
+
+		Result doubleResult{ "differential/double" }, floatResult{ "differential/float" };
+		const double sampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 };
+
+		for (int t = 0; t < trials; ++t)
+		{
+			auto sampleRate = sampleRates[random.nextInt(juce::numElementsInArray(sampleRates))];
+			auto mid = randomSettings(random, sampleRate);
+			auto side = randomSettings(random, sampleRate);
+			auto midSide = random.nextBool();
+
+			// Noise plus a full-range log sweep, so every stage gets exercised.
+			std::vector<double> left(16384), right(16384);
+			double phase = 0.0;
+			for (size_t i = 0; i < left.size(); ++i)
+			{
+				auto frequency = 20.0 * std::pow(0.45 * sampleRate / 20.0, (double)i / (double)left.size());
+				phase += 2.0 * pi * frequency / sampleRate;
+				left[i] = 0.25 * std::sin(phase) + 0.25 * (random.nextDouble() * 2.0 - 1.0);
+				right[i] = 0.5 * (random.nextDouble() * 2.0 - 1.0);
+			}
+
+			auto description = describe(mid, sampleRate) + (midSide ? " (M/S)" : "");
+
+			auto doubleError = runDifferential<double, ReferenceChain<double>>(mid, side, sampleRate, midSide, left, right);
+			doubleResult.check(doubleError <= doubleBoundDb, doubleError, description);
+
+			auto floatError = runDifferential<float, MonoChainReference>(mid, side, sampleRate, midSide, left, right);
+			floatResult.check(floatError <= floatBoundDb, floatError, description);
+		}
+
+		auto ok = doubleResult.report("dB residual");
+		return floatResult.report("dB residual") && ok;
+	}
+
+	//==============================================================================
+	// |H| of the chain from the textbook formulas, independent of any design
+	// code in the plugin or in JUCE.
+	double analyticMagnitude(const ChainSettings& s, double sampleRate, double frequency)
+	{
+		auto warped = std::tan(pi * frequency / sampleRate);
+
+		auto lowCutOrder = 2.0 * (s.lowCutSlope + 1);
+		auto highCutOrder = 2.0 * (s.highCutSlope + 1);
+		auto lowCutRatio = std::tan(pi * s.lowCutFreq / sampleRate) / warped;
+		auto highCutRatio = warped / std::tan(pi * s.highCutFreq / sampleRate);
+
+		auto highPass = 1.0 / std::sqrt(1.0 + std::pow(lowCutRatio, 2.0 * lowCutOrder));
+		auto lowPass = 1.0 / std::sqrt(1.0 + std::pow(highCutRatio, 2.0 * highCutOrder));
+
+		// RBJ cookbook peaking EQ.
+		auto A = std::pow(10.0, s.peakGainInDecibels / 40.0);
+		auto w0 = 2.0 * pi * s.peakFreq / sampleRate;
+		auto alpha = std::sin(w0) / (2.0 * s.peakQuality);
+
+		auto z = std::polar(1.0, -2.0 * pi * frequency / sampleRate);
+		auto numerator = (1.0 + alpha * A) - 2.0 * std::cos(w0) * z + (1.0 - alpha * A) * z * z;
+		auto denominator = (1.0 + alpha / A) - 2.0 * std::cos(w0) * z + (1.0 - alpha / A) * z * z;
+
+		return highPass * lowPass * std::abs(numerator / denominator);
+	}
+
+	double chainMagnitude(const ChainCoefficients& c, double sampleRate, double frequency)
+	{
+		auto z = std::polar(1.0, -2.0 * pi * frequency / sampleRate);
+
+		auto section = [z](const BiquadCoefficients& b)
+		{
+			return std::abs((b.b0 + b.b1 * z + b.b2 * z * z) / (1.0 + b.a1 * z + b.a2 * z * z));
+		};
+
+		auto magnitude = section(c.peak);
+
+		for (int i = 0; i < c.numLowCut; ++i)
+			magnitude *= section(c.lowCut[i]);
+
+		for (int i = 0; i < c.numHighCut; ++i)
+			magnitude *= section(c.highCut[i]);
+
+		return magnitude;
+	}
+
+	bool verifyAnalytic(juce::Random& random, int trials)
+	{
+		constexpr int fftOrder = 17;
+		constexpr int fftSize = 1 << fftOrder;
+		constexpr double toleranceDb = 0.02;
+		constexpr double floorDb = -60.0;
+
+		Result engineResult{ "analytic/engine" }, curveResult{ "analytic/display-curve" }, tableResult{ "analytic/tables" };
+		juce::SharedResourcePointer<CoefficientTables> tables;
+		const double sampleRates[] = { 44100.0, 48000.0, 96000.0 };
+
+		juce::dsp::FFT fft(fftOrder);
+		std::vector<std::complex<float>> in(fftSize), out(fftSize);
+
+		for (int t = 0; t < trials; ++t)
+		{
+			auto sampleRate = sampleRates[random.nextInt(juce::numElementsInArray(sampleRates))];
+			auto settings = randomSettings(random, sampleRate);
+
+			// Impulse response of the double engine.
+			SimdFilterChain<double> engine;
+			engine.prepare(4096);
+			engine.setCoefficients(makeChainCoefficients(settings, sampleRate));
+
+			juce::AudioBuffer<double> impulse(1, fftSize);
+			impulse.clear();
+			impulse.setSample(0, 0, 1.0);
+
+			juce::dsp::AudioBlock<double> block(impulse);
+			engine.process(block);
+
+			// juce::dsp::FFT is single precision; the IR is well inside its range.
+			for (int i = 0; i < fftSize; ++i)
+				in[(size_t)i] = { (float)impulse.getSample(0, i), 0.0f };
+
+			fft.perform(in.data(), out.data(), false);
+
+			std::vector<double> frequencies, curve;
+			for (int bin = 1; bin < fftSize / 2; bin += 37)
+				frequencies.push_back(bin * sampleRate / fftSize);
+
+			curve.resize(frequencies.size());
+			getChainMagnitudes(settings, sampleRate, frequencies.data(), curve.data(), frequencies.size());
+
+			auto description = describe(settings, sampleRate);
+			auto tableCoefficients = tables->makeChainCoefficients(settings, sampleRate);
+
+			for (size_t k = 0; k < frequencies.size(); ++k)
+			{
+				auto bin = (size_t)juce::roundToInt(frequencies[k] * fftSize / sampleRate);
+				auto expectedDb = juce::Decibels::gainToDecibels(analyticMagnitude(settings, sampleRate, frequencies[k]), -400.0);
+
+				if (expectedDb < floorDb)
+					continue;
+
+				auto measuredDb = juce::Decibels::gainToDecibels((double)std::abs(out[bin]), -400.0);
+				auto engineError = std::abs(measuredDb - expectedDb);
+				engineResult.check(engineError <= toleranceDb, engineError,
+					description + " @ " + juce::String(frequencies[k], 1) + " Hz");
+
+				// The response curve uses float coefficients, so it gets more room.
+				auto curveError = std::abs(juce::Decibels::gainToDecibels(curve[k], -400.0) - expectedDb);
+				curveResult.check(curveError <= 10.0 * toleranceDb, curveError,
+					description + " @ " + juce::String(frequencies[k], 1) + " Hz");
+
+				// Interpolated table coefficients, evaluated directly.
+				auto tableError = std::abs(juce::Decibels::gainToDecibels(chainMagnitude(tableCoefficients, sampleRate, frequencies[k]), -400.0)
+					- expectedDb);
+				tableResult.check(tableError <= toleranceDb, tableError,
+					description + " @ " + juce::String(frequencies[k], 1) + " Hz");
+			}
+		}
+
+		auto ok = engineResult.report("dB");
+		ok = tableResult.report("dB") && ok;
+		return curveResult.report("dB") && ok;
+	}
+
+	bool verifyMatchedPeak(juce::Random& random, int trials)
+	{
+		constexpr double toleranceDb = 0.01;
+
+		Result matchResult{ "analytic/matched-peak" }, nyquistResult{ "analytic/matched-peak-nyquist" };
+		juce::SharedResourcePointer<CoefficientTables> tables;
+		const double sampleRates[] = { 44100.0, 48000.0, 96000.0, 192000.0 };
+
+		auto toDb = [](const BiquadCoefficients& b, double normalisedFrequency)
+		{
+			auto z = std::polar(1.0, -2.0 * pi * normalisedFrequency);
+			return juce::Decibels::gainToDecibels(std::abs((b.b0 + b.b1 * z + b.b2 * z * z) / (1.0 + b.a1 * z + b.a2 * z * z)), -400.0);
+		};
+
+		for (int t = 0; t < trials * 20; ++t)
+		{
+			auto sampleRate = sampleRates[random.nextInt(juce::numElementsInArray(sampleRates))];
+			auto frequency = logUniform(random, 20.0, juce::jmin(20000.0, 0.45 * sampleRate));
+			auto quality = logUniform(random, 0.1, 10.0);
+			auto gain = random.nextDouble() * 48.0 - 24.0;
+
+			auto matched = tables->makePeak(frequency, quality, gain, sampleRate, PeakDesign_Matched);
+			auto description = juce::String(frequency, 1) + " Hz " + juce::String(gain, 1) + " dB Q " + juce::String(quality, 2)
+				+ ", sr " + juce::String(sampleRate);
+
+			auto centreError = std::abs(toDb(matched, frequency / sampleRate) - gain);
+			auto dcError = std::abs(toDb(matched, 1.0e-7));
+			matchResult.check(centreError <= toleranceDb && dcError <= toleranceDb, juce::jmax(centreError, dcError), description);
+
+			// s^2 + s A / Q + 1 over s^2 + s / (A Q) + 1, just below Nyquist.
+			auto A = std::pow(10.0, gain / 40.0);
+			auto s = std::complex<double>(0.0, 0.4995 * sampleRate / frequency);
+			auto analogDb = juce::Decibels::gainToDecibels(std::abs((s * s + s * A / quality + 1.0) / (s * s + s / (A * quality) + 1.0)), -400.0);
+
+			auto bilinear = tables->makePeak(frequency, quality, gain, sampleRate, PeakDesign_Bilinear);
+			auto matchedError = std::abs(toDb(matched, 0.4995) - analogDb);
+			auto bilinearError = std::abs(toDb(bilinear, 0.4995) - analogDb);
+			nyquistResult.check(matchedError <= bilinearError + toleranceDb, matchedError - bilinearError, description);
+		}
+
+		auto ok = matchResult.report("dB");
+		return nyquistResult.report("dB over bilinear") && ok;
+	}
+
+	bool verifyCrossover(juce::Random& random, int trials)
+	{
+		constexpr int fftOrder = 16;
+		constexpr int fftSize = 1 << fftOrder;
+		constexpr double toleranceDb = 0.01;
+
+		Result sumResult{ "analytic/crossover-sum" };
+		juce::SharedResourcePointer<CoefficientTables> tables;
+		const double sampleRates[] = { 44100.0, 48000.0, 96000.0 };
+
+		juce::dsp::FFT fft(fftOrder);
+		std::vector<std::complex<float>> in(fftSize), out(fftSize);
+
+		for (int t = 0; t < trials; ++t)
+		{
+			auto sampleRate = sampleRates[random.nextInt(juce::numElementsInArray(sampleRates))];
+			auto numBands = 2 + random.nextInt(SimdCrossover<double>::maxBands - 1);
+
+			float frequencies[SimdCrossover<double>::maxSplits];
+			for (int split = 0; split < numBands - 1; ++split)
+				frequencies[split] = (float)logUniform(random, 30.0, juce::jmin(18000.0, 0.4 * sampleRate));
+
+			std::sort(frequencies, frequencies + numBands - 1);
+
+			SimdCrossover<double> crossover;
+			crossover.setCrossovers(frequencies, numBands, *tables, sampleRate);
+
+			std::vector<double> impulse(fftSize, 0.0);
+			impulse[0] = 1.0;
+
+			juce::AudioBuffer<double> bands(numBands, fftSize);
+			double* bandChannels[SimdCrossover<double>::maxBands] = {};
+			double* const* bandPointers[SimdCrossover<double>::maxBands] = {};
+
+			for (int b = 0; b < numBands; ++b)
+			{
+				bandChannels[b] = bands.getWritePointer(b);
+				bandPointers[b] = &bandChannels[b];
+			}
+
+			const double* input = impulse.data();
+			crossover.process(&input, 1, bandPointers, fftSize);
+
+			for (int i = 0; i < fftSize; ++i)
+			{
+				auto sum = 0.0;
+				for (int b = 0; b < numBands; ++b)
+					sum += bands.getSample(b, i);
+
+				in[(size_t)i] = { (float)sum, 0.0f };
+			}
+
+			fft.perform(in.data(), out.data(), false);
+
+			juce::String description = juce::String(numBands) + " bands at";
+			for (int split = 0; split < numBands - 1; ++split)
+				description << " " << juce::String(frequencies[split], 1);
+
+			description << " Hz, sr " << juce::String(sampleRate);
+
+			for (int bin = 1; bin < fftSize / 2; bin += 37)
+			{
+				auto error = std::abs(juce::Decibels::gainToDecibels((double)std::abs(out[(size_t)bin]), -400.0));
+				sumResult.check(error <= toleranceDb, error,
+					description + " @ " + juce::String(bin * sampleRate / fftSize, 1) + " Hz");
+			}
+		}
+
+		return sumResult.report("dB");
+	}
+
+	//==============================================================================
+	bool verifyFuzz(juce::Random& random, int trials)
+	{
+		constexpr int maxBlockSize = 4096;
+		constexpr double runawayLimit = 1000.0;
+
+		Result allocations{ "fuzz/allocations" }, blowups{ "fuzz/nan-denormal-runaway" };
+
+		for (int t = 0; t < trials; ++t)
+		{
+			SimpleEQAudioProcessor processor;
+
+			auto numChannels = random.nextBool() ? 2 : 1;
+			auto layout = processor.getBusesLayout();
+			auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+			layout.inputBuses.getReference(0) = channelSet;
+			layout.outputBuses.getReference(0) = channelSet;
+
+			// Half the trials also take some band outputs, which match the main bus.
+			auto numBandBuses = random.nextBool() ? 1 + random.nextInt(SimpleEQAudioProcessor::maxCrossoverBands) : 0;
+			for (int bus = 1; bus < layout.outputBuses.size(); ++bus)
+				layout.outputBuses.getReference(bus) = bus <= numBandBuses ? channelSet : juce::AudioChannelSet::disabled();
+
+			processor.setBusesLayout(layout);
+
+			auto bufferChannels = juce::jmax(processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+
+			const double sampleRates[] = { 44100.0, 48000.0, 96000.0, 192000.0 };
+			auto sampleRate = sampleRates[random.nextInt(juce::numElementsInArray(sampleRates))];
+			auto precision = random.nextBool() ? juce::AudioProcessor::doublePrecision : juce::AudioProcessor::singlePrecision;
+
+			processor.setProcessingPrecision(precision);
+			processor.setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+			processor.prepareToPlay(sampleRate, maxBlockSize);
+
+			juce::AudioBuffer<float> floatBuffer(bufferChannels, maxBlockSize);
+			juce::AudioBuffer<double> doubleBuffer(bufferChannels, maxBlockSize);
+			juce::MidiBuffer midi;
+
+			auto parameters = processor.getParameters();
+			auto description = juce::String(numChannels) + " ch, " + juce::String(numBandBuses) + " band buses, sr " + juce::String(sampleRate)
+				+ (precision == juce::AudioProcessor::doublePrecision ? ", double" : ", float")
+				+ ", trial " + juce::String(t);
+
+			for (int b = 0; b < 200; ++b)
+			{
+				// A handful of parameters change every block, as host automation would.
+				for (int p = random.nextInt(4); --p >= 0;)
+					parameters[random.nextInt(parameters.size())]->setValueNotifyingHost(random.nextFloat());
+
+				auto blockSize = random.nextInt(4) == 0 ? random.nextInt(17) : random.nextInt(maxBlockSize + 1);
+				auto silent = random.nextInt(5) == 0;
+
+				auto fill = [&](auto& buffer)
+				{
+					buffer.clear();
+					if (! silent)
+						for (int ch = 0; ch < numChannels; ++ch)
+							for (int i = 0; i < blockSize; ++i)
+								buffer.setSample(ch, i, (std::decay_t<decltype(buffer.getSample(0, 0))>)(random.nextFloat() - 0.5f));
+				};
+
+				auto check = [&](auto& buffer)
+				{
+					auto worst = 0.0;
+					auto bad = false;
+
+					for (int ch = 0; ch < bufferChannels; ++ch)
+					{
+						for (int i = 0; i < blockSize; ++i)
+						{
+							auto x = (double)buffer.getSample(ch, i);
+							bad = bad || ! std::isfinite(x) || std::fpclassify(buffer.getSample(ch, i)) == FP_SUBNORMAL
+								|| std::abs(x) > runawayLimit;
+							worst = juce::jmax(worst, std::isfinite(x) ? std::abs(x) : runawayLimit * 10.0);
+						}
+					}
+
+					blowups.check(! bad, worst, description + ", block " + juce::String(b));
+				};
+
+				auto run = [&](auto& buffer)
+				{
+					fill(buffer);
+					using Buffer = std::decay_t<decltype(buffer)>;
+					Buffer view(buffer.getArrayOfWritePointers(), bufferChannels, blockSize);
+
+					auto before = getThreadAllocationCount();
+					processor.processBlock(view, midi);
+					auto allocated = getThreadAllocationCount() - before;
+
+					allocations.check(allocated == 0, (double)allocated,
+						description + ", block " + juce::String(b) + " (" + juce::String(blockSize) + " samples)");
+					check(buffer);
+				};
+
+				if (precision == juce::AudioProcessor::doublePrecision)
+					run(doubleBuffer);
+				else
+					run(floatBuffer);
+			}
+
+			processor.releaseResources();
+		}
+
+		auto ok = allocations.report("allocations/block");
+		return blowups.report("peak |x|") && ok;
+	}
+
+	//==============================================================================
+	bool verifyLatency(juce::Random& random, int trials)
+	{
+		constexpr int blockSize = 512;
+		constexpr double sampleRate = 48000.0;
+
+		Result latencyResult{ "latency/offline-worker" };
+
+		for (int t = 0; t < trials; ++t)
+		{
+			SimpleEQAudioProcessor processor;
+
+			auto setParameter = [&](const juce::String& id, float value)
+			{
+				auto* parameter = processor.apvts.getParameter(id);
+				parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+			};
+
+			auto linearPhase = random.nextBool();
+			auto expected = 0;
+			juce::String description;
+
+			if (linearPhase)
+			{
+				auto firLength = random.nextInt(3);   // up to 16384 taps, so designs stay quick
+				setParameter("Linear Phase", 1.0f);
+				setParameter("FIR Length", (float)firLength);
+				expected = (1 << (LinearPhaseEQ::minFirOrder + firLength)) / 2;
+				description = "linear phase, " + juce::String(1 << (LinearPhaseEQ::minFirOrder + firLength)) + " taps";
+			}
+			else
+			{
+				// The linear-phase half-band filters, whose latency can't round to nothing.
+				auto order = 1 + random.nextInt(SimpleEQAudioProcessor::maxOversamplingOrder);
+				setParameter("Oversampling", (float)order);
+				setParameter("Oversampling Filter", 1.0f);
+				description = juce::String(1 << order) + "x oversampling";
+			}
+
+			auto latency = 0;
+
+			// The message thread (this one) sleeps meanwhile, as the tools' main does.
+			std::thread worker([&]
+				{
+					processor.setNonRealtime(true);
+					processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+					processor.prepareToPlay(sampleRate, blockSize);
+
+					juce::AudioBuffer<float> buffer(2, blockSize);
+					juce::MidiBuffer midi;
+
+					for (int waited = 0; waited < 10000; waited += 10)
+					{
+						buffer.clear();
+						processor.processBlock(buffer, midi);
+
+						if (processor.isReadyToRender())
+							break;
+
+						juce::Thread::sleep(10);
+					}
+
+					latency = processor.getLatencySamples();
+					processor.releaseResources();
+				});
+
+			worker.join();
+
+			auto ok = latency > 0 && (expected == 0 || latency == expected);
+			auto error = expected > 0 ? std::abs(latency - expected) : (latency > 0 ? 0 : 1);
+			latencyResult.check(ok, (double)error,
+				description + ": reported " + juce::String(latency)
+					+ (expected > 0 ? ", expected " + juce::String(expected) : juce::String()));
+		}
+
+		return latencyResult.report("samples off");
+	}
+}
+
+//==============================================================================
+int runVerification(const juce::ArgumentList& args)
+{
+	auto seed = args.containsOption("--seed") ? args.getValueForOption("--seed").getLargeIntValue()
+		: juce::Time::currentTimeMillis();
+	auto trials = args.containsOption("--trials") ? juce::jmax(1, args.getValueForOption("--trials").getIntValue()) : 50;
+
+	std::cout << "darQBench --verify, seed " << seed << ", " << trials << " trials per check\n";
+
+	juce::Random random(seed);
+
+	auto ok = verifyDifferential(random, trials);
+	ok = verifyAnalytic(random, trials) && ok;
+	ok = verifyMatchedPeak(random, trials) && ok;
+	ok = verifyCrossover(random, trials) && ok;
+	ok = verifyFuzz(random, juce::jmax(1, trials / 5)) && ok;
+	ok = verifyLatency(random, juce::jmax(2, trials / 10)) && ok;
+
+	std::cout << (ok ? "All checks passed\n" : "Some checks FAILED\n");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+/** darQBench --verify: checks the optimised filter engines against the
+	juce::dsp::IIR reference chain and analytic responses, then fuzzes
+	processBlock. Returns the process exit code (0 when everything passed). */
+int runVerification(const juce::ArgumentList& args);
@@ -0,0 +1,413 @@
+#include "FilterGraph.h"
+#include "../../Source/PluginProcessor.h"
+
+#include <map>
+
+namespace
+{
+	bool isDarqPlugin(const juce::String& name)
+	{
+		return name == JucePlugin_Name || name == "darQ" || name == "SimpleEQ";
+	}
+
+	void readBusLayouts(const juce::XmlElement& layoutXml, juce::AudioProcessor::BusesLayout& layout)
+	{
+		for (auto isInput : { true, false })
+		{
+			auto* busesXml = layoutXml.getChildByName(isInput ? "INPUTS" : "OUTPUTS");
+			if (busesXml == nullptr)
+				continue;
+
+			auto& buses = isInput ? layout.inputBuses : layout.outputBuses;
+
+			for (auto* bus : busesXml->getChildWithTagNameIterator("BUS"))
+			{
+				auto index = bus->getIntAttribute("index", -1);
+				auto channels = bus->getStringAttribute("layout");
+
+				if (! juce::isPositiveAndBelow(index, buses.size()) || channels.isEmpty())
+					continue;
+
+				buses.getReference(index) = channels == "disabled" ? juce::AudioChannelSet::disabled()
+					: juce::AudioChannelSet::fromAbbreviatedString(channels);
+			}
+		}
+	}
+}
+
+//==============================================================================
+std::unique_ptr<FilterGraph> FilterGraph::load(const juce::File& file, bool bypassUnknown, juce::String& error)
+{
+	auto xml = juce::XmlDocument::parse(file);
+	if (xml == nullptr || ! xml->hasTagName("FILTERGRAPH"))
+	{
+		error = "not a filter graph: " + file.getFullPathName();
+		return nullptr;
+	}
+
+	std::unique_ptr<FilterGraph> graph(new FilterGraph());
+	std::map<int, Node*> nodesByUid;
+
+	for (auto* filter : xml->getChildWithTagNameIterator("FILTER"))
+	{
+		auto* plugin = filter->getChildByName("PLUGIN");
+		if (plugin == nullptr)
+			continue;
+
+		auto node = std::make_unique<Node>();
+		node->uid = filter->getIntAttribute("uid");
+		node->name = plugin->getStringAttribute("name");
+
+		auto format = plugin->getStringAttribute("format");
+
+		if (format == "Internal" && node->name == "Audio Input")
+			node->kind = NodeKind::input;
+		else if (format == "Internal" && node->name == "Audio Output")
+			node->kind = NodeKind::output;
+		else if (isDarqPlugin(node->name))
+			node->kind = NodeKind::eq;
+		else if (bypassUnknown)
+			node->kind = NodeKind::bypass;
+		else
+		{
+			error = "can't run " + format + " plugin \"" + node->name + "\" headless (try --bypass-unknown)";
+			return nullptr;
+		}
+
+		auto& io = node->kind == NodeKind::input ? graph->inputNode : graph->outputNode;
+		if (node->kind == NodeKind::input || node->kind == NodeKind::output)
+		{
+			if (io != nullptr)
+			{
+				error = "more than one " + node->name + " node";
+				return nullptr;
+			}
+
+			io = node.get();
+		}
+
+		if (auto* layout = filter->getChildByName("LAYOUT"))
+			node->layout = *layout;
+
+		if (auto* state = filter->getChildByName("STATE"))
+			node->state = decodeState(state->getAllSubText().trim());
+
+		nodesByUid[node->uid] = node.get();
+		graph->nodes.push_back(std::move(node));
+	}
+
+	if (graph->inputNode == nullptr || graph->outputNode == nullptr)
+	{
+		error = "the graph needs an Audio Input and an Audio Output node";
+		return nullptr;
+	}
+
+	for (auto* connectionXml : xml->getChildWithTagNameIterator("CONNECTION"))
+	{
+		auto source = nodesByUid.find(connectionXml->getIntAttribute("srcFilter"));
+		auto dest = nodesByUid.find(connectionXml->getIntAttribute("dstFilter"));
+
+		if (source == nodesByUid.end() || dest == nodesByUid.end())
+		{
+			error = "connection refers to a missing node";
+			return nullptr;
+		}
+
+		Connection connection;
+		connection.source = source->second;
+		connection.sourceChannel = connectionXml->getIntAttribute("srcChannel");
+		connection.destChannel = connectionXml->getIntAttribute("dstChannel");
+
+		// MIDI connections carry nothing when rendering audio files.
+		if (connection.sourceChannel == juce::AudioProcessorGraph::midiChannelIndex
+			|| connection.destChannel == juce::AudioProcessorGraph::midiChannelIndex)
+			continue;
+
+		auto* from = source->second;
+		auto* to = dest->second;
+
+		from->numChannels = juce::jmax(from->numChannels, connection.sourceChannel + 1);
+		to->numChannels = juce::jmax(to->numChannels, connection.destChannel + 1);
+
+		if (std::find(from->successors.begin(), from->successors.end(), to) == from->successors.end())
+		{
+			from->successors.push_back(to);
+			++to->numPredecessors;
+		}
+
+		to->inputs.push_back(std::move(connection));
+	}
+
+	graph->numOutputChannels = graph->outputNode->numChannels;
+
+	if (auto sortError = graph->sortNodes(); sortError.isNotEmpty())
+	{
+		error = sortError;
+		return nullptr;
+	}
+
+	return graph;
+}
+
+juce::MemoryBlock FilterGraph::decodeState(const juce::String& text)
+{
+	juce::MemoryBlock data;
+	if (! data.fromBase64Encoding(text))
+		return {};
+
+	// The host wraps VST3 state in XML, with the plugin's own state in IComponent.
+	if (auto xml = juce::AudioProcessor::getXmlFromBinary(data.getData(), (int)data.getSize()))
+	{
+		if (auto* component = xml->getChildByName("IComponent"))
+		{
+			juce::MemoryBlock componentState;
+			if (componentState.fromBase64Encoding(component->getAllSubText().trim()))
+				return componentState;
+		}
+	}
+
+	return data;
+}
+
+juce::String FilterGraph::sortNodes()
+{
+	std::map<Node*, int> waitingFor, position;
+	std::vector<Node*> ready;
+
+	for (auto& node : nodes)
+	{
+		waitingFor[node.get()] = node->numPredecessors;
+		if (node->numPredecessors == 0)
+			ready.push_back(node.get());
+	}
+
+	while (! ready.empty())
+	{
+		auto* node = ready.back();
+		ready.pop_back();
+
+		position[node] = (int)position.size();
+
+		for (auto* successor : node->successors)
+			if (--waitingFor[successor] == 0)
+				ready.push_back(successor);
+	}
+
+	if (position.size() != nodes.size())
+		return "the graph has a feedback loop";
+
+	std::sort(nodes.begin(), nodes.end(), [&position](const auto& a, const auto& b)
+		{
+			return position[a.get()] < position[b.get()];
+		});
+
+	return {};
+}
+
+//==============================================================================
+juce::String FilterGraph::prepare(double sampleRate, int blockSize, int numChannels)
+{
+	for (auto& node : nodes)
+		if (auto error = prepareNode(*node, sampleRate, blockSize, numChannels); error.isNotEmpty())
+			return node->name + " (" + juce::String(node->uid) + "): " + error;
+
+	compensateLatency();
+	return {};
+}
+
+juce::String FilterGraph::prepareNode(Node& node, double sampleRate, int blockSize, int numChannels)
+{
+	if (node.kind == NodeKind::input)
+		node.numChannels = juce::jmax(node.numChannels, numChannels);
+
+	if (node.kind != NodeKind::eq)
+	{
+		node.buffer.setSize(node.kind == NodeKind::output ? 0 : node.numChannels, blockSize);
+		return {};
+	}
+
+	auto processor = std::make_unique<SimpleEQAudioProcessor>();
+
+	auto layout = processor->getBusesLayout();
+	readBusLayouts(node.layout, layout);
+
+	if (! processor->setBusesLayout(layout))
+		return "unsupported channel layout";
+
+	if (node.state.getSize() > 0)
+		processor->setStateInformation(node.state.getData(), (int)node.state.getSize());
+
+	processor->setNonRealtime(true);
+	processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+	processor->prepareToPlay(sampleRate, blockSize);
+
+	node.numChannels = juce::jmax(node.numChannels, processor->getTotalNumInputChannels(), processor->getTotalNumOutputChannels());
+	node.buffer.setSize(node.numChannels, blockSize);
+
+	// Linear-phase kernels are designed asynchronously; prime with silence.
+	for (int waited = 0; ! processor->isReadyToRender() && waited < 30000; waited += 10)
+	{
+		node.buffer.clear();
+		processor->processBlock(node.buffer, node.midi);
+		juce::Thread::sleep(10);
+	}
+
+	node.buffer.clear();
+	node.processor = std::move(processor);
+	return {};
+}
+
+void FilterGraph::compensateLatency()
+{
+	// Nodes are in evaluation order, so every source is settled before its
+	// destinations look at it.
+	for (auto& node : nodes)
+	{
+		auto arrival = 0;
+		for (auto& connection : node->inputs)
+			arrival = juce::jmax(arrival, connection.source->pathLatency);
+
+		for (auto& connection : node->inputs)
+		{
+			connection.delay.assign((size_t)(arrival - connection.source->pathLatency), 0.0f);
+			connection.delayPos = 0;
+		}
+
+		node->pathLatency = arrival + (node->processor != nullptr ? node->processor->getLatencySamples() : 0);
+	}
+
+	latency = outputNode->pathLatency;
+}
+
+void FilterGraph::release()
+{
+	for (auto& node : nodes)
+		if (node->processor != nullptr)
+			node->processor->releaseResources();
+}
+
+//==============================================================================
+void FilterGraph::process(WorkStealingPool& pool, const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output, int numSamples)
+{
+	currentPool = &pool;
+	currentInput = &input;
+	currentOutput = &output;
+	currentNumSamples = numSamples;
+
+	for (auto& node : nodes)
+		node->pending.store(node->numPredecessors);
+
+	nodesRemaining.store((int)nodes.size());
+	blockDone.reset();
+
+	for (auto& node : nodes)
+	{
+		if (node->numPredecessors > 0)
+			continue;
+
+		auto* ready = node.get();
+		pool.submit([this, ready] { runNode(*ready); });
+	}
+
+	blockDone.wait();
+}
+
+void FilterGraph::runNode(Node& node)
+{
+	auto numSamples = currentNumSamples;
+
+	switch (node.kind)
+	{
+	case NodeKind::input:
+		for (int ch = 0; ch < node.buffer.getNumChannels(); ++ch)
+		{
+			if (ch < currentInput->getNumChannels())
+				node.buffer.copyFrom(ch, 0, *currentInput, ch, 0, numSamples);
+			else
+				node.buffer.clear(ch, 0, numSamples);
+		}
+		break;
+
+	case NodeKind::eq:
+	{
+		gatherInputs(node, numSamples);
+
+		juce::AudioBuffer<float> view(node.buffer.getArrayOfWritePointers(), node.buffer.getNumChannels(), numSamples);
+		node.midi.clear();
+		node.processor->processBlock(view, node.midi);
+		break;
+	}
+
+	case NodeKind::output:
+	case NodeKind::bypass:
+		gatherInputs(node, numSamples);
+		break;
+	}
+
+	for (auto* successor : node.successors)
+		if (successor->pending.fetch_sub(1) == 1)
+			currentPool->submit([this, successor] { runNode(*successor); });
+
+	if (nodesRemaining.fetch_sub(1) == 1)
+		blockDone.signal();
+}
+
+void FilterGraph::gatherInputs(Node& node, int numSamples)
+{
+	auto& target = node.kind == NodeKind::output ? *currentOutput : node.buffer;
+	target.clear(0, numSamples);
+
+	for (auto& connection : node.inputs)
+	{
+		auto& source = connection.source->buffer;
+
+		if (connection.sourceChannel >= source.getNumChannels() || connection.destChannel >= target.getNumChannels())
+			continue;
+
+		auto* in = source.getReadPointer(connection.sourceChannel);
+		auto* out = target.getWritePointer(connection.destChannel);
+
+		if (connection.delay.empty())
+		{
+			juce::FloatVectorOperations::add(out, in, numSamples);
+			continue;
+		}
+
+		auto* delay = connection.delay.data();
+		auto size = (int)connection.delay.size();
+		auto pos = connection.delayPos;
+
+		for (int i = 0; i < numSamples; ++i)
+		{
+			out[i] += delay[pos];
+			delay[pos] = in[i];
+
+			if (++pos == size)
+				pos = 0;
+		}
+
+		connection.delayPos = pos;
+	}
+}
+
+//==============================================================================
+juce::String FilterGraph::describe() const
+{
+	juce::String text;
+
+	for (auto& node : nodes)
+	{
+		auto kind = node->kind == NodeKind::input ? "input"
+			: node->kind == NodeKind::output ? "output"
+			: node->kind == NodeKind::eq ? "darQ"
+			: "bypassed";
+
+		text << juce::String(node->uid).paddedLeft(' ', 4) << "  " << node->name << " [" << kind << "]"
+			<< ", " << (int)node->inputs.size() << " inputs"
+			<< ", latency " << (node->processor != nullptr ? node->processor->getLatencySamples() : 0)
+			<< ", ready at " << node->pathLatency << "\n";
+	}
+
+	text << "total latency " << latency << " samples\n";
+	return text;
+}
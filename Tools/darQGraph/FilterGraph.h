@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+	FilterGraph: runs an AudioPluginHost .filtergraph file without a host.
+
+	The graph's "Audio Input" and "Audio Output" nodes become the file being
+	rendered; darQ nodes (saved as "darQ" or under the project's original
+	name, "SimpleEQ") are instantiated in process and get their saved state
+	back. Other plugins can't be loaded headless: they are an error unless
+	bypassing is allowed, in which case their inputs are passed straight
+	through.
+
+	Every block, nodes whose inputs are complete are handed to a
+	WorkStealingPool, so independent branches run in parallel. Branches that
+	merge are delay-compensated to the slowest of them.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "WorkStealingPool.h"
+
+class FilterGraph
+{
+public:
+	static std::unique_ptr<FilterGraph> load(const juce::File& file, bool bypassUnknown, juce::String& error);
+
+	/** Prepares every node; the input node offers numChannels channels. */
+	juce::String prepare(double sampleRate, int blockSize, int numChannels);
+	void release();
+
+	/** Total latency from the input node to the output node. */
+	int getLatencySamples() const noexcept { return latency; }
+
+	/** Highest output node channel anything is connected to, plus one. */
+	int getNumOutputChannels() const noexcept { return numOutputChannels; }
+
+	/** Runs one block. input holds the file's channels; output is overwritten. */
+	void process(WorkStealingPool& pool, const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output, int numSamples);
+
+	/** One line per node in evaluation order, with latencies. */
+	juce::String describe() const;
+
+private:
+	struct Node;
+
+	struct Connection
+	{
+		Node* source = nullptr;
+		int sourceChannel = 0, destChannel = 0;
+
+		// Lines this input up with the node's slowest input.
+		std::vector<float> delay;
+		int delayPos = 0;
+	};
+
+	enum class NodeKind { input, output, eq, bypass };
+
+	struct Node
+	{
+		int uid = 0;
+		NodeKind kind = NodeKind::bypass;
+		juce::String name;
+
+		std::unique_ptr<juce::AudioProcessor> processor;
+		juce::XmlElement layout{ "LAYOUT" };
+		juce::MemoryBlock state;
+
+		std::vector<Connection> inputs;
+		std::vector<Node*> successors;
+		int numChannels = 0;   // highest channel any connection uses, plus one
+		int numPredecessors = 0;
+		std::atomic<int> pending{ 0 };
+
+		juce::AudioBuffer<float> buffer;
+		juce::MidiBuffer midi;
+		int pathLatency = 0;
+	};
+
+	FilterGraph() = default;
+
+	juce::String sortNodes();
+	juce::String prepareNode(Node& node, double sampleRate, int blockSize, int numChannels);
+	void compensateLatency();
+
+	void runNode(Node& node);
+	void gatherInputs(Node& node, int numSamples);
+
+	static juce::MemoryBlock decodeState(const juce::String& text);
+
+	std::vector<std::unique_ptr<Node>> nodes;   // evaluation order once loaded
+	Node* inputNode = nullptr;
+	Node* outputNode = nullptr;
+	int latency = 0, numOutputChannels = 0;
+
+	// Per block
+	WorkStealingPool* currentPool = nullptr;
+	const juce::AudioBuffer<float>* currentInput = nullptr;
+	juce::AudioBuffer<float>* currentOutput = nullptr;
+	int currentNumSamples = 0;
+	std::atomic<int> nodesRemaining{ 0 };
+	juce::WaitableEvent blockDone;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterGraph)
+};
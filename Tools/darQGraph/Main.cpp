@@ -0,0 +1,262 @@
+/*
+  ==============================================================================
+
+	darQGraph: headless runner for AudioPluginHost filter graphs.
+
+	Loads a .filtergraph (e.g. simpleEq.filtergraph), instantiates its darQ
+	nodes in process and renders audio files through the graph. Within a
+	block, independent branches run in parallel on a work-stealing pool that
+	every file being rendered shares.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "FilterGraph.h"
+
+namespace
+{
+	struct GraphSettings
+	{
+		juce::File graphFile;
+		juce::File outputDir;
+		juce::String outputFormat;
+		int blockSize = 512;
+		int bitDepth = 24;
+		bool bypassUnknown = false;
+	};
+
+	void printUsage()
+	{
+		std::cout << "Usage: darQGraph [options] <graph.filtergraph> <input files...>\n"
+			"\n"
+			"  --output-dir <dir>     Where rendered files go (default: ./rendered)\n"
+			"  --format <wav|flac|aiff> Output format (default: same as input)\n"
+			"  --bits <16|24|32>      Output bit depth (default: 24)\n"
+			"  --block <samples>      Processing block size (default: 512)\n"
+			"  --threads <n>          Work-stealing threads running graph nodes (default: all cores)\n"
+			"  --files <n>            Files rendered at the same time (default: 2)\n"
+			"  --bypass-unknown       Pass audio through plugins that can't run headless\n"
+			"  --describe             Print the graph in evaluation order and exit\n";
+	}
+
+	//==============================================================================
+	class GraphJob : public juce::ThreadPoolJob
+	{
+	public:
+		GraphJob(const juce::File& inputFile, const GraphSettings& graphSettings, WorkStealingPool& nodePool,
+			juce::AudioFormatManager& manager, juce::TimeSliceThread& readAhead)
+			: juce::ThreadPoolJob(inputFile.getFileName()),
+			input(inputFile), settings(graphSettings), pool(nodePool), formatManager(manager), readAheadThread(readAhead)
+		{
+		}
+
+		JobStatus runJob() override
+		{
+			auto start = juce::Time::getMillisecondCounterHiRes();
+			result = render();
+
+			if (result.isEmpty())
+				result = "ok (" + juce::String((juce::Time::getMillisecondCounterHiRes() - start) / 1000.0, 2) + " s)";
+			else
+				failed = true;
+
+			return jobHasFinished;
+		}
+
+		const juce::File input;
+		juce::String result;
+		bool failed = false;
+
+	private:
+		juce::String render()
+		{
+			std::unique_ptr<juce::AudioFormatReader> source(formatManager.createReaderFor(input));
+			if (source == nullptr)
+				return "can't read file";
+
+			const auto numChannels = (int)source->numChannels;
+			const auto sampleRate = source->sampleRate;
+			const auto length = source->lengthInSamples;
+			const auto metadata = source->metadataValues;
+
+			auto extension = settings.outputFormat.isNotEmpty() ? "." + settings.outputFormat : input.getFileExtension();
+			auto* format = formatManager.findFormatForFileExtension(extension);
+			if (format == nullptr)
+				return "no writer for " + extension;
+
+			// Every file gets its own graph: nodes keep per-stream state.
+			juce::String error;
+			auto graph = FilterGraph::load(settings.graphFile, settings.bypassUnknown, error);
+			if (graph == nullptr)
+				return error;
+
+			if (error = graph->prepare(sampleRate, settings.blockSize, numChannels); error.isNotEmpty())
+				return error;
+
+			auto numOutputChannels = graph->getNumOutputChannels();
+			if (numOutputChannels == 0)
+				return "nothing is connected to the Audio Output node";
+
+			juce::BufferingAudioReader reader(source.release(), readAheadThread, 4 * 65536);
+			reader.setReadTimeout(10000);
+
+			auto outFile = settings.outputDir.getChildFile(input.getFileNameWithoutExtension() + extension);
+			outFile.deleteFile();
+
+			std::unique_ptr<juce::OutputStream> stream = std::make_unique<juce::FileOutputStream>(outFile);
+			if (static_cast<juce::FileOutputStream*>(stream.get())->failedToOpen())
+				return "can't write " + outFile.getFullPathName();
+
+			std::unique_ptr<juce::AudioFormatWriter> writer(format->createWriterFor(stream.get(), sampleRate,
+				(unsigned int)numOutputChannels, settings.bitDepth, metadata, 0));
+			if (writer == nullptr)
+				return "writer rejected " + juce::String(settings.bitDepth) + " bit / " + juce::String(numOutputChannels) + " channels";
+
+			stream.release(); // now owned by the writer
+
+			juce::AudioBuffer<float> inBuffer(numChannels, settings.blockSize);
+			juce::AudioBuffer<float> outBuffer(numOutputChannels, settings.blockSize);
+
+			// Skip the graph's latency at the start and flush it at the end, as
+			// darQRender does.
+			auto latency = (juce::int64)graph->getLatencySamples();
+			auto toSkip = latency;
+
+			for (juce::int64 pos = 0; pos < length + latency; pos += settings.blockSize)
+			{
+				auto num = (int)juce::jmin((juce::int64)settings.blockSize, length + latency - pos);
+
+				inBuffer.clear();
+				if (pos < length)
+					reader.read(&inBuffer, 0, (int)juce::jmin((juce::int64)num, length - pos), pos, true, numChannels > 1);
+
+				graph->process(pool, inBuffer, outBuffer, num);
+
+				auto skip = (int)juce::jmin((juce::int64)num, toSkip);
+				toSkip -= skip;
+
+				if (num > skip && ! writer->writeFromAudioSampleBuffer(outBuffer, skip, num - skip))
+					return "write failed";
+			}
+
+			graph->release();
+			return {};
+		}
+
+		GraphSettings settings;
+		WorkStealingPool& pool;
+		juce::AudioFormatManager& formatManager;
+		juce::TimeSliceThread& readAheadThread;
+	};
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+	juce::ScopedJuceInitialiser_GUI juceInitialiser;
+	juce::ArgumentList args(argc, argv);
+
+	if (args.size() == 0 || args.containsOption("--help|-h"))
+	{
+		printUsage();
+		return 0;
+	}
+
+	GraphSettings settings;
+	settings.bypassUnknown = args.removeOptionIfFound("--bypass-unknown");
+
+	auto describeOnly = args.removeOptionIfFound("--describe");
+
+	// Options are removed along with their values, leaving the graph and the inputs.
+	settings.outputDir = args.containsOption("--output-dir")
+		? juce::File::getCurrentWorkingDirectory().getChildFile(args.removeValueForOption("--output-dir"))
+		: juce::File::getCurrentWorkingDirectory().getChildFile("rendered");
+	settings.outputFormat = args.removeValueForOption("--format").trimCharactersAtStart(".").toLowerCase();
+
+	if (args.containsOption("--block"))
+		settings.blockSize = juce::jlimit(1, 65536, args.removeValueForOption("--block").getIntValue());
+
+	if (args.containsOption("--bits"))
+		settings.bitDepth = args.removeValueForOption("--bits").getIntValue();
+
+	auto numThreads = args.containsOption("--threads") ? args.removeValueForOption("--threads").getIntValue()
+		: juce::SystemStats::getNumCpus();
+	auto numFiles = args.containsOption("--files") ? args.removeValueForOption("--files").getIntValue() : 2;
+
+	juce::Array<juce::File> inputs;
+	for (auto& arg : args.arguments)
+		if (! arg.isOption() && ! arg.isLongOption() && ! arg.isShortOption())
+			inputs.add(arg.resolveAsFile());
+
+	if (inputs.isEmpty())
+	{
+		std::cerr << "No filter graph\n";
+		return 1;
+	}
+
+	settings.graphFile = inputs.removeAndReturn(0);
+
+	if (describeOnly)
+	{
+		juce::String error;
+		auto graph = FilterGraph::load(settings.graphFile, settings.bypassUnknown, error);
+
+		if (graph == nullptr || (error = graph->prepare(48000.0, settings.blockSize, 2)).isNotEmpty())
+		{
+			std::cerr << error << "\n";
+			return 1;
+		}
+
+		std::cout << graph->describe();
+		graph->release();
+		return 0;
+	}
+
+	if (inputs.isEmpty())
+	{
+		std::cerr << "No input files\n";
+		return 1;
+	}
+
+	if (auto result = settings.outputDir.createDirectory(); result.failed())
+	{
+		std::cerr << result.getErrorMessage() << "\n";
+		return 1;
+	}
+
+	juce::AudioFormatManager formatManager;
+	formatManager.registerBasicFormats();
+
+	juce::TimeSliceThread readAheadThread("darQGraph read-ahead");
+	readAheadThread.startThread();
+
+	WorkStealingPool nodePool(numThreads);
+
+	{
+		// File drivers mostly wait on their blocks; the node pool does the work.
+		juce::ThreadPool filePool(juce::jlimit(1, inputs.size(), numFiles));
+		juce::OwnedArray<GraphJob> jobs;
+
+		for (auto& input : inputs)
+		{
+			auto* job = jobs.add(new GraphJob(input, settings, nodePool, formatManager, readAheadThread));
+			filePool.addJob(job, false);
+		}
+
+		while (filePool.getNumJobs() > 0)
+			juce::Thread::sleep(50);
+
+		readAheadThread.stopThread(1000);
+
+		auto failures = 0;
+		for (auto* job : jobs)
+		{
+			std::cout << job->input.getFileName() << ": " << job->result << "\n";
+			failures += job->failed ? 1 : 0;
+		}
+
+		std::cout << "steals: " << nodePool.getNumSteals() << "\n";
+		return failures == 0 ? 0 : 1;
+	}
+}
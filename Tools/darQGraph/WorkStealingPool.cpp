@@ -0,0 +1,118 @@
+#include "WorkStealingPool.h"
+
+namespace
+{
+	// Which pool and deque the calling thread works for, if any.
+	thread_local const WorkStealingPool* currentPool = nullptr;
+	thread_local int currentWorker = -1;
+}
+
+class WorkStealingPool::Worker : public juce::Thread
+{
+public:
+	Worker(WorkStealingPool& owner, int workerIndex)
+		: juce::Thread("darQGraph worker " + juce::String(workerIndex)), pool(owner), index(workerIndex)
+	{
+	}
+
+	void run() override
+	{
+		currentPool = &pool;
+		currentWorker = index;
+		pool.workerLoop(index);
+	}
+
+private:
+	WorkStealingPool& pool;
+	const int index;
+};
+
+WorkStealingPool::WorkStealingPool(int numWorkers)
+{
+	numWorkers = juce::jmax(1, numWorkers);
+
+	for (int i = 0; i < numWorkers; ++i)
+		queues.push_back(std::make_unique<Queue>());
+
+	for (int i = 0; i < numWorkers; ++i)
+		workers.add(new Worker(*this, i))->startThread();
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		const std::lock_guard<std::mutex> sl(sleepLock);
+		stopping = true;
+	}
+
+	wake.notify_all();
+
+	for (auto* worker : workers)
+		worker->stopThread(-1);
+}
+
+void WorkStealingPool::submit(Task task)
+{
+	auto index = currentPool == this ? currentWorker : (int)(nextQueue++ % (unsigned int)queues.size());
+
+	{
+		auto& queue = *queues[(size_t)index];
+		const std::lock_guard<std::mutex> sl(queue.lock);
+		queue.tasks.push_back(std::move(task));
+	}
+
+	queuedTasks.fetch_add(1);
+
+	{
+		// Taking the lock orders this with a worker that is about to sleep.
+		const std::lock_guard<std::mutex> sl(sleepLock);
+	}
+
+	wake.notify_one();
+}
+
+bool WorkStealingPool::runOne(int self)
+{
+	Task task;
+	auto numQueues = (int)queues.size();
+
+	for (int k = 0; k < numQueues && task == nullptr; ++k)
+	{
+		auto& queue = *queues[(size_t)((self + k) % numQueues)];
+		const std::lock_guard<std::mutex> sl(queue.lock);
+
+		if (queue.tasks.empty())
+			continue;
+
+		if (k == 0)
+		{
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+		}
+		else
+		{
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			steals.fetch_add(1);
+		}
+	}
+
+	if (task == nullptr)
+		return false;
+
+	queuedTasks.fetch_sub(1);
+	task();
+	return true;
+}
+
+void WorkStealingPool::workerLoop(int self)
+{
+	while (! stopping)
+	{
+		if (runOne(self))
+			continue;
+
+		std::unique_lock<std::mutex> sl(sleepLock);
+		wake.wait(sl, [this] { return stopping || queuedTasks.load() > 0; });
+	}
+}
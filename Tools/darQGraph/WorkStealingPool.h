@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+	Work-stealing thread pool for darQGraph.
+
+	Every worker owns a deque. Tasks submitted from a worker go to the back of
+	its own deque and are popped from there (newest first, so a node's
+	successors run while its output is still in cache); tasks submitted from
+	any other thread are dealt round robin. An idle worker steals from the
+	front of the other workers' deques before going to sleep.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+class WorkStealingPool
+{
+public:
+	using Task = std::function<void()>;
+
+	explicit WorkStealingPool(int numWorkers);
+	~WorkStealingPool();
+
+	void submit(Task task);
+
+	int getNumWorkers() const noexcept { return (int)queues.size(); }
+
+	/** Tasks taken from another worker's deque so far. */
+	juce::int64 getNumSteals() const noexcept { return steals.load(); }
+
+private:
+	class Worker;
+
+	struct Queue
+	{
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+
+	bool runOne(int self);
+	void workerLoop(int self);
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	juce::OwnedArray<Worker> workers;
+
+	std::mutex sleepLock;
+	std::condition_variable wake;
+	std::atomic<int> queuedTasks{ 0 };
+	std::atomic<bool> stopping{ false };
+	std::atomic<unsigned int> nextQueue{ 0 };
+	std::atomic<juce::int64> steals{ 0 };
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WorkStealingPool)
+};
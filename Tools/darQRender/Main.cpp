@@ -0,0 +1,373 @@
+/*
+  ==============================================================================
+
+	darQRender: headless batch renderer for the darQ processor.
+
+	Streams audio files through SimpleEQAudioProcessor without an editor, one
+	file per worker thread, and can export the configured frequency response
+	as CSV.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+	struct RenderSettings
+	{
+		juce::MemoryBlock state;
+		juce::StringPairArray parameters;
+		juce::File outputDir;
+		juce::String outputFormat;
+		int blockSize = 512;
+		int bitDepth = 24;
+	};
+
+	void printUsage()
+	{
+		std::cout << "Usage: darQRender [options] <input files...>\n"
+			"\n"
+			"  --state <file>         Plugin state blob saved by getStateInformation\n"
+			"  --param \"<id>=<value>\" Set a parameter (plain value, repeatable), e.g. --param \"Peak Gain=6\"\n"
+			"  --output-dir <dir>     Where rendered files go (default: ./rendered)\n"
+			"  --format <wav|flac|aiff> Output format (default: same as input)\n"
+			"  --bits <16|24|32>      Output bit depth (default: 24)\n"
+			"  --block <samples>      Processing block size (default: 512)\n"
+			"  --threads <n>          Worker threads (default: all cores)\n"
+			"  --response <file.csv>  Export magnitude/phase response instead of rendering\n"
+			"  --sample-rate <hz>     Sample rate for --response (default: 48000)\n"
+			"  --points <n>           Number of log-spaced points for --response (default: 512)\n"
+			"  --list-params          Print all parameter IDs and ranges\n";
+	}
+
+	juce::String applySettings(SimpleEQAudioProcessor& processor, const RenderSettings& settings)
+	{
+		if (settings.state.getSize() > 0)
+			processor.setStateInformation(settings.state.getData(), (int)settings.state.getSize());
+
+		for (auto& id : settings.parameters.getAllKeys())
+		{
+			auto* parameter = processor.apvts.getParameter(id);
+			if (parameter == nullptr)
+				return "Unknown parameter: " + id;
+
+			auto value = settings.parameters[id].getFloatValue();
+			parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+		}
+
+		return {};
+	}
+
+	//==============================================================================
+	class RenderJob : public juce::ThreadPoolJob
+	{
+	public:
+		RenderJob(const juce::File& inputFile, const RenderSettings& renderSettings,
+			juce::AudioFormatManager& manager, juce::TimeSliceThread& readAhead)
+			: juce::ThreadPoolJob(inputFile.getFileName()),
+			input(inputFile), settings(renderSettings), formatManager(manager), readAheadThread(readAhead)
+		{
+		}
+
+		JobStatus runJob() override
+		{
+			auto start = juce::Time::getMillisecondCounterHiRes();
+			result = render();
+
+			if (result.isEmpty())
+				result = "ok (" + juce::String((juce::Time::getMillisecondCounterHiRes() - start) / 1000.0, 2) + " s)";
+			else
+				failed = true;
+
+			return jobHasFinished;
+		}
+
+		const juce::File input;
+		juce::String result;
+		bool failed = false;
+
+	private:
+		juce::String render()
+		{
+			std::unique_ptr<juce::AudioFormatReader> source(formatManager.createReaderFor(input));
+			if (source == nullptr)
+				return "can't read file";
+
+			const auto numChannels = (int)source->numChannels;
+			const auto sampleRate = source->sampleRate;
+			const auto length = source->lengthInSamples;
+			const auto metadata = source->metadataValues;
+
+			if (numChannels < 1 || numChannels > 2)
+				return "only mono and stereo files are supported";
+
+			auto extension = settings.outputFormat.isNotEmpty() ? "." + settings.outputFormat : input.getFileExtension();
+			auto* format = formatManager.findFormatForFileExtension(extension);
+			if (format == nullptr)
+				return "no writer for " + extension;
+
+			// Reads ahead of the processing loop on the shared read-ahead thread.
+			juce::BufferingAudioReader reader(source.release(), readAheadThread, 4 * 65536);
+			reader.setReadTimeout(10000);
+
+			SimpleEQAudioProcessor processor;
+
+			auto layout = processor.getBusesLayout();
+			auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+			layout.inputBuses.getReference(0) = channelSet;
+			layout.outputBuses.getReference(0) = channelSet;
+
+			if (! processor.setBusesLayout(layout))
+				return "unsupported channel layout";
+
+			if (auto error = applySettings(processor, settings); error.isNotEmpty())
+				return error;
+
+			processor.setNonRealtime(true);
+			processor.setRateAndBufferSizeDetails(sampleRate, settings.blockSize);
+			processor.prepareToPlay(sampleRate, settings.blockSize);
+
+			juce::AudioBuffer<float> buffer(juce::jmax(processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels()),
+				settings.blockSize);
+			juce::MidiBuffer midi;
+
+			// Linear-phase kernels are designed asynchronously; prime with silence.
+			for (int waited = 0; ! processor.isReadyToRender() && waited < 30000; waited += 10)
+			{
+				buffer.clear();
+				processor.processBlock(buffer, midi);
+				juce::Thread::sleep(10);
+			}
+
+			auto outFile = settings.outputDir.getChildFile(input.getFileNameWithoutExtension() + extension);
+
+			// Rendering over the input would delete it before it's read.
+			if (outFile == input)
+				return "output would overwrite the input; choose another --output-dir or --format";
+
+			outFile.deleteFile();
+
+			std::unique_ptr<juce::OutputStream> stream = std::make_unique<juce::FileOutputStream>(outFile);
+			if (static_cast<juce::FileOutputStream*>(stream.get())->failedToOpen())
+				return "can't write " + outFile.getFullPathName();
+
+			std::unique_ptr<juce::AudioFormatWriter> writer(format->createWriterFor(stream.get(), sampleRate,
+				(unsigned int)numChannels, settings.bitDepth, metadata, 0));
+			if (writer == nullptr)
+				return "writer rejected " + juce::String(settings.bitDepth) + " bit / " + juce::String(numChannels) + " channels";
+
+			stream.release(); // now owned by the writer
+
+			// Skip the processor's latency at the start and flush it at the end,
+			// so the output lines up with the input.
+			auto latency = (juce::int64)processor.getLatencySamples();
+			auto toSkip = latency;
+
+			for (juce::int64 pos = 0; pos < length + latency; pos += settings.blockSize)
+			{
+				auto num = (int)juce::jmin((juce::int64)settings.blockSize, length + latency - pos);
+
+				buffer.clear();
+				if (pos < length)
+					reader.read(&buffer, 0, (int)juce::jmin((juce::int64)num, length - pos), pos, true, numChannels > 1);
+
+				juce::AudioBuffer<float> view(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), num);
+				processor.processBlock(view, midi);
+
+				auto skip = (int)juce::jmin((juce::int64)num, toSkip);
+				toSkip -= skip;
+
+				if (num > skip && ! writer->writeFromAudioSampleBuffer(view, skip, num - skip))
+					return "write failed";
+			}
+
+			processor.releaseResources();
+			return {};
+		}
+
+		RenderSettings settings;
+		juce::AudioFormatManager& formatManager;
+		juce::TimeSliceThread& readAheadThread;
+	};
+
+	//==============================================================================
+	int exportResponse(const RenderSettings& settings, const juce::File& csvFile, double sampleRate, int numPoints)
+	{
+		SimpleEQAudioProcessor processor;
+
+		if (auto error = applySettings(processor, settings); error.isNotEmpty())
+		{
+			std::cerr << error << "\n";
+			return 1;
+		}
+
+		auto midSide = processor.apvts.getRawParameterValue("Stereo Mode")->load() > 0.5f;
+
+		std::vector<double> frequencies((size_t)numPoints), magnitudes((size_t)numPoints), phases((size_t)numPoints);
+		std::vector<double> sideMagnitudes((size_t)numPoints), sidePhases((size_t)numPoints);
+
+		auto lowest = 10.0, highest = sampleRate * 0.5;
+		for (int i = 0; i < numPoints; ++i)
+			frequencies[(size_t)i] = lowest * std::pow(highest / lowest, (double)i / (numPoints - 1));
+
+		processor.getFrequencyResponse(sampleRate, frequencies.data(), magnitudes.data(), phases.data(), frequencies.size());
+
+		if (midSide)
+			processor.getFrequencyResponse(sampleRate, frequencies.data(), sideMagnitudes.data(), sidePhases.data(), frequencies.size(), true);
+
+		juce::String csv;
+		csv << (midSide ? "frequency_hz,mid_magnitude_db,mid_phase_deg,side_magnitude_db,side_phase_deg\n"
+			: "frequency_hz,magnitude_db,phase_deg\n");
+
+		for (size_t i = 0; i < frequencies.size(); ++i)
+		{
+			csv << juce::String(frequencies[i], 3) << ","
+				<< juce::String(juce::Decibels::gainToDecibels(magnitudes[i], -300.0), 4) << ","
+				<< juce::String(juce::radiansToDegrees(phases[i]), 4);
+
+			if (midSide)
+				csv << "," << juce::String(juce::Decibels::gainToDecibels(sideMagnitudes[i], -300.0), 4)
+					<< "," << juce::String(juce::radiansToDegrees(sidePhases[i]), 4);
+
+			csv << "\n";
+		}
+
+		if (! csvFile.replaceWithText(csv))
+		{
+			std::cerr << "Can't write " << csvFile.getFullPathName() << "\n";
+			return 1;
+		}
+
+		std::cout << "Wrote " << numPoints << " points to " << csvFile.getFullPathName() << "\n";
+		return 0;
+	}
+
+	void listParameters()
+	{
+		SimpleEQAudioProcessor processor;
+
+		for (auto* parameter : processor.getParameters())
+			if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+				std::cout << ranged->getParameterID() << "  [" << ranged->getNormalisableRange().start
+					<< " .. " << ranged->getNormalisableRange().end << "]  default "
+					<< ranged->convertFrom0to1(ranged->getDefaultValue()) << "\n";
+	}
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+	juce::ScopedJuceInitialiser_GUI juceInitialiser;
+	juce::ArgumentList args(argc, argv);
+
+	if (args.size() == 0 || args.containsOption("--help|-h"))
+	{
+		printUsage();
+		return 0;
+	}
+
+	if (args.containsOption("--list-params"))
+	{
+		listParameters();
+		return 0;
+	}
+
+	RenderSettings settings;
+
+	if (args.containsOption("--state"))
+	{
+		auto stateFile = juce::File::getCurrentWorkingDirectory().getChildFile(args.removeValueForOption("--state"));
+		if (! stateFile.loadFileAsData(settings.state))
+		{
+			std::cerr << "Can't read state file " << stateFile.getFullPathName() << "\n";
+			return 1;
+		}
+	}
+
+	while (args.containsOption("--param"))
+	{
+		auto assignment = args.removeValueForOption("--param");
+		auto id = assignment.upToLastOccurrenceOf("=", false, false).trim();
+		auto value = assignment.fromLastOccurrenceOf("=", false, false).trim();
+
+		if (id.isEmpty() || value.isEmpty())
+		{
+			std::cerr << "Bad --param \"" << assignment << "\", expected \"<id>=<value>\"\n";
+			return 1;
+		}
+
+		settings.parameters.set(id, value);
+	}
+
+	if (args.containsOption("--response"))
+	{
+		auto sampleRate = args.containsOption("--sample-rate") ? args.removeValueForOption("--sample-rate").getDoubleValue() : 48000.0;
+		auto numPoints = args.containsOption("--points") ? args.removeValueForOption("--points").getIntValue() : 512;
+		auto responseFile = juce::File::getCurrentWorkingDirectory().getChildFile(args.removeValueForOption("--response"));
+
+		return exportResponse(settings, responseFile, sampleRate, juce::jmax(2, numPoints));
+	}
+
+	// Options are removed along with their values, leaving only the inputs.
+	settings.outputDir = args.containsOption("--output-dir")
+		? juce::File::getCurrentWorkingDirectory().getChildFile(args.removeValueForOption("--output-dir"))
+		: juce::File::getCurrentWorkingDirectory().getChildFile("rendered");
+	settings.outputFormat = args.removeValueForOption("--format").trimCharactersAtStart(".").toLowerCase();
+
+	if (args.containsOption("--block"))
+		settings.blockSize = juce::jlimit(1, 65536, args.removeValueForOption("--block").getIntValue());
+
+	if (args.containsOption("--bits"))
+		settings.bitDepth = args.removeValueForOption("--bits").getIntValue();
+
+	auto numThreads = args.containsOption("--threads") ? args.removeValueForOption("--threads").getIntValue()
+		: juce::SystemStats::getNumCpus();
+
+	if (auto result = settings.outputDir.createDirectory(); result.failed())
+	{
+		std::cerr << result.getErrorMessage() << "\n";
+		return 1;
+	}
+
+	juce::Array<juce::File> inputs;
+	for (auto& arg : args.arguments)
+		if (! arg.isOption() && ! arg.isLongOption() && ! arg.isShortOption())
+			inputs.add(arg.resolveAsFile());
+
+	if (inputs.isEmpty())
+	{
+		std::cerr << "No input files\n";
+		return 1;
+	}
+
+	juce::AudioFormatManager formatManager;
+	formatManager.registerBasicFormats();
+
+	juce::TimeSliceThread readAheadThread("darQRender read-ahead");
+	readAheadThread.startThread();
+
+	juce::ThreadPool pool(juce::jlimit(1, inputs.size(), numThreads));
+	juce::OwnedArray<RenderJob> jobs;
+
+	for (auto& input : inputs)
+	{
+		auto* job = jobs.add(new RenderJob(input, settings, formatManager, readAheadThread));
+		pool.addJob(job, false);
+	}
+
+	while (pool.getNumJobs() > 0)
+		juce::Thread::sleep(50);
+
+	readAheadThread.stopThread(1000);
+
+	auto failures = 0;
+	for (auto* job : jobs)
+	{
+		std::cout << job->input.getFileName() << ": " << job->result << "\n";
+		failures += job->failed ? 1 : 0;
+	}
+
+	return failures == 0 ? 0 : 1;
+}